@@ -0,0 +1,533 @@
+// allocbench.m.cpp                                                   -*-C++-*-
+
+//@PURPOSE: Measure the performance of BDE allocators on realistic workloads.
+//
+//@DESCRIPTION: This program runs each selected workload (see
+// 'allocbench_workload') against each selected allocator (see
+// 'allocbench_subject') and writes one machine-readable record per pair.  Each
+// pair is run three times, with a freshly created allocator each time:
+//
+//: 1 A timed run, with every thread using the allocator under test directly,
+//:   which yields the wall time, the throughput (work items per second), and
+//:   the growth in the resident set size of the process.
+//:
+//: 2 A latency run, with every thread using its own 'LatencyProbe', which
+//:   yields percentiles of the duration of sampled 'allocate' and
+//:   'deallocate' calls.
+//:
+//: 3 A footprint run, with all threads using one 'FootprintTracker', which
+//:   yields the number of calls, the peak number of bytes live in the
+//:   workload, the peak number of bytes the allocator obtained upstream, and
+//:   their ratio (the fragmentation).
+//
+// The instrumented runs are separate from the timed run so that the
+// instrumentation does not perturb the throughput figures.  Note that the
+// resident-set-size figures are process-wide: for clean figures, run a
+// single allocator and workload per process.
+//
+// Usage:
+//..
+//  allocbench [--allocator NAME[,NAME...]] [--workload NAME[,NAME...]]
+//             [--rounds N] [--items N] [--threads N] [--seed N]
+//             [--sample-interval N] [--format json|csv] [--output FILE]
+//             [--list]
+//..
+
+#include <allocbench_instrument.h>
+#include <allocbench_subject.h>
+#include <allocbench_workload.h>
+
+#include <bslma_managedptr.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+                               // =============
+                               // struct Record
+                               // =============
+
+struct Record {
+    // This 'struct' holds the measurements of one workload run against one
+    // allocator.
+
+    bsl::string_view           d_allocator;
+    bsl::string_view           d_workload;
+    int                        d_numThreads;
+    int                        d_numRounds;
+    bsls::Types::Int64         d_numItems;
+    double                     d_wallSeconds;
+    bsls::Types::Int64         d_numAllocations;
+    bsls::Types::Int64         d_numDeallocations;
+    allocbench::LatencySummary d_allocateLatency;
+    allocbench::LatencySummary d_deallocateLatency;
+    bsls::Types::Int64         d_peakRequestedBytes;
+    bsls::Types::Int64         d_peakUpstreamBytes;   // -1 if unknown
+    bsls::Types::Int64         d_rssGrowthBytes;      // -1 if unknown
+    bsls::Types::Int64         d_peakRssBytes;        // -1 if unknown
+};
+
+                                // ===========
+                                // struct Args
+                                // ===========
+
+struct Args {
+    // This 'struct' holds the parsed command line.
+
+    bsl::vector<bsl::string>   d_allocators;
+    bsl::vector<bsl::string>   d_workloads;
+    allocbench::WorkloadConfig d_config;
+    int                        d_sampleInterval;
+    bool                       d_csv;
+    bsl::string                d_output;
+    bool                       d_list;
+};
+
+void split(bsl::vector<bsl::string> *result, const char *list)
+    // Append to the specified 'result' the comma-separated elements of the
+    // specified 'list'.
+{
+    const char *begin = list;
+    for (;;) {
+        const char *end = bsl::strchr(begin, ',');
+        if (!end) {
+            result->push_back(bsl::string(begin));
+            return;                                                   // RETURN
+        }
+        result->push_back(bsl::string(begin, end));
+        begin = end + 1;
+    }
+}
+
+int parseArgs(Args *result, int argc, char *argv[])
+    // Load into the specified 'result' the options specified by 'argc' and
+    // 'argv'.  Return 0 on success, and a non-zero value (after printing a
+    // diagnostic) otherwise.
+{
+    result->d_config.d_numRounds        = 5;
+    result->d_config.d_numItemsPerRound = 20000;
+    result->d_config.d_numThreads       = 2;
+    result->d_config.d_seed             = 1;
+    result->d_sampleInterval            = 16;
+    result->d_csv                       = false;
+    result->d_list                      = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const bsl::string_view option(argv[i]);
+
+        if ("--list" == option) {
+            result->d_list = true;
+            continue;
+        }
+
+        if (i + 1 == argc) {
+            bsl::cerr << "missing value for " << option << '\n';
+            return -1;                                                // RETURN
+        }
+        const char *value = argv[++i];
+
+        if ("--allocator" == option) {
+            split(&result->d_allocators, value);
+        }
+        else if ("--workload" == option) {
+            split(&result->d_workloads, value);
+        }
+        else if ("--rounds" == option) {
+            result->d_config.d_numRounds = bsl::atoi(value);
+        }
+        else if ("--items" == option) {
+            result->d_config.d_numItemsPerRound = bsl::atoi(value);
+        }
+        else if ("--threads" == option) {
+            result->d_config.d_numThreads = bsl::atoi(value);
+        }
+        else if ("--seed" == option) {
+            result->d_config.d_seed = static_cast<unsigned>(
+                                                         bsl::atoi(value));
+        }
+        else if ("--sample-interval" == option) {
+            result->d_sampleInterval = bsl::atoi(value);
+        }
+        else if ("--format" == option) {
+            if (0 == bsl::strcmp(value, "csv")) {
+                result->d_csv = true;
+            }
+            else if (0 != bsl::strcmp(value, "json")) {
+                bsl::cerr << "unknown format: " << value << '\n';
+                return -1;                                            // RETURN
+            }
+        }
+        else if ("--output" == option) {
+            result->d_output = value;
+        }
+        else {
+            bsl::cerr << "unknown option: " << option << '\n';
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (result->d_config.d_numRounds < 1
+     || result->d_config.d_numItemsPerRound < 1
+     || result->d_config.d_numThreads < 1
+     || result->d_sampleInterval < 1) {
+        bsl::cerr << "numeric options must be positive\n";
+        return -1;                                                    // RETURN
+    }
+
+    bsl::vector<bsl::string_view> names;
+    if (result->d_allocators.empty()) {
+        allocbench::SubjectUtil::names(&names);
+        result->d_allocators.assign(names.begin(), names.end());
+    }
+    if (result->d_workloads.empty()) {
+        allocbench::WorkloadUtil::names(&names);
+        result->d_workloads.assign(names.begin(), names.end());
+    }
+    return 0;
+}
+
+void printOptional(bsl::ostream& stream, bsls::Types::Int64 value, bool json)
+    // Write the specified 'value' to the specified 'stream', or, if 'value' is
+    // negative (i.e., unknown), write 'null' if the specified 'json' is 'true'
+    // and nothing otherwise.
+{
+    if (0 <= value) {
+        stream << value;
+    }
+    else if (json) {
+        stream << "null";
+    }
+}
+
+void printFragmentation(bsl::ostream& stream, const Record& record, bool json)
+    // Write the fragmentation of the specified 'record' to the specified
+    // 'stream', or, if it is unknown, write 'null' if the specified 'json' is
+    // 'true' and nothing otherwise.
+{
+    if (0 <= record.d_peakUpstreamBytes && 0 < record.d_peakRequestedBytes) {
+        stream << static_cast<double>(record.d_peakUpstreamBytes)
+                                   / static_cast<double>(
+                                                 record.d_peakRequestedBytes);
+    }
+    else if (json) {
+        stream << "null";
+    }
+}
+
+void printCsvHeader(bsl::ostream& stream)
+    // Write the header line of the CSV format to the specified 'stream'.
+{
+    stream << "allocator,workload,threads,rounds,items,wall_seconds,"
+              "items_per_second,allocations,deallocations,"
+              "allocate_p50_ns,allocate_p90_ns,allocate_p99_ns,"
+              "allocate_p999_ns,allocate_max_ns,"
+              "deallocate_p50_ns,deallocate_p90_ns,deallocate_p99_ns,"
+              "deallocate_p999_ns,deallocate_max_ns,"
+              "peak_requested_bytes,peak_upstream_bytes,fragmentation,"
+              "rss_growth_bytes,peak_rss_bytes\n";
+}
+
+void printLatency(bsl::ostream&                     stream,
+                  const char                       *prefix,
+                  const allocbench::LatencySummary& summary,
+                  bool                              json)
+    // Write the specified latency 'summary' to the specified 'stream', naming
+    // the fields with the specified 'prefix' if the specified 'json' is
+    // 'true'.
+{
+    if (json) {
+        stream << ",\"" << prefix << "_p50_ns\":"  << summary.d_p50
+               << ",\"" << prefix << "_p90_ns\":"  << summary.d_p90
+               << ",\"" << prefix << "_p99_ns\":"  << summary.d_p99
+               << ",\"" << prefix << "_p999_ns\":" << summary.d_p999
+               << ",\"" << prefix << "_max_ns\":"  << summary.d_max;
+    }
+    else {
+        stream << ',' << summary.d_p50
+               << ',' << summary.d_p90
+               << ',' << summary.d_p99
+               << ',' << summary.d_p999
+               << ',' << summary.d_max;
+    }
+}
+
+void printRecord(bsl::ostream& stream, const Record& record, bool json)
+    // Write the specified 'record' to the specified 'stream' as a JSON object
+    // on one line if the specified 'json' is 'true', and as a CSV line
+    // otherwise.
+{
+    const double itemsPerSecond = 0 < record.d_wallSeconds
+                                ? static_cast<double>(record.d_numItems)
+                                                         / record.d_wallSeconds
+                                : 0;
+
+    if (json) {
+        stream << "{\"allocator\":\"" << record.d_allocator << '"'
+               << ",\"workload\":\""  << record.d_workload  << '"'
+               << ",\"threads\":"           << record.d_numThreads
+               << ",\"rounds\":"            << record.d_numRounds
+               << ",\"items\":"             << record.d_numItems
+               << ",\"wall_seconds\":"      << record.d_wallSeconds
+               << ",\"items_per_second\":"  << itemsPerSecond
+               << ",\"allocations\":"       << record.d_numAllocations
+               << ",\"deallocations\":"     << record.d_numDeallocations;
+        printLatency(stream, "allocate",   record.d_allocateLatency,   true);
+        printLatency(stream, "deallocate", record.d_deallocateLatency, true);
+        stream << ",\"peak_requested_bytes\":" << record.d_peakRequestedBytes
+               << ",\"peak_upstream_bytes\":";
+        printOptional(stream, record.d_peakUpstreamBytes, true);
+        stream << ",\"fragmentation\":";
+        printFragmentation(stream, record, true);
+        stream << ",\"rss_growth_bytes\":";
+        printOptional(stream, record.d_rssGrowthBytes, true);
+        stream << ",\"peak_rss_bytes\":";
+        printOptional(stream, record.d_peakRssBytes, true);
+        stream << "}\n";
+    }
+    else {
+        stream << record.d_allocator
+               << ',' << record.d_workload
+               << ',' << record.d_numThreads
+               << ',' << record.d_numRounds
+               << ',' << record.d_numItems
+               << ',' << record.d_wallSeconds
+               << ',' << itemsPerSecond
+               << ',' << record.d_numAllocations
+               << ',' << record.d_numDeallocations;
+        printLatency(stream, "allocate",   record.d_allocateLatency,   false);
+        printLatency(stream, "deallocate", record.d_deallocateLatency, false);
+        stream << ',' << record.d_peakRequestedBytes << ',';
+        printOptional(stream, record.d_peakUpstreamBytes, false);
+        stream << ',';
+        printFragmentation(stream, record, false);
+        stream << ',';
+        printOptional(stream, record.d_rssGrowthBytes, false);
+        stream << ',';
+        printOptional(stream, record.d_peakRssBytes, false);
+        stream << '\n';
+    }
+    stream.flush();
+}
+
+void measure(Record                      *record,
+             const allocbench::Workload&  workload,
+             const bsl::string_view&      subjectName,
+             const Args&                  args)
+    // Load into the specified 'record' the measurements of the specified
+    // 'workload' run against the subject having the specified 'subjectName',
+    // with the configuration given by the specified 'args'.
+{
+    const allocbench::WorkloadConfig& config     = args.d_config;
+    const int                         numThreads = workload.numThreads(config);
+
+    // 1. Timed run.
+
+    {
+        allocbench::UpstreamMeter             upstream;
+        bslma::ManagedPtr<allocbench::Subject> subject;
+        allocbench::SubjectUtil::create(&subject, subjectName, &upstream);
+
+        const bsl::vector<bslma::Allocator *> allocators(
+                                                       numThreads,
+                                                       subject->allocator());
+
+        const bsls::Types::Int64 rssBefore =
+                                  allocbench::ProcessUtil::residentSetSize();
+
+        bsls::Stopwatch timer;
+        timer.start(true);
+        record->d_numItems = workload.run(subject.get(), allocators, config);
+        timer.stop();
+
+        const bsls::Types::Int64 rssAfter =
+                                  allocbench::ProcessUtil::residentSetSize();
+
+        record->d_wallSeconds    = timer.accumulatedWallTime();
+        record->d_rssGrowthBytes = 0 <= rssBefore && 0 <= rssAfter
+                                 ? (rssAfter > rssBefore
+                                    ? rssAfter - rssBefore
+                                    : 0)
+                                 : -1;
+        record->d_peakRssBytes   =
+                              allocbench::ProcessUtil::peakResidentSetSize();
+    }
+
+    // 2. Latency run.
+
+    {
+        allocbench::UpstreamMeter             upstream;
+        bslma::ManagedPtr<allocbench::Subject> subject;
+        allocbench::SubjectUtil::create(&subject, subjectName, &upstream);
+
+        bsl::vector<allocbench::LatencyProbe *> probes;
+        bsl::vector<bslma::Allocator *>         allocators;
+        for (int i = 0; i < numThreads; ++i) {
+            probes.push_back(new allocbench::LatencyProbe(
+                                                       subject->allocator(),
+                                                       args.d_sampleInterval));
+            allocators.push_back(probes.back());
+        }
+
+        workload.run(subject.get(), allocators, config);
+
+        bsl::vector<bsls::Types::Int64> allocateSamples;
+        bsl::vector<bsls::Types::Int64> deallocateSamples;
+        for (int i = 0; i < numThreads; ++i) {
+            allocateSamples.insert(allocateSamples.end(),
+                                   probes[i]->allocateSamples().begin(),
+                                   probes[i]->allocateSamples().end());
+            deallocateSamples.insert(deallocateSamples.end(),
+                                     probes[i]->deallocateSamples().begin(),
+                                     probes[i]->deallocateSamples().end());
+            delete probes[i];
+        }
+
+        record->d_allocateLatency   =
+                 allocbench::LatencySummary::summarize(&allocateSamples);
+        record->d_deallocateLatency =
+                 allocbench::LatencySummary::summarize(&deallocateSamples);
+    }
+
+    // 3. Footprint run.
+
+    {
+        allocbench::UpstreamMeter             upstream;
+        bslma::ManagedPtr<allocbench::Subject> subject;
+        allocbench::SubjectUtil::create(&subject, subjectName, &upstream);
+
+        allocbench::FootprintTracker tracker(subject->allocator());
+
+        const bsl::vector<bslma::Allocator *> allocators(numThreads,
+                                                         &tracker);
+
+        workload.run(subject.get(), allocators, config);
+
+        record->d_numAllocations     = tracker.numAllocations();
+        record->d_numDeallocations   = tracker.numDeallocations();
+        record->d_peakRequestedBytes = tracker.peakBytesInUse();
+        record->d_peakUpstreamBytes  = subject->usesUpstream()
+                                     ? upstream.peakBytesInUse()
+                                     : -1;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Args args;
+    if (0 != parseArgs(&args, argc, argv)) {
+        return 1;                                                     // RETURN
+    }
+
+    if (args.d_list) {
+        bsl::vector<bsl::string_view> names;
+
+        allocbench::SubjectUtil::names(&names);
+        bsl::cout << "allocators:";
+        for (bsl::size_t i = 0; i < names.size(); ++i) {
+            bsl::cout << ' ' << names[i];
+        }
+
+        allocbench::WorkloadUtil::names(&names);
+        bsl::cout << "\nworkloads:";
+        for (bsl::size_t i = 0; i < names.size(); ++i) {
+            bsl::cout << ' ' << names[i];
+        }
+        bsl::cout << '\n';
+        return 0;                                                     // RETURN
+    }
+
+    bsl::ofstream  file;
+    bsl::ostream  *stream = &bsl::cout;
+    if (!args.d_output.empty()) {
+        file.open(args.d_output.c_str());
+        if (!file) {
+            bsl::cerr << "cannot open " << args.d_output << '\n';
+            return 1;                                                 // RETURN
+        }
+        stream = &file;
+    }
+
+    if (args.d_csv) {
+        printCsvHeader(*stream);
+    }
+
+    int status = 0;
+
+    for (bsl::size_t w = 0; w < args.d_workloads.size(); ++w) {
+        bslma::ManagedPtr<allocbench::Workload> workload;
+        if (0 != allocbench::WorkloadUtil::create(&workload,
+                                                  args.d_workloads[w])) {
+            bsl::cerr << "unknown workload: " << args.d_workloads[w] << '\n';
+            status = 1;
+            continue;
+        }
+
+        for (bsl::size_t a = 0; a < args.d_allocators.size(); ++a) {
+            const bsl::string& name = args.d_allocators[a];
+
+            {
+                allocbench::UpstreamMeter              upstream;
+                bslma::ManagedPtr<allocbench::Subject> subject;
+                if (0 != allocbench::SubjectUtil::create(&subject,
+                                                         name,
+                                                         &upstream)) {
+                    bsl::cerr << "unknown allocator: " << name << '\n';
+                    status = 1;
+                    continue;
+                }
+                if (workload->requiresThreadSafety()
+                 && !subject->isThreadSafe()) {
+                    bsl::cerr << "skipping " << args.d_workloads[w]
+                              << " for " << name
+                              << ": allocator is not thread-safe\n";
+                    continue;
+                }
+            }
+
+            Record record;
+            record.d_allocator  = name;
+            record.d_workload   = args.d_workloads[w];
+            record.d_numThreads = workload->numThreads(args.d_config);
+            record.d_numRounds  = args.d_config.d_numRounds;
+
+            measure(&record, *workload, name, args);
+
+            printRecord(*stream, record, !args.d_csv);
+        }
+    }
+
+    return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
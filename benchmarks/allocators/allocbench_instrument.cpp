@@ -0,0 +1,358 @@
+// allocbench_instrument.cpp                                          -*-C++-*-
+#include <allocbench_instrument.h>
+
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+namespace allocbench {
+namespace {
+
+typedef bsls::AlignmentUtil::MaxAlignedType Header;
+    // The header preceding each block handed out by 'UpstreamMeter', which
+    // records the size of the block and preserves maximal alignment.
+
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class UpstreamMeter
+                            // -------------------
+
+// CREATORS
+UpstreamMeter::UpstreamMeter()
+: d_numBytesInUse(0)
+, d_peakBytesInUse(0)
+, d_numAllocations(0)
+{
+}
+
+UpstreamMeter::~UpstreamMeter()
+{
+    BSLS_ASSERT(0 == d_numBytesInUse.loadRelaxed());
+}
+
+// MANIPULATORS
+void *UpstreamMeter::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    Header *header = static_cast<Header *>(
+                  bslma::NewDeleteAllocator::singleton().allocate(
+                                                     sizeof(Header) + size));
+    *reinterpret_cast<size_type *>(header) = size;
+
+    ++d_numAllocations;
+
+    const bsls::Types::Int64 inUse = d_numBytesInUse.addRelaxed(
+                                       static_cast<bsls::Types::Int64>(size));
+
+    bsls::Types::Int64 peak = d_peakBytesInUse.loadRelaxed();
+    while (peak < inUse) {
+        const bsls::Types::Int64 previous =
+                               d_peakBytesInUse.testAndSwap(peak, inUse);
+        if (previous == peak) {
+            break;
+        }
+        peak = previous;
+    }
+
+    return header + 1;
+}
+
+void UpstreamMeter::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    d_numBytesInUse.addRelaxed(-static_cast<bsls::Types::Int64>(
+                                   *reinterpret_cast<size_type *>(header)));
+
+    bslma::NewDeleteAllocator::singleton().deallocate(header);
+}
+
+void UpstreamMeter::resetPeak()
+{
+    d_peakBytesInUse.storeRelaxed(d_numBytesInUse.loadRelaxed());
+}
+
+                            // --------------------
+                            // class LatencySummary
+                            // --------------------
+
+// CLASS METHODS
+LatencySummary LatencySummary::summarize(
+                                      bsl::vector<bsls::Types::Int64> *samples)
+{
+    BSLS_ASSERT(samples);
+
+    LatencySummary result = { 0, 0, 0, 0, 0, 0 };
+
+    if (samples->empty()) {
+        return result;                                                // RETURN
+    }
+
+    bsl::sort(samples->begin(), samples->end());
+
+    const bsls::Types::Int64 n = static_cast<bsls::Types::Int64>(
+                                                             samples->size());
+
+    result.d_count = n;
+    result.d_p50   = (*samples)[n *  50 /  100];
+    result.d_p90   = (*samples)[n *  90 /  100];
+    result.d_p99   = (*samples)[n *  99 /  100];
+    result.d_p999  = (*samples)[n * 999 / 1000];
+    result.d_max   = samples->back();
+
+    return result;
+}
+
+                             // ------------------
+                             // class LatencyProbe
+                             // ------------------
+
+// PROTECTED MANIPULATORS
+void LatencyProbe::doDeallocate(void      *address,
+                                size_type  size,
+                                size_type  alignment)
+{
+    if (--d_deallocateCountdown) {
+        d_target_p->deallocate(address, size, alignment);
+        return;                                                       // RETURN
+    }
+
+    d_deallocateCountdown = d_interval;
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    d_target_p->deallocate(address, size, alignment);
+    d_deallocateSamples.push_back(bsls::TimeUtil::getTimer() - start);
+}
+
+// CREATORS
+LatencyProbe::LatencyProbe(bslma::Allocator *target,
+                           int               interval,
+                           bslma::Allocator *basicAllocator)
+: d_target_p(target)
+, d_interval(interval)
+, d_allocateCountdown(interval)
+, d_deallocateCountdown(interval)
+, d_allocateSamples(basicAllocator)
+, d_deallocateSamples(basicAllocator)
+{
+    BSLS_ASSERT(target);
+    BSLS_ASSERT(1 <= interval);
+}
+
+LatencyProbe::~LatencyProbe()
+{
+}
+
+// MANIPULATORS
+void *LatencyProbe::allocate(size_type size)
+{
+    if (--d_allocateCountdown) {
+        return d_target_p->allocate(size);                            // RETURN
+    }
+
+    d_allocateCountdown = d_interval;
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    void *result = d_target_p->allocate(size);
+    d_allocateSamples.push_back(bsls::TimeUtil::getTimer() - start);
+
+    return result;
+}
+
+void LatencyProbe::deallocate(void *address)
+{
+    if (--d_deallocateCountdown) {
+        d_target_p->deallocate(address);
+        return;                                                       // RETURN
+    }
+
+    d_deallocateCountdown = d_interval;
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    d_target_p->deallocate(address);
+    d_deallocateSamples.push_back(bsls::TimeUtil::getTimer() - start);
+}
+
+                           // ----------------------
+                           // class FootprintTracker
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+void FootprintTracker::recordDeallocation(void *address)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BlockMap::iterator it = d_blocks.find(address);
+    BSLS_ASSERT(d_blocks.end() != it);
+
+    d_numBytesInUse -= static_cast<bsls::Types::Int64>(it->second);
+    ++d_numDeallocations;
+    d_blocks.erase(it);
+}
+
+// PROTECTED MANIPULATORS
+void FootprintTracker::doDeallocate(void      *address,
+                                    size_type  size,
+                                    size_type  alignment)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    recordDeallocation(address);
+    d_target_p->deallocate(address, size, alignment);
+}
+
+// CREATORS
+FootprintTracker::FootprintTracker(bslma::Allocator *target,
+                                   bslma::Allocator *basicAllocator)
+: d_target_p(target)
+, d_blocks(basicAllocator)
+, d_numBytesInUse(0)
+, d_peakBytesInUse(0)
+, d_numAllocations(0)
+, d_numDeallocations(0)
+{
+    BSLS_ASSERT(target);
+}
+
+FootprintTracker::~FootprintTracker()
+{
+}
+
+// MANIPULATORS
+void *FootprintTracker::allocate(size_type size)
+{
+    void *result = d_target_p->allocate(size);
+    if (0 == result) {
+        return result;                                                // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_blocks[result] = size;
+    ++d_numAllocations;
+    d_numBytesInUse += static_cast<bsls::Types::Int64>(size);
+    if (d_peakBytesInUse < d_numBytesInUse) {
+        d_peakBytesInUse = d_numBytesInUse;
+    }
+
+    return result;
+}
+
+void FootprintTracker::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    recordDeallocation(address);
+    d_target_p->deallocate(address);
+}
+
+// ACCESSORS
+bsls::Types::Int64 FootprintTracker::numAllocations() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numAllocations;
+}
+
+bsls::Types::Int64 FootprintTracker::numDeallocations() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numDeallocations;
+}
+
+bsls::Types::Int64 FootprintTracker::peakBytesInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_peakBytesInUse;
+}
+
+                             // ------------------
+                             // struct ProcessUtil
+                             // ------------------
+
+// CLASS METHODS
+bsls::Types::Int64 ProcessUtil::residentSetSize()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::FILE *file = bsl::fopen("/proc/self/statm", "r");
+    if (!file) {
+        return -1;                                                    // RETURN
+    }
+
+    long size     = 0;
+    long resident = 0;
+    const int rc  = bsl::fscanf(file, "%ld %ld", &size, &resident);
+    bsl::fclose(file);
+
+    if (2 != rc) {
+        return -1;                                                    // RETURN
+    }
+    return static_cast<bsls::Types::Int64>(resident) * sysconf(_SC_PAGESIZE);
+#else
+    return -1;
+#endif
+}
+
+bsls::Types::Int64 ProcessUtil::peakResidentSetSize()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    struct rusage usage;
+    if (0 != getrusage(RUSAGE_SELF, &usage)) {
+        return -1;                                                    // RETURN
+    }
+#if defined(BSLS_PLATFORM_OS_DARWIN)
+    return static_cast<bsls::Types::Int64>(usage.ru_maxrss);   // bytes
+#else
+    return static_cast<bsls::Types::Int64>(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return -1;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,347 @@
+// allocbench_instrument.h                                            -*-C++-*-
+#ifndef INCLUDED_ALLOCBENCH_INSTRUMENT
+#define INCLUDED_ALLOCBENCH_INSTRUMENT
+
+//@PURPOSE: Provide allocators and utilities that measure allocator behavior.
+//
+//@CLASSES:
+//  allocbench::UpstreamMeter: allocator measuring memory obtained upstream
+//  allocbench::LatencyProbe: forwarding allocator sampling call latency
+//  allocbench::FootprintTracker: forwarding allocator tracking live bytes
+//  allocbench::LatencySummary: percentiles of a set of latency samples
+//  allocbench::ProcessUtil: resident-set-size queries
+//
+//@DESCRIPTION: This component provides the instruments used by the
+// 'allocbench' program to measure an allocator under test (the "subject"):
+//
+//: o 'UpstreamMeter' sits *below* the subject, supplying the memory the
+//:   subject obtains from the system and recording the number of bytes in use
+//:   and its high-water mark.
+//:
+//: o 'LatencyProbe' sits *above* the subject, forwarding every call to it and
+//:   timing every 'n'th 'allocate' and 'deallocate'.  Each thread uses its own
+//:   probe, so recording a sample requires no synchronization.
+//:
+//: o 'FootprintTracker' sits above the subject, forwarding every call to it
+//:   and recording the size of every live block, so that the peak number of
+//:   bytes requested by the workload can be compared with the peak number of
+//:   bytes the subject obtained upstream.  The tracker serializes all calls
+//:   and is therefore used only in a dedicated (untimed) pass.
+//
+// The ratio of the two peaks is reported as the *fragmentation* of the
+// subject for a workload: the factor by which the memory the subject holds
+// exceeds the memory the workload actually needs, including per-block
+// overhead, rounding to size classes, unreused free blocks, and (for
+// sequential allocators) memory that is freed by the workload but not
+// reclaimed until the allocator is released.
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace allocbench {
+
+                            // ===================
+                            // class UpstreamMeter
+                            // ===================
+
+class UpstreamMeter : public bslma::Allocator {
+    // This thread-safe allocator obtains memory from the new/delete allocator,
+    // prefixing each block with a header that records its size, and keeps
+    // track of the number of bytes in use and the maximum number of bytes
+    // ever in use.
+
+    // DATA
+    bsls::AtomicInt64 d_numBytesInUse;
+    bsls::AtomicInt64 d_peakBytesInUse;
+    bsls::AtomicInt64 d_numAllocations;
+
+  private:
+    // NOT IMPLEMENTED
+    UpstreamMeter(const UpstreamMeter&);
+    UpstreamMeter& operator=(const UpstreamMeter&);
+
+  public:
+    // CREATORS
+    UpstreamMeter();
+        // Create a meter having no memory in use.
+
+    ~UpstreamMeter() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this meter.  The behavior is undefined unless all memory
+        // obtained from this meter has been returned to it.
+
+    // MANIPULATORS
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes).  If 'size' is 0, a null pointer is
+        // returned with no other effect.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this function has no effect.
+
+    void resetPeak();
+        // Set the high-water mark of this meter to the number of bytes
+        // currently in use.
+
+    // ACCESSORS
+    bsls::Types::Int64 numAllocations() const;
+        // Return the number of blocks ever allocated from this meter.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes currently in use.
+
+    bsls::Types::Int64 peakBytesInUse() const;
+        // Return the maximum number of bytes in use since construction or the
+        // most recent call to 'resetPeak'.
+};
+
+                            // ====================
+                            // class LatencySummary
+                            // ====================
+
+struct LatencySummary {
+    // This 'struct' holds percentiles (in nanoseconds) of a set of latency
+    // samples.
+
+    // PUBLIC DATA
+    bsls::Types::Int64 d_count;   // number of samples
+    bsls::Types::Int64 d_p50;
+    bsls::Types::Int64 d_p90;
+    bsls::Types::Int64 d_p99;
+    bsls::Types::Int64 d_p999;
+    bsls::Types::Int64 d_max;
+
+    // CLASS METHODS
+    static LatencySummary summarize(bsl::vector<bsls::Types::Int64> *samples);
+        // Return the summary of the specified 'samples', which are sorted as a
+        // side effect.  If 'samples' is empty, every field of the result is 0.
+};
+
+                             // ==================
+                             // class LatencyProbe
+                             // ==================
+
+class LatencyProbe : public bslma::Allocator {
+    // This allocator forwards every call to a target allocator, and records
+    // the duration of every 'n'th 'allocate' and every 'n'th 'deallocate' call
+    // (for a sampling interval 'n' specified at construction).  This class is
+    // *not* thread-safe: each thread must use its own probe.
+
+    // DATA
+    bslma::Allocator                *d_target_p;
+    int                              d_interval;
+    int                              d_allocateCountdown;
+    int                              d_deallocateCountdown;
+    bsl::vector<bsls::Types::Int64>  d_allocateSamples;
+    bsl::vector<bsls::Types::Int64>  d_deallocateSamples;
+
+  private:
+    // NOT IMPLEMENTED
+    LatencyProbe(const LatencyProbe&);
+    LatencyProbe& operator=(const LatencyProbe&);
+
+  protected:
+    // PROTECTED MANIPULATORS
+    void doDeallocate(void      *address,
+                      size_type  size,
+                      size_type  alignment) BSLS_KEYWORD_OVERRIDE;
+        // Forward the specified 'address', 'size', and 'alignment' to the
+        // sized 'deallocate' of the target allocator, timing the call if it
+        // is to be sampled.
+
+  public:
+    // CREATORS
+    LatencyProbe(bslma::Allocator *target,
+                 int               interval,
+                 bslma::Allocator *basicAllocator = 0);
+        // Create a probe forwarding to the specified 'target' allocator and
+        // timing every 'interval'th call.  Optionally specify a
+        // 'basicAllocator' used to supply memory for the samples.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= interval'.
+
+    ~LatencyProbe() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this probe.
+
+    // MANIPULATORS
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the result of 'allocate(size)' on the target allocator for
+        // the specified 'size', timing the call if it is to be sampled.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Forward the specified 'address' to 'deallocate' on the target
+        // allocator, timing the call if it is to be sampled.
+
+    bsl::vector<bsls::Types::Int64>& allocateSamples();
+        // Return a reference providing modifiable access to the 'allocate'
+        // latency samples (in nanoseconds) recorded by this probe.
+
+    bsl::vector<bsls::Types::Int64>& deallocateSamples();
+        // Return a reference providing modifiable access to the 'deallocate'
+        // latency samples (in nanoseconds) recorded by this probe.
+};
+
+                           // ======================
+                           // class FootprintTracker
+                           // ======================
+
+class FootprintTracker : public bslma::Allocator {
+    // This thread-safe allocator forwards every call to a target allocator,
+    // and records the size of every live block in order to report the number
+    // of bytes requested and its high-water mark, along with the number of
+    // calls made.
+
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<void *, bsls::Types::size_type> BlockMap;
+
+    // DATA
+    bslma::Allocator   *d_target_p;
+    mutable bslmt::Mutex d_mutex;
+    BlockMap            d_blocks;
+    bsls::Types::Int64  d_numBytesInUse;
+    bsls::Types::Int64  d_peakBytesInUse;
+    bsls::Types::Int64  d_numAllocations;
+    bsls::Types::Int64  d_numDeallocations;
+
+  private:
+    // NOT IMPLEMENTED
+    FootprintTracker(const FootprintTracker&);
+    FootprintTracker& operator=(const FootprintTracker&);
+
+    // PRIVATE MANIPULATORS
+    void recordDeallocation(void *address);
+        // Record that the block at the specified 'address' has been freed.
+
+  protected:
+    // PROTECTED MANIPULATORS
+    void doDeallocate(void      *address,
+                      size_type  size,
+                      size_type  alignment) BSLS_KEYWORD_OVERRIDE;
+        // Forward the specified 'address', 'size', and 'alignment' to the
+        // sized 'deallocate' of the target allocator, and record the call.
+
+  public:
+    // CREATORS
+    explicit FootprintTracker(bslma::Allocator *target,
+                              bslma::Allocator *basicAllocator = 0);
+        // Create a tracker forwarding to the specified 'target' allocator.
+        // Optionally specify a 'basicAllocator' used to supply memory for the
+        // bookkeeping.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~FootprintTracker() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this tracker.
+
+    // MANIPULATORS
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the result of 'allocate(size)' on the target allocator for
+        // the specified 'size', and record the call.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Forward the specified 'address' to 'deallocate' on the target
+        // allocator, and record the call.
+
+    // ACCESSORS
+    bsls::Types::Int64 numAllocations() const;
+        // Return the number of non-null blocks allocated through this tracker.
+
+    bsls::Types::Int64 numDeallocations() const;
+        // Return the number of non-null blocks deallocated through this
+        // tracker.
+
+    bsls::Types::Int64 peakBytesInUse() const;
+        // Return the maximum number of bytes requested through this tracker
+        // and live at the same time.
+};
+
+                             // ==================
+                             // struct ProcessUtil
+                             // ==================
+
+struct ProcessUtil {
+    // This 'struct' provides a namespace for queries of the memory used by
+    // the current process.
+
+    // CLASS METHODS
+    static bsls::Types::Int64 residentSetSize();
+        // Return the current resident set size of this process in bytes, or
+        // -1 if it cannot be determined on this platform.
+
+    static bsls::Types::Int64 peakResidentSetSize();
+        // Return the maximum resident set size of this process so far in
+        // bytes, or -1 if it cannot be determined on this platform.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class UpstreamMeter
+                            // -------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 UpstreamMeter::numAllocations() const
+{
+    return d_numAllocations.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 UpstreamMeter::numBytesInUse() const
+{
+    return d_numBytesInUse.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 UpstreamMeter::peakBytesInUse() const
+{
+    return d_peakBytesInUse.loadRelaxed();
+}
+
+                             // ------------------
+                             // class LatencyProbe
+                             // ------------------
+
+// MANIPULATORS
+inline
+bsl::vector<bsls::Types::Int64>& LatencyProbe::allocateSamples()
+{
+    return d_allocateSamples;
+}
+
+inline
+bsl::vector<bsls::Types::Int64>& LatencyProbe::deallocateSamples()
+{
+    return d_deallocateSamples;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,247 @@
+// allocbench_subject.cpp                                             -*-C++-*-
+#include <allocbench_subject.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_keyword.h>
+
+namespace BloombergLP {
+namespace allocbench {
+namespace {
+
+enum { k_BUFFER_SIZE = 64 * 1024 };
+
+                           // ======================
+                           // class NewDeleteSubject
+                           // ======================
+
+class NewDeleteSubject : public Subject {
+    // This class wraps the new/delete allocator.
+
+  public:
+    // MANIPULATORS
+    bslma::Allocator *allocator() BSLS_KEYWORD_OVERRIDE
+    {
+        return &bslma::NewDeleteAllocator::singleton();
+    }
+
+    // ACCESSORS
+    bool isThreadSafe() const BSLS_KEYWORD_OVERRIDE
+    {
+        return true;
+    }
+
+    bool usesUpstream() const BSLS_KEYWORD_OVERRIDE
+    {
+        return false;
+    }
+};
+
+                            // ====================
+                            // class ManagedSubject
+                            // ====================
+
+template <class ALLOCATOR, bool RELEASE_PER_ROUND, bool THREAD_SAFE>
+class ManagedSubject : public Subject {
+    // This class wraps a managed allocator of the (template parameter) type
+    // 'ALLOCATOR', which is released at the end of each round if the
+    // (template parameter) 'RELEASE_PER_ROUND' is 'true', and is thread-safe
+    // if the (template parameter) 'THREAD_SAFE' is 'true'.
+
+    // DATA
+    ALLOCATOR d_allocator;
+
+  public:
+    // CREATORS
+    explicit ManagedSubject(bslma::Allocator *upstream)
+    : d_allocator(upstream)
+    {
+    }
+
+    // MANIPULATORS
+    bslma::Allocator *allocator() BSLS_KEYWORD_OVERRIDE
+    {
+        return &d_allocator;
+    }
+
+    void endRound() BSLS_KEYWORD_OVERRIDE
+    {
+        if (RELEASE_PER_ROUND) {
+            d_allocator.release();
+        }
+    }
+
+    // ACCESSORS
+    bool isThreadSafe() const BSLS_KEYWORD_OVERRIDE
+    {
+        return THREAD_SAFE;
+    }
+};
+
+                      // ===============================
+                      // class BufferedSequentialSubject
+                      // ===============================
+
+class BufferedSequentialSubject : public Subject {
+    // This class wraps a buffered sequential allocator using a 64K buffer,
+    // which is released at the end of each round.
+
+    // DATA
+    bsls::AlignedBuffer<k_BUFFER_SIZE>  d_buffer;
+    bdlma::BufferedSequentialAllocator  d_allocator;
+
+  public:
+    // CREATORS
+    explicit BufferedSequentialSubject(bslma::Allocator *upstream)
+    : d_allocator(d_buffer.buffer(), k_BUFFER_SIZE, upstream)
+    {
+    }
+
+    // MANIPULATORS
+    bslma::Allocator *allocator() BSLS_KEYWORD_OVERRIDE
+    {
+        return &d_allocator;
+    }
+
+    void endRound() BSLS_KEYWORD_OVERRIDE
+    {
+        d_allocator.release();
+    }
+
+    // ACCESSORS
+    bool isThreadSafe() const BSLS_KEYWORD_OVERRIDE
+    {
+        return false;
+    }
+};
+
+typedef ManagedSubject<bdlma::MultipoolAllocator, false, false>
+                                                              MultipoolSubject;
+
+typedef ManagedSubject<bdlma::ConcurrentMultipoolAllocator, false, true>
+                                                    ConcurrentMultipoolSubject;
+
+typedef ManagedSubject<bdlma::ThreadCachingMultipoolAllocator, false, true>
+                                                         ThreadCachingSubject;
+
+typedef ManagedSubject<bdlma::SequentialAllocator, true, false>
+                                                             SequentialSubject;
+
+typedef ManagedSubject<bdlma::LocalSequentialAllocator<k_BUFFER_SIZE>,
+                       true,
+                       false>                           LocalSequentialSubject;
+
+template <class SUBJECT>
+void createSubject(bslma::ManagedPtr<Subject> *result,
+                   bslma::Allocator           *upstream)
+    // Load into the specified 'result' a newly created subject of the
+    // (template parameter) type 'SUBJECT' obtaining memory from the specified
+    // 'upstream' allocator.
+{
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    result->load(new (*allocator) SUBJECT(upstream), allocator);
+}
+
+const char *const k_NAMES[] = {
+    "newdelete",
+    "multipool",
+    "concurrentmultipool",
+    "threadcaching",
+    "sequential",
+    "bufferedsequential",
+    "localsequential"
+};
+
+}  // close unnamed namespace
+
+                               // -------------
+                               // class Subject
+                               // -------------
+
+// CREATORS
+Subject::~Subject()
+{
+}
+
+// MANIPULATORS
+void Subject::endRound()
+{
+}
+
+// ACCESSORS
+bool Subject::usesUpstream() const
+{
+    return true;
+}
+
+                             // ------------------
+                             // struct SubjectUtil
+                             // ------------------
+
+// CLASS METHODS
+int SubjectUtil::create(bslma::ManagedPtr<Subject> *result,
+                        const bsl::string_view&     name,
+                        bslma::Allocator           *upstream)
+{
+    if ("newdelete" == name) {
+        bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+        result->load(new (*allocator) NewDeleteSubject(), allocator);
+    }
+    else if ("multipool" == name) {
+        createSubject<MultipoolSubject>(result, upstream);
+    }
+    else if ("concurrentmultipool" == name) {
+        createSubject<ConcurrentMultipoolSubject>(result, upstream);
+    }
+    else if ("threadcaching" == name) {
+        createSubject<ThreadCachingSubject>(result, upstream);
+    }
+    else if ("sequential" == name) {
+        createSubject<SequentialSubject>(result, upstream);
+    }
+    else if ("bufferedsequential" == name) {
+        createSubject<BufferedSequentialSubject>(result, upstream);
+    }
+    else if ("localsequential" == name) {
+        createSubject<LocalSequentialSubject>(result, upstream);
+    }
+    else {
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+void SubjectUtil::names(bsl::vector<bsl::string_view> *result)
+{
+    result->assign(k_NAMES, k_NAMES + sizeof k_NAMES / sizeof *k_NAMES);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,119 @@
+// allocbench_subject.h                                               -*-C++-*-
+#ifndef INCLUDED_ALLOCBENCH_SUBJECT
+#define INCLUDED_ALLOCBENCH_SUBJECT
+
+//@PURPOSE: Provide the allocators under test by the 'allocbench' program.
+//
+//@CLASSES:
+//  allocbench::Subject: protocol for an allocator under test
+//  allocbench::SubjectUtil: factory for the allocators under test
+//
+//@DESCRIPTION: This component provides a protocol, 'allocbench::Subject',
+// wrapping an allocator under test, and a utility, 'allocbench::SubjectUtil',
+// that creates a subject by name.  The following subjects are available:
+//..
+//  Name                  Allocator                                 Thread-safe
+//  --------------------  ----------------------------------------  -----------
+//  newdelete             bslma::NewDeleteAllocator                 yes
+//  multipool             bdlma::MultipoolAllocator                 no
+//  concurrentmultipool   bdlma::ConcurrentMultipoolAllocator       yes
+//  threadcaching         bdlma::ThreadCachingMultipoolAllocator    yes
+//  sequential            bdlma::SequentialAllocator                no
+//  bufferedsequential    bdlma::BufferedSequentialAllocator (64K)  no
+//  localsequential       bdlma::LocalSequentialAllocator<65536>    no
+//..
+// The pools ('bdlma::Multipool' and 'bdlma::ConcurrentMultipool') are
+// measured through the allocator adapters that own them.  Every subject
+// except 'newdelete' obtains its memory from an upstream allocator supplied at
+// creation, so that the memory it holds can be measured.
+//
+// Sequential allocators never reuse freed memory, so a workload that frees
+// memory would grow them without bound.  'Subject::endRound', which a
+// workload calls whenever all the memory it allocated has been freed (e.g.,
+// between rounds of work), therefore releases the sequential subjects,
+// modeling the usual "arena per request" use of such allocators.  The pooling
+// subjects are not released between rounds, so that the reuse of freed blocks
+// is measured.
+
+#include <bslma_allocator.h>
+#include <bslma_managedptr.h>
+
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace allocbench {
+
+                               // =============
+                               // class Subject
+                               // =============
+
+class Subject {
+    // This protocol wraps an allocator under test.
+
+  public:
+    // CREATORS
+    virtual ~Subject();
+        // Destroy this subject, and the allocator it wraps.
+
+    // MANIPULATORS
+    virtual bslma::Allocator *allocator() = 0;
+        // Return the address of the allocator under test.
+
+    virtual void endRound();
+        // Note that a round of work has ended and that no memory allocated
+        // from 'allocator()' is in use.  The default implementation has no
+        // effect.
+
+    // ACCESSORS
+    virtual bool isThreadSafe() const = 0;
+        // Return 'true' if the allocator under test may be used concurrently
+        // by several threads, and 'false' otherwise.
+
+    virtual bool usesUpstream() const;
+        // Return 'true' if the allocator under test obtains its memory from
+        // the upstream allocator supplied at creation, and 'false' otherwise.
+        // The default implementation returns 'true'.
+};
+
+                             // ==================
+                             // struct SubjectUtil
+                             // ==================
+
+struct SubjectUtil {
+    // This 'struct' provides a namespace for creating subjects by name.
+
+    // CLASS METHODS
+    static int create(bslma::ManagedPtr<Subject> *result,
+                      const bsl::string_view&     name,
+                      bslma::Allocator           *upstream);
+        // Load into the specified 'result' a newly created subject having the
+        // specified 'name' and obtaining its memory from the specified
+        // 'upstream' allocator.  Return 0 on success, and a non-zero value
+        // (with no effect on 'result') if 'name' is not the name of a
+        // subject.
+
+    static void names(bsl::vector<bsl::string_view> *result);
+        // Load into the specified 'result' the names of all subjects.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,467 @@
+// allocbench_workload.cpp                                            -*-C++-*-
+#include <allocbench_workload.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+
+#include <bsl_deque.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace allocbench {
+namespace {
+
+                                // ============
+                                // class Random
+                                // ============
+
+class Random {
+    // This class provides a small, deterministic pseudo-random number
+    // generator, so that runs with the same seed perform the same
+    // allocations.
+
+    // DATA
+    unsigned d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned seed)
+    : d_state(seed * 2654435761u + 1)
+    {
+    }
+
+    // MANIPULATORS
+    unsigned next(unsigned limit)
+        // Return a pseudo-random value in the range '[0, limit)'.  The
+        // behavior is undefined unless '0 < limit'.
+    {
+        d_state = d_state * 1664525u + 1013904223u;
+        return (d_state >> 8) % limit;
+    }
+};
+
+const char k_TEXT[] =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    // Source of the characters of generated strings; at least 200 long.
+
+                            // ====================
+                            // class ContainerChurn
+                            // ====================
+
+class ContainerChurn : public Workload {
+    // This class implements the 'containerchurn' workload.
+
+    enum {
+        k_KEY_SPACE      = 4096,  // distinct keys in the map
+        k_MAX_STRING_LEN = 200    // maximum length of a string
+    };
+
+  public:
+    // ACCESSORS
+    int numThreads(const WorkloadConfig&) const BSLS_KEYWORD_OVERRIDE
+    {
+        return 1;
+    }
+
+    bool requiresThreadSafety() const BSLS_KEYWORD_OVERRIDE
+    {
+        return false;
+    }
+
+    bsls::Types::Int64 run(
+             Subject                                *subject,
+             const bsl::vector<bslma::Allocator *>&  allocators,
+             const WorkloadConfig&                   config) const
+                                                         BSLS_KEYWORD_OVERRIDE
+    {
+        BSLS_ASSERT(1 == allocators.size());
+
+        bslma::Allocator *allocator = allocators[0];
+
+        Random random(config.d_seed);
+
+        bsls::Types::Int64 numItems = 0;
+
+        for (int round = 0; round < config.d_numRounds; ++round) {
+            {
+                bsl::unordered_map<int, bsl::string> map(allocator);
+                bsl::vector<bsl::string>             vec(allocator);
+
+                for (int i = 0; i < config.d_numItemsPerRound; ++i) {
+                    const int    key = static_cast<int>(
+                                                   random.next(k_KEY_SPACE));
+                    const bsl::size_t len = random.next(k_MAX_STRING_LEN + 1);
+
+                    switch (random.next(6)) {
+                      case 0:
+                      case 1: {
+                        map[key].assign(k_TEXT, len);
+                      } break;
+                      case 2: {
+                        map.erase(key);
+                      } break;
+                      case 3:
+                      case 4: {
+                        vec.push_back(bsl::string(k_TEXT, len, allocator));
+                      } break;
+                      case 5: {
+                        if (!vec.empty()) {
+                            const bsl::size_t index = random.next(
+                                         static_cast<unsigned>(vec.size()));
+                            vec[index].swap(vec.back());
+                            vec.pop_back();
+                        }
+                      } break;
+                    }
+                }
+                numItems += config.d_numItemsPerRound;
+            }
+            subject->endRound();
+        }
+        return numItems;
+    }
+};
+
+                             // ==================
+                             // class MessageParse
+                             // ==================
+
+class MessageParse : public Workload {
+    // This class implements the 'messageparse' workload.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<bsl::string, bsl::string> Field;
+    typedef bsl::vector<Field>                  Message;
+
+    enum {
+        k_NUM_WIRE_MESSAGES = 64,   // distinct input messages
+        k_BATCH_SIZE        = 16,   // messages alive at once
+        k_MIN_FIELDS        = 5,
+        k_MAX_FIELDS        = 40,
+        k_MIN_NAME_LEN      = 4,
+        k_MAX_NAME_LEN      = 16,
+        k_MAX_VALUE_LEN     = 120
+    };
+
+    // PRIVATE CLASS METHODS
+    static void parse(Message *result, const bsl::string& wire)
+        // Load into the specified 'result' the fields of the specified 'wire'
+        // message.
+    {
+        bsl::size_t pos = 0;
+        while (pos < wire.size()) {
+            const bsl::size_t eq   = wire.find('=', pos);
+            const bsl::size_t semi = wire.find(';', eq);
+
+            result->emplace_back();
+            Field& field = result->back();
+            field.first.assign(wire, pos, eq - pos);
+            field.second.assign(wire, eq + 1, semi - eq - 1);
+
+            pos = semi + 1;
+        }
+    }
+
+  public:
+    // ACCESSORS
+    int numThreads(const WorkloadConfig&) const BSLS_KEYWORD_OVERRIDE
+    {
+        return 1;
+    }
+
+    bool requiresThreadSafety() const BSLS_KEYWORD_OVERRIDE
+    {
+        return false;
+    }
+
+    bsls::Types::Int64 run(
+             Subject                                *subject,
+             const bsl::vector<bslma::Allocator *>&  allocators,
+             const WorkloadConfig&                   config) const
+                                                         BSLS_KEYWORD_OVERRIDE
+    {
+        BSLS_ASSERT(1 == allocators.size());
+
+        bslma::Allocator *allocator = allocators[0];
+
+        Random random(config.d_seed);
+
+        // The input messages are built from the default allocator, which is
+        // not measured.
+
+        bsl::vector<bsl::string> wire(k_NUM_WIRE_MESSAGES);
+        for (int i = 0; i < k_NUM_WIRE_MESSAGES; ++i) {
+            const int numFields = k_MIN_FIELDS + static_cast<int>(
+                             random.next(k_MAX_FIELDS - k_MIN_FIELDS + 1));
+            for (int j = 0; j < numFields; ++j) {
+                wire[i].append(k_TEXT,
+                               k_MIN_NAME_LEN +
+                        random.next(k_MAX_NAME_LEN - k_MIN_NAME_LEN + 1));
+                wire[i].push_back('=');
+                wire[i].append(k_TEXT + 1,
+                               random.next(k_MAX_VALUE_LEN + 1));
+                wire[i].push_back(';');
+            }
+        }
+
+        bsls::Types::Int64 numItems = 0;
+
+        Message *batch[k_BATCH_SIZE];
+
+        for (int round = 0; round < config.d_numRounds; ++round) {
+            for (int i = 0; i < config.d_numItemsPerRound; i += k_BATCH_SIZE) {
+                const int batchSize = config.d_numItemsPerRound - i
+                                                                < k_BATCH_SIZE
+                                    ? config.d_numItemsPerRound - i
+                                    : k_BATCH_SIZE;
+
+                for (int j = 0; j < batchSize; ++j) {
+                    batch[j] = new (*allocator) Message(allocator);
+                    parse(batch[j], wire[random.next(k_NUM_WIRE_MESSAGES)]);
+                }
+                for (int j = 0; j < batchSize; ++j) {
+                    allocator->deleteObject(batch[j]);
+                }
+
+                subject->endRound();
+            }
+            numItems += config.d_numItemsPerRound;
+        }
+        return numItems;
+    }
+};
+
+                             // =================
+                             // class CrossThread
+                             // =================
+
+class CrossThread : public Workload {
+    // This class implements the 'crossthread' workload.
+
+    enum {
+        k_BATCH_SIZE     = 64,    // blocks per batch
+        k_MAX_BATCHES    = 1024,  // batches queued before producers wait
+        k_MIN_BLOCK_SIZE = 16,
+        k_MAX_BLOCK_SIZE = 512
+    };
+
+    // PRIVATE TYPES
+    struct Batch {
+        void *d_blocks[k_BATCH_SIZE];
+        int   d_numBlocks;
+    };
+
+    struct Queue {
+        // A bounded queue of batches, with a count of active producers.
+
+        bslmt::Mutex       d_mutex;
+        bslmt::Condition   d_notEmpty;
+        bslmt::Condition   d_notFull;
+        bsl::deque<Batch>  d_batches;
+        int                d_numProducers;
+    };
+
+    // PRIVATE CLASS METHODS
+    static void produce(Queue            *queue,
+                        bslma::Allocator *allocator,
+                        int               numBlocks,
+                        unsigned          seed)
+        // Allocate the specified 'numBlocks' blocks from the specified
+        // 'allocator', using the specified 'seed' to choose their sizes, and
+        // append them, in batches, to the specified 'queue'.
+    {
+        Random random(seed);
+
+        Batch batch;
+        batch.d_numBlocks = 0;
+
+        for (int i = 0; i < numBlocks; ++i) {
+            const int size = k_MIN_BLOCK_SIZE + static_cast<int>(
+                     random.next(k_MAX_BLOCK_SIZE - k_MIN_BLOCK_SIZE + 1));
+
+            char *block = static_cast<char *>(allocator->allocate(size));
+            block[0]        = 1;
+            block[size - 1] = 1;
+
+            batch.d_blocks[batch.d_numBlocks++] = block;
+
+            if (k_BATCH_SIZE == batch.d_numBlocks || i + 1 == numBlocks) {
+                bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+
+                while (k_MAX_BATCHES <= queue->d_batches.size()) {
+                    queue->d_notFull.wait(&queue->d_mutex);
+                }
+                queue->d_batches.push_back(batch);
+                queue->d_notEmpty.signal();
+
+                batch.d_numBlocks = 0;
+            }
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+
+        if (0 == --queue->d_numProducers) {
+            queue->d_notEmpty.broadcast();
+        }
+    }
+
+    static void consume(Queue *queue, bslma::Allocator *allocator)
+        // Free, to the specified 'allocator', the blocks of the batches taken
+        // from the specified 'queue' until the queue is empty and has no
+        // active producers.
+    {
+        for (;;) {
+            Batch batch;
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+
+                while (queue->d_batches.empty()) {
+                    if (0 == queue->d_numProducers) {
+                        return;                                       // RETURN
+                    }
+                    queue->d_notEmpty.wait(&queue->d_mutex);
+                }
+                batch = queue->d_batches.front();
+                queue->d_batches.pop_front();
+                queue->d_notFull.signal();
+            }
+
+            for (int i = 0; i < batch.d_numBlocks; ++i) {
+                allocator->deallocate(batch.d_blocks[i]);
+            }
+        }
+    }
+
+  public:
+    // ACCESSORS
+    int numThreads(const WorkloadConfig& config) const BSLS_KEYWORD_OVERRIDE
+    {
+        return 2 * config.d_numThreads;
+    }
+
+    bool requiresThreadSafety() const BSLS_KEYWORD_OVERRIDE
+    {
+        return true;
+    }
+
+    bsls::Types::Int64 run(
+             Subject                                *subject,
+             const bsl::vector<bslma::Allocator *>&  allocators,
+             const WorkloadConfig&                   config) const
+                                                         BSLS_KEYWORD_OVERRIDE
+    {
+        const int numProducers = config.d_numThreads;
+
+        BSLS_ASSERT(2 * numProducers ==
+                                     static_cast<int>(allocators.size()));
+
+        bsls::Types::Int64 numItems = 0;
+
+        for (int round = 0; round < config.d_numRounds; ++round) {
+            Queue queue;
+            queue.d_numProducers = numProducers;
+
+            bslmt::ThreadGroup threads;
+            for (int i = 0; i < numProducers; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(
+                             &CrossThread::produce,
+                             &queue,
+                             allocators[i],
+                             config.d_numItemsPerRound,
+                             config.d_seed + round * numProducers + i));
+                threads.addThread(bdlf::BindUtil::bind(
+                             &CrossThread::consume,
+                             &queue,
+                             allocators[numProducers + i]));
+            }
+            threads.joinAll();
+
+            numItems += static_cast<bsls::Types::Int64>(numProducers)
+                                                * config.d_numItemsPerRound;
+
+            subject->endRound();
+        }
+        return numItems;
+    }
+};
+
+const char *const k_NAMES[] = {
+    "containerchurn",
+    "messageparse",
+    "crossthread"
+};
+
+}  // close unnamed namespace
+
+                               // --------------
+                               // class Workload
+                               // --------------
+
+// CREATORS
+Workload::~Workload()
+{
+}
+
+                            // -------------------
+                            // struct WorkloadUtil
+                            // -------------------
+
+// CLASS METHODS
+int WorkloadUtil::create(bslma::ManagedPtr<Workload> *result,
+                         const bsl::string_view&      name)
+{
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    if ("containerchurn" == name) {
+        result->load(new (*allocator) ContainerChurn(), allocator);
+    }
+    else if ("messageparse" == name) {
+        result->load(new (*allocator) MessageParse(), allocator);
+    }
+    else if ("crossthread" == name) {
+        result->load(new (*allocator) CrossThread(), allocator);
+    }
+    else {
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+void WorkloadUtil::names(bsl::vector<bsl::string_view> *result)
+{
+    result->assign(k_NAMES, k_NAMES + sizeof k_NAMES / sizeof *k_NAMES);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
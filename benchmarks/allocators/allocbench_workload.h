@@ -0,0 +1,142 @@
+// allocbench_workload.h                                              -*-C++-*-
+#ifndef INCLUDED_ALLOCBENCH_WORKLOAD
+#define INCLUDED_ALLOCBENCH_WORKLOAD
+
+//@PURPOSE: Provide the workloads run by the 'allocbench' program.
+//
+//@CLASSES:
+//  allocbench::WorkloadConfig: parameters of a workload run
+//  allocbench::Workload: protocol for a workload
+//  allocbench::WorkloadUtil: factory for the workloads
+//
+//@DESCRIPTION: This component provides a protocol, 'allocbench::Workload',
+// for a unit of allocation-heavy work, and a utility,
+// 'allocbench::WorkloadUtil', that creates a workload by name.  The following
+// workloads are available:
+//
+//: 'containerchurn':
+//:   A single thread randomly inserts into, updates, and erases from a
+//:   'bsl::unordered_map<int, bsl::string>' and a 'bsl::vector<bsl::string>'
+//:   holding strings of 0 to 200 characters.  A work item is one container
+//:   operation.
+//:
+//: 'messageparse':
+//:   A single thread parses batches of 16 text messages of the form
+//:   "name=value;..." (of 5 to 40 fields) into vectors of pairs of strings,
+//:   then destroys the batch.  A work item is one parsed message.
+//:
+//: 'crossthread':
+//:   'N' producer threads allocate blocks of 16 to 512 bytes and pass them,
+//:   in batches of 64, to 'N' consumer threads that free them.  A work item
+//:   is one block.  This workload requires a thread-safe subject.
+//
+// A workload performs its work in a number of rounds.  Whenever all memory
+// allocated by the workload has been freed -- at the end of each round, and,
+// for 'messageparse', after each batch -- the workload calls
+// 'Subject::endRound'.
+//
+// Each thread of a workload uses its own allocator, supplied by the caller,
+// which must forward (possibly through instrumentation) to the allocator of
+// the subject.  A run is deterministic for a given configuration, so that
+// separate timed and instrumented runs perform the same allocations.
+
+#include <allocbench_subject.h>
+
+#include <bslma_allocator.h>
+#include <bslma_managedptr.h>
+
+#include <bsls_types.h>
+
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace allocbench {
+
+                           // =====================
+                           // struct WorkloadConfig
+                           // =====================
+
+struct WorkloadConfig {
+    // This 'struct' holds the parameters of a workload run.
+
+    // PUBLIC DATA
+    int      d_numRounds;         // number of rounds
+    int      d_numItemsPerRound;  // work items per round (per producer)
+    int      d_numThreads;        // producers (and consumers) for
+                                  // 'crossthread'
+    unsigned d_seed;              // seed for the pseudo-random sequence
+};
+
+                               // ==============
+                               // class Workload
+                               // ==============
+
+class Workload {
+    // This protocol defines a unit of allocation-heavy work.
+
+  public:
+    // CREATORS
+    virtual ~Workload();
+        // Destroy this workload.
+
+    // ACCESSORS
+    virtual int numThreads(const WorkloadConfig& config) const = 0;
+        // Return the number of threads used by this workload for the specified
+        // 'config', which is the number of allocators that must be supplied to
+        // 'run'.
+
+    virtual bool requiresThreadSafety() const = 0;
+        // Return 'true' if this workload uses the subject from several threads
+        // concurrently, and 'false' otherwise.
+
+    virtual bsls::Types::Int64 run(
+                  Subject                                *subject,
+                  const bsl::vector<bslma::Allocator *>&  allocators,
+                  const WorkloadConfig&                   config) const = 0;
+        // Perform the work of this workload for the specified 'config', with
+        // each thread 'i' using the allocator 'allocators[i]', which forwards
+        // to the allocator of the specified 'subject'.  Return the number of
+        // work items performed.  The behavior is undefined unless
+        // 'numThreads(config) == allocators.size()'.
+};
+
+                            // ===================
+                            // struct WorkloadUtil
+                            // ===================
+
+struct WorkloadUtil {
+    // This 'struct' provides a namespace for creating workloads by name.
+
+    // CLASS METHODS
+    static int create(bslma::ManagedPtr<Workload> *result,
+                      const bsl::string_view&      name);
+        // Load into the specified 'result' a newly created workload having
+        // the specified 'name'.  Return 0 on success, and a non-zero value
+        // (with no effect on 'result') if 'name' is not the name of a
+        // workload.
+
+    static void names(bsl::vector<bsl::string_view> *result);
+        // Load into the specified 'result' the names of all workloads.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
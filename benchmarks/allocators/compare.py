@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+"""Compare two 'allocbench' JSON result files and report regressions.
+
+Usage: compare.py BASELINE CURRENT [--threshold PERCENT]
+
+Records are matched on (allocator, workload, threads).  A record regresses if
+its throughput falls, or its p99 latency, peak upstream bytes, or
+fragmentation rises, by more than the threshold (default 10%).  The exit
+status is 1 if any record regresses, and 0 otherwise.
+"""
+
+import argparse
+import json
+import sys
+
+# (field, True if larger is better)
+METRICS = [
+    ("items_per_second", True),
+    ("allocate_p99_ns", False),
+    ("deallocate_p99_ns", False),
+    ("peak_upstream_bytes", False),
+    ("fragmentation", False),
+]
+
+
+def load(path):
+    records = {}
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line:
+                continue
+            r = json.loads(line)
+            records[(r["allocator"], r["workload"], r["threads"])] = r
+    return records
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="allowed change in percent (default 10)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    for key in sorted(baseline):
+        if key not in current:
+            print("missing: %s/%s/%d" % key)
+            continue
+        for field, higherIsBetter in METRICS:
+            old = baseline[key].get(field)
+            new = current[key].get(field)
+            if old is None or new is None or old == 0:
+                continue
+            change = 100.0 * (new - old) / old
+            worse = -change if higherIsBetter else change
+            if worse > args.threshold:
+                regressions += 1
+                print("REGRESSION %s/%s/%d %s: %g -> %g (%+.1f%%)"
+                      % (key + (field, old, new, change)))
+
+    print("%d regression(s)" % regressions)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
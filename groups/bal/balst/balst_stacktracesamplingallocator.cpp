@@ -0,0 +1,443 @@
+// balst_stacktracesamplingallocator.cpp                              -*-C++-*-
+#include <balst_stacktracesamplingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_stacktracesamplingallocator_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceframe.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_mallocfreeallocator.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_fstream.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace balst {
+namespace {
+
+typedef bsls::StackAddressUtil AddressUtil;
+
+enum {
+    k_IGNORE_FRAMES = AddressUtil::k_IGNORE_FRAMES + 1
+        // Number of frames at the top of a captured stack that describe the
+        // machinery gathering it: 'getStackAddresses' itself on some
+        // platforms (see 'bsls::StackAddressUtil'), and 'recordSample'.
+};
+
+void writeSymbol(bsl::ostream& stream, const StackTraceFrame& frame)
+    // Write to the specified 'stream' the symbol name of the specified
+    // 'frame' in a form suitable for a collapsed stack, or its address in
+    // hexadecimal if its symbol name is unknown.
+{
+    if (!frame.isSymbolNameKnown() || frame.symbolName().empty()) {
+        char buffer[32];
+        bsl::snprintf(buffer, sizeof buffer, "%p", frame.address());
+        stream << buffer;
+        return;                                                       // RETURN
+    }
+
+    // ';' separates the frames of a collapsed stack, and a line break would
+    // terminate it, so neither may appear in a frame.
+
+    const bsl::string& name = frame.symbolName();
+    for (bsl::size_t i = 0; i < name.length(); ++i) {
+        const char c = name[i];
+        stream << (';' == c ? ':' : '\n' == c ? ' ' : c);
+    }
+}
+
+}  // close unnamed namespace
+
+                    // ---------------------------------
+                    // class StackTraceSamplingAllocator
+                    // ---------------------------------
+
+// PRIVATE MANIPULATORS
+bsls::Types::Int64 StackTraceSamplingAllocator::nextInterval()
+{
+    if (0 == d_samplingPeriod) {
+        return 0;                                                     // RETURN
+    }
+
+    // Draw a uniform deviate in '[0, 1)' from a 64-bit xorshift* generator,
+    // and transform it into an exponentially distributed interval.
+
+    d_randomState ^= d_randomState >> 12;
+    d_randomState ^= d_randomState << 25;
+    d_randomState ^= d_randomState >> 27;
+
+    const Uint64 bits    = (d_randomState * 0x2545F4914F6CDD1DULL) >> 11;
+    const double uniform = static_cast<double>(bits) / 9007199254740992.0;
+
+    const double interval = -bsl::log(1.0 - uniform) *
+                                       static_cast<double>(d_samplingPeriod);
+
+    // Clamp to a sane range; the upper bound only matters for the vanishingly
+    // rare deviates very close to 1.
+
+    const double maxInterval = 64.0 * static_cast<double>(d_samplingPeriod);
+
+    return interval < 1.0
+           ? 1
+           : static_cast<Int64>(bsl::min(interval, maxInterval));
+}
+
+void StackTraceSamplingAllocator::recordSample(void      *address,
+                                               size_type  size,
+                                               bool       reset)
+{
+    // Capture the stack before acquiring the lock to keep the critical
+    // section short.
+
+    void *frames[k_MAX_NUM_RECORDED_FRAMES + k_IGNORE_FRAMES];
+
+    int numFrames = AddressUtil::getStackAddresses(
+                                        frames,
+                                        d_numRecordedFrames + k_IGNORE_FRAMES);
+    numFrames = bsl::max(numFrames - k_IGNORE_FRAMES, 0);
+
+    const double weight = 0 == d_samplingPeriod
+                        ? 1.0
+                        : 1.0 / (1.0 - bsl::exp(
+                                   -static_cast<double>(size) /
+                                   static_cast<double>(d_samplingPeriod)));
+
+    // If the bookkeeping cannot be allocated, the block is returned to the
+    // underlying allocator before the exception propagates.
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(address,
+                                                        d_allocator_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (reset && 0 != d_samplingPeriod) {
+        // Skip any further sampling points that fall within this block (or
+        // were passed by concurrent allocations), so that the threshold is
+        // positive again and the next crossing is detected by 'allocate'.
+
+        while (d_bytesUntilSample.addRelaxed(nextInterval()) <= 0) {
+        }
+    }
+
+    Stack stack(frames + k_IGNORE_FRAMES,
+                frames + k_IGNORE_FRAMES + numFrames,
+                d_allocator_p);
+
+    StackMap::iterator it = d_stacks.find(stack);
+    if (d_stacks.end() == it) {
+        const StackStats zero = { 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0 };
+
+        it = d_stacks.insert(StackMap::value_type(stack,
+                                                  zero,
+                                                  d_allocator_p)).first;
+    }
+
+    StackStats  *stats  = &it->second;
+    const Sample sample = { stats, size, weight };
+
+    d_samples[address] = sample;
+
+    proctor.release();
+
+    const Int64 bytes = static_cast<Int64>(size);
+
+    ++stats->d_numLive;
+    ++stats->d_numAllocated;
+    stats->d_numLiveBytes += bytes;
+    stats->d_numBytes     += bytes;
+    stats->d_estLive      += weight;
+    stats->d_estAllocated += weight;
+    stats->d_estLiveBytes += weight * static_cast<double>(size);
+    stats->d_estBytes     += weight * static_cast<double>(size);
+
+    ++d_numSamples;
+
+    d_filter[filterIndex(address)].addRelaxed(1);
+}
+
+void StackTraceSamplingAllocator::removeSample(void *address)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    SampleMap::iterator it = d_samples.find(address);
+    if (d_samples.end() == it) {
+        return;                                                       // RETURN
+    }
+
+    const Sample& sample = it->second;
+    StackStats   *stats  = sample.d_stats_p;
+
+    --stats->d_numLive;
+    stats->d_numLiveBytes -= static_cast<Int64>(sample.d_size);
+    stats->d_estLive      -= sample.d_weight;
+    stats->d_estLiveBytes -= sample.d_weight *
+                                          static_cast<double>(sample.d_size);
+
+    d_samples.erase(it);
+
+    d_filter[filterIndex(address)].addRelaxed(-1);
+}
+
+// CREATORS
+StackTraceSamplingAllocator::StackTraceSamplingAllocator(
+                                       bsls::Types::Int64  samplingPeriod,
+                                       bslma::Allocator   *basicAllocator)
+: d_bytesUntilSample(0)
+, d_samplingPeriod(samplingPeriod)
+, d_numRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES)
+, d_randomState(0)
+, d_stacks(basicAllocator ? basicAllocator
+                          : &bslma::MallocFreeAllocator::singleton())
+, d_samples(basicAllocator ? basicAllocator
+                           : &bslma::MallocFreeAllocator::singleton())
+, d_numSamples(0)
+, d_mutex()
+, d_allocator_p(basicAllocator ? basicAllocator
+                               : &bslma::MallocFreeAllocator::singleton())
+{
+    BSLS_ASSERT(0 <= samplingPeriod);
+
+    d_randomState = (static_cast<Uint64>(
+                                reinterpret_cast<bsls::Types::UintPtr>(this))
+                     * 0x9E3779B97F4A7C15ULL) | 1;
+    d_bytesUntilSample = nextInterval();
+}
+
+StackTraceSamplingAllocator::StackTraceSamplingAllocator(
+                                       bsls::Types::Int64  samplingPeriod,
+                                       int                 numRecordedFrames,
+                                       bslma::Allocator   *basicAllocator)
+: d_bytesUntilSample(0)
+, d_samplingPeriod(samplingPeriod)
+, d_numRecordedFrames(numRecordedFrames)
+, d_randomState(0)
+, d_stacks(basicAllocator ? basicAllocator
+                          : &bslma::MallocFreeAllocator::singleton())
+, d_samples(basicAllocator ? basicAllocator
+                           : &bslma::MallocFreeAllocator::singleton())
+, d_numSamples(0)
+, d_mutex()
+, d_allocator_p(basicAllocator ? basicAllocator
+                               : &bslma::MallocFreeAllocator::singleton())
+{
+    BSLS_ASSERT(0 <= samplingPeriod);
+    BSLS_ASSERT(1 <= numRecordedFrames);
+    BSLS_ASSERT(     numRecordedFrames <= k_MAX_NUM_RECORDED_FRAMES);
+
+    d_randomState = (static_cast<Uint64>(
+                                reinterpret_cast<bsls::Types::UintPtr>(this))
+                     * 0x9E3779B97F4A7C15ULL) | 1;
+    d_bytesUntilSample = nextInterval();
+}
+
+StackTraceSamplingAllocator::~StackTraceSamplingAllocator()
+{
+}
+
+// ACCESSORS
+bsls::Types::Int64 StackTraceSamplingAllocator::numLiveSamples() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<Int64>(d_samples.size());
+}
+
+bsls::Types::Int64 StackTraceSamplingAllocator::numSamples() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numSamples;
+}
+
+void StackTraceSamplingAllocator::printCollapsedStacks(
+                                                  bsl::ostream& stream,
+                                                  Measure       measure) const
+{
+    typedef bsl::pair<Stack, Int64>     Entry;
+    typedef bsl::map<const void *, int> FrameIndexMap;
+
+    // Take a snapshot of the selected estimates, so that the lock is not held
+    // while resolving symbols and writing to 'stream'.
+
+    bsl::vector<Entry> entries(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (StackMap::const_iterator it = d_stacks.begin();
+                                                d_stacks.end() != it; ++it) {
+            const StackStats& stats = it->second;
+
+            double value = 0.0;
+            switch (measure) {
+              case e_LIVE_BYTES: {
+                value = stats.d_estLiveBytes;
+              } break;
+              case e_LIVE_OBJECTS: {
+                value = stats.d_estLive;
+              } break;
+              case e_ALLOCATED_BYTES: {
+                value = stats.d_estBytes;
+              } break;
+              case e_ALLOCATED_OBJECTS: {
+                value = stats.d_estAllocated;
+              } break;
+            }
+
+            const Int64 rounded = static_cast<Int64>(value + 0.5);
+            if (0 < rounded) {
+                entries.push_back(Entry(it->first, rounded, d_allocator_p));
+            }
+        }
+    }
+
+    if (entries.empty()) {
+        return;                                                       // RETURN
+    }
+
+    // Resolve every distinct frame address of the snapshot in a single pass
+    // of the stack-trace resolver.
+
+    FrameIndexMap             frameIndex(d_allocator_p);
+    bsl::vector<const void *> addresses(d_allocator_p);
+
+    for (bsl::size_t i = 0; i < entries.size(); ++i) {
+        const Stack& stack = entries[i].first;
+        for (bsl::size_t j = 0; j < stack.size(); ++j) {
+            if (frameIndex.insert(bsl::make_pair(
+                                         stack[j],
+                                         static_cast<int>(addresses.size())))
+                                                                     .second) {
+                addresses.push_back(stack[j]);
+            }
+        }
+    }
+
+    StackTrace trace(d_allocator_p);
+    const int  rc = addresses.empty()
+                  ? 0
+                  : StackTraceUtil::loadStackTraceFromAddressArray(
+                                          &trace,
+                                          addresses.data(),
+                                          static_cast<int>(addresses.size()));
+    const bool resolved = 0 == rc &&
+                          static_cast<int>(addresses.size()) == trace.length();
+
+    for (bsl::size_t i = 0; i < entries.size(); ++i) {
+        const Stack& stack = entries[i].first;
+
+        // Frames were recorded innermost first; collapsed stacks list them
+        // outermost first.
+
+        for (bsl::size_t j = stack.size(); 0 < j; --j) {
+            if (j != stack.size()) {
+                stream << ';';
+            }
+
+            if (resolved) {
+                writeSymbol(stream, trace[frameIndex[stack[j - 1]]]);
+            }
+            else {
+                char buffer[32];
+                bsl::snprintf(buffer, sizeof buffer, "%p", stack[j - 1]);
+                stream << buffer;
+            }
+        }
+
+        stream << ' ' << entries[i].second << '\n';
+    }
+
+    stream.flush();
+}
+
+void StackTraceSamplingAllocator::printHeapProfile(bsl::ostream& stream) const
+{
+    typedef bsl::pair<Stack, StackStats> Entry;
+
+    bsl::vector<Entry> entries(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        entries.assign(d_stacks.begin(), d_stacks.end());
+    }
+
+    StackStats total = { 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0 };
+    for (bsl::size_t i = 0; i < entries.size(); ++i) {
+        total.d_numLive      += entries[i].second.d_numLive;
+        total.d_numLiveBytes += entries[i].second.d_numLiveBytes;
+        total.d_numAllocated += entries[i].second.d_numAllocated;
+        total.d_numBytes     += entries[i].second.d_numBytes;
+    }
+
+    // 'pprof' treats a sampling rate of 1 as "every allocation recorded".
+
+    const Int64 rate = bsl::max<Int64>(d_samplingPeriod, 1);
+
+    stream << "heap profile: "
+           << total.d_numLive << ": " << total.d_numLiveBytes << " ["
+           << total.d_numAllocated << ": " << total.d_numBytes
+           << "] @ heap_v2/" << rate << '\n';
+
+    for (bsl::size_t i = 0; i < entries.size(); ++i) {
+        const Stack&      stack = entries[i].first;
+        const StackStats& stats = entries[i].second;
+
+        stream << stats.d_numLive << ": " << stats.d_numLiveBytes << " ["
+               << stats.d_numAllocated << ": " << stats.d_numBytes << "] @";
+
+        for (bsl::size_t j = 0; j < stack.size(); ++j) {
+            char buffer[32];
+            bsl::snprintf(buffer,
+                          sizeof buffer,
+                          " 0x%llx",
+                          static_cast<unsigned long long>(
+                              reinterpret_cast<bsls::Types::UintPtr>(
+                                                                 stack[j])));
+            stream << buffer;
+        }
+        stream << '\n';
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    stream << "\nMAPPED_LIBRARIES:\n";
+
+    bsl::ifstream maps("/proc/self/maps");
+    if (maps) {
+        stream << maps.rdbuf();
+    }
+#endif
+
+    stream.flush();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,495 @@
+// balst_stacktracesamplingallocator.h                                -*-C++-*-
+#ifndef INCLUDED_BALST_STACKTRACESAMPLINGALLOCATOR
+#define INCLUDED_BALST_STACKTRACESAMPLINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator adaptor that samples allocation stack traces.
+//
+//@CLASSES:
+//  balst::StackTraceSamplingAllocator: sampling heap-profiling allocator
+//
+//@SEE_ALSO: balst_stacktracetestallocator, balst_stacktraceutil,
+//           bdlma_countingallocator
+//
+//@DESCRIPTION: This component provides an allocator adaptor,
+// 'balst::StackTraceSamplingAllocator', that implements the 'bslma::Allocator'
+// protocol, forwards every request to an allocator supplied at construction,
+// and records the call stack of a random *sample* of the allocations it
+// serves.  The resulting heap profile identifies the call sites responsible
+// for the bulk of a program's memory consumption, both for memory that is
+// currently in use (e.g., to find leaks or unexpected growth) and for all
+// memory allocated since construction (e.g., to find allocation hot spots).
+//..
+//             ,----------------------------------.
+//            ( balst::StackTraceSamplingAllocator )
+//             `----------------------------------'
+//                              |       ctor/dtor
+//                              |       numLiveSamples
+//                              |       numSamples
+//                              |       printCollapsedStacks
+//                              |       printHeapProfile
+//                              |       samplingPeriod
+//                              V
+//                      ,----------------.
+//                     ( bslma::Allocator )
+//                      `----------------'
+//                                      allocate
+//                                      deallocate
+//..
+// Unlike 'balst::StackTraceTestAllocator', which records a stack trace in a
+// header prepended to *every* block, this allocator adds no per-block overhead
+// to blocks that are not sampled, and the cost of an unsampled allocation or
+// deallocation is a single atomic operation in addition to the call to the
+// underlying allocator.  It is therefore suitable for use in production
+// processes.
+//
+///Sampling
+///--------
+// The allocator samples allocations in proportion to the number of bytes
+// allocated: on average, one allocation is sampled for every
+// 'samplingPeriod' bytes allocated, where 'samplingPeriod' is supplied at
+// construction.  The distance (in bytes) between successive samples is drawn
+// from an exponential distribution, so that every *byte* allocated has an
+// equal probability, '1 / samplingPeriod', of being the one that triggers a
+// sample, and the probability that a block of 'n' bytes is sampled is
+// '1 - exp(-n / samplingPeriod)'.  Large blocks are therefore almost always
+// sampled, while only a small fraction of the (usually far more numerous)
+// small blocks are.  If 'samplingPeriod' is 0, every allocation is sampled.
+//
+// For each sample, the allocator records the call stack of the allocation
+// (see 'bsls::StackAddressUtil') and the size of the block.  Samples are
+// aggregated by call stack; for each distinct call stack the allocator keeps
+// the number and total size of the sampled blocks allocated from it, and of
+// those that remain *live* (i.e., have not yet been deallocated).  When
+// a sampled block is deallocated it is moved from the live to the freed
+// totals of its call stack.  Note that allocations from a given call stack
+// that are never sampled are not represented in the profile at all; the
+// profile is a statistical estimate, whose precision improves with the
+// number of samples taken.
+//
+///Profile Output
+///--------------
+// Two output formats are supported:
+//
+//: o 'printCollapsedStacks' writes one line per distinct call stack, with the
+//:   frames (outermost first) resolved to symbol names by
+//:   'balst::StackTraceUtil' -- i.e., by the platform's
+//:   'balst::StackTraceResolverImpl' (ELF on Linux and Solaris) -- and joined
+//:   by ';', followed by a space and an estimate of the selected 'Measure'
+//:   attributable to that stack.  This is the "collapsed stack" format
+//:   consumed by the 'flamegraph.pl' family of tools.  The estimate of the
+//:   number of objects and bytes for a sampled block of 'n' bytes is obtained
+//:   by dividing the observed count by '1 - exp(-n / samplingPeriod)'.
+//:
+//: o 'printHeapProfile' writes the (unresolved) samples in the legacy text
+//:   heap profile format understood by 'pprof' ('heap_v2'), followed on Linux
+//:   by the process's memory map so that 'pprof' can symbolize the addresses
+//:   offline.  'pprof' applies the sampling-rate correction itself.
+//
+// Both methods take a consistent snapshot of the samples while holding this
+// object's lock, and release the lock before resolving symbols or writing to
+// the stream, so that allocations made while printing (possibly from this
+// very allocator) neither deadlock nor appear in the snapshot.
+//
+///Thread Safety
+///-------------
+// 'balst::StackTraceSamplingAllocator' is fully *thread-safe*, meaning that
+// any operation on the same object can be safely invoked from any thread.
+// The thread safety of the underlying allocator is the responsibility of the
+// client.
+//
+///Bookkeeping Memory
+///------------------
+// The sample records are allocated from the allocator supplied at
+// construction, and (like 'balst::StackTraceTestAllocator') this allocator
+// defaults to the 'bslma::MallocFreeAllocator' singleton, rather than the
+// currently installed default allocator, so that an instance of this class may
+// itself be installed as the default allocator.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling the Memory Use of a Subsystem
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a long-running service has a memory footprint that grows
+// steadily over time, and we would like to find out which code is responsible
+// without the overhead of recording every allocation.
+//
+// First, we define a function that "leaks" some of the memory it allocates
+// (for the purpose of this example, the leaked blocks are collected in a
+// vector so that they can be reclaimed later):
+//..
+//  void leakSome(bsl::vector<void *> *leaked,
+//                bslma::Allocator    *allocator,
+//                int                  numBlocks)
+//      // Allocate the specified 'numBlocks' blocks of 100 bytes from the
+//      // specified 'allocator', deallocate all but every tenth of them, and
+//      // append the addresses of the remaining blocks to the specified
+//      // 'leaked'.
+//  {
+//      for (int i = 0; i < numBlocks; ++i) {
+//          void *p = allocator->allocate(100);
+//          if (0 == i % 10) {
+//              leaked->push_back(p);
+//          }
+//          else {
+//              allocator->deallocate(p);
+//          }
+//      }
+//  }
+//..
+// Then, we create a sampling allocator that samples roughly one allocation in
+// every 4K bytes, and supply it to the suspect code:
+//..
+//  bslma::TestAllocator               ta;
+//  balst::StackTraceSamplingAllocator sampler(4096, &ta);
+//
+//  bsl::vector<void *> leaked;
+//  leakSome(&leaked, &sampler, 10000);
+//..
+// Next, we observe that, of the 1,000,000 bytes allocated, around 250
+// allocations have been sampled, and that roughly a tenth of them are still
+// live:
+//..
+//  assert(100 < sampler.numSamples());
+//  assert(0   < sampler.numLiveSamples());
+//  assert(sampler.numLiveSamples() < sampler.numSamples() / 2);
+//..
+// Then, we write the estimated number of bytes still in use from each call
+// stack (the default measure) in the collapsed-stack format.  The output can
+// be rendered as a flame graph in which 'leakSome' accounts for
+// (approximately) the 100,000 bytes that were leaked:
+//..
+//  bsl::ostringstream oss;
+//  sampler.printCollapsedStacks(oss);
+//  assert(!oss.str().empty());
+//..
+// Finally, we reclaim the leaked blocks, after which no samples are live:
+//..
+//  for (bsl::size_t i = 0; i < leaked.size(); ++i) {
+//      sampler.deallocate(leaked[i]);
+//  }
+//  assert(0 == sampler.numLiveSamples());
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                    // =================================
+                    // class StackTraceSamplingAllocator
+                    // =================================
+
+class StackTraceSamplingAllocator : public bslma::Allocator {
+    // This class provides a thread-safe allocator adaptor that forwards all
+    // requests to an underlying allocator, and records the call stack of a
+    // random sample of allocations, chosen with a probability proportional to
+    // their size, so as to produce a heap profile at low cost.
+
+  public:
+    // PUBLIC TYPES
+    enum Measure {
+        // Enumerate the quantities that 'printCollapsedStacks' can report for
+        // each call stack.
+
+        e_LIVE_BYTES,         // estimated bytes currently in use
+        e_LIVE_OBJECTS,       // estimated blocks currently in use
+        e_ALLOCATED_BYTES,    // estimated bytes allocated since construction
+        e_ALLOCATED_OBJECTS   // estimated blocks allocated since construction
+    };
+
+    enum {
+        k_DEFAULT_NUM_RECORDED_FRAMES = 16,  // default stack depth recorded
+
+        k_MAX_NUM_RECORDED_FRAMES     = 64   // maximum stack depth recorded
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64  Int64;
+    typedef bsls::Types::Uint64 Uint64;
+
+    typedef bsl::vector<const void *> Stack;
+
+    struct StackStats {
+        // Sampled totals attributed to one call stack.
+
+        Int64  d_numLive;        // sampled blocks not yet deallocated
+        Int64  d_numLiveBytes;   // bytes in sampled blocks not deallocated
+        Int64  d_numAllocated;   // sampled blocks allocated
+        Int64  d_numBytes;       // bytes in sampled blocks allocated
+        double d_estLive;        // estimated blocks not yet deallocated
+        double d_estLiveBytes;   // estimated bytes not yet deallocated
+        double d_estAllocated;   // estimated blocks allocated
+        double d_estBytes;       // estimated bytes allocated
+    };
+
+    typedef bsl::map<Stack, StackStats> StackMap;
+
+    struct Sample {
+        // Record of a live sampled block.
+
+        StackStats *d_stats_p;   // totals of the allocating call stack
+        size_type   d_size;      // size of the block
+        double      d_weight;    // estimated blocks represented by the block
+    };
+
+    typedef bsl::unordered_map<const void *, Sample> SampleMap;
+
+    enum {
+        k_FILTER_BITS  = 10,                   // log2 of the filter size
+
+        k_FILTER_SIZE  = 1 << k_FILTER_BITS    // number of filter counters
+    };
+
+    // DATA
+    bsls::AtomicInt64     d_bytesUntilSample;  // bytes to allocate before the
+                                               // next sample is taken
+
+    bsls::AtomicInt       d_filter[k_FILTER_SIZE];
+                                               // number of live samples whose
+                                               // address hashes to each slot;
+                                               // a zero count lets
+                                               // 'deallocate' skip the sample
+                                               // lookup
+
+    const Int64           d_samplingPeriod;    // mean bytes between samples
+
+    const int             d_numRecordedFrames; // stack depth to record
+
+    Uint64                d_randomState;       // state of the generator of
+                                               // sampling intervals
+
+    StackMap              d_stacks;            // totals, by call stack
+
+    SampleMap             d_samples;           // live samples, by address
+
+    Int64                 d_numSamples;        // samples taken
+
+    mutable bslmt::Mutex  d_mutex;             // guards the samples and the
+                                               // random state
+
+    bslma::Allocator     *d_allocator_p;       // underlying allocator (held,
+                                               // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    StackTraceSamplingAllocator(const StackTraceSamplingAllocator&);
+    StackTraceSamplingAllocator& operator=(const StackTraceSamplingAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static int filterIndex(const void *address);
+        // Return the index of the 'd_filter' counter for the specified
+        // 'address'.
+
+    // PRIVATE MANIPULATORS
+    Int64 nextInterval();
+        // Return the number of bytes to allocate before the next sample is
+        // taken, drawn from an exponential distribution whose mean is the
+        // sampling period.  The behavior is undefined unless 'd_mutex' is
+        // locked by the calling thread.
+
+    void recordSample(void *address, size_type size, bool reset);
+        // Record the call stack of the calling thread as a sample of the block
+        // of the specified 'size' at the specified 'address'.  If the
+        // specified 'reset' is 'true', also draw the next sampling interval.
+
+    void removeSample(void *address);
+        // If the block at the specified 'address' was sampled, move its
+        // sample from the live to the freed totals of its call stack;
+        // otherwise, this method has no effect.
+
+  public:
+    // CREATORS
+    explicit
+    StackTraceSamplingAllocator(bsls::Types::Int64  samplingPeriod,
+                                bslma::Allocator   *basicAllocator = 0);
+    StackTraceSamplingAllocator(bsls::Types::Int64  samplingPeriod,
+                                int                 numRecordedFrames,
+                                bslma::Allocator   *basicAllocator = 0);
+        // Create a sampling allocator that samples, on average, one
+        // allocation for every specified 'samplingPeriod' bytes allocated,
+        // or every allocation if 'samplingPeriod' is 0.  Optionally specify
+        // 'numRecordedFrames', the maximum number of stack frames recorded
+        // for each sample; if 'numRecordedFrames' is not specified,
+        // 'k_DEFAULT_NUM_RECORDED_FRAMES' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory, both to clients and for
+        // the sample records.  If 'basicAllocator' is 0, the
+        // 'bslma::MallocFreeAllocator' singleton is used.  The behavior is
+        // undefined unless '0 <= samplingPeriod' and
+        // '1 <= numRecordedFrames <= k_MAX_NUM_RECORDED_FRAMES'.
+
+    virtual ~StackTraceSamplingAllocator();
+        // Destroy this allocator.  Note that blocks allocated from this
+        // object and not yet deallocated are *not* released; they remain
+        // allocated from the underlying allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes), obtained from the underlying allocator,
+        // and, if the allocation is chosen for sampling, record the call stack
+        // of the calling thread.  If 'size' is 0, a null pointer is returned
+        // with no other effect.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // underlying allocator.  If the block was sampled, move its sample
+        // from the live to the freed totals of its call stack.  If 'address'
+        // is 0, this function has no effect.  The behavior is undefined unless
+        // 'address' was allocated using this allocator object and has not
+        // already been deallocated.  Note that the sized 'deallocate' overload
+        // inherited from 'bslma::Allocator' also invokes this method, so the
+        // (advisory) size and alignment hints are not forwarded to the
+        // underlying allocator.
+
+    // ACCESSORS
+    bsls::Types::Int64 numLiveSamples() const;
+        // Return the number of sampled blocks that have not yet been
+        // deallocated.
+
+    bsls::Types::Int64 numSamples() const;
+        // Return the number of allocations that have been sampled since this
+        // object was constructed.
+
+    int numRecordedFrames() const;
+        // Return the maximum number of stack frames recorded for each sample.
+
+    void printCollapsedStacks(bsl::ostream& stream,
+                              Measure       measure = e_LIVE_BYTES) const;
+        // Write to the specified 'stream' one line for each distinct sampled
+        // call stack, consisting of the symbol names of its frames, outermost
+        // first, separated by ';', followed by a space and the estimate of
+        // the optionally specified 'measure' attributable to that call stack,
+        // rounded to the nearest integer.  If 'measure' is not specified,
+        // 'e_LIVE_BYTES' is used.  Call stacks whose estimate rounds to 0 are
+        // omitted.  Frames whose symbol cannot be resolved are written as
+        // hexadecimal addresses.
+
+    void printHeapProfile(bsl::ostream& stream) const;
+        // Write to the specified 'stream' the samples taken by this allocator
+        // in the legacy text heap profile format understood by 'pprof', with
+        // unresolved frame addresses.  On Linux, append the memory map of the
+        // process (from '/proc/self/maps') to allow 'pprof' to symbolize the
+        // profile.
+
+    bsls::Types::Int64 samplingPeriod() const;
+        // Return the mean number of bytes allocated between samples, or 0 if
+        // every allocation is sampled.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                    // ---------------------------------
+                    // class StackTraceSamplingAllocator
+                    // ---------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+int StackTraceSamplingAllocator::filterIndex(const void *address)
+{
+    // Fibonacci hashing of the address, discarding the low-order bits, which
+    // are constant for aligned blocks.
+
+    const Uint64 hash = (static_cast<Uint64>(
+                             reinterpret_cast<bsls::Types::UintPtr>(address))
+                         >> 4) * 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<int>(hash >> (64 - k_FILTER_BITS));
+}
+
+// MANIPULATORS
+inline
+void *StackTraceSamplingAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    void *address = d_allocator_p->allocate(size);
+
+    const Int64 remaining = d_bytesUntilSample.addRelaxed(
+                                                 -static_cast<Int64>(size));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(remaining <= 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Only the thread whose request crossed the sampling threshold takes
+        // the sample (and draws the next interval), unless every allocation
+        // is to be sampled.
+
+        const bool crossed = remaining + static_cast<Int64>(size) > 0;
+
+        if (crossed || 0 == d_samplingPeriod) {
+            recordSample(address, size, crossed);
+        }
+    }
+
+    return address;
+}
+
+inline
+void StackTraceSamplingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                         0 != d_filter[filterIndex(address)].loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        removeSample(address);
+    }
+
+    d_allocator_p->deallocate(address);
+}
+
+// ACCESSORS
+inline
+int StackTraceSamplingAllocator::numRecordedFrames() const
+{
+    return d_numRecordedFrames;
+}
+
+inline
+bsls::Types::Int64 StackTraceSamplingAllocator::samplingPeriod() const
+{
+    return d_samplingPeriod;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1030 @@
+// balst_stacktracesamplingallocator.t.cpp                            -*-C++-*-
+#include <balst_stacktracesamplingallocator.h>
+
+#include <balst_objectfileformat.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a thread-safe allocator adaptor that forwards
+// all requests to an underlying allocator and records the call stacks of a
+// random sample of allocations.  We first verify the forwarding behavior and
+// the bookkeeping of live and freed samples with a sampling period of 0
+// (under which every allocation is sampled, making the results
+// deterministic), then verify the statistical properties of the sampling with
+// a positive sampling period, and finally verify the two output formats.
+//
+// We use 'bslma::TestAllocator' as the underlying allocator throughout, both
+// to verify that every request is forwarded and that the bookkeeping memory
+// is obtained from (and returned to) the supplied allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] StackTraceSamplingAllocator(Int64 period, Allocator *ba = 0);
+// [ 2] StackTraceSamplingAllocator(Int64, int frames, Allocator *ba = 0);
+// [ 2] ~StackTraceSamplingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void deallocate(void *address, size_type size, size_type align);
+//
+// ACCESSORS
+// [ 3] Int64 numLiveSamples() const;
+// [ 3] Int64 numSamples() const;
+// [ 2] int numRecordedFrames() const;
+// [ 5] void printCollapsedStacks(ostream& stream, Measure m) const;
+// [ 6] void printHeapProfile(ostream& stream) const;
+// [ 2] Int64 samplingPeriod() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: samples are taken at the requested average rate
+// [ 7] CONCERN: concurrent allocation and deallocation is thread-safe
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::StackTraceSamplingAllocator Obj;
+typedef bsls::Types::Int64                 Int64;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define NOINLINE __attribute__((noinline))
+#else
+#define NOINLINE
+#endif
+
+NOINLINE
+void *balstSamplingTestAllocateA(bslma::Allocator *allocator, int size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  Note that this function has external linkage and is not
+    // inlined so that it appears, by name, in resolved stack traces.
+{
+    void *result = allocator->allocate(size);
+    bsl::memset(result, 0, size);
+    return result;
+}
+
+NOINLINE
+void *balstSamplingTestAllocateB(bslma::Allocator *allocator, int size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  Note that this function has external linkage and is not
+    // inlined so that it appears, by name, in resolved stack traces.
+{
+    void *result = allocator->allocate(size);
+    bsl::memset(result, 0, size);
+    return result;
+}
+
+static
+Int64 sumCollapsed(const bsl::string& profile, const char *frameName = 0)
+    // Return the sum of the values of the lines of the specified
+    // collapsed-stack 'profile'.  If the optionally specified 'frameName' is
+    // not 0, only lines containing 'frameName' are summed.  Assert that every
+    // line has the form '<frames> <value>'.
+{
+    Int64              sum = 0;
+    bsl::istringstream iss(profile);
+    bsl::string        line;
+
+    while (bsl::getline(iss, line)) {
+        const bsl::size_t space = line.rfind(' ');
+        ASSERTV(line, bsl::string::npos != space);
+        ASSERTV(line, 0 < space);
+        if (bsl::string::npos == space) {
+            continue;
+        }
+
+        if (frameName && bsl::string::npos == line.find(frameName)) {
+            continue;
+        }
+
+        const Int64 value = bsl::atoll(line.c_str() + space + 1);
+        ASSERTV(line, 0 < value);
+        sum += value;
+    }
+
+    return sum;
+}
+
+static
+int numLines(const bsl::string& text)
+    // Return the number of lines in the specified 'text'.
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < text.length(); ++i) {
+        count += '\n' == text[i];
+    }
+    return count;
+}
+
+                        // ============================
+                        // class SizeRecordingAllocator
+                        // ============================
+
+class SizeRecordingAllocator : public bslma::Allocator {
+    // This test allocator obtains memory from an upstream allocator and
+    // records the blocks returned through each 'deallocate' overload.
+
+    // DATA
+    bslma::Allocator *d_upstream_p;        // supplies memory (held, not
+                                           // owned)
+    void             *d_lastSizedAddress_p;
+                                           // last block returned through the
+                                           // sized overload
+    void             *d_lastUnsizedAddress_p;
+                                           // last block returned through the
+                                           // unsized overload
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual void doDeallocate(void      *address,
+                              size_type  size,
+                              size_type  alignment)
+        // Record the specified 'address' and return the block at 'address'
+        // to the upstream allocator, ignoring the specified 'size' and
+        // 'alignment'.
+    {
+        (void)size;
+        (void)alignment;
+
+        d_lastSizedAddress_p = address;
+        d_upstream_p->deallocate(address);
+    }
+
+  public:
+    // CREATORS
+    explicit SizeRecordingAllocator(bslma::Allocator *upstream)
+    : d_upstream_p(upstream)
+    , d_lastSizedAddress_p(0)
+    , d_lastUnsizedAddress_p(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        return d_upstream_p->allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+    {
+        d_lastUnsizedAddress_p = address;
+        d_upstream_p->deallocate(address);
+    }
+
+    // ACCESSORS
+    void *lastSizedAddress() const { return d_lastSizedAddress_p; }
+    void *lastUnsizedAddress() const { return d_lastUnsizedAddress_p; }
+};
+
+extern "C"
+void *workerThread(void *arg)
+    // Allocate and deallocate blocks of various sizes from the
+    // 'bslma::Allocator' at the specified 'arg', keeping a bounded number of
+    // blocks live at any time, and deallocate every block before returning.
+{
+    bslma::Allocator *allocator = static_cast<bslma::Allocator *>(arg);
+
+    enum { k_NUM_SLOTS = 64, k_NUM_ITERATIONS = 20000 };
+
+    void *slots[k_NUM_SLOTS] = { 0 };
+    int   sizes[k_NUM_SLOTS] = { 0 };
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        const int slot = (i * 7) % k_NUM_SLOTS;
+
+        if (slots[slot]) {
+            if (i % 2) {
+                allocator->deallocate(slots[slot]);
+            }
+            else {
+                allocator->deallocate(slots[slot], sizes[slot], 1);
+            }
+        }
+        sizes[slot] = 1 + (i * 13) % 500;
+        slots[slot] = allocator->allocate(sizes[slot]);
+    }
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        allocator->deallocate(slots[i]);
+    }
+
+    return 0;
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling the Memory Use of a Subsystem
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a long-running service has a memory footprint that grows
+// steadily over time, and we would like to find out which code is responsible
+// without the overhead of recording every allocation.
+//
+// First, we define a function that "leaks" some of the memory it allocates
+// (for the purpose of this example, the leaked blocks are collected in a
+// vector so that they can be reclaimed later):
+//..
+    void leakSome(bsl::vector<void *> *leaked,
+                  bslma::Allocator    *allocator,
+                  int                  numBlocks)
+        // Allocate the specified 'numBlocks' blocks of 100 bytes from the
+        // specified 'allocator', deallocate all but every tenth of them, and
+        // append the addresses of the remaining blocks to the specified
+        // 'leaked'.
+    {
+        for (int i = 0; i < numBlocks; ++i) {
+            void *p = allocator->allocate(100);
+            if (0 == i % 10) {
+                leaked->push_back(p);
+            }
+            else {
+                allocator->deallocate(p);
+            }
+        }
+    }
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // The component must not use the default allocator.
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create a sampling allocator that samples roughly one allocation in
+// every 4K bytes, and supply it to the suspect code:
+//..
+    bslma::TestAllocator               ta;
+    balst::StackTraceSamplingAllocator sampler(4096, &ta);
+
+    bsl::vector<void *> leaked;
+    leakSome(&leaked, &sampler, 10000);
+//..
+// Next, we observe that, of the 1,000,000 bytes allocated, around 250
+// allocations have been sampled, and that roughly a tenth of them are still
+// live:
+//..
+    ASSERT(100 < sampler.numSamples());
+    ASSERT(0   < sampler.numLiveSamples());
+    ASSERT(sampler.numLiveSamples() < sampler.numSamples() / 2);
+//..
+// Then, we write the estimated number of bytes still in use from each call
+// stack (the default measure) in the collapsed-stack format.  The output can
+// be rendered as a flame graph in which 'leakSome' accounts for
+// (approximately) the 100,000 bytes that were leaked:
+//..
+    bsl::ostringstream oss;
+    sampler.printCollapsedStacks(oss);
+    ASSERT(!oss.str().empty());
+//..
+// Finally, we reclaim the leaked blocks, after which no samples are live:
+//..
+    for (bsl::size_t i = 0; i < leaked.size(); ++i) {
+        sampler.deallocate(leaked[i]);
+    }
+    ASSERT(0 == sampler.numLiveSamples());
+//..
+
+        if (veryVerbose) cout << oss.str();
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' and both 'deallocate' overloads
+        //:   from several threads keep the sample bookkeeping consistent.
+        //
+        // Plan:
+        //: 1 Run several threads that allocate and deallocate blocks of
+        //:   various sizes through one object, with a sampling period small
+        //:   enough that many samples are taken, and then verify that no
+        //:   samples are live and that all memory was returned.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: concurrent allocation and deallocation is thread-safe
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_THREADS = 4 };
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+        {
+            Obj mX(512, &ta);  const Obj& X = mX;
+
+            bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                const int rc = bslmt::ThreadUtil::create(&threads[i],
+                                                         workerThread,
+                                                         &mX);
+                ASSERTV(i, 0 == rc);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                const int rc = bslmt::ThreadUtil::join(threads[i]);
+                ASSERTV(i, 0 == rc);
+            }
+
+            if (veryVerbose) { P(X.numSamples()); }
+
+            ASSERT(0 <  X.numSamples());
+            ASSERT(0 == X.numLiveSamples());
+
+            bsl::ostringstream oss;
+            X.printCollapsedStacks(oss, Obj::e_LIVE_OBJECTS);
+            ASSERTV(oss.str(), oss.str().empty());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'printHeapProfile'
+        //
+        // Concerns:
+        //: 1 The first line is the 'heap_v2' header, reporting the numbers
+        //:   and total sizes of live and of all sampled blocks, and the
+        //:   sampling period (or 1 if every allocation is sampled).
+        //:
+        //: 2 Each distinct call stack is written on one line with its sampled
+        //:   totals, followed by its frame addresses in hexadecimal.
+        //:
+        //: 3 On Linux, the process memory map follows the samples.
+        //
+        // Plan:
+        //: 1 Allocate blocks from two call sites, deallocate some, and verify
+        //:   the header and the number and content of the sample lines.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   void printHeapProfile(ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'printHeapProfile'" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+        {
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            {
+                bsl::ostringstream oss;
+                X.printHeapProfile(oss);
+
+                const bsl::string& s = oss.str();
+                ASSERTV(s, 0 == s.find("heap profile: 0: 0 [0: 0] @ "
+                                       "heap_v2/1\n"));
+            }
+
+            // Allocate both 'a' blocks from the same call stack.
+
+            void *a[2];
+            for (int i = 0; i < 2; ++i) {
+                a[i] = balstSamplingTestAllocateA(&mX, 10);
+            }
+            void *b = balstSamplingTestAllocateB(&mX, 30);
+
+            mX.deallocate(a[1]);
+
+            bsl::ostringstream oss;
+            X.printHeapProfile(oss);
+
+            const bsl::string& s = oss.str();
+            if (veryVerbose) cout << s.substr(0, s.find("MAPPED")) << endl;
+
+            ASSERTV(s, 0 == s.find("heap profile: 2: 40 [3: 50] @ "
+                                   "heap_v2/1\n"));
+            ASSERTV(s, bsl::string::npos != s.find("\n1: 10 [2: 20] @ 0x"));
+            ASSERTV(s, bsl::string::npos != s.find("\n1: 30 [1: 30] @ 0x"));
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            const bsl::size_t maps = s.find("\nMAPPED_LIBRARIES:\n");
+            ASSERTV(s, bsl::string::npos != maps);
+            ASSERTV(s, 3 == numLines(s.substr(0, maps)));
+            ASSERTV(s, s.length() > maps + 20);
+#else
+            ASSERTV(s, 3 == numLines(s));
+#endif
+
+            mX.deallocate(a[0]);
+            mX.deallocate(b);
+
+            bsl::ostringstream oss2;
+            X.printHeapProfile(oss2);
+            ASSERTV(oss2.str(), 0 == oss2.str().find(
+                                 "heap profile: 0: 0 [3: 50] @ heap_v2/1\n"));
+        }
+        {
+            Obj mX(12345, &ta);  const Obj& X = mX;
+
+            bsl::ostringstream oss;
+            X.printHeapProfile(oss);
+            ASSERTV(oss.str(), 0 == oss.str().find(
+                                 "heap profile: 0: 0 [0: 0] @ heap_v2/12345"));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'printCollapsedStacks'
+        //
+        // Concerns:
+        //: 1 Each distinct call stack with a non-zero estimate is written on
+        //:   one line, as ';'-separated frames followed by a space and the
+        //:   estimate of the selected measure.
+        //:
+        //: 2 Frames are resolved to symbol names, outermost first, so that the
+        //:   allocating function appears after its callers.
+        //:
+        //: 3 Live measures exclude deallocated samples, while allocated
+        //:   measures include them.
+        //:
+        //: 4 Nothing is written if there are no samples.
+        //
+        // Plan:
+        //: 1 With every allocation sampled, allocate blocks from two named
+        //:   call sites, deallocate some of them, and check the sums of the
+        //:   values written for each measure and call site.  (C-1, 3..4)
+        //:
+        //: 2 Where symbols can be resolved, verify that each call site's name
+        //:   appears, and appears after the name of 'main'.  (C-2)
+        //
+        // Testing:
+        //   void printCollapsedStacks(ostream& stream, Measure m) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'printCollapsedStacks'" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+        {
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            {
+                bsl::ostringstream oss;
+                X.printCollapsedStacks(oss);
+                ASSERT(oss.str().empty());
+            }
+
+            void *a[5];
+            for (int i = 0; i < 5; ++i) {
+                a[i] = balstSamplingTestAllocateA(&mX, 100);
+            }
+            void *b = balstSamplingTestAllocateB(&mX, 1000);
+
+            mX.deallocate(a[0]);
+            mX.deallocate(a[1]);
+
+            const char *A = "balstSamplingTestAllocateA";
+            const char *B = "balstSamplingTestAllocateB";
+
+            bsl::ostringstream ossLB, ossLO, ossAB, ossAO;
+            X.printCollapsedStacks(ossLB);
+            X.printCollapsedStacks(ossLO, Obj::e_LIVE_OBJECTS);
+            X.printCollapsedStacks(ossAB, Obj::e_ALLOCATED_BYTES);
+            X.printCollapsedStacks(ossAO, Obj::e_ALLOCATED_OBJECTS);
+
+            if (veryVerbose) cout << ossLB.str();
+
+            ASSERTV(ossLB.str(), 1300 == sumCollapsed(ossLB.str()));
+            ASSERTV(ossLO.str(),    4 == sumCollapsed(ossLO.str()));
+            ASSERTV(ossAB.str(), 1500 == sumCollapsed(ossAB.str()));
+            ASSERTV(ossAO.str(),    6 == sumCollapsed(ossAO.str()));
+
+#if defined(BALST_OBJECTFILEFORMAT_RESOLVER_ELF)
+            ASSERTV(ossLB.str(),  300 == sumCollapsed(ossLB.str(), A));
+            ASSERTV(ossLB.str(), 1000 == sumCollapsed(ossLB.str(), B));
+            ASSERTV(ossAO.str(),    5 == sumCollapsed(ossAO.str(), A));
+            ASSERTV(ossAO.str(),    1 == sumCollapsed(ossAO.str(), B));
+
+            const bsl::string& s = ossLB.str();
+            ASSERTV(s, bsl::string::npos != s.find("main;"));
+            ASSERTV(s, s.find("main;") < s.find(A));
+#else
+            (void)A;
+            (void)B;
+#endif
+
+            for (int i = 2; i < 5; ++i) {
+                mX.deallocate(a[i]);
+            }
+            mX.deallocate(b);
+
+            bsl::ostringstream ossNone;
+            X.printCollapsedStacks(ossNone);
+            ASSERTV(ossNone.str(), ossNone.str().empty());
+
+            bsl::ostringstream ossAll;
+            X.printCollapsedStacks(ossAll, Obj::e_ALLOCATED_OBJECTS);
+            ASSERTV(ossAll.str(), 6 == sumCollapsed(ossAll.str()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SAMPLING RATE
+        //
+        // Concerns:
+        //: 1 With a positive sampling period, on average one allocation is
+        //:   sampled for every 'samplingPeriod' bytes allocated.
+        //:
+        //: 2 The estimated totals reported by 'printCollapsedStacks' are
+        //:   (statistically) unbiased estimates of the true totals, for both
+        //:   small and large blocks.
+        //
+        // Plan:
+        //: 1 Allocate many small blocks, and a smaller number of blocks
+        //:   larger than the sampling period, and verify that the number of
+        //:   samples, and the estimated numbers of objects and bytes, are
+        //:   within a generous tolerance of the expected values.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: samples are taken at the requested average rate
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING RATE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+        {
+            enum { k_PERIOD = 1024, k_SIZE = 64, k_NUM_BLOCKS = 200000 };
+
+            Obj mX(k_PERIOD, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(mX.allocate(k_SIZE));
+            }
+
+            const Int64 expected = static_cast<Int64>(k_NUM_BLOCKS) * k_SIZE
+                                                                   / k_PERIOD;
+            const Int64 numSamples = X.numSamples();
+
+            if (veryVerbose) { P_(expected) P(numSamples) }
+
+            ASSERTV(expected, numSamples, expected * 9 / 10 < numSamples);
+            ASSERTV(expected, numSamples, numSamples < expected * 11 / 10);
+            ASSERT(0 == X.numLiveSamples());
+
+            bsl::ostringstream ossAO, ossAB;
+            X.printCollapsedStacks(ossAO, Obj::e_ALLOCATED_OBJECTS);
+            X.printCollapsedStacks(ossAB, Obj::e_ALLOCATED_BYTES);
+
+            const Int64 estObjects = sumCollapsed(ossAO.str());
+            const Int64 estBytes   = sumCollapsed(ossAB.str());
+
+            if (veryVerbose) { P_(estObjects) P(estBytes) }
+
+            ASSERTV(estObjects, k_NUM_BLOCKS * 9 / 10 < estObjects);
+            ASSERTV(estObjects, estObjects < k_NUM_BLOCKS * 11 / 10);
+
+            const Int64 totalBytes = static_cast<Int64>(k_NUM_BLOCKS)
+                                                                     * k_SIZE;
+            ASSERTV(estBytes, totalBytes * 9 / 10 < estBytes);
+            ASSERTV(estBytes, estBytes < totalBytes * 11 / 10);
+        }
+        {
+            enum { k_PERIOD = 1024, k_SIZE = 10000, k_NUM_BLOCKS = 1000 };
+
+            Obj mX(k_PERIOD, &ta);  const Obj& X = mX;
+
+            bsl::vector<void *> blocks(&ta);
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks.push_back(mX.allocate(k_SIZE));
+            }
+
+            // A block 10 times the sampling period is sampled with
+            // probability '1 - exp(-10)'.
+
+            ASSERTV(X.numSamples(), k_NUM_BLOCKS - 5 < X.numSamples());
+            ASSERT(X.numSamples() == X.numLiveSamples());
+
+            bsl::ostringstream oss;
+            X.printCollapsedStacks(oss, Obj::e_LIVE_BYTES);
+
+            const Int64 estBytes   = sumCollapsed(oss.str());
+            const Int64 totalBytes = static_cast<Int64>(k_NUM_BLOCKS)
+                                                                     * k_SIZE;
+            ASSERTV(estBytes, totalBytes * 99 / 100 < estBytes);
+            ASSERTV(estBytes, estBytes < totalBytes * 101 / 100);
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(0 == X.numLiveSamples());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' and both 'deallocate' overloads forward to the
+        //:   underlying allocator.
+        //:
+        //: 2 'allocate(0)' returns 0 and takes no sample, and deallocating a
+        //:   null pointer has no effect on the samples.
+        //:
+        //: 3 With a sampling period of 0, every allocation is sampled, and
+        //:   each deallocation of a sampled block (through either overload)
+        //:   makes its sample no longer live.
+        //:
+        //: 4 The sized 'deallocate' overload returns the block through the
+        //:   unsized 'deallocate' of the underlying allocator, as its size
+        //:   hint is advisory.
+        //:
+        //: 5 The bookkeeping memory is obtained from the underlying allocator
+        //:   and never from the default allocator.
+        //
+        // Plan:
+        //: 1 Using a sampling period of 0, allocate and deallocate blocks,
+        //:   checking 'numSamples', 'numLiveSamples', and the statistics of
+        //:   the underlying test allocator after each operation.  (C-1..3, 5)
+        //:
+        //: 2 Supply an allocator that records the blocks returned through each
+        //:   of its 'deallocate' overloads, deallocate through the sized
+        //:   overload of the object under test, and verify that the block was
+        //:   returned through the unsized overload.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   void deallocate(void *address, size_type size, size_type align);
+        //   Int64 numLiveSamples() const;
+        //   Int64 numSamples() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+        {
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.numSamples());
+            ASSERT(0 == X.numLiveSamples());
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(0 == X.numSamples());
+            ASSERT(0 == ta.numAllocations());
+
+            // Note that the bookkeeping for a sample is also allocated from
+            // 'ta', after the client's block.
+
+            Int64 numAllocations = ta.numAllocations();
+
+            void *p1 = mX.allocate(8);
+            ASSERT(0 != p1);
+            ASSERT(1 == X.numSamples());
+            ASSERT(1 == X.numLiveSamples());
+            ASSERT(numAllocations < ta.numAllocations());
+
+            numAllocations = ta.numAllocations();
+
+            void *p2 = mX.allocate(24);
+            ASSERT(2 == X.numSamples());
+            ASSERT(2 == X.numLiveSamples());
+            ASSERT(numAllocations < ta.numAllocations());
+            ASSERT(p1 != p2);
+
+            mX.deallocate(0);
+            ASSERT(2 == X.numLiveSamples());
+
+            mX.deallocate(p1);
+            ASSERT(2  == X.numSamples());
+            ASSERT(1  == X.numLiveSamples());
+            ASSERT(p1 == ta.lastDeallocatedAddress());
+
+            bslma::Allocator& base = mX;
+            base.deallocate(p2, 24, 8);
+            ASSERT(2  == X.numSamples());
+            ASSERT(0  == X.numLiveSamples());
+            ASSERT(p2 == ta.lastDeallocatedAddress());
+
+            base.deallocate(0, 0, 1);
+            ASSERT(0  == X.numLiveSamples());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            SizeRecordingAllocator sra(&ta);
+
+            Obj mX(0, &sra);  const Obj& X = mX;
+
+            bslma::Allocator& base = mX;
+
+            void *p = base.allocate(40);
+            ASSERT(1 == X.numLiveSamples());
+
+            // Note that the sample's bookkeeping is also released through
+            // 'sra', using the sized overload.
+
+            base.deallocate(p, 40, 8);
+            ASSERT(0 == X.numLiveSamples());
+            ASSERT(p == sra.lastUnsizedAddress());
+            ASSERT(p != sra.lastSizedAddress());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The sampling period and number of recorded frames supplied at
+        //:   construction are reported by the accessors, and the number of
+        //:   recorded frames defaults to 'k_DEFAULT_NUM_RECORDED_FRAMES'.
+        //:
+        //: 2 If no allocator is supplied, the default allocator is not used.
+        //:
+        //: 3 The destructor releases all bookkeeping memory, even if sampled
+        //:   blocks are still live.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Construct objects with each constructor and verify the
+        //:   accessors.  (C-1..2)
+        //:
+        //: 2 Destroy an object with live samples and verify that only the
+        //:   client's block remains allocated from the underlying allocator.
+        //:   (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   StackTraceSamplingAllocator(Int64 period, Allocator *ba = 0);
+        //   StackTraceSamplingAllocator(Int64, int frames, Allocator *ba = 0);
+        //   ~StackTraceSamplingAllocator();
+        //   int numRecordedFrames() const;
+        //   Int64 samplingPeriod() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        {
+            const Obj X(1000);
+            ASSERT(1000 == X.samplingPeriod());
+            ASSERT(Obj::k_DEFAULT_NUM_RECORDED_FRAMES ==
+                                                     X.numRecordedFrames());
+
+            const Obj Y(0, 5);
+            ASSERT(0 == Y.samplingPeriod());
+            ASSERT(5 == Y.numRecordedFrames());
+
+            Obj mZ(0);
+            mZ.deallocate(mZ.allocate(100));
+            ASSERT(1 == mZ.numSamples());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+        void *p;
+        {
+            Obj mX(0, 3, &ta);  const Obj& X = mX;
+            ASSERT(3 == X.numRecordedFrames());
+
+            p = mX.allocate(50);
+            ASSERT(1 <  ta.numBlocksInUse());
+        }
+        ASSERT(1 == ta.numBlocksInUse());
+        ta.deallocate(p);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(0, &ta));
+            ASSERT_FAIL(Obj(-1, &ta));
+
+            ASSERT_PASS(Obj(0, 1, &ta));
+            ASSERT_FAIL(Obj(0, 0, &ta));
+            ASSERT_PASS(Obj(0, Obj::k_MAX_NUM_RECORDED_FRAMES, &ta));
+            ASSERT_FAIL(Obj(0, Obj::k_MAX_NUM_RECORDED_FRAMES + 1, &ta));
+            ASSERT_FAIL(Obj(-1, 1, &ta));
+        }
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, allocate and deallocate some blocks, and print
+        //:   both profiles.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+        {
+            Obj mX(256, &ta);  const Obj& X = mX;
+
+            bsl::vector<void *> blocks(&ta);
+            for (int i = 0; i < 1000; ++i) {
+                blocks.push_back(balstSamplingTestAllocateA(&mX, 1 + i % 64));
+            }
+
+            ASSERT(0 < X.numSamples());
+            ASSERT(X.numSamples() == X.numLiveSamples());
+
+            bsl::ostringstream collapsed;
+            X.printCollapsedStacks(collapsed);
+            ASSERT(!collapsed.str().empty());
+
+            bsl::ostringstream heap;
+            X.printHeapProfile(heap);
+            ASSERT(0 == heap.str().find("heap profile: "));
+
+            if (veryVerbose) cout << collapsed.str();
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(0 == X.numLiveSamples());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
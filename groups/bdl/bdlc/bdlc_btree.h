@@ -0,0 +1,2255 @@
+// bdlc_btree.h                                                       -*-C++-*-
+#ifndef INCLUDED_BDLC_BTREE
+#define INCLUDED_BDLC_BTREE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cache-friendly B-tree for ordered containers.
+//
+//@CLASSES:
+//  bdlc::BTree: B-tree of entries ordered by key
+//
+//@SEE_ALSO: bdlc_btreemap, bdlc_btreeset
+//
+//@DESCRIPTION: This component provides the class template 'bdlc::BTree',
+// which forms the underlying implementation of 'bdlc::BTreeMap' and
+// 'bdlc::BTreeSet'.  The data structure is a B-tree: a balanced search tree
+// whose nodes each hold an ordered array of up to 'k_NODE_CAPACITY' entries
+// and, for internal nodes, one more child node than entries.  Every leaf of
+// the tree is at the same depth.  Unlike a red-black tree (see 'bslstl_map'),
+// which allocates one node per element and must follow one pointer per level
+// of a search, a B-tree allocates one node per many elements, stores the
+// elements of a node contiguously, and is only a few levels deep, so that a
+// search touches few cache lines and in-order iteration mostly steps through
+// contiguous memory.
+//
+// The capacity of a node is chosen, from the size of 'ENTRY', such that a leaf
+// node occupies about 256 bytes (four 64-byte cache lines), but is never less
+// than 3.  Internal nodes additionally hold the addresses of their children.
+// Leaf nodes are allocated at the size of a leaf; the memory overhead per
+// element is therefore a small fraction of a pointer, rather than the three
+// pointers and color of a red-black tree node plus the allocator's own
+// per-block overhead.
+//
+///Node Splitting and Bulk Loading
+///-------------------------------
+// When an entry is inserted into a full node, the node is split in two, and
+// the entry separating the two halves moves up to the parent (splitting the
+// parent too, if it is full).  Ordinarily the split is even, leaving both
+// nodes about half full.  When the insertion is at the end of the tree,
+// however, the split leaves the original node full and starts a new node
+// holding just the inserted entry.  A sequence of insertions in increasing key
+// order at the end of the tree (for example, by 'insert(first, last)' from a
+// sorted range, or by 'insert(end(), entry)') therefore produces a tree whose
+// nodes are nearly full, and, as the insertion position is found without a
+// search, takes amortized constant time per entry.
+//
+// Every node other than the root holds at least half of 'k_NODE_CAPACITY'
+// entries, except that the nodes along the right edge of the tree may hold
+// fewer as a result of such appends.
+//
+///Requirements on 'KEY', 'ENTRY', 'ENTRY_UTIL', and 'COMPARATOR'
+///--------------------------------------------------------------
+// The template parameter type 'ENTRY' must be copy or move constructible, and
+// its move constructor must not throw when the source and destination use the
+// same allocator.  The template parameter type 'COMPARATOR' must be a copy
+// constructible function object.
+//
+// 'ENTRY_UTIL' must support static methods 'construct' and 'key' compatible
+// with the following statements for objects 'entry' of type 'ENTRY', 'key' of
+// type 'KEY', and 'allocator' of type 'bslma::Allocator':
+//..
+//  ENTRY_UTIL::construct(&entry, &allocator, key);
+//  const KEY& keyOfEntry = ENTRY_UTIL::key(entry);
+//..
+//
+// 'COMPARATOR' must support a function call operator compatible with the
+// following statements for objects 'key1' and 'key2' of type 'KEY':
+//..
+//  COMPARATOR comparator;
+//  bool       result = comparator(key1, key2);
+//..
+// where the definition of the called function defines a strict weak ordering
+// on keys.
+//
+// If support for 'operator==' is required, the type 'ENTRY' must be
+// equality-comparable.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Entries are moved between and within nodes as the tree is modified.  Any
+// insertion of a new entry, or erasure of an entry, therefore invalidates all
+// pointers, references, and iterators to entries of the tree.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::BTree' is exception neutral.  An inserted entry is constructed, and
+// any node needed to hold it allocated, before the tree is changed, so
+// (provided that the move constructor of 'ENTRY' does not throw, as required
+// above) the insertion of a single entry provides the strong exception safety
+// guarantee, and all other methods provide the basic exception safety
+// guarantee (see {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bdlscm_version.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_destructorproctor.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_bidirectionaliterator.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class ENTRY>
+class BTree_IteratorImp;
+
+template <class ENTRY>
+bool operator==(const BTree_IteratorImp<ENTRY>&,
+                const BTree_IteratorImp<ENTRY>&);
+
+template <class ENTRY>
+bool operator!=(const BTree_IteratorImp<ENTRY>&,
+                const BTree_IteratorImp<ENTRY>&);
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class BTree;
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator==(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&,
+                const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&);
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator!=(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&,
+                const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&);
+
+                              // =================
+                              // struct BTree_Node
+                              // =================
+
+template <class ENTRY>
+struct BTree_Node {
+    // This component-private 'struct' provides the storage of a node of a
+    // B-tree.  A leaf node is an object of this type; an internal node is a
+    // 'BTree_InternalNode', which additionally holds the addresses of its
+    // children.  The first 'd_count' elements of 'd_entries' are the entries
+    // of the node, in key order; the remaining elements are uninitialized.
+
+    // TYPES
+    enum {
+        k_TARGET_SIZE = 256,  // approximate size, in bytes, of a leaf node
+
+        k_HEADER_SIZE = 16,   // approximate size, in bytes, of the members of
+                              // a node other than its entries
+
+        k_FIT         = (k_TARGET_SIZE - k_HEADER_SIZE) / sizeof(ENTRY),
+
+        k_CAPACITY    = k_FIT < 3 ? 3 : k_FIT,
+                              // maximum number of entries in a node
+
+        k_MIN_COUNT   = (k_CAPACITY - 1) / 2
+                              // number of entries below which a node (other
+                              // than the root) is rebalanced after an erasure
+    };
+
+    // DATA
+    BTree_Node                *d_parent_p;             // parent, or 0 if root
+    unsigned short             d_position;             // index in parent
+    unsigned short             d_count;                // number of entries
+    bool                       d_isLeaf;               // 'true' if leaf
+    bsls::ObjectBuffer<ENTRY>  d_entries[k_CAPACITY];  // entries
+
+    // MANIPULATORS
+    BTree_Node *& child(int index);
+        // Return a reference providing modifiable access to the address of the
+        // child of this node at the specified 'index'.  The behavior is
+        // undefined unless this node is not a leaf and
+        // '0 <= index <= k_CAPACITY'.
+
+    ENTRY *entries();
+        // Return the address of the first entry of this node.
+
+    // ACCESSORS
+    BTree_Node *child(int index) const;
+        // Return the address of the child of this node at the specified
+        // 'index'.  The behavior is undefined unless this node is not a leaf
+        // and '0 <= index <= d_count'.
+
+    const ENTRY *entries() const;
+        // Return the address of the first entry of this node.
+};
+
+                          // =========================
+                          // struct BTree_InternalNode
+                          // =========================
+
+template <class ENTRY>
+struct BTree_InternalNode : BTree_Node<ENTRY> {
+    // This component-private 'struct' provides the storage of an internal node
+    // of a B-tree.  The first 'd_count + 1' elements of 'd_children' are the
+    // addresses of the children of the node; the keys of the entries of child
+    // 'i' order before the key of entry 'i' of the node, and after the key of
+    // entry 'i - 1'.
+
+    // DATA
+    BTree_Node<ENTRY> *d_children[BTree_Node<ENTRY>::k_CAPACITY + 1];
+                                                              // children
+};
+
+                          // =======================
+                          // class BTree_IteratorImp
+                          // =======================
+
+template <class ENTRY>
+class BTree_IteratorImp {
+    // This class implements the methods required by
+    // 'bslstl::BidirectionalIterator' to provide bidirectional iterators.  As
+    // such, an instance of this class represents a position within a B-tree:
+    // an entry of a node, or the past-the-end position, which is represented
+    // as the position following the last entry of the root node (or, for an
+    // empty tree, by a default-constructed object).  This class uses no
+    // features of the 'ENTRY' type except for addresses of 'ENTRY' objects.
+
+    // PRIVATE TYPES
+    typedef BTree_Node<ENTRY> Node;
+
+    // DATA
+    Node *d_node_p;    // node of the referenced entry
+    int   d_position;  // index of the referenced entry in 'd_node_p'
+
+    // FRIENDS
+    friend bool operator==<>(const BTree_IteratorImp&,
+                             const BTree_IteratorImp&);
+
+  public:
+    // CREATORS
+    BTree_IteratorImp();
+        // Create a 'BTree_IteratorImp' having the default, non-dereferenceable
+        // value.
+
+    BTree_IteratorImp(Node *node, int position);
+        // Create a 'BTree_IteratorImp' referring to the entry at the specified
+        // 'position' of the specified 'node', or, if 'position' is
+        // 'node->d_count' and 'node' is the root of its tree, to the
+        // past-the-end position of the tree.  The behavior is undefined unless
+        // '0 <= position <= node->d_count'.
+
+    BTree_IteratorImp(const BTree_IteratorImp& original);
+        // Create a 'BTree_IteratorImp' having the same value as the specified
+        // 'original'.
+
+    //! ~BTree_IteratorImp() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    BTree_IteratorImp& operator=(const BTree_IteratorImp& rhs);
+        // Assign to this 'BTree_IteratorImp' the value of the specified 'rhs'.
+
+    void operator++();
+        // Advance this 'BTree_IteratorImp' to the next entry, in key order, of
+        // the underlying B-tree, or to the past-the-end position if there is
+        // no such entry.  The behavior is undefined unless this object refers
+        // to an entry of the tree.
+
+    void operator--();
+        // Move this 'BTree_IteratorImp' to the previous entry, in key order,
+        // of the underlying B-tree.  The behavior is undefined unless this
+        // object refers to an entry of the tree other than the first, or to
+        // the past-the-end position of a non-empty tree.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this
+        // 'BTree_IteratorImp'.  The behavior is undefined unless this object
+        // refers to an entry of the tree.
+
+    Node *node() const;
+        // Return the address of the node of the position referred to by this
+        // object.
+
+    int position() const;
+        // Return the index, within 'node()', of the position referred to by
+        // this object.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const BTree_IteratorImp<ENTRY>& a,
+                const BTree_IteratorImp<ENTRY>& b);
+    // Return 'true' if the specified 'a' and 'b' are equal, and 'false'
+    // otherwise.  Two 'BTree_IteratorImp' objects are equal if they refer to
+    // the same position of the same B-tree, or are both default-constructed.
+
+template <class ENTRY>
+bool operator!=(const BTree_IteratorImp<ENTRY>& a,
+                const BTree_IteratorImp<ENTRY>& b);
+    // Return 'true' if the specified 'a' and 'b' are not equal, and 'false'
+    // otherwise.  Two 'BTree_IteratorImp' objects are not equal if they do
+    // not refer to the same position of the same B-tree, and are not both
+    // default-constructed.
+
+                                // ===========
+                                // class BTree
+                                // ===========
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class BTree {
+    // This class template provides a B-tree implementation useful for
+    // implementing an ordered set and an ordered map having unique keys.
+
+    // PRIVATE TYPES
+    typedef BTree_Node<ENTRY>         Node;
+    typedef BTree_InternalNode<ENTRY> InternalNode;
+    typedef BTree_IteratorImp<ENTRY>  IteratorImp;
+
+    // FRIENDS
+    friend bool operator==<>(const BTree&, const BTree&);
+    friend bool operator!=<>(const BTree&, const BTree&);
+
+  public:
+    // TYPES
+    typedef KEY        key_type;
+    typedef ENTRY      entry_type;
+    typedef ENTRY_UTIL entry_util_type;
+    typedef COMPARATOR key_compare_type;
+
+    typedef bslstl::BidirectionalIterator<ENTRY, IteratorImp>
+                                                                      iterator;
+    typedef bslstl::BidirectionalIterator<const ENTRY, IteratorImp>
+                                                                const_iterator;
+
+  private:
+    // DATA
+    Node             *d_root_p;       // root node, or 0 if empty
+    bsl::size_t       d_size;         // number of entries
+    COMPARATOR        d_comparator;   // key ordering functor
+    bslma::Allocator *d_allocator_p;  // allocator
+
+    // PRIVATE MANIPULATORS
+    Node *allocateNode(bool isLeaf);
+        // Return the address of a newly allocated node having no parent and no
+        // entries, which is a leaf if the specified 'isLeaf' is 'true', and an
+        // internal node otherwise.
+
+    void destroyNodes(Node *node);
+        // Destroy the entries of the specified 'node' and of all of its
+        // descendants, and deallocate those nodes.
+
+    IteratorImp insertAt(Node *node, int position, ENTRY *entry);
+        // Move the specified 'entry' into this tree at the specified
+        // 'position' of the specified leaf 'node', or into a new root leaf if
+        // 'node' is 0, splitting 'node' and its ancestors as necessary, and
+        // return the position of the inserted entry.  On return 'entry' is
+        // destroyed.  If an exception is thrown, this tree and 'entry' are
+        // unchanged.  The behavior is undefined unless inserting 'entry' at
+        // 'position' of 'node' maintains the order of the entries of this
+        // tree, and 'node' is 0 only if this tree is empty.
+
+    void makeRoom(Node **node, int *position);
+        // If the specified '*node' is full, split it in two, moving the entry
+        // separating the two halves into its parent (first splitting the
+        // parent, or adding a new root, as necessary), and load into 'node'
+        // and the specified 'position' the node and index at which the entry
+        // that was to be inserted at '*position' of the original '*node' must
+        // now be inserted.  If the insertion is at the end of the tree, the
+        // original node keeps all but its last entry and the new node is
+        // initially empty (see {Node Splitting and Bulk Loading}); otherwise
+        // the entries are divided evenly.  If an exception is thrown, the
+        // entries of this tree are unchanged.
+
+    void mergeWithNext(Node *node, IteratorImp *cursor);
+        // Move the entry of the parent of the specified 'node' that separates
+        // 'node' from its next sibling, followed by all of the entries (and
+        // children) of the next sibling, to the end of 'node', and deallocate
+        // the next sibling.  Update the specified 'cursor' if it refers to one
+        // of the moved entries, or to an entry of the parent following the
+        // separator.  The behavior is undefined unless 'node' has a next
+        // sibling and the combined number of entries fits in a node.
+
+    void rebalance(Node *node, IteratorImp *cursor);
+        // Restore the invariants of this tree after an entry has been removed
+        // from the specified 'node', merging or rebalancing 'node' with a
+        // sibling if it is too sparse, and repeating for its parent as
+        // necessary, and update the specified 'cursor' to continue to refer to
+        // the same entry (unless 'cursor' is default-constructed).
+
+    void relocate(ENTRY *to, ENTRY *from, int numEntries);
+        // Move the specified 'numEntries' entries starting at the specified
+        // 'from' address to the (uninitialized) memory starting at the
+        // specified 'to' address, leaving the memory at 'from' uninitialized.
+        // Note that the ranges may overlap.
+
+    void shiftFromNext(Node *node, int numEntries, IteratorImp *cursor);
+        // Move the entry of the parent of the specified 'node' that separates
+        // 'node' from its next sibling, followed by the specified
+        // 'numEntries - 1' first entries (and 'numEntries' first children) of
+        // the next sibling, to the end of 'node', and make entry
+        // 'numEntries - 1' of the next sibling the new separator.  Update the
+        // specified 'cursor' if it refers to one of the moved entries.  The
+        // behavior is undefined unless 'node' has a next sibling having more
+        // than 'numEntries' entries, and the entries moved fit in 'node'.
+
+    void shiftToNext(Node *node, int numEntries, IteratorImp *cursor);
+        // Move the entry of the parent of the specified 'node' that separates
+        // 'node' from its next sibling, preceded by the specified
+        // 'numEntries - 1' last entries (and 'numEntries' last children) of
+        // 'node', to the start of the next sibling, and make the entry of
+        // 'node' preceding those the new separator.  Update the specified
+        // 'cursor' if it refers to one of the moved entries.  The behavior is
+        // undefined unless 'node' has a next sibling, more than 'numEntries'
+        // entries, and the entries moved fit in the next sibling.
+
+    // PRIVATE ACCESSORS
+    IteratorImp beginImp() const;
+        // Return the position of the first entry of this tree, or the
+        // past-the-end position if this tree is empty.
+
+    IteratorImp endImp() const;
+        // Return the past-the-end position of this tree.
+
+    IteratorImp findImp(const KEY& key) const;
+        // Return the position of the entry of this tree having the specified
+        // 'key', or the past-the-end position if there is no such entry.
+
+    bool findInsertPosition(Node       **node,
+                            int         *position,
+                            const KEY&   key) const;
+        // Return 'true', and load into the specified 'node' and 'position' the
+        // location of the entry having the specified 'key', if this tree
+        // contains such an entry; otherwise, return 'false' and load into
+        // 'node' and 'position' the leaf node and index at which an entry
+        // having 'key' must be inserted ('node' being 0 if this tree is
+        // empty).
+
+    bool isInsertPositionFor(Node               **node,
+                             int                 *position,
+                             const IteratorImp&   hint,
+                             const KEY&           key) const;
+        // Return 'true', and load into the specified 'node' and 'position' the
+        // leaf node and index at which an entry having the specified 'key'
+        // must be inserted, if the entry would be placed immediately before
+        // the specified 'hint'; otherwise return 'false' with no other effect.
+        // The behavior is undefined unless 'hint' is a position of this tree.
+
+    IteratorImp lowerBoundImp(const KEY& key) const;
+        // Return the position of the first entry of this tree whose key is
+        // not ordered before the specified 'key', or the past-the-end position
+        // if there is no such entry.
+
+    int lowerBoundIndex(const Node *node, const KEY& key) const;
+        // Return the index of the first entry of the specified 'node' whose
+        // key is not ordered before the specified 'key', or 'node->d_count' if
+        // there is no such entry.
+
+    IteratorImp upperBoundImp(const KEY& key) const;
+        // Return the position of the first entry of this tree whose key is
+        // ordered after the specified 'key', or the past-the-end position if
+        // there is no such entry.
+
+    int upperBoundIndex(const Node *node, const KEY& key) const;
+        // Return the index of the first entry of the specified 'node' whose
+        // key is ordered after the specified 'key', or 'node->d_count' if
+        // there is no such entry.
+
+  public:
+    // PUBLIC CLASS DATA
+    static const int k_NODE_CAPACITY = Node::k_CAPACITY;
+                                                   // maximum number of entries
+                                                   // in a node
+
+    // CREATORS
+    explicit BTree(const COMPARATOR&  comparator,
+                   bslma::Allocator  *basicAllocator = 0);
+        // Create an empty tree that will use the specified 'comparator' to
+        // order the keys of its entries.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  No memory is
+        // allocated.
+
+    BTree(const BTree& original, bslma::Allocator *basicAllocator = 0);
+        // Create a tree having the same value and comparator as the specified
+        // 'original'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    explicit BTree(bslmf::MovableRef<BTree> original);
+        // Create a tree having the same value, comparator, and allocator as
+        // the specified 'original' object by moving (in constant time) the
+        // contents of 'original' to the new tree.  'original' is left in a
+        // (valid) unspecified state.
+
+    BTree(bslmf::MovableRef<BTree>  original,
+          bslma::Allocator         *basicAllocator);
+        // Create a tree having the same value and comparator as the specified
+        // 'original' object, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'original' and the newly created object have
+        // the same allocator then the contents of 'original' are moved (in
+        // constant time) to this object; otherwise the entries of 'original'
+        // are moved into this tree.  In either case, 'original' is left
+        // empty.
+
+    ~BTree();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    BTree& operator=(const BTree& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    BTree& operator=(bslmf::MovableRef<BTree> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The entries of 'rhs' are moved (in constant time) to
+        // this object if the two have the same allocator, otherwise entries
+        // from 'rhs' are moved into this tree.  In either case, 'rhs' is left
+        // in a valid but unspecified state.
+
+    template <class KEY_TYPE>
+    ENTRY& operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // If an entry with the specified 'key' is not already present in this
+        // tree, insert an entry having the value defined by
+        // 'ENTRY_UTIL::construct'; otherwise, this method has no effect.
+        // Return a reference to the (possibly newly inserted) entry in this
+        // tree having 'key'.
+
+    void clear();
+        // Remove all entries from this tree and release all memory held by
+        // this tree.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of entries in this tree having the specified 'key', where
+        // the first iterator is positioned at the start of the sequence, and
+        // the second is positioned one past the end of the sequence.  If this
+        // tree contains no entry having 'key', the two returned iterators
+        // refer to the position where such an entry would be inserted.  Note
+        // that since each key in a tree is unique, the returned range contains
+        // at most one entry.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this tree the entry having the specified 'key', if it
+        // exists, and return 1; otherwise (there is no entry having 'key' in
+        // this tree) return 0 with no other effect.  If an entry is removed,
+        // this method invalidates all iterators, pointers, and references to
+        // entries of this tree.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this tree the entry at the specified 'position', and
+        // return an iterator referring to the entry immediately following the
+        // removed entry, or to the past-the-end position if the removed entry
+        // was the last entry in this tree.  This method invalidates all other
+        // iterators, pointers, and references to entries of this tree.  The
+        // behavior is undefined unless 'position' refers to an entry in this
+        // tree.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this tree the entries starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referring to the entry 'last' referred to,
+        // or to the past-the-end position if 'last' was the past-the-end
+        // position.  This method invalidates all other iterators, pointers,
+        // and references to entries of this tree.  The behavior is undefined
+        // unless 'first' and 'last' either refer to entries in this tree or
+        // are the 'end' iterator, and 'first' is at or before 'last'.
+
+    iterator find(const KEY& key);
+        // Return an iterator providing modifiable access to the entry in this
+        // tree having the specified 'key', if such an entry exists, and
+        // 'end()' otherwise.
+
+#if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
+    template <class ENTRY_TYPE>
+    bsl::pair<iterator, bool> insert(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+#else
+    template <class ENTRY_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<ENTRY_TYPE, ENTRY>::value,
+                            bsl::pair<iterator, bool> >::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+#endif
+        // Insert the specified 'entry' into this tree if the key of the
+        // 'entry' does not already exist in this tree; otherwise, this method
+        // has no effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) entry in this tree whose
+        // key is equal to that of the entry to be inserted, and whose 'second'
+        // member is 'true' if a new entry was inserted, and 'false' if an
+        // entry having an equal key was already present.  If an entry is
+        // inserted, this method invalidates all other iterators, pointers, and
+        // references to entries of this tree.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        bsls::ObjectBuffer<ENTRY> buffer;
+        bslma::ConstructionUtil::construct(
+                             buffer.address(),
+                             d_allocator_p,
+                             BSLS_COMPILERFEATURES_FORWARD(ENTRY_TYPE, entry));
+        bslma::DestructorProctor<ENTRY> proctor(buffer.address());
+
+        Node *node;
+        int   position;
+        if (findInsertPosition(&node,
+                               &position,
+                               ENTRY_UTIL::key(buffer.object()))) {
+            return bsl::pair<iterator, bool>(IteratorImp(node, position),
+                                             false);                  // RETURN
+        }
+
+        IteratorImp result = insertAt(node, position, buffer.address());
+        proctor.release();
+
+        return bsl::pair<iterator, bool>(result, true);
+    }
+
+#if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
+    template <class ENTRY_TYPE>
+    iterator insert(const_iterator                                hint,
+                    BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+#else
+    template <class ENTRY_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<ENTRY_TYPE, ENTRY>::value,
+                            iterator>::type
+                    insert(const_iterator                                hint,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+#endif
+        // Insert the specified 'entry' into this tree if the key of the
+        // 'entry' does not already exist in this tree; otherwise, this method
+        // has no effect.  Return an iterator referring to the (possibly newly
+        // inserted) entry in this tree whose key is equal to that of the entry
+        // to be inserted.  If the entry belongs immediately before the
+        // specified 'hint', it is inserted there without searching the tree.
+        // If an entry is inserted, this method invalidates all other
+        // iterators, pointers, and references to entries of this tree.  The
+        // behavior is undefined unless 'hint' is a valid iterator on this
+        // tree.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        bsls::ObjectBuffer<ENTRY> buffer;
+        bslma::ConstructionUtil::construct(
+                             buffer.address(),
+                             d_allocator_p,
+                             BSLS_COMPILERFEATURES_FORWARD(ENTRY_TYPE, entry));
+        bslma::DestructorProctor<ENTRY> proctor(buffer.address());
+
+        const KEY& key = ENTRY_UTIL::key(buffer.object());
+
+        Node *node;
+        int   position;
+        if (!isInsertPositionFor(&node, &position, hint.imp(), key)
+         && findInsertPosition(&node, &position, key)) {
+            return iterator(IteratorImp(node, position));             // RETURN
+        }
+
+        IteratorImp result = insertAt(node, position, buffer.address());
+        proctor.release();
+
+        return iterator(result);
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create an entry for each iterator in the range starting at the
+        // specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, by converting from the object referred to
+        // by each iterator.  Insert into this tree each such entry whose key
+        // is not already contained.  Each entry is inserted with the 'end()'
+        // position as hint, so that inserting a range sorted in increasing
+        // key order, whose keys follow those already in this tree, takes
+        // amortized constant time per entry (see {Node Splitting and Bulk
+        // Loading}).  The (template parameter) type 'INPUT_ITERATOR' shall
+        // meet the requirements of an input iterator defined in the C++11
+        // standard [24.2.3] providing access to values of a type convertible
+        // to 'ENTRY'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator providing modifiable access to the first entry in
+        // this tree whose key is not ordered before the specified 'key', or
+        // 'end()' if there is no such entry.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator providing modifiable access to the first entry in
+        // this tree whose key is ordered after the specified 'key', or 'end()'
+        // if there is no such entry.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator to the first entry in the sequence of modifiable
+        // entries maintained by this tree, or the 'end' iterator if this tree
+        // is empty.
+
+    iterator end();
+        // Return an iterator to the past-the-end position in the sequence of
+        // modifiable entries maintained by this tree.
+
+                             // Aspects
+
+    void swap(BTree& other);
+        // Exchange the value of this object, as well as its comparator, with
+        // those of the specified 'other' object.  The behavior is undefined
+        // unless this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bool contains(const KEY& key) const;
+        // Return 'true' if this tree contains an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries in this tree having the specified
+        // 'key'.  Note that since a tree maintains unique keys, the returned
+        // value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this tree contains no entries, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of 'const_iterator's defining the sequence of entries
+        // in this tree having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this tree contains
+        // no entry having 'key', the two returned iterators refer to the
+        // position where such an entry would be inserted.  Note that since
+        // each key in a tree is unique, the returned range contains at most
+        // one entry.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the entry in this tree
+        // having the specified 'key', if such an entry exists, and 'end()'
+        // otherwise.
+
+    int height() const;
+        // Return the number of levels of nodes in this tree, which is 0 if
+        // this tree is empty.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the comparator used by this tree to order the
+        // keys of its entries.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first entry in this tree
+        // whose key is not ordered before the specified 'key', or 'end()' if
+        // there is no such entry.
+
+    bsl::size_t size() const;
+        // Return the number of entries in this tree.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first entry in this tree
+        // whose key is ordered after the specified 'key', or 'end()' if there
+        // is no such entry.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return a 'const_iterator' to the first entry in the sequence of
+        // entries maintained by this tree, or the 'end' iterator if this tree
+        // is empty.
+
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' to the first entry in the sequence of
+        // entries maintained by this tree, or the 'end' iterator if this tree
+        // is empty.
+
+    const_iterator cend() const;
+        // Return a 'const_iterator' to the past-the-end position in the
+        // sequence of entries maintained by this tree.
+
+    const_iterator end() const;
+        // Return a 'const_iterator' to the past-the-end position in the
+        // sequence of entries maintained by this tree.
+
+                             // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this tree to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator==(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'BTree' objects have the same value
+    // if they have the same number of entries, and each entry of one is equal
+    // to the entry at the same position, in key order, of the other.  The
+    // comparators are not involved in the comparison.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator!=(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'BTree' objects do not have the
+    // same value if they have different numbers of entries, or some entry of
+    // one is not equal to the entry at the same position, in key order, of
+    // the other.  The comparators are not involved in the comparison.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void swap(BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& a,
+          BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& b);
+    // Exchange the value and comparator of the specified 'a' and 'b' objects.
+    // This function provides the no-throw exception-safety guarantee if the
+    // two objects were created with the same allocator and the basic
+    // guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                              // -----------------
+                              // struct BTree_Node
+                              // -----------------
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+BTree_Node<ENTRY> *& BTree_Node<ENTRY>::child(int index)
+{
+    BSLS_ASSERT_SAFE(!d_isLeaf);
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index <= k_CAPACITY);
+
+    return static_cast<BTree_InternalNode<ENTRY> *>(this)->d_children[index];
+}
+
+template <class ENTRY>
+inline
+ENTRY *BTree_Node<ENTRY>::entries()
+{
+    return d_entries[0].address();
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+BTree_Node<ENTRY> *BTree_Node<ENTRY>::child(int index) const
+{
+    BSLS_ASSERT_SAFE(!d_isLeaf);
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index <= d_count);
+
+    return static_cast<const BTree_InternalNode<ENTRY> *>(this)->
+                                                            d_children[index];
+}
+
+template <class ENTRY>
+inline
+const ENTRY *BTree_Node<ENTRY>::entries() const
+{
+    return d_entries[0].address();
+}
+
+                          // -----------------------
+                          // class BTree_IteratorImp
+                          // -----------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+BTree_IteratorImp<ENTRY>::BTree_IteratorImp()
+: d_node_p(0)
+, d_position(0)
+{
+}
+
+template <class ENTRY>
+inline
+BTree_IteratorImp<ENTRY>::BTree_IteratorImp(Node *node, int position)
+: d_node_p(node)
+, d_position(position)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position <= node->d_count);
+}
+
+template <class ENTRY>
+inline
+BTree_IteratorImp<ENTRY>::BTree_IteratorImp(
+                                            const BTree_IteratorImp& original)
+: d_node_p(original.d_node_p)
+, d_position(original.d_position)
+{
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+BTree_IteratorImp<ENTRY>& BTree_IteratorImp<ENTRY>::operator=(
+                                                  const BTree_IteratorImp& rhs)
+{
+    d_node_p   = rhs.d_node_p;
+    d_position = rhs.d_position;
+
+    return *this;
+}
+
+template <class ENTRY>
+void BTree_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+    BSLS_ASSERT_SAFE(d_position < d_node_p->d_count);
+
+    if (!d_node_p->d_isLeaf) {
+        // The next entry is the first entry of the leftmost leaf of the
+        // subtree following this entry.
+
+        d_node_p = d_node_p->child(d_position + 1);
+        while (!d_node_p->d_isLeaf) {
+            d_node_p = d_node_p->child(0);
+        }
+        d_position = 0;
+        return;                                                       // RETURN
+    }
+
+    ++d_position;
+
+    // Past the end of a leaf, the next entry is the separator following the
+    // nearest subtree, containing this leaf, that is not the last child of its
+    // parent.  Past the end of the root is the past-the-end position.
+
+    while (d_position == d_node_p->d_count && d_node_p->d_parent_p) {
+        d_position = d_node_p->d_position;
+        d_node_p   = d_node_p->d_parent_p;
+    }
+}
+
+template <class ENTRY>
+void BTree_IteratorImp<ENTRY>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    if (!d_node_p->d_isLeaf) {
+        // The previous entry is the last entry of the rightmost leaf of the
+        // subtree preceding this position.
+
+        d_node_p = d_node_p->child(d_position);
+        while (!d_node_p->d_isLeaf) {
+            d_node_p = d_node_p->child(d_node_p->d_count);
+        }
+        d_position = d_node_p->d_count - 1;
+        return;                                                       // RETURN
+    }
+
+    while (0 == d_position && d_node_p->d_parent_p) {
+        d_position = d_node_p->d_position;
+        d_node_p   = d_node_p->d_parent_p;
+    }
+
+    BSLS_ASSERT_SAFE(0 < d_position);
+
+    --d_position;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& BTree_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+    BSLS_ASSERT_SAFE(d_position < d_node_p->d_count);
+
+    return d_node_p->entries()[d_position];
+}
+
+template <class ENTRY>
+inline
+typename BTree_IteratorImp<ENTRY>::Node *BTree_IteratorImp<ENTRY>::node()
+                                                                         const
+{
+    return d_node_p;
+}
+
+template <class ENTRY>
+inline
+int BTree_IteratorImp<ENTRY>::position() const
+{
+    return d_position;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool bdlc::operator==(const BTree_IteratorImp<ENTRY>& a,
+                      const BTree_IteratorImp<ENTRY>& b)
+{
+    return a.d_node_p == b.d_node_p && a.d_position == b.d_position;
+}
+
+template <class ENTRY>
+inline
+bool bdlc::operator!=(const BTree_IteratorImp<ENTRY>& a,
+                      const BTree_IteratorImp<ENTRY>& b)
+{
+    return !(a == b);
+}
+
+namespace bdlc {
+
+                                // -----------
+                                // class BTree
+                                // -----------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::Node *
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::allocateNode(bool isLeaf)
+{
+    Node *node = static_cast<Node *>(d_allocator_p->allocate(
+                                isLeaf ? sizeof(Node) : sizeof(InternalNode)));
+
+    node->d_parent_p = 0;
+    node->d_position = 0;
+    node->d_count    = 0;
+    node->d_isLeaf   = isLeaf;
+
+    return node;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::destroyNodes(Node *node)
+{
+    if (!node->d_isLeaf) {
+        for (int i = 0; i <= node->d_count; ++i) {
+            destroyNodes(node->child(i));
+        }
+    }
+    bslalg::ArrayDestructionPrimitives::destroy(
+                                              node->entries(),
+                                              node->entries() + node->d_count);
+    d_allocator_p->deallocate(node);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertAt(Node  *node,
+                                                    int    position,
+                                                    ENTRY *entry)
+{
+    if (0 == node) {
+        BSLS_ASSERT_SAFE(0 == d_root_p);
+
+        d_root_p = allocateNode(true);
+        node     = d_root_p;
+        position = 0;
+    }
+    else {
+        makeRoom(&node, &position);
+    }
+
+    BSLS_ASSERT_SAFE(node->d_isLeaf);
+    BSLS_ASSERT_SAFE(node->d_count < Node::k_CAPACITY);
+
+    ENTRY *entries = node->entries();
+
+    relocate(entries + position + 1,
+             entries + position,
+             node->d_count - position);
+    bslma::ConstructionUtil::destructiveMove(entries + position,
+                                             d_allocator_p,
+                                             entry);
+    ++node->d_count;
+    ++d_size;
+
+    return IteratorImp(node, position);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::makeRoom(Node **node,
+                                                         int   *position)
+{
+    Node *full = *node;
+
+    if (full->d_count < Node::k_CAPACITY) {
+        return;                                                       // RETURN
+    }
+
+    // Determine whether the insertion is at the end of the tree, in which
+    // case 'full' is left full rather than split evenly.
+
+    bool isAppend = Node::k_CAPACITY == *position;
+    for (const Node *n = full; isAppend && n->d_parent_p; n = n->d_parent_p) {
+        isAppend = n->d_position == n->d_parent_p->d_count;
+    }
+
+    // Allocate the new sibling, and make room for the separator in the parent
+    // (adding a new root if 'full' is the root), before any entry is moved, so
+    // that an exception leaves the entries of the tree unchanged.
+
+    Node *sibling = allocateNode(full->d_isLeaf);
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(sibling,
+                                                        d_allocator_p);
+
+    if (full->d_parent_p) {
+        Node *parent         = full->d_parent_p;
+        int   parentPosition = full->d_position;
+
+        makeRoom(&parent, &parentPosition);
+    }
+    else {
+        Node *root = allocateNode(false);
+
+        root->child(0)     = full;
+        full->d_parent_p   = root;
+        full->d_position   = 0;
+        d_root_p           = root;
+    }
+
+    proctor.release();
+
+    // Note that splitting the parent may have moved 'full' to a new parent.
+
+    Node *parent = full->d_parent_p;
+    int   index  = full->d_position;
+
+    const int count = Node::k_CAPACITY;
+    const int split = isAppend ? count - 1 : count / 2;
+    const int moved = count - split - 1;
+
+    // Move the separating entry, and insert 'sibling', into the parent.
+
+    ENTRY *parentEntries = parent->entries();
+
+    relocate(parentEntries + index + 1,
+             parentEntries + index,
+             parent->d_count - index);
+    bslma::ConstructionUtil::destructiveMove(parentEntries + index,
+                                             d_allocator_p,
+                                             full->entries() + split);
+
+    for (int i = parent->d_count; i > index; --i) {
+        Node *child = parent->child(i);
+
+        parent->child(i + 1) = child;
+        child->d_position    = static_cast<unsigned short>(i + 1);
+    }
+    parent->child(index + 1) = sibling;
+    sibling->d_parent_p      = parent;
+    sibling->d_position      = static_cast<unsigned short>(index + 1);
+    ++parent->d_count;
+
+    // Move the entries, and children, following the separator to 'sibling'.
+
+    relocate(sibling->entries(), full->entries() + split + 1, moved);
+
+    if (!full->d_isLeaf) {
+        for (int i = 0; i <= moved; ++i) {
+            Node *child = full->child(split + 1 + i);
+
+            sibling->child(i) = child;
+            child->d_parent_p = sibling;
+            child->d_position = static_cast<unsigned short>(i);
+        }
+    }
+
+    full->d_count    = static_cast<unsigned short>(split);
+    sibling->d_count = static_cast<unsigned short>(moved);
+
+    if (*position > split) {
+        *node     = sibling;
+        *position = *position - split - 1;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::mergeWithNext(
+                                                         Node        *node,
+                                                         IteratorImp *cursor)
+{
+    Node *parent = node->d_parent_p;
+    int   index  = node->d_position;
+    Node *next   = parent->child(index + 1);
+
+    const int count     = node->d_count;
+    const int nextCount = next->d_count;
+
+    BSLS_ASSERT_SAFE(count + nextCount < Node::k_CAPACITY);
+
+    ENTRY *parentEntries = parent->entries();
+
+    bslma::ConstructionUtil::destructiveMove(node->entries() + count,
+                                             d_allocator_p,
+                                             parentEntries + index);
+    relocate(node->entries() + count + 1, next->entries(), nextCount);
+
+    if (!node->d_isLeaf) {
+        for (int i = 0; i <= nextCount; ++i) {
+            Node *child = next->child(i);
+
+            node->child(count + 1 + i) = child;
+            child->d_parent_p          = node;
+            child->d_position          = static_cast<unsigned short>(
+                                                             count + 1 + i);
+        }
+    }
+    node->d_count = static_cast<unsigned short>(count + 1 + nextCount);
+
+    // Close the gaps left in the parent by the separator and 'next'.
+
+    relocate(parentEntries + index,
+             parentEntries + index + 1,
+             parent->d_count - index - 1);
+
+    for (int i = index + 1; i < parent->d_count; ++i) {
+        Node *child = parent->child(i + 1);
+
+        parent->child(i)  = child;
+        child->d_position = static_cast<unsigned short>(i);
+    }
+    --parent->d_count;
+
+    if (cursor->node() == next) {
+        *cursor = IteratorImp(node, count + 1 + cursor->position());
+    }
+    else if (cursor->node() == parent && cursor->position() >= index) {
+        *cursor = cursor->position() == index
+                ? IteratorImp(node, count)
+                : IteratorImp(parent, cursor->position() - 1);
+    }
+
+    d_allocator_p->deallocate(next);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::rebalance(Node        *node,
+                                                          IteratorImp *cursor)
+{
+    while (node != d_root_p && node->d_count < Node::k_MIN_COUNT) {
+        Node *parent   = node->d_parent_p;
+        int   index    = node->d_position;
+        Node *previous = 0 < index ? parent->child(index - 1) : 0;
+        Node *next     = index < parent->d_count
+                       ? parent->child(index + 1)
+                       : 0;
+
+        if (previous
+         && previous->d_count + node->d_count < Node::k_CAPACITY) {
+            mergeWithNext(previous, cursor);
+            node = parent;
+            continue;
+        }
+        if (next && node->d_count + next->d_count < Node::k_CAPACITY) {
+            mergeWithNext(node, cursor);
+            node = parent;
+            continue;
+        }
+
+        // Neither sibling can be merged, so the fuller one has more than
+        // 'k_MIN_COUNT' entries; move half of the difference to 'node'.
+
+        if (previous && (!next || previous->d_count >= next->d_count)) {
+            shiftToNext(previous,
+                        (previous->d_count - node->d_count + 1) / 2,
+                        cursor);
+        }
+        else {
+            shiftFromNext(node,
+                          (next->d_count - node->d_count + 1) / 2,
+                          cursor);
+        }
+        break;
+    }
+
+    if (0 == d_root_p->d_count) {
+        Node *root = d_root_p;
+
+        if (root->d_isLeaf) {
+            d_root_p = 0;
+        }
+        else {
+            d_root_p             = root->child(0);
+            d_root_p->d_parent_p = 0;
+            d_root_p->d_position = 0;
+        }
+        d_allocator_p->deallocate(root);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::relocate(ENTRY *to,
+                                                         ENTRY *from,
+                                                         int    numEntries)
+{
+    if (bslmf::IsBitwiseMoveable<ENTRY>::value) {
+        if (0 < numEntries) {
+            bsl::memmove(static_cast<void *>(to),
+                         static_cast<const void *>(from),
+                         numEntries * sizeof(ENTRY));
+        }
+    }
+    else if (to < from) {
+        for (int i = 0; i < numEntries; ++i) {
+            bslma::ConstructionUtil::destructiveMove(to + i,
+                                                     d_allocator_p,
+                                                     from + i);
+        }
+    }
+    else {
+        for (int i = numEntries - 1; i >= 0; --i) {
+            bslma::ConstructionUtil::destructiveMove(to + i,
+                                                     d_allocator_p,
+                                                     from + i);
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::shiftFromNext(
+                                                       Node        *node,
+                                                       int          numEntries,
+                                                       IteratorImp *cursor)
+{
+    Node *parent = node->d_parent_p;
+    int   index  = node->d_position;
+    Node *next   = parent->child(index + 1);
+
+    const int count     = node->d_count;
+    const int nextCount = next->d_count;
+
+    BSLS_ASSERT_SAFE(0 < numEntries);
+    BSLS_ASSERT_SAFE(numEntries < nextCount);
+    BSLS_ASSERT_SAFE(count + numEntries <= Node::k_CAPACITY);
+
+    ENTRY *entries     = node->entries();
+    ENTRY *nextEntries = next->entries();
+
+    bslma::ConstructionUtil::destructiveMove(entries + count,
+                                             d_allocator_p,
+                                             parent->entries() + index);
+    relocate(entries + count + 1, nextEntries, numEntries - 1);
+    bslma::ConstructionUtil::destructiveMove(parent->entries() + index,
+                                             d_allocator_p,
+                                             nextEntries + numEntries - 1);
+    relocate(nextEntries, nextEntries + numEntries, nextCount - numEntries);
+
+    if (!node->d_isLeaf) {
+        for (int i = 0; i < numEntries; ++i) {
+            Node *child = next->child(i);
+
+            node->child(count + 1 + i) = child;
+            child->d_parent_p          = node;
+            child->d_position          = static_cast<unsigned short>(
+                                                             count + 1 + i);
+        }
+        for (int i = 0; i <= nextCount - numEntries; ++i) {
+            Node *child = next->child(i + numEntries);
+
+            next->child(i)    = child;
+            child->d_position = static_cast<unsigned short>(i);
+        }
+    }
+
+    node->d_count = static_cast<unsigned short>(count + numEntries);
+    next->d_count = static_cast<unsigned short>(nextCount - numEntries);
+
+    if (cursor->node() == parent && cursor->position() == index) {
+        *cursor = IteratorImp(node, count);
+    }
+    else if (cursor->node() == next) {
+        const int position = cursor->position();
+
+        *cursor = position <  numEntries - 1
+                ? IteratorImp(node, count + 1 + position)
+                : position == numEntries - 1
+                ? IteratorImp(parent, index)
+                : IteratorImp(next, position - numEntries);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::shiftToNext(
+                                                       Node        *node,
+                                                       int          numEntries,
+                                                       IteratorImp *cursor)
+{
+    Node *parent = node->d_parent_p;
+    int   index  = node->d_position;
+    Node *next   = parent->child(index + 1);
+
+    const int count     = node->d_count;
+    const int nextCount = next->d_count;
+
+    BSLS_ASSERT_SAFE(0 < numEntries);
+    BSLS_ASSERT_SAFE(numEntries < count);
+    BSLS_ASSERT_SAFE(nextCount + numEntries <= Node::k_CAPACITY);
+
+    ENTRY *entries     = node->entries();
+    ENTRY *nextEntries = next->entries();
+
+    relocate(nextEntries + numEntries, nextEntries, nextCount);
+    bslma::ConstructionUtil::destructiveMove(nextEntries + numEntries - 1,
+                                             d_allocator_p,
+                                             parent->entries() + index);
+    relocate(nextEntries, entries + count - numEntries + 1, numEntries - 1);
+    bslma::ConstructionUtil::destructiveMove(parent->entries() + index,
+                                             d_allocator_p,
+                                             entries + count - numEntries);
+
+    if (!node->d_isLeaf) {
+        for (int i = nextCount; i >= 0; --i) {
+            Node *child = next->child(i);
+
+            next->child(i + numEntries) = child;
+            child->d_position = static_cast<unsigned short>(i + numEntries);
+        }
+        for (int i = 0; i < numEntries; ++i) {
+            Node *child = node->child(count - numEntries + 1 + i);
+
+            next->child(i)    = child;
+            child->d_parent_p = next;
+            child->d_position = static_cast<unsigned short>(i);
+        }
+    }
+
+    node->d_count = static_cast<unsigned short>(count - numEntries);
+    next->d_count = static_cast<unsigned short>(nextCount + numEntries);
+
+    if (cursor->node() == next) {
+        *cursor = IteratorImp(next, cursor->position() + numEntries);
+    }
+    else if (cursor->node() == parent && cursor->position() == index) {
+        *cursor = IteratorImp(next, numEntries - 1);
+    }
+    else if (cursor->node() == node && cursor->position() >= count
+                                                             - numEntries) {
+        const int position = cursor->position();
+
+        *cursor = position == count - numEntries
+                ? IteratorImp(parent, index)
+                : IteratorImp(next, position - (count - numEntries + 1));
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::beginImp() const
+{
+    if (0 == d_root_p) {
+        return IteratorImp();                                         // RETURN
+    }
+
+    Node *node = d_root_p;
+    while (!node->d_isLeaf) {
+        node = node->child(0);
+    }
+
+    return IteratorImp(node, 0);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::endImp() const
+{
+    return d_root_p ? IteratorImp(d_root_p, d_root_p->d_count)
+                    : IteratorImp();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::findImp(const KEY& key) const
+{
+    Node *node;
+    int   position;
+
+    return findInsertPosition(&node, &position, key)
+         ? IteratorImp(node, position)
+         : endImp();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::findInsertPosition(
+                                                  Node       **node,
+                                                  int         *position,
+                                                  const KEY&   key) const
+{
+    Node *current = d_root_p;
+
+    *node     = 0;
+    *position = 0;
+
+    while (current) {
+        int index = lowerBoundIndex(current, key);
+
+        *node     = current;
+        *position = index;
+
+        if (index < current->d_count
+         && !d_comparator(key, ENTRY_UTIL::key(current->entries()[index]))) {
+            return true;                                              // RETURN
+        }
+
+        current = current->d_isLeaf ? 0 : current->child(index);
+    }
+
+    return false;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::isInsertPositionFor(
+                                            Node               **node,
+                                            int                 *position,
+                                            const IteratorImp&   hint,
+                                            const KEY&           key) const
+{
+    if (0 == d_root_p) {
+        return false;                                                 // RETURN
+    }
+
+    if (hint != endImp()
+     && !d_comparator(key, ENTRY_UTIL::key(*hint))) {
+        return false;                                                 // RETURN
+    }
+
+    // Determine whether 'hint' is the first position of the tree, which is
+    // the first position of the leftmost leaf.
+
+    bool  isFirst = hint.node()->d_isLeaf && 0 == hint.position();
+    Node *current = hint.node();
+    while (isFirst && current->d_parent_p) {
+        isFirst = 0 == current->d_position;
+        current = current->d_parent_p;
+    }
+
+    if (isFirst) {
+        *node     = hint.node();
+        *position = 0;
+        return true;                                                  // RETURN
+    }
+
+    IteratorImp previous(hint);
+    --previous;
+
+    if (!d_comparator(ENTRY_UTIL::key(*previous), key)) {
+        return false;                                                 // RETURN
+    }
+
+    // An entry between 'previous' and 'hint' goes at the end of the leaf
+    // holding 'previous' unless 'hint' is in a leaf, in which case it goes
+    // before 'hint'.  Note that of two consecutive positions, at least one is
+    // in a leaf.
+
+    if (hint.node()->d_isLeaf) {
+        *node     = hint.node();
+        *position = hint.position();
+    }
+    else {
+        *node     = previous.node();
+        *position = previous.position() + 1;
+    }
+
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBoundImp(const KEY& key) const
+{
+    Node *node = d_root_p;
+
+    if (0 == node) {
+        return IteratorImp();                                         // RETURN
+    }
+
+    while (true) {
+        int index = lowerBoundIndex(node, key);
+
+        if (index < node->d_count
+         && !d_comparator(key, ENTRY_UTIL::key(node->entries()[index]))) {
+            return IteratorImp(node, index);                          // RETURN
+        }
+
+        if (node->d_isLeaf) {
+            // The position following the end of a leaf is that of the
+            // separator after the nearest enclosing subtree that is not the
+            // last child of its parent.
+
+            while (index == node->d_count && node->d_parent_p) {
+                index = node->d_position;
+                node  = node->d_parent_p;
+            }
+            return IteratorImp(node, index);                          // RETURN
+        }
+
+        node = node->child(index);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+int BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBoundIndex(
+                                                    const Node *node,
+                                                    const KEY&  key) const
+{
+    // Note that the search is written so that the compiler can select the
+    // next range with a conditional move, rather than a branch that is
+    // mispredicted half of the time.
+
+    const ENTRY *entries = node->entries();
+    const ENTRY *base    = entries;
+    int          length  = node->d_count;
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    while (1 < length) {
+        const int half = length / 2;
+
+        base   += d_comparator(ENTRY_UTIL::key(base[half - 1]), key) ? half
+                                                                       : 0;
+        length -= half;
+    }
+
+    return static_cast<int>(base - entries)
+         + (d_comparator(ENTRY_UTIL::key(*base), key) ? 1 : 0);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBoundImp(const KEY& key) const
+{
+    Node *node = d_root_p;
+
+    if (0 == node) {
+        return IteratorImp();                                         // RETURN
+    }
+
+    while (true) {
+        int index = upperBoundIndex(node, key);
+
+        if (node->d_isLeaf) {
+            while (index == node->d_count && node->d_parent_p) {
+                index = node->d_position;
+                node  = node->d_parent_p;
+            }
+            return IteratorImp(node, index);                          // RETURN
+        }
+
+        node = node->child(index);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+int BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBoundIndex(
+                                                    const Node *node,
+                                                    const KEY&  key) const
+{
+    const ENTRY *entries = node->entries();
+    const ENTRY *base    = entries;
+    int          length  = node->d_count;
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    while (1 < length) {
+        const int half = length / 2;
+
+        base   += d_comparator(key, ENTRY_UTIL::key(base[half - 1])) ? 0
+                                                                       : half;
+        length -= half;
+    }
+
+    return static_cast<int>(base - entries)
+         + (d_comparator(key, ENTRY_UTIL::key(*base)) ? 0 : 1);
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::BTree(
+                                          const COMPARATOR&  comparator,
+                                          bslma::Allocator  *basicAllocator)
+: d_root_p(0)
+, d_size(0)
+, d_comparator(comparator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::BTree(
+                                              const BTree&      original,
+                                              bslma::Allocator *basicAllocator)
+: d_root_p(0)
+, d_size(0)
+, d_comparator(original.d_comparator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Build the copy in 'temp', which destroys it if an exception is thrown.
+    // Appending in order fills each node (see {Node Splitting and Bulk
+    // Loading}).
+
+    BTree temp(d_comparator, d_allocator_p);
+
+    for (const_iterator it = original.begin(); it != original.end(); ++it) {
+        temp.insert(temp.cend(), *it);
+    }
+
+    d_root_p      = temp.d_root_p;
+    d_size        = temp.d_size;
+    temp.d_root_p = 0;
+    temp.d_size   = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::BTree(
+                                             bslmf::MovableRef<BTree> original)
+: d_root_p(bslmf::MovableRefUtil::access(original).d_root_p)
+, d_size(bslmf::MovableRefUtil::access(original).d_size)
+, d_comparator(bslmf::MovableRefUtil::access(original).d_comparator)
+, d_allocator_p(bslmf::MovableRefUtil::access(original).d_allocator_p)
+{
+    BTree& lvalue = original;
+
+    lvalue.d_root_p = 0;
+    lvalue.d_size   = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::BTree(
+                                    bslmf::MovableRef<BTree>  original,
+                                    bslma::Allocator         *basicAllocator)
+: d_root_p(0)
+, d_size(0)
+, d_comparator(bslmf::MovableRefUtil::access(original).d_comparator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BTree& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        d_root_p        = lvalue.d_root_p;
+        d_size          = lvalue.d_size;
+        lvalue.d_root_p = 0;
+        lvalue.d_size   = 0;
+    }
+    else {
+        BTree temp(d_comparator, d_allocator_p);
+
+        for (iterator it = lvalue.begin(); it != lvalue.end(); ++it) {
+            temp.insert(temp.cend(), bslmf::MovableRefUtil::move(*it));
+        }
+
+        d_root_p      = temp.d_root_p;
+        d_size        = temp.d_size;
+        temp.d_root_p = 0;
+        temp.d_size   = 0;
+
+        // The moved-from keys of 'original' are no longer ordered.
+
+        lvalue.clear();
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::~BTree()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::operator=(const BTree& rhs)
+{
+    if (this != &rhs) {
+        BTree temp(rhs, d_allocator_p);
+
+        swap(temp);
+    }
+
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::operator=(
+                                                  bslmf::MovableRef<BTree> rhs)
+{
+    BTree& lvalue = rhs;
+
+    if (this != &lvalue) {
+        BTree temp(bslmf::MovableRefUtil::move(lvalue), d_allocator_p);
+
+        swap(temp);
+    }
+
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class KEY_TYPE>
+ENTRY& BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::operator[](
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    Node *node;
+    int   position;
+    if (findInsertPosition(&node, &position, key)) {
+        return node->entries()[position];                             // RETURN
+    }
+
+    bsls::ObjectBuffer<ENTRY> buffer;
+    ENTRY_UTIL::construct(buffer.address(),
+                          d_allocator_p,
+                          BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+    bslma::DestructorProctor<ENTRY> proctor(buffer.address());
+
+    IteratorImp result = insertAt(node, position, buffer.address());
+    proctor.release();
+
+    return *result;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::clear()
+{
+    if (d_root_p) {
+        destroyNodes(d_root_p);
+        d_root_p = 0;
+        d_size   = 0;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator,
+          typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::equal_range(const KEY& key)
+{
+    IteratorImp first = lowerBoundImp(key);
+    IteratorImp last  = first;
+
+    if (last != endImp() && !d_comparator(key, ENTRY_UTIL::key(*last))) {
+        ++last;
+    }
+
+    return bsl::pair<iterator, iterator>(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bsl::size_t BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(const KEY& key)
+{
+    IteratorImp position = findImp(key);
+
+    if (position == endImp()) {
+        return 0;                                                     // RETURN
+    }
+
+    erase(const_iterator(position));
+
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    Node *node  = position.imp().node();
+    int   index = position.imp().position();
+
+    // 'cursor' tracks the entry following the erased one (or is
+    // default-constructed if there is none) while the tree is rebalanced.
+
+    IteratorImp cursor;
+
+    if (node->d_isLeaf) {
+        ENTRY *entries = node->entries();
+
+        bslma::DestructionUtil::destroy(entries + index);
+        relocate(entries + index,
+                 entries + index + 1,
+                 node->d_count - index - 1);
+        --node->d_count;
+
+        Node *next      = node;
+        int   nextIndex = index;
+        while (nextIndex == next->d_count && next->d_parent_p) {
+            nextIndex = next->d_position;
+            next      = next->d_parent_p;
+        }
+        if (nextIndex < next->d_count) {
+            cursor = IteratorImp(next, nextIndex);
+        }
+    }
+    else {
+        // Replace the erased entry by its predecessor, the last entry of the
+        // rightmost leaf of the preceding subtree, and remove the predecessor
+        // from that leaf.  The next entry is the first entry of the leftmost
+        // leaf of the following subtree.
+
+        Node *leaf = node->child(index);
+        while (!leaf->d_isLeaf) {
+            leaf = leaf->child(leaf->d_count);
+        }
+
+        Node *next = node->child(index + 1);
+        while (!next->d_isLeaf) {
+            next = next->child(0);
+        }
+        cursor = IteratorImp(next, 0);
+
+        bslma::DestructionUtil::destroy(node->entries() + index);
+        bslma::ConstructionUtil::destructiveMove(
+                                       node->entries() + index,
+                                       d_allocator_p,
+                                       leaf->entries() + leaf->d_count - 1);
+        --leaf->d_count;
+
+        node = leaf;
+    }
+
+    --d_size;
+
+    rebalance(node, &cursor);
+
+    return cursor.node() ? iterator(cursor) : end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(const_iterator first,
+                                                 const_iterator last)
+{
+    // Erasing an entry moves other entries, so count the entries to erase
+    // and follow the iterator returned by each erasure.
+
+    bsl::size_t numEntries = 0;
+    for (const_iterator it = first; it != last; ++it) {
+        ++numEntries;
+    }
+
+    iterator result(first.imp());
+    for (; 0 < numEntries; --numEntries) {
+        result = erase(const_iterator(result));
+    }
+
+    return result;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::find(const KEY& key)
+{
+    return iterator(findImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(cend(), *first);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return iterator(lowerBoundImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return iterator(upperBoundImp(key));
+}
+
+                          // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::begin()
+{
+    return iterator(beginImp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::end()
+{
+    return iterator(endImp());
+}
+
+                             // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::swap(BTree& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    bslalg::SwapUtil::swap(&d_root_p,     &other.d_root_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::contains(const KEY& key) const
+{
+    Node *node;
+    int   position;
+
+    return findInsertPosition(&node, &position, key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::count(
+                                                          const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator,
+          typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::equal_range(const KEY& key) const
+{
+    IteratorImp first = lowerBoundImp(key);
+    IteratorImp last  = first;
+
+    if (last != endImp() && !d_comparator(key, ENTRY_UTIL::key(*last))) {
+        ++last;
+    }
+
+    return bsl::pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::find(const KEY& key) const
+{
+    return const_iterator(findImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+int BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::height() const
+{
+    int rv = 0;
+
+    for (const Node *node = d_root_p; node; ++rv) {
+        node = node->d_isLeaf ? 0 : node->child(0);
+    }
+
+    return rv;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+COMPARATOR BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return const_iterator(lowerBoundImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::size() const
+{
+    return d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return const_iterator(upperBoundImp(key));
+}
+
+                          // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::begin() const
+{
+    return const_iterator(beginImp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::cbegin() const
+{
+    return const_iterator(beginImp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::cend() const
+{
+    return const_iterator(endImp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::end() const
+{
+    return const_iterator(endImp());
+}
+
+                             // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bslma::Allocator *BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool bdlc::operator==(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                      const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs)
+{
+    typedef typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+                                                                 ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    ConstIterator lhsIt = lhs.begin();
+    ConstIterator rhsIt = rhs.begin();
+    for (; lhsIt != lhs.end(); ++lhsIt, ++rhsIt) {
+        if (!(*lhsIt == *rhsIt)) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool bdlc::operator!=(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                      const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void bdlc::swap(BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& a,
+                BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR> Tree;
+
+    Tree futureA(b, a.allocator());
+    Tree futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1704 @@
+// bdlc_btree.t.cpp                                                   -*-C++-*-
+
+#include <bdlc_btree.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsltf_movablealloctesttype.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//
+//                              Overview
+//                              --------
+// The object under test is a container implementing a B-tree.  The general
+// concerns are correctness of the tree structure (node occupancy, parent
+// links, uniform leaf depth, and key order) through every sequence of
+// insertions and erasures, correct iteration in both directions, exception
+// safety, and proper dispatching (for member function templates such as
+// insert).  This container is implemented in the form of a class template,
+// and thus its proper instantiation for types that are, and are not, bitwise
+// moveable is a concern.
+//
+// Most test cases verify the structure of the tree after each modification
+// using the test function 'isValid', and verify the contents of the tree
+// against a 'bsl::set' model.
+//
+// Primary Manipulators:
+//: o 'clear'
+//: o 'erase(key)'
+//: o 'insert'
+//
+// Basic Accessors:
+//: o 'allocator'
+//: o 'begin'
+//: o 'end'
+//: o 'height'
+//: o 'key_comp'
+//: o 'size'
+//
+// Certain standard value-semantic-type test cases are omitted:
+//: o ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+//: o ostream& operator<<(ostream& stream, const BTree& tree);
+//: o BDEX
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Injected exceptions are safely propagated during memory allocation.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BTree(const COMPARATOR&, Allocator *basicAllocator = 0);
+// [ 8] BTree(const BTree&, Allocator *basicAllocator = 0);
+// [ 8] BTree(BTree&&);
+// [ 8] BTree(BTree&&, Allocator *basicAllocator);
+// [ 2] ~BTree();
+//
+// MANIPULATORS
+// [ 8] BTree& operator=(const BTree&);
+// [ 8] BTree& operator=(BTree&&);
+// [10] ENTRY& operator[](FORWARD_REF(KEY_TYPE) key);
+// [ 2] void clear();
+// [ 5] bsl::pair<iterator, iterator> equal_range(const KEY&);
+// [ 6] size_t erase(const KEY&);
+// [ 6] iterator erase(const_iterator);
+// [ 6] iterator erase(iterator);
+// [ 6] iterator erase(const_iterator, const_iterator);
+// [ 5] iterator find(const KEY&);
+// [ 3] bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry);
+// [ 7] iterator insert(const_iterator, FORWARD_REF(ENTRY_TYPE) entry);
+// [ 7] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 5] iterator lower_bound(const KEY&);
+// [ 5] iterator upper_bound(const KEY&);
+//
+// [ 4] iterator begin();
+// [ 4] iterator end();
+//
+// [ 8] void swap(BTree&);
+//
+// ACCESSORS
+// [ 5] bool contains(const KEY&) const;
+// [ 5] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 5] bsl::pair<ci, ci> equal_range(const KEY&) const;
+// [ 5] const_iterator find(const KEY&) const;
+// [ 3] int height() const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 5] const_iterator lower_bound(const KEY&) const;
+// [ 2] size_t size() const;
+// [ 5] const_iterator upper_bound(const KEY&) const;
+//
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_iterator end() const;
+//
+// [ 2] Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 8] bool operator==(const BTree&, const BTree&);
+// [ 8] bool operator!=(const BTree&, const BTree&);
+//
+// FREE FUNCTIONS
+// [ 8] void swap(BTree&, BTree&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: node capacity is derived from the size of 'ENTRY'
+// [ 4] CONCERN: 'BTree_IteratorImp::operator++()'
+// [ 4] CONCERN: 'BTree_IteratorImp::operator--()'
+// [ 7] CONCERN: appending in key order fills nodes
+// [ 9] CONCERN: insertion is exception safe
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+                              // =================
+                              // struct LargeEntry
+                              // =================
+
+struct LargeEntry {
+    // This 'struct' provides an entry type too large for more than one entry
+    // to fit in a node of the target size.
+
+    // DATA
+    char d_data[200];
+};
+
+                           // ====================
+                           // struct TestEntryUtil
+                           // ====================
+
+template <class ENTRY>
+struct TestEntryUtil
+    // This templated utility provides methods to construct an 'ENTRY' having a
+    // specified integer key, and a method to extract the key from an 'ENTRY'.
+{
+    // CLASS METHODS
+    static void construct(ENTRY             *entry,
+                          bslma::Allocator  *allocator,
+                          int                key)
+        // Load into the specified 'entry' the specified 'key' value, using the
+        // specified 'allocator' to supply memory.
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key);
+    }
+
+    static int key(const ENTRY& entry)
+        // Return the key of the specified 'entry'.
+    {
+        return entry.data();
+    }
+};
+
+template <>
+struct TestEntryUtil<int>
+    // This utility provides methods to assign the integer value of an entry,
+    // and a method to extract the value from an entry.
+{
+    // CLASS METHODS
+    static void construct(int               *entry,
+                          bslma::Allocator  *,
+                          int                key)
+        // Load into the specified 'entry' the specified 'key' value.
+    {
+        *entry = key;
+    }
+
+    static int key(const int& entry)
+        // Return the key of the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+template <>
+struct TestEntryUtil<bsl::pair<int, int> >
+    // This utility provides methods to construct a 'bsl::pair<int, int>'
+    // having the specified key as the 'first' value and zero as the 'second'
+    // value, and a method to extract the key from a 'bsl::pair<int, int>'.
+{
+    // CLASS METHODS
+    static void construct(bsl::pair<int, int> *entry,
+                          bslma::Allocator    *allocator,
+                          int                  key)
+        // Load into the specified 'entry' the pair value comprised of the
+        // value of the specified 'key' and zero, using the specified
+        // 'allocator' to supply memory.
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key, 0);
+    }
+
+    static int key(const bsl::pair<int, int>& entry)
+        // Return the key of the specified 'entry'.
+    {
+        return entry.first;
+    }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class ENTRY>
+int checkNode(const bdlc::BTree_Node<ENTRY> *node,
+              bool                           isRoot,
+              bool                           isRightEdge,
+              const int                     *low,
+              const int                     *high,
+              int                            depth,
+              int                           *leafDepth,
+              bsl::size_t                   *numEntries)
+    // Return 0 if the subtree rooted at the specified 'node' is valid, and a
+    // non-zero value otherwise.  The subtree is valid if 'node' has at least
+    // 'k_MIN_COUNT' entries (unless the specified 'isRoot' is 'true', or the
+    // specified 'isRightEdge' is 'true' and 'node' has at least one entry,
+    // see {'bdlc_btree'|Node Splitting and Bulk Loading}), the
+    // keys of its entries are strictly increasing and between the specified
+    // 'low' and 'high' (each unless 0), and its children (if any) are valid,
+    // refer back to 'node', and have the correct positions.  The specified
+    // 'depth' is the depth of 'node'; load the depth of the leaves into the
+    // specified 'leafDepth' if it is negative, and otherwise verify that every
+    // leaf has that depth.  Add the number of entries of the subtree to the
+    // specified 'numEntries'.
+{
+    typedef bdlc::BTree_Node<ENTRY> Node;
+    typedef TestEntryUtil<ENTRY>    EntryUtil;
+
+    const int count = node->d_count;
+
+    if (count > Node::k_CAPACITY) {
+        return 1;                                                     // RETURN
+    }
+    if (!isRoot && !isRightEdge && count < Node::k_MIN_COUNT) {
+        return 2;                                                     // RETURN
+    }
+    if (0 == count) {
+        return 3;                                                     // RETURN
+    }
+
+    const ENTRY *entries = node->entries();
+
+    for (int i = 0; i < count; ++i) {
+        const int key = EntryUtil::key(entries[i]);
+
+        if ((0 == i && low && !(*low < key))
+         || (0 <  i && !(EntryUtil::key(entries[i - 1]) < key))
+         || (high && !(key < *high))) {
+            return 4;                                                 // RETURN
+        }
+    }
+
+    *numEntries += count;
+
+    if (node->d_isLeaf) {
+        if (*leafDepth < 0) {
+            *leafDepth = depth;
+        }
+        return *leafDepth == depth ? 0 : 5;                           // RETURN
+    }
+
+    for (int i = 0; i <= count; ++i) {
+        const Node *child = node->child(i);
+
+        if (child->d_parent_p != node || child->d_position != i) {
+            return 6;                                                 // RETURN
+        }
+
+        int childLow  = 0 < i     ? EntryUtil::key(entries[i - 1]) : 0;
+        int childHigh = i < count ? EntryUtil::key(entries[i])     : 0;
+
+        int rc = checkNode(child,
+                           false,
+                           isRightEdge && i == count,
+                           0 < i     ? &childLow  : low,
+                           i < count ? &childHigh : high,
+                           depth + 1,
+                           leafDepth,
+                           numEntries);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+    }
+
+    return 0;
+}
+
+template <class OBJ>
+int isValid(const OBJ& object)
+    // Return 0 if the specified 'object' satisfies the invariants of a B-tree
+    // (see 'checkNode'), its root has no parent, and the number of entries in
+    // its nodes is its 'size()', and a non-zero value otherwise.
+{
+    typedef typename OBJ::entry_type        Entry;
+    typedef bdlc::BTree_Node<Entry>         Node;
+
+    const Node *root = object.begin().imp().node();
+
+    if (0 == root) {
+        return object.size() ? 7 : 0;                                 // RETURN
+    }
+
+    while (root->d_parent_p) {
+        root = root->d_parent_p;
+    }
+
+    int         leafDepth  = -1;
+    bsl::size_t numEntries = 0;
+
+    int rc = checkNode(root, true, true, 0, 0, 1, &leafDepth, &numEntries);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    if (leafDepth != object.height()) {
+        return 8;                                                     // RETURN
+    }
+
+    return numEntries == object.size() ? 0 : 9;
+}
+
+template <class OBJ>
+bool matches(const OBJ& object, const bsl::set<int>& model)
+    // Return 'true' if the keys of the entries of the specified 'object',
+    // both in forward and in reverse iteration order, are those of the
+    // specified 'model', and 'false' otherwise.
+{
+    typedef typename OBJ::entry_util_type EntryUtil;
+
+    if (object.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+
+    typename OBJ::const_iterator  it      = object.begin();
+    bsl::set<int>::const_iterator modelIt = model.begin();
+    for (; modelIt != model.end(); ++it, ++modelIt) {
+        if (EntryUtil::key(*it) != *modelIt) {
+            return false;                                             // RETURN
+        }
+    }
+    if (it != object.end()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::set<int>::const_reverse_iterator modelRit = model.rbegin();
+    for (; modelRit != model.rend(); ++modelRit) {
+        --it;
+        if (EntryUtil::key(*it) != *modelRit) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return it == object.begin();
+}
+
+int nextRandom(unsigned int *state)
+    // Return the next value of a linear congruential pseudo-random sequence
+    // whose state is the specified 'state', in the range '[0, 2^15)'.
+{
+    *state = *state * 1103515245u + 12345u;
+
+    return static_cast<int>((*state >> 16) & 0x7fff);
+}
+
+// ============================================================================
+//                       TEMPLATIZED TEST FUNCTIONS
+// ----------------------------------------------------------------------------
+
+template <class ENTRY>
+void testCase3Insert()
+    // Test 'insert' and 'height' for trees of the (template parameter) type
+    // 'ENTRY', with keys in increasing, decreasing, and pseudo-random order.
+{
+    typedef bdlc::BTree<int, ENTRY, TestEntryUtil<ENTRY>, bsl::less<int> >
+                                                                           Obj;
+
+    const int CAP = Obj::k_NODE_CAPACITY;
+    const int NUM = 4 * CAP * CAP + 7;
+
+    for (int order = 0; order < 3; ++order) {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+        bsl::set<int> model(&sa);
+        unsigned int  state = 1;
+        int           height = 0;
+
+        for (int i = 0; i < NUM; ++i) {
+            const int KEY = 0 == order ? i
+                          : 1 == order ? NUM - i
+                          : nextRandom(&state) % (2 * NUM);
+
+            bool inserted = model.insert(KEY).second;
+
+            bsls::ObjectBuffer<ENTRY> buffer;
+            TestEntryUtil<ENTRY>::construct(buffer.address(), &oa, KEY);
+            bslma::DestructorGuard<ENTRY> guard(buffer.address());
+
+            bsl::pair<typename Obj::iterator, bool> rv =
+                                                   mX.insert(buffer.object());
+
+            ASSERTV(order, i, inserted == rv.second);
+            ASSERTV(order, i, KEY == TestEntryUtil<ENTRY>::key(*rv.first));
+            ASSERTV(order, i, 0 == isValid(X));
+
+            // The height grows by at most one at a time.
+
+            ASSERTV(order, i, X.height() - height <= 1);
+            height = X.height();
+        }
+
+        ASSERTV(order, matches(X, model));
+        ASSERTV(order, X.height(), 3 <= X.height());
+
+        if (veryVerbose) { P_(order) P_(X.size()) P(X.height()) }
+    }
+}
+
+template <class ENTRY>
+void testCase6Erase()
+    // Test the 'erase' methods for trees of the (template parameter) type
+    // 'ENTRY', erasing single entries in pseudo-random order, ranges, and
+    // entries at iterator positions.
+{
+    typedef bdlc::BTree<int, ENTRY, TestEntryUtil<ENTRY>, bsl::less<int> >
+                                                                           Obj;
+    typedef TestEntryUtil<ENTRY> EntryUtil;
+
+    const int CAP = Obj::k_NODE_CAPACITY;
+    const int NUM = 3 * CAP * CAP + 5;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int seed = 1; seed <= 2; ++seed) {
+        // Build trees by ordered and by random insertion, then erase by key
+        // in pseudo-random order, verifying each step.  (The contents are
+        // compared to the model periodically, to limit the running time.)
+
+        for (int build = 0; build < 2; ++build) {
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            bsl::set<int> model(&sa);
+            unsigned int  state = seed;
+
+            for (int i = 0; i < NUM; ++i) {
+                const int KEY = 0 == build ? i : nextRandom(&state) % NUM;
+
+                model.insert(KEY);
+                mX[KEY];
+            }
+            ASSERTV(seed, build, matches(X, model));
+
+            while (!model.empty()) {
+                const int KEY = nextRandom(&state) % NUM;
+
+                bsl::size_t expected = model.erase(KEY);
+
+                ASSERTV(seed, build, KEY, expected == mX.erase(KEY));
+                ASSERTV(seed, build, KEY, X.end() == X.find(KEY));
+
+                if (expected) {
+                    ASSERTV(seed, build, KEY, 0 == isValid(X));
+                }
+                if (expected && 0 == model.size() % 8) {
+                    ASSERTV(seed, build, KEY, matches(X, model));
+                }
+            }
+            ASSERTV(seed, build, X.empty());
+            ASSERTV(seed, build, 0 == X.height());
+            ASSERTV(seed, build, 0 == oa.numBytesInUse());
+        }
+    }
+
+    // Erase at iterator positions, verifying the returned iterator, in trees
+    // (built by appending, so having full nodes) of height 3.
+
+    const int NUM_FULL = CAP * (CAP + 2);
+
+    for (int step = 1; step <= 5; ++step) {
+        Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+        bsl::set<int> model(&sa);
+
+        for (int i = 0; i < NUM_FULL; ++i) {
+            model.insert(i);
+            mX[i];
+        }
+
+        typename Obj::iterator it = mX.begin();
+        int                    n  = 0;
+        while (it != mX.end()) {
+            if (0 == n++ % step) {
+                const int KEY = EntryUtil::key(*it);
+
+                bsl::set<int>::iterator next = model.erase(model.find(KEY));
+
+                it = mX.erase(it);
+
+                ASSERTV(step, KEY, 0 == isValid(X));
+                if (next == model.end()) {
+                    ASSERTV(step, KEY, X.end() == it);
+                }
+                else {
+                    ASSERTV(step, KEY, X.end() != it);
+                    ASSERTV(step, KEY, *next == EntryUtil::key(*it));
+                }
+            }
+            else {
+                ++it;
+            }
+        }
+        ASSERTV(step, matches(X, model));
+
+        // Erase from the end backwards.
+
+        while (!X.empty()) {
+            typename Obj::const_iterator last = X.end();
+            --last;
+
+            model.erase(--model.end());
+
+            ASSERTV(step, X.end() == mX.erase(last));
+            ASSERTV(step, 0 == isValid(X));
+        }
+        ASSERTV(step, matches(X, model));
+    }
+
+    // Erase ranges.
+
+    const int LENGTHS[] = { 0, 1, CAP / 2, CAP, 3 * CAP, NUM_FULL };
+    const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS / sizeof *LENGTHS);
+
+    for (int first = 0; first < NUM_FULL; first += NUM_FULL / 8 + 1) {
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int last = first + LENGTHS[ti];
+
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            bsl::set<int> model(&sa);
+
+            for (int i = 0; i < NUM_FULL; ++i) {
+                model.insert(i);
+                mX[i];
+            }
+
+            typename Obj::iterator rv = mX.erase(X.lower_bound(first),
+                                                 X.lower_bound(last));
+            model.erase(model.lower_bound(first), model.lower_bound(last));
+
+            ASSERTV(first, last, 0 == isValid(X));
+            ASSERTV(first, last, matches(X, model));
+            ASSERTV(first, last, X.lower_bound(last) == rv);
+        }
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // 'operator[]'
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the existing entry having the
+        //:   key, if there is one, without modifying the tree.
+        //:
+        //: 2 Otherwise, 'operator[]' inserts an entry constructed by
+        //:   'ENTRY_UTIL::construct' and returns a reference to it.
+        //:
+        //: 3 The returned reference provides modifiable access.
+        //
+        // Plan:
+        //: 1 Use 'operator[]' to insert entries in pseudo-random order into a
+        //:   tree of 'bsl::pair<int, int>', setting the 'second' member of
+        //:   each new entry, and verify the structure and contents of the tree
+        //:   against a 'bsl::set' model.  Then verify that 'operator[]'
+        //:   returns the same entries, unchanged.  (C-1..3)
+        //
+        // Testing:
+        //   ENTRY& operator[](FORWARD_REF(KEY_TYPE) key);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'operator[]'" << endl
+                          << "============" << endl;
+
+        typedef bsl::pair<int, int> Entry;
+        typedef bdlc::BTree<int, Entry, TestEntryUtil<Entry>, bsl::less<int> >
+                                                                           Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+        bsl::set<int> model(&sa);
+        unsigned int  state = 7;
+
+        for (int i = 0; i < 2000; ++i) {
+            const int KEY = nextRandom(&state) % 1500;
+
+            const bool  isNew = model.insert(KEY).second;
+            Entry&      entry = mX[KEY];
+
+            ASSERTV(i, KEY == entry.first);
+            ASSERTV(i, isNew == (0 == entry.second));
+
+            entry.second = KEY + 1;
+
+            ASSERTV(i, 0 == isValid(X));
+        }
+        ASSERT(matches(X, model));
+
+        for (bsl::set<int>::const_iterator it = model.begin();
+                                                 it != model.end(); ++it) {
+            ASSERTV(*it, *it + 1 == mX[*it].second);
+        }
+        ASSERT(model.size() == X.size());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an exception is thrown while constructing an entry, or while
+        //:   allocating a node (including when several nodes are split at
+        //:   once), the tree is unchanged and no memory is leaked.
+        //:
+        //: 2 The copy constructor does not leak memory when an exception is
+        //:   thrown.
+        //
+        // Plan:
+        //: 1 Using a non-bitwise-moveable entry type that allocates, build
+        //:   trees of several sizes (including sizes for which the next
+        //:   insertion splits a chain of full nodes) and, within the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, insert a new entry
+        //:   and verify that on exception the tree is valid and unchanged.
+        //:   (C-1)
+        //:
+        //: 2 Within the same macros, copy construct a tree.  The test
+        //:   allocator verifies no memory is leaked.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: insertion is exception safe
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        typedef bsltf::MovableAllocTestType Entry;
+        typedef bdlc::BTree<int, Entry, TestEntryUtil<Entry>, bsl::less<int> >
+                                                                           Obj;
+
+        const int CAP = Obj::k_NODE_CAPACITY;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, CAP - 1, CAP, CAP + 1, CAP * CAP,
+                              CAP * (CAP + 1), 3 * CAP * CAP };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            bsl::set<int> model(&sa);
+            for (int i = 0; i < SIZE; ++i) {
+                model.insert(2 * i);
+                mX.insert(mX.end(), Entry(2 * i, &oa));
+            }
+
+            const int KEYS[] = { -1, SIZE, 2 * SIZE + 1 };
+            for (int ki = 0; ki < 3; ++ki) {
+                const int KEY = KEYS[ki];
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(SIZE, KEY, 0 == isValid(X));
+                    ASSERTV(SIZE, KEY, matches(X, model));
+
+                    mX.insert(Entry(KEY, &oa));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                model.insert(KEY);
+
+                ASSERTV(SIZE, KEY, 0 == isValid(X));
+                ASSERTV(SIZE, KEY, matches(X, model));
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj mY(X, &oa);  const Obj& Y = mY;
+
+                    ASSERTV(SIZE, KEY, X == Y);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERT(0 == oa.numBytesInUse());
+#endif
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, a valid structure, and
+        //:   uses the specified allocator.
+        //:
+        //: 2 Moving with the same allocator transfers the nodes without
+        //:   allocating; moving with a different allocator moves the entries.
+        //:
+        //: 3 Copy and move assignment give the target the value of the source,
+        //:   including assignment to self.
+        //:
+        //: 4 'swap' exchanges the values of two trees, both when they have the
+        //:   same and when they have different allocators.
+        //:
+        //: 5 'operator==' and 'operator!=' compare sizes and entries.
+        //
+        // Plan:
+        //: 1 For trees of several sizes, exercise each operation and verify
+        //:   the results with 'isValid', 'matches', and 'operator=='.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   BTree(const BTree&, Allocator *basicAllocator = 0);
+        //   BTree(BTree&&);
+        //   BTree(BTree&&, Allocator *basicAllocator);
+        //   BTree& operator=(const BTree&);
+        //   BTree& operator=(BTree&&);
+        //   void swap(BTree&);
+        //   bool operator==(const BTree&, const BTree&);
+        //   bool operator!=(const BTree&, const BTree&);
+        //   void swap(BTree&, BTree&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                      << "==========================================" << endl;
+
+        typedef bsltf::MovableAllocTestType Entry;
+        typedef bdlc::BTree<int, Entry, TestEntryUtil<Entry>, bsl::less<int> >
+                                                                           Obj;
+
+        const int CAP = Obj::k_NODE_CAPACITY;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, CAP, CAP + 1, CAP * CAP + 3 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bsl::set<int> model(&sa);
+            Obj           mW(bsl::less<int>(), &oa);  const Obj& W = mW;
+            unsigned int  state = 3;
+
+            for (int i = 0; i < SIZE; ++i) {
+                const int KEY = nextRandom(&state);
+
+                model.insert(KEY);
+                mW.insert(Entry(KEY, &oa));
+            }
+
+            // Copy construction.
+
+            Obj mX(W, &za);  const Obj& X = mX;
+
+            ASSERTV(SIZE, 0 == isValid(X));
+            ASSERTV(SIZE, matches(X, model));
+            ASSERTV(SIZE, &za == X.allocator());
+            ASSERTV(SIZE, W == X);
+            ASSERTV(SIZE, !(W != X));
+
+            // Equality with a different value.
+
+            {
+                Obj mY(W, &oa);  const Obj& Y = mY;
+
+                mY.insert(Entry(-1, &oa));
+                ASSERTV(SIZE, W != Y);
+                ASSERTV(SIZE, Y != W);
+
+                mY.erase(-1);
+                ASSERTV(SIZE, W == Y);
+
+                if (SIZE) {
+                    const int KEY = TestEntryUtil<Entry>::key(*Y.begin());
+
+                    mY.erase(KEY);
+                    mY.insert(Entry(KEY - 1, &oa));
+                    ASSERTV(SIZE, W.size() == Y.size());
+                    ASSERTV(SIZE, W != Y);
+                }
+            }
+
+            // Move construction with the same allocator.
+
+            {
+                Obj mY(W, &oa);
+
+                bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                Obj mZ(bslmf::MovableRefUtil::move(mY));  const Obj& Z = mZ;
+
+                ASSERTV(SIZE, numAllocations == oa.numAllocations());
+                ASSERTV(SIZE, 0 == isValid(Z));
+                ASSERTV(SIZE, matches(Z, model));
+                ASSERTV(SIZE, 0 == isValid(mY));
+                ASSERTV(SIZE, mY.empty());
+
+                Obj mV(bslmf::MovableRefUtil::move(mZ), &oa);
+                const Obj& V = mV;
+
+                ASSERTV(SIZE, numAllocations == oa.numAllocations());
+                ASSERTV(SIZE, matches(V, model));
+            }
+
+            // Move construction with a different allocator.
+
+            {
+                Obj mY(W, &oa);
+                Obj mZ(bslmf::MovableRefUtil::move(mY), &za);
+                const Obj& Z = mZ;
+
+                ASSERTV(SIZE, &za == Z.allocator());
+                ASSERTV(SIZE, 0 == isValid(Z));
+                ASSERTV(SIZE, matches(Z, model));
+                ASSERTV(SIZE, 0 == isValid(mY));
+            }
+
+            // Assignment, including to self.
+
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                Obj mY(bsl::less<int>(), &za);  const Obj& Y = mY;
+                for (int i = 0; i < SIZES[tj]; ++i) {
+                    mY.insert(Entry(i, &za));
+                }
+
+                mY = W;
+                ASSERTV(SIZE, SIZES[tj], 0 == isValid(Y));
+                ASSERTV(SIZE, SIZES[tj], matches(Y, model));
+                ASSERTV(SIZE, SIZES[tj], &za == Y.allocator());
+
+                mY = Y;
+                ASSERTV(SIZE, SIZES[tj], matches(Y, model));
+
+                Obj mZ(W, &oa);
+
+                mY.clear();
+                mY = bslmf::MovableRefUtil::move(mZ);
+                ASSERTV(SIZE, SIZES[tj], 0 == isValid(Y));
+                ASSERTV(SIZE, SIZES[tj], matches(Y, model));
+            }
+
+            // Swap.
+
+            {
+                Obj mY(bsl::less<int>(), &oa);  const Obj& Y = mY;
+                mY.insert(Entry(-5, &oa));
+
+                Obj mZ(W, &oa);  const Obj& Z = mZ;
+
+                mZ.swap(mY);
+                ASSERTV(SIZE, matches(Y, model));
+                ASSERTV(SIZE, 1 == Z.size());
+
+                swap(mY, mZ);
+                ASSERTV(SIZE, matches(Z, model));
+                ASSERTV(SIZE, 1 == Y.size());
+
+                Obj mV(bsl::less<int>(), &za);  const Obj& V = mV;
+
+                swap(mZ, mV);
+                ASSERTV(SIZE, matches(V, model));
+                ASSERTV(SIZE, Z.empty());
+                ASSERTV(SIZE, &za == V.allocator());
+                ASSERTV(SIZE, &oa == Z.allocator());
+                ASSERTV(SIZE, 0 == isValid(V));
+            }
+        }
+        ASSERT(0 == oa.numBytesInUse());
+        ASSERT(0 == za.numBytesInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // HINTED INSERTION AND BULK LOADING
+        //
+        // Concerns:
+        //: 1 Inserting with a hint that immediately follows the new entry's
+        //:   position inserts the entry at that position.
+        //:
+        //: 2 Inserting with an incorrect hint inserts the entry at the correct
+        //:   position.
+        //:
+        //: 3 Inserting an existing key with a hint returns the existing entry
+        //:   and does not modify the tree.
+        //:
+        //: 4 Inserting a sorted range into an empty tree produces nodes that
+        //:   are nearly full.
+        //:
+        //: 5 'insert(first, last)' inserts every entry of an unsorted range,
+        //:   ignoring duplicates.
+        //
+        // Plan:
+        //: 1 For every position of trees of several sizes, insert a key that
+        //:   belongs before the position with that position as the hint, and
+        //:   a key that does not with that position as the hint, and verify
+        //:   the tree.  (C-1..3)
+        //:
+        //: 2 Insert a sorted range into an empty tree, and verify that the
+        //:   memory in use is within a small factor of the size of the
+        //:   entries.  (C-4)
+        //:
+        //: 3 Insert an unsorted range with duplicates, and compare the tree to
+        //:   a 'bsl::set' model.  (C-5)
+        //
+        // Testing:
+        //   iterator insert(const_iterator, FORWARD_REF(ENTRY_TYPE) entry);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   CONCERN: appending in key order fills nodes
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HINTED INSERTION AND BULK LOADING" << endl
+                          << "=================================" << endl;
+
+        typedef bdlc::BTree<int, int, TestEntryUtil<int>, bsl::less<int> > Obj;
+
+        const int CAP = Obj::k_NODE_CAPACITY;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tHinted insertion at every position." << endl;
+
+        const int SIZES[] = { 0, 1, 2, CAP, CAP + 1, 2 * CAP + 1, CAP * CAP };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            const int STEP = 1 + SIZE / (4 * CAP);
+
+            for (int hintIndex = 0; hintIndex <= SIZE; hintIndex += STEP) {
+                for (int good = 0; good < 2; ++good) {
+                    Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+                    bsl::set<int> model(&sa);
+                    for (int i = 0; i < SIZE; ++i) {
+                        model.insert(10 * i);
+                        mX.insert(10 * i);
+                    }
+
+                    Obj::const_iterator hint = X.begin();
+                    for (int i = 0; i < hintIndex; ++i) {
+                        ++hint;
+                    }
+
+                    // A good key belongs immediately before the hint; a bad
+                    // key belongs elsewhere (when there is another place).
+
+                    const int KEY = good
+                                  ? 10 * hintIndex - 5
+                                  : 10 * ((hintIndex + SIZE / 2 + 1)
+                                                             % (SIZE + 1)) - 5;
+
+                    model.insert(KEY);
+
+                    Obj::iterator rv = mX.insert(hint, KEY);
+
+                    ASSERTV(SIZE, hintIndex, good, KEY == *rv);
+                    ASSERTV(SIZE, hintIndex, good, 0 == isValid(X));
+                    ASSERTV(SIZE, hintIndex, good, matches(X, model));
+
+                    // Inserting an existing key has no effect.
+
+                    const bsls::Types::Int64 numAllocations =
+                                                           oa.numAllocations();
+
+                    rv = mX.insert(X.begin(), KEY);
+                    ASSERTV(SIZE, hintIndex, good, KEY == *rv);
+                    ASSERTV(SIZE, hintIndex, good, matches(X, model));
+                    ASSERTV(SIZE, hintIndex, good,
+                            numAllocations == oa.numAllocations());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tBulk loading a sorted range." << endl;
+        {
+            const int NUM = 100000;
+
+            bsl::vector<int> values(&sa);
+            for (int i = 0; i < NUM; ++i) {
+                values.push_back(i);
+            }
+
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            const bsls::Types::Int64 bytesBefore = oa.numBytesInUse();
+
+            mX.insert(values.begin(), values.end());
+
+            const bsls::Types::Int64 bytes = oa.numBytesInUse() - bytesBefore;
+
+            ASSERT(0 == isValid(X));
+            ASSERT(NUM == static_cast<int>(X.size()));
+
+            // Full leaves hold 'CAP' entries in a node of 'sizeof(Node)'
+            // bytes; allow for the internal nodes and a partially filled
+            // leaf at each level.
+
+            typedef bdlc::BTree_Node<int> Node;
+
+            const bsls::Types::Int64 fullBytes =
+                           static_cast<bsls::Types::Int64>(NUM / CAP + 1)
+                                                                * sizeof(Node);
+
+            if (veryVerbose) { P_(CAP) P_(bytes) P(fullBytes) }
+
+            ASSERTV(bytes, fullBytes, bytes < fullBytes + fullBytes / 4);
+
+            // Random insertion leaves nodes about 70% full.
+
+            Obj mY(bsl::less<int>(), &oa);  const Obj& Y = mY;
+
+            unsigned int state = 5;
+            for (int i = 0; i < NUM; ++i) {
+                const int j = (nextRandom(&state) << 15 | nextRandom(&state))
+                                                                         % NUM;
+                bsl::swap(values[i], values[j]);
+            }
+            mY.insert(values.begin(), values.end());
+
+            ASSERT(0 == isValid(Y));
+            ASSERT(X == Y);
+        }
+
+        if (verbose) cout << "\tInserting an unsorted range." << endl;
+        {
+            bsl::vector<int> values(&sa);
+            bsl::set<int>    model(&sa);
+            unsigned int     state = 11;
+
+            for (int i = 0; i < 5000; ++i) {
+                values.push_back(nextRandom(&state) % 3000);
+                model.insert(values.back());
+            }
+
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            mX.insert(values.begin(), values.begin() + 2500);
+            ASSERT(0 == isValid(X));
+
+            mX.insert(values.begin() + 2500, values.end());
+            ASSERT(0 == isValid(X));
+            ASSERT(matches(X, model));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'erase'
+        //
+        // Concerns:
+        //: 1 'erase(key)' removes the entry having the key, if any, and
+        //:   returns the number of entries removed.
+        //:
+        //: 2 After each erasure the tree is valid: nodes are merged and
+        //:   rebalanced as required, and the height shrinks when the root
+        //:   becomes empty.
+        //:
+        //: 3 'erase(position)' returns an iterator to the entry following the
+        //:   erased entry, wherever the erased entry is in the tree and
+        //:   however the tree is rebalanced.
+        //:
+        //: 4 'erase(first, last)' removes the range and returns an iterator to
+        //:   the entry that 'last' referred to.
+        //:
+        //: 5 All memory is released when the last entry is erased.
+        //:
+        //: 6 Entries that are, and are not, bitwise moveable are supported.
+        //
+        // Plan:
+        //: 1 For trees built in key order and in pseudo-random order, erase
+        //:   keys in pseudo-random order until the tree is empty, verifying
+        //:   the tree and the return value against a 'bsl::set' model after
+        //:   every erasure.  (C-1..2, 5)
+        //:
+        //: 2 Erase every 'n'th entry by iterator, then erase the last entry
+        //:   repeatedly, verifying the returned iterator.  (C-3)
+        //:
+        //: 3 Erase ranges of several positions and lengths.  (C-4)
+        //:
+        //: 4 Perform the above for 'int' and for
+        //:   'bsltf::MovableAllocTestType'.  (C-6)
+        //
+        // Testing:
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'erase'" << endl
+                          << "=======" << endl;
+
+        testCase6Erase<int>();
+        testCase6Erase<bsltf::MovableAllocTestType>();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SEARCH
+        //
+        // Concerns:
+        //: 1 'find', 'contains', and 'count' locate every present key, in
+        //:   internal nodes and in leaves, and report absent keys as absent.
+        //:
+        //: 2 'lower_bound' and 'upper_bound' return the correct position for
+        //:   present keys, for keys between entries (including between the
+        //:   last entry of a leaf and the following separator), and for keys
+        //:   before the first and after the last entry.
+        //:
+        //: 3 'equal_range' returns the range holding the entry having the key,
+        //:   or an empty range at the insertion position.
+        //:
+        //: 4 The 'const' and non-'const' overloads return the same positions.
+        //
+        // Plan:
+        //: 1 Build trees of several sizes holding the even numbers '[0, 2n)',
+        //:   and, for every key in '[-1, 2n]', compare the results of each
+        //:   method to those of the corresponding 'bsl::set' method.  (C-1..4)
+        //
+        // Testing:
+        //   bsl::pair<iterator, iterator> equal_range(const KEY&);
+        //   iterator find(const KEY&);
+        //   iterator lower_bound(const KEY&);
+        //   iterator upper_bound(const KEY&);
+        //   bool contains(const KEY&) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   bsl::pair<ci, ci> equal_range(const KEY&) const;
+        //   const_iterator find(const KEY&) const;
+        //   const_iterator lower_bound(const KEY&) const;
+        //   const_iterator upper_bound(const KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SEARCH" << endl
+                          << "======" << endl;
+
+        typedef bdlc::BTree<int, int, TestEntryUtil<int>, bsl::less<int> > Obj;
+
+        const int CAP = Obj::k_NODE_CAPACITY;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, CAP, CAP + 1, CAP * CAP, CAP * CAP * 3 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            bsl::set<int> model(&sa);
+            unsigned int  state = 9;
+
+            while (static_cast<int>(model.size()) < SIZE) {
+                const int KEY = 2 * (nextRandom(&state) % SIZE);
+
+                model.insert(KEY);
+                mX.insert(KEY);
+            }
+            ASSERTV(SIZE, 0 == isValid(X));
+
+            for (int key = -1; key <= 2 * SIZE; ++key) {
+                bsl::set<int>::const_iterator modelLower =
+                                                       model.lower_bound(key);
+                bsl::set<int>::const_iterator modelUpper =
+                                                       model.upper_bound(key);
+
+                const bool FOUND = model.count(key);
+
+                ASSERTV(SIZE, key, FOUND == X.contains(key));
+                ASSERTV(SIZE, key, FOUND == X.count(key));
+                ASSERTV(SIZE, key, FOUND == (X.end()  != X.find(key)));
+                ASSERTV(SIZE, key, FOUND == (mX.end() != mX.find(key)));
+                if (FOUND) {
+                    ASSERTV(SIZE, key, key == *X.find(key));
+                    ASSERTV(SIZE, key, key == *mX.find(key));
+                }
+
+                Obj::const_iterator lower = X.lower_bound(key);
+                Obj::const_iterator upper = X.upper_bound(key);
+
+                ASSERTV(SIZE, key, lower == mX.lower_bound(key));
+                ASSERTV(SIZE, key, upper == mX.upper_bound(key));
+
+                ASSERTV(SIZE, key,
+                        (modelLower == model.end()) == (lower == X.end()));
+                ASSERTV(SIZE, key,
+                        (modelUpper == model.end()) == (upper == X.end()));
+                if (modelLower != model.end()) {
+                    ASSERTV(SIZE, key, *modelLower == *lower);
+                }
+                if (modelUpper != model.end()) {
+                    ASSERTV(SIZE, key, *modelUpper == *upper);
+                }
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> range =
+                                                          X.equal_range(key);
+                bsl::pair<Obj::iterator, Obj::iterator> mRange =
+                                                         mX.equal_range(key);
+
+                ASSERTV(SIZE, key, lower == range.first);
+                ASSERTV(SIZE, key, upper == range.second);
+                ASSERTV(SIZE, key, lower == mRange.first);
+                ASSERTV(SIZE, key, upper == mRange.second);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ITERATORS
+        //
+        // Concerns:
+        //: 1 'begin' refers to the smallest entry, and 'end' to the
+        //:   past-the-end position; the two are equal for an empty tree.
+        //:
+        //: 2 Incrementing from 'begin' visits every entry in key order,
+        //:   descending into and climbing out of nodes, and reaches 'end'.
+        //:
+        //: 3 Decrementing from 'end' visits every entry in reverse order and
+        //:   reaches 'begin'.
+        //:
+        //: 4 The 'const' and non-'const' iterators agree, and 'cbegin' and
+        //:   'cend' return 'begin' and 'end'.
+        //:
+        //: 5 Entries are modifiable through an 'iterator'.
+        //
+        // Plan:
+        //: 1 For trees of several heights, iterate forward and backward,
+        //:   verifying the keys against a 'bsl::set' model, and mixing
+        //:   increments and decrements.  (C-1..5)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   CONCERN: 'BTree_IteratorImp::operator++()'
+        //   CONCERN: 'BTree_IteratorImp::operator--()'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATORS" << endl
+                          << "=========" << endl;
+
+        typedef bsl::pair<int, int> Entry;
+        typedef bdlc::BTree<int, Entry, TestEntryUtil<Entry>, bsl::less<int> >
+                                                                           Obj;
+
+        const int CAP = Obj::k_NODE_CAPACITY;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        {
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(X.begin()  == X.end());
+            ASSERT(mX.begin() == mX.end());
+            ASSERT(X.cbegin() == X.cend());
+        }
+
+        const int SIZES[] = { 1, 2, CAP, CAP + 1, CAP * CAP, 2 * CAP * CAP };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            bsl::set<int> model(&sa);
+            unsigned int  state = 13;
+
+            while (static_cast<int>(model.size()) < SIZE) {
+                const int KEY = nextRandom(&state);
+
+                model.insert(KEY);
+                mX.insert(Entry(KEY, 0));
+            }
+
+            ASSERTV(SIZE, matches(X, model));
+            ASSERTV(SIZE, X.cbegin() == X.begin());
+            ASSERTV(SIZE, X.cend()   == X.end());
+            ASSERTV(SIZE, mX.begin() == X.begin());
+            ASSERTV(SIZE, mX.end()   == X.end());
+
+            // Modify through 'iterator', and verify with post-increment and
+            // post-decrement.
+
+            int n = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); it++) {
+                it->second = n++;
+            }
+            ASSERTV(SIZE, SIZE == n);
+
+            Obj::const_iterator it = X.end();
+            while (it != X.begin()) {
+                it--;
+                ASSERTV(SIZE, n, --n == it->second);
+            }
+
+            // Mix increments and decrements.
+
+            it = X.begin();
+            for (int i = 0; i < SIZE - 1; ++i) {
+                Obj::const_iterator next = it;
+
+                ++next;
+                --next;
+                ASSERTV(SIZE, i, it == next);
+
+                ++it;
+                ASSERTV(SIZE, i, i + 1 == it->second);
+            }
+            ++it;
+            ASSERTV(SIZE, X.end() == it);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'insert' AND 'height'
+        //
+        // Concerns:
+        //: 1 'insert' adds an entry if and only if its key is not present, and
+        //:   returns an iterator to the entry having the key.
+        //:
+        //: 2 After every insertion the tree is valid: no node exceeds its
+        //:   capacity, nodes other than the root are not too sparse, every
+        //:   leaf has the same depth, and the keys are ordered.
+        //:
+        //: 3 Splits propagate to the root, and the height grows by one when
+        //:   the root splits.
+        //:
+        //: 4 Entries that are, and are not, bitwise moveable are supported.
+        //
+        // Plan:
+        //: 1 Insert keys in increasing, decreasing, and pseudo-random order
+        //:   (with duplicates) until the tree has at least three levels,
+        //:   verifying the tree and the return value against a 'bsl::set'
+        //:   model after every insertion.  (C-1..3)
+        //:
+        //: 2 Perform the above for 'int' and for
+        //:   'bsltf::MovableAllocTestType'.  (C-4)
+        //
+        // Testing:
+        //   bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry);
+        //   int height() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'insert' AND 'height'" << endl
+                          << "=====================" << endl;
+
+        testCase3Insert<int>();
+        testCase3Insert<bsltf::MovableAllocTestType>();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed tree is empty, has height 0, allocates no
+        //:   memory, and uses the specified (or default) allocator.
+        //:
+        //: 2 The node capacity is at least 3, and leaf nodes are about 256
+        //:   bytes.
+        //:
+        //: 3 'key_comp' returns the comparator.
+        //:
+        //: 4 'clear' releases all memory.
+        //
+        // Plan:
+        //: 1 Construct trees with and without an allocator and verify the
+        //:   accessors.  (C-1, 3)
+        //:
+        //: 2 Verify 'k_NODE_CAPACITY' and the size of a leaf node for entries
+        //:   of several sizes.  (C-2)
+        //:
+        //: 3 Insert entries, 'clear', and verify that no memory is in use.
+        //:   (C-4)
+        //
+        // Testing:
+        //   BTree(const COMPARATOR&, Allocator *basicAllocator = 0);
+        //   ~BTree();
+        //   void clear();
+        //   bool empty() const;
+        //   COMPARATOR key_comp() const;
+        //   size_t size() const;
+        //   Allocator *allocator() const;
+        //   CONCERN: node capacity is derived from the size of 'ENTRY'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTOR AND BASIC ACCESSORS" << endl
+                          << "===============================" << endl;
+
+        typedef bdlc::BTree<int, int, TestEntryUtil<int>, bsl::less<int> > Obj;
+
+        {
+            bsl::less<int> comparator;
+
+            Obj mX(comparator);  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.height());
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            bsl::less<int> comparator = X.key_comp();
+            ASSERT(comparator(1, 2));
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(1000 == X.size());
+            ASSERT(!X.empty());
+            ASSERT(0 < oa.numBytesInUse());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == X.height());
+            ASSERT(0 == oa.numBytesInUse());
+
+            mX.insert(1);
+            ASSERT(1 == X.size());
+        }
+        ASSERT(0 == oa.numBytesInUse());
+
+        typedef bdlc::BTree_Node<char>                  CharNode;
+        typedef bdlc::BTree_Node<int>                   IntNode;
+        typedef bdlc::BTree_Node<bsl::pair<int, int> >  PairNode;
+        typedef bdlc::BTree_Node<bsltf::MovableAllocTestType>  AllocNode;
+
+        typedef bdlc::BTree_Node<LargeEntry>            BigNode;
+
+        if (veryVerbose) {
+            P_(CharNode::k_CAPACITY)  P(sizeof(CharNode))
+            P_(IntNode::k_CAPACITY)   P(sizeof(IntNode))
+            P_(PairNode::k_CAPACITY)  P(sizeof(PairNode))
+            P_(AllocNode::k_CAPACITY) P(sizeof(AllocNode))
+            P_(BigNode::k_CAPACITY)   P(sizeof(BigNode))
+        }
+
+        ASSERT(Obj::k_NODE_CAPACITY == IntNode::k_CAPACITY);
+
+        ASSERT(3 <= CharNode::k_CAPACITY);
+        ASSERT(3 <= IntNode::k_CAPACITY);
+        ASSERT(3 == BigNode::k_CAPACITY);
+
+        ASSERT(sizeof(CharNode)  <= 256);
+        ASSERT(sizeof(IntNode)   <= 256);
+        ASSERT(sizeof(PairNode)  <= 256);
+        ASSERT(sizeof(AllocNode) <= 256);
+
+        ASSERT(sizeof(IntNode)   > 256 - sizeof(int));
+        ASSERT(sizeof(PairNode)  > 256 - sizeof(bsl::pair<int, int>));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Instantiate an object and verify basic functionality.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        typedef bdlc::BTree<int, int, TestEntryUtil<int>, bsl::less<int> > Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        Obj        mX(bsl::less<int>(), &oa);
+        const Obj& X = mX;
+
+        ASSERT(      0 == X.size());
+        ASSERT(X.end() == X.find(0));
+
+        {
+            bsl::pair<Obj::iterator, bool> rv = mX.insert(0);
+
+            ASSERT(       1 ==  X.size());
+            ASSERT(    true ==  rv.second);
+            ASSERT( X.end() !=  rv.first);
+            ASSERT(       0 == *rv.first);
+            ASSERT(rv.first ==  X.find(0));
+            ASSERT( X.end() ==  X.find(1));
+        }
+
+        for (int i = 1; i < 100; ++i) {
+            mX.insert(100 - i);
+        }
+        ASSERT(100 == X.size());
+        ASSERT(0 == isValid(X));
+
+        int expected = 0;
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            ASSERTV(expected, expected == *it);
+            ++expected;
+        }
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+
+        ASSERT(X == Y);
+
+        ASSERT(1 == mY.erase(50));
+        ASSERT(0 == mY.erase(50));
+        ASSERT(99 == Y.size());
+        ASSERT(X != Y);
+        ASSERT(0 == isValid(Y));
+        ASSERT(Y.end() == Y.find(50));
+        ASSERT(51 == *Y.lower_bound(50));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    LOOP_ASSERT(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1404 @@
+// bdlc_btreemap.h                                                    -*-C++-*-
+#ifndef INCLUDED_BDLC_BTREEMAP
+#define INCLUDED_BDLC_BTREEMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cache-friendly ordered map container.
+//
+//@CLASSES:
+//   bdlc::BTreeMap: B-tree based ordered map container
+//
+//@SEE_ALSO: bdlc_btree, bdlc_btreeset, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::BTreeMap', that implements an ordered map of items with unique keys,
+// stored in a B-tree.
+//
+// Ordered maps are useful when keys must be visited in order, or looked up by
+// range (e.g., with 'lower_bound').  'bsl::map' stores each element in its own
+// red-black tree node, so that every element costs a separate allocation and
+// three pointers of overhead, and every level of a search, and every step of
+// an iteration, is likely to be a cache miss on a large map.  'bdlc::BTreeMap'
+// instead stores many elements contiguously in each node, with nodes sized to
+// a few cache lines (see {'bdlc_btree'}), so that a map of millions of
+// elements is only a few levels deep, uses a fraction of the memory of a
+// 'bsl::map', and is iterated mostly sequentially through memory.
+// 'bdlc::BTreeMap' generally exhibits better performance than 'bsl::map' for
+// lookups, iteration, and insertion, particularly for maps too large for the
+// data cache and for small element types.
+//
+// An instantiation of 'bdlc::BTreeMap' is an allocator-aware, value-semantic
+// type whose salient attributes are the sequence of 'KEY-VALUE' pairs
+// contained, in key order.  An instantiation may be provided with a custom
+// key-comparison functor, but it is not a salient attribute.  In particular,
+// when comparing element values for equality between two different
+// 'bdlc::BTreeMap' objects, the elements are compared using 'operator=='.
+//
+///Interface Differences with 'map'
+///--------------------------------
+// A 'bdlc::BTreeMap' meets most of the requirements of an associative
+// container with bidirectional iterators in the C++11 Standard [23.2.4].  The
+// elements of a 'bdlc::BTreeMap' are moved within and between nodes when the
+// map is modified, so that (unlike in a 'bsl::map') the insertion or erasure
+// of any element invalidates all iterators, pointers, and references to
+// elements of the map (see {Iterator, Pointer, and Reference Invalidation}).
+// The iterators of a 'bdlc::BTreeMap' refer to objects of type
+// 'bsl::pair<KEY, VALUE>', rather than 'value_type', whose key must not be
+// modified.  Allocator use follows BDE style, and the various allocator
+// propagation attributes are not present (e.g., the allocator trait
+// 'propagate_on_container_copy_assignment').
+//
+///Bulk Loading
+///------------
+// Inserting elements in increasing key order at the end of the map (e.g., by
+// constructing a map from, or calling 'insert' with, a range sorted by key, or
+// by calling 'insert' with 'end()' as the hint) takes amortized constant time
+// per element, as no search is needed, and leaves the nodes of the map nearly
+// full, so that the map uses the least memory and is fastest to search and to
+// iterate.  Inserting in random order leaves nodes about 70% full on average.
+//
+///Requirements on 'KEY', 'VALUE', and 'COMPARATOR'
+///------------------------------------------------
+// The template parameter types 'KEY' and 'VALUE' must be copy or move
+// constructible, and their move constructors must not throw when the source
+// and destination use the same allocator.  The template parameter type
+// 'COMPARATOR' must be a default and copy constructible function object.
+//
+// 'COMPARATOR' must support a function-call operator compatible with the
+// following statements for objects 'key1' and 'key2' of type 'KEY':
+//..
+//  COMPARATOR comparator;
+//  bool       result = comparator(key1, key2);
+//..
+// where the definition of the called function defines a strict weak ordering
+// on keys.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Elements are moved within and between the nodes of a 'bdlc::BTreeMap' as
+// the map is modified, so any manipulator that inserts or erases an element
+// invalidates all pointers, references, and iterators to elements of the map.
+// Note that the iterator returned by a manipulator is valid.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::BTreeMap' is exception neutral.  The insertion of a single element
+// provides the strong exception safety guarantee, and all other methods
+// provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Orders by Time
+/// - - - - - - - - - - - - - - - - -
+// Suppose we maintain, for a trading system, an index from the timestamp of
+// each order (in microseconds) to the quantity of the order, and must answer
+// queries such as "what quantity was ordered in a given interval?".  The
+// index is large, is loaded in time order, and is queried by range, so an
+// ordered map is needed, and 'bdlc::BTreeMap' keeps it compact.
+//
+// First, we define an alias for the index:
+//..
+//  typedef bdlc::BTreeMap<bsls::Types::Int64, int> OrderIndex;
+//..
+// Then, we load the index from a log of orders, which is sorted by time.
+// Since the orders arrive in key order, each is inserted at the end of the
+// map (see {Bulk Loading}):
+//..
+//  struct Order {
+//      bsls::Types::Int64 d_timestamp;
+//      int                d_quantity;
+//  };
+//
+//  const Order orders[] = {
+//      { 1000000, 100 },
+//      { 1000350, 200 },
+//      { 1002000,  50 },
+//      { 1002010, 300 },
+//      { 1007500,  25 },
+//      { 1009999, 400 },
+//  };
+//  const bsl::size_t numOrders = sizeof orders / sizeof *orders;
+//
+//  OrderIndex index;
+//
+//  for (bsl::size_t i = 0; i < numOrders; ++i) {
+//      index.insert(index.end(),
+//                   bsl::make_pair(orders[i].d_timestamp,
+//                                  orders[i].d_quantity));
+//  }
+//
+//  assert(numOrders == index.size());
+//..
+// Next, we define a function that sums the quantities ordered in the
+// half-open interval '[begin, end)', by iterating from the first order not
+// before 'begin':
+//..
+//  int quantityBetween(const OrderIndex&  index,
+//                      bsls::Types::Int64 begin,
+//                      bsls::Types::Int64 end)
+//      // Return the total quantity of the orders in the specified 'index'
+//      // whose timestamps are at or after the specified 'begin' and before
+//      // the specified 'end'.
+//  {
+//      int total = 0;
+//
+//      for (OrderIndex::const_iterator it = index.lower_bound(begin);
+//                                      it != index.end() && it->first < end;
+//                                      ++it) {
+//          total += it->second;
+//      }
+//
+//      return total;
+//  }
+//..
+// Finally, we query the index:
+//..
+//  assert(300 == quantityBetween(index, 1000000, 1002000));
+//  assert(350 == quantityBetween(index, 1002000, 1007500));
+//  assert(  0 == quantityBetween(index, 1002011, 1007500));
+//  assert(675 == quantityBetween(index,       0, 1009999));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_btree.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_addconst.h>
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_iterator.h>
+#include <bslstl_stdexceptutil.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_TRAITS_HEADER)
+#include <bsl_type_traits.h>
+    #ifndef BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES
+    #error Rvalue references curiously absent despite native 'type_traits'.
+    #endif
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class BTreeMap;
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(BTreeMap<KEY, VALUE, COMPARATOR>& a,
+          BTreeMap<KEY, VALUE, COMPARATOR>& b);
+
+                        // =========================
+                        // struct BTreeMap_EntryUtil
+                        // =========================
+
+template <class KEY, class VALUE, class ENTRY>
+struct BTreeMap_EntryUtil
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY'.
+{
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Load into the specified 'entry' the 'ENTRY' value comprised of the
+        // specified 'key' and a default constructed 'VALUE', using the
+        // specified 'allocator' to supply memory.  'allocator' is ignored if
+        // the (template parameter) type 'ENTRY' is not allocator aware.
+
+    static const KEY& key(const ENTRY& entry);
+        // Return the key of the specified 'entry'.
+};
+
+                               // ==============
+                               // class BTreeMap
+                               // ==============
+
+template <class KEY, class VALUE, class COMPARATOR>
+class BTreeMap {
+    // This class template implements a value-semantic container type holding
+    // an ordered map of 'KEY-VALUE' pairs having unique keys that provides a
+    // mapping from keys of (template parameter) type 'KEY' to their associated
+    // mapped values of (template parameter) type 'VALUE'.  The (template
+    // parameter) type 'COMPARATOR' is a functor defining the order of two
+    // 'KEY' values.  See {Requirements on 'KEY', 'VALUE', and 'COMPARATOR'}
+    // for more information.
+
+  private:
+    // PRIVATE TYPES
+    typedef BTree<KEY,
+                  bsl::pair<KEY, VALUE>,
+                  BTreeMap_EntryUtil<KEY, VALUE, bsl::pair<KEY, VALUE> >,
+                  COMPARATOR> ImplType;
+        // This is the underlying implementation class.
+
+    // FRIENDS
+    friend bool operator==<>(const BTreeMap&, const BTreeMap&);
+    friend bool operator!=<>(const BTreeMap&, const BTreeMap&);
+
+    // The following verbose declaration is required by the xlC 12.1 compiler.
+    template <class K, class V, class C>
+    friend void swap(BTreeMap<K, V, C>&, BTreeMap<K, V, C>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<typename bsl::add_const<KEY>::type, VALUE> value_type;
+
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::size_t                                size_type;
+    typedef bsl::ptrdiff_t                             difference_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+    typedef value_type*                                pointer;
+    typedef const value_type*                          const_pointer;
+    typedef typename ImplType::iterator                iterator;
+    typedef typename ImplType::const_iterator          const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying B-tree used by this map
+
+  public:
+    // CREATORS
+    BTreeMap();
+    explicit BTreeMap(bslma::Allocator *basicAllocator);
+    explicit BTreeMap(const COMPARATOR&  comparator,
+                      bslma::Allocator  *basicAllocator = 0);
+        // Create an empty 'BTreeMap' object.  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    BTreeMap(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    BTreeMap(INPUT_ITERATOR     first,
+             INPUT_ITERATOR     last,
+             const COMPARATOR&  comparator,
+             bslma::Allocator  *basicAllocator = 0);
+        // Create a 'BTreeMap' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.  Note that if a member of the input sequence has an
+        // equivalent key to an earlier member, the later member will not be
+        // inserted.  Also note that a range sorted by key is loaded in linear
+        // time (see {Bulk Loading}).
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeMap(bsl::initializer_list<value_type>  values,
+             bslma::Allocator                  *basicAllocator = 0);
+    BTreeMap(bsl::initializer_list<value_type>  values,
+             const COMPARATOR&                  comparator,
+             bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'BTreeMap' object initialized by insertion of the specified
+        // 'values'.  Optionally specify a 'comparator' used to order the keys
+        // of elements in this container.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.  Note that if a
+        // member of 'values' has an equivalent key to an earlier member, the
+        // later member will not be inserted.
+#endif
+
+    BTreeMap(const BTreeMap& original, bslma::Allocator *basicAllocator = 0);
+        // Create a 'BTreeMap' object having the same value and comparator as
+        // the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified or is 0, the currently installed default allocator is
+        // used.
+
+    BTreeMap(bslmf::MovableRef<BTreeMap> original);
+        // Create a 'BTreeMap' object having the same value, comparator, and
+        // allocator as the specified 'original' object.  The contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, and no exceptions will be
+        // thrown.
+
+    BTreeMap(bslmf::MovableRef<BTreeMap>  original,
+             bslma::Allocator            *basicAllocator);
+        // Create a 'BTreeMap' object having the same value and comparator as
+        // the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The allocator of
+        // 'original' remains unchanged.  If 'original' and the newly created
+        // object have the same allocator then the contents of 'original' are
+        // moved (in constant time) to this object, and no exceptions will be
+        // thrown; otherwise the elements of 'original' are moved into this
+        // object (and an exception may be thrown).  In either case 'original'
+        // is left in a (valid) unspecified state.
+
+    ~BTreeMap();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    BTreeMap& operator=(const BTreeMap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    BTreeMap& operator=(bslmf::MovableRef<BTreeMap> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If this object and 'rhs' use the same allocator the
+        // contents of 'rhs' are moved (in constant time) to this object.
+        // 'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeMap& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // map and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects having a value whose key is
+        // equivalent to that which appears earlier in the list; return a
+        // reference providing modifiable access to this object.
+#endif
+
+    template <class KEY_TYPE>
+    VALUE& operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map.  If this map does
+        // not already contain an element having 'key', insert an element with
+        // the 'key' and a default-constructed 'VALUE', and return a reference
+        // to the newly mapped value.  If 'key' is movable, 'key' is left in a
+        // (valid) unspecified state.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map, if such an entry
+        // exists; otherwise throw a 'std::out_of_range' exception.  Note that
+        // this method is not exception-neutral.
+
+    void clear();
+        // Remove all elements from this map and release all memory held by
+        // this map.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this map having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // map contains no elements having a key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that since a
+        // map maintains unique keys, the range will contain at most one
+        // element.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element whose key is equivalent to the
+        // specified 'key', if it exists, and return 1; otherwise (there is no
+        // element having 'key' in this map), return 0 with no other effect.
+        // If an element is removed, this method invalidates all iterators and
+        // references to elements of this map.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the modifiable element immediately
+        // following the removed element, or to the past-the-end position if
+        // the removed element was the last element in the sequence of elements
+        // maintained by this map.  This method invalidates all other iterators
+        // and references to elements of this map.  The behavior is undefined
+        // unless 'position' refers to an element in this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referencing the same element as 'last'.  This
+        // method invalidates all other iterators and references to elements of
+        // this map.  The behavior is undefined unless 'first' and 'last' are
+        // valid iterators on this map, and the 'first' position is at or
+        // before the 'last' position in the iteration sequence provided by
+        // this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the modifiable element in this map
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this map.
+
+#if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
+    template <class VALUE_TYPE>
+    bsl::pair<iterator, bool>
+#elif !defined(BSLS_COMPILERFEATURES_SUPPORT_TRAITS_HEADER)
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            bsl::pair<iterator, bool> >::type
+#else
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_constructible<value_type,
+                                                  VALUE_TYPE&&>::value,
+                            bsl::pair<iterator, bool> >::type
+#endif
+    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map; otherwise, this method has no
+        // effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) modifiable element in
+        // this map whose key is equivalent to that of the element to be
+        // inserted, and whose 'second' member is 'true' if a new element was
+        // inserted, and 'false' if an element with an equivalent key was
+        // already present.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insert(BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+    }
+
+#if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
+    template <class VALUE_TYPE>
+    iterator
+#elif !defined(BSLS_COMPILERFEATURES_SUPPORT_TRAITS_HEADER)
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+#else
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_constructible<value_type,
+                                                  VALUE_TYPE&&>::value,
+                            iterator>::type
+#endif
+    insert(const_iterator                                hint,
+           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map; otherwise, this method has no
+        // effect.  Return an iterator referring to the (possibly newly
+        // inserted) modifiable element in this map whose key is equivalent to
+        // that of the element to be inserted.  If 'value' belongs immediately
+        // before the specified 'hint', it is inserted there in amortized
+        // constant time; otherwise 'hint' is ignored.  The behavior is
+        // undefined unless 'hint' is a valid iterator on this map.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insert(hint,
+                             BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last').  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that if the key of a member of
+        // the input sequence is equivalent to the key of an earlier member,
+        // the later member will not be inserted.  Also note that a range
+        // sorted by key, whose keys follow those of this map, is inserted in
+        // linear time (see {Bulk Loading}).
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this map an element having the value of each object in
+        // the specified 'values' initializer list if a value with an
+        // equivalent key is not already contained in this map.
+#endif
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first modifiable element in
+        // this map whose key is not ordered before the specified 'key', or
+        // 'end()' if there is no such element.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first modifiable element in
+        // this map whose key is ordered after the specified 'key', or 'end()'
+        // if there is no such element.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator to the first element in the sequence of
+        // modifiable elements maintained by this map, or the 'end' iterator if
+        // this map is empty.
+
+    iterator end();
+        // Return an iterator to the past-the-end element in the sequence of
+        // modifiable elements maintained by this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator to the last element in the sequence of
+        // modifiable elements maintained by this map, or 'rend()' if this map
+        // is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator to the prior-to-the-beginning element in
+        // the sequence of modifiable elements maintained by this map.
+
+                             // Aspects
+
+    void swap(BTreeMap& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  The behavior is undefined
+        // unless this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the mapped
+        // value associated with the specified 'key' in this map, if such an
+        // entry exists; otherwise throw a 'std::out_of_range' exception.  Note
+        // that this method is not exception-neutral.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this map having the specified
+        // 'key'.  Note that since a map maintains unique keys, the returned
+        // value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this map having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this map contains
+        // no elements having a key equivalent to 'key', then the two returned
+        // iterators will have the same value.  Note that since a map maintains
+        // unique keys, the range will contain at most one element.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the element in this map
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this map.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this map to
+        // order keys.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this map
+        // whose key is not ordered before the specified 'key', or 'end()' if
+        // there is no such element.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this map
+        // whose key is ordered after the specified 'key', or 'end()' if there
+        // is no such element.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return a 'const_iterator' to the first element in the sequence of
+        // elements maintained by this map, or the 'end' iterator if this map
+        // is empty.
+
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' to the first element in the sequence of
+        // elements maintained by this map, or the 'end' iterator if this map
+        // is empty.
+
+    const_iterator cend() const;
+        // Return a 'const_iterator' to the past-the-end element in the
+        // sequence of elements maintained by this map.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse 'const_iterator' to the last element in the
+        // sequence of elements maintained by this map, or 'crend()' if this
+        // map is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse 'const_iterator' to the prior-to-the-beginning
+        // element in the sequence of elements maintained by this map.
+
+    const_iterator end() const;
+        // Return a 'const_iterator' to the past-the-end element in the
+        // sequence of elements maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse 'const_iterator' to the last element in the
+        // sequence of elements maintained by this map, or 'rend()' if this map
+        // is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse 'const_iterator' to the prior-to-the-beginning
+        // element in the sequence of elements maintained by this map.
+
+                           // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level', and return a
+        // reference to the modifiable 'stream'.  If 'level' is specified,
+        // optionally specify 'spacesPerLevel', the number of spaces per
+        // indentation level for this and all of its nested objects.  If
+        // 'level' is negative, suppress indentation of the first line.  If
+        // 'spacesPerLevel' is negative, format the entire output on one line,
+        // suppressing all but the initial indentation (as governed by
+        // 'level').  If 'stream' is not valid on entry, this operation has no
+        // effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'BTreeMap' objects have the same
+    // value if their sizes are the same and each element of one is equal to
+    // the element at the same position, in key order, of the other.  The
+    // comparators are not involved in the comparison.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'BTreeMap' objects do not have
+    // the same value if their sizes are different or some element of one is
+    // not equal to the element at the same position, in key order, of the
+    // other.  The comparators are not involved in the comparison.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator<(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+               const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator>(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+               const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator<=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator>=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than, greater than, less than or equal to, or
+    // greater than or equal to (respectively) the value of the specified
+    // 'rhs' map, and 'false' otherwise.  The sequences of elements, in key
+    // order, are compared using 'operator<' on the elements.  The comparators
+    // are not involved in the comparison.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::ostream& operator<<(bsl::ostream&                           stream,
+                         const BTreeMap<KEY, VALUE, COMPARATOR>& map);
+    // Write the value of the specified 'map' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(BTreeMap<KEY, VALUE, COMPARATOR>& a,
+          BTreeMap<KEY, VALUE, COMPARATOR>& b);
+    // Exchange the value and the comparator of the specified 'a' and 'b'
+    // objects.  This function provides the no-throw exception-safety
+    // guarantee if the two objects were created with the same allocator and
+    // the basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -------------------------
+                        // struct BTreeMap_EntryUtil
+                        // -------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class ENTRY>
+template <class KEY_TYPE>
+inline
+void BTreeMap_EntryUtil<KEY, VALUE, ENTRY>::construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bsls::ObjectBuffer<VALUE> value;
+
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    bslma::ConstructionUtil::construct(
+                                  entry,
+                                  allocator,
+                                  BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key),
+                                  bslmf::MovableRefUtil::move(value.object()));
+}
+
+template <class KEY, class VALUE, class ENTRY>
+inline
+const KEY& BTreeMap_EntryUtil<KEY, VALUE, ENTRY>::key(const ENTRY& entry)
+{
+    return entry.first;
+}
+
+                               // --------------
+                               // class BTreeMap
+                               // --------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap()
+: d_impl(COMPARATOR())
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                                           const COMPARATOR&  comparator,
+                                           bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(INPUT_ITERATOR     first,
+                                           INPUT_ITERATOR     last,
+                                           const COMPARATOR&  comparator,
+                                           bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                             bsl::initializer_list<value_type>  values,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                             bsl::initializer_list<value_type>  values,
+                             const COMPARATOR&                  comparator,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                                            const BTreeMap&   original,
+                                            bslma::Allocator *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                                          bslmf::MovableRef<BTreeMap> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                                 bslmf::MovableRef<BTreeMap>  original,
+                                 bslma::Allocator            *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                              bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::~BTreeMap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>&
+BTreeMap<KEY, VALUE, COMPARATOR>::operator=(const BTreeMap& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>&
+BTreeMap<KEY, VALUE, COMPARATOR>::operator=(bslmf::MovableRef<BTreeMap> rhs)
+{
+    BTreeMap& lvalue = rhs;
+
+    d_impl = bslmf::MovableRefUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>&
+BTreeMap<KEY, VALUE, COMPARATOR>::operator=(
+                                      bsl::initializer_list<value_type> values)
+{
+    BTreeMap tmp(values.begin(),
+                 values.end(),
+                 d_impl.key_comp(),
+                 d_impl.allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY_TYPE>
+inline
+VALUE& BTreeMap<KEY, VALUE, COMPARATOR>::operator[](
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    return d_impl[BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key)].second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+VALUE& BTreeMap<KEY, VALUE, COMPARATOR>::at(const KEY& key)
+{
+    iterator node = d_impl.find(key);
+
+    if (node == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                             "BTreeMap<...>::at(key_type): invalid key value");
+    }
+
+    return node->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void BTreeMap<KEY, VALUE, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator,
+          typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator>
+BTreeMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t BTreeMap<KEY, VALUE, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::erase(iterator position)
+{
+    // Note that this overload is necessary to avoid ambiguity when the key is
+    // a map iterator.
+
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::erase(const_iterator first,
+                                        const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void BTreeMap<KEY, VALUE, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                              INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void BTreeMap<KEY, VALUE, COMPARATOR>::insert(
+                                      bsl::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return d_impl.upper_bound(key);
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void BTreeMap<KEY, VALUE, COMPARATOR>::swap(BTreeMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const VALUE& BTreeMap<KEY, VALUE, COMPARATOR>::at(const KEY& key) const
+{
+    const_iterator node = d_impl.find(key);
+
+    if (node == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                       "BTreeMap<...>::at(key_type) const: invalid key value");
+    }
+
+    return node->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool BTreeMap<KEY, VALUE, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t BTreeMap<KEY, VALUE, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool BTreeMap<KEY, VALUE, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator,
+          typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator>
+BTreeMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+COMPARATOR BTreeMap<KEY, VALUE, COMPARATOR>::key_comp() const
+{
+    return d_impl.key_comp();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t BTreeMap<KEY, VALUE, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upper_bound(key);
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::cbegin() const
+{
+    return d_impl.cbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::cend() const
+{
+    return d_impl.cend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+                           // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bslma::Allocator *BTreeMap<KEY, VALUE, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::ostream& BTreeMap<KEY, VALUE, COMPARATOR>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    const_iterator iter = begin();
+    while (iter != end()) {
+        printer.printValue(*iter);
+        ++iter;
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator==(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator!=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_impl != rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator<(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                     const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return bsl::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator>(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                     const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator<=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator>=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                           stream,
+                               const BTreeMap<KEY, VALUE, COMPARATOR>& map)
+{
+    return map.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void bdlc::swap(BTreeMap<KEY, VALUE, COMPARATOR>& a,
+                BTreeMap<KEY, VALUE, COMPARATOR>& b)
+{
+    bslalg::SwapUtil::swap(&a.d_impl, &b.d_impl);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR>
+struct HasStlIterators<bdlc::BTreeMap<KEY, VALUE, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::BTreeMap<KEY, VALUE, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
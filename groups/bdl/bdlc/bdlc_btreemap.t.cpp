@@ -0,0 +1,1714 @@
+// bdlc_btreemap.t.cpp                                                -*-C++-*-
+
+#include <bdlc_btreemap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a container implementing an ordered map
+// stored in a B-tree.  The general concerns are correctness, exception
+// safety, and proper dispatching.  The B-tree itself is verified by the test
+// driver of 'bdlc_btree', so for all of the object's functionality except
+// 'at', 'print', 'operator<<', the reverse iterators, and the relational
+// operators, this simplifies to verifying the forwarding to the
+// implementation object 'bdlc::BTree'.  Each test compares the object under
+// test against a 'bsl::map' model.
+//
+// Primary Manipulators:
+//: o 'clear'
+//: o 'erase(key)'
+//: o 'insert'
+//
+// Basic Accessors:
+//: o 'allocator'
+//: o 'begin'
+//: o 'end'
+//: o 'key_comp'
+//: o 'size'
+//
+// Certain standard value-semantic-type test cases are omitted:
+//: o BDEX
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BTreeMap();
+// [ 2] explicit BTreeMap(bslma::Allocator *basicAllocator);
+// [ 2] explicit BTreeMap(const COMPARATOR&, Allocator *basicAllocator = 0);
+// [ 2] BTreeMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+// [ 2] BTreeMap(II, II, const COMPARATOR&, Allocator * = 0);
+// [ 2] BTreeMap(initializer_list<value_type>, Allocator * = 0);
+// [ 2] BTreeMap(init_list<vt>, const COMPARATOR&, Allocator * = 0);
+// [ 7] BTreeMap(const BTreeMap&, Allocator *basicAllocator = 0);
+// [ 7] BTreeMap(BTreeMap&&);
+// [ 7] BTreeMap(BTreeMap&&, Allocator *basicAllocator);
+// [ 2] ~BTreeMap();
+//
+// MANIPULATORS
+// [ 7] BTreeMap& operator=(const BTreeMap&);
+// [ 7] BTreeMap& operator=(BTreeMap&&);
+// [ 7] BTreeMap& operator=(initializer_list<value_type>);
+// [ 3] VALUE& operator[](FORWARD_REF(KEY_TYPE) key);
+// [ 3] VALUE& at(const KEY&);
+// [ 5] void clear();
+// [ 4] bsl::pair<iterator, iterator> equal_range(const KEY&);
+// [ 5] size_t erase(const KEY&);
+// [ 5] iterator erase(const_iterator);
+// [ 5] iterator erase(iterator);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 4] iterator find(const KEY&);
+// [ 3] bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) value);
+// [ 3] iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) value);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<value_type>);
+// [ 4] iterator lower_bound(const KEY&);
+// [ 4] iterator upper_bound(const KEY&);
+//
+// [ 6] iterator begin();
+// [ 6] iterator end();
+// [ 6] reverse_iterator rbegin();
+// [ 6] reverse_iterator rend();
+//
+// [ 7] void swap(BTreeMap&);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY&) const;
+// [ 3] bool contains(const KEY&) const;
+// [ 3] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 4] bsl::pair<ci, ci> equal_range(const KEY&) const;
+// [ 4] const_iterator find(const KEY&) const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 4] const_iterator lower_bound(const KEY&) const;
+// [ 2] size_t size() const;
+// [ 4] const_iterator upper_bound(const KEY&) const;
+//
+// [ 6] const_iterator begin() const;
+// [ 6] const_iterator cbegin() const;
+// [ 6] const_iterator cend() const;
+// [ 6] const_reverse_iterator crbegin() const;
+// [ 6] const_reverse_iterator crend() const;
+// [ 6] const_iterator end() const;
+// [ 6] const_reverse_iterator rbegin() const;
+// [ 6] const_reverse_iterator rend() const;
+//
+// [ 2] Allocator *allocator() const;
+// [ 8] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+//
+// FREE OPERATORS
+// [ 7] bool operator==(const BTreeMap&, const BTreeMap&);
+// [ 7] bool operator!=(const BTreeMap&, const BTreeMap&);
+// [ 7] bool operator<(const BTreeMap&, const BTreeMap&);
+// [ 7] bool operator>(const BTreeMap&, const BTreeMap&);
+// [ 7] bool operator<=(const BTreeMap&, const BTreeMap&);
+// [ 7] bool operator>=(const BTreeMap&, const BTreeMap&);
+// [ 8] ostream& operator<<(ostream&, const BTreeMap&);
+//
+// FREE FUNCTIONS
+// [ 7] void swap(BTreeMap&, BTreeMap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                    GLOBAL TYPEDEFS AND HELPERS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::BTreeMap<int, int> Obj;
+typedef bsl::map<int, int>       Model;
+
+static unsigned int nextRandom(unsigned int *state)
+    // Return the next value of a pseudo-random sequence whose state is held
+    // in the specified 'state', and update 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xffffff;
+}
+
+template <class MAP, class MODEL>
+bool matches(const MAP& map, const MODEL& model)
+    // Return 'true' if the specified 'map' has the same sequence of elements,
+    // in both forward and reverse order, as the specified 'model', and
+    // 'false' otherwise.
+{
+    if (map.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+
+    typename MODEL::const_iterator mit = model.begin();
+    for (typename MAP::const_iterator it = map.begin(); it != map.end();
+                                                                ++it, ++mit) {
+        if (it->first != mit->first || it->second != mit->second) {
+            return false;                                             // RETURN
+        }
+    }
+
+    typename MODEL::const_reverse_iterator rmit = model.rbegin();
+    for (typename MAP::const_reverse_iterator it = map.rbegin();
+                                                 it != map.rend(); ++it) {
+        if (it->first != rmit->first || it->second != rmit->second) {
+            return false;                                             // RETURN
+        }
+        ++rmit;
+    }
+
+    return true;
+}
+
+static void loadRandom(Obj          *map,
+                       Model        *model,
+                       int           numValues,
+                       int           range,
+                       unsigned int  seed)
+    // Insert into the specified 'map' and 'model' the specified 'numValues'
+    // pseudo-random keys in the range '[0, range)', generated from the
+    // specified 'seed', each mapped to the negation of its key.
+{
+    unsigned int state = seed;
+
+    for (int i = 0; i < numValues; ++i) {
+        const int KEY = static_cast<int>(nextRandom(&state) % range);
+
+        map->insert(bsl::make_pair(KEY, -KEY));
+        model->insert(bsl::make_pair(KEY, -KEY));
+    }
+}
+
+                       // =============================
+                       // struct ReverseIntComparator
+                       // =============================
+
+struct ReverseIntComparator {
+    // This comparator orders integers in decreasing order.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+static bsls::Types::Int64 s_antiOptimization = 0;
+
+static double nanoseconds(const bsls::TimeInterval& interval)
+    // Return the specified 'interval' in nanoseconds.
+{
+    return static_cast<double>(interval.totalNanoseconds());
+}
+
+template <class MAP>
+bsls::TimeInterval performanceInsert(MAP *map, const bsl::vector<int>& keys)
+    // Insert into the specified 'map' the specified 'keys', in order, and
+    // return the duration of the insertions.
+{
+    bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        map->insert(bsl::make_pair(keys[i], keys[i]));
+    }
+
+    return bsls::SystemTime::nowMonotonicClock() - start;
+}
+
+template <class MAP>
+bsls::TimeInterval performanceFind(const MAP&              map,
+                                   const bsl::vector<int>& keys)
+    // Invoke 'find' on the specified 'map' for each of the specified 'keys'
+    // and return the median duration of a number of trials.
+{
+    const int NUM_TRIAL = 11;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            typename MAP::const_iterator it = map.find(keys[i]);
+            if (it != map.end()) {
+                s_antiOptimization += it->second;
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+template <class MAP>
+bsls::TimeInterval performanceIterate(const MAP& map)
+    // Iterate over the specified 'map' and return the median duration of a
+    // number of trials.
+{
+    const int NUM_TRIAL = 11;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (typename MAP::const_iterator it = map.begin(); it != map.end();
+                                                                        ++it) {
+            s_antiOptimization += it->second;
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Orders by Time
+/// - - - - - - - - - - - - - - - - -
+// Suppose we maintain, for a trading system, an index from the timestamp of
+// each order (in microseconds) to the quantity of the order, and must answer
+// queries such as "what quantity was ordered in a given interval?".  The
+// index is large, is loaded in time order, and is queried by range, so an
+// ordered map is needed, and 'bdlc::BTreeMap' keeps it compact.
+//
+// First, we define an alias for the index:
+//..
+    typedef bdlc::BTreeMap<bsls::Types::Int64, int> OrderIndex;
+//..
+// Then, we load the index from a log of orders, which is sorted by time.
+// Since the orders arrive in key order, each is inserted at the end of the
+// map (see {Bulk Loading}):
+//..
+    struct Order {
+        bsls::Types::Int64 d_timestamp;
+        int                d_quantity;
+    };
+//..
+// Next, we define a function that sums the quantities ordered in the
+// half-open interval '[begin, end)', by iterating from the first order not
+// before 'begin':
+//..
+    int quantityBetween(const OrderIndex&  index,
+                        bsls::Types::Int64 begin,
+                        bsls::Types::Int64 end)
+        // Return the total quantity of the orders in the specified 'index'
+        // whose timestamps are at or after the specified 'begin' and before
+        // the specified 'end'.
+    {
+        int total = 0;
+
+        for (OrderIndex::const_iterator it = index.lower_bound(begin);
+                                        it != index.end() && it->first < end;
+                                        ++it) {
+            total += it->second;
+        }
+
+        return total;
+    }
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("usage", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const Order orders[] = {
+            { 1000000, 100 },
+            { 1000350, 200 },
+            { 1002000,  50 },
+            { 1002010, 300 },
+            { 1007500,  25 },
+            { 1009999, 400 },
+        };
+        const bsl::size_t numOrders = sizeof orders / sizeof *orders;
+
+        OrderIndex index;
+
+        for (bsl::size_t i = 0; i < numOrders; ++i) {
+            index.insert(index.end(),
+                         bsl::make_pair(orders[i].d_timestamp,
+                                        orders[i].d_quantity));
+        }
+
+        ASSERT(numOrders == index.size());
+//..
+// Finally, we query the index:
+//..
+        ASSERT(300 == quantityBetween(index, 1000000, 1002000));
+        ASSERT(350 == quantityBetween(index, 1002000, 1007500));
+        ASSERT(  0 == quantityBetween(index, 1002011, 1007500));
+        ASSERT(675 == quantityBetween(index,       0, 1009999));
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        //: 1 The 'print' method writes the elements in key order, as nested
+        //:   sequences, in the format of 'bslim::Printer'.
+        //:
+        //: 2 The output using 's << obj' is the same as 'obj.print(s, 0, -1)'.
+        //:
+        //: 3 'print' and 'operator<<' return the supplied 'ostream'.
+        //:
+        //: 4 Nothing is written to a stream in a bad state.
+        //
+        // Plan:
+        //: 1 For a set of maps and formatting parameters, compare the output
+        //:   of 'print' and 'operator<<' to expected strings.  (C-1..3)
+        //:
+        //: 2 Verify nothing is written to a stream in a bad state.  (C-4)
+        //
+        // Testing:
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   ostream& operator<<(ostream&, const BTreeMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT AND OUTPUT OPERATOR" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bslma::TestAllocator         da("temporary default",
+                                        veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+#define NL "\n"
+#define SP " "
+
+        static const struct {
+            int         d_line;
+            int         d_level;
+            int         d_spacesPerLevel;
+            int         d_numElems;
+            const int   d_keys[3];
+            const char *d_expected_p;
+        } DATA[] = {
+            //LINE  L  SPL  NE  KEYS         EXP
+            //----  -  ---  --  ----         ---
+            { L_,   0,  -1,  0, { 0 },       "[ ]"                           },
+            { L_,   0,   0,  0, { 0 },       "["  NL "]" NL                  },
+            { L_,   0,  -1,  1, { 5 },       "[ [ 5 -5 ] ]"                  },
+            { L_,   0,  -1,  3, { 3, 1, 2 }, "[ [ 1 -1 ] [ 2 -2 ] [ 3 -3 ] ]"},
+            { L_,   0,   1,  2, { 2, 1 },    "["       NL
+                                             " ["      NL
+                                             "  1"     NL
+                                             "  -1"    NL
+                                             " ]"      NL
+                                             " ["      NL
+                                             "  2"     NL
+                                             "  -2"    NL
+                                             " ]"      NL
+                                             "]"       NL                    },
+            { L_,   1,   2,  1, { 4 },       "  ["     NL
+                                             "    ["   NL
+                                             "      4" NL
+                                             "      -4" NL
+                                             "    ]"   NL
+                                             "  ]"     NL                    },
+            { L_,  -1,  -1,  1, { 4 },       "[ [ 4 -4 ] ]"                  },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+#undef NL
+#undef SP
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const int         L    = DATA[ti].d_level;
+            const int         SPL  = DATA[ti].d_spacesPerLevel;
+            const int         NE   = DATA[ti].d_numElems;
+            const char *const EXP  = DATA[ti].d_expected_p;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < NE; ++i) {
+                mX[DATA[ti].d_keys[i]] = -DATA[ti].d_keys[i];
+            }
+
+            {
+                bsl::ostringstream os(&sa);
+
+                ASSERTV(LINE, &os == &X.print(os, L, SPL));
+                ASSERTV(LINE, EXP, os.str(), EXP == os.str());
+            }
+
+            if (0 == L && -1 == SPL) {
+                bsl::ostringstream os(&sa);
+
+                ASSERTV(LINE, &os == &(os << X));
+                ASSERTV(LINE, EXP, os.str(), EXP == os.str());
+            }
+        }
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX[1] = 1;
+
+            bsl::ostringstream os(&sa);
+            os.setstate(bsl::ios::badbit);
+
+            X.print(os);
+            ASSERT(os.str().empty());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS
+        //
+        // Concerns:
+        //: 1 The copy constructor creates an object having the same value
+        //:   using the supplied allocator, and the original is unchanged.
+        //:
+        //: 2 The move constructor transfers the value (and allocator) without
+        //:   allocating; with a different allocator, the value is moved into
+        //:   memory from that allocator.
+        //:
+        //: 3 Copy, move, and initializer-list assignment assign the value and
+        //:   return a reference to the object.
+        //:
+        //: 4 'swap' (member and free) exchanges the values, and the free
+        //:   'swap' works for objects having different allocators.
+        //:
+        //: 5 The equality and relational operators compare the sequences of
+        //:   elements, in key order, consistently with 'bsl::map'.
+        //
+        // Plan:
+        //: 1 For pairs of pseudo-random maps, verify the results of the
+        //:   relational operators against those of 'bsl::map' models.  (C-5)
+        //:
+        //: 2 Copy, move, and assign pseudo-random maps, with the same and with
+        //:   different allocators, and verify the values of the results and
+        //:   the allocators used.  (C-1..4)
+        //
+        // Testing:
+        //   BTreeMap(const BTreeMap&, Allocator *basicAllocator = 0);
+        //   BTreeMap(BTreeMap&&);
+        //   BTreeMap(BTreeMap&&, Allocator *basicAllocator);
+        //   BTreeMap& operator=(const BTreeMap&);
+        //   BTreeMap& operator=(BTreeMap&&);
+        //   BTreeMap& operator=(initializer_list<value_type>);
+        //   void swap(BTreeMap&);
+        //   bool operator==(const BTreeMap&, const BTreeMap&);
+        //   bool operator!=(const BTreeMap&, const BTreeMap&);
+        //   bool operator<(const BTreeMap&, const BTreeMap&);
+        //   bool operator>(const BTreeMap&, const BTreeMap&);
+        //   bool operator<=(const BTreeMap&, const BTreeMap&);
+        //   bool operator>=(const BTreeMap&, const BTreeMap&);
+        //   void swap(BTreeMap&, BTreeMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 2, 30, 300 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (verbose) cout << "Relational operators." << endl;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                for (unsigned int seed = 1; seed <= 2; ++seed) {
+                    Obj   mX(&oa);  const Obj& X = mX;
+                    Obj   mY(&oa);  const Obj& Y = mY;
+                    Model mA(&sa);  const Model& A = mA;
+                    Model mB(&sa);  const Model& B = mB;
+
+                    loadRandom(&mX, &mA, SIZES[i], 2 * SIZES[i] + 1, 1);
+                    loadRandom(&mY, &mB, SIZES[j], 2 * SIZES[j] + 1, seed);
+
+                    ASSERTV(i, j, seed, (A == B) == (X == Y));
+                    ASSERTV(i, j, seed, (A != B) == (X != Y));
+                    ASSERTV(i, j, seed, (A <  B) == (X <  Y));
+                    ASSERTV(i, j, seed, (A >  B) == (X >  Y));
+                    ASSERTV(i, j, seed, (A <= B) == (X <= Y));
+                    ASSERTV(i, j, seed, (A >= B) == (X >= Y));
+                }
+            }
+        }
+
+        if (verbose) cout << "Copy and move construction." << endl;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            loadRandom(&mX, &mA, SIZE, 2 * SIZE + 1, 3);
+
+            {
+                Obj mY(X, &za);  const Obj& Y = mY;
+
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, &za == Y.allocator());
+                ASSERTV(SIZE, matches(X, A));
+            }
+            {
+                Obj mW(X, &oa);
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                Obj mY(bslmf::MovableRefUtil::move(mW));  const Obj& Y = mY;
+
+                ASSERTV(SIZE, NUM_BLOCKS == oa.numBlocksTotal());
+                ASSERTV(SIZE, &oa == Y.allocator());
+                ASSERTV(SIZE, matches(Y, A));
+            }
+            {
+                Obj mW(X, &oa);  const Obj& W = mW;
+
+                Obj mY(bslmf::MovableRefUtil::move(mW), &za);
+                const Obj& Y = mY;
+
+                ASSERTV(SIZE, &za == Y.allocator());
+                ASSERTV(SIZE, &oa == W.allocator());
+                ASSERTV(SIZE, matches(Y, A));
+            }
+        }
+
+        if (verbose) cout << "Assignment and swap." << endl;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                Obj   mX(&oa);  const Obj& X = mX;
+                Obj   mY(&oa);  const Obj& Y = mY;
+                Model mA(&sa);  const Model& A = mA;
+                Model mB(&sa);  const Model& B = mB;
+
+                loadRandom(&mX, &mA, SIZES[i], 2 * SIZES[i] + 1, 4);
+                loadRandom(&mY, &mB, SIZES[j], 2 * SIZES[j] + 1, 5);
+
+                {
+                    Obj mZ(Y, &za);  const Obj& Z = mZ;
+
+                    ASSERTV(i, j, &mZ == &(mZ = X));
+                    ASSERTV(i, j, matches(Z, A));
+                    ASSERTV(i, j, &za == Z.allocator());
+                }
+                {
+                    Obj mW(X, &oa);
+                    Obj mZ(Y, &oa);  const Obj& Z = mZ;
+
+                    ASSERTV(i, j,
+                            &mZ == &(mZ = bslmf::MovableRefUtil::move(mW)));
+                    ASSERTV(i, j, matches(Z, A));
+                }
+                {
+                    Obj mW(X, &oa);
+                    Obj mZ(Y, &za);  const Obj& Z = mZ;
+
+                    mZ = bslmf::MovableRefUtil::move(mW);
+                    ASSERTV(i, j, matches(Z, A));
+                    ASSERTV(i, j, &za == Z.allocator());
+                }
+                {
+                    Obj mW(X, &oa);  const Obj& W = mW;
+                    Obj mZ(Y, &oa);  const Obj& Z = mZ;
+
+                    mW.swap(mZ);
+                    ASSERTV(i, j, matches(W, B));
+                    ASSERTV(i, j, matches(Z, A));
+
+                    swap(mW, mZ);
+                    ASSERTV(i, j, matches(W, A));
+                    ASSERTV(i, j, matches(Z, B));
+                }
+                {
+                    Obj mW(X, &oa);  const Obj& W = mW;
+                    Obj mZ(Y, &za);  const Obj& Z = mZ;
+
+                    swap(mW, mZ);
+                    ASSERTV(i, j, matches(W, B));
+                    ASSERTV(i, j, matches(Z, A));
+                    ASSERTV(i, j, &oa == W.allocator());
+                    ASSERTV(i, j, &za == Z.allocator());
+                }
+            }
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX[7] = 7;
+
+            ASSERT(&mX == &(mX = { { 3, 4 }, { 1, 2 }, { 3, 5 } }));
+            ASSERT(2 == X.size());
+            ASSERT(2 == X.at(1));
+            ASSERT(4 == X.at(3));
+            ASSERT(!X.contains(7));
+        }
+#endif
+
+        if (verbose) cout << "Negative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+            Obj mY(&oa);
+            Obj mZ(&za);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ITERATORS
+        //
+        // Concerns:
+        //: 1 The forward iterators visit the elements in key order, and the
+        //:   reverse iterators in the opposite order.
+        //:
+        //: 2 The iterators of an empty map compare equal.
+        //:
+        //: 3 The mapped value may be modified through an 'iterator' and a
+        //:   'reverse_iterator'.
+        //
+        // Plan:
+        //: 1 Using 'matches', compare pseudo-random maps of various sizes to
+        //:   'bsl::map' models, and verify the iterators of empty maps.
+        //:   (C-1..2)
+        //:
+        //: 2 Modify the mapped values through each kind of modifiable
+        //:   iterator and verify the changes.  (C-3)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATORS" << endl
+                          << "=========" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(mX.begin()   == mX.end());
+            ASSERT(mX.rbegin()  == mX.rend());
+            ASSERT(X.begin()    == X.end());
+            ASSERT(X.cbegin()   == X.cend());
+            ASSERT(X.rbegin()   == X.rend());
+            ASSERT(X.crbegin()  == X.crend());
+        }
+
+        const int SIZES[] = { 1, 2, 15, 16, 17, 100, 1000, 5000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            loadRandom(&mX, &mA, SIZE, 2 * SIZE, 6);
+
+            ASSERTV(SIZE, matches(X, A));
+
+            bsl::size_t count = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ++count;
+            }
+            ASSERTV(SIZE, X.size() == count);
+
+            count = 0;
+            for (Obj::const_reverse_iterator it = X.crbegin();
+                                                      it != X.crend(); ++it) {
+                ++count;
+            }
+            ASSERTV(SIZE, X.size() == count);
+
+            ASSERTV(SIZE, A.begin()->first  == X.begin()->first);
+            ASSERTV(SIZE, A.rbegin()->first == X.rbegin()->first);
+
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second = it->first + 1;
+            }
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(SIZE, it->first + 1 == it->second);
+            }
+
+            for (Obj::reverse_iterator it = mX.rbegin(); it != mX.rend();
+                                                                        ++it) {
+                it->second = it->first + 2;
+            }
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(SIZE, it->first + 2 == it->second);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASE AND CLEAR
+        //
+        // Concerns:
+        //: 1 'erase(key)' removes the element having the key, if any, and
+        //:   returns the number of elements removed.
+        //:
+        //: 2 'erase(position)' (for both 'iterator' and 'const_iterator')
+        //:   removes the element and returns an iterator to the element that
+        //:   followed it.
+        //:
+        //: 3 'erase(first, last)' removes the elements in the range and
+        //:   returns an iterator to the element at 'last'.
+        //:
+        //: 4 'clear' removes all elements and releases all memory.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Erase pseudo-random keys, positions, and ranges from maps, and
+        //:   from 'bsl::map' models, and compare the results.  (C-1..3)
+        //:
+        //: 2 Clear maps of various sizes and verify the object allocator holds
+        //:   no memory.  (C-4)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASE AND CLEAR" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZE = 2000;
+
+        if (verbose) cout << "'erase(key)'." << endl;
+        {
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            loadRandom(&mX, &mA, SIZE, 2 * SIZE, 7);
+
+            unsigned int state = 8;
+            for (int i = 0; i < 2 * SIZE; ++i) {
+                const int KEY = static_cast<int>(nextRandom(&state)
+                                                                % (2 * SIZE));
+
+                ASSERTV(i, mA.erase(KEY) == mX.erase(KEY));
+                ASSERTV(i, A.size() == X.size());
+            }
+            ASSERT(matches(X, A));
+        }
+
+        if (verbose) cout << "'erase(position)'." << endl;
+        {
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            loadRandom(&mX, &mA, SIZE, 2 * SIZE, 9);
+
+            unsigned int state = 10;
+            for (int i = 0; !A.empty(); ++i) {
+                const int KEY = static_cast<int>(nextRandom(&state)
+                                                                % (2 * SIZE));
+
+                Obj::iterator         it  = mX.lower_bound(KEY);
+                Model::iterator       mit = mA.lower_bound(KEY);
+
+                if (mit == mA.end()) {
+                    continue;
+                }
+
+                Model::iterator mnext = mA.erase(mit);
+                Obj::iterator   next  = 0 == i % 2
+                                      ? mX.erase(it)
+                                      : mX.erase(Obj::const_iterator(it));
+
+                ASSERTV(i, (mnext == mA.end()) == (next == mX.end()));
+                if (mnext != mA.end() && next != mX.end()) {
+                    ASSERTV(i, mnext->first == next->first);
+                }
+                ASSERTV(i, A.size() == X.size());
+            }
+            ASSERT(X.empty());
+        }
+
+        if (verbose) cout << "'erase(first, last)'." << endl;
+        {
+            unsigned int state = 11;
+            for (int i = 0; i < 20; ++i) {
+                Obj   mX(&oa);  const Obj& X = mX;
+                Model mA(&sa);  const Model& A = mA;
+
+                loadRandom(&mX, &mA, SIZE / 4, SIZE, 12 + i);
+
+                int first = static_cast<int>(nextRandom(&state) % SIZE);
+                int last  = static_cast<int>(nextRandom(&state) % SIZE);
+                if (last < first) {
+                    bsl::swap(first, last);
+                }
+
+                Obj::iterator rv = mX.erase(X.lower_bound(first),
+                                            X.lower_bound(last));
+                mA.erase(mA.lower_bound(first), mA.lower_bound(last));
+
+                ASSERTV(i, matches(X, A));
+                ASSERTV(i, X.lower_bound(last) == rv);
+            }
+        }
+
+        if (verbose) cout << "'clear'." << endl;
+        {
+            const int SIZES[] = { 0, 1, 100, 1000 };
+            const int NUM_SIZES =
+                                static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                Obj   mX(&oa);  const Obj& X = mX;
+                Model mA(&sa);
+
+                loadRandom(&mX, &mA, SIZES[i], 2 * SIZES[i] + 1, 13);
+
+                mX.clear();
+
+                ASSERTV(i, X.empty());
+                ASSERTV(i, 0 == oa.numBytesInUse());
+
+                mX[1] = 2;
+                ASSERTV(i, 1 == X.size());
+            }
+        }
+
+        if (verbose) cout << "Negative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+
+            mX[1] = 1;
+
+            ASSERT_SAFE_FAIL(mX.erase(mX.end()));
+            ASSERT_SAFE_FAIL(mX.erase(mX.cend()));
+            ASSERT_SAFE_PASS(mX.erase(mX.begin()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SEARCH
+        //
+        // Concerns:
+        //: 1 'find' returns an iterator to the element having the key, or
+        //:   'end()'.
+        //:
+        //: 2 'lower_bound', 'upper_bound', and 'equal_range' return the same
+        //:   positions as those of 'bsl::map'.
+        //:
+        //: 3 The manipulators and accessors return the same positions.
+        //:
+        //: 4 A custom comparator determines the order.
+        //
+        // Plan:
+        //: 1 For pseudo-random maps and every key in, and just outside, the
+        //:   range of keys, compare the results of each search method to
+        //:   those of a 'bsl::map' model, using the distance from 'begin()'
+        //:   to compare positions.  (C-1..3)
+        //:
+        //: 2 Repeat with 'ReverseIntComparator'.  (C-4)
+        //
+        // Testing:
+        //   bsl::pair<iterator, iterator> equal_range(const KEY&);
+        //   iterator find(const KEY&);
+        //   iterator lower_bound(const KEY&);
+        //   iterator upper_bound(const KEY&);
+        //   bsl::pair<ci, ci> equal_range(const KEY&) const;
+        //   const_iterator find(const KEY&) const;
+        //   const_iterator lower_bound(const KEY&) const;
+        //   const_iterator upper_bound(const KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SEARCH" << endl
+                          << "======" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 10, 200, 3000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE  = SIZES[i];
+            const int RANGE = 2 * SIZE + 1;
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            loadRandom(&mX, &mA, SIZE, RANGE, 14);
+
+            for (int key = -1; key <= RANGE; ++key) {
+                const bsl::ptrdiff_t LOWER = bsl::distance(A.begin(),
+                                                           A.lower_bound(key));
+                const bsl::ptrdiff_t UPPER = bsl::distance(A.begin(),
+                                                           A.upper_bound(key));
+
+                ASSERTV(SIZE, key,
+                        LOWER == bsl::distance(X.begin(), X.lower_bound(key)));
+                ASSERTV(SIZE, key,
+                        UPPER == bsl::distance(X.begin(), X.upper_bound(key)));
+                ASSERTV(SIZE, key,
+                        X.lower_bound(key) == mX.lower_bound(key));
+                ASSERTV(SIZE, key,
+                        X.upper_bound(key) == mX.upper_bound(key));
+
+                bsl::pair<Obj::iterator, Obj::iterator> R1 =
+                                                         mX.equal_range(key);
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> R2 =
+                                                          X.equal_range(key);
+
+                ASSERTV(SIZE, key, LOWER == bsl::distance(mX.begin(),
+                                                          R1.first));
+                ASSERTV(SIZE, key, UPPER == bsl::distance(mX.begin(),
+                                                          R1.second));
+                ASSERTV(SIZE, key, R1.first  == R2.first);
+                ASSERTV(SIZE, key, R1.second == R2.second);
+
+                if (A.count(key)) {
+                    ASSERTV(SIZE, key, X.find(key)  != X.end());
+                    ASSERTV(SIZE, key, X.find(key)->first == key);
+                    ASSERTV(SIZE, key, mX.find(key) == X.find(key));
+                }
+                else {
+                    ASSERTV(SIZE, key, X.find(key)  == X.end());
+                    ASSERTV(SIZE, key, mX.find(key) == mX.end());
+                }
+            }
+        }
+
+        {
+            typedef bdlc::BTreeMap<int, int, ReverseIntComparator> RObj;
+
+            RObj mX(&oa);  const RObj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                mX[i] = i;
+            }
+
+            ASSERT(99 == X.begin()->first);
+            ASSERT( 0 == X.rbegin()->first);
+            ASSERT(50 == X.lower_bound(50)->first);
+            ASSERT(49 == X.upper_bound(50)->first);
+            ASSERT(X.end() == X.upper_bound(0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, 'operator[]', AND 'at'
+        //
+        // Concerns:
+        //: 1 'insert' of a value whose key is not present inserts the value
+        //:   and returns an iterator to it and 'true'; otherwise the map is
+        //:   unchanged and the existing element and 'false' are returned.
+        //:
+        //: 2 Hinted 'insert' returns an iterator to the (possibly newly
+        //:   inserted) element for any valid hint.
+        //:
+        //: 3 Range and initializer-list 'insert' insert the values whose keys
+        //:   are not already present.
+        //:
+        //: 4 'operator[]' returns a reference to the mapped value, inserting a
+        //:   default-constructed value if the key is not present.
+        //:
+        //: 5 'at' returns a reference to the mapped value, or throws
+        //:   'std::out_of_range' if the key is not present.
+        //:
+        //: 6 'contains' and 'count' report the presence of a key.
+        //
+        // Plan:
+        //: 1 Insert pseudo-random values into maps using each form of
+        //:   'insert', and into a 'bsl::map' model, and compare the results.
+        //:   (C-1..3)
+        //:
+        //: 2 Use 'operator[]', 'at', 'contains', and 'count' on the resulting
+        //:   maps and verify the results.  (C-4..6)
+        //
+        // Testing:
+        //   bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) value);
+        //   iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) value);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<value_type>);
+        //   VALUE& operator[](FORWARD_REF(KEY_TYPE) key);
+        //   VALUE& at(const KEY&);
+        //   const VALUE& at(const KEY&) const;
+        //   bool contains(const KEY&) const;
+        //   bsl::size_t count(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, 'operator[]', AND 'at'" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZE = 3000;
+
+        if (verbose) cout << "'insert(value)'." << endl;
+        {
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            unsigned int state = 15;
+            for (int i = 0; i < SIZE; ++i) {
+                const int KEY = static_cast<int>(nextRandom(&state) % SIZE);
+
+                const Obj::value_type VALUE(KEY, i);
+
+                bsl::pair<Obj::iterator, bool>   R  = mX.insert(VALUE);
+                bsl::pair<Model::iterator, bool> MR = mA.insert(VALUE);
+
+                ASSERTV(i, MR.second == R.second);
+                ASSERTV(i, KEY == R.first->first);
+                ASSERTV(i, MR.first->second == R.first->second);
+            }
+            ASSERT(matches(X, A));
+
+            for (int key = -1; key <= SIZE; ++key) {
+                ASSERTV(key, A.count(key) == X.count(key));
+                ASSERTV(key, (1 == A.count(key)) == X.contains(key));
+            }
+        }
+
+        if (verbose) cout << "'insert(hint, value)'." << endl;
+        {
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            unsigned int state = 16;
+            for (int i = 0; i < SIZE; ++i) {
+                const int KEY = static_cast<int>(nextRandom(&state) % SIZE);
+
+                // Alternate among a correct hint, 'end()', and an arbitrary
+                // position.
+
+                Obj::const_iterator hint;
+                switch (i % 3) {
+                  case 0: hint = X.lower_bound(KEY); break;
+                  case 1: hint = X.end();            break;
+                  default: hint = X.lower_bound(
+                                     static_cast<int>(nextRandom(&state)
+                                                                   % SIZE));
+                }
+
+                Obj::iterator it = mX.insert(hint, bsl::make_pair(KEY, i));
+                mA.insert(bsl::make_pair(KEY, i));
+
+                ASSERTV(i, KEY == it->first);
+                ASSERTV(i, A.find(KEY)->second == it->second);
+            }
+            ASSERT(matches(X, A));
+        }
+
+        if (verbose) cout << "'insert(first, last)'." << endl;
+        {
+            Model mA(&sa);  const Model& A = mA;
+
+            bsl::vector<bsl::pair<int, int> > values(&sa);
+
+            unsigned int state = 17;
+            for (int i = 0; i < SIZE; ++i) {
+                const int KEY = static_cast<int>(nextRandom(&state) % SIZE);
+
+                values.push_back(bsl::make_pair(KEY, i));
+                mA.insert(bsl::make_pair(KEY, i));
+            }
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.insert(values.begin(), values.end());
+            ASSERT(matches(X, A));
+
+            Obj mY(values.begin(), values.end(), &oa);  const Obj& Y = mY;
+            ASSERT(matches(Y, A));
+
+            // Sorted input, followed by a range overlapping the first.
+
+            Obj mZ(A.begin(), A.end(), &oa);  const Obj& Z = mZ;
+            ASSERT(matches(Z, A));
+
+            mZ.insert(values.begin(), values.end());
+            ASSERT(matches(Z, A));
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) cout << "'insert(initializer_list)'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX[2] = 0;
+            mX.insert({ { 1, 10 }, { 2, 20 }, { 3, 30 }, { 1, 11 } });
+
+            ASSERT(3 == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT( 0 == X.at(2));
+            ASSERT(30 == X.at(3));
+        }
+#endif
+
+        if (verbose) cout << "'operator[]' and 'at'." << endl;
+        {
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            unsigned int state = 18;
+            for (int i = 0; i < SIZE; ++i) {
+                const int KEY = static_cast<int>(nextRandom(&state) % SIZE);
+
+                const bool isNew = 0 == A.count(KEY);
+
+                int& value = mX[KEY];
+                ASSERTV(i, !isNew || 0 == value);
+
+                value += i;
+                mA[KEY] += i;
+            }
+            ASSERT(matches(X, A));
+
+            for (Model::const_iterator it = A.begin(); it != A.end(); ++it) {
+                ASSERTV(it->first, it->second == X.at(it->first));
+                ASSERTV(it->first, it->second == mX.at(it->first));
+                ASSERTV(it->first, &mX.at(it->first) == &X.at(it->first));
+            }
+
+            mX.at(A.begin()->first) = -1;
+            ASSERT(-1 == X.at(A.begin()->first));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            const int ABSENT = -1;
+
+            bool threw = false;
+            try {
+                mX.at(ABSENT);
+            }
+            catch (const bsl::out_of_range&) {
+                threw = true;
+            }
+            ASSERT(threw);
+
+            threw = false;
+            try {
+                X.at(ABSENT);
+            }
+            catch (const bsl::out_of_range&) {
+                threw = true;
+            }
+            ASSERT(threw);
+#endif
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an object having the expected value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 The default constructors allocate no memory.
+        //:
+        //: 3 Memory is allocated only from the object allocator, and is all
+        //:   released on destruction.
+        //:
+        //: 4 The basic accessors return the expected values.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, and verify their values, comparators, allocators, and
+        //:   memory use.  (C-1..4)
+        //
+        // Testing:
+        //   BTreeMap();
+        //   explicit BTreeMap(bslma::Allocator *basicAllocator);
+        //   explicit BTreeMap(const COMPARATOR&, Allocator *bA = 0);
+        //   BTreeMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+        //   BTreeMap(II, II, const COMPARATOR&, Allocator * = 0);
+        //   BTreeMap(initializer_list<value_type>, Allocator * = 0);
+        //   BTreeMap(init_list<vt>, const COMPARATOR&, Allocator * = 0);
+        //   ~BTreeMap();
+        //   bool empty() const;
+        //   COMPARATOR key_comp() const;
+        //   size_t size() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&da == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == da.numBlocksTotal());
+
+            mX[1] = 1;
+            ASSERT(0 < da.numBlocksInUse());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+        {
+            typedef bdlc::BTreeMap<int, int, ReverseIntComparator> RObj;
+
+            ReverseIntComparator comparator;
+
+            RObj mX(comparator, &oa);  const RObj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(X.key_comp()(2, 1));
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+        ASSERT(0 == oa.numBytesInUse());
+
+        {
+            Model mA(&sa);  const Model& A = mA;
+
+            for (int i = 0; i < 500; ++i) {
+                mA[(i * 37) % 500] = i;
+            }
+
+            {
+                Obj mX(A.begin(), A.end(), &oa);  const Obj& X = mX;
+
+                ASSERT(&oa == X.allocator());
+                ASSERT(!X.empty());
+                ASSERT(A.size() == X.size());
+                ASSERT(matches(X, A));
+            }
+            ASSERT(0 == oa.numBytesInUse());
+
+            {
+                bsl::less<int> comparator;
+
+                Obj mX(A.rbegin(), A.rend(), comparator, &oa);
+                const Obj& X = mX;
+
+                ASSERT(&oa == X.allocator());
+                ASSERT(matches(X, A));
+            }
+            ASSERT(0 == oa.numBytesInUse());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ { 3, 30 }, { 1, 10 }, { 3, 31 } }, &oa);
+            const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(2 == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(30 == X.at(3));
+
+            typedef bdlc::BTreeMap<int, int, ReverseIntComparator> RObj;
+
+            RObj mY({ { 1, 10 }, { 2, 20 } }, ReverseIntComparator(), &oa);
+            const RObj& Y = mY;
+
+            ASSERT(2 == Y.begin()->first);
+        }
+        ASSERT(0 == oa.numBytesInUse());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert, find, and erase elements, and iterate.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.empty());
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(mX.insert(bsl::make_pair(100 - i, i)).second);
+        }
+        ASSERT(100 == X.size());
+        ASSERT(!mX.insert(bsl::make_pair(1, 0)).second);
+
+        int expected = 1;
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            ASSERTV(expected, expected == it->first);
+            ASSERTV(expected, 100 - expected == it->second);
+            ++expected;
+        }
+
+        ASSERT(1 == mX.erase(50));
+        ASSERT(0 == mX.erase(50));
+        ASSERT(X.end() == X.find(50));
+        ASSERT(51 == X.lower_bound(50)->first);
+        ASSERT(100 == X.rbegin()->first);
+
+        mX[50] = 7;
+        ASSERT(7 == X.at(50));
+        ASSERT(100 == X.size());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare 'bdlc::BTreeMap' to 'bsl::map'.
+        //
+        // Concerns:
+        //: 1 'bdlc::BTreeMap' can outperform 'bsl::map' for 'insert', 'find',
+        //:   and iteration.
+        //:
+        //: 2 'bdlc::BTreeMap' uses less memory than 'bsl::map'.
+        //
+        // Plan:
+        //: 1 For maps of sizes from 1,000 to 1,000,000 'int' keys, time the
+        //:   insertion of keys in random and in sorted order, 'find' for keys
+        //:   present and absent, and iteration, and report the times and the
+        //:   memory in use for each container.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bslma::NewDeleteAllocator    na;
+        bslma::DefaultAllocatorGuard dag(&na);
+
+        const int SIZES[] = { 1000, 100000, 1000000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        const bsl::ios_base::fmtflags flags = cout.flags();
+
+        cout << bsl::fixed << bsl::setprecision(1);
+
+        cout << "     size      container   insert(random)  insert(sorted)"
+                "   find(hit)  find(miss)     iterate   bytes/elem  (ns/op)"
+             << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE = SIZES[si];
+
+            bsl::vector<int> randomKeys;
+            bsl::vector<int> sortedKeys;
+            bsl::vector<int> absentKeys;
+
+            unsigned int state = 19;
+            for (int i = 0; i < SIZE; ++i) {
+                sortedKeys.push_back(2 * i);
+                absentKeys.push_back(2 * i + 1);
+            }
+            randomKeys = sortedKeys;
+            for (int i = SIZE - 1; 0 < i; --i) {
+                bsl::swap(randomKeys[i],
+                          randomKeys[nextRandom(&state) % (i + 1)]);
+            }
+            bsl::vector<int> lookupKeys(randomKeys);
+            for (int i = SIZE - 1; 0 < i; --i) {
+                bsl::swap(lookupKeys[i],
+                          lookupKeys[nextRandom(&state) % (i + 1)]);
+            }
+
+            for (int container = 0; container < 2; ++container) {
+                bslma::TestAllocator ta("bytes");
+
+                double insertRandom, insertSorted, findHit, findMiss;
+                double iterate, bytes;
+
+                if (0 == container) {
+                    bdlc::BTreeMap<int, int> mX(&ta);
+                    bdlc::BTreeMap<int, int> mY(&na);
+
+                    insertRandom = nanoseconds(
+                                           performanceInsert(&mX, randomKeys));
+                    insertSorted = nanoseconds(
+                                           performanceInsert(&mY, sortedKeys));
+                    findHit      = nanoseconds(
+                                             performanceFind(mX, lookupKeys));
+                    findMiss     = nanoseconds(
+                                             performanceFind(mX, absentKeys));
+                    iterate      = nanoseconds(performanceIterate(mX));
+                    bytes        = static_cast<double>(ta.numBytesInUse());
+                }
+                else {
+                    bsl::map<int, int> mX(&ta);
+                    bsl::map<int, int> mY(&na);
+
+                    insertRandom = nanoseconds(
+                                           performanceInsert(&mX, randomKeys));
+                    insertSorted = nanoseconds(
+                                           performanceInsert(&mY, sortedKeys));
+                    findHit      = nanoseconds(
+                                             performanceFind(mX, lookupKeys));
+                    findMiss     = nanoseconds(
+                                             performanceFind(mX, absentKeys));
+                    iterate      = nanoseconds(performanceIterate(mX));
+                    bytes        = static_cast<double>(ta.numBytesInUse());
+                }
+
+                cout << bsl::setw(9)  << SIZE
+                     << bsl::setw(15) << (0 == container ? "BTreeMap"
+                                                         : "bsl::map")
+                     << bsl::setw(17) << insertRandom / SIZE
+                     << bsl::setw(16) << insertSorted / SIZE
+                     << bsl::setw(12) << findHit      / SIZE
+                     << bsl::setw(12) << findMiss     / SIZE
+                     << bsl::setw(12) << iterate      / SIZE
+                     << bsl::setw(13) << bytes        / SIZE
+                     << endl;
+            }
+        }
+
+        cout.flags(flags);
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    LOOP_ASSERT(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
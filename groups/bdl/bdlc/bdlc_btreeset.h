@@ -0,0 +1,1148 @@
+// bdlc_btreeset.h                                                    -*-C++-*-
+#ifndef INCLUDED_BDLC_BTREESET
+#define INCLUDED_BDLC_BTREESET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cache-friendly ordered set container.
+//
+//@CLASSES:
+//   bdlc::BTreeSet: B-tree based ordered set container
+//
+//@SEE_ALSO: bdlc_btree, bdlc_btreemap, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::BTreeSet', that implements an ordered set of unique values stored in
+// a B-tree.
+//
+// 'bsl::set' stores each element in its own red-black tree node, whereas
+// 'bdlc::BTreeSet' stores many elements contiguously in each node, with nodes
+// sized to a few cache lines (see {'bdlc_btree'}).  A large 'bdlc::BTreeSet'
+// is therefore only a few levels deep, uses a fraction of the memory of a
+// 'bsl::set', and is iterated mostly sequentially through memory, so that
+// 'bdlc::BTreeSet' generally exhibits better performance than 'bsl::set' for
+// lookups, iteration, and insertion, particularly for sets too large for the
+// data cache and for small element types.
+//
+// An instantiation of 'bdlc::BTreeSet' is an allocator-aware, value-semantic
+// type whose salient attributes are the sequence of values contained, in
+// order.  An instantiation may be provided with a custom comparison functor,
+// but it is not a salient attribute.  In particular, when comparing element
+// values for equality between two different 'bdlc::BTreeSet' objects, the
+// elements are compared using 'operator=='.
+//
+///Interface Differences with 'set'
+///--------------------------------
+// A 'bdlc::BTreeSet' meets most of the requirements of an associative
+// container with bidirectional iterators in the C++11 Standard [23.2.4].  The
+// elements of a 'bdlc::BTreeSet' are moved within and between nodes when the
+// set is modified, so that (unlike in a 'bsl::set') the insertion or erasure
+// of any element invalidates all iterators, pointers, and references to
+// elements of the set.  Allocator use follows BDE style, and the various
+// allocator propagation attributes are not present (e.g., the allocator trait
+// 'propagate_on_container_copy_assignment').
+//
+///Bulk Loading
+///------------
+// Inserting values in increasing order at the end of the set (e.g., by
+// constructing a set from, or calling 'insert' with, a sorted range, or by
+// calling 'insert' with 'end()' as the hint) takes amortized constant time per
+// element, as no search is needed, and leaves the nodes of the set nearly
+// full, so that the set uses the least memory and is fastest to search and to
+// iterate.
+//
+///Requirements on 'KEY' and 'COMPARATOR'
+///--------------------------------------
+// The template parameter type 'KEY' must be copy or move constructible, and
+// its move constructor must not throw when the source and destination use the
+// same allocator.  The template parameter type 'COMPARATOR' must be a default
+// and copy constructible function object defining a strict weak ordering on
+// 'KEY' values, compatible with the following statements for objects 'key1'
+// and 'key2' of type 'KEY':
+//..
+//  COMPARATOR comparator;
+//  bool       result = comparator(key1, key2);
+//..
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any manipulator that inserts or erases an element invalidates all pointers,
+// references, and iterators to elements of the set.  Note that the iterator
+// returned by a manipulator is valid.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::BTreeSet' is exception neutral.  The insertion of a single element
+// provides the strong exception safety guarantee, and all other methods
+// provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Allocating Identifiers
+///- - - - - - - - - - - - - - - - -
+// Suppose a server assigns each new connection the smallest identifier, at or
+// above a given floor, that is not in use.  The identifiers in use are kept in
+// a 'bdlc::BTreeSet', which allows the gaps between them to be found by
+// iterating in order.
+//
+// First, we define a function that finds the smallest unused identifier:
+//..
+//  int smallestUnused(const bdlc::BTreeSet<int>& inUse, int floor)
+//      // Return the smallest identifier not less than the specified 'floor'
+//      // that is not in the specified 'inUse' set.
+//  {
+//      int candidate = floor;
+//
+//      for (bdlc::BTreeSet<int>::const_iterator it =
+//                                                    inUse.lower_bound(floor);
+//           it != inUse.end() && *it == candidate;
+//           ++it) {
+//          ++candidate;
+//      }
+//
+//      return candidate;
+//  }
+//..
+// Then, we create the set of identifiers in use:
+//..
+//  bdlc::BTreeSet<int> inUse;
+//
+//  for (int id = 100; id < 110; ++id) {
+//      inUse.insert(inUse.end(), id);
+//  }
+//  inUse.erase(104);
+//..
+// Finally, we allocate a few identifiers:
+//..
+//  assert( 99 == smallestUnused(inUse,  99));
+//  assert(104 == smallestUnused(inUse, 100));
+//  inUse.insert(104);
+//  assert(110 == smallestUnused(inUse, 100));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_btree.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_platform.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_iterator.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY, class COMPARATOR = bsl::less<KEY> >
+class BTreeSet;
+
+template <class KEY, class COMPARATOR>
+bool operator==(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+void swap(BTreeSet<KEY, COMPARATOR>& a, BTreeSet<KEY, COMPARATOR>& b);
+
+                        // =========================
+                        // struct BTreeSet_EntryUtil
+                        // =========================
+
+template <class ENTRY>
+struct BTreeSet_EntryUtil
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY' (which is, identically, the
+    // 'ENTRY').
+{
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Load into the specified 'entry' the 'ENTRY' value comprised of the
+        // specified 'key', using the specified 'allocator' to supply memory.
+        // 'allocator' is ignored if the (template parameter) type 'ENTRY' is
+        // not allocator aware.
+
+    static const ENTRY& key(const ENTRY& entry);
+        // Return the specified 'entry'.
+};
+
+                               // ==============
+                               // class BTreeSet
+                               // ==============
+
+template <class KEY, class COMPARATOR>
+class BTreeSet {
+    // This class template implements a value-semantic container type holding
+    // an ordered set of unique values of (template parameter) type 'KEY'.  The
+    // (template parameter) type 'COMPARATOR' is a functor defining the order
+    // of two 'KEY' values.  See {Requirements on 'KEY' and 'COMPARATOR'} for
+    // more information.
+
+  private:
+    // PRIVATE TYPES
+    typedef BTree<KEY, KEY, BTreeSet_EntryUtil<KEY>, COMPARATOR> ImplType;
+        // This is the underlying implementation class.
+
+    // FRIENDS
+    friend bool operator==<>(const BTreeSet&, const BTreeSet&);
+    friend bool operator!=<>(const BTreeSet&, const BTreeSet&);
+
+    // The following verbose declaration is required by the xlC 12.1 compiler.
+    template <class K, class C>
+    friend void swap(BTreeSet<K, C>&, BTreeSet<K, C>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef bsl::size_t                                size_type;
+    typedef bsl::ptrdiff_t                             difference_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+    typedef value_type*                                pointer;
+    typedef const value_type*                          const_pointer;
+    typedef typename ImplType::const_iterator          iterator;
+    typedef typename ImplType::const_iterator          const_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying B-tree used by this set
+
+  public:
+    // CREATORS
+    BTreeSet();
+    explicit BTreeSet(bslma::Allocator *basicAllocator);
+    explicit BTreeSet(const COMPARATOR&  comparator,
+                      bslma::Allocator  *basicAllocator = 0);
+        // Create an empty 'BTreeSet' object.  Optionally specify a
+        // 'comparator' used to order the elements of this container.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    BTreeSet(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    BTreeSet(INPUT_ITERATOR     first,
+             INPUT_ITERATOR     last,
+             const COMPARATOR&  comparator,
+             bslma::Allocator  *basicAllocator = 0);
+        // Create a 'BTreeSet' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'comparator' used to order the elements of this container.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.  Note that if a member of the input sequence is
+        // equivalent to an earlier member, the later member will not be
+        // inserted.  Also note that a sorted range is loaded in linear time
+        // (see {Bulk Loading}).
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeSet(bsl::initializer_list<KEY>  values,
+             bslma::Allocator           *basicAllocator = 0);
+    BTreeSet(bsl::initializer_list<KEY>  values,
+             const COMPARATOR&           comparator,
+             bslma::Allocator           *basicAllocator = 0);
+        // Create a 'BTreeSet' object initialized by insertion of the specified
+        // 'values'.  Optionally specify a 'comparator' used to order the
+        // elements of this container.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.  Note that if a
+        // member of 'values' is equivalent to an earlier member, the later
+        // member will not be inserted.
+#endif
+
+    BTreeSet(const BTreeSet& original, bslma::Allocator *basicAllocator = 0);
+        // Create a 'BTreeSet' object having the same value and comparator as
+        // the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified or is 0, the currently installed default allocator is
+        // used.
+
+    BTreeSet(bslmf::MovableRef<BTreeSet> original);
+        // Create a 'BTreeSet' object having the same value, comparator, and
+        // allocator as the specified 'original' object.  The contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, and no exceptions will be
+        // thrown.
+
+    BTreeSet(bslmf::MovableRef<BTreeSet>  original,
+             bslma::Allocator            *basicAllocator);
+        // Create a 'BTreeSet' object having the same value and comparator as
+        // the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The allocator of
+        // 'original' remains unchanged.  If 'original' and the newly created
+        // object have the same allocator then the contents of 'original' are
+        // moved (in constant time) to this object, and no exceptions will be
+        // thrown; otherwise the elements of 'original' are moved into this
+        // object (and an exception may be thrown).  In either case 'original'
+        // is left in a (valid) unspecified state.
+
+    ~BTreeSet();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    BTreeSet& operator=(const BTreeSet& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    BTreeSet& operator=(bslmf::MovableRef<BTreeSet> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If this object and 'rhs' use the same allocator the
+        // contents of 'rhs' are moved (in constant time) to this object.
+        // 'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeSet& operator=(bsl::initializer_list<KEY> values);
+        // Assign to this object the value resulting from first clearing this
+        // set and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects equivalent to one that
+        // appears earlier in the list; return a reference providing
+        // modifiable access to this object.
+#endif
+
+    void clear();
+        // Remove all elements from this set and release all memory held by
+        // this set.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this set the element equivalent to the specified 'key',
+        // if it exists, and return 1; otherwise (there is no such element in
+        // this set), return 0 with no other effect.  If an element is removed,
+        // this method invalidates all iterators and references to elements of
+        // this set.
+
+    const_iterator erase(const_iterator position);
+        // Remove from this set the element at the specified 'position', and
+        // return a 'const_iterator' referring to the element immediately
+        // following the removed element, or to the past-the-end position if
+        // the removed element was the last element in the sequence of elements
+        // maintained by this set.  This method invalidates all other iterators
+        // and references to elements of this set.  The behavior is undefined
+        // unless 'position' refers to an element in this set.
+
+    const_iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referencing the same element as 'last'.  This
+        // method invalidates all other iterators and references to elements of
+        // this set.  The behavior is undefined unless 'first' and 'last' are
+        // valid iterators on this set, and the 'first' position is at or
+        // before the 'last' position in the iteration sequence provided by
+        // this container.
+
+#if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
+    template <class KEY_TYPE>
+    bsl::pair<const_iterator, bool> insert(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) value)
+#else
+    template <class KEY_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<KEY_TYPE, KEY>::value,
+                            bsl::pair<const_iterator, bool> >::type
+                      insert(BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) value)
+#endif
+        // Insert the specified 'value' into this set if the 'value' does not
+        // already exist in this set; otherwise, this method has no effect.
+        // Return a 'pair' whose 'first' member is a 'const_iterator' referring
+        // to the (possibly newly inserted) element in this set whose value is
+        // equivalent to that of the element to be inserted, and whose 'second'
+        // member is 'true' if a new element was inserted, and 'false' if an
+        // equivalent value was already present.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insert(BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, value));
+    }
+
+#if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
+    template <class KEY_TYPE>
+    const_iterator insert(const_iterator                              hint,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) value)
+#else
+    template <class KEY_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<KEY_TYPE, KEY>::value,
+                            const_iterator>::type
+                      insert(const_iterator                              hint,
+                             BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) value)
+#endif
+        // Insert the specified 'value' into this set if the 'value' does not
+        // already exist in this set; otherwise, this method has no effect.
+        // Return a 'const_iterator' referring to the (possibly newly inserted)
+        // element in this set whose value is equivalent to that of the
+        // element to be inserted.  If 'value' belongs immediately before the
+        // specified 'hint', it is inserted there in amortized constant time;
+        // otherwise 'hint' is ignored.  The behavior is undefined unless
+        // 'hint' is a valid iterator on this set.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insert(hint,
+                             BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, value));
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last').  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that if a member of the input
+        // sequence is equivalent to an earlier member, the later member will
+        // not be inserted.  Also note that a sorted range, whose values follow
+        // those of this set, is inserted in linear time (see {Bulk Loading}).
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<KEY> values);
+        // Insert into this set the value of each object in the specified
+        // 'values' initializer list if an equivalent value is not already
+        // contained in this set.
+#endif
+
+                             // Aspects
+
+    void swap(BTreeSet& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  The behavior is undefined
+        // unless this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains an element equivalent to the
+        // specified 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this set equivalent to the
+        // specified 'key'.  Note that since a set maintains unique values, the
+        // returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this set equivalent to the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // set contains no elements equivalent to 'key', then the two returned
+        // iterators will have the same value.  Note that since a set maintains
+        // unique values, the range will contain at most one element.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the element in this set
+        // equivalent to the specified 'key', or 'end()' if no such element
+        // exists in this set.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the comparison functor used by this set to order
+        // values.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this set
+        // not ordered before the specified 'key', or 'end()' if there is no
+        // such element.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this set
+        // ordered after the specified 'key', or 'end()' if there is no such
+        // element.
+
+    COMPARATOR value_comp() const;
+        // Return (a copy of) the comparison functor used by this set to order
+        // values.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return a 'const_iterator' to the first element in the sequence of
+        // elements maintained by this set, or the 'end' iterator if this set
+        // is empty.
+
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' to the first element in the sequence of
+        // elements maintained by this set, or the 'end' iterator if this set
+        // is empty.
+
+    const_iterator cend() const;
+        // Return a 'const_iterator' to the past-the-end element in the
+        // sequence of elements maintained by this set.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse 'const_iterator' to the last element in the
+        // sequence of elements maintained by this set, or 'crend()' if this
+        // set is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse 'const_iterator' to the prior-to-the-beginning
+        // element in the sequence of elements maintained by this set.
+
+    const_iterator end() const;
+        // Return a 'const_iterator' to the past-the-end element in the
+        // sequence of elements maintained by this set.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse 'const_iterator' to the last element in the
+        // sequence of elements maintained by this set, or 'rend()' if this set
+        // is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse 'const_iterator' to the prior-to-the-beginning
+        // element in the sequence of elements maintained by this set.
+
+                           // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level', and return a
+        // reference to the modifiable 'stream'.  If 'level' is specified,
+        // optionally specify 'spacesPerLevel', the number of spaces per
+        // indentation level for this and all of its nested objects.  If
+        // 'level' is negative, suppress indentation of the first line.  If
+        // 'spacesPerLevel' is negative, format the entire output on one line,
+        // suppressing all but the initial indentation (as governed by
+        // 'level').  If 'stream' is not valid on entry, this operation has no
+        // effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+bool operator==(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'BTreeSet' objects have the same
+    // value if their sizes are the same and each element of one is equal to
+    // the element at the same position, in order, of the other.  The
+    // comparators are not involved in the comparison.
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'BTreeSet' objects do not have
+    // the same value if their sizes are different or some element of one is
+    // not equal to the element at the same position, in order, of the other.
+    // The comparators are not involved in the comparison.
+
+template <class KEY, class COMPARATOR>
+bool operator<(const BTreeSet<KEY, COMPARATOR>& lhs,
+               const BTreeSet<KEY, COMPARATOR>& rhs);
+template <class KEY, class COMPARATOR>
+bool operator>(const BTreeSet<KEY, COMPARATOR>& lhs,
+               const BTreeSet<KEY, COMPARATOR>& rhs);
+template <class KEY, class COMPARATOR>
+bool operator<=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+template <class KEY, class COMPARATOR>
+bool operator>=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than, greater than, less than or equal to, or
+    // greater than or equal to (respectively) the value of the specified
+    // 'rhs' set, and 'false' otherwise.  The sequences of elements are
+    // compared using 'operator<'.  The comparators are not involved in the
+    // comparison.
+
+template <class KEY, class COMPARATOR>
+bsl::ostream& operator<<(bsl::ostream&                    stream,
+                         const BTreeSet<KEY, COMPARATOR>& set);
+    // Write the value of the specified 'set' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+void swap(BTreeSet<KEY, COMPARATOR>& a, BTreeSet<KEY, COMPARATOR>& b);
+    // Exchange the value and the comparator of the specified 'a' and 'b'
+    // objects.  This function provides the no-throw exception-safety
+    // guarantee if the two objects were created with the same allocator and
+    // the basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -------------------------
+                        // struct BTreeSet_EntryUtil
+                        // -------------------------
+
+// CLASS METHODS
+template <class ENTRY>
+template <class KEY_TYPE>
+inline
+void BTreeSet_EntryUtil<ENTRY>::construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(
+                                 entry,
+                                 allocator,
+                                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+}
+
+template <class ENTRY>
+inline
+const ENTRY& BTreeSet_EntryUtil<ENTRY>::key(const ENTRY& entry)
+{
+    return entry;
+}
+
+                               // --------------
+                               // class BTreeSet
+                               // --------------
+
+// CREATORS
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet()
+: d_impl(COMPARATOR())
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(const COMPARATOR&  comparator,
+                                    bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(INPUT_ITERATOR    first,
+                                    INPUT_ITERATOR    last,
+                                    bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(INPUT_ITERATOR     first,
+                                    INPUT_ITERATOR     last,
+                                    const COMPARATOR&  comparator,
+                                    bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(
+                                    bsl::initializer_list<KEY>  values,
+                                    bslma::Allocator           *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(
+                                    bsl::initializer_list<KEY>  values,
+                                    const COMPARATOR&           comparator,
+                                    bslma::Allocator           *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(const BTreeSet&   original,
+                                    bslma::Allocator *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(bslmf::MovableRef<BTreeSet> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(
+                                   bslmf::MovableRef<BTreeSet>  original,
+                                   bslma::Allocator            *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                              bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::~BTreeSet()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>&
+BTreeSet<KEY, COMPARATOR>::operator=(const BTreeSet& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>&
+BTreeSet<KEY, COMPARATOR>::operator=(bslmf::MovableRef<BTreeSet> rhs)
+{
+    BTreeSet& lvalue = rhs;
+
+    d_impl = bslmf::MovableRefUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>&
+BTreeSet<KEY, COMPARATOR>::operator=(bsl::initializer_list<KEY> values)
+{
+    BTreeSet tmp(values.begin(),
+                 values.end(),
+                 d_impl.key_comp(),
+                 d_impl.allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+void BTreeSet<KEY, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeSet<KEY, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::erase(const_iterator first, const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void BTreeSet<KEY, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                       INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+void BTreeSet<KEY, COMPARATOR>::insert(bsl::initializer_list<KEY> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+                             // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+void BTreeSet<KEY, COMPARATOR>::swap(BTreeSet& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR>
+inline
+bool BTreeSet<KEY, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeSet<KEY, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool BTreeSet<KEY, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename BTreeSet<KEY, COMPARATOR>::const_iterator,
+          typename BTreeSet<KEY, COMPARATOR>::const_iterator>
+BTreeSet<KEY, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+COMPARATOR BTreeSet<KEY, COMPARATOR>::key_comp() const
+{
+    return d_impl.key_comp();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeSet<KEY, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upper_bound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+COMPARATOR BTreeSet<KEY, COMPARATOR>::value_comp() const
+{
+    return d_impl.key_comp();
+}
+
+                          // Iterators
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::cbegin() const
+{
+    return d_impl.cbegin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::cend() const
+{
+    return d_impl.cend();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeSet<KEY, COMPARATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeSet<KEY, COMPARATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeSet<KEY, COMPARATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeSet<KEY, COMPARATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+                           // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+bslma::Allocator *BTreeSet<KEY, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class COMPARATOR>
+bsl::ostream& BTreeSet<KEY, COMPARATOR>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    const_iterator iter = begin();
+    while (iter != end()) {
+        printer.printValue(*iter);
+        ++iter;
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator==(const BTreeSet<KEY, COMPARATOR>& lhs,
+                      const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator!=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                      const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_impl != rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator<(const BTreeSet<KEY, COMPARATOR>& lhs,
+                     const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return bsl::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator>(const BTreeSet<KEY, COMPARATOR>& lhs,
+                     const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator<=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                      const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator>=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                      const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                    stream,
+                               const BTreeSet<KEY, COMPARATOR>& set)
+{
+    return set.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+inline
+void bdlc::swap(BTreeSet<KEY, COMPARATOR>& a, BTreeSet<KEY, COMPARATOR>& b)
+{
+    bslalg::SwapUtil::swap(&a.d_impl, &b.d_impl);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR>
+struct HasStlIterators<bdlc::BTreeSet<KEY, COMPARATOR> > : bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::BTreeSet<KEY, COMPARATOR> > : bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1026 @@
+// bdlc_btreeset.t.cpp                                                -*-C++-*-
+
+#include <bdlc_btreeset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_set.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a container implementing an ordered set
+// stored in a B-tree.  The general concerns are correctness, exception
+// safety, and proper dispatching.  The B-tree itself is verified by the test
+// driver of 'bdlc_btree', so for all of the object's functionality except
+// 'print', 'operator<<', the reverse iterators, and the relational operators,
+// this simplifies to verifying the forwarding to the implementation object
+// 'bdlc::BTree'.  Each test compares the object under test against a
+// 'bsl::set' model.
+//
+// Primary Manipulators:
+//: o 'clear'
+//: o 'erase(key)'
+//: o 'insert'
+//
+// Basic Accessors:
+//: o 'allocator'
+//: o 'begin'
+//: o 'end'
+//: o 'key_comp'
+//: o 'size'
+//
+// Certain standard value-semantic-type test cases are omitted:
+//: o BDEX
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BTreeSet();
+// [ 2] explicit BTreeSet(bslma::Allocator *basicAllocator);
+// [ 2] explicit BTreeSet(const COMPARATOR&, Allocator *basicAllocator = 0);
+// [ 2] BTreeSet(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+// [ 2] BTreeSet(II, II, const COMPARATOR&, Allocator * = 0);
+// [ 2] BTreeSet(initializer_list<KEY>, Allocator * = 0);
+// [ 2] BTreeSet(init_list<KEY>, const COMPARATOR&, Allocator * = 0);
+// [ 5] BTreeSet(const BTreeSet&, Allocator *basicAllocator = 0);
+// [ 5] BTreeSet(BTreeSet&&);
+// [ 5] BTreeSet(BTreeSet&&, Allocator *basicAllocator);
+// [ 2] ~BTreeSet();
+//
+// MANIPULATORS
+// [ 5] BTreeSet& operator=(const BTreeSet&);
+// [ 5] BTreeSet& operator=(BTreeSet&&);
+// [ 5] BTreeSet& operator=(initializer_list<KEY>);
+// [ 3] void clear();
+// [ 3] size_t erase(const KEY&);
+// [ 3] const_iterator erase(const_iterator);
+// [ 3] const_iterator erase(const_iterator, const_iterator);
+// [ 3] bsl::pair<const_iterator, bool> insert(FORWARD_REF(KEY_TYPE) value);
+// [ 3] const_iterator insert(const_iterator, FORWARD_REF(KEY_TYPE) value);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<KEY>);
+// [ 5] void swap(BTreeSet&);
+//
+// ACCESSORS
+// [ 4] bool contains(const KEY&) const;
+// [ 4] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 4] bsl::pair<ci, ci> equal_range(const KEY&) const;
+// [ 4] const_iterator find(const KEY&) const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 4] const_iterator lower_bound(const KEY&) const;
+// [ 2] size_t size() const;
+// [ 4] const_iterator upper_bound(const KEY&) const;
+// [ 2] COMPARATOR value_comp() const;
+//
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_reverse_iterator crbegin() const;
+// [ 4] const_reverse_iterator crend() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_reverse_iterator rbegin() const;
+// [ 4] const_reverse_iterator rend() const;
+//
+// [ 2] Allocator *allocator() const;
+// [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const BTreeSet&, const BTreeSet&);
+// [ 5] bool operator!=(const BTreeSet&, const BTreeSet&);
+// [ 5] bool operator<(const BTreeSet&, const BTreeSet&);
+// [ 5] bool operator>(const BTreeSet&, const BTreeSet&);
+// [ 5] bool operator<=(const BTreeSet&, const BTreeSet&);
+// [ 5] bool operator>=(const BTreeSet&, const BTreeSet&);
+// [ 5] ostream& operator<<(ostream&, const BTreeSet&);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(BTreeSet&, BTreeSet&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                    GLOBAL TYPEDEFS AND HELPERS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::BTreeSet<int> Obj;
+typedef bsl::set<int>       Model;
+
+static unsigned int nextRandom(unsigned int *state)
+    // Return the next value of a pseudo-random sequence whose state is held
+    // in the specified 'state', and update 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xffffff;
+}
+
+template <class SET, class MODEL>
+bool matches(const SET& set, const MODEL& model)
+    // Return 'true' if the specified 'set' has the same sequence of elements,
+    // in both forward and reverse order, as the specified 'model', and
+    // 'false' otherwise.
+{
+    return set.size() == model.size()
+        && bsl::equal(set.begin(), set.end(), model.begin())
+        && bsl::equal(set.rbegin(), set.rend(), model.rbegin());
+}
+
+static void loadRandom(Obj          *set,
+                       Model        *model,
+                       int           numValues,
+                       int           range,
+                       unsigned int  seed)
+    // Insert into the specified 'set' and 'model' the specified 'numValues'
+    // pseudo-random values in the range '[0, range)', generated from the
+    // specified 'seed'.
+{
+    unsigned int state = seed;
+
+    for (int i = 0; i < numValues; ++i) {
+        const int VALUE = static_cast<int>(nextRandom(&state) % range);
+
+        set->insert(VALUE);
+        model->insert(VALUE);
+    }
+}
+
+                       // =============================
+                       // struct ReverseIntComparator
+                       // =============================
+
+struct ReverseIntComparator {
+    // This comparator orders integers in decreasing order.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Allocating Identifiers
+///- - - - - - - - - - - - - - - - -
+// Suppose a server assigns each new connection the smallest identifier, at or
+// above a given floor, that is not in use.  The identifiers in use are kept in
+// a 'bdlc::BTreeSet', which allows the gaps between them to be found by
+// iterating in order.
+//
+// First, we define a function that finds the smallest unused identifier:
+//..
+    int smallestUnused(const bdlc::BTreeSet<int>& inUse, int floor)
+        // Return the smallest identifier not less than the specified 'floor'
+        // that is not in the specified 'inUse' set.
+    {
+        int candidate = floor;
+
+        for (bdlc::BTreeSet<int>::const_iterator it =
+                                                      inUse.lower_bound(floor);
+             it != inUse.end() && *it == candidate;
+             ++it) {
+            ++candidate;
+        }
+
+        return candidate;
+    }
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("usage", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+//..
+// Then, we create the set of identifiers in use:
+//..
+        bdlc::BTreeSet<int> inUse;
+
+        for (int id = 100; id < 110; ++id) {
+            inUse.insert(inUse.end(), id);
+        }
+        inUse.erase(104);
+//..
+// Finally, we allocate a few identifiers:
+//..
+        ASSERT( 99 == smallestUnused(inUse,  99));
+        ASSERT(104 == smallestUnused(inUse, 100));
+        inUse.insert(104);
+        ASSERT(110 == smallestUnused(inUse, 100));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS AND PRINT
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment, and 'swap', produce
+        //:   objects having the expected values and allocators.
+        //:
+        //: 2 The equality and relational operators compare the sequences of
+        //:   elements consistently with 'bsl::set'.
+        //:
+        //: 3 'print' and 'operator<<' write the elements in order in the
+        //:   format of 'bslim::Printer'.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Copy, move, assign, and swap pseudo-random sets, with the same
+        //:   and different allocators, and verify the results.  (C-1)
+        //:
+        //: 2 Verify the relational operators against 'bsl::set' models for
+        //:   pairs of pseudo-random sets.  (C-2)
+        //:
+        //: 3 Compare the output of 'print' and 'operator<<' to expected
+        //:   strings.  (C-3)
+        //:
+        //: 4 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   BTreeSet(const BTreeSet&, Allocator *basicAllocator = 0);
+        //   BTreeSet(BTreeSet&&);
+        //   BTreeSet(BTreeSet&&, Allocator *basicAllocator);
+        //   BTreeSet& operator=(const BTreeSet&);
+        //   BTreeSet& operator=(BTreeSet&&);
+        //   BTreeSet& operator=(initializer_list<KEY>);
+        //   void swap(BTreeSet&);
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   bool operator==(const BTreeSet&, const BTreeSet&);
+        //   bool operator!=(const BTreeSet&, const BTreeSet&);
+        //   bool operator<(const BTreeSet&, const BTreeSet&);
+        //   bool operator>(const BTreeSet&, const BTreeSet&);
+        //   bool operator<=(const BTreeSet&, const BTreeSet&);
+        //   bool operator>=(const BTreeSet&, const BTreeSet&);
+        //   ostream& operator<<(ostream&, const BTreeSet&);
+        //   void swap(BTreeSet&, BTreeSet&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS AND PRINT" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 2, 40, 400 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                Obj   mX(&oa);  const Obj& X = mX;
+                Obj   mY(&oa);  const Obj& Y = mY;
+                Model mA(&sa);  const Model& A = mA;
+                Model mB(&sa);  const Model& B = mB;
+
+                loadRandom(&mX, &mA, SIZES[i], 2 * SIZES[i] + 1, 1);
+                loadRandom(&mY, &mB, SIZES[j], 2 * SIZES[j] + 1, 2);
+
+                ASSERTV(i, j, (A == B) == (X == Y));
+                ASSERTV(i, j, (A != B) == (X != Y));
+                ASSERTV(i, j, (A <  B) == (X <  Y));
+                ASSERTV(i, j, (A >  B) == (X >  Y));
+                ASSERTV(i, j, (A <= B) == (X <= Y));
+                ASSERTV(i, j, (A >= B) == (X >= Y));
+
+                {
+                    Obj mZ(X, &za);  const Obj& Z = mZ;
+
+                    ASSERTV(i, j, X == Z);
+                    ASSERTV(i, j, &za == Z.allocator());
+
+                    ASSERTV(i, j, &mZ == &(mZ = Y));
+                    ASSERTV(i, j, matches(Z, B));
+                    ASSERTV(i, j, &za == Z.allocator());
+                }
+                {
+                    Obj mW(X, &oa);
+
+                    const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                    Obj mZ(bslmf::MovableRefUtil::move(mW));
+                    const Obj& Z = mZ;
+
+                    ASSERTV(i, j, NUM_BLOCKS == oa.numBlocksTotal());
+                    ASSERTV(i, j, matches(Z, A));
+
+                    Obj mV(Y, &oa);
+
+                    ASSERTV(i, j,
+                            &mZ == &(mZ = bslmf::MovableRefUtil::move(mV)));
+                    ASSERTV(i, j, matches(Z, B));
+                }
+                {
+                    Obj mW(X, &oa);
+
+                    Obj mZ(bslmf::MovableRefUtil::move(mW), &za);
+                    const Obj& Z = mZ;
+
+                    ASSERTV(i, j, &za == Z.allocator());
+                    ASSERTV(i, j, matches(Z, A));
+                }
+                {
+                    Obj mW(X, &oa);  const Obj& W = mW;
+                    Obj mZ(Y, &oa);  const Obj& Z = mZ;
+
+                    mW.swap(mZ);
+                    ASSERTV(i, j, matches(W, B));
+                    ASSERTV(i, j, matches(Z, A));
+
+                    Obj mV(X, &za);  const Obj& V = mV;
+
+                    swap(mV, mZ);
+                    ASSERTV(i, j, matches(V, A));
+                    ASSERTV(i, j, matches(Z, A));
+
+                    swap(mV, mW);
+                    ASSERTV(i, j, matches(V, B));
+                    ASSERTV(i, j, matches(W, A));
+                    ASSERTV(i, j, &za == V.allocator());
+                    ASSERTV(i, j, &oa == W.allocator());
+                }
+            }
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.insert(7);
+
+            ASSERT(&mX == &(mX = { 3, 1, 3 }));
+            ASSERT(2 == X.size());
+            ASSERT(1 == *X.begin());
+            ASSERT(!X.contains(7));
+        }
+#endif
+
+        if (verbose) cout << "'print' and 'operator<<'." << endl;
+        {
+            bslma::TestAllocator         da("temporary default",
+                                            veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            {
+                bsl::ostringstream os;
+
+                ASSERT(&os == &(os << X));
+                ASSERTV(os.str(), "[ ]" == os.str());
+            }
+
+            mX.insert(3);
+            mX.insert(1);
+            mX.insert(2);
+
+            {
+                bsl::ostringstream os;
+
+                ASSERT(&os == &(os << X));
+                ASSERTV(os.str(), "[ 1 2 3 ]" == os.str());
+            }
+            {
+                bsl::ostringstream os;
+
+                ASSERT(&os == &X.print(os, 1, 2));
+                ASSERTV(os.str(),
+                        "  [\n    1\n    2\n    3\n  ]\n" == os.str());
+            }
+            {
+                bsl::ostringstream os;
+
+                os.setstate(bsl::ios::badbit);
+                X.print(os);
+                ASSERT(os.str().empty());
+            }
+        }
+
+        if (verbose) cout << "Negative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+            Obj mY(&oa);
+            Obj mZ(&za);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SEARCH AND ITERATORS
+        //
+        // Concerns:
+        //: 1 'find', 'lower_bound', 'upper_bound', and 'equal_range' return
+        //:   the same positions as those of 'bsl::set'.
+        //:
+        //: 2 'contains' and 'count' report the presence of a value.
+        //:
+        //: 3 The forward iterators visit the elements in order, and the
+        //:   reverse iterators in the opposite order.
+        //:
+        //: 4 A custom comparator determines the order.
+        //
+        // Plan:
+        //: 1 For pseudo-random sets and every value in, and just outside, the
+        //:   range of values, compare the results of each search method to
+        //:   those of a 'bsl::set' model.  (C-1..2)
+        //:
+        //: 2 Compare the iteration sequences to those of the model.  (C-3)
+        //:
+        //: 3 Repeat with 'ReverseIntComparator'.  (C-4)
+        //
+        // Testing:
+        //   bool contains(const KEY&) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   bsl::pair<ci, ci> equal_range(const KEY&) const;
+        //   const_iterator find(const KEY&) const;
+        //   const_iterator lower_bound(const KEY&) const;
+        //   const_iterator upper_bound(const KEY&) const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SEARCH AND ITERATORS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 10, 200, 3000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE  = SIZES[i];
+            const int RANGE = 2 * SIZE + 1;
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            loadRandom(&mX, &mA, SIZE, RANGE, 3);
+
+            ASSERTV(SIZE, matches(X, A));
+            ASSERTV(SIZE, bsl::equal(X.cbegin(), X.cend(), A.begin()));
+            ASSERTV(SIZE, bsl::equal(X.crbegin(), X.crend(), A.rbegin()));
+            ASSERTV(SIZE, A.size() == static_cast<bsl::size_t>(
+                                      bsl::distance(X.crbegin(), X.crend())));
+
+            for (int value = -1; value <= RANGE; ++value) {
+                const bsl::ptrdiff_t LOWER =
+                                bsl::distance(A.begin(), A.lower_bound(value));
+                const bsl::ptrdiff_t UPPER =
+                                bsl::distance(A.begin(), A.upper_bound(value));
+
+                ASSERTV(SIZE, value, LOWER ==
+                              bsl::distance(X.begin(), X.lower_bound(value)));
+                ASSERTV(SIZE, value, UPPER ==
+                              bsl::distance(X.begin(), X.upper_bound(value)));
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                        X.equal_range(value);
+
+                ASSERTV(SIZE, value, X.lower_bound(value) == R.first);
+                ASSERTV(SIZE, value, X.upper_bound(value) == R.second);
+
+                ASSERTV(SIZE, value, A.count(value) == X.count(value));
+                ASSERTV(SIZE, value,
+                        (1 == A.count(value)) == X.contains(value));
+
+                if (A.count(value)) {
+                    ASSERTV(SIZE, value, value == *X.find(value));
+                }
+                else {
+                    ASSERTV(SIZE, value, X.end() == X.find(value));
+                }
+            }
+        }
+
+        {
+            typedef bdlc::BTreeSet<int, ReverseIntComparator> RObj;
+
+            RObj mX(&oa);  const RObj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+
+            ASSERT(99 == *X.begin());
+            ASSERT( 0 == *X.rbegin());
+            ASSERT(50 == *X.lower_bound(50));
+            ASSERT(49 == *X.upper_bound(50));
+            ASSERT(X.end() == X.upper_bound(0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Each form of 'insert' inserts the values not already present and
+        //:   returns the expected iterator (and flag).
+        //:
+        //: 2 Each form of 'erase' removes the expected elements and returns
+        //:   the expected count or iterator.
+        //:
+        //: 3 'clear' removes all elements and releases all memory.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Apply each manipulator with pseudo-random values to sets and to
+        //:   'bsl::set' models, and compare the results.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   const_iterator erase(const_iterator);
+        //   const_iterator erase(const_iterator, const_iterator);
+        //   bsl::pair<const_iterator, bool> insert(FORWARD_REF(KEY_TYPE));
+        //   const_iterator insert(const_iterator, FORWARD_REF(KEY_TYPE));
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<KEY>);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZE = 2000;
+
+        if (verbose) cout << "'insert'." << endl;
+        {
+            Obj   mX(&oa);  const Obj& X = mX;
+            Obj   mY(&oa);  const Obj& Y = mY;
+            Model mA(&sa);  const Model& A = mA;
+
+            bsl::vector<int> values(&sa);
+
+            unsigned int state = 4;
+            for (int i = 0; i < SIZE; ++i) {
+                const int VALUE = static_cast<int>(nextRandom(&state) % SIZE);
+
+                values.push_back(VALUE);
+
+                const bool isNew = mA.insert(VALUE).second;
+
+                bsl::pair<Obj::const_iterator, bool> R = mX.insert(VALUE);
+
+                ASSERTV(i, isNew == R.second);
+                ASSERTV(i, VALUE == *R.first);
+
+                Obj::const_iterator hint = 0 == i % 2
+                                           ? Y.end()
+                                           : Y.lower_bound(VALUE);
+
+                ASSERTV(i, VALUE == *mY.insert(hint, VALUE));
+            }
+            ASSERT(matches(X, A));
+            ASSERT(matches(Y, A));
+
+            Obj mZ(&oa);  const Obj& Z = mZ;
+
+            mZ.insert(values.begin(), values.end());
+            ASSERT(matches(Z, A));
+
+            Obj mW(A.begin(), A.end(), &oa);  const Obj& W = mW;
+
+            ASSERT(matches(W, A));
+
+            mW.insert(values.begin(), values.end());
+            ASSERT(matches(W, A));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            Obj mV(&oa);  const Obj& V = mV;
+
+            mV.insert({ 5, 3, 5, 1 });
+            ASSERT(3 == V.size());
+            ASSERT(1 == *V.begin());
+            ASSERT(5 == *V.rbegin());
+#endif
+        }
+
+        if (verbose) cout << "'erase'." << endl;
+        {
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mA(&sa);  const Model& A = mA;
+
+            loadRandom(&mX, &mA, SIZE, 2 * SIZE, 5);
+
+            unsigned int state = 6;
+            for (int i = 0; i < SIZE / 2; ++i) {
+                const int VALUE = static_cast<int>(nextRandom(&state)
+                                                                % (2 * SIZE));
+
+                ASSERTV(i, mA.erase(VALUE) == mX.erase(VALUE));
+            }
+            ASSERT(matches(X, A));
+
+            for (int i = 0; !A.empty(); ++i) {
+                const int VALUE = static_cast<int>(nextRandom(&state)
+                                                                % (2 * SIZE));
+
+                Model::const_iterator mit = A.lower_bound(VALUE);
+                if (mit == A.end()) {
+                    continue;
+                }
+
+                Model::const_iterator mnext = mA.erase(mit);
+                Obj::const_iterator   next  = mX.erase(X.lower_bound(VALUE));
+
+                ASSERTV(i, (mnext == A.end()) == (next == X.end()));
+                if (mnext != A.end() && next != X.end()) {
+                    ASSERTV(i, *mnext == *next);
+                }
+                ASSERTV(i, A.size() == X.size());
+            }
+            ASSERT(X.empty());
+
+            for (int i = 0; i < 10; ++i) {
+                loadRandom(&mX, &mA, SIZE / 4, SIZE, 7 + i);
+
+                int first = static_cast<int>(nextRandom(&state) % SIZE);
+                int last  = static_cast<int>(nextRandom(&state) % SIZE);
+                if (last < first) {
+                    bsl::swap(first, last);
+                }
+
+                Obj::const_iterator rv = mX.erase(X.lower_bound(first),
+                                                  X.lower_bound(last));
+                mA.erase(A.lower_bound(first), A.lower_bound(last));
+
+                ASSERTV(i, matches(X, A));
+                ASSERTV(i, X.lower_bound(last) == rv);
+            }
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == oa.numBytesInUse());
+        }
+
+        if (verbose) cout << "Negative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+
+            mX.insert(1);
+
+            ASSERT_SAFE_FAIL(mX.erase(mX.end()));
+            ASSERT_SAFE_PASS(mX.erase(mX.begin()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an object having the expected value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 The default constructors allocate no memory.
+        //:
+        //: 3 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, and verify their values, comparators, allocators, and
+        //:   memory use.  (C-1..3)
+        //
+        // Testing:
+        //   BTreeSet();
+        //   explicit BTreeSet(bslma::Allocator *basicAllocator);
+        //   explicit BTreeSet(const COMPARATOR&, Allocator *bA = 0);
+        //   BTreeSet(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+        //   BTreeSet(II, II, const COMPARATOR&, Allocator * = 0);
+        //   BTreeSet(initializer_list<KEY>, Allocator * = 0);
+        //   BTreeSet(init_list<KEY>, const COMPARATOR&, Allocator * = 0);
+        //   ~BTreeSet();
+        //   bool empty() const;
+        //   COMPARATOR key_comp() const;
+        //   size_t size() const;
+        //   COMPARATOR value_comp() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&da == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+        {
+            typedef bdlc::BTreeSet<int, ReverseIntComparator> RObj;
+
+            RObj mX(ReverseIntComparator(), &oa);  const RObj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.key_comp()(2, 1));
+            ASSERT(X.value_comp()(2, 1));
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+        {
+            Model mA(&sa);  const Model& A = mA;
+
+            for (int i = 0; i < 500; ++i) {
+                mA.insert((i * 37) % 500);
+            }
+
+            {
+                Obj mX(A.begin(), A.end(), &oa);  const Obj& X = mX;
+
+                ASSERT(&oa == X.allocator());
+                ASSERT(!X.empty());
+                ASSERT(matches(X, A));
+            }
+            ASSERT(0 == oa.numBytesInUse());
+
+            {
+                Obj mX(A.rbegin(), A.rend(), bsl::less<int>(), &oa);
+                const Obj& X = mX;
+
+                ASSERT(&oa == X.allocator());
+                ASSERT(matches(X, A));
+            }
+            ASSERT(0 == oa.numBytesInUse());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ 3, 1, 3 }, &oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(2 == X.size());
+            ASSERT(1 == *X.begin());
+
+            typedef bdlc::BTreeSet<int, ReverseIntComparator> RObj;
+
+            RObj mY({ 1, 2 }, ReverseIntComparator(), &oa);
+            const RObj& Y = mY;
+
+            ASSERT(2 == *Y.begin());
+        }
+        ASSERT(0 == oa.numBytesInUse());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert, find, and erase elements, and iterate.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.empty());
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(mX.insert(100 - i).second);
+        }
+        ASSERT(100 == X.size());
+        ASSERT(!mX.insert(1).second);
+
+        int expected = 1;
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            ASSERTV(expected, expected == *it);
+            ++expected;
+        }
+
+        ASSERT(1 == mX.erase(50));
+        ASSERT(0 == mX.erase(50));
+        ASSERT(X.end() == X.find(50));
+        ASSERT(51 == *X.lower_bound(50));
+        ASSERT(100 == *X.rbegin());
+        ASSERT(99 == X.size());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    LOOP_ASSERT(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
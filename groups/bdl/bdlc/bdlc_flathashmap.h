@@ -72,6 +72,28 @@ BSLS_IDENT("$Id: $")
 // new location.  As such, all iterators, pointers, and references to elements
 // of the 'bdlc::FlatHashMap' are invalidated on a resize.
 //
+///Looking Up Many Keys
+///--------------------
+// Each 'find' on a map much larger than the data cache typically stalls on a
+// cache miss for the map's control bytes, and another for the element.  When
+// many keys are known up front (e.g., the keys of a batch of messages to
+// enrich), 'findMany' looks them up in batches: it computes the hash value of
+// every key in the batch and prefetches the control bytes each will probe,
+// then matches every key against its control bytes and prefetches the element
+// each is expected to find, and only then compares keys, so that the misses
+// of a batch are serviced concurrently.  For example:
+//..
+//  bsl::vector<int>                                   keys;
+//  bsl::vector<bdlc::FlatHashMap<int, int>::iterator> found(keys.size());
+//
+//  map.findMany(keys.begin(), keys.end(), found.begin());
+//..
+// The results are the same as those of calling 'find' for each key.  Any
+// speed-up is platform-dependent and not guaranteed: it depends on how many
+// cache misses the processor can service at once, and on maps that fit in
+// cache 'findMany' gives little or no benefit.  Test case -3 of the test
+// driver of this component measures it.
+//
 ///Requirements on 'KEY', 'HASH', and 'EQUAL'
 ///------------------------------------------
 // The template parameter type 'KEY' must be copy or move constructible.  The
@@ -614,6 +636,22 @@ class FlatHashMap {
         // having the specified 'key', or 'end()' if no such entry exists in
         // this map.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result);
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, an iterator referring to the modifiable element in
+        // this map having that key, or 'end()' if no such entry exists in this
+        // map.  Return the position following the last iterator written.  The
+        // result is the same as calling 'find' for each key, but the hash
+        // values of a batch of keys are computed, and the memory they probe
+        // prefetched, before any key is compared, which hides much of the
+        // memory latency of looking up many keys in a map larger than the data
+        // cache.  'KEY_ITERATOR' shall be a forward iterator whose value type
+        // is convertible to 'KEY'.  See {Looking Up Many Keys}.
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class VALUE_TYPE>
     bsl::pair<iterator, bool>
@@ -776,6 +814,20 @@ class FlatHashMap {
         // having the specified 'key', or 'end()' if no such entry exists in
         // this map.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result) const;
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, a 'const_iterator' referring to the element in
+        // this map having that key, or 'end()' if no such entry exists in this
+        // map.  Return the position following the last iterator written.  The
+        // result is the same as calling 'find' for each key, but the lookups
+        // are batched and prefetched as described for the modifiable
+        // overload.  'KEY_ITERATOR' shall be a forward iterator whose value
+        // type is convertible to 'KEY'.
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this map to
         // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
@@ -1254,6 +1306,17 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR FlatHashMap<KEY, VALUE, HASH, EQUAL>::findMany(
+                                                KEY_ITERATOR    first,
+                                                KEY_ITERATOR    last,
+                                                OUTPUT_ITERATOR result)
+{
+    return d_impl.findMany(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
@@ -1380,6 +1443,17 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR FlatHashMap<KEY, VALUE, HASH, EQUAL>::findMany(
+                                          KEY_ITERATOR    first,
+                                          KEY_ITERATOR    last,
+                                          OUTPUT_ITERATOR result) const
+{
+    return d_impl.findMany(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
@@ -191,6 +191,8 @@ using namespace bsl;
 // [30] DRQS 169531176: bsl::inserter compatibility on Sun
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: LOAD FACTORS
+// [-3] PERFORMANCE TEST: 'findMany'
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -973,6 +975,140 @@ bsls::TimeInterval performanceFindNotPresent(MAP *map)
     return results[NUM_TRIAL / 2];
 }
 
+struct LoadFactorTimes {
+    // This 'struct' holds the median time, in nanoseconds per operation, of
+    // each operation measured by 'performanceLoadFactor'.
+
+    double d_insert;
+    double d_findPresent;
+    double d_findNotPresent;
+    double d_erase;
+};
+
+static double perOperation(bsl::vector<bsls::TimeInterval> *results,
+                           int                              numOperations)
+    // Return the median of the specified 'results' divided by the specified
+    // 'numOperations', in nanoseconds.  Note that 'results' is sorted.
+{
+    bsl::sort(results->begin(), results->end());
+
+    return static_cast<double>(
+                          (*results)[results->size() / 2].totalNanoseconds())
+         / numOperations;
+}
+
+static LoadFactorTimes performanceLoadFactor(bsl::size_t capacity,
+                                             bsl::size_t numEntries)
+    // Return the median time taken per operation to insert the specified
+    // 'numEntries' distinct keys into a 'bdlc::FlatHashMap' having the
+    // specified 'capacity', to 'find' each of them, to 'find' as many keys not
+    // in the map, and to erase each of them.  The behavior is undefined
+    // unless inserting 'numEntries' keys does not rehash the map.
+{
+    const int NUM_TRIAL = 11;
+
+    bdlc::FlatHashMap<int, int> map(capacity);
+
+    const int N = static_cast<int>(numEntries);
+
+    bsl::vector<bsls::TimeInterval> insertResults;
+    bsl::vector<bsls::TimeInterval> presentResults;
+    bsl::vector<bsls::TimeInterval> notPresentResults;
+    bsl::vector<bsls::TimeInterval> eraseResults;
+
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        map.clear();
+
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < N; ++i) {
+            map.insert(bsl::make_pair(i * 2, i));
+        }
+        insertResults.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+
+        ASSERTV(capacity, map.capacity(), capacity == map.capacity());
+
+        start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < N; ++i) {
+            s_antiOptimization += map.find(((i * 7) % N) * 2)->second;
+        }
+        presentResults.push_back(
+                                bsls::SystemTime::nowMonotonicClock() - start);
+
+        start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < N; ++i) {
+            if (map.end() == map.find(((i * 7) % N) * 2 + 1)) {
+                ++s_antiOptimization;
+            }
+        }
+        notPresentResults.push_back(
+                                bsls::SystemTime::nowMonotonicClock() - start);
+
+        start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < N; ++i) {
+            s_antiOptimization += static_cast<unsigned int>(
+                                               map.erase(((i * 7) % N) * 2));
+        }
+        eraseResults.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    LoadFactorTimes times;
+
+    times.d_insert         = perOperation(&insertResults,     N);
+    times.d_findPresent    = perOperation(&presentResults,    N);
+    times.d_findNotPresent = perOperation(&notPresentResults, N);
+    times.d_erase          = perOperation(&eraseResults,      N);
+
+    return times;
+}
+
+template <class MAP>
+void performanceFindMany(double                  *findTime,
+                         double                  *findManyTime,
+                         MAP                     *map,
+                         const bsl::vector<int>&  keys)
+    // Load into the specified 'findTime' and 'findManyTime' the median time,
+    // in nanoseconds per key, taken to look up each of the specified 'keys'
+    // in the specified 'map' using 'find' and using 'findMany', respectively.
+{
+    typedef typename MAP::iterator Iterator;
+
+    const int NUM_TRIAL = 11;
+    const int N         = static_cast<int>(keys.size());
+
+    bsl::vector<Iterator> found(keys.size());
+
+    bsl::vector<bsls::TimeInterval> findResults;
+    bsl::vector<bsls::TimeInterval> findManyResults;
+
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < N; ++i) {
+            found[i] = map->find(keys[i]);
+        }
+        findResults.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+
+        for (int i = 0; i < N; ++i) {
+            if (map->end() != found[i]) {
+                s_antiOptimization += found[i]->second;
+            }
+        }
+
+        start = bsls::SystemTime::nowMonotonicClock();
+        map->findMany(keys.begin(), keys.end(), found.begin());
+        findManyResults.push_back(
+                                bsls::SystemTime::nowMonotonicClock() - start);
+
+        for (int i = 0; i < N; ++i) {
+            if (map->end() != found[i]) {
+                s_antiOptimization += found[i]->second;
+            }
+        }
+    }
+
+    *findTime     = perOperation(&findResults,     N);
+    *findManyTime = perOperation(&findManyResults, N);
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -4984,6 +5120,170 @@ int main(int argc, char *argv[])
             cout << "anti-optimization: " << s_antiOptimization << endl;
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: LOAD FACTORS
+        //   Report the cost of each operation as the table fills.
+        //
+        // Concerns:
+        //: 1 The cost of 'insert', of 'find' for present and absent keys, and
+        //:   of 'erase', at load factors up to the maximum, is reported for
+        //:   the group width of the platform, so that changes to
+        //:   'bdlc::FlatHashTable_GroupControl' and the probe loop can be
+        //:   compared.
+        //
+        // Plan:
+        //: 1 For tables large enough to exceed the first-level caches, and for
+        //:   load factors from 1/8 to just under 7/8, time each operation on
+        //:   a table of fixed capacity, and print the median time per
+        //:   operation.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: LOAD FACTORS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: LOAD FACTORS" << endl
+                          << "==============================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        cout << "group width: " << bdlc::FlatHashTable_GroupControl::k_SIZE
+             << endl
+             << "capacity    load    insert    find(hit)  find(miss)"
+                "     erase  (ns/op)"
+             << endl;
+
+        const bsl::ios_base::fmtflags flags = cout.flags();
+
+        cout << bsl::fixed;
+
+        const bsl::size_t CAPACITIES[] = { 1 << 14, 1 << 20 };
+        const int         NUM_CAPACITIES =
+                                 sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            const bsl::size_t CAPACITY = CAPACITIES[ci];
+
+            for (int eighths = 1; eighths <= 7; ++eighths) {
+                bsl::size_t numEntries = CAPACITY / 8 * eighths;
+                if (7 == eighths) {
+                    --numEntries;  // stay below the maximum load factor
+                }
+
+                const LoadFactorTimes TIMES =
+                                   performanceLoadFactor(CAPACITY, numEntries);
+
+                cout << bsl::setw(8)  << CAPACITY
+                     << bsl::setw(8)  << bsl::setprecision(3)
+                                      << static_cast<double>(numEntries)
+                                                                    / CAPACITY
+                     << bsl::setprecision(1)
+                     << bsl::setw(10) << TIMES.d_insert
+                     << bsl::setw(13) << TIMES.d_findPresent
+                     << bsl::setw(12) << TIMES.d_findNotPresent
+                     << bsl::setw(10) << TIMES.d_erase
+                     << endl;
+            }
+        }
+
+        cout.flags(flags);
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'findMany'
+        //   Report the benefit of batched look-up on a table that does not
+        //   fit in cache.
+        //
+        // Concerns:
+        //: 1 For a table much larger than the last-level cache, and keys in
+        //:   random order, the cost of looking up each key with 'find' and
+        //:   with 'findMany' is reported for both 'bdlc::FlatHashMap' and
+        //:   'bsl::unordered_map'.
+        //
+        // Plan:
+        //: 1 Populate each map with 2^22 entries, and time looking up 2^20
+        //:   pseudo-random keys, half of which are present, using 'find' in a
+        //:   loop and using 'findMany'.  Print the median time per key and
+        //:   the speed-up of 'findMany'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'findMany'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: 'findMany'" << endl
+                          << "============================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        const int NUM_ENTRIES = 1 << 22;
+        const int NUM_KEYS    = 1 << 20;
+
+        bsl::vector<int> keys;
+        {
+            unsigned int seed = 12345;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                seed = seed * 1103515245 + 12345;
+                keys.push_back(static_cast<int>(
+                                   (seed >> 8) % (2 * NUM_ENTRIES)));
+            }
+        }
+
+        const bsl::ios_base::fmtflags flags = cout.flags();
+
+        cout << bsl::fixed << bsl::setprecision(1);
+
+        cout << "container        find  findMany  speed-up  (ns/key)" << endl;
+
+        {
+            bdlc::FlatHashMap<int, int> mX;
+            for (int i = 0; i < NUM_ENTRIES; ++i) {
+                mX.insert(bsl::make_pair(i * 2, i));
+            }
+
+            double findTime;
+            double findManyTime;
+            performanceFindMany(&findTime, &findManyTime, &mX, keys);
+
+            cout << "flat     "
+                 << bsl::setw(12) << findTime
+                 << bsl::setw(10) << findManyTime
+                 << bsl::setw(9)  << findTime / findManyTime << "x"
+                 << endl;
+        }
+        {
+            bsl::unordered_map<int, int> mY;
+            mY.reserve(NUM_ENTRIES);
+            for (int i = 0; i < NUM_ENTRIES; ++i) {
+                mY.insert(bsl::make_pair(i * 2, i));
+            }
+
+            double findTime;
+            double findManyTime;
+            performanceFindMany(&findTime, &findManyTime, &mY, keys);
+
+            cout << "unordered"
+                 << bsl::setw(12) << findTime
+                 << bsl::setw(10) << findManyTime
+                 << bsl::setw(9)  << findTime / findManyTime << "x"
+                 << endl;
+        }
+
+        cout.flags(flags);
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
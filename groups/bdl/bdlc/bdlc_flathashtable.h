@@ -319,6 +319,23 @@ class FlatHashTable
         // 'd_capacity' if the 'key' is not present.  The behavior is undefined
         // unless 'hashValue == d_hasher(key)'.
 
+    template <class KEY_ITERATOR>
+    KEY_ITERATOR findKeys(bsl::size_t  *indices,
+                          KEY_ITERATOR  first,
+                          KEY_ITERATOR  last) const;
+        // Load into the specified 'indices' the result of 'findKey' for each
+        // of the keys in the range starting at the specified 'first' and
+        // ending at the specified 'last' or after 'k_FIND_MANY_BATCH_SIZE'
+        // keys, whichever is reached first, and return the position following
+        // the last key looked up.  The lookups proceed in stages, each over
+        // the whole batch: the hash value of every key is computed and the
+        // first control group it probes prefetched; then every key is matched
+        // against that group and the entry of its first candidate prefetched;
+        // and only then is any key compared, so that the cache misses of the
+        // batch overlap.  The behavior is undefined unless
+        // '0 < d_capacity', 'first != last', and 'indices' has at least
+        // 'k_FIND_MANY_BATCH_SIZE' elements.
+
     bsl::size_t minimumCompliantCapacity(bsl::size_t minimumCapacity) const;
         // Return the minimum capacity that satisfies all class invariants, and
         // is at least the specified 'minimumCapacity'.
@@ -333,6 +350,12 @@ class FlatHashTable
 
     static const bsl::int8_t  k_HASHLET_MASK = 0x7f;  // hashlet = hash & MASK
 
+    static const int          k_FIND_MANY_BATCH_SIZE = 16;
+                                                      // number of keys
+                                                      // 'findMany' hashes and
+                                                      // prefetches before
+                                                      // resolving them
+
     static const bsl::size_t  k_MAX_LOAD_FACTOR_NUMERATOR = 7;
                                                       // numerator of fraction
                                                       // that specifies the
@@ -463,6 +486,24 @@ class FlatHashTable
         // flat hash table with a key equal to the specified 'key', if such an
         // entry exists, and 'end()' otherwise.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result);
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, an iterator providing modifiable access to the
+        // object in this flat hash table having that key, if such an entry
+        // exists, and 'end()' otherwise.  Return the position following the
+        // last iterator written.  The result is the same as calling 'find' for
+        // each key, but keys are processed in batches of
+        // 'k_FIND_MANY_BATCH_SIZE' whose hash values are computed, whose
+        // control groups are prefetched, and whose candidate entries are then
+        // prefetched, before any key is compared, so that on tables larger
+        // than the data cache the memory latency of the lookups overlaps.
+        // 'KEY_ITERATOR' shall be a forward iterator whose value type is
+        // convertible to 'KEY'.
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class ENTRY_TYPE>
     bsl::pair<iterator, bool> insert(
@@ -617,6 +658,20 @@ class FlatHashTable
         // flat hash table having the specified 'key', or 'end()' if no such
         // entry exists in this table.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result) const;
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, an iterator representing the position of the
+        // entry in this flat hash table having that key, or 'end()' if no such
+        // entry exists.  Return the position following the last iterator
+        // written.  The result is the same as calling 'find' for each key, but
+        // the lookups are batched and prefetched as described for the
+        // modifiable overload.  'KEY_ITERATOR' shall be a forward iterator
+        // whose value type is convertible to 'KEY'.
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this flat hash
         // table to generate a hash value (of type 'bsl::size_t) for a 'KEY'
@@ -1189,6 +1244,57 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
     return d_capacity;
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY_ITERATOR>
+KEY_ITERATOR FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKeys(
+                                                  bsl::size_t  *indices,
+                                                  KEY_ITERATOR  first,
+                                                  KEY_ITERATOR  last) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+    BSLS_ASSERT_SAFE(first != last);
+
+    bsl::size_t  hashValues[k_FIND_MANY_BATCH_SIZE];
+    int          numKeys = 0;
+    KEY_ITERATOR it      = first;
+
+    for (; numKeys < k_FIND_MANY_BATCH_SIZE && it != last; ++numKeys, ++it) {
+        const bsl::size_t hashValue = d_hasher(*it);
+        const bsl::size_t index     = (hashValue >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+
+        hashValues[numKeys] = hashValue;
+
+        bsls::PerformanceHint::prefetchForReading(d_controls_p + index);
+    }
+
+    // Match each key against its first control group (prefetched above), and
+    // prefetch the entry of the first candidate, which is the entry holding
+    // the key unless the hashlet collides or the key is absent.
+
+    for (int i = 0; i < numKeys; ++i) {
+        const bsl::size_t  index   = (hashValues[i] >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+        const bsl::uint8_t hashlet = static_cast<bsl::uint8_t>(
+                                               hashValues[i] & k_HASHLET_MASK);
+
+        GroupControl        groupControl(d_controls_p + index);
+        const bsl::uint32_t candidates = groupControl.match(hashlet);
+        if (candidates) {
+            const int offset = bdlb::BitUtil::numTrailingUnsetBits(candidates);
+
+            bsls::PerformanceHint::prefetchForReading(
+                                                d_entries_p + index + offset);
+        }
+    }
+
+    for (int i = 0; i < numKeys; ++i, ++first) {
+        indices[i] = findKey(*first, hashValues[i]);
+    }
+
+    return first;
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 bsl::size_t FlatHashTable<KEY,
                           ENTRY,
@@ -1610,6 +1716,41 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
     return end();
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findMany(
+                                                  KEY_ITERATOR    first,
+                                                  KEY_ITERATOR    last,
+                                                  OUTPUT_ITERATOR result)
+{
+    if (0 == d_capacity) {
+        for (; first != last; ++first, ++result) {
+            *result = end();
+        }
+        return result;                                                // RETURN
+    }
+
+    bsl::size_t indices[k_FIND_MANY_BATCH_SIZE];
+
+    while (first != last) {
+        const KEY_ITERATOR next = findKeys(indices, first, last);
+
+        for (const bsl::size_t *index = indices; first != next;
+                                              ++first, ++index, ++result) {
+            if (*index < d_capacity) {
+                *result = iterator(IteratorImp(d_entries_p  + *index,
+                                               d_controls_p + *index,
+                                               d_capacity   - *index - 1));
+            }
+            else {
+                *result = end();
+            }
+        }
+    }
+
+    return result;
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 inline
@@ -1819,6 +1960,42 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
     return end();
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findMany(
+                                            KEY_ITERATOR    first,
+                                            KEY_ITERATOR    last,
+                                            OUTPUT_ITERATOR result) const
+{
+    if (0 == d_capacity) {
+        for (; first != last; ++first, ++result) {
+            *result = end();
+        }
+        return result;                                                // RETURN
+    }
+
+    bsl::size_t indices[k_FIND_MANY_BATCH_SIZE];
+
+    while (first != last) {
+        const KEY_ITERATOR next = findKeys(indices, first, last);
+
+        for (const bsl::size_t *index = indices; first != next;
+                                              ++first, ++index, ++result) {
+            if (*index < d_capacity) {
+                *result = const_iterator(IteratorImp(
+                                                d_entries_p  + *index,
+                                                d_controls_p + *index,
+                                                d_capacity   - *index - 1));
+            }
+            else {
+                *result = end();
+            }
+        }
+    }
+
+    return result;
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
 HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
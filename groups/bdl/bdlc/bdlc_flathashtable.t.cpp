@@ -110,6 +110,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [12] iterator find(const KEY&);
+// [22] OUTPUT_ITERATOR findMany(KEY_ITERATOR, KEY_ITERATOR, OUTPUT_IT);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry)
 // [16] void insert(INPUT_IT, INPUT_IT);
 // [19] void rehash(size_t);
@@ -130,6 +131,7 @@ using namespace bsl;
 // [ 4] const ENTRY *entries() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [12] const_iterator find(const KEY&) const;
+// [22] OUTPUT_ITERATOR findMany(KEY_IT, KEY_IT, OUTPUT_ITERATOR) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -929,6 +931,82 @@ IsValidResult::Enum isValid(bsl::size_t                       *errorIndex,
 }
 
 
+template <class HASH>
+void testCase22FindMany(int id)
+    // Verify that 'findMany' produces the same results as 'find' for tables
+    // using the hash functor 'HASH'; the specified 'id' is reported on
+    // failure.  See the test plan of case 22 for the concerns checked by this
+    // function.
+{
+    typedef bsl::pair<const int, int>                         Entry;
+    typedef TestEntryUtil<Entry>                              EntryUtil;
+    typedef bsl::equal_to<int>                                Equal;
+    typedef bdlc::FlatHashTable<int, Entry, EntryUtil, HASH, Equal>
+                                                              Obj;
+    typedef typename Obj::iterator                            Iter;
+    typedef typename Obj::const_iterator                      ConstIter;
+
+    const int SIZES[] = { 0, 1, 15, 16, 17, 33, 100, 1000 };
+    const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int SIZE = SIZES[ti];
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        Obj mX(0, HASH(), Equal(), &oa);  const Obj& X = mX;
+
+        for (int i = 0; i < SIZE; ++i) {
+            mX.insert(bsl::make_pair(2 * i, i));
+        }
+
+        // Look up every present key, and as many absent keys, interleaved,
+        // with the first key repeated at the end.
+
+        bsl::vector<int> keys(&sa);
+        for (int i = 0; i < SIZE; ++i) {
+            keys.push_back(2 * i);
+            keys.push_back(2 * i + 1);
+        }
+        keys.push_back(0);
+
+        const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+        bsl::vector<Iter>      found(keys.size(), mX.end(), &sa);
+        bsl::vector<ConstIter> constFound(&sa);
+
+        typename bsl::vector<Iter>::iterator end =
+                               mX.findMany(keys.begin(), keys.end(),
+                                           found.begin());
+
+        X.findMany(keys.begin(), keys.end(), bsl::back_inserter(constFound));
+
+        LOOP2_ASSERT(id, SIZE, found.end()   == end);
+        LOOP2_ASSERT(id, SIZE, keys.size()   == constFound.size());
+
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            LOOP3_ASSERT(id, SIZE, i, mX.find(keys[i]) == found[i]);
+            LOOP3_ASSERT(id, SIZE, i,  X.find(keys[i]) == constFound[i]);
+        }
+
+        LOOP2_ASSERT(id, SIZE, numAllocations == oa.numAllocations());
+
+        // Modify an element through the result.
+
+        if (SIZE) {
+            found[0]->second = -1;
+            LOOP2_ASSERT(id, SIZE, -1 == X.find(0)->second);
+        }
+
+        // An empty range writes nothing.
+
+        LOOP2_ASSERT(id, SIZE, found.begin() == mX.findMany(keys.begin(),
+                                                            keys.begin(),
+                                                            found.begin()));
+    }
+}
+
 template <class ENTRY>
 void testCase21OperationsWhenMoved(int id)
     // Address the key-based accessor and basic manipulator concerns of
@@ -3066,6 +3144,53 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 22: {
+        // --------------------------------------------------------------------
+        // 'findMany'
+        //
+        // Concerns:
+        //: 1 'findMany' writes, for each key in order, the same iterator that
+        //:   'find' returns, both for present and absent keys, and for
+        //:   repeated keys.
+        //:
+        //: 2 Ranges shorter than, equal to, and longer than a batch, and the
+        //:   empty range, are handled.
+        //:
+        //: 3 Tables having zero capacity are handled.
+        //:
+        //: 4 Tables whose keys all collide (so that lookups probe several
+        //:   groups) are handled.
+        //:
+        //: 5 The returned position follows the last iterator written, and any
+        //:   output iterator may be used.
+        //:
+        //: 6 The non-'const' overload provides modifiable access.
+        //:
+        //: 7 No memory is allocated.
+        //
+        // Plan:
+        //: 1 For tables of several sizes, including 0, using a well
+        //:   distributed hash and a hash that maps every key to 0, look up
+        //:   present, absent, and repeated keys with both overloads, writing
+        //:   to a random-access iterator and a 'bsl::back_insert_iterator',
+        //:   and compare the results to those of 'find'.  (C-1..5)
+        //:
+        //: 2 Modify an element through a result.  (C-6)
+        //:
+        //: 3 Verify that the object allocator was not used.  (C-7)
+        //
+        // Testing:
+        //   OUTPUT_ITERATOR findMany(KEY_ITERATOR, KEY_ITERATOR, OUTPUT_IT);
+        //   OUTPUT_ITERATOR findMany(KEY_IT, KEY_IT, OUTPUT_ITERATOR) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'findMany'" << endl
+                          << "==========" << endl;
+
+        testCase22FindMany<bslh::Hash<> >(0);
+        testCase22FindMany<IntZeroHash>(1);
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // {DRQS 167125039} BASIC OPERATIONS OF MOVED-TO TABLES
@@ -65,11 +65,19 @@ class FlatHashTable_GroupControl
     static const bsl::uint64_t k_DEFLATE       = 0x0002040810204081ull;
     static const int           k_DEFLATE_SHIFT = 56;
     static const bsl::uint64_t k_MSB_MASK      = 0x8080808080808080ull;
+    static const bsl::uint64_t k_LSB_MASK      = 0x7F7F7F7F7F7F7F7Full;
 
     // DATA
     Storage d_value;  // efficiently cached value for inquiries
 
     // PRIVATE ACCESSORS
+#if !defined(BSLS_PLATFORM_CPU_SSE2)
+    bsl::uint64_t matchBytes(bsl::uint8_t value) const;
+        // Return a word in which the most-significant bit of byte 'i' is set
+        // if 'data[i]' has the specified 'value', and all other bits are
+        // unset.
+#endif
+
     bsl::uint32_t matchRaw(bsl::uint8_t value) const;
         // Return a bit mask of the 'k_SIZE' entries that have the specified
         // 'value'.  The bit at index 'i' corresponds to the result for
@@ -124,6 +132,23 @@ class FlatHashTable_GroupControl
                      // --------------------------------
 
 // PRIVATE ACCESSORS
+#if !defined(BSLS_PLATFORM_CPU_SSE2)
+inline
+bsl::uint64_t FlatHashTable_GroupControl::matchBytes(bsl::uint8_t value) const
+{
+    // A byte of 't' is zero exactly where 'd_value' has 'value'.  Adding
+    // 0x7F to the low seven bits of a byte sets its most-significant bit
+    // unless those bits are all zero, and cannot carry into the next byte, so
+    // the complement of the sum, or'ed with 't', identifies the zero bytes
+    // exactly (unlike the common 'haszero' idiom, which can report false
+    // positives above a true match).
+
+    const Storage t = d_value ^ (k_MULT * value);
+
+    return ~(((t & k_LSB_MASK) + k_LSB_MASK) | t) & k_MSB_MASK;
+}
+#endif
+
 inline
 bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
 {
@@ -132,14 +157,8 @@ bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
                                        _mm_set1_epi8(static_cast<char>(value)),
                                        d_value));
 #else
-    Storage t = d_value ^ (k_MULT * value);
-
-    t = t | (t << 4);
-    t = t | (t << 2);
-    t = t | (t << 1);
-
     return static_cast<bsl::uint32_t>(
-                         (((~t) & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
+                           (matchBytes(value) * k_DEFLATE) >> k_DEFLATE_SHIFT);
 #endif
 }
 
@@ -190,7 +209,11 @@ bsl::uint32_t FlatHashTable_GroupControl::match(bsl::uint8_t value) const
 inline
 bool FlatHashTable_GroupControl::neverFull() const
 {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
     return 0 != matchRaw(k_EMPTY);
+#else
+    return 0 != matchBytes(k_EMPTY);
+#endif
 }
 
 }  // close package namespace
@@ -2574,10 +2574,27 @@ inline
 void bdlc::hashAppend(HASHALG& hashAlg, const PackedIntArray<TYPE>& input)
 {
     using ::BloombergLP::bslh::hashAppend;
-    typedef typename PackedIntArray<TYPE>::const_iterator ci_t;
+
+    enum { k_BLOCK_LENGTH = 64 };  // number of elements hashed per call
+
     hashAppend(hashAlg, input.length());
-    for (ci_t b = input.begin(), e = input.end(); b != e; ++b) {
-        hashAppend(hashAlg, *b);
+
+    // The elements are stored using a variable number of bytes, so equal
+    // arrays need not have equal storage.  Unpack the elements into a local
+    // block of 'TYPE' and pass each block to 'hashAlg' at once, which yields
+    // the same hash as appending the elements one at a time.
+
+    TYPE        block[k_BLOCK_LENGTH];
+    bsl::size_t index = 0;
+    while (index < input.length()) {
+        bsl::size_t numElements = 0;
+        do {
+            block[numElements++] = input[index++];
+        } while (numElements < k_BLOCK_LENGTH && index < input.length());
+
+        ::BloombergLP::bslh::hashAppendContiguous(hashAlg,
+                                                  block,
+                                                  numElements);
     }
 }
 
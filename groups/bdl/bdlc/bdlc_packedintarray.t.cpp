@@ -698,6 +698,10 @@ int main(int argc, char *argv[])
         //:
         //: 3 Non-modifiable objects can be hashed (i.e., objects providing
         //:   only non-modifiable access).
+        //:
+        //: 4 The hash value is the same as that of appending the length and
+        //:   then each element in turn, for lengths spanning several of the
+        //:   blocks in which elements are passed to the hashing algorithm.
         //
         // Plan:
         //: 1 Specify a set of specifications for the 'gg' function that result
@@ -709,6 +713,10 @@ int main(int argc, char *argv[])
         //: 3 For every item in the cross-product of these two sets, verify
         //:   that the hash value is the same when the two items are.  Hope
         //:   that they are different when the two items are.  (C-1..3)
+        //:
+        //: 4 For arrays of increasing length holding values of various
+        //:   widths, compare the hash value to that computed by appending the
+        //:   length and each element to a hashing algorithm.  (C-4)
         //
         // Testing:
         //   void hashAppend(HASHALG&, const PackedIntArray&);
@@ -870,6 +878,32 @@ int main(int argc, char *argv[])
                 }
             }
         }
+
+        if (verbose) cout << "\nVerify hashing element by element." << endl;
+        {
+            typedef Hasher::HashAlgorithm HashAlgorithm;
+
+            Obj mX;  const Obj& X = mX;
+
+            for (int len = 0; len <= 300; ++len) {
+                HashAlgorithm alg;
+                hashAppend(alg, X.length());
+                for (bsl::size_t i = 0; i < X.length(); ++i) {
+                    hashAppend(alg, X[i]);
+                }
+                const HashType EXP = static_cast<HashType>(alg.computeHash());
+
+                LOOP_ASSERT(len, EXP == hasher(X));
+
+                // Cycle through values requiring 1, 2, 4, and 8 bytes.
+
+                const Element VALUES[] = { -3,
+                                           1000,
+                                           -70000,
+                                           0x123456789LL };
+                mX.push_back(VALUES[len % 4] * (len + 1));
+            }
+        }
       } break;
       case 25: {
         // --------------------------------------------------------------------
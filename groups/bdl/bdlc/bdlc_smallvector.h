@@ -0,0 +1,1917 @@
+// bdlc_smallvector.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_SMALLVECTOR
+#define INCLUDED_BDLC_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector that stores a few elements without allocating.
+//
+//@CLASSES:
+//  bdlc::SmallVector: sequence container with inline storage for N elements
+//
+//@SEE_ALSO: bslstl_vector, bslstl_inplacevector
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::SmallVector', implementing a dynamically-resizable sequence
+// container that holds up to 'INLINE_CAPACITY' elements in storage embedded in
+// the object itself, and obtains memory from its allocator only when it grows
+// beyond that.  A 'bsl::vector' allocates as soon as its first element is
+// added, so that a short-lived vector that typically holds only a few elements
+// costs at least one allocation and deallocation; a 'bdlc::SmallVector' whose
+// 'INLINE_CAPACITY' covers the common case costs none.
+//
+// The interface of 'bdlc::SmallVector' is that of 'bsl::vector' (less the
+// standard allocator interface), with the addition of the 'isInline' accessor,
+// which indicates whether the elements are in the inline storage.  Once a
+// 'bdlc::SmallVector' has spilled to allocated memory, it keeps that memory
+// (like 'bsl::vector') until 'shrink_to_fit' is called, which returns the
+// elements to the inline storage if they fit.
+//
+// Elements are relocated (on growth, insertion, and erasure) using
+// 'bslalg::ArrayPrimitives', so that the elements of bitwise-moveable types
+// are moved with 'memcpy' and 'memmove'.
+//
+// An instantiation of 'bdlc::SmallVector' is an allocator-aware,
+// value-semantic type whose salient attributes are its size and the sequence
+// of values of its elements.  The 'INLINE_CAPACITY' of an object is not a
+// salient attribute, but is part of its type.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// The rules are those of 'bsl::vector', with one addition: moving or swapping
+// a 'bdlc::SmallVector' whose elements are in the inline storage moves the
+// elements themselves, and so invalidates all iterators, pointers, and
+// references to them.  (Moving or swapping objects whose elements are in
+// allocated memory transfers the memory, as with 'bsl::vector'.)
+//
+///Allocator Use
+///-------------
+// Memory beyond the inline storage is obtained from the allocator supplied at
+// construction (or the default allocator, if none is supplied), which is also
+// passed to each element of an allocator-aware 'VALUE_TYPE'.  The allocator
+// of an object does not change after construction.
+//
+///Requirements on 'VALUE_TYPE'
+///----------------------------
+// The requirements on 'VALUE_TYPE' are those of the corresponding operations
+// of 'bsl::vector'.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::SmallVector' is exception neutral.  Appending a single element
+// provides the strong exception-safety guarantee; other methods provide the
+// basic guarantee (see {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Splitting a Path into Its Components
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we split file-system paths into their components, and that nearly
+// all the paths we see have no more than eight components.  Collecting the
+// components in a 'bdlc::SmallVector' with an inline capacity of eight avoids
+// any allocation for those paths, while still handling longer ones.
+//
+// First, we define the function that splits a path:
+//..
+//  typedef bdlc::SmallVector<bslstl::StringRef, 8> Components;
+//
+//  void splitPath(Components *result, const bslstl::StringRef& path)
+//      // Load into the specified 'result' the non-empty components of the
+//      // specified 'path', separated by '/'.
+//  {
+//      result->clear();
+//
+//      const char *begin = path.begin();
+//      for (const char *it = path.begin(); it != path.end(); ++it) {
+//          if ('/' == *it) {
+//              if (begin != it) {
+//                  result->push_back(bslstl::StringRef(begin, it));
+//              }
+//              begin = it + 1;
+//          }
+//      }
+//      if (begin != path.end()) {
+//          result->push_back(bslstl::StringRef(begin, path.end()));
+//      }
+//  }
+//..
+// Then, we split a short path, and observe that no memory is allocated:
+//..
+//  bslma::TestAllocator ta;
+//  Components           components(&ta);
+//
+//  splitPath(&components, "/usr/local/lib");
+//
+//  assert(3       == components.size());
+//  assert("local" == components[1]);
+//  assert(components.isInline());
+//  assert(0       == ta.numBlocksTotal());
+//..
+// Finally, we split a long path, which spills to allocated memory:
+//..
+//  splitPath(&components, "a/b/c/d/e/f/g/h/i/j");
+//
+//  assert(10  == components.size());
+//  assert("j" == components.back());
+//  assert(!components.isInline());
+//  assert(1   == ta.numBlocksInUse());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_hasstliterators.h>
+#include <bslalg_rangecompare.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isintegral.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_allocator.h>
+#include <bslstl_iterator.h>
+#include <bslstl_stdexceptutil.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_limits.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                             // =================
+                             // class SmallVector
+                             // =================
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector {
+    // This class template implements a value-semantic, allocator-aware
+    // sequence container of elements of (template parameter) type
+    // 'VALUE_TYPE', the first (template parameter) 'INLINE_CAPACITY' of which
+    // are stored without allocating memory.  See the component documentation
+    // for details.
+
+    // PRIVATE TYPES
+    typedef bslalg::ArrayPrimitives            ArrayPrimitives;
+    typedef bslalg::ArrayDestructionPrimitives DestructionUtil;
+    typedef bslmf::MovableRefUtil              MoveUtil;
+    typedef bsl::allocator<VALUE_TYPE>         StdAllocator;
+
+    enum {
+        k_BUFFER_SIZE = sizeof(VALUE_TYPE) *
+                                  (INLINE_CAPACITY ? INLINE_CAPACITY : 1),
+        k_ALIGNMENT   = bsls::AlignmentFromType<VALUE_TYPE>::VALUE
+    };
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                             value_type;
+    typedef VALUE_TYPE&                            reference;
+    typedef const VALUE_TYPE&                      const_reference;
+    typedef VALUE_TYPE                            *pointer;
+    typedef const VALUE_TYPE                      *const_pointer;
+    typedef VALUE_TYPE                            *iterator;
+    typedef const VALUE_TYPE                      *const_iterator;
+    typedef bsl::size_t                            size_type;
+    typedef bsl::ptrdiff_t                         difference_type;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // DATA
+    bsls::AlignedBuffer<k_BUFFER_SIZE, k_ALIGNMENT>  d_buffer;
+                                                  // inline element storage
+
+    VALUE_TYPE                                      *d_dataBegin_p;
+                                                  // first element
+
+    VALUE_TYPE                                      *d_dataEnd_p;
+                                                  // past-the-end element
+
+    size_type                                        d_capacity;
+                                                  // capacity of the storage
+                                                  // at 'd_dataBegin_p'
+
+    bslma::Allocator                                *d_allocator_p;
+                                                  // allocator (held, not
+                                                  // owned)
+
+    // PRIVATE MANIPULATORS
+    void adoptStorage(VALUE_TYPE *data, size_type capacity, size_type size);
+        // Release the allocated storage of this vector, if any, and make the
+        // storage at the specified 'data' address, having the specified
+        // 'capacity' and holding the specified 'size' elements, the storage
+        // of this vector.  The behavior is undefined unless the elements of
+        // this vector have been destroyed or relocated.
+
+    VALUE_TYPE *allocateStorage(size_type capacity);
+        // Return the address of uninitialized storage for the specified
+        // 'capacity' elements, obtained from the allocator of this vector.
+
+    VALUE_TYPE *inlineData();
+        // Return the address of the inline storage of this vector.
+
+    template <class INPUT_ITERATOR>
+    iterator insertRange(const_iterator          position,
+                         INPUT_ITERATOR          first,
+                         INPUT_ITERATOR          last,
+                         bsl::input_iterator_tag);
+    template <class FORWARD_ITERATOR>
+    iterator insertRange(const_iterator            position,
+                         FORWARD_ITERATOR          first,
+                         FORWARD_ITERATOR          last,
+                         bsl::forward_iterator_tag);
+        // Insert the elements in the range specified by '[first .. last)' at
+        // the specified 'position', and return an iterator to the first new
+        // element, or 'position' if the range is empty.  The last argument
+        // dispatches on the category of the iterators.
+
+    template <class ARG_TYPE>
+    iterator insertWithGrowth(const_iterator                        position,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARG_TYPE)
+                                                                  argument);
+        // Move the elements of this vector to new storage having twice the
+        // capacity, and insert, at the specified 'position', an element
+        // constructed from the specified 'argument'.  Return an iterator to
+        // the new element.  Note that 'argument' may refer to an element of
+        // this vector.
+
+    void reallocate(size_type newCapacity);
+        // Move the elements of this vector to allocated storage having the
+        // specified 'newCapacity'.  The behavior is undefined unless
+        // 'size() <= newCapacity'.
+
+    // PRIVATE ACCESSORS
+    size_type computeNewCapacity(size_type newSize) const;
+        // Return the capacity to allocate to hold the specified 'newSize'
+        // elements: the larger of 'newSize' and twice the current capacity.
+        // Throw 'bsl::length_error' if 'max_size() < newSize'.
+
+    const VALUE_TYPE *inlineData() const;
+        // Return the address of the inline storage of this vector.
+
+  public:
+    // CLASS METHODS
+    static size_type inlineCapacity();
+        // Return the (template parameter) 'INLINE_CAPACITY', the number of
+        // elements an object of this type can hold without allocating memory.
+
+    // CREATORS
+    SmallVector();
+    explicit SmallVector(bslma::Allocator *basicAllocator);
+        // Create an empty vector.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    explicit SmallVector(size_type         initialSize,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create a vector of the specified 'initialSize' value-initialized
+        // elements.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    SmallVector(size_type          initialSize,
+                const VALUE_TYPE&  value,
+                bslma::Allocator  *basicAllocator = 0);
+        // Create a vector of the specified 'initialSize' copies of the
+        // specified 'value'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    SmallVector(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0,
+                typename bsl::enable_if<
+                       !bsl::is_integral<INPUT_ITERATOR>::value>::type * = 0);
+        // Create a vector holding the elements in the range specified by
+        // '[first .. last)'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '[first .. last)' is a valid range.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    SmallVector(std::initializer_list<VALUE_TYPE>  values,
+                bslma::Allocator                  *basicAllocator = 0);
+                                                                    // IMPLICIT
+        // Create a vector holding the specified 'values'.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+#endif
+
+    SmallVector(const SmallVector&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a vector having the same value as the specified 'original'
+        // vector.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    SmallVector(bslmf::MovableRef<SmallVector> original);
+        // Create a vector having the value of the specified 'original' vector,
+        // and using the allocator of 'original'.  If the elements of
+        // 'original' are in allocated memory, that memory is transferred to
+        // the new vector; otherwise, the elements are relocated.  'original'
+        // is left empty.
+
+    SmallVector(bslmf::MovableRef<SmallVector>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a vector having the value of the specified 'original' vector,
+        // and using the specified 'basicAllocator' to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If 'basicAllocator' is the allocator of 'original', this
+        // constructor behaves as the one above; otherwise, the elements of
+        // 'original' are moved one by one, and 'original' is left holding
+        // the same number of elements, each in a valid but unspecified state.
+
+    ~SmallVector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    SmallVector& operator=(const SmallVector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    SmallVector& operator=(bslmf::MovableRef<SmallVector> rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.  If
+        // 'rhs' uses the same allocator as this object and its elements are
+        // in allocated memory, that memory is transferred to this object;
+        // otherwise, the elements of 'rhs' are relocated (if 'rhs' uses the
+        // same allocator as this object) or moved one by one.  'rhs' is left
+        // in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    SmallVector& operator=(std::initializer_list<VALUE_TYPE> values);
+        // Assign to this object the specified 'values', and return a
+        // reference providing modifiable access to this object.
+#endif
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Assign to this object the specified 'numElements' copies of the
+        // specified 'value'.  Note that 'value' may refer to an element of
+        // this vector.
+
+    template <class INPUT_ITERATOR>
+    typename bsl::enable_if<!bsl::is_integral<INPUT_ITERATOR>::value>::type
+    assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Assign to this object the elements in the range specified by
+        // '[first .. last)'.  The behavior is undefined unless
+        // '[first .. last)' is a valid range that does not refer to elements
+        // of this vector.
+
+                                 // Iterators
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator to the first element of this vector, or 'end()'
+        // if this vector is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator of this vector.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator to the last element of this vector, or
+        // 'rend()' if this vector is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator of this vector.
+
+                              // Element Access
+
+    reference operator[](size_type position);
+        // Return a reference to the element at the specified 'position'.  The
+        // behavior is undefined unless 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference to the element at the specified 'position'.
+        // Throw 'bsl::out_of_range' if 'size() <= position'.
+
+    reference front();
+        // Return a reference to the first element.  The behavior is undefined
+        // unless this vector is not empty.
+
+    reference back();
+        // Return a reference to the last element.  The behavior is undefined
+        // unless this vector is not empty.
+
+    VALUE_TYPE *data() BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the first element of this vector.
+
+                                 // Modifiers
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    reference emplace_back(ARGS&&... arguments);
+        // Append to the end of this vector an element constructed by
+        // forwarding the allocator of this vector (if 'VALUE_TYPE' is
+        // allocator-aware) and the specified 'arguments' to the constructor
+        // of 'VALUE_TYPE', and return a reference to it.
+
+    template <class... ARGS>
+    iterator emplace(const_iterator position, ARGS&&... arguments);
+        // Insert, at the specified 'position', an element constructed by
+        // forwarding the allocator of this vector (if 'VALUE_TYPE' is
+        // allocator-aware) and the specified 'arguments' to the constructor
+        // of 'VALUE_TYPE', and return an iterator to it.  The behavior is
+        // undefined unless 'position' is in '[begin() .. end()]'.
+#endif
+
+    void push_back(const VALUE_TYPE& value);
+    void push_back(bslmf::MovableRef<VALUE_TYPE> value);
+        // Append to the end of this vector the specified 'value' (copied or
+        // moved, as appropriate).  Note that a copied 'value' may refer to an
+        // element of this vector.
+
+    void pop_back();
+        // Erase the last element of this vector.  The behavior is undefined
+        // if this vector is empty.
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+    iterator insert(const_iterator                position,
+                    bslmf::MovableRef<VALUE_TYPE> value);
+        // Insert the specified 'value' (copied or moved, as appropriate) at
+        // the specified 'position', and return an iterator to the new
+        // element.  The behavior is undefined unless 'position' is in
+        // '[begin() .. end()]'.  Note that a copied 'value' may refer to an
+        // element of this vector.
+
+    iterator insert(const_iterator    position,
+                    size_type         numElements,
+                    const VALUE_TYPE& value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // at the specified 'position', and return an iterator to the first
+        // new element, or 'position' if 'numElements' is 0.  The behavior is
+        // undefined unless 'position' is in '[begin() .. end()]'.  Note that
+        // 'value' may refer to an element of this vector.
+
+    template <class INPUT_ITERATOR>
+    typename bsl::enable_if<!bsl::is_integral<INPUT_ITERATOR>::value,
+                            iterator>::type
+    insert(const_iterator position, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert the elements in the range specified by '[first .. last)' at
+        // the specified 'position', and return an iterator to the first new
+        // element, or 'position' if the range is empty.  The behavior is
+        // undefined unless 'position' is in '[begin() .. end()]' and
+        // '[first .. last)' is a valid range that does not refer to elements
+        // of this vector.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    iterator insert(const_iterator                    position,
+                    std::initializer_list<VALUE_TYPE> values);
+        // Insert the specified 'values' at the specified 'position', and
+        // return an iterator to the first new element, or 'position' if
+        // 'values' is empty.  The behavior is undefined unless 'position' is
+        // in '[begin() .. end()]'.
+#endif
+
+    iterator erase(const_iterator position);
+        // Erase the element at the specified 'position', and return an
+        // iterator to the element that followed it.  The behavior is
+        // undefined unless 'position' is in '[begin() .. end())'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the elements in the range specified by '[first .. last)', and
+        // return an iterator to the element that followed them.  The behavior
+        // is undefined unless '[first .. last)' is a valid range of elements
+        // of this vector.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Erase all elements of this vector.  Note that the capacity is not
+        // changed.
+
+    void resize(size_type newSize);
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end or appending value-initialized elements or
+        // copies of the optionally specified 'value', as necessary.
+
+    void reserve(size_type newCapacity);
+        // Ensure that this vector can hold at least the specified
+        // 'newCapacity' elements without allocating memory.  Throw
+        // 'bsl::length_error' if 'max_size() < newCapacity'.
+
+    void shrink_to_fit();
+        // Reduce the memory used by this vector to the minimum needed for its
+        // elements, moving them to the inline storage if they fit in it.
+
+    void swap(SmallVector& other);
+        // Exchange the value of this object with that of the specified
+        // 'other' object.  This method takes constant time if the elements of
+        // both objects are in allocated memory, and otherwise time linear in
+        // the number of inline elements.  The behavior is undefined unless
+        // this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this vector to supply memory.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // element of this vector, or 'end()' if this vector is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this vector.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element of this vector, or 'rend()' if this vector is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this vector.
+
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position'.  The behavior is undefined unless
+        // 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position'.  Throw 'bsl::out_of_range' if
+        // 'size() <= position'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element.  The behavior is undefined unless this vector is not
+        // empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element.  The behavior is undefined unless this vector is not
+        // empty.
+
+    const VALUE_TYPE *data() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the address providing non-modifiable access to the first
+        // element of this vector.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this vector can hold without
+        // allocating memory.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this vector has no elements, and 'false'
+        // otherwise.
+
+    bool isInline() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if the elements of this vector are in its inline
+        // storage, and 'false' if they are in allocated memory.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the maximum possible size of this vector.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this vector.
+
+                                  // Aspects
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level' and return a
+        // reference to 'stream'.  If 'level' is specified, optionally specify
+        // 'spacesPerLevel', the number of spaces per indentation level for
+        // this and all of its nested objects.  If 'level' is negative,
+        // suppress indentation of the first line.  If 'spacesPerLevel' is
+        // negative, format the entire output on one line, suppressing all but
+        // the initial indentation (as governed by 'level').  If 'stream' is
+        // not valid on entry, this operation has no effect.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator==(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'SmallVector' objects have the same
+    // value if they have the same size and each element of one is equal to
+    // the element at the same position in the other.
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator!=(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'SmallVector' objects do not
+    // have the same value if they do not have the same size or some element
+    // of one is not equal to the element at the same position in the other.
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator<(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs);
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator>(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs);
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator<=(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs);
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator>=(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than, greater than, less than or equal to, or
+    // greater than or equal to (respectively) the value of the specified
+    // 'rhs' vector, and 'false' otherwise.
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+bsl::ostream& operator<<(
+                     bsl::ostream&                                   stream,
+                     const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& vector);
+    // Write the value of the specified 'vector' to the specified output
+    // 'stream' in a single-line format, and return a reference providing
+    // modifiable access to 'stream'.  If 'stream' is not valid on entry, this
+    // operation has no effect.  Note that this human-readable format is not
+    // fully specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+void swap(SmallVector<VALUE_TYPE, INLINE_CAPACITY>& a,
+          SmallVector<VALUE_TYPE, INLINE_CAPACITY>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This
+    // function provides the basic exception-safety guarantee, and is
+    // efficient (see 'SmallVector::swap') if the two objects were created
+    // with the same allocator.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class SmallVector
+                             // -----------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::adoptStorage(
+                                                        VALUE_TYPE *data,
+                                                        size_type   capacity,
+                                                        size_type   size)
+{
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_dataBegin_p);
+    }
+    d_dataBegin_p = data;
+    d_dataEnd_p   = data + size;
+    d_capacity    = capacity;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+VALUE_TYPE *SmallVector<VALUE_TYPE, INLINE_CAPACITY>::allocateStorage(
+                                                            size_type capacity)
+{
+    return static_cast<VALUE_TYPE *>(
+                       d_allocator_p->allocate(capacity * sizeof(VALUE_TYPE)));
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+VALUE_TYPE *SmallVector<VALUE_TYPE, INLINE_CAPACITY>::inlineData()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::insertRange(
+                                             const_iterator          position,
+                                             INPUT_ITERATOR          first,
+                                             INPUT_ITERATOR          last,
+                                             bsl::input_iterator_tag)
+{
+    // The length of the range is not known in advance, so append the new
+    // elements, then rotate them into place.
+
+    const size_type index   = position - cbegin();
+    const size_type oldSize = size();
+
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+    ArrayPrimitives::rotate(begin() + index, begin() + oldSize, end());
+    return begin() + index;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+template <class FORWARD_ITERATOR>
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::insertRange(
+                                           const_iterator            position,
+                                           FORWARD_ITERATOR          first,
+                                           FORWARD_ITERATOR          last,
+                                           bsl::forward_iterator_tag)
+{
+    const size_type index       = position - cbegin();
+    const size_type numElements = bsl::distance(first, last);
+    const size_type newSize     = size() + numElements;
+    VALUE_TYPE     *pos         = d_dataBegin_p + index;
+
+    if (newSize <= d_capacity) {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                first,
+                                last,
+                                numElements,
+                                d_allocator_p);
+        d_dataEnd_p += numElements;
+        return pos;                                                   // RETURN
+    }
+
+    const size_type newCapacity = computeNewCapacity(newSize);
+    VALUE_TYPE     *newData     = allocateStorage(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                              &d_dataEnd_p,
+                                              d_dataBegin_p,
+                                              pos,
+                                              d_dataEnd_p,
+                                              first,
+                                              last,
+                                              numElements,
+                                              d_allocator_p);
+    proctor.release();
+    adoptStorage(newData, newCapacity, newSize);
+    return d_dataBegin_p + index;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+template <class ARG_TYPE>
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::insertWithGrowth(
+                       const_iterator                              position,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(ARG_TYPE) argument)
+{
+    const size_type index       = position - cbegin();
+    const size_type newSize     = size() + 1;
+    const size_type newCapacity = computeNewCapacity(newSize);
+    VALUE_TYPE     *newData     = allocateStorage(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    // The new element is constructed before any element is moved, so that
+    // 'argument' may refer to an element of this vector.
+
+    ArrayPrimitives::destructiveMoveAndEmplace(
+                            newData,
+                            &d_dataEnd_p,
+                            d_dataBegin_p,
+                            d_dataBegin_p + index,
+                            d_dataEnd_p,
+                            StdAllocator(d_allocator_p),
+                            BSLS_COMPILERFEATURES_FORWARD(ARG_TYPE, argument));
+    proctor.release();
+    adoptStorage(newData, newCapacity, newSize);
+    return d_dataBegin_p + index;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reallocate(
+                                                         size_type newCapacity)
+{
+    BSLS_ASSERT_SAFE(size() <= newCapacity);
+
+    const size_type oldSize = size();
+    VALUE_TYPE     *newData = allocateStorage(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     d_allocator_p);
+    proctor.release();
+    adoptStorage(newData, newCapacity, oldSize);
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::size_type
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::computeNewCapacity(
+                                                       size_type newSize) const
+{
+    const size_type maxSize = max_size();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(maxSize < newSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwLengthError(
+                                     "SmallVector<...>: vector too long");
+    }
+
+    const size_type doubled = maxSize / 2 < d_capacity ? maxSize
+                                                       : 2 * d_capacity;
+
+    return newSize < doubled ? doubled : newSize;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const VALUE_TYPE *SmallVector<VALUE_TYPE, INLINE_CAPACITY>::inlineData() const
+{
+    return reinterpret_cast<const VALUE_TYPE *>(d_buffer.buffer());
+}
+
+// CLASS METHODS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::size_type
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::inlineCapacity()
+{
+    return INLINE_CAPACITY;
+}
+
+// CREATORS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector()
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator())
+{
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bslma::Allocator *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector(
+                                             size_type         initialSize,
+                                             bslma::Allocator *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    resize(initialSize);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector(
+                                            size_type          initialSize,
+                                            const VALUE_TYPE&  value,
+                                            bslma::Allocator  *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    resize(initialSize, value);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector(
+                INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator,
+                typename bsl::enable_if<
+                            !bsl::is_integral<INPUT_ITERATOR>::value>::type *)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Build the elements in a fully constructed object, which releases them
+    // if an exception is thrown.
+
+    SmallVector temp(d_allocator_p);
+    temp.insert(temp.cend(), first, last);
+    *this = MoveUtil::move(temp);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector(
+                             std::initializer_list<VALUE_TYPE>  values,
+                             bslma::Allocator                  *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (INLINE_CAPACITY < values.size()) {
+        d_dataBegin_p = allocateStorage(values.size());
+        d_dataEnd_p   = d_dataBegin_p;
+        d_capacity    = values.size();
+    }
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                      isInline() ? 0 : d_dataBegin_p,
+                                      d_allocator_p);
+
+    ArrayPrimitives::copyConstruct(d_dataBegin_p,
+                                   values.begin(),
+                                   values.end(),
+                                   d_allocator_p);
+    proctor.release();
+    d_dataEnd_p = d_dataBegin_p + values.size();
+}
+#endif
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector(
+                                          const SmallVector&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (INLINE_CAPACITY < original.size()) {
+        d_dataBegin_p = allocateStorage(original.size());
+        d_dataEnd_p   = d_dataBegin_p;
+        d_capacity    = original.size();
+    }
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                      isInline() ? 0 : d_dataBegin_p,
+                                      d_allocator_p);
+
+    ArrayPrimitives::copyConstruct(d_dataBegin_p,
+                                   original.begin(),
+                                   original.end(),
+                                   d_allocator_p);
+    proctor.release();
+    d_dataEnd_p = d_dataBegin_p + original.size();
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector(
+                                       bslmf::MovableRef<SmallVector> original)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    SmallVector& lvalue = original;
+
+    if (lvalue.isInline()) {
+        ArrayPrimitives::destructiveMove(d_dataBegin_p,
+                                         lvalue.d_dataBegin_p,
+                                         lvalue.d_dataEnd_p,
+                                         d_allocator_p);
+        d_dataEnd_p = d_dataBegin_p + lvalue.size();
+    }
+    else {
+        d_dataBegin_p = lvalue.d_dataBegin_p;
+        d_dataEnd_p   = lvalue.d_dataEnd_p;
+        d_capacity    = lvalue.d_capacity;
+
+        lvalue.d_dataBegin_p = lvalue.inlineData();
+        lvalue.d_capacity    = INLINE_CAPACITY;
+    }
+    lvalue.d_dataEnd_p = lvalue.d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::SmallVector(
+                              bslmf::MovableRef<SmallVector>  original,
+                              bslma::Allocator               *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    SmallVector& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        *this = MoveUtil::move(lvalue);
+    }
+    else {
+        if (INLINE_CAPACITY < lvalue.size()) {
+            d_dataBegin_p = allocateStorage(lvalue.size());
+            d_dataEnd_p   = d_dataBegin_p;
+            d_capacity    = lvalue.size();
+        }
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(
+                                          isInline() ? 0 : d_dataBegin_p,
+                                          d_allocator_p);
+
+        ArrayPrimitives::moveConstruct(d_dataBegin_p,
+                                       lvalue.d_dataBegin_p,
+                                       lvalue.d_dataEnd_p,
+                                       d_allocator_p);
+        proctor.release();
+        d_dataEnd_p = d_dataBegin_p + lvalue.size();
+    }
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::~SmallVector()
+{
+    DestructionUtil::destroy(d_dataBegin_p, d_dataEnd_p);
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_dataBegin_p);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>&
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs) {
+        assign(rhs.begin(), rhs.end());
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>&
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::operator=(
+                                            bslmf::MovableRef<SmallVector> rhs)
+{
+    SmallVector& lvalue = rhs;
+
+    if (this == &lvalue) {
+        return *this;                                                 // RETURN
+    }
+
+    if (d_allocator_p != lvalue.d_allocator_p) {
+        clear();
+        reserve(lvalue.size());
+        ArrayPrimitives::moveConstruct(d_dataBegin_p,
+                                       lvalue.d_dataBegin_p,
+                                       lvalue.d_dataEnd_p,
+                                       d_allocator_p);
+        d_dataEnd_p = d_dataBegin_p + lvalue.size();
+        return *this;                                                 // RETURN
+    }
+
+    clear();
+    if (lvalue.isInline()) {
+        // The elements of 'lvalue' fit in the storage of this vector, which
+        // is at least as large as the inline storage.
+
+        ArrayPrimitives::destructiveMove(d_dataBegin_p,
+                                         lvalue.d_dataBegin_p,
+                                         lvalue.d_dataEnd_p,
+                                         d_allocator_p);
+        d_dataEnd_p = d_dataBegin_p + lvalue.size();
+    }
+    else {
+        adoptStorage(lvalue.d_dataBegin_p, lvalue.d_capacity, lvalue.size());
+
+        lvalue.d_dataBegin_p = lvalue.inlineData();
+        lvalue.d_capacity    = INLINE_CAPACITY;
+    }
+    lvalue.d_dataEnd_p = lvalue.d_dataBegin_p;
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>&
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::operator=(
+                                      std::initializer_list<VALUE_TYPE> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    if (numElements <= d_capacity) {
+        // 'value' may refer to an element of this vector, so assign over the
+        // common prefix before erasing any element.
+
+        const size_type common = numElements < size() ? numElements : size();
+        bsl::fill(d_dataBegin_p, d_dataBegin_p + common, value);
+        if (numElements < size()) {
+            erase(d_dataBegin_p + numElements, d_dataEnd_p);
+        }
+        else {
+            resize(numElements, value);
+        }
+        return;                                                       // RETURN
+    }
+
+    const size_type newCapacity = computeNewCapacity(numElements);
+    VALUE_TYPE     *newData     = allocateStorage(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::uninitializedFillN(newData,
+                                        numElements,
+                                        value,
+                                        d_allocator_p);
+    proctor.release();
+    clear();
+    adoptStorage(newData, newCapacity, numElements);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+typename bsl::enable_if<!bsl::is_integral<INPUT_ITERATOR>::value>::type
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::assign(INPUT_ITERATOR first,
+                                                 INPUT_ITERATOR last)
+{
+    clear();
+    insert(cend(), first, last);
+}
+
+                                 // Iterators
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::rbegin() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+                              // Element Access
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::operator[](size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size() <= position)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwOutOfRange(
+                                  "SmallVector<...>::at(n): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+VALUE_TYPE *SmallVector<VALUE_TYPE, INLINE_CAPACITY>::data()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+                                 // Modifiers
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+template <class... ARGS>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::emplace_back(ARGS&&... arguments)
+{
+    return *emplace(cend(), BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+template <class... ARGS>
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::emplace(const_iterator position,
+                                                  ARGS&&...      arguments)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const size_type index = position - cbegin();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        if (position == cend()) {
+            bslma::ConstructionUtil::construct(
+                            d_dataEnd_p,
+                            d_allocator_p,
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+        }
+        else {
+            ArrayPrimitives::emplace(
+                            d_dataBegin_p + index,
+                            d_dataEnd_p,
+                            d_allocator_p,
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+        }
+        ++d_dataEnd_p;
+        return d_dataBegin_p + index;                                 // RETURN
+    }
+
+    const size_type newSize     = size() + 1;
+    const size_type newCapacity = computeNewCapacity(newSize);
+    VALUE_TYPE     *newData     = allocateStorage(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::destructiveMoveAndEmplace(
+                            newData,
+                            &d_dataEnd_p,
+                            d_dataBegin_p,
+                            d_dataBegin_p + index,
+                            d_dataEnd_p,
+                            StdAllocator(d_allocator_p),
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    proctor.release();
+    adoptStorage(newData, newCapacity, newSize);
+    return d_dataBegin_p + index;
+}
+#endif
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::push_back(
+                                                       const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        bslma::ConstructionUtil::construct(d_dataEnd_p, d_allocator_p, value);
+        ++d_dataEnd_p;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        insertWithGrowth(cend(), value);
+    }
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::push_back(
+                                           bslmf::MovableRef<VALUE_TYPE> value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        bslma::ConstructionUtil::construct(d_dataEnd_p,
+                                           d_allocator_p,
+                                           MoveUtil::move(value));
+        ++d_dataEnd_p;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        insertWithGrowth(cend(), MoveUtil::move(value));
+    }
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_dataEnd_p;
+    bslma::DestructionUtil::destroy(d_dataEnd_p);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::insert(const_iterator    position,
+                                                 const VALUE_TYPE& value)
+{
+    return insert(position, size_type(1), value);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::insert(
+                                        const_iterator                position,
+                                        bslmf::MovableRef<VALUE_TYPE> value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_capacity == size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return insertWithGrowth(position, MoveUtil::move(value));     // RETURN
+    }
+
+    VALUE_TYPE *pos = d_dataBegin_p + (position - cbegin());
+    ArrayPrimitives::insert(pos,
+                            d_dataEnd_p,
+                            MoveUtil::move(value),
+                            d_allocator_p);
+    ++d_dataEnd_p;
+    return pos;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::insert(const_iterator    position,
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const size_type index   = position - cbegin();
+    const size_type newSize = size() + numElements;
+    VALUE_TYPE     *pos     = d_dataBegin_p + index;
+
+    if (newSize <= d_capacity) {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                value,
+                                numElements,
+                                d_allocator_p);
+        d_dataEnd_p += numElements;
+        return pos;                                                   // RETURN
+    }
+
+    const size_type newCapacity = computeNewCapacity(newSize);
+    VALUE_TYPE     *newData     = allocateStorage(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                              &d_dataEnd_p,
+                                              d_dataBegin_p,
+                                              pos,
+                                              d_dataEnd_p,
+                                              value,
+                                              numElements,
+                                              d_allocator_p);
+    proctor.release();
+    adoptStorage(newData, newCapacity, newSize);
+    return d_dataBegin_p + index;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+typename bsl::enable_if<
+    !bsl::is_integral<INPUT_ITERATOR>::value,
+    typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator>::type
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                                 INPUT_ITERATOR first,
+                                                 INPUT_ITERATOR last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    typedef typename bsl::iterator_traits<INPUT_ITERATOR>::iterator_category
+                                                                      Category;
+
+    return insertRange(position, first, last, Category());
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::insert(
+                                   const_iterator                    position,
+                                   std::initializer_list<VALUE_TYPE> values)
+{
+    return insert(position, values.begin(), values.end());
+}
+#endif
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position < cend());
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::erase(const_iterator first,
+                                                const_iterator last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= cend());
+
+    VALUE_TYPE     *pos         = d_dataBegin_p + (first - cbegin());
+    const size_type numElements = last - first;
+
+    ArrayPrimitives::erase(pos, pos + numElements, d_dataEnd_p, d_allocator_p);
+    d_dataEnd_p -= numElements;
+    return pos;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    DestructionUtil::destroy(d_dataBegin_p, d_dataEnd_p);
+    d_dataEnd_p = d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::resize(size_type newSize)
+{
+    if (newSize <= size()) {
+        DestructionUtil::destroy(d_dataBegin_p + newSize, d_dataEnd_p);
+        d_dataEnd_p = d_dataBegin_p + newSize;
+    }
+    else if (newSize <= d_capacity) {
+        ArrayPrimitives::defaultConstruct(d_dataEnd_p,
+                                          newSize - size(),
+                                          d_allocator_p);
+        d_dataEnd_p = d_dataBegin_p + newSize;
+    }
+    else {
+        const size_type newCapacity = computeNewCapacity(newSize);
+        VALUE_TYPE     *newData     = allocateStorage(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(newData,
+                                                            d_allocator_p);
+
+        ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                                  &d_dataEnd_p,
+                                                  d_dataBegin_p,
+                                                  d_dataEnd_p,
+                                                  d_dataEnd_p,
+                                                  newSize - size(),
+                                                  d_allocator_p);
+        proctor.release();
+        adoptStorage(newData, newCapacity, newSize);
+    }
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::resize(
+                                                     size_type         newSize,
+                                                     const VALUE_TYPE& value)
+{
+    if (newSize <= size()) {
+        DestructionUtil::destroy(d_dataBegin_p + newSize, d_dataEnd_p);
+        d_dataEnd_p = d_dataBegin_p + newSize;
+    }
+    else {
+        insert(cend(), newSize - size(), value);
+    }
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::reserve(size_type newCapacity)
+{
+    if (d_capacity < newCapacity) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(max_size() < newCapacity)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            bslstl::StdExceptUtil::throwLengthError(
+                        "SmallVector<...>::reserve(n): capacity too large");
+        }
+        reallocate(newCapacity);
+    }
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::shrink_to_fit()
+{
+    if (isInline() || size() == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (size() <= INLINE_CAPACITY) {
+        const size_type oldSize = size();
+
+        ArrayPrimitives::destructiveMove(inlineData(),
+                                         d_dataBegin_p,
+                                         d_dataEnd_p,
+                                         d_allocator_p);
+        adoptStorage(inlineData(), INLINE_CAPACITY, oldSize);
+    }
+    else {
+        reallocate(size());
+    }
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<VALUE_TYPE, INLINE_CAPACITY>::swap(SmallVector& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    if (!isInline() && !other.isInline()) {
+        bsl::swap(d_dataBegin_p, other.d_dataBegin_p);
+        bsl::swap(d_dataEnd_p,   other.d_dataEnd_p);
+        bsl::swap(d_capacity,    other.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    // At least one of the vectors holds its elements inline, and so must
+    // relocate them.  Moving within a single allocator relocates the inline
+    // elements and transfers the allocated storage.
+
+    SmallVector temp(MoveUtil::move(*this));
+    *this = MoveUtil::move(other);
+    other = MoveUtil::move(temp);
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bslma::Allocator *SmallVector<VALUE_TYPE, INLINE_CAPACITY>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::crbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::at(size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size() <= position)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwOutOfRange(
+                            "SmallVector<...>::at(n) const: invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const VALUE_TYPE *SmallVector<VALUE_TYPE, INLINE_CAPACITY>::data() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::size_type
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<VALUE_TYPE, INLINE_CAPACITY>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p == d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<VALUE_TYPE, INLINE_CAPACITY>::isInline() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p == inlineData();
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::size_type
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return bsl::numeric_limits<size_type>::max() / sizeof(VALUE_TYPE);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<VALUE_TYPE, INLINE_CAPACITY>::size_type
+SmallVector<VALUE_TYPE, INLINE_CAPACITY>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p - d_dataBegin_p;
+}
+
+                                  // Aspects
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+bsl::ostream& SmallVector<VALUE_TYPE, INLINE_CAPACITY>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    for (const_iterator iter = begin(); iter != end(); ++iter) {
+        printer.printValue(*iter);
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator==(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs)
+{
+    return bslalg::RangeCompare::equal(lhs.begin(),
+                                       lhs.end(),
+                                       lhs.size(),
+                                       rhs.begin(),
+                                       rhs.end(),
+                                       rhs.size());
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator!=(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator<(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                     const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs)
+{
+    return 0 > bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                     lhs.end(),
+                                                     lhs.size(),
+                                                     rhs.begin(),
+                                                     rhs.end(),
+                                                     rhs.size());
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator>(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                     const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator<=(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator>=(const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::ostream& bdlc::operator<<(
+                      bsl::ostream&                                   stream,
+                      const SmallVector<VALUE_TYPE, INLINE_CAPACITY>& vector)
+{
+    return vector.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+void bdlc::swap(SmallVector<VALUE_TYPE, INLINE_CAPACITY>& a,
+                SmallVector<VALUE_TYPE, INLINE_CAPACITY>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    SmallVector<VALUE_TYPE, INLINE_CAPACITY> futureA(b, a.allocator());
+    SmallVector<VALUE_TYPE, INLINE_CAPACITY> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+struct HasStlIterators<bdlc::SmallVector<VALUE_TYPE, INLINE_CAPACITY> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class VALUE_TYPE, bsl::size_t INLINE_CAPACITY>
+struct UsesBslmaAllocator<bdlc::SmallVector<VALUE_TYPE, INLINE_CAPACITY> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1496 @@
+// bdlc_smallvector.t.cpp                                             -*-C++-*-
+
+#include <bdlc_smallvector.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_sstream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a sequence container that stores a fixed
+// number of elements inline before spilling to allocated memory.  Since
+// 'bsl::vector' provides the same sequence operations with the same
+// semantics, most test cases compare the object under test with a
+// 'bsl::vector' model after applying the same operations to both.  The
+// concerns specific to this component are that no memory is allocated while
+// the elements fit in the inline storage, that the transitions between the
+// inline storage and allocated memory (on growth, move, swap, and
+// 'shrink_to_fit') preserve the elements, that every element of an
+// allocator-aware type uses the allocator of the vector, and that no memory
+// is leaked when an exception is thrown.  Elements of type 'bsl::string'
+// holding long strings are used throughout, so that each element allocates.
+//
+// Primary Manipulators:
+//: o 'push_back'
+//: o 'clear'
+//
+// Basic Accessors:
+//: o 'allocator'
+//: o 'begin'
+//: o 'capacity'
+//: o 'end'
+//: o 'isInline'
+//: o 'size'
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static size_type inlineCapacity();
+//
+// CREATORS
+// [ 2] SmallVector();
+// [ 2] explicit SmallVector(bslma::Allocator *basicAllocator);
+// [ 3] explicit SmallVector(size_type, Allocator * = 0);
+// [ 3] SmallVector(size_type, const VALUE_TYPE&, Allocator * = 0);
+// [ 3] SmallVector(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+// [ 3] SmallVector(initializer_list<VALUE_TYPE>, Allocator * = 0);
+// [ 3] SmallVector(const SmallVector&, Allocator *basicAllocator = 0);
+// [ 3] SmallVector(SmallVector&&);
+// [ 3] SmallVector(SmallVector&&, Allocator *basicAllocator);
+// [ 2] ~SmallVector();
+//
+// MANIPULATORS
+// [ 3] SmallVector& operator=(const SmallVector&);
+// [ 3] SmallVector& operator=(SmallVector&&);
+// [ 3] SmallVector& operator=(initializer_list<VALUE_TYPE>);
+// [ 3] void assign(size_type, const VALUE_TYPE&);
+// [ 3] void assign(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] reference emplace_back(Args&&...);
+// [ 4] iterator emplace(const_iterator, Args&&...);
+// [ 2] void push_back(const VALUE_TYPE&);
+// [ 2] void push_back(VALUE_TYPE&&);
+// [ 2] void pop_back();
+// [ 4] iterator insert(const_iterator, const VALUE_TYPE&);
+// [ 4] iterator insert(const_iterator, VALUE_TYPE&&);
+// [ 4] iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+// [ 4] iterator insert(const_iterator, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] iterator insert(const_iterator, initializer_list<VALUE_TYPE>);
+// [ 4] iterator erase(const_iterator);
+// [ 4] iterator erase(const_iterator, const_iterator);
+// [ 2] void clear();
+// [ 5] void resize(size_type);
+// [ 5] void resize(size_type, const VALUE_TYPE&);
+// [ 5] void reserve(size_type);
+// [ 5] void shrink_to_fit();
+// [ 5] void swap(SmallVector&);
+//
+// [ 2] reference operator[](size_type);
+// [ 5] reference at(size_type);
+// [ 2] reference front();
+// [ 2] reference back();
+// [ 2] VALUE_TYPE *data();
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 5] const_reverse_iterator rbegin() const;
+// [ 5] const_reverse_iterator rend() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool empty() const;
+// [ 2] bool isInline() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+// [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const SmallVector&, const SmallVector&);
+// [ 5] bool operator!=(const SmallVector&, const SmallVector&);
+// [ 5] bool operator<(const SmallVector&, const SmallVector&);
+// [ 5] bool operator>(const SmallVector&, const SmallVector&);
+// [ 5] bool operator<=(const SmallVector&, const SmallVector&);
+// [ 5] bool operator>=(const SmallVector&, const SmallVector&);
+// [ 5] ostream& operator<<(ostream&, const SmallVector&);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(SmallVector&, SmallVector&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                    GLOBAL TYPEDEFS AND HELPERS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::SmallVector<bsl::string, 4> Obj;
+typedef bsl::vector<bsl::string>          Model;
+typedef bslmf::MovableRefUtil             MoveUtil;
+
+static unsigned int nextRandom(unsigned int *state)
+    // Return the next value of a pseudo-random sequence whose state is held
+    // in the specified 'state', and update 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xffffff;
+}
+
+static bsl::string makeValue(int value)
+    // Return a string, long enough to allocate memory, that is unique to the
+    // specified 'value'.
+{
+    bsl::ostringstream stream;
+    stream << "A string that is long enough to allocate: " << value;
+    return bsl::string(stream.str(), bslma::Default::allocator());
+}
+
+template <class VECTOR, class MODEL>
+bool matches(const VECTOR& vector, const MODEL& model)
+    // Return 'true' if the specified 'vector' has the same sequence of
+    // elements, in both forward and reverse order, as the specified 'model',
+    // and 'false' otherwise.
+{
+    return vector.size() == model.size()
+        && bsl::equal(vector.begin(), vector.end(), model.begin())
+        && bsl::equal(vector.rbegin(), vector.rend(), model.rbegin());
+}
+
+template <class VECTOR>
+bool usesAllocator(const VECTOR& vector, bslma::Allocator *allocator)
+    // Return 'true' if each element of the specified 'vector' uses the
+    // specified 'allocator', and 'false' otherwise.
+{
+    for (typename VECTOR::const_iterator it = vector.begin();
+         it != vector.end();
+         ++it) {
+        if (it->get_allocator().mechanism() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class ITERATOR>
+class InputIterator {
+    // This class adapts the (template parameter) 'ITERATOR' to provide only
+    // the operations of an input iterator, so that tests can verify that
+    // single-pass ranges are supported.
+
+    // DATA
+    ITERATOR d_it;
+
+  public:
+    // TYPES
+    typedef bsl::iterator_traits<ITERATOR>         Traits;
+
+    typedef bsl::input_iterator_tag                iterator_category;
+    typedef typename Traits::value_type            value_type;
+    typedef typename Traits::difference_type       difference_type;
+    typedef typename Traits::pointer               pointer;
+    typedef typename Traits::reference             reference;
+
+    // CREATORS
+    explicit InputIterator(ITERATOR it) : d_it(it) {}
+        // Create an iterator adapting the specified 'it'.
+
+    // MANIPULATORS
+    InputIterator& operator++()
+        // Advance this iterator, and return a reference providing modifiable
+        // access to it.
+    {
+        ++d_it;
+        return *this;
+    }
+
+    // ACCESSORS
+    reference operator*() const
+        // Return the element referred to by this iterator.
+    {
+        return *d_it;
+    }
+
+    bool operator!=(const InputIterator& rhs) const
+        // Return 'true' if this iterator does not refer to the same position
+        // as the specified 'rhs', and 'false' otherwise.
+    {
+        return d_it != rhs.d_it;
+    }
+};
+
+static bsls::Types::Int64 s_antiOptimization = 0;
+
+static double nanoseconds(const bsls::TimeInterval& interval)
+    // Return the specified 'interval' in nanoseconds.
+{
+    return static_cast<double>(interval.totalNanoseconds());
+}
+
+template <class VECTOR>
+bsls::TimeInterval performanceFill(int numVectors, int numElements)
+    // Create, fill with the specified 'numElements' integers, and destroy the
+    // specified 'numVectors' objects of the (template parameter) type
+    // 'VECTOR', and return the duration.
+{
+    bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+    for (int i = 0; i < numVectors; ++i) {
+        VECTOR vector;
+        for (int j = 0; j < numElements; ++j) {
+            vector.push_back(i + j);
+        }
+        s_antiOptimization += vector.back();
+    }
+
+    return bsls::SystemTime::nowMonotonicClock() - start;
+}
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Splitting a Path into Its Components
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we split file-system paths into their components, and that nearly
+// all the paths we see have no more than eight components.  Collecting the
+// components in a 'bdlc::SmallVector' with an inline capacity of eight avoids
+// any allocation for those paths, while still handling longer ones.
+//
+// First, we define the function that splits a path:
+//..
+    typedef bdlc::SmallVector<bslstl::StringRef, 8> Components;
+
+    void splitPath(Components *result, const bslstl::StringRef& path)
+        // Load into the specified 'result' the non-empty components of the
+        // specified 'path', separated by '/'.
+    {
+        result->clear();
+
+        const char *begin = path.begin();
+        for (const char *it = path.begin(); it != path.end(); ++it) {
+            if ('/' == *it) {
+                if (begin != it) {
+                    result->push_back(bslstl::StringRef(begin, it));
+                }
+                begin = it + 1;
+            }
+        }
+        if (begin != path.end()) {
+            result->push_back(bslstl::StringRef(begin, path.end()));
+        }
+    }
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we split a short path, and observe that no memory is allocated:
+//..
+    bslma::TestAllocator ta;
+    Components           components(&ta);
+
+    splitPath(&components, "/usr/local/lib");
+
+    ASSERT(3       == components.size());
+    ASSERT("local" == components[1]);
+    ASSERT(components.isInline());
+    ASSERT(0       == ta.numBlocksTotal());
+//..
+// Finally, we split a long path, which spills to allocated memory:
+//..
+    splitPath(&components, "a/b/c/d/e/f/g/h/i/j");
+
+    ASSERT(10  == components.size());
+    ASSERT("j" == components.back());
+    ASSERT(!components.isInline());
+    ASSERT(1   == ta.numBlocksInUse());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RESIZE, CAPACITY, SWAP, COMPARISON, AND PRINT
+        //
+        // Concerns:
+        //: 1 'resize' appends value-initialized elements or copies of the
+        //:   supplied value, or destroys trailing elements, allocating only
+        //:   when the capacity is exceeded.
+        //:
+        //: 2 'reserve' allocates only when the requested capacity exceeds the
+        //:   current capacity, and 'shrink_to_fit' returns the elements to the
+        //:   inline storage when they fit, and otherwise reduces the capacity
+        //:   to the size.
+        //:
+        //: 3 'swap' exchanges the values of vectors of any sizes, whether the
+        //:   elements are inline or allocated, and the free 'swap' also
+        //:   supports vectors having different allocators.
+        //:
+        //: 4 The equality and relational operators compare values
+        //:   lexicographically.
+        //:
+        //: 5 'at' throws 'bsl::out_of_range' for an invalid position.
+        //:
+        //: 6 'print' and 'operator<<' format the value as expected.
+        //
+        // Plan:
+        //: 1 Resize, reserve, and shrink vectors, and verify the values, the
+        //:   capacities, and the allocations.  (C-1..2)
+        //:
+        //: 2 Swap vectors of every pair of sizes from 0 to 7 (so that each is
+        //:   either inline or allocated), with both the member and free
+        //:   'swap', and with equal and different allocators, and verify the
+        //:   values against the model.  (C-3)
+        //:
+        //: 3 Compare vectors built from a table of specifications against
+        //:   each other, and verify that the results agree with those of the
+        //:   model.  (C-4)
+        //:
+        //: 4 Call 'at' with valid and invalid positions.  (C-5)
+        //:
+        //: 5 Print vectors and compare the output with expected strings.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void resize(size_type);
+        //   void resize(size_type, const VALUE_TYPE&);
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   void swap(SmallVector&);
+        //   reference at(size_type);
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   bool operator==(const SmallVector&, const SmallVector&);
+        //   bool operator!=(const SmallVector&, const SmallVector&);
+        //   bool operator<(const SmallVector&, const SmallVector&);
+        //   bool operator>(const SmallVector&, const SmallVector&);
+        //   bool operator<=(const SmallVector&, const SmallVector&);
+        //   bool operator>=(const SmallVector&, const SmallVector&);
+        //   ostream& operator<<(ostream&, const SmallVector&);
+        //   void swap(SmallVector&, SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RESIZE, CAPACITY, SWAP, COMPARISON, AND PRINT"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) cout << "\t'resize', 'reserve', and 'shrink_to_fit'.\n";
+        {
+            typedef bdlc::SmallVector<int, 4> IntObj;
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            mX.resize(3);
+            ASSERT(3 == X.size());
+            ASSERT(0 == X[0] && 0 == X[2]);
+            ASSERT(X.isInline());
+
+            mX.resize(6, 7);
+            ASSERT(6 == X.size());
+            ASSERT(0 == X[2] && 7 == X[3] && 7 == X[5]);
+            ASSERT(!X.isInline());
+            ASSERT(8 == X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.resize(9);
+            ASSERT(9 == X.size());
+            ASSERT(7 == X[5] && 0 == X[8]);
+            ASSERT(16 == X.capacity());
+
+            mX.resize(5);
+            ASSERT(5 == X.size());
+            ASSERT(16 == X.capacity());
+
+            mX.reserve(10);
+            ASSERT(16 == X.capacity());
+
+            mX.shrink_to_fit();
+            ASSERT(5 == X.size());
+            ASSERT(5 == X.capacity());
+            ASSERT(!X.isInline());
+            ASSERT(0 == X[0] && 7 == X[4]);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.pop_back();
+            mX.shrink_to_fit();
+            ASSERT(4 == X.size());
+            ASSERT(4 == X.capacity());
+            ASSERT(X.isInline());
+            ASSERT(0 == X[0] && 7 == X[3]);
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.reserve(4);
+            ASSERT(X.isInline());
+
+            mX.reserve(5);
+            ASSERT(!X.isInline());
+            ASSERT(5 == X.capacity());
+            ASSERT(7 == X[3]);
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                mX.reserve(X.max_size() + 1);
+            }
+            catch (const bsl::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\t'swap'.\n";
+        {
+            for (int i = 0; i <= 7; ++i) {
+                for (int j = 0; j <= 7; ++j) {
+                    for (int k = 0; k < 3; ++k) {
+                        bslma::Allocator *ALLOC = k < 2 ? &oa : &za;
+
+                        Obj mX(&oa);  const Obj& X = mX;
+                        Obj mY(ALLOC);  const Obj& Y = mY;
+                        Model mMX, mMY;
+
+                        for (int n = 0; n < i; ++n) {
+                            mX.push_back(makeValue(n));
+                            mMX.push_back(makeValue(n));
+                        }
+                        for (int n = 0; n < j; ++n) {
+                            mY.push_back(makeValue(100 + n));
+                            mMY.push_back(makeValue(100 + n));
+                        }
+
+                        if (0 == k) {
+                            mX.swap(mY);
+                        }
+                        else {
+                            swap(mX, mY);
+                        }
+                        ASSERTV(i, j, k, matches(X, mMY));
+                        ASSERTV(i, j, k, matches(Y, mMX));
+                        ASSERTV(i, j, k, &oa == X.allocator());
+                        ASSERTV(i, j, k, ALLOC == Y.allocator());
+                        ASSERTV(i, j, k, usesAllocator(X, &oa));
+                        ASSERTV(i, j, k, usesAllocator(Y, ALLOC));
+                    }
+                }
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == za.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tComparison.\n";
+        {
+            typedef bdlc::SmallVector<char, 2> CharObj;
+
+            static const char *SPECS[] = {
+                "", "A", "B", "AA", "AB", "BA", "ABC", "ABD", "ABCD",
+            };
+            const int NUM_SPECS = static_cast<int>(sizeof SPECS /
+                                                   sizeof *SPECS);
+
+            for (int ti = 0; ti < NUM_SPECS; ++ti) {
+                const bsl::string   SI(SPECS[ti], &oa);
+                const CharObj       X(SI.begin(), SI.end(), &oa);
+
+                for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                    const bsl::string SJ(SPECS[tj], &oa);
+                    const CharObj     Y(SJ.begin(), SJ.end(), &oa);
+
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                    ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                    ASSERTV(ti, tj, (SI <  SJ) == (X <  Y));
+                    ASSERTV(ti, tj, (SI >  SJ) == (X >  Y));
+                    ASSERTV(ti, tj, (SI <= SJ) == (X <= Y));
+                    ASSERTV(ti, tj, (SI >= SJ) == (X >= Y));
+                }
+            }
+        }
+
+        if (verbose) cout << "\t'at'.\n";
+        {
+            typedef bdlc::SmallVector<int, 2> IntObj;
+
+            IntObj mX(3, 5, &oa);  const IntObj& X = mX;
+
+            mX.at(2) = 6;
+            ASSERT(6 == X.at(2));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                X.at(3);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+
+        if (verbose) cout << "\t'print' and 'operator<<'.\n";
+        {
+            typedef bdlc::SmallVector<int, 2> IntObj;
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+            mX.push_back(1);
+            mX.push_back(2);
+            mX.push_back(3);
+
+            bsl::ostringstream out1(&oa);
+            out1 << X;
+            ASSERTV(out1.str(), "[ 1 2 3 ]" == out1.str());
+
+            bsl::ostringstream out2(&oa);
+            X.print(out2, 1, 2);
+            ASSERTV(out2.str(), "  [\n    1\n    2\n    3\n  ]\n" ==
+                                                                  out2.str());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERT, EMPLACE, AND ERASE
+        //
+        // Concerns:
+        //: 1 Each insertion method inserts the elements at the position,
+        //:   moving the elements to allocated memory when they no longer fit,
+        //:   and returns an iterator to the first inserted element.
+        //:
+        //: 2 Each 'erase' method removes the designated elements, and returns
+        //:   an iterator to the element that followed them.
+        //:
+        //: 3 A copied value may refer to an element of the vector, also when
+        //:   the insertion causes the elements to be moved.
+        //:
+        //: 4 Each inserted element uses the allocator of the vector.
+        //:
+        //: 5 An insertion that throws leaks no memory, and a single-element
+        //:   append leaves the vector unchanged.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of insertions and erasures to an
+        //:   object and to the model, including insertions of values
+        //:   referring to elements of the vector, comparing the two after each
+        //:   step, and verifying the returned iterators and the allocators of
+        //:   the elements.  Erase elements often enough that the size of the
+        //:   vector crosses the inline capacity many times; as a vector does
+        //:   not give up allocated memory, recreate it from time to time.
+        //:   (C-1..4)
+        //:
+        //: 2 Use the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros to inject
+        //:   exceptions into 'push_back' and range 'insert' at the inline
+        //:   capacity, and verify the value and that no memory is leaked.
+        //:   (C-5)
+        //
+        // Testing:
+        //   reference emplace_back(Args&&...);
+        //   iterator emplace(const_iterator, Args&&...);
+        //   iterator insert(const_iterator, const VALUE_TYPE&);
+        //   iterator insert(const_iterator, VALUE_TYPE&&);
+        //   iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+        //   iterator insert(const_iterator, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   iterator insert(const_iterator, initializer_list<VALUE_TYPE>);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, EMPLACE, AND ERASE" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Model VALUES;
+            for (int i = 0; i < 6; ++i) {
+                VALUES.push_back(makeValue(1000 + i));
+            }
+
+            unsigned int state = 7;
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model mM;
+
+            for (int i = 0; i < 3000; ++i) {
+                const int op  = static_cast<int>(nextRandom(&state) % 9);
+                const int pos = static_cast<int>(nextRandom(&state) %
+                                                               (X.size() + 1));
+                const int n   = static_cast<int>(nextRandom(&state) % 4);
+                const int v   = static_cast<int>(nextRandom(&state) % 50);
+
+                if (veryVeryVerbose) {
+                    T_ P_(i) P_(op) P_(pos) P_(n) P(v)
+                }
+
+                Obj::iterator it = 0;
+                switch (op) {
+                  case 0: {
+                    it = mX.insert(X.begin() + pos, makeValue(v));
+                    mM.insert(mM.begin() + pos, makeValue(v));
+                  } break;
+                  case 1: {
+                    bsl::string value(makeValue(v), &oa);
+                    it = mX.insert(X.begin() + pos, MoveUtil::move(value));
+                    mM.insert(mM.begin() + pos, makeValue(v));
+                  } break;
+                  case 2: {
+                    if (X.empty()) {
+                        it = mX.insert(X.begin(), makeValue(v));
+                        mM.insert(mM.begin(), makeValue(v));
+                    }
+                    else {
+                        // Insert a value referring to the last element.
+
+                        it = mX.insert(X.begin() + pos, X.back());
+                        mM.insert(mM.begin() + pos, mM.back());
+                    }
+                  } break;
+                  case 3: {
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+                    it = mX.emplace(X.begin() + pos, 3, 'a' + v % 26);
+#else
+                    it = mX.insert(X.begin() + pos,
+                                   bsl::string(3, 'a' + v % 26));
+#endif
+                    mM.insert(mM.begin() + pos, bsl::string(3, 'a' + v % 26));
+                  } break;
+                  case 4: {
+                    if (X.empty()) {
+                        it = mX.insert(X.begin(), makeValue(v));
+                        mM.insert(mM.begin(), makeValue(v));
+                    }
+                    else {
+                        // Insert copies of the first element.
+
+                        it = mX.insert(X.begin() + pos, n, X.front());
+                        mM.insert(mM.begin() + pos, n, mM.front());
+                    }
+                  } break;
+                  case 5: {
+                    it = mX.insert(X.begin() + pos, n, makeValue(v));
+                    mM.insert(mM.begin() + pos, n, makeValue(v));
+                  } break;
+                  case 6: {
+                    it = mX.insert(X.begin() + pos,
+                                   VALUES.begin() + v % 3,
+                                   VALUES.begin() + v % 3 + n);
+                    mM.insert(mM.begin() + pos,
+                              VALUES.begin() + v % 3,
+                              VALUES.begin() + v % 3 + n);
+                  } break;
+                  case 7: {
+                    typedef InputIterator<Model::const_iterator> InIt;
+                    it = mX.insert(X.begin() + pos,
+                                   InIt(VALUES.begin()),
+                                   InIt(VALUES.begin() + n));
+                    mM.insert(mM.begin() + pos,
+                              VALUES.begin(),
+                              VALUES.begin() + n);
+                  } break;
+                  case 8: {
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+                    mX.emplace_back(makeValue(v));
+#else
+                    mX.push_back(makeValue(v));
+#endif
+                    mM.push_back(makeValue(v));
+                    it = mX.end() - 1;
+                  } break;
+                }
+                ASSERTV(i, op, pos == it - X.begin() || 8 == op);
+                ASSERTV(i, op, matches(X, mM));
+                ASSERTV(i, op, usesAllocator(X, &oa));
+                ASSERTV(i, op, X.isInline() == (X.capacity() == 4));
+
+                if (X.size() > 10
+                 || (!X.empty() && 0 == nextRandom(&state) % 3)) {
+                    const int first = static_cast<int>(nextRandom(&state) %
+                                                                    X.size());
+                    const int count = static_cast<int>(nextRandom(&state) %
+                                                       (X.size() - first + 1));
+                    if (1 == count && nextRandom(&state) % 2) {
+                        it = mX.erase(X.begin() + first);
+                    }
+                    else {
+                        it = mX.erase(X.begin() + first,
+                                      X.begin() + first + count);
+                    }
+                    mM.erase(mM.begin() + first, mM.begin() + first + count);
+                    ASSERTV(i, first == it - X.begin());
+                    ASSERTV(i, matches(X, mM));
+                }
+
+                if (0 == i % 50) {
+                    Obj mY(X, &oa);
+                    mX = MoveUtil::move(mY);
+                    ASSERTV(i, matches(X, mM));
+                }
+            }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.clear();
+            mX.insert(X.begin(), { makeValue(1), makeValue(2) });
+            mX.insert(X.begin() + 1, { makeValue(3), makeValue(4) });
+            ASSERT(4 == X.size());
+            ASSERT(makeValue(3) == X[1] && makeValue(2) == X[3]);
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tException safety.\n";
+        {
+            const bsl::string V1 = makeValue(1);
+            const bsl::string V2 = makeValue(2);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(4, V1, &oa);  const Obj& X = mX;
+
+                const Obj::iterator OLD_BEGIN = mX.begin();
+
+                try {
+                    mX.push_back(V2);
+                }
+                catch (...) {
+                    ASSERT(4 == X.size());
+                    ASSERT(OLD_BEGIN == X.begin());
+                    ASSERT(V1 == X[3]);
+                    throw;
+                }
+                ASSERT(5 == X.size());
+                ASSERT(V2 == X[4]);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            const bsl::string VALUES[] = { V1, V2, V1, V2, V1 };
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(3, V2, &oa);  const Obj& X = mX;
+
+                mX.insert(X.begin() + 1, VALUES, VALUES + 5);
+                ASSERT(8 == X.size());
+                ASSERT(V1 == X[1] && V2 == X[2] && V2 == X[6]);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tNegative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            typedef bdlc::SmallVector<int, 4> IntObj;
+
+            IntObj mX(2, 0, &oa);  const IntObj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.erase(X.begin() + 1, X.begin()));
+            ASSERT_SAFE_FAIL(mX.insert(X.end() + 1, 0));
+            ASSERT_SAFE_PASS(mX.insert(X.end(), 0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 Each constructor creates a vector having the expected value,
+        //:   using the supplied allocator, or the default allocator if none
+        //:   is supplied, allocating only if the elements do not fit inline.
+        //:
+        //: 2 A copy has the value of the original, and a capacity equal to
+        //:   the larger of its size and the inline capacity.
+        //:
+        //: 3 Moving a vector whose elements are in allocated memory transfers
+        //:   the memory, and moving a vector whose elements are inline
+        //:   relocates them; in both cases, the source is left empty.  When
+        //:   the allocators differ, the elements are moved one by one.
+        //:
+        //: 4 Copy and move assignment produce a vector having the value of
+        //:   the source, also when assigning to itself and across the inline
+        //:   capacity in either direction.
+        //:
+        //: 5 'assign' replaces the value, and may be passed a value referring
+        //:   to an element of the vector.
+        //:
+        //: 6 A constructor that throws leaks no memory.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, and verify their values, allocators, and allocations.
+        //:   (C-1)
+        //:
+        //: 2 For source vectors of sizes from 0 to 7, copy, move, copy-assign,
+        //:   and move-assign to target vectors of sizes from 0 to 7, with the
+        //:   same and different allocators, and verify the values,
+        //:   allocators, and allocations.  (C-2..4)
+        //:
+        //: 3 Call 'assign' with a count and a value, including a value that is
+        //:   an element of the vector, and with ranges.  (C-5)
+        //:
+        //: 4 Use the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros to inject
+        //:   exceptions into the copy constructor, and the range constructor
+        //:   with an input iterator.  (C-6)
+        //
+        // Testing:
+        //   explicit SmallVector(size_type, Allocator * = 0);
+        //   SmallVector(size_type, const VALUE_TYPE&, Allocator * = 0);
+        //   SmallVector(INPUT_ITERATOR, INPUT_ITERATOR, Allocator * = 0);
+        //   SmallVector(initializer_list<VALUE_TYPE>, Allocator * = 0);
+        //   SmallVector(const SmallVector&, Allocator *basicAllocator = 0);
+        //   SmallVector(SmallVector&&);
+        //   SmallVector(SmallVector&&, Allocator *basicAllocator);
+        //   SmallVector& operator=(const SmallVector&);
+        //   SmallVector& operator=(SmallVector&&);
+        //   SmallVector& operator=(initializer_list<VALUE_TYPE>);
+        //   void assign(size_type, const VALUE_TYPE&);
+        //   void assign(INPUT_ITERATOR, INPUT_ITERATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND ASSIGNMENT" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        Model VALUES;
+        for (int i = 0; i < 8; ++i) {
+            VALUES.push_back(makeValue(i));
+        }
+
+        if (verbose) cout << "\tValue constructors.\n";
+        {
+            {
+                const Obj X(3, &oa);
+                ASSERT(3 == X.size());
+                ASSERT(X[2].empty());
+                ASSERT(X.isInline());
+                ASSERT(&oa == X.allocator());
+                ASSERT(0 == oa.numBlocksTotal());
+            }
+            {
+                const Obj X(6, VALUES[1], &oa);
+                ASSERT(6 == X.size());
+                ASSERT(VALUES[1] == X[5]);
+                ASSERT(!X.isInline());
+                ASSERT(usesAllocator(X, &oa));
+            }
+            {
+                const Obj X(VALUES.begin(), VALUES.begin() + 3, &oa);
+                ASSERT(matches(X, Model(VALUES.begin(), VALUES.begin() + 3)));
+                ASSERT(X.isInline());
+                ASSERT(usesAllocator(X, &oa));
+            }
+            {
+                typedef InputIterator<Model::const_iterator> InIt;
+                const Obj X((InIt(VALUES.begin())), InIt(VALUES.end()), &oa);
+                ASSERT(matches(X, VALUES));
+                ASSERT(!X.isInline());
+                ASSERT(usesAllocator(X, &oa));
+            }
+            {
+                // The integral overload is chosen for two 'int' arguments.
+
+                const bdlc::SmallVector<int, 2> X(3, 7, &oa);
+                ASSERT(3 == X.size());
+                ASSERT(7 == X[2]);
+            }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            {
+                const Obj X({ VALUES[0], VALUES[1] }, &oa);
+                ASSERT(2 == X.size());
+                ASSERT(VALUES[1] == X[1]);
+                ASSERT(X.isInline());
+            }
+#endif
+            {
+                bslma::DefaultAllocatorGuard dag(&za);
+
+                const Obj X(5, VALUES[0]);
+                ASSERT(&za == X.allocator());
+                ASSERT(usesAllocator(X, &za));
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == za.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tCopy and move.\n";
+        {
+            for (int i = 0; i <= 7; ++i) {
+                const Model MI(VALUES.begin(), VALUES.begin() + i);
+
+                Obj mW(MI.begin(), MI.end(), &oa);  const Obj& W = mW;
+
+                {
+                    const Obj X(W, &za);
+                    ASSERTV(i, matches(X, MI));
+                    ASSERTV(i, &za == X.allocator());
+                    ASSERTV(i, usesAllocator(X, &za));
+                    ASSERTV(i, X.capacity() == (i < 4 ? 4u : unsigned(i)));
+                }
+                {
+                    Obj mY(W, &oa);  const Obj& Y = mY;
+
+                    const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+                    const Obj::const_iterator DATA = Y.begin();
+
+                    const Obj X(MoveUtil::move(mY));
+                    ASSERTV(i, matches(X, MI));
+                    ASSERTV(i, Y.empty());
+                    ASSERTV(i, Y.isInline());
+                    ASSERTV(i, &oa == X.allocator());
+                    ASSERTV(i, usesAllocator(X, &oa));
+                    ASSERTV(i, X.isInline() == (i <= 4));
+                    ASSERTV(i, X.isInline() || DATA == X.begin());
+                    ASSERTV(i, BLOCKS == oa.numBlocksTotal());
+                }
+                {
+                    Obj mY(W, &oa);  const Obj& Y = mY;
+
+                    const Obj X(MoveUtil::move(mY), &oa);
+                    ASSERTV(i, matches(X, MI));
+                    ASSERTV(i, Y.empty());
+                }
+                {
+                    Obj mY(W, &oa);  const Obj& Y = mY;
+
+                    const Obj X(MoveUtil::move(mY), &za);
+                    ASSERTV(i, matches(X, MI));
+                    ASSERTV(i, &za == X.allocator());
+                    ASSERTV(i, usesAllocator(X, &za));
+                    ASSERTV(i, static_cast<int>(Y.size()) == i);
+                }
+
+                for (int j = 0; j <= 7; ++j) {
+                    for (int k = 0; k < 2; ++k) {
+                        bslma::Allocator *ALLOC = k ? &za : &oa;
+
+                        Obj mX(j, VALUES[7], ALLOC);  const Obj& X = mX;
+                        mX = W;
+                        ASSERTV(i, j, k, matches(X, MI));
+                        ASSERTV(i, j, k, usesAllocator(X, ALLOC));
+
+                        Obj mY(j, VALUES[7], ALLOC);  const Obj& Y = mY;
+                        Obj mZ(W, &oa);
+                        mY = MoveUtil::move(mZ);
+                        ASSERTV(i, j, k, matches(Y, MI));
+                        ASSERTV(i, j, k, ALLOC == Y.allocator());
+                        ASSERTV(i, j, k, usesAllocator(Y, ALLOC));
+                    }
+                }
+
+                mW = W;
+                ASSERTV(i, matches(W, MI));
+
+                mW = MoveUtil::move(mW);
+                ASSERTV(i, matches(W, MI));
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == za.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\t'assign'.\n";
+        {
+            Obj mX(3, VALUES[1], &oa);  const Obj& X = mX;
+            mX[2] = VALUES[2];
+
+            mX.assign(2, X[2]);
+            ASSERT(2 == X.size());
+            ASSERT(VALUES[2] == X[0] && VALUES[2] == X[1]);
+
+            mX[0] = VALUES[3];
+            mX.assign(4, X[0]);
+            ASSERT(4 == X.size());
+            ASSERT(VALUES[3] == X[3]);
+            ASSERT(X.isInline());
+
+            mX.assign(9, X[1]);
+            ASSERT(9 == X.size());
+            ASSERT(VALUES[3] == X[8]);
+            ASSERT(!X.isInline());
+            ASSERT(usesAllocator(X, &oa));
+
+            mX.assign(VALUES.begin(), VALUES.begin() + 3);
+            ASSERT(matches(X, Model(VALUES.begin(), VALUES.begin() + 3)));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX = { VALUES[4], VALUES[5] };
+            ASSERT(2 == X.size());
+            ASSERT(VALUES[5] == X[1]);
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tException safety.\n";
+        {
+            const Obj W(VALUES.begin(), VALUES.end(), &za);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(W, &oa);
+                ASSERT(W == X);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            typedef InputIterator<Model::const_iterator> InIt;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X((InIt(VALUES.begin())), InIt(VALUES.end()), &oa);
+                ASSERT(W == X);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed vector is empty, inline, and has a capacity
+        //:   of 'INLINE_CAPACITY', and uses the supplied allocator, or the
+        //:   default allocator if none is supplied.
+        //:
+        //: 2 'push_back' appends an element, without allocating while the
+        //:   size does not exceed 'INLINE_CAPACITY', and moving the elements
+        //:   to allocated memory (doubling the capacity) when it does.
+        //:
+        //: 3 Each element uses the allocator of the vector.
+        //:
+        //: 4 'pop_back' and 'clear' destroy elements, and do not release the
+        //:   allocated memory.
+        //:
+        //: 5 The accessors report the state of the vector.
+        //:
+        //: 6 An 'INLINE_CAPACITY' of 0 is supported.
+        //:
+        //: 7 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Append elements to a vector, by copy and by move, verifying the
+        //:   state, the allocator of each element, and the allocations after
+        //:   each step.  (C-1..5)
+        //:
+        //: 2 Repeat P-1 for an 'INLINE_CAPACITY' of 0.  (C-6)
+        //:
+        //: 3 Verify that no memory is in use after the vectors are destroyed.
+        //:   (C-7)
+        //
+        // Testing:
+        //   static size_type inlineCapacity();
+        //   SmallVector();
+        //   explicit SmallVector(bslma::Allocator *basicAllocator);
+        //   ~SmallVector();
+        //   void push_back(const VALUE_TYPE&);
+        //   void push_back(VALUE_TYPE&&);
+        //   void pop_back();
+        //   void clear();
+        //   reference operator[](size_type);
+        //   reference front();
+        //   reference back();
+        //   VALUE_TYPE *data();
+        //   bslma::Allocator *allocator() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   size_type capacity() const;
+        //   bool empty() const;
+        //   bool isInline() const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        ASSERT(4 == Obj::inlineCapacity());
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+
+        for (int byMove = 0; byMove < 2; ++byMove) {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(X.isInline());
+            ASSERT(4 == X.capacity());
+            ASSERT(X.begin() == X.end());
+            ASSERT(0 < X.max_size());
+
+            for (int i = 0; i < 9; ++i) {
+                const bsl::string VALUE = makeValue(i);
+                if (byMove) {
+                    bsl::string value(VALUE, &oa);
+                    mX.push_back(MoveUtil::move(value));
+                }
+                else {
+                    mX.push_back(VALUE);
+                }
+
+                const int BLOCKS = i + 1 + (i < 4 ? 0 : 1);
+                    // one block per element, and one for the storage
+
+                ASSERTV(byMove, i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(byMove, i, VALUE == X.back());
+                ASSERTV(byMove, i, makeValue(0) == X.front());
+                ASSERTV(byMove, i, makeValue(i / 2) == X[i / 2]);
+                ASSERTV(byMove, i, &X.front() == X.data());
+                ASSERTV(byMove, i, X.end() - X.begin() == i + 1);
+                ASSERTV(byMove, i, (i < 4) == X.isInline());
+                ASSERTV(byMove, i, X.capacity() ==
+                                          (i < 4 ? 4u : i < 8 ? 8u : 16u));
+                ASSERTV(byMove, i, usesAllocator(X, &oa));
+                ASSERTV(byMove, i, oa.numBlocksInUse(),
+                        BLOCKS == oa.numBlocksInUse());
+            }
+
+            mX.front() = makeValue(9);
+            ASSERT(makeValue(9) == X[0]);
+
+            mX.pop_back();
+            ASSERT(8 == X.size());
+            ASSERT(makeValue(7) == X.back());
+            ASSERT(16 == X.capacity());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(16 == X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tZero inline capacity.\n";
+        {
+            typedef bdlc::SmallVector<int, 0> ZeroObj;
+
+            ZeroObj mX(&oa);  const ZeroObj& X = mX;
+            ASSERT(0 == X.capacity());
+            ASSERT(X.isInline());
+
+            for (int i = 0; i < 5; ++i) {
+                mX.push_back(i);
+                ASSERTV(i, !X.isInline());
+                ASSERTV(i, i == X.back());
+            }
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.clear();
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tNegative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            typedef bdlc::SmallVector<int, 1> IntObj;
+
+            IntObj mX(&oa);  const IntObj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.pop_back());
+            ASSERT_SAFE_FAIL(X.front());
+            ASSERT_SAFE_FAIL(X.back());
+            ASSERT_SAFE_FAIL(X[0]);
+            mX.push_back(1);
+            ASSERT_SAFE_PASS(X[0]);
+            ASSERT_SAFE_FAIL(X[1]);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        typedef bdlc::SmallVector<int, 4> IntObj;
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(X.isInline());
+
+        mX.push_back(1);
+        mX.push_back(3);
+        mX.insert(X.begin() + 1, 2);
+        ASSERT(3 == X.size());
+        ASSERT(1 == X[0] && 2 == X[1] && 3 == X[2]);
+        ASSERT(0 == oa.numBlocksTotal());
+
+        IntObj mY(X, &oa);  const IntObj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.push_back(4);
+        mY.push_back(5);
+        ASSERT(!Y.isInline());
+        ASSERT(1 == oa.numBlocksInUse());
+        ASSERT(X < Y);
+
+        mY.erase(Y.begin(), Y.begin() + 3);
+        ASSERT(2 == Y.size());
+        ASSERT(4 == Y.front());
+        ASSERT(X != Y);
+
+        mY.shrink_to_fit();
+        ASSERT(Y.isInline());
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare 'bdlc::SmallVector' to 'bsl::vector'.
+        //
+        // Concerns:
+        //: 1 Creating, filling, and destroying a 'bdlc::SmallVector' whose
+        //:   elements fit inline is faster than doing so for a 'bsl::vector'.
+        //:
+        //: 2 The cost of a 'bdlc::SmallVector' whose elements do not fit
+        //:   inline is comparable to that of a 'bsl::vector'.
+        //
+        // Plan:
+        //: 1 For sizes from 1 to 64 'int' elements, time the creation,
+        //:   filling with 'push_back', and destruction of many vectors of
+        //:   each type using the new-delete allocator, and report the time
+        //:   per vector.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bslma::NewDeleteAllocator    na;
+        bslma::DefaultAllocatorGuard dag(&na);
+
+        const int SIZES[] = { 1, 4, 8, 16, 64 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        const int NUM_VECTORS = 1000000;
+
+        const bsl::ios_base::fmtflags flags = cout.flags();
+
+        cout << bsl::fixed << bsl::setprecision(1);
+
+        cout << "     size    bsl::vector  SmallVector<8>  SmallVector<16>"
+                "  (ns/vector)"
+             << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE = SIZES[si];
+
+            const double vector = nanoseconds(
+                       performanceFill<bsl::vector<int> >(NUM_VECTORS, SIZE));
+            const double small8 = nanoseconds(
+              performanceFill<bdlc::SmallVector<int, 8> >(NUM_VECTORS, SIZE));
+            const double small16 = nanoseconds(
+             performanceFill<bdlc::SmallVector<int, 16> >(NUM_VECTORS, SIZE));
+
+            cout << bsl::setw(9)  << SIZE
+                 << bsl::setw(15) << vector  / NUM_VECTORS
+                 << bsl::setw(16) << small8  / NUM_VECTORS
+                 << bsl::setw(17) << small16 / NUM_VECTORS
+                 << endl;
+        }
+
+        cout.flags(flags);
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
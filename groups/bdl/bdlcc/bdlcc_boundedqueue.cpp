@@ -5,6 +5,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlcc_boundedqueue_cpp,"$Id$$CSID$")
 
+#include <bsls_assert.h>
+
 namespace BloombergLP {
 
 ///Implementation Note
@@ -32,6 +34,20 @@ namespace BloombergLP {
 //   * 'markStartedOperation' to mark a started operation, and
 //   * 'unmarkStartedOperation' to mark an aborted operation.
 
+namespace bdlcc {
+
+                         // ------------------------
+                         // class BoundedQueueWaiter
+                         // ------------------------
+
+// CREATORS
+BoundedQueueWaiter::~BoundedQueueWaiter()
+{
+    BSLS_ASSERT(!d_isRegistered);
+}
+
+}  // close package namespace
+
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
@@ -10,6 +10,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlcc::BoundedQueue: thread-aware bounded queue of 'TYPE'
+//  bdlcc::BoundedQueueWaiter: notification that a queue may be popped
 //
 //@SEE_ALSO: bdlcc_fixedqueue
 //
@@ -44,6 +45,53 @@ BSLS_IDENT("$Id: $")
 // 'popFront' immediately and return an error code.  The queue may be restored
 // to normal operation with the 'enablePopFront' method.
 //
+///Waiting Without Blocking
+///------------------------
+// Code that must not block a thread while the queue is empty (for example, a
+// coroutine, or a state machine driven by a thread pool) can register a
+// 'bdlcc::BoundedQueueWaiter' with 'registerPopFrontWaiter' after
+// 'tryPopFront' fails with 'e_EMPTY'.  The 'notify' method of a registered
+// waiter is invoked once, by the thread whose push makes an element available
+// (or by the thread disabling popping), and the waiter is then no longer
+// registered.  A push making 'n' elements available notifies up to 'n'
+// waiters, in the order in which they were registered, and 'disablePopFront'
+// notifies all of them.  A notified waiter is not guaranteed to find an
+// element, since another thread may pop it first; it should call
+// 'tryPopFront' again and, if the queue is empty, register again.
+// 'registerPopFrontWaiter' does not register a waiter (and so never loses a
+// notification) if an element is already available, and
+// 'deregisterPopFrontWaiter' cancels a registration, for example, when the
+// waiter times out.  A push notifies waiters only if any are registered, so
+// that the cost to a queue not used this way is one atomic operation per
+// push that makes elements available.
+//
+///Batch Operations
+///----------------
+// Producers and consumers that move elements in bursts may use
+// 'pushBackBatch', 'tryPushBackBatch', 'popFrontBatch', and
+// 'tryPopFrontBatch'.  Each of these methods claims as many slots as are
+// available (up to the number requested) with a single update of the
+// queue's semaphore and a single atomic increment of the queue's push (or
+// pop) index, and then reports the completion of the whole range with a
+// single update of the queue's bookkeeping.  The per-element cost of
+// synchronization is therefore amortized across the batch.
+//
+// The elements of a batch occupy consecutive positions in the queue only
+// within each range claimed: when a blocking 'pushBackBatch' must wait for
+// space, the values supplied may be interleaved with values pushed by other
+// threads.  Elements supplied to the batch push methods are copied; the
+// batch pop methods move elements out of the queue.
+//
+///Power-of-Two Capacity
+///---------------------
+// Each push and pop maps an ever-increasing index onto a slot of the queue's
+// circular buffer.  When the capacity of the queue is a power of two this
+// mapping is performed with a bit mask rather than an integer division.  A
+// queue constructed with 'e_ROUND_UP_TO_POWER_OF_TWO' rounds the requested
+// capacity up to the nearest power of two so that the cheaper mapping is
+// always used; a queue whose requested capacity is already a power of two
+// uses the cheaper mapping regardless of the rounding mode.
+//
 ///Comparison To FixedQueue
 ///------------------------
 // Both 'bdlcc::FixedQueue' and 'bdlcc::BoundedQueue' provide thread-aware
@@ -283,6 +331,105 @@ class BoundedQueue_PushExceptionCompleteProctor {
         // the managed queue's 'pushExceptionComplete' method.
 
     // MANIPULATORS
+    void release();
+        // Release from management the queue currently managed by this proctor.
+        // If no queue is currently managed, this method has no effect.
+};
+
+                   // ==================================
+                   // class BoundedQueue_PopRangeProctor
+                   // ==================================
+
+template <class TYPE>
+class BoundedQueue_PopRangeProctor {
+    // This class implements a proctor that, unless 'release' has been called,
+    // invokes 'TYPE::popRangeExceptionComplete' upon destruction to discard
+    // the unprocessed portion of a range of nodes claimed by a batch "pop"
+    // operation.  The proctor refers to the caller's loop variables so that
+    // the range discarded reflects the progress made before an exception.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE         *d_queue_p;     // managed queue
+    const Uint64 *d_index_p;     // address of next unprocessed index
+    Uint64        d_end;         // end of the claimed range of indices
+    int           d_numStarted;  // number of operations started for range
+    const int    *d_numOwed_p;   // address of number of unconstructed nodes
+                                 // seen so far in the range
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopRangeProctor();
+    BoundedQueue_PopRangeProctor(const BoundedQueue_PopRangeProctor&);
+    BoundedQueue_PopRangeProctor& operator=(
+                                          const BoundedQueue_PopRangeProctor&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopRangeProctor(TYPE         *queue,
+                                 const Uint64 *index,
+                                 Uint64        end,
+                                 int           numStarted,
+                                 const int    *numOwed);
+        // Create a proctor managing the specified 'queue' that, unless
+        // 'release' is called, discards the nodes in '[*index .. end)' upon
+        // destruction, marks the specified 'numStarted' operations finished,
+        // and removes a further '*numOwed' elements from 'queue' (plus one for
+        // each unconstructed node discarded).  Note that 'index' and 'numOwed'
+        // are read only upon destruction.
+
+    ~BoundedQueue_PopRangeProctor();
+        // Destroy this object and, if 'release' has not been invoked, invoke
+        // the managed queue's 'popRangeExceptionComplete' method.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the queue currently managed by this proctor.
+        // If no queue is currently managed, this method has no effect.
+};
+
+                  // ===================================
+                  // class BoundedQueue_PushRangeProctor
+                  // ===================================
+
+template <class TYPE>
+class BoundedQueue_PushRangeProctor {
+    // This class implements a proctor that, unless 'release' has been called,
+    // invokes 'TYPE::pushRangeExceptionComplete' upon destruction to mark the
+    // nodes of a batch "push" operation that were not written as
+    // unconstructed.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;    // managed queue
+    Uint64  d_index;      // first index of the claimed range
+    int     d_numValues;  // number of nodes in the claimed range
+    int     d_numPushed;  // number of nodes successfully written
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushRangeProctor();
+    BoundedQueue_PushRangeProctor(const BoundedQueue_PushRangeProctor&);
+    BoundedQueue_PushRangeProctor& operator=(
+                                         const BoundedQueue_PushRangeProctor&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushRangeProctor(TYPE *queue, Uint64 index, int numValues);
+        // Create a proctor managing the specified 'queue' and the range of
+        // the specified 'numValues' nodes starting at the specified 'index'.
+
+    ~BoundedQueue_PushRangeProctor();
+        // Destroy this object and, if 'release' has not been invoked, invoke
+        // the managed queue's 'pushRangeExceptionComplete' method.
+
+    // MANIPULATORS
+    void advance();
+        // Increment the number of nodes this proctor considers successfully
+        // written.
+
     void release();
         // Release from management the queue currently managed by this proctor.
         // If no queue is currently managed, this method has no effect.
@@ -347,6 +494,53 @@ struct BoundedQueue_Node<TYPE, false> {
         // Return 'false'.
 };
 
+                         // ========================
+                         // class BoundedQueueWaiter
+                         // ========================
+
+class BoundedQueueWaiter {
+    // This abstract class provides a single-shot registration with a
+    // 'BoundedQueue' for notification that an element may be popped from the
+    // queue, or that popping from the queue has been disabled (see {Waiting
+    // Without Blocking}).  The links through which a queue chains its
+    // registered waiters are held by the waiter itself, so registration
+    // allocates no memory.
+
+    // DATA
+    BoundedQueueWaiter *d_next_p;        // next registered waiter (held)
+
+    BoundedQueueWaiter *d_prev_p;        // previous registered waiter (held)
+
+    bool                d_isRegistered;  // 'true' if registered with a queue
+
+    // FRIENDS
+    template <class TYPE>
+    friend class BoundedQueue;
+
+    // NOT IMPLEMENTED
+    BoundedQueueWaiter(const BoundedQueueWaiter&);
+    BoundedQueueWaiter& operator=(const BoundedQueueWaiter&);
+
+  public:
+    // CREATORS
+    BoundedQueueWaiter();
+        // Create a waiter that is not registered with any queue.
+
+    virtual ~BoundedQueueWaiter();
+        // Destroy this waiter.  The behavior is undefined unless this waiter
+        // is not registered with any queue.
+
+    // MANIPULATORS
+    virtual void notify() = 0;
+        // Respond to an element becoming available to be popped from the
+        // queue with which this waiter was registered, or to popping from
+        // that queue being disabled.  This method is invoked at most once per
+        // registration, after this waiter is deregistered, by the thread
+        // pushing the element (or disabling popping), and so should neither
+        // block nor throw.  Note that the element may be popped by another
+        // thread before this waiter attempts to pop it.
+};
+
                             // ==================
                             // class BoundedQueue
                             // ==================
@@ -434,12 +628,33 @@ class BoundedQueue {
     mutable bslmt::Condition  d_emptyCondition;    // condition variable for
                                                    // 'waitUntilEmpty'
 
-    Node                     *d_element_p;         // array of elements that
+    AtomicUint                d_numPopWaiters;     // number of registered
+                                                   // 'BoundedQueueWaiter'
+                                                   // objects; tested by
+                                                   // "push" operations before
+                                                   // locking
+                                                   // 'd_popWaiterMutex'
+
+    bslmt::Mutex              d_popWaiterMutex;    // mutex protecting the list
+                                                   // of registered waiters
+
+    BoundedQueueWaiter       *d_popWaiterHead_p;   // first (longest
+                                                   // registered) waiter, or 0
+                                                   // (held, not owned)
+
+    BoundedQueueWaiter       *d_popWaiterTail_p;   // last registered waiter,
+                                                   // or 0 (held, not owned)
+
+    Node                    *d_element_p;         // array of elements that
                                                    // comprise the bounded
                                                    // queue
 
     Uint64                    d_capacity;          // capacity of the queue
 
+    Uint64                    d_capacityMask;      // 'd_capacity - 1' if
+                                                   // 'd_capacity' is a power
+                                                   // of two, and 0 otherwise
+
     bslma::Allocator         *d_allocator_p;       // allocator, held not owned
 
     // FRIENDS
@@ -450,6 +665,10 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopRangeProctor<BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PushRangeProctor<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
     static bool circularlyGreater(Uint lhs, Uint rhs);
         // Return 'true' if the specified 'lhs' is circularly greater than the
@@ -513,6 +732,18 @@ class BoundedQueue {
         // 'd_popCount').
 
     // PRIVATE MANIPULATORS
+    void init();
+        // Allocate and initialize the nodes of this queue and make them
+        // available to "push" operations.  This method is invoked by the
+        // constructors once 'd_capacity' has been established.
+
+    void notifyPopFrontWaiters(int numAvailable);
+        // Deregister up to the specified 'numAvailable' of the registered
+        // waiters (all of them if 'numAvailable' is negative), in the order
+        // in which they were registered, and invoke 'notify' on each of them.
+        // This method is invoked once elements have been made available to
+        // "pop" operations, or popping has been disabled.
+
     void popComplete(Node *node);
         // Destruct the value stored in the specified 'node', and mark the
         // 'node' writable.  This method is used within 'popFrontHelper' by a
@@ -524,10 +755,54 @@ class BoundedQueue {
         // element into the specified 'value'.  This method is invoked by
         // 'popFront' and 'tryPopFront' once an element is available.
 
+    void popFrontRange(TYPE *values, int numValues);
+        // Remove the specified 'numValues' elements from the front of this
+        // queue and, if the specified 'values' is not 0, load the removed
+        // elements into the array of at least 'numValues' elements starting
+        // at 'values'.  The nodes are claimed from 'd_popIndex' in as few
+        // contiguous ranges as possible (one, unless nodes marked for
+        // reclamation are encountered).  The behavior is undefined unless
+        // 'numValues' has been taken from 'd_popSemaphore'.
+
+    void popRangeComplete(int numPopped);
+        // Mark the specified 'numPopped' "pop" operations as complete, 'post'
+        // to the 'd_pushSemaphore' if appropriate, and signal threads blocked
+        // in 'waitUntilEmpty' if the queue is empty and quiescent.
+
+    void popRangeExceptionComplete(Uint64 index,
+                                   Uint64 end,
+                                   int    numStarted,
+                                   int    numOwed);
+        // Discard the nodes in the range '[index .. end)' of a batch "pop"
+        // operation interrupted by an exception, mark the specified
+        // 'numStarted' "pop" operations as complete, and remove the specified
+        // 'numOwed' elements (plus one for each unconstructed node discarded)
+        // from the front of this queue.  This method is used within
+        // 'popFrontRange' by a proctor.
+
     void pushComplete();
         // Mark a "push" operation as complete, and 'post' to the
         // 'd_popSemaphore' if appropriate.
 
+    void pushRange(const TYPE *values, int numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values' to the back of this queue, claiming a single
+        // contiguous range of nodes from 'd_pushIndex'.  The behavior is
+        // undefined unless 'numValues' has been taken from 'd_pushSemaphore'.
+
+    void pushRangeComplete(int numPushed, int numUnconstructed);
+        // Mark the specified 'numPushed' "push" operations as complete and
+        // the specified 'numUnconstructed' "push" operations as aborted, and
+        // 'post' to the 'd_popSemaphore' if appropriate.
+
+    void pushRangeExceptionComplete(Uint64 index,
+                                    int    numPushed,
+                                    int    numValues);
+        // Mark the nodes in the range of the specified 'numValues' nodes
+        // starting at the specified 'index' that follow the first specified
+        // 'numPushed' nodes as unconstructed, and complete the batch "push"
+        // operation.  This method is used within 'pushRange' by a proctor.
+
     void pushExceptionComplete();
         // Remove the indicator for a started push operation, and 'post' to the
         // 'd_popSemaphore' if appropriate.  This method is used within
@@ -543,6 +818,11 @@ class BoundedQueue {
         // another thread has (or will) signal the queue is empty and this
         // thread does not need to signal.
 
+    // PRIVATE ACCESSORS
+    Uint64 elementIndex(Uint64 index) const;
+        // Return the position in 'd_element_p' of the node identified by the
+        // specified (ever-increasing) push or pop 'index'.
+
     // NOT IMPLEMENTED
     BoundedQueue(const BoundedQueue&);
     BoundedQueue& operator=(const BoundedQueue&);
@@ -563,6 +843,15 @@ class BoundedQueue {
         e_FAILED   = -4
     };
 
+    enum CapacityMode {
+        // Enumeration of the ways in which the capacity supplied at
+        // construction may be adjusted (see {Power-of-Two Capacity}).
+
+        e_EXACT_CAPACITY,           // use the supplied capacity
+        e_ROUND_UP_TO_POWER_OF_TWO  // round the supplied capacity up to the
+                                    // nearest power of two
+    };
+
     // CREATORS
     explicit
     BoundedQueue(bsl::size_t capacity, bslma::Allocator *basicAllocator = 0);
@@ -571,6 +860,16 @@ class BoundedQueue {
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.
 
+    BoundedQueue(bsl::size_t       capacity,
+                 CapacityMode      capacityMode,
+                 bslma::Allocator *basicAllocator = 0);
+        // Create a thread-aware queue with at least the specified 'capacity',
+        // adjusted as indicated by the specified 'capacityMode'.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless the adjusted capacity is
+        // representable as an 'int'.
+
     ~BoundedQueue();
         // Destroy this object.
 
@@ -585,6 +884,23 @@ class BoundedQueue {
         // the queue being empty will return 'e_DISABLED' if 'disablePopFront'
         // is invoked.
 
+    int popFrontBatch(bsl::size_t *numPopped,
+                      TYPE        *values,
+                      bsl::size_t  maxValues);
+        // Remove up to the specified 'maxValues' elements from the front of
+        // this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty, block until it is not
+        // empty; otherwise remove as many elements as are available without
+        // blocking.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPopFrontDisabled()' and 'e_FAILED' if an error occurs.  On
+        // failure, '*numPopped' is 0 and 'values' is not changed.  Threads
+        // blocked due to the queue being empty will return 'e_DISABLED' if
+        // 'disablePopFront' is invoked.  The behavior is undefined unless
+        // '0 < maxValues' and 'values' refers to an array of at least
+        // 'maxValues' elements.  See {Batch Operations}.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  If the
         // queue is full, block until it is not full.  Return 0 on success, and
@@ -603,6 +919,23 @@ class BoundedQueue {
         // due to the queue being full will return 'e_DISABLED' if
         // 'disablePushBack' is invoked.
 
+    int pushBackBatch(bsl::size_t *numPushed,
+                      const TYPE  *values,
+                      bsl::size_t  numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue, and
+        // load the number of elements appended into the specified
+        // 'numPushed'.  If the queue is full, block until it is not full, as
+        // many times as necessary to append all of the values.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success (in which case '*numPushed == numValues'),
+        // 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an error
+        // occurs.  On failure, the first '*numPushed' values have been
+        // appended.  Threads blocked due to the queue being full will return
+        // 'e_DISABLED' if 'disablePushBack' is invoked.  The behavior is
+        // undefined unless 'values' refers to an array of at least 'numValues'
+        // elements.  See {Batch Operations}.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -618,6 +951,21 @@ class BoundedQueue {
         // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
         // an error occurs.  On failure, 'value' is not changed.
 
+    int tryPopFrontBatch(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxValues);
+        // Attempt to remove up to the specified 'maxValues' elements from the
+        // front of this queue without blocking, load the removed elements, in
+        // order, into the array starting at the specified 'values', and load
+        // the number of elements removed into the specified 'numPopped'.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPopFrontDisabled()', 'e_EMPTY' if '!isPopFrontDisabled()' and
+        // the queue was empty, and 'e_FAILED' if an error occurs.  On failure,
+        // '*numPopped' is 0 and 'values' is not changed.  The behavior is
+        // undefined unless '0 < maxValues' and 'values' refers to an array of
+        // at least 'maxValues' elements.  See {Batch Operations}.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -633,6 +981,21 @@ class BoundedQueue {
         // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
         // 'e_FAILED' if an error occurs.  On failure, 'value' is not changed.
 
+    int tryPushBackBatch(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues);
+        // Append, without blocking, as many of the specified 'numValues'
+        // elements of the array starting at the specified 'values' as there
+        // is space for, in order, to the back of this queue, and load the
+        // number of elements appended into the specified 'numPushed'.  Return
+        // 0 on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success (in which case '0 < *numPushed' unless
+        // '0 == numValues'), 'e_DISABLED' if 'isPushBackDisabled()', 'e_FULL'
+        // if '!isPushBackDisabled()' and the queue was full, and 'e_FAILED'
+        // if an error occurs.  On failure, '*numPushed' is 0.  The behavior is
+        // undefined unless 'values' refers to an array of at least
+        // 'numValues' elements.  See {Batch Operations}.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -656,6 +1019,24 @@ class BoundedQueue {
         // Enable queuing.  If the queue is not enqueue disabled, this call has
         // no effect.
 
+                             // Pop Waiters
+
+    bool deregisterPopFrontWaiter(BoundedQueueWaiter *waiter);
+        // Deregister the specified 'waiter' from this queue, if it is
+        // registered.  Return 'true' if 'waiter' was registered, in which
+        // case it will not be notified, and 'false' otherwise (for example,
+        // if it has been, or is being, notified).
+
+    int registerPopFrontWaiter(BoundedQueueWaiter *waiter);
+        // Register the specified 'waiter' to be notified, once, when an
+        // element may be popped from this queue or popping is disabled,
+        // unless that is already the case.  Return 0 if 'waiter' was
+        // registered, and a non-zero value (without registering 'waiter') if
+        // this queue is not empty or 'isPopFrontDisabled()'.  The behavior is
+        // undefined unless 'waiter' is not registered with any queue, and
+        // 'waiter' and this queue exist until 'waiter' is notified or
+        // deregistered.  See {Waiting Without Blocking}.
+
     // ACCESSORS
     bsl::size_t capacity() const;
         // Return the maximum number of elements that may be stored in this
@@ -752,6 +1133,91 @@ BoundedQueue_PushExceptionCompleteProctor<TYPE>::
 template <class TYPE>
 inline
 void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
+{
+    d_queue_p = 0;
+}
+
+                   // ----------------------------------
+                   // class BoundedQueue_PopRangeProctor
+                   // ----------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PopRangeProctor<TYPE>::BoundedQueue_PopRangeProctor(
+                                                    TYPE         *queue,
+                                                    const Uint64 *index,
+                                                    Uint64        end,
+                                                    int           numStarted,
+                                                    const int    *numOwed)
+: d_queue_p(queue)
+, d_index_p(index)
+, d_end(end)
+, d_numStarted(numStarted)
+, d_numOwed_p(numOwed)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PopRangeProctor<TYPE>::~BoundedQueue_PopRangeProctor()
+{
+    if (d_queue_p) {
+        d_queue_p->popRangeExceptionComplete(*d_index_p,
+                                             d_end,
+                                             d_numStarted,
+                                             *d_numOwed_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PopRangeProctor<TYPE>::release()
+{
+    d_queue_p = 0;
+}
+
+                  // -----------------------------------
+                  // class BoundedQueue_PushRangeProctor
+                  // -----------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushRangeProctor<TYPE>::BoundedQueue_PushRangeProctor(
+                                                        TYPE   *queue,
+                                                        Uint64  index,
+                                                        int     numValues)
+: d_queue_p(queue)
+, d_index(index)
+, d_numValues(numValues)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushRangeProctor<TYPE>::~BoundedQueue_PushRangeProctor()
+{
+    if (d_queue_p) {
+        d_queue_p->pushRangeExceptionComplete(d_index,
+                                              d_numPushed,
+                                              d_numValues);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushRangeProctor<TYPE>::advance()
+{
+    ++d_numPushed;
+}
+
+template <class TYPE>
+inline
+void BoundedQueue_PushRangeProctor<TYPE>::release()
 {
     d_queue_p = 0;
 }
@@ -791,6 +1257,19 @@ bool BoundedQueue_Node<TYPE, false>::isUnconstructed() const
     return false;
 }
 
+                         // ------------------------
+                         // class BoundedQueueWaiter
+                         // ------------------------
+
+// CREATORS
+inline
+BoundedQueueWaiter::BoundedQueueWaiter()
+: d_next_p(0)
+, d_prev_p(0)
+, d_isRegistered(false)
+{
+}
+
                             // ------------------
                             // class BoundedQueue
                             // ------------------
@@ -858,6 +1337,92 @@ bsls::Types::Uint64 BoundedQueue<TYPE>::unmarkStartedOperation(
 }
 
 // PRIVATE MANIPULATORS
+template <class TYPE>
+void BoundedQueue<TYPE>::init()
+{
+    AtomicOp::initUint64(&d_pushCount, 0);
+    AtomicOp::initUint64(&d_pushIndex, 0);
+    AtomicOp::initUint64(&d_popCount,  0);
+    AtomicOp::initUint64(&d_popIndex,  0);
+
+    AtomicOp::initUint(&d_emptyWaiterCount, 0);
+    AtomicOp::initUint(&d_emptyCountSeen,   0);
+    AtomicOp::initUint(&d_numPopWaiters,    0);
+
+    BSLS_ASSERT(d_capacity <= static_cast<Uint64>(INT_MAX));
+
+    d_capacityMask = 0 == (d_capacity & (d_capacity - 1)) ? d_capacity - 1
+                                                          : 0;
+
+    d_element_p = static_cast<Node *>(
+                              d_allocator_p->allocate(static_cast<bsl::size_t>(
+                                                  d_capacity * sizeof(Node))));
+
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        d_element_p[i].setIsUnconstructed(false);
+    }
+
+    d_pushSemaphore.post(static_cast<int>(d_capacity));
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::notifyPopFrontWaiters(int numAvailable)
+{
+    // A read-modify-write of 'd_numPopWaiters', rather than a load, orders
+    // this test after the preceding update of 'd_popSemaphore' with respect
+    // to the increment in 'registerPopFrontWaiter': either this test observes
+    // the registered waiter, or 'registerPopFrontWaiter' observes the update.
+
+    if (0 == AtomicOp::addUintNvAcqRel(&d_numPopWaiters, 0)) {
+        return;                                                       // RETURN
+    }
+
+    // Detach the waiters to notify, and notify them once the mutex is
+    // released, reading the link to the next waiter before notifying each,
+    // since a notified waiter may be destroyed or registered again.
+
+    BoundedQueueWaiter *notified = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_popWaiterMutex);
+
+        BoundedQueueWaiter *last = 0;
+        while (d_popWaiterHead_p && 0 != numAvailable) {
+            BoundedQueueWaiter *waiter = d_popWaiterHead_p;
+
+            d_popWaiterHead_p = waiter->d_next_p;
+            if (d_popWaiterHead_p) {
+                d_popWaiterHead_p->d_prev_p = 0;
+            }
+            else {
+                d_popWaiterTail_p = 0;
+            }
+
+            waiter->d_isRegistered = false;
+            waiter->d_next_p       = 0;
+            if (last) {
+                last->d_next_p = waiter;
+            }
+            else {
+                notified = waiter;
+            }
+            last = waiter;
+
+            AtomicOp::decrementUintAcqRel(&d_numPopWaiters);
+
+            if (0 < numAvailable) {
+                --numAvailable;
+            }
+        }
+    }
+
+    while (notified) {
+        BoundedQueueWaiter *next = notified->d_next_p;
+
+        notified->notify();
+        notified = next;
+    }
+}
+
 template <class TYPE>
 inline
 void BoundedQueue<TYPE>::popComplete(Node *node)
@@ -895,9 +1460,8 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 
     // 'd_popIndex' stores the next location to use (want the original value)
 
-    Uint64  index = (AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1)
-                                                                  % d_capacity;
-    Node   *node  = &d_element_p[index];
+    Uint64  index = AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1;
+    Node   *node  = &d_element_p[elementIndex(index)];
 
     // Nodes marked for reclamation are not counted in 'd_popSemaphore' and are
     // to be skipped; 'd_isUnconstructed' does not need to be modified here
@@ -909,8 +1473,8 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
     while (node->isUnconstructed()) {
         markReclaimed(&d_popCount);
 
-        index = (AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1) % d_capacity;
-        node  = &d_element_p[index];
+        index = AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1;
+        node  = &d_element_p[elementIndex(index)];
     }
 
     BoundedQueue_PopCompleteGuard<BoundedQueue<TYPE>, Node> guard(this, node);
@@ -922,6 +1486,119 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popFrontRange(TYPE *values, int numValues)
+{
+    while (numValues) {
+        const int count = numValues;
+
+        numValues = 0;
+
+        // For quiescent state detection (see *Implementation* *Note*) and
+        // eventual 'post' to the 'd_pushSemaphore' to indicate node
+        // availability, indicate 'count' remove operations have begun, and
+        // claim 'count' contiguous nodes.
+
+        markStartedOperation(&d_popCount, count);
+
+        Uint64       index = AtomicOp::addUint64NvAcqRel(&d_popIndex, count)
+                                                                       - count;
+        const Uint64 end   = index + count;
+
+        BoundedQueue_PopRangeProctor<BoundedQueue<TYPE> > proctor(this,
+                                                                  &index,
+                                                                  end,
+                                                                  count,
+                                                                  &numValues);
+
+        for (; index != end; ++index) {
+            Node& node = d_element_p[elementIndex(index)];
+
+            // Nodes marked for reclamation are not counted in
+            // 'd_popSemaphore'; each one seen requires another node to be
+            // claimed (see 'popFrontHelper').
+
+            if (!node.isUnconstructed()) {
+                if (values) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+                    *values = bslmf::MovableRefUtil::move(
+                                                       node.d_value.object());
+#else
+                    *values = node.d_value.object();
+#endif
+                    ++values;
+                }
+                node.d_value.object().~TYPE();
+            }
+            else {
+                ++numValues;
+            }
+        }
+
+        proctor.release();
+
+        popRangeComplete(count);
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popRangeComplete(int numPopped)
+{
+    Uint64 count = markFinishedOperation(&d_popCount, numPopped);
+    if (isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.post(static_cast<int>(count & k_STARTED_MASK));
+        }
+
+        // The empty condition is signaled whether or not the exchange above
+        // succeeded, so that a thread in 'waitUntilEmpty' is not left blocked
+        // when this operation leaves the queue empty (e.g., in 'removeAll').
+
+        Uint emptyCount = AtomicOp::getUintAcquire(&d_emptyWaiterCount);
+
+        if (isEmpty() && updateEmptyCountSeen(emptyCount)) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+            }
+            d_emptyCondition.broadcast();
+        }
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popRangeExceptionComplete(Uint64 index,
+                                                   Uint64 end,
+                                                   int    numStarted,
+                                                   int    numOwed)
+{
+    // The node at 'index' (if any) still holds the value whose transfer
+    // failed.
+
+    for (; index != end; ++index) {
+        Node& node = d_element_p[elementIndex(index)];
+
+        if (!node.isUnconstructed()) {
+            node.d_value.object().~TYPE();
+        }
+        else {
+            ++numOwed;
+        }
+    }
+
+    popRangeComplete(numStarted);
+
+    if (numOwed) {
+        popFrontRange(0, numOwed);
+    }
+}
+
 template <class TYPE>
 inline
 void BoundedQueue<TYPE>::pushComplete()
@@ -936,7 +1613,10 @@ void BoundedQueue<TYPE>::pushComplete()
         if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
                                                count,
                                                0) == count) {
-            d_popSemaphore.post(static_cast<int>(count & k_STARTED_MASK));
+            const int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+            d_popSemaphore.post(numToPost);
+            notifyPopFrontWaiters(numToPost);
         }
     }
 }
@@ -959,10 +1639,86 @@ void BoundedQueue<TYPE>::pushExceptionComplete()
                                                count,
                                                0) == count) {
             d_popSemaphore.post(numToPost);
+            notifyPopFrontWaiters(numToPost);
         }
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushRange(const TYPE *values, int numValues)
+{
+    markStartedOperation(&d_pushCount, numValues);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    const Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numValues)
+                                                                   - numValues;
+
+    BoundedQueue_PushRangeProctor<BoundedQueue<TYPE> > proctor(this,
+                                                               index,
+                                                               numValues);
+
+    for (int i = 0; i < numValues; ++i) {
+        Node& node = d_element_p[elementIndex(index + i)];
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                values[i],
+                                                d_allocator_p);
+
+        node.setIsUnconstructed(false);
+
+        proctor.advance();
+    }
+
+    proctor.release();
+
+    pushRangeComplete(numValues, 0);
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushRangeComplete(int numPushed,
+                                           int numUnconstructed)
+{
+    // Adding 'k_STARTED_DEC' for each unconstructed node removes the
+    // indicator for its started push operation (see 'pushExceptionComplete').
+
+    const Uint64 delta = static_cast<Uint64>(numPushed) * k_FINISHED_INC
+                       + static_cast<Uint64>(numUnconstructed) * k_STARTED_DEC;
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_pushCount, delta);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.post(numToPost);
+            notifyPopFrontWaiters(numToPost);
+        }
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushRangeExceptionComplete(Uint64 index,
+                                                    int    numPushed,
+                                                    int    numValues)
+{
+    // Nodes that were not written are skipped by "pop" operations (see
+    // 'popFrontHelper').
+
+    for (int i = numPushed; i < numValues; ++i) {
+        d_element_p[elementIndex(index + i)].setIsUnconstructed(true);
+    }
+
+    pushRangeComplete(numPushed, numValues - numPushed);
+}
+
 template <class TYPE>
 inline
 bool BoundedQueue<TYPE>::updateEmptyCountSeen(Uint emptyCount)
@@ -982,6 +1738,14 @@ bool BoundedQueue<TYPE>::updateEmptyCountSeen(Uint emptyCount)
     return false;
 }
 
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+bsls::Types::Uint64 BoundedQueue<TYPE>::elementIndex(Uint64 index) const
+{
+    return d_capacityMask ? index & d_capacityMask : index % d_capacity;
+}
+
 // CREATORS
 template <class TYPE>
 BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
@@ -990,27 +1754,39 @@ BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
 , d_popSemaphore()
 , d_emptyMutex()
 , d_emptyCondition()
+, d_popWaiterMutex()
+, d_popWaiterHead_p(0)
+, d_popWaiterTail_p(0)
 , d_element_p(0)
 , d_capacity(capacity > 2 ? capacity : 2)
+, d_capacityMask(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    AtomicOp::initUint64(&d_pushCount, 0);
-    AtomicOp::initUint64(&d_pushIndex, 0);
-    AtomicOp::initUint64(&d_popCount,  0);
-    AtomicOp::initUint64(&d_popIndex,  0);
-
-    AtomicOp::initUint(&d_emptyWaiterCount, 0);
-    AtomicOp::initUint(&d_emptyCountSeen,   0);
-
-    d_element_p = static_cast<Node *>(
-                              d_allocator_p->allocate(static_cast<bsl::size_t>(
-                                                  d_capacity * sizeof(Node))));
+    init();
+}
 
-    for (bsl::size_t i = 0; i < d_capacity; ++i) {
-        d_element_p[i].setIsUnconstructed(false);
+template <class TYPE>
+BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
+                                 CapacityMode      capacityMode,
+                                 bslma::Allocator *basicAllocator)
+: d_pushSemaphore()
+, d_popSemaphore()
+, d_emptyMutex()
+, d_emptyCondition()
+, d_popWaiterMutex()
+, d_popWaiterHead_p(0)
+, d_popWaiterTail_p(0)
+, d_element_p(0)
+, d_capacity(capacity > 2 ? capacity : 2)
+, d_capacityMask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (e_ROUND_UP_TO_POWER_OF_TWO == capacityMode) {
+        d_capacity = bdlb::BitUtil::roundUpToBinaryPower(
+                                       static_cast<bsl::uint64_t>(d_capacity));
     }
 
-    d_pushSemaphore.post(static_cast<int>(d_capacity));
+    init();
 }
 
 template <class TYPE>
@@ -1055,9 +1831,8 @@ int BoundedQueue<TYPE>::pushBack(const TYPE& value)
 
     // 'd_pushIndex' stores the next location to use (want the original value)
 
-    Uint64 index = (AtomicOp::addUint64NvAcqRel(&d_pushIndex, 1) - 1)
-                                                                  % d_capacity;
-    Node&  node  = d_element_p[index];
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, 1) - 1;
+    Node&  node  = d_element_p[elementIndex(index)];
 
     node.setIsUnconstructed(true);
 
@@ -1091,9 +1866,8 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
 
     // 'd_pushIndex' stores the next location to use (want the original value)
 
-    Uint64 index = (AtomicOp::addUint64NvAcqRel(&d_pushIndex, 1) - 1)
-                                                                  % d_capacity;
-    Node&  node  = d_element_p[index];
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, 1) - 1;
+    Node&  node  = d_element_p[elementIndex(index)];
 
     node.setIsUnconstructed(true);
 
@@ -1114,68 +1888,89 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
 }
 
 template <class TYPE>
-void BoundedQueue<TYPE>::removeAll()
+int BoundedQueue<TYPE>::popFrontBatch(bsl::size_t *numPopped,
+                                      TYPE        *values,
+                                      bsl::size_t  maxValues)
 {
-    int reclaim = d_popSemaphore.takeAll();
-
-    if (reclaim) {
-        while (reclaim) {
-            int count = reclaim;
-
-            reclaim = 0;
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxValues);
 
-            // For quiescent state detection (see *Implementation* *Note*) and
-            // eventual 'post' to the 'd_pushSemaphore' to indicate node
-            // availability, indicate 'count' remove operations have begin.
+    *numPopped = 0;
 
-            markStartedOperation(&d_popCount, count);
+    if (d_popSemaphore.isDisabled()) {
+        return e_DISABLED;                                            // RETURN
+    }
 
-            // 'd_popIndex' stores the next location to use (want the original
-            // value)
+    const int maxCount = static_cast<int>(
+                          maxValues < d_capacity ? maxValues : d_capacity);
 
-            Uint64 index = AtomicOp::addUint64NvAcqRel(&d_popIndex, count)
-                                                                       - count;
+    int count = d_popSemaphore.take(maxCount);
+    if (0 == count) {
+        int rv = d_popSemaphore.wait();
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+        count = 1 + (1 < maxCount ? d_popSemaphore.take(maxCount - 1) : 0);
+    }
 
-            for (int i = 0; i < count; ++i, ++index) {
-                Node& node = d_element_p[index % d_capacity];
+    popFrontRange(values, count);
 
-                if (!node.isUnconstructed()) {
-                    node.d_value.object().~TYPE();
-                }
-                else {
-                    ++reclaim;
-                }
-            }
+    *numPopped = count;
 
-            // For quiescent state detection (see *Implementation* *Note*) and
-            // eventual 'post' to the 'd_pushSemaphore' to indicate node
-            // availability, indicate 'count' remove operations have finished.
+    return e_SUCCESS;
+}
 
-            Uint64 popCount = markFinishedOperation(&d_popCount, count);
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBackBatch(bsl::size_t *numPushed,
+                                      const TYPE  *values,
+                                      bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
 
-            if (isQuiescentState(popCount)) {
-                // The total number of popped elements is
-                // 'popCount & k_STARTED_MASK'.  Attempt, once, to zero the
-                // count and, if successful, post to the push semaphore.
+    *numPushed = 0;
 
-                if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
-                                                      popCount,
-                                                      0) == popCount) {
-                    d_pushSemaphore.post(static_cast<int>(
-                                                   popCount & k_STARTED_MASK));
-                }
+    while (*numPushed < numValues) {
+        if (d_pushSemaphore.isDisabled()) {
+            return e_DISABLED;                                        // RETURN
+        }
 
-                Uint emptyCount = AtomicOp::getUintAcquire(
-                                                          &d_emptyWaiterCount);
+        const bsl::size_t remaining = numValues - *numPushed;
+        const int         maxCount  = static_cast<int>(
+                            remaining < d_capacity ? remaining : d_capacity);
 
-                if (isEmpty() && updateEmptyCountSeen(emptyCount)) {
-                    {
-                        bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
-                    }
-                    d_emptyCondition.broadcast();
+        int count = d_pushSemaphore.take(maxCount);
+        if (0 == count) {
+            int rv = d_pushSemaphore.wait();
+            if (rv) {
+                if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                    return e_DISABLED;                                // RETURN
                 }
+                return e_FAILED;                                      // RETURN
             }
+            count = 1 + (1 < maxCount ? d_pushSemaphore.take(maxCount - 1)
+                                      : 0);
         }
+
+        pushRange(values + *numPushed, count);
+
+        *numPushed += count;
+    }
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::removeAll()
+{
+    int count = d_popSemaphore.takeAll();
+
+    if (count) {
+        popFrontRange(0, count);
     }
 }
 
@@ -1199,6 +1994,36 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFrontBatch(bsl::size_t *numPopped,
+                                         TYPE        *values,
+                                         bsl::size_t  maxValues)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxValues);
+
+    *numPopped = 0;
+
+    if (d_popSemaphore.isDisabled()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    const int maxCount = static_cast<int>(
+                          maxValues < d_capacity ? maxValues : d_capacity);
+
+    int count = d_popSemaphore.take(maxCount);
+    if (0 == count) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    popFrontRange(values, count);
+
+    *numPopped = count;
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -1217,9 +2042,8 @@ int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 
     // 'd_pushIndex' stores the next location to use (want the original value)
 
-    Uint64 index = (AtomicOp::addUint64NvAcqRel(&d_pushIndex, 1) - 1)
-                                                                  % d_capacity;
-    Node&  node  = d_element_p[index];
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, 1) - 1;
+    Node&  node  = d_element_p[elementIndex(index)];
 
     node.setIsUnconstructed(true);
 
@@ -1256,9 +2080,8 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
 
     // 'd_pushIndex' stores the next location to use (want the original value)
 
-    Uint64 index = (AtomicOp::addUint64NvAcqRel(&d_pushIndex, 1) - 1)
-                                                                  % d_capacity;
-    Node&  node  = d_element_p[index];
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, 1) - 1;
+    Node&  node  = d_element_p[elementIndex(index)];
 
     node.setIsUnconstructed(true);
 
@@ -1275,6 +2098,39 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
 
     pushComplete();
 
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPushBackBatch(bsl::size_t *numPushed,
+                                         const TYPE  *values,
+                                         bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    *numPushed = 0;
+
+    if (d_pushSemaphore.isDisabled()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    if (0 == numValues) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    const int maxCount = static_cast<int>(
+                          numValues < d_capacity ? numValues : d_capacity);
+
+    int count = d_pushSemaphore.take(maxCount);
+    if (0 == count) {
+        return e_FULL;                                                // RETURN
+    }
+
+    pushRange(values, count);
+
+    *numPushed = count;
+
     return e_SUCCESS;
 }
 
@@ -1290,6 +2146,8 @@ void BoundedQueue<TYPE>::disablePopFront()
         bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
     }
     d_emptyCondition.broadcast();
+
+    notifyPopFrontWaiters(-1);
 }
 
 template <class TYPE>
@@ -1313,6 +2171,74 @@ void BoundedQueue<TYPE>::enablePushBack()
     d_pushSemaphore.enable();
 }
 
+                             // Pop Waiters
+
+template <class TYPE>
+bool BoundedQueue<TYPE>::deregisterPopFrontWaiter(BoundedQueueWaiter *waiter)
+{
+    BSLS_ASSERT(waiter);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_popWaiterMutex);
+
+    if (!waiter->d_isRegistered) {
+        return false;                                                 // RETURN
+    }
+
+    if (waiter->d_prev_p) {
+        waiter->d_prev_p->d_next_p = waiter->d_next_p;
+    }
+    else {
+        d_popWaiterHead_p = waiter->d_next_p;
+    }
+    if (waiter->d_next_p) {
+        waiter->d_next_p->d_prev_p = waiter->d_prev_p;
+    }
+    else {
+        d_popWaiterTail_p = waiter->d_prev_p;
+    }
+
+    waiter->d_isRegistered = false;
+    waiter->d_next_p       = 0;
+    waiter->d_prev_p       = 0;
+
+    AtomicOp::decrementUintAcqRel(&d_numPopWaiters);
+
+    return true;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::registerPopFrontWaiter(BoundedQueueWaiter *waiter)
+{
+    BSLS_ASSERT(waiter);
+    BSLS_ASSERT(!waiter->d_isRegistered);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_popWaiterMutex);
+
+    // Increment the count of waiters before testing the state of
+    // 'd_popSemaphore' (see 'notifyPopFrontWaiters').
+
+    AtomicOp::incrementUintAcqRel(&d_numPopWaiters);
+
+    if (0 < d_popSemaphore.getValue() || d_popSemaphore.isDisabled()) {
+        AtomicOp::decrementUintAcqRel(&d_numPopWaiters);
+        return 1;                                                     // RETURN
+    }
+
+    waiter->d_next_p       = 0;
+    waiter->d_prev_p       = d_popWaiterTail_p;
+    waiter->d_isRegistered = true;
+
+    if (d_popWaiterTail_p) {
+        d_popWaiterTail_p->d_next_p = waiter;
+    }
+    else {
+        d_popWaiterHead_p = waiter;
+    }
+    d_popWaiterTail_p = waiter;
+
+    return e_SUCCESS;
+}
+
 // ACCESSORS
 template <class TYPE>
 inline
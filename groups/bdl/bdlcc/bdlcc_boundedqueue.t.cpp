@@ -16,6 +16,7 @@
 #include <bslmt_condition.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 
@@ -23,6 +24,8 @@
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_keyword.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -78,18 +81,25 @@ using namespace bsl;
 //: o ACCESSOR methods are 'const' thread-safe.
 // ----------------------------------------------------------------------------
 // [ 2] BoundedQueue(bsl::size_t capacity, bslma::Allocator bA = 0);
+// [16] BoundedQueue(bsl::size_t capacity, CapacityMode mode, *bA = 0);
 // [ 2] ~BoundedQueue();
 // [ 2] int popFront(TYPE *value);
+// [16] int popFrontBatch(size_t *numPopped, TYPE *values, size_t max);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [16] int pushBackBatch(size_t *numPushed, const TYPE *values, size_t num);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [16] int tryPopFrontBatch(size_t *numPopped, TYPE *values, size_t max);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [16] int tryPushBackBatch(size_t *numPushed, const TYPE *, size_t num);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
 // [ 5] void enablePushBack();
+// [18] bool deregisterPopFrontWaiter(BoundedQueueWaiter *waiter);
+// [18] int registerPopFrontWaiter(BoundedQueueWaiter *waiter);
 // [ 4] bsl::size_t capacity() const;
 // [ 4] bool isEmpty() const;
 // [ 4] bool isFull() const;
@@ -100,7 +110,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [16] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -112,6 +122,10 @@ using namespace bsl;
 // [13] DRQS 164984269: 'removeAll' STARTED/FINISHED ISSUE
 // [14] DRQS 153332608: 'pushBack', 'pushBack', 'waitUntilEmpty'
 // [15] DRQS 168011541: 'waitUntilEmpty' RACE WITH 'disablePopFront'
+// [16] CONCERN: batch operations claim contiguous ranges correctly
+// [17] CONCERN: 'removeAll' wakes threads in 'waitUntilEmpty'
+// [18] CONCERN: no notification is lost to a concurrent push
+// [-1] PERFORMANCE: BATCH VS. SINGLE-ITEM THROUGHPUT
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -158,6 +172,17 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
 // ============================================================================
 //                        GLOBAL MACROS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -880,6 +905,347 @@ extern "C" void *case13_popFront(void *arg)
     return 0;
 }
 
+struct Case17Data {
+    bslmt::Barrier  *d_barrier_p;   // synchronizes each iteration
+    Obj             *d_queue_p;     // queue under test
+    bsls::AtomicInt *d_continue_p;  // 0 indicates the threads should exit;
+                                    // 2 indicates 'case17_waitUntilEmpty'
+                                    // has started
+};
+
+extern "C" void *case17_removeAll(void *arg)
+    // Until '*d_continue_p' is 0, invoke 'removeAll' on the queue described
+    // by the specified 'arg' once per iteration of the barrier protocol.
+{
+    Case17Data *data = static_cast<Case17Data *>(arg);
+
+    while (true) {
+        data->d_barrier_p->wait();
+
+        if (0 == *data->d_continue_p) {
+            break;
+        }
+
+        data->d_queue_p->removeAll();
+
+        data->d_barrier_p->wait();
+    }
+
+    return 0;
+}
+
+extern "C" void *case17_tryPopFront(void *arg)
+    // Until '*d_continue_p' is 0, invoke 'tryPopFront' twice on the queue
+    // described by the specified 'arg' once per iteration of the barrier
+    // protocol.
+{
+    Case17Data *data = static_cast<Case17Data *>(arg);
+
+    while (true) {
+        data->d_barrier_p->wait();
+
+        if (0 == *data->d_continue_p) {
+            break;
+        }
+
+        int value;
+
+        data->d_queue_p->tryPopFront(&value);
+        data->d_queue_p->tryPopFront(&value);
+
+        data->d_barrier_p->wait();
+    }
+
+    return 0;
+}
+
+extern "C" void *case17_waitUntilEmpty(void *arg)
+    // Set '*d_continue_p' to 2 and invoke 'waitUntilEmpty' on the queue
+    // described by the specified 'arg', asserting that it succeeds.
+{
+    Case17Data *data = static_cast<Case17Data *>(arg);
+
+    *data->d_continue_p = 2;
+
+    ASSERT(Obj::e_SUCCESS == data->d_queue_p->waitUntilEmpty());
+
+    return 0;
+}
+
+class TestWaiter : public bdlcc::BoundedQueueWaiter {
+    // This class provides a waiter that counts its notifications and,
+    // optionally, appends its identifier to a vector and posts to a
+    // semaphore when notified.
+
+    // DATA
+    bsls::AtomicInt   d_numNotified;  // number of notifications
+    int               d_id;           // identifier appended to 'd_order_p'
+    bsl::vector<int> *d_order_p;      // order of notification, or 0 (held)
+    bslmt::Semaphore *d_semaphore_p;  // posted when notified, or 0 (held)
+
+  public:
+    // CREATORS
+    explicit
+    TestWaiter(int               id        = 0,
+               bsl::vector<int> *order     = 0,
+               bslmt::Semaphore *semaphore = 0)
+        // Create a waiter having the optionally specified 'id', that appends
+        // 'id' to the optionally specified 'order' and posts to the
+        // optionally specified 'semaphore' when notified.
+    : d_numNotified(0)
+    , d_id(id)
+    , d_order_p(order)
+    , d_semaphore_p(semaphore)
+    {
+    }
+
+    // MANIPULATORS
+    void notify() BSLS_KEYWORD_OVERRIDE
+        // Record the notification of this waiter.
+    {
+        ++d_numNotified;
+        if (d_order_p) {
+            d_order_p->push_back(d_id);
+        }
+        if (d_semaphore_p) {
+            d_semaphore_p->post();
+        }
+    }
+
+    // ACCESSORS
+    int numNotified() const
+        // Return the number of times this waiter has been notified.
+    {
+        return d_numNotified;
+    }
+};
+
+struct Case18Data {
+    Obj             *d_queue_p;    // queue under test
+    bsls::AtomicInt *d_sum_p;      // sum of the values popped
+    int              d_numValues;  // number of values pushed per producer
+};
+
+extern "C" void *case18_consumer(void *arg)
+    // Until a negative value is popped, pop values from the queue described
+    // by the specified 'arg' and add them to '*d_sum_p', registering a waiter
+    // and waiting for its notification whenever the queue is empty.
+{
+    Case18Data *data = static_cast<Case18Data *>(arg);
+
+    bslmt::Semaphore semaphore;
+    TestWaiter       waiter(0, 0, &semaphore);
+
+    while (true) {
+        int value;
+        int rc = data->d_queue_p->tryPopFront(&value);
+        if (0 == rc) {
+            if (0 > value) {
+                break;
+            }
+            data->d_sum_p->add(value);
+        }
+        else {
+            ASSERTV(rc, Obj::e_EMPTY == rc);
+
+            if (0 == data->d_queue_p->registerPopFrontWaiter(&waiter)) {
+                semaphore.wait();
+            }
+        }
+    }
+
+    return 0;
+}
+
+extern "C" void *case18_producer(void *arg)
+    // Push 'd_numValues' values of 1 onto the queue described by the
+    // specified 'arg'.
+{
+    Case18Data *data = static_cast<Case18Data *>(arg);
+
+    for (int i = 0; i < data->d_numValues; ++i) {
+        ASSERT(0 == data->d_queue_p->pushBack(1));
+    }
+
+    return 0;
+}
+
+                        // ==========================
+                        // Batch Producer and Consumer
+                        // ==========================
+
+typedef bdlcc::BoundedQueue<bsls::Types::Uint64> BatchQueue;
+
+struct BatchThreadData {
+    // This 'struct' describes the work of a thread created by
+    // 'batchProducer' or 'batchConsumer'.  Elements pushed by producer 'id'
+    // have the value '(id << 32) + sequenceNumber'.
+
+    BatchQueue          *d_queue_p;       // queue under test
+    int                  d_id;            // producer identifier
+    int                  d_numItems;      // number of items to push
+    int                  d_batchSize;     // 1 indicates single-item methods
+    int                  d_numProducers;  // number of producers
+    bsls::Types::Uint64  d_numPopped;     // number of items popped
+    bsls::Types::Uint64  d_sum;           // sum of items popped
+    bool                 d_isOrdered;     // per-producer order observed
+};
+
+extern "C" void *batchProducer(void *arg)
+    // Push 'd_numItems' items onto the queue described by the specified 'arg'
+    // in batches of 'd_batchSize' items.
+{
+    BatchThreadData *data = static_cast<BatchThreadData *>(arg);
+
+    const bsls::Types::Uint64 base =
+                           static_cast<bsls::Types::Uint64>(data->d_id) << 32;
+
+    bsl::vector<bsls::Types::Uint64> values(data->d_batchSize);
+
+    for (int i = 0; i < data->d_numItems; ) {
+        if (1 == data->d_batchSize) {
+            int rc = data->d_queue_p->pushBack(base + i);
+            ASSERTV(rc, 0 == rc);
+            ++i;
+            continue;
+        }
+
+        const int numValues = bsl::min(data->d_batchSize,
+                                       data->d_numItems - i);
+
+        for (int j = 0; j < numValues; ++j) {
+            values[j] = base + i + j;
+        }
+
+        bsl::size_t numPushed = 0;
+
+        int rc = data->d_queue_p->pushBackBatch(&numPushed,
+                                                values.data(),
+                                                numValues);
+        ASSERTV(rc, 0 == rc);
+        ASSERTV(numPushed, numValues,
+                static_cast<bsl::size_t>(numValues) == numPushed);
+
+        i += numValues;
+    }
+
+    return 0;
+}
+
+extern "C" void *batchConsumer(void *arg)
+    // Pop items, in batches of up to 'd_batchSize' items, from the queue
+    // described by the specified 'arg' until popping is disabled, and record
+    // the number and sum of the items popped, and whether the items of each
+    // producer were observed in order.
+{
+    BatchThreadData *data = static_cast<BatchThreadData *>(arg);
+
+    bsl::vector<bsls::Types::Uint64> values(data->d_batchSize);
+    bsl::vector<bsls::Types::Uint64> next(data->d_numProducers, 0);
+
+    data->d_numPopped = 0;
+    data->d_sum       = 0;
+    data->d_isOrdered = true;
+
+    while (true) {
+        bsl::size_t numPopped = 1;
+
+        int rc = 1 == data->d_batchSize
+               ? data->d_queue_p->popFront(&values[0])
+               : data->d_queue_p->popFrontBatch(&numPopped,
+                                                values.data(),
+                                                data->d_batchSize);
+
+        if (BatchQueue::e_DISABLED == rc) {
+            break;
+        }
+        ASSERTV(rc, 0 == rc);
+
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            const bsls::Types::Uint64 producer = values[i] >> 32;
+            const bsls::Types::Uint64 sequence = values[i] & 0xffffffff;
+
+            if (sequence < next[static_cast<bsl::size_t>(producer)]) {
+                data->d_isOrdered = false;
+            }
+            next[static_cast<bsl::size_t>(producer)] = sequence + 1;
+
+            data->d_sum += values[i];
+        }
+        data->d_numPopped += numPopped;
+    }
+
+    return 0;
+}
+
+double runBatchThroughput(bsl::size_t capacity,
+                          int         numProducers,
+                          int         numConsumers,
+                          int         numItems,
+                          int         batchSize)
+    // Push the specified 'numItems' items from each of the specified
+    // 'numProducers' threads and pop them from the specified 'numConsumers'
+    // threads through a queue having the specified 'capacity', using batches
+    // of the specified 'batchSize' items (a 'batchSize' of 1 selects the
+    // single-item methods).  Return the number of items transferred per
+    // second.
+{
+    BatchQueue queue(capacity);
+
+    bsl::vector<BatchThreadData>           producers(numProducers);
+    bsl::vector<BatchThreadData>           consumers(numConsumers);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numProducers +
+                                                   numConsumers);
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < numConsumers; ++i) {
+        BatchThreadData& data = consumers[i];
+
+        data.d_queue_p      = &queue;
+        data.d_id           = i;
+        data.d_numItems     = 0;
+        data.d_batchSize    = batchSize;
+        data.d_numProducers = numProducers;
+
+        bslmt::ThreadUtil::create(&handles[i], batchConsumer, &data);
+    }
+    for (int i = 0; i < numProducers; ++i) {
+        BatchThreadData& data = producers[i];
+
+        data.d_queue_p      = &queue;
+        data.d_id           = i;
+        data.d_numItems     = numItems;
+        data.d_batchSize    = batchSize;
+        data.d_numProducers = numProducers;
+
+        bslmt::ThreadUtil::create(&handles[numConsumers + i],
+                                  batchProducer,
+                                  &data);
+    }
+    for (int i = 0; i < numProducers; ++i) {
+        bslmt::ThreadUtil::join(handles[numConsumers + i]);
+    }
+
+    queue.waitUntilEmpty();
+    timer.stop();
+
+    queue.disablePopFront();
+
+    bsls::Types::Uint64 numPopped = 0;
+    for (int i = 0; i < numConsumers; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+        numPopped += consumers[i].d_numPopped;
+    }
+
+    ASSERTV(numPopped, static_cast<bsls::Types::Uint64>(numItems)
+                                                             * numProducers ==
+                                                                   numPopped);
+
+    return static_cast<double>(numPopped) / timer.elapsedTime();
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -905,238 +1271,1114 @@ int getValue(int *value, char specChar, int verboseFlag);
     // 'verboseFlag' is set.  Return 0 if operation successful, return non-zero
     // otherwise.
 
-enum { e_SUCCESS_PUSHBACK = -1, e_SUCCESS_REMOVEALL = -2 };
+enum { e_SUCCESS_PUSHBACK = -1, e_SUCCESS_REMOVEALL = -2 };
+
+int getValue(int *value, char specChar, int verboseFlag)
+{
+    static int values[] = { 0, 1, 2, 3, 4 };
+
+    if ('~' == specChar) {
+        return e_SUCCESS_REMOVEALL;                                   // RETURN
+    }
+
+    if ('a' <= specChar && 'e' >= specChar) {
+        *value = values[specChar - 'a'];
+        return e_SUCCESS_PUSHBACK;                                    // RETURN
+    }
+
+    if (verboseFlag) {
+        cerr << "\t\tERROR!" << endl;
+        cerr << specChar << " not recognized." << endl;
+    }
+
+    return 1;
+}
+
+template <class OBJ>
+int ggg(OBJ *object, const char *spec, int verboseFlag = 1)
+    // Configure the specified 'object' according to the specified 'spec',
+    // using only the primary manipulator functions 'pushBack' and 'removeAll'.
+    // Optionally specify a zero 'verboseFlag' to suppress 'spec' syntax error
+    // messages.  Return the index of the first invalid character, and a
+    // negative value otherwise.  Note that this function is used to implement
+    // 'gg' as well as allow for verification of syntax error detection.
+{
+    enum { e_SUCCESS = -1 };
+
+    typename OBJ::value_type v;
+
+    for (int i = 0; spec[i]; ++i) {
+        int rv = getValue(&v, spec[i], verboseFlag);
+        if (rv > -1) {
+            return i;                                                 // RETURN
+        }
+        else if (e_SUCCESS_PUSHBACK  == rv) {
+            object->pushBack(v);
+        }
+        else if (e_SUCCESS_REMOVEALL == rv) {
+            object->removeAll();
+        }
+    }
+
+    return e_SUCCESS;
+}
+
+template <class OBJ>
+OBJ& gg(OBJ *object, const char *spec)
+    // Return, by reference, the specified 'object' with its value adjusted
+    // according to the specified 'spec'.
+{
+    ASSERT(ggg(object, spec) < 0);
+    return *object;
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Simple Thread Pool
+///- - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::BoundedQueue' is used to communicate
+// between a single "producer" thread and multiple "consumer" threads.  The
+// "producer" will push work requests onto the queue, and each "consumer" will
+// iteratively take a work request from the queue and service the request.
+// This example shows a partial, simplified implementation of the
+// 'bdlmt::FixedThreadPool' class.  See component 'bdlmt_fixedthreadpool' for
+// more information.
+//
+// First, we define a utility classes that handles a simple "work item":
+//..
+    struct my_WorkData {
+        // Work data...
+    };
+
+    struct my_WorkRequest {
+        enum RequestType {
+            e_WORK = 1,
+            e_STOP = 2
+        };
+
+        RequestType d_type;
+        my_WorkData d_data;
+        // Work data...
+    };
+//..
+// Next, we provide a simple function to service an individual work item.  The
+// details are unimportant for this example:
+//..
+    void myDoWork(const my_WorkData& data)
+        // Do some work based upon the specified 'data'.
+    {
+        // do some stuff...
+        (void)data;
+    }
+//..
+// Then, we define a 'myConsumer' function that will pop elements off the queue
+// and process them.  Note that the call to 'queue->popFront()' will block
+// until there is an element available on the queue.  This function will be
+// executed in multiple threads, so that each thread waits in
+// 'queue->popFront()', and 'bdlcc::BoundedQueue' guarantees that each thread
+// gets a unique element from the queue:
+//..
+    void myConsumer(bdlcc::BoundedQueue<my_WorkRequest> *queue)
+        // Pop elements from the specified 'queue'.
+    {
+        while (1) {
+            // 'popFront()' will wait for a 'my_WorkRequest' until available.
+
+            my_WorkRequest item;
+            item.d_type = my_WorkRequest::e_WORK;
+
+            ASSERT(0 == queue->popFront(&item));
+
+            if (item.d_type == my_WorkRequest::e_STOP) { break; }
+            myDoWork(item.d_data);
+        }
+    }
+//..
+// Finally, we define a 'myProducer' function that serves multiple roles: it
+// creates the 'bdlcc::BoundedQueue', starts the consumer threads, and then
+// produces and enqueues work items.  When work requests are exhausted, this
+// function enqueues one 'e_STOP' item for each consumer queue.  This 'e_STOP'
+// item indicates to the consumer thread to terminate its thread-handling
+// function.
+//
+// Note that, although the producer cannot control which thread 'pop's a
+// particular work item, it can rely on the knowledge that each consumer thread
+// will read a single 'e_STOP' item and then terminate.
+//..
+    void myProducer(int numThreads)
+        // Create a queue, start the specified 'numThreads' consumer threads,
+        // produce and enqueue work.
+    {
+        enum {
+            k_MAX_QUEUE_LENGTH = 100,
+            k_NUM_WORK_ITEMS   = 1000
+        };
+
+        bdlcc::BoundedQueue<my_WorkRequest> queue(k_MAX_QUEUE_LENGTH);
+
+        bslmt::ThreadGroup consumerThreads;
+        consumerThreads.addThreads(bdlf::BindUtil::bind(&myConsumer, &queue),
+                                   numThreads);
+
+        for (int i = 0; i < k_NUM_WORK_ITEMS; ++i) {
+            my_WorkRequest item;
+            item.d_type = my_WorkRequest::e_WORK;
+            item.d_data = my_WorkData(); // some stuff to do
+            queue.pushBack(item);
+        }
+
+        for (int i = 0; i < numThreads; ++i) {
+            my_WorkRequest item;
+            item.d_type = my_WorkRequest::e_STOP;
+            queue.pushBack(item);
+        }
+
+        consumerThreads.joinAll();
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 19: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslmt::ThreadUtil::Handle watchdogHandle;
+
+        s_continue = 1;
+
+        bslmt::ThreadUtil::create(&watchdogHandle,
+                                  watchdog,
+                                  const_cast<char *>("usage example"));
+
+        enum { k_NUM_THREADS = 4 };
+
+        myProducer(k_NUM_THREADS);
+
+        s_continue = 0;
+
+        bslmt::ThreadUtil::join(watchdogHandle);
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // POP WAITERS
+        //
+        // Concerns:
+        //: 1 A waiter registered with an empty queue is notified exactly once,
+        //:   by the first push, and is then no longer registered.
+        //:
+        //: 2 A waiter is not registered (and not notified) if the queue is not
+        //:   empty or popping is disabled.
+        //:
+        //: 3 'deregisterPopFrontWaiter' returns 'true' for a registered
+        //:   waiter, which is then not notified, and 'false' otherwise.
+        //:
+        //: 4 A push making 'n' elements available notifies up to 'n' waiters,
+        //:   in the order of registration, and 'disablePopFront' notifies all
+        //:   registered waiters.
+        //:
+        //: 5 No notification is lost to a push concurrent with the
+        //:   registration of a waiter.
+        //:
+        //: 6 Registration allocates no memory.
+        //
+        // Plan:
+        //: 1 Register a waiter with an empty queue, verify that it is not
+        //:   notified until an element is pushed, and that it is notified
+        //:   once by that push and not by a subsequent one.  (C-1)
+        //:
+        //: 2 Attempt to register a waiter with a non-empty queue and with a
+        //:   queue that is dequeue disabled, and verify the status and that
+        //:   the waiter is not notified.  (C-2)
+        //:
+        //: 3 Deregister registered, notified, and never registered waiters,
+        //:   verify the status, and that a deregistered waiter is not
+        //:   notified by a subsequent push.  (C-3)
+        //:
+        //: 4 Register several waiters, push single elements and a batch, and
+        //:   disable popping, verifying the waiters notified, and their
+        //:   order, after each step.  (C-4)
+        //:
+        //: 5 Have several consumer threads pop until a negative value is
+        //:   popped, registering a waiter and waiting for its notification
+        //:   whenever the queue is empty, while several producers push
+        //:   values.  Verify the sum of the values popped, and use a watchdog
+        //:   to detect a lost notification.  (C-5)
+        //:
+        //: 6 Use a test allocator monitor to verify that no memory is
+        //:   allocated by registration and notification.  (C-6)
+        //
+        // Testing:
+        //   bool deregisterPopFrontWaiter(BoundedQueueWaiter *waiter);
+        //   int registerPopFrontWaiter(BoundedQueueWaiter *waiter);
+        //   CONCERN: no notification is lost to a concurrent push
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "POP WAITERS" << endl
+                          << "===========" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tNotification by a push." << endl;
+        {
+            Obj mX(4, &oa);
+
+            TestWaiter waiter;
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            ASSERT(0 == mX.registerPopFrontWaiter(&waiter));
+            ASSERT(0 == waiter.numNotified());
+
+            mX.pushBack(1);
+            ASSERTV(waiter.numNotified(), 1 == waiter.numNotified());
+
+            mX.pushBack(2);
+            ASSERTV(waiter.numNotified(), 1 == waiter.numNotified());
+
+            ASSERT(false == mX.deregisterPopFrontWaiter(&waiter));
+            ASSERT(oam.isTotalSame());
+        }
+
+        if (verbose) cout << "\tRegistration that fails." << endl;
+        {
+            Obj mX(4, &oa);
+
+            TestWaiter waiter;
+
+            mX.pushBack(1);
+            ASSERT(0 != mX.registerPopFrontWaiter(&waiter));
+
+            int value;
+            ASSERT(0 == mX.tryPopFront(&value));
+
+            mX.disablePopFront();
+            ASSERT(0 != mX.registerPopFrontWaiter(&waiter));
+
+            mX.enablePopFront();
+            mX.pushBack(2);
+            ASSERT(0 == waiter.numNotified());
+        }
+
+        if (verbose) cout << "\tDeregistration." << endl;
+        {
+            Obj mX(4, &oa);
+
+            TestWaiter waiter1(1);
+            TestWaiter waiter2(2);
+            TestWaiter waiter3(3);
+            TestWaiter waiter4(4);
+
+            ASSERT(false == mX.deregisterPopFrontWaiter(&waiter1));
+
+            ASSERT(0 == mX.registerPopFrontWaiter(&waiter1));
+            ASSERT(0 == mX.registerPopFrontWaiter(&waiter2));
+            ASSERT(0 == mX.registerPopFrontWaiter(&waiter3));
+            ASSERT(0 == mX.registerPopFrontWaiter(&waiter4));
+
+            // Remove from the middle, the front, and the back of the list.
+
+            ASSERT(true  == mX.deregisterPopFrontWaiter(&waiter2));
+            ASSERT(false == mX.deregisterPopFrontWaiter(&waiter2));
+            ASSERT(true  == mX.deregisterPopFrontWaiter(&waiter1));
+            ASSERT(true  == mX.deregisterPopFrontWaiter(&waiter4));
+
+            mX.pushBack(1);
+            mX.pushBack(2);
+
+            ASSERT(0 == waiter1.numNotified());
+            ASSERT(0 == waiter2.numNotified());
+            ASSERT(1 == waiter3.numNotified());
+            ASSERT(0 == waiter4.numNotified());
+
+            ASSERT(false == mX.deregisterPopFrontWaiter(&waiter3));
+        }
+
+        if (verbose) cout << "\tOrder and number notified." << endl;
+        {
+            const int NUM_WAITERS = 6;
+
+            Obj mX(8, &oa);
+
+            bsl::vector<int> order;
+            order.reserve(2 * NUM_WAITERS);
+
+            TestWaiter waiter0(0, &order);
+            TestWaiter waiter1(1, &order);
+            TestWaiter waiter2(2, &order);
+            TestWaiter waiter3(3, &order);
+            TestWaiter waiter4(4, &order);
+            TestWaiter waiter5(5, &order);
+
+            TestWaiter *WAITERS[NUM_WAITERS] = {
+                &waiter0, &waiter1, &waiter2, &waiter3, &waiter4, &waiter5
+            };
+
+            for (int i = 0; i < NUM_WAITERS; ++i) {
+                ASSERTV(i, 0 == mX.registerPopFrontWaiter(WAITERS[i]));
+            }
+
+            mX.pushBack(1);
+            ASSERTV(order.size(), 1 == order.size());
+            ASSERT(0 == order[0]);
+
+            // Notified waiters are not registered, and so may register again
+            // once the queue is empty.
+
+            int value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(0 == mX.registerPopFrontWaiter(&waiter0));
+
+            const int VALUES[] = { 2, 3 };
+            bsl::size_t numPushed;
+            ASSERT(0 == mX.pushBackBatch(&numPushed, VALUES, 2));
+            ASSERTV(order.size(), 3 == order.size());
+            ASSERT(1 == order[1]);
+            ASSERT(2 == order[2]);
+
+            mX.disablePopFront();
+            ASSERTV(order.size(), 7 == order.size());
+            ASSERT(3 == order[3]);
+            ASSERT(4 == order[4]);
+            ASSERT(5 == order[5]);
+            ASSERT(0 == order[6]);
+
+            for (int i = 0; i < NUM_WAITERS; ++i) {
+                ASSERTV(i, false == mX.deregisterPopFrontWaiter(WAITERS[i]));
+            }
+        }
+
+        if (verbose) cout << "\tConcurrent registration and push." << endl;
+        {
+            const int NUM_CONSUMERS = 4;
+            const int NUM_PRODUCERS = 2;
+            const int NUM_VALUES    = 10000;  // per producer
+
+            bslmt::ThreadUtil::Handle watchdogHandle;
+
+            s_continue = 1;
+
+            bslmt::ThreadUtil::create(&watchdogHandle,
+                                      watchdog,
+                                      const_cast<char *>("pop waiters"));
+
+            Obj mX(16, &oa);
+
+            bsls::AtomicInt sum(0);
+
+            Case18Data data;
+
+            data.d_queue_p   = &mX;
+            data.d_sum_p     = &sum;
+            data.d_numValues = NUM_VALUES;
+
+            bslmt::ThreadUtil::Handle consumers[NUM_CONSUMERS];
+            for (int i = 0; i < NUM_CONSUMERS; ++i) {
+                bslmt::ThreadUtil::create(&consumers[i],
+                                          case18_consumer,
+                                          &data);
+            }
+
+            bslmt::ThreadUtil::Handle producers[NUM_PRODUCERS];
+            for (int i = 0; i < NUM_PRODUCERS; ++i) {
+                bslmt::ThreadUtil::create(&producers[i],
+                                          case18_producer,
+                                          &data);
+            }
+            for (int i = 0; i < NUM_PRODUCERS; ++i) {
+                bslmt::ThreadUtil::join(producers[i]);
+            }
+
+            for (int i = 0; i < NUM_CONSUMERS; ++i) {
+                mX.pushBack(-1);
+            }
+
+            for (int i = 0; i < NUM_CONSUMERS; ++i) {
+                bslmt::ThreadUtil::join(consumers[i]);
+            }
+
+            ASSERTV(sum, NUM_PRODUCERS * NUM_VALUES == sum);
+            ASSERT(mX.isEmpty());
+
+            s_continue = 0;
+            bslmt::ThreadUtil::join(watchdogHandle);
+        }
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'removeAll' WAKES THREADS IN 'waitUntilEmpty'
+        //
+        // Concerns:
+        //: 1 A thread blocked in 'waitUntilEmpty' is woken when 'removeAll'
+        //:   leaves the queue empty.
+        //:
+        //: 2 Such a thread is woken when 'removeAll', racing with
+        //:   'tryPopFront', leaves the queue empty.
+        //
+        // Plan:
+        //: 1 Push elements, start a thread that executes 'waitUntilEmpty',
+        //:   and once it has started, execute 'removeAll'.  Join the thread
+        //:   under a watchdog to detect a missed wake-up.  (C-1)
+        //:
+        //: 2 For a fixed number of iterations, push elements and have one
+        //:   thread execute 'removeAll' while another executes 'tryPopFront'
+        //:   as the main thread executes 'waitUntilEmpty'.  Each iteration is
+        //:   delimited by a barrier, so the case performs a bounded amount of
+        //:   work regardless of the number of processors.  Use a watchdog to
+        //:   detect a missed wake-up.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'removeAll' wakes threads in 'waitUntilEmpty'
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << "CONCERN: 'removeAll' WAKES THREADS IN 'waitUntilEmpty'\n"
+                 << "======================================================\n";
+        }
+
+        bslmt::ThreadUtil::Handle watchdogHandle;
+
+        s_continue = 1;
+
+        bslmt::ThreadUtil::create(&watchdogHandle,
+                                  watchdog,
+                                  const_cast<char *>(
+                                        "'waitUntilEmpty' with 'removeAll'"));
+
+        if (verbose) {
+            cout << "\tTesting a single blocked 'waitUntilEmpty'." << endl;
+        }
+        {
+            Obj mX(32);
+
+            bsls::AtomicInt state(1);
+
+            Case17Data data;
+
+            data.d_barrier_p  = 0;
+            data.d_queue_p    = &mX;
+            data.d_continue_p = &state;
+
+            for (int j = 0; j < 4; ++j) {
+                mX.pushBack(j);
+            }
+
+            bslmt::ThreadUtil::Handle waitHandle;
+
+            bslmt::ThreadUtil::create(&waitHandle,
+                                      case17_waitUntilEmpty,
+                                      &data);
+
+            while (2 != state) {
+                bslmt::ThreadUtil::yield();
+            }
+            bslmt::ThreadUtil::microSleep(10000);
+
+            mX.removeAll();
+
+            bslmt::ThreadUtil::join(waitHandle);
+
+            ASSERT(mX.isEmpty());
+        }
+
+        if (verbose) {
+            cout << "\tTesting 'removeAll' racing with 'tryPopFront'."
+                 << endl;
+        }
+        {
+            const int k_NUM_ITERATIONS = 1000;
+
+            Obj mX(32);
+
+            bslmt::Barrier  barrier(3);
+            bsls::AtomicInt proceed(1);
+
+            Case17Data data;
+
+            data.d_barrier_p  = &barrier;
+            data.d_queue_p    = &mX;
+            data.d_continue_p = &proceed;
+
+            bslmt::ThreadUtil::Handle removeAllHandle, tryPopHandle;
+
+            bslmt::ThreadUtil::create(&removeAllHandle,
+                                      case17_removeAll,
+                                      &data);
+            bslmt::ThreadUtil::create(&tryPopHandle,
+                                      case17_tryPopFront,
+                                      &data);
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                for (int j = 0; j < 4; ++j) {
+                    mX.pushBack(j);
+                }
+
+                barrier.wait();
+
+                ASSERTV(i, Obj::e_SUCCESS == mX.waitUntilEmpty());
+
+                barrier.wait();
+
+                ASSERTV(i, mX.isEmpty());
+            }
+
+            proceed = 0;
+            barrier.wait();
+
+            bslmt::ThreadUtil::join(removeAllHandle);
+            bslmt::ThreadUtil::join(tryPopHandle);
+        }
+
+        s_continue = 0;
+        bslmt::ThreadUtil::join(watchdogHandle);
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS AND CAPACITY MODE
+        //
+        // Concerns:
+        //: 1 A queue constructed with 'e_ROUND_UP_TO_POWER_OF_TWO' has the
+        //:   smallest power-of-two capacity not less than the requested
+        //:   capacity (and at least 2), and a queue constructed with
+        //:   'e_EXACT_CAPACITY' has the same capacity as one constructed
+        //:   without a capacity mode.
+        //:
+        //: 2 The batch methods transfer elements in FIFO order, including
+        //:   across the wrap-around of the circular buffer, and interoperate
+        //:   with the single-item methods, for capacities that are and are
+        //:   not powers of two.
+        //:
+        //: 3 'tryPushBackBatch' appends as many values as there is space
+        //:   for and returns 'e_FULL' when there is none; 'tryPopFrontBatch'
+        //:   removes as many elements as are available and returns 'e_EMPTY'
+        //:   when there are none.
+        //:
+        //: 4 The batch methods return 'e_DISABLED', and report no elements
+        //:   transferred, when the corresponding operation is disabled.
+        //:
+        //: 5 An exception thrown while copying a value into, or assigning a
+        //:   value out of, the queue leaves the queue in a usable state.
+        //:
+        //: 6 Concurrent batch producers and consumers transfer every element
+        //:   exactly once, and each consumer observes the elements of each
+        //:   producer in order.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Verify 'capacity' for a variety of requested capacities in each
+        //:   mode.  (C-1)
+        //:
+        //: 2 For a variety of capacities and batch sizes, repeatedly fill and
+        //:   drain the queue with the batch and single-item methods and
+        //:   verify the values and the return codes.  (C-2..3)
+        //:
+        //: 3 Disable push and pop and verify the batch methods fail.  (C-4)
+        //:
+        //: 4 Using a type that allocates on copy and assignment, use the
+        //:   test allocator's allocation limit to throw from within a batch
+        //:   push and a batch pop, and verify the queue remains usable.
+        //:   (C-5)
+        //:
+        //: 5 Run several producer and consumer threads using the batch
+        //:   methods and verify the number, sum, and per-producer order of
+        //:   the popped elements.  (C-6)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-7)
+        //
+        // Testing:
+        //   BoundedQueue(bsl::size_t capacity, CapacityMode mode, *bA = 0);
+        //   int popFrontBatch(size_t *numPopped, TYPE *values, size_t max);
+        //   int pushBackBatch(size_t *numPushed, const TYPE *values, size_t);
+        //   int tryPopFrontBatch(size_t *numPopped, TYPE *values, size_t max);
+        //   int tryPushBackBatch(size_t *numPushed, const TYPE *, size_t num);
+        //   CONCERN: batch operations claim contiguous ranges correctly
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS AND CAPACITY MODE" << endl
+                          << "==================================" << endl;
+
+        if (verbose) cout << "\nTesting capacity mode." << endl;
+        {
+            static const struct {
+                int         d_line;
+                bsl::size_t d_capacity;
+                bsl::size_t d_exact;
+                bsl::size_t d_rounded;
+            } DATA[] = {
+                //LINE  CAP   EXACT  ROUNDED
+                //----  ----  -----  -------
+                { L_,      0,     2,       2 },
+                { L_,      1,     2,       2 },
+                { L_,      2,     2,       2 },
+                { L_,      3,     3,       4 },
+                { L_,      8,     8,       8 },
+                { L_,     17,    17,      32 },
+                { L_,   1000,  1000,    1024 },
+                { L_,   1024,  1024,    1024 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE    = DATA[ti].d_line;
+                const bsl::size_t CAP     = DATA[ti].d_capacity;
+                const bsl::size_t EXACT   = DATA[ti].d_exact;
+                const bsl::size_t ROUNDED = DATA[ti].d_rounded;
+
+                Obj mA(CAP, &sa);
+                Obj mB(CAP, Obj::e_EXACT_CAPACITY, &sa);
+                Obj mC(CAP, Obj::e_ROUND_UP_TO_POWER_OF_TWO, &sa);
+
+                ASSERTV(LINE, EXACT   == mA.capacity());
+                ASSERTV(LINE, EXACT   == mB.capacity());
+                ASSERTV(LINE, ROUNDED == mC.capacity());
+
+                ASSERTV(LINE, &sa == mC.allocator());
+            }
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting FIFO order and wrap-around." << endl;
+        {
+            static const bsl::size_t CAPACITIES[] = { 2, 3, 7, 8, 16, 17 };
+            const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+            static const bsl::size_t BATCHES[] = { 1, 2, 3, 5, 8, 40 };
+            const int NUM_BATCHES = sizeof BATCHES / sizeof *BATCHES;
+
+            for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            for (int bi = 0; bi < NUM_BATCHES;    ++bi) {
+                const bsl::size_t CAP   = CAPACITIES[ci];
+                const bsl::size_t BATCH = BATCHES[bi];
+
+                if (veryVerbose) { P_(CAP) P(BATCH) }
+
+                Obj mX(CAP);  const Obj& X = mX;
+
+                bsl::vector<int> values(BATCH);
+                bsl::vector<int> results(BATCH);
+
+                int nextPush = 0;
+                int nextPop  = 0;
+
+                for (int iteration = 0; iteration < 20; ++iteration) {
+
+                    // Fill the queue, alternating batch and single pushes.
+
+                    while (!X.isFull()) {
+                        for (bsl::size_t i = 0; i < BATCH; ++i) {
+                            values[i] = nextPush + static_cast<int>(i);
+                        }
+
+                        bsl::size_t numPushed = 99;
+
+                        int rc = mX.tryPushBackBatch(&numPushed,
+                                                     values.data(),
+                                                     BATCH);
+                        ASSERTV(CAP, BATCH, rc, 0 == rc);
+                        ASSERTV(CAP, BATCH, numPushed,
+                                0 < numPushed && numPushed <= BATCH);
+
+                        nextPush += static_cast<int>(numPushed);
+
+                        if (!X.isFull() && 1 == iteration % 2) {
+                            ASSERT(0 == mX.tryPushBack(nextPush++));
+                        }
+                    }
+
+                    ASSERTV(CAP, BATCH, CAP == X.numElements());
+                    ASSERTV(CAP, BATCH, nextPush - nextPop ==
+                                      static_cast<int>(X.numElements()));
+
+                    {
+                        bsl::size_t numPushed = 99;
+
+                        ASSERT(Obj::e_FULL == mX.tryPushBackBatch(
+                                                               &numPushed,
+                                                               values.data(),
+                                                               BATCH));
+                        ASSERT(0 == numPushed);
+                    }
+
+                    // Drain the queue, alternating batch and single pops.
+
+                    while (!X.isEmpty()) {
+                        if (1 == iteration % 3) {
+                            int value;
+
+                            ASSERT(0 == mX.tryPopFront(&value));
+                            ASSERTV(CAP, BATCH, nextPop, value,
+                                    nextPop == value);
+                            ++nextPop;
+                            continue;
+                        }
+
+                        bsl::size_t numPopped = 99;
+
+                        int rc = 0 == iteration % 3
+                               ? mX.tryPopFrontBatch(&numPopped,
+                                                     results.data(),
+                                                     BATCH)
+                               : mX.popFrontBatch(&numPopped,
+                                                  results.data(),
+                                                  BATCH);
+                        ASSERTV(CAP, BATCH, rc, 0 == rc);
+                        ASSERTV(CAP, BATCH, numPopped,
+                                0 < numPopped && numPopped <= BATCH);
+
+                        for (bsl::size_t i = 0; i < numPopped; ++i) {
+                            ASSERTV(CAP, BATCH, nextPop, results[i],
+                                    nextPop == results[i]);
+                            ++nextPop;
+                        }
+                    }
+
+                    ASSERTV(CAP, BATCH, nextPush == nextPop);
+
+                    {
+                        bsl::size_t numPopped = 99;
+
+                        ASSERT(Obj::e_EMPTY == mX.tryPopFrontBatch(
+                                                              &numPopped,
+                                                              results.data(),
+                                                              BATCH));
+                        ASSERT(0 == numPopped);
+                    }
+
+                    // Push a partial batch with the blocking method.
+
+                    const bsl::size_t NUM = bsl::min(BATCH, CAP);
+
+                    for (bsl::size_t i = 0; i < NUM; ++i) {
+                        values[i] = nextPush + static_cast<int>(i);
+                    }
+
+                    bsl::size_t numPushed = 99;
+
+                    ASSERT(0 == mX.pushBackBatch(&numPushed,
+                                                 values.data(),
+                                                 NUM));
+                    ASSERT(NUM == numPushed);
+                    ASSERT(NUM == X.numElements());
+
+                    nextPush += static_cast<int>(NUM);
+                }
+
+                // Empty batches are allowed for the push methods.
+
+                bsl::size_t numPushed = 99;
+
+                ASSERT(0 == mX.pushBackBatch(&numPushed, 0, 0));
+                ASSERT(0 == numPushed);
+
+                numPushed = 99;
+
+                ASSERT(0 == mX.tryPushBackBatch(&numPushed, 0, 0));
+                ASSERT(0 == numPushed);
+
+                mX.removeAll();
+
+                ASSERT(X.isEmpty());
+            }
+            }
+        }
+
+        if (verbose) cout << "\nTesting disabled states." << endl;
+        {
+            Obj mX(8);  const Obj& X = mX;
+
+            int         values[4] = { 1, 2, 3, 4 };
+            bsl::size_t num       = 99;
+
+            ASSERT(0 == mX.pushBackBatch(&num, values, 4));
+            ASSERT(4 == num);
+
+            mX.disablePushBack();
+
+            num = 99;
+            ASSERT(Obj::e_DISABLED == mX.pushBackBatch(&num, values, 4));
+            ASSERT(0 == num);
+
+            num = 99;
+            ASSERT(Obj::e_DISABLED == mX.tryPushBackBatch(&num, values, 4));
+            ASSERT(0 == num);
+
+            ASSERT(4 == X.numElements());
+
+            mX.disablePopFront();
+
+            num = 99;
+            ASSERT(Obj::e_DISABLED == mX.popFrontBatch(&num, values, 4));
+            ASSERT(0 == num);
+
+            num = 99;
+            ASSERT(Obj::e_DISABLED == mX.tryPopFrontBatch(&num, values, 4));
+            ASSERT(0 == num);
+
+            ASSERT(4 == X.numElements());
+
+            mX.enablePopFront();
+            mX.enablePushBack();
+
+            ASSERT(0 == mX.tryPopFrontBatch(&num, values, 4));
+            ASSERT(4 == num);
+            ASSERT(1 == values[0] && 4 == values[3]);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nTesting exception safety." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            typedef bdlcc::BoundedQueue<AllocExceptionHelper> HObj;
+
+            HObj mX(8, &sa);  const HObj& X = mX;
+
+            AllocExceptionHelper value(&sa);
+
+            bsl::vector<AllocExceptionHelper> values(3, value, &sa);
 
-int getValue(int *value, char specChar, int verboseFlag)
-{
-    static int values[] = { 0, 1, 2, 3, 4 };
+            // Throw while copying the second of three values.
 
-    if ('~' == specChar) {
-        return e_SUCCESS_REMOVEALL;                                   // RETURN
-    }
+            int numException = 0;
 
-    if ('a' <= specChar && 'e' >= specChar) {
-        *value = values[specChar - 'a'];
-        return e_SUCCESS_PUSHBACK;                                    // RETURN
-    }
+            sa.setAllocationLimit(1);
+            try {
+                bsl::size_t numPushed;
 
-    if (verboseFlag) {
-        cerr << "\t\tERROR!" << endl;
-        cerr << specChar << " not recognized." << endl;
-    }
+                mX.tryPushBackBatch(&numPushed, values.data(), 3);
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
 
-    return 1;
-}
+            ASSERT(1 == numException);
+            ASSERT(1 == X.numElements());
 
-template <class OBJ>
-int ggg(OBJ *object, const char *spec, int verboseFlag = 1)
-    // Configure the specified 'object' according to the specified 'spec',
-    // using only the primary manipulator functions 'pushBack' and 'removeAll'.
-    // Optionally specify a zero 'verboseFlag' to suppress 'spec' syntax error
-    // messages.  Return the index of the first invalid character, and a
-    // negative value otherwise.  Note that this function is used to implement
-    // 'gg' as well as allow for verification of syntax error detection.
-{
-    enum { e_SUCCESS = -1 };
+            // The two nodes that were not written are reclaimed by the next
+            // pop that passes over them.
 
-    typename OBJ::value_type v;
+            bsl::size_t num = 99;
 
-    for (int i = 0; spec[i]; ++i) {
-        int rv = getValue(&v, spec[i], verboseFlag);
-        if (rv > -1) {
-            return i;                                                 // RETURN
-        }
-        else if (e_SUCCESS_PUSHBACK  == rv) {
-            object->pushBack(v);
-        }
-        else if (e_SUCCESS_REMOVEALL == rv) {
-            object->removeAll();
-        }
-    }
+            ASSERT(0 == mX.tryPopFrontBatch(&num, values.data(), 3));
+            ASSERT(1 == num);
+            ASSERT(0 == X.numElements());
 
-    return e_SUCCESS;
-}
+            ASSERT(0 == mX.pushBack(value));
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(X.isEmpty());
 
-template <class OBJ>
-OBJ& gg(OBJ *object, const char *spec)
-    // Return, by reference, the specified 'object' with its value adjusted
-    // according to the specified 'spec'.
-{
-    ASSERT(ggg(object, spec) < 0);
-    return *object;
-}
+            ASSERT(0 == mX.tryPushBackBatch(&num, values.data(), 3));
+            ASSERT(3 == num);
 
-// ============================================================================
-//                                USAGE EXAMPLE
-// ----------------------------------------------------------------------------
+            // Throw while assigning the second of three popped values.
 
-///Usage
-///-----
-// This section illustrates intended use of this component.
-//
-///Example 1: A Simple Thread Pool
-///- - - - - - - - - - - - - - - -
-// In the following example a 'bdlcc::BoundedQueue' is used to communicate
-// between a single "producer" thread and multiple "consumer" threads.  The
-// "producer" will push work requests onto the queue, and each "consumer" will
-// iteratively take a work request from the queue and service the request.
-// This example shows a partial, simplified implementation of the
-// 'bdlmt::FixedThreadPool' class.  See component 'bdlmt_fixedthreadpool' for
-// more information.
-//
-// First, we define a utility classes that handles a simple "work item":
-//..
-    struct my_WorkData {
-        // Work data...
-    };
+            numException = 0;
 
-    struct my_WorkRequest {
-        enum RequestType {
-            e_WORK = 1,
-            e_STOP = 2
-        };
+            sa.setAllocationLimit(1);
+            try {
+                mX.popFrontBatch(&num, values.data(), 3);
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
 
-        RequestType d_type;
-        my_WorkData d_data;
-        // Work data...
-    };
-//..
-// Next, we provide a simple function to service an individual work item.  The
-// details are unimportant for this example:
-//..
-    void myDoWork(const my_WorkData& data)
-        // Do some work based upon the specified 'data'.
-    {
-        // do some stuff...
-        (void)data;
-    }
-//..
-// Then, we define a 'myConsumer' function that will pop elements off the queue
-// and process them.  Note that the call to 'queue->popFront()' will block
-// until there is an element available on the queue.  This function will be
-// executed in multiple threads, so that each thread waits in
-// 'queue->popFront()', and 'bdlcc::BoundedQueue' guarantees that each thread
-// gets a unique element from the queue:
-//..
-    void myConsumer(bdlcc::BoundedQueue<my_WorkRequest> *queue)
-        // Pop elements from the specified 'queue'.
-    {
-        while (1) {
-            // 'popFront()' will wait for a 'my_WorkRequest' until available.
+            ASSERT(1 == numException);
+            ASSERT(0 == X.numElements());
+            ASSERT(X.isEmpty());
 
-            my_WorkRequest item;
-            item.d_type = my_WorkRequest::e_WORK;
+            // Throw while popping a range containing unconstructed nodes.
 
-            ASSERT(0 == queue->popFront(&item));
+            sa.setAllocationLimit(1);
+            try {
+                mX.pushBackBatch(&num, values.data(), 3);
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
 
-            if (item.d_type == my_WorkRequest::e_STOP) { break; }
-            myDoWork(item.d_data);
-        }
-    }
-//..
-// Finally, we define a 'myProducer' function that serves multiple roles: it
-// creates the 'bdlcc::BoundedQueue', starts the consumer threads, and then
-// produces and enqueues work items.  When work requests are exhausted, this
-// function enqueues one 'e_STOP' item for each consumer queue.  This 'e_STOP'
-// item indicates to the consumer thread to terminate its thread-handling
-// function.
-//
-// Note that, although the producer cannot control which thread 'pop's a
-// particular work item, it can rely on the knowledge that each consumer thread
-// will read a single 'e_STOP' item and then terminate.
-//..
-    void myProducer(int numThreads)
-        // Create a queue, start the specified 'numThreads' consumer threads,
-        // produce and enqueue work.
-    {
-        enum {
-            k_MAX_QUEUE_LENGTH = 100,
-            k_NUM_WORK_ITEMS   = 1000
-        };
+            ASSERT(0 == mX.pushBackBatch(&num, values.data(), 3));
+            ASSERT(3 == num);
+            ASSERT(4 == X.numElements());
 
-        bdlcc::BoundedQueue<my_WorkRequest> queue(k_MAX_QUEUE_LENGTH);
+            sa.setAllocationLimit(1);
+            try {
+                mX.popFrontBatch(&num, values.data(), 3);
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
 
-        bslmt::ThreadGroup consumerThreads;
-        consumerThreads.addThreads(bdlf::BindUtil::bind(&myConsumer, &queue),
-                                   numThreads);
+            ASSERT(3 == numException);
+            ASSERT(1 == X.numElements());
 
-        for (int i = 0; i < k_NUM_WORK_ITEMS; ++i) {
-            my_WorkRequest item;
-            item.d_type = my_WorkRequest::e_WORK;
-            item.d_data = my_WorkData(); // some stuff to do
-            queue.pushBack(item);
-        }
+            mX.removeAll();
 
-        for (int i = 0; i < numThreads; ++i) {
-            my_WorkRequest item;
-            item.d_type = my_WorkRequest::e_STOP;
-            queue.pushBack(item);
+            ASSERT(X.isEmpty());
+
+            ASSERT(0 == mX.tryPushBackBatch(&num, values.data(), 3));
+            ASSERT(3 == num);
+            ASSERT(0 == mX.tryPushBackBatch(&num, values.data(), 3));
+            ASSERT(3 == num);
+            ASSERT(0 == mX.tryPushBackBatch(&num, values.data(), 3));
+            ASSERT(2 == num);
+            ASSERT(X.isFull());
         }
+#endif
 
-        consumerThreads.joinAll();
-    }
-//..
+        if (verbose) cout << "\nTesting concurrent batches." << endl;
+        {
+            static const struct {
+                int         d_line;
+                bsl::size_t d_capacity;
+                int         d_numProducers;
+                int         d_numConsumers;
+                int         d_batchSize;
+            } DATA[] = {
+                //LINE  CAP  PRODUCERS  CONSUMERS  BATCH
+                //----  ---  ---------  ---------  -----
+                { L_,     8,         1,         1,     3 },
+                { L_,    64,         2,         2,    16 },
+                { L_,   100,         4,         2,    64 },
+                { L_,   256,         2,         4,   512 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
-// ============================================================================
-//                               MAIN PROGRAM
-// ----------------------------------------------------------------------------
+            enum { k_NUM_ITEMS = 20000 };
 
-int main(int argc, char *argv[])
-{
-    int                 test = argc > 1 ? atoi(argv[1]) : 0;
-    bool             verbose = argc > 2;
-    bool         veryVerbose = argc > 3;
-    bool     veryVeryVerbose = argc > 4;
-    bool veryVeryVeryVerbose = argc > 5;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE      = DATA[ti].d_line;
+                const bsl::size_t CAP       = DATA[ti].d_capacity;
+                const int         PRODUCERS = DATA[ti].d_numProducers;
+                const int         CONSUMERS = DATA[ti].d_numConsumers;
+                const int         BATCH     = DATA[ti].d_batchSize;
+
+                BatchQueue queue(CAP);
+
+                bsl::vector<BatchThreadData>           data(PRODUCERS
+                                                                + CONSUMERS);
+                bsl::vector<bslmt::ThreadUtil::Handle> handles(PRODUCERS
+                                                                + CONSUMERS);
+
+                for (int i = 0; i < PRODUCERS + CONSUMERS; ++i) {
+                    data[i].d_queue_p      = &queue;
+                    data[i].d_id           = i;
+                    data[i].d_numItems     = k_NUM_ITEMS;
+                    data[i].d_batchSize    = BATCH;
+                    data[i].d_numProducers = PRODUCERS;
+
+                    bslmt::ThreadUtil::create(&handles[i],
+                                              i < PRODUCERS ? batchProducer
+                                                            : batchConsumer,
+                                              &data[i]);
+                }
 
-    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+                for (int i = 0; i < PRODUCERS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
 
-    // CONCERN: In no case does memory come from the global allocator.
+                ASSERT(0 == queue.waitUntilEmpty());
 
-    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
-    bslma::Default::setGlobalAllocator(&globalAllocator);
+                queue.disablePopFront();
 
-    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
-    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+                bsls::Types::Uint64 numPopped = 0;
+                bsls::Types::Uint64 sum       = 0;
 
-    switch (test) { case 0:  // Zero is always the leading case.
-      case 16: {
-        // --------------------------------------------------------------------
-        // USAGE EXAMPLE
-        //   Extracted from component header file.
-        //
-        // Concerns:
-        //: 1 The usage example provided in the component header file compiles,
-        //:   links, and runs as shown.
-        //
-        // Plan:
-        //: 1 Incorporate usage example from header into test driver, remove
-        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
-        //:   (C-1)
-        //
-        // Testing:
-        //   USAGE EXAMPLE
-        // --------------------------------------------------------------------
+                for (int i = PRODUCERS; i < PRODUCERS + CONSUMERS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
 
-        if (verbose) cout << endl
-                          << "USAGE EXAMPLE" << endl
-                          << "=============" << endl;
+                    ASSERTV(LINE, i, data[i].d_isOrdered);
 
-        bslmt::ThreadUtil::Handle watchdogHandle;
+                    numPopped += data[i].d_numPopped;
+                    sum       += data[i].d_sum;
+                }
 
-        s_continue = 1;
+                bsls::Types::Uint64 expSum = 0;
+                for (int i = 0; i < PRODUCERS; ++i) {
+                    expSum += (static_cast<bsls::Types::Uint64>(i) << 32)
+                                                                * k_NUM_ITEMS
+                            + k_NUM_ITEMS * (k_NUM_ITEMS - 1) / 2;
+                }
 
-        bslmt::ThreadUtil::create(&watchdogHandle,
-                                  watchdog,
-                                  const_cast<char *>("usage example"));
+                ASSERTV(LINE, numPopped,
+                        static_cast<bsls::Types::Uint64>(PRODUCERS)
+                                                * k_NUM_ITEMS == numPopped);
+                ASSERTV(LINE, sum, expSum, expSum == sum);
+            }
+        }
 
-        enum { k_NUM_THREADS = 4 };
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
 
-        myProducer(k_NUM_THREADS);
+            Obj mX(8);
 
-        s_continue = 0;
+            int         values[2] = { 1, 2 };
+            bsl::size_t num;
 
-        bslmt::ThreadUtil::join(watchdogHandle);
+            ASSERT_PASS(mX.tryPushBackBatch(&num, values, 2));
+            ASSERT_FAIL(mX.tryPushBackBatch(0, values, 2));
+            ASSERT_FAIL(mX.tryPushBackBatch(&num, 0, 2));
+
+            ASSERT_PASS(mX.tryPopFrontBatch(&num, values, 2));
+            ASSERT_FAIL(mX.tryPopFrontBatch(0, values, 2));
+            ASSERT_FAIL(mX.tryPopFrontBatch(&num, 0, 2));
+            ASSERT_FAIL(mX.tryPopFrontBatch(&num, values, 0));
+
+            ASSERT_FAIL(mX.popFrontBatch(&num, values, 0));
+            ASSERT_FAIL(mX.pushBackBatch(0, values, 2));
+        }
       } break;
       case 15: {
         // --------------------------------------------------------------------
@@ -1324,6 +2566,7 @@ int main(int argc, char *argv[])
 
         queue.disablePopFront();  // exit the popFront loops
         bslmt::ThreadUtil::join(popThread);
+
       } break;
       case 12: {
         // --------------------------------------------------------------------
@@ -3234,6 +4477,68 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCH VS. SINGLE-ITEM THROUGHPUT
+        //
+        // Concerns:
+        //: 1 The batch methods transfer more items per second than the
+        //:   single-item methods, and a power-of-two capacity is no slower
+        //:   than a capacity requiring a division.
+        //
+        // Plan:
+        //: 1 For single-producer/single-consumer and multi-producer/
+        //:   multi-consumer configurations, and for capacities of 1000 and
+        //:   1024, measure the items transferred per second using the
+        //:   single-item methods and the batch methods with batches of 64
+        //:   and 512 items.  The number of items pushed by each producer may
+        //:   be supplied as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCH VS. SINGLE-ITEM THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: BATCH VS. SINGLE-ITEM THROUGHPUT"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        const int NUM_ITEMS = argc > 2 ? atoi(argv[2]) : 2000000;
+
+        static const struct {
+            int d_numProducers;
+            int d_numConsumers;
+        } THREADS[] = { { 1, 1 }, { 4, 4 } };
+        const int NUM_THREADS = sizeof THREADS / sizeof *THREADS;
+
+        static const bsl::size_t CAPACITIES[] = { 1000, 1024 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        static const int BATCHES[] = { 1, 64, 512 };
+        const int NUM_BATCHES = sizeof BATCHES / sizeof *BATCHES;
+
+        for (int ti = 0; ti < NUM_THREADS;    ++ti) {
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+        for (int bi = 0; bi < NUM_BATCHES;    ++bi) {
+            const int PRODUCERS = THREADS[ti].d_numProducers;
+            const int CONSUMERS = THREADS[ti].d_numConsumers;
+
+            const double rate = runBatchThroughput(CAPACITIES[ci],
+                                                   PRODUCERS,
+                                                   CONSUMERS,
+                                                   NUM_ITEMS,
+                                                   BATCHES[bi]);
+
+            cout << PRODUCERS << "P/" << CONSUMERS << "C"
+                 << "  capacity " << CAPACITIES[ci]
+                 << "  batch " << BATCHES[bi]
+                 << ": " << static_cast<bsls::Types::Int64>(rate / 1000)
+                 << "K items/s" << endl;
+        }
+        }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
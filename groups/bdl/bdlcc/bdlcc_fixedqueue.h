@@ -43,6 +43,19 @@ BSLS_IDENT("$Id: $")
 // These limitations are a trade-off for significant gain in performance
 // compared to 'bdlcc::Queue'.
 //
+///Batch Operations
+///----------------
+// The methods 'pushBackBatch', 'tryPushBackBatch', 'popFrontBatch', and
+// 'tryPopFrontBatch' transfer several elements in one call.  Each cell of a
+// 'bdlcc::FixedQueue' is reserved individually (see
+// {bdlcc_fixedqueueindexmanager}), so these methods do not reduce the number
+// of atomic operations per element; they do, however, check for and wake
+// blocked threads once per batch rather than once per element.  Clients
+// transferring elements in bursts should prefer the batch methods of
+// {bdlcc_boundedqueue}, which claim a contiguous range of elements with a
+// single atomic operation.  Note that a 'bdlcc::FixedQueue' whose capacity is
+// a power of two maps its indices onto cells without an integer division.
+//
 ///Comparison To BoundedQueue
 ///--------------------------
 // Both 'bdlcc::FixedQueue' and 'bdlcc::BoundedQueue' provide thread-aware
@@ -339,6 +352,53 @@ class FixedQueue {
         // removed element.  Return 0 on success, and a non-zero value if queue
         // was empty.  On failure, 'value' is not changed.
 
+    int pushBackBatch(bsl::size_t *numPushed,
+                      const TYPE  *values,
+                      bsl::size_t  numValues);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue,
+        // blocking - if necessary - until space is available for each, and
+        // load the number of elements appended into the specified
+        // 'numPushed'.  Return 0 on success, and a nonzero value if the queue
+        // is disabled, in which case the first '*numPushed' values have been
+        // appended.  The behavior is undefined unless 'values' refers to an
+        // array of at least 'numValues' elements.  See {Batch Operations}.
+
+    int tryPushBackBatch(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues);
+        // Attempt to append, without blocking, the specified 'numValues'
+        // elements of the array starting at the specified 'values', in order,
+        // to the back of this queue, stopping when the queue is full, and load
+        // the number of elements appended into the specified 'numPushed'.
+        // Return 0 if at least one element was appended or '0 == numValues',
+        // and a non-zero value if the queue is full or disabled.  The behavior
+        // is undefined unless 'values' refers to an array of at least
+        // 'numValues' elements.  See {Batch Operations}.
+
+    void popFrontBatch(bsl::size_t *numPopped,
+                       TYPE        *values,
+                       bsl::size_t  maxValues);
+        // Remove up to the specified 'maxValues' elements from the front of
+        // this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty, block until it is not
+        // empty.  The behavior is undefined unless '0 < maxValues' and
+        // 'values' refers to an array of at least 'maxValues' elements.  See
+        // {Batch Operations}.
+
+    int tryPopFrontBatch(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxValues);
+        // Attempt to remove up to the specified 'maxValues' elements from the
+        // front of this queue without blocking, load the removed elements, in
+        // order, into the array starting at the specified 'values', and load
+        // the number of elements removed into the specified 'numPopped'.
+        // Return 0 on success, and a non-zero value if the queue was empty.
+        // The behavior is undefined unless '0 < maxValues' and 'values' refers
+        // to an array of at least 'maxValues' elements.  See
+        // {Batch Operations}.
+
     void removeAll();
         // Remove all items from this queue.  Note that this operation is not
         // atomic; if other threads are concurrently pushing items into the
@@ -753,6 +813,153 @@ TYPE FixedQueue<TYPE>::popFront()
 #endif
 }
 
+template <class TYPE>
+int FixedQueue<TYPE>::pushBackBatch(bsl::size_t *numPushed,
+                                    const TYPE  *values,
+                                    bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    *numPushed = 0;
+
+    while (*numPushed < numValues) {
+        bsl::size_t numAppended;
+
+        int retval = tryPushBackBatch(&numAppended,
+                                      values + *numPushed,
+                                      numValues - *numPushed);
+
+        *numPushed += numAppended;
+
+        if (0 == retval) {
+            continue;
+        }
+
+        if (retval < 0) {
+            // The queue is disabled.
+
+            return retval;                                            // RETURN
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'pushBack')
+
+        if (isFull() && isEnabled()) {
+            d_pushControlSema.wait();
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::tryPushBackBatch(bsl::size_t *numPushed,
+                                       const TYPE  *values,
+                                       bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    *numPushed = 0;
+
+    int retval = 0;
+
+    while (*numPushed < numValues) {
+        unsigned int generation;
+        unsigned int index;
+
+        // SYNCHRONIZATION POINT 1 (see 'tryPushBack')
+
+        retval = d_impl.reservePushIndex(&generation, &index);
+
+        if (0 != retval) {
+            break;
+        }
+
+        FixedQueue_PushProctor<TYPE> guard(this, generation, index);
+        bslalg::ScalarPrimitives::copyConstruct(&d_elements[index],
+                                                values[*numPushed],
+                                                d_allocator_p);
+        guard.release();
+        d_impl.commitPushIndex(generation, index);
+
+        ++*numPushed;
+    }
+
+    // The read of 'd_numWaitingPoppers' follows the last reservation, so a
+    // popper that observed this queue as empty before any element of this
+    // batch was committed is seen here.
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingPoppers)) {
+        int numWakeUps = bsl::min(static_cast<int>(*numPushed),
+                                  static_cast<int>(d_numWaitingPoppers));
+        while (numWakeUps--) {
+            d_popControlSema.post();
+        }
+    }
+
+    return 0 < *numPushed || 0 == numValues ? 0 : retval;
+}
+
+template <class TYPE>
+void FixedQueue<TYPE>::popFrontBatch(bsl::size_t *numPopped,
+                                     TYPE        *values,
+                                     bsl::size_t  maxValues)
+{
+    while (0 != tryPopFrontBatch(numPopped, values, maxValues)) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 2-Prime (see 'popFront')
+
+        if (isEmpty()) {
+            d_popControlSema.wait();
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+    }
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::tryPopFrontBatch(bsl::size_t *numPopped,
+                                       TYPE        *values,
+                                       bsl::size_t  maxValues)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxValues);
+
+    *numPopped = 0;
+
+    int retval = 0;
+
+    while (*numPopped < maxValues) {
+        unsigned int generation;
+        unsigned int index;
+
+        // SYNCHRONIZATION POINT 2 (see 'tryPopFront')
+
+        retval = d_impl.reservePopIndex(&generation, &index);
+
+        if (0 != retval) {
+            break;
+        }
+
+        FixedQueue_PopGuard<TYPE> guard(this, generation, index);
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[*numPopped] = bslmf::MovableRefUtil::move(d_elements[index]);
+#else
+        values[*numPopped] = d_elements[index];
+#endif
+        ++*numPopped;
+    }
+
+    return 0 < *numPopped ? 0 : retval;
+}
+
 template <class TYPE>
 void FixedQueue<TYPE>::removeAll()
 {
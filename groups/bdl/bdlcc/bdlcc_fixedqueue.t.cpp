@@ -53,6 +53,7 @@
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>            // 'atoi'
 
@@ -448,6 +449,52 @@ void* popFrontTestThread(void *ptr)
 
 }
 
+void batchPusher(bdlcc::FixedQueue<int> *queue, int numItems, int batchSize)
+    // Push the values '[0 .. numItems)' onto the specified 'queue' in batches
+    // of the specified 'batchSize' values.  The behavior is undefined unless
+    // 'numItems' is a multiple of 'batchSize'.
+{
+    bsl::vector<int> values(batchSize);
+    for (int i = 0; i < numItems; i += batchSize) {
+        for (int j = 0; j < batchSize; ++j) {
+            values[j] = i + j;
+        }
+        bsl::size_t numPushed;
+        ASSERTT(0 == queue->pushBackBatch(&numPushed,
+                                          values.data(),
+                                          batchSize));
+        ASSERTT(static_cast<bsl::size_t>(batchSize) == numPushed);
+    }
+}
+
+void batchPopper(bdlcc::FixedQueue<int> *queue,
+                 int                     batchSize,
+                 bsls::AtomicInt        *numPopped,
+                 bsls::AtomicInt64      *sum)
+    // Pop values from the specified 'queue' in batches of up to the specified
+    // 'batchSize' values, accumulating their number in the specified
+    // 'numPopped' and their sum in the specified 'sum', until a value of -1
+    // is popped.  Any further -1 values popped in the same batch are pushed
+    // back for other poppers.
+{
+    bsl::vector<int> values(batchSize);
+    while (true) {
+        bsl::size_t n;
+        queue->popFrontBatch(&n, values.data(), batchSize);
+        for (bsl::size_t i = 0; i < n; ++i) {
+            if (-1 == values[i]) {
+                for (++i; i < n; ++i) {
+                    ASSERTT(-1 == values[i]);
+                    queue->pushBack(-1);
+                }
+                return;                                               // RETURN
+            }
+            *sum += values[i];
+            ++*numPopped;
+        }
+    }
+}
+
 void case9pusher(bdlcc::FixedQueue<int> *queue, bsls::AtomicBool *done)
 {
     while (!*done) {
@@ -1322,7 +1369,7 @@ int main(int argc, char *argv[])
                     bslmt::Configuration::recommendedDefaultThreadStackSize());
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // ---------------------------------------------------------
         // Usage example test
         //
@@ -1338,6 +1385,165 @@ int main(int argc, char *argv[])
         break;
       }
 
+      case 19: {
+        // ---------------------------------------------------------
+        // Batch operations test
+        //
+        // Verify that 'pushBackBatch', 'tryPushBackBatch',
+        // 'popFrontBatch', and 'tryPopFrontBatch' transfer elements in
+        // FIFO order (including across wrap-around, for capacities that
+        // are and are not powers of two), report the number of elements
+        // transferred, honor the disabled state, and transfer every
+        // element exactly once between concurrent producers and
+        // consumers.
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Batch operations test" << endl
+                          << "=====================" << endl;
+
+        {
+            static const int CAPACITIES[] = { 1, 3, 7, 8, 16, 17 };
+            const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+            static const int BATCHES[] = { 1, 2, 5, 40 };
+            const int NUM_BATCHES = sizeof BATCHES / sizeof *BATCHES;
+
+            for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            for (int bi = 0; bi < NUM_BATCHES;    ++bi) {
+                const int         CAP    = CAPACITIES[ci];
+                const int         BATCH  = BATCHES[bi];
+                const bsl::size_t UBATCH = BATCH;
+
+                bdlcc::FixedQueue<int> mX(CAP);
+
+                bsl::vector<int> values(BATCH);
+                bsl::vector<int> results(BATCH);
+
+                int nextPush = 0;
+                int nextPop  = 0;
+
+                for (int iteration = 0; iteration < 20; ++iteration) {
+                    while (!mX.isFull()) {
+                        for (int i = 0; i < BATCH; ++i) {
+                            values[i] = nextPush + i;
+                        }
+
+                        bsl::size_t numPushed = 99;
+
+                        int rc = mX.tryPushBackBatch(&numPushed,
+                                                     values.data(),
+                                                     BATCH);
+                        LOOP3_ASSERT(CAP, BATCH, rc, 0 == rc);
+                        LOOP3_ASSERT(CAP, BATCH, numPushed,
+                                     0 < numPushed && numPushed <= UBATCH);
+
+                        nextPush += static_cast<int>(numPushed);
+                    }
+
+                    LOOP2_ASSERT(CAP, BATCH, CAP == mX.numElements());
+
+                    bsl::size_t num = 99;
+
+                    ASSERT(0 != mX.tryPushBackBatch(&num,
+                                                    values.data(),
+                                                    BATCH));
+                    ASSERT(0 == num);
+
+                    while (!mX.isEmpty()) {
+                        bsl::size_t numPopped = 99;
+
+                        if (iteration % 2) {
+                            mX.popFrontBatch(&numPopped,
+                                             results.data(),
+                                             BATCH);
+                        }
+                        else {
+                            ASSERT(0 == mX.tryPopFrontBatch(&numPopped,
+                                                            results.data(),
+                                                            BATCH));
+                        }
+                        LOOP3_ASSERT(CAP, BATCH, numPopped,
+                                     0 < numPopped && numPopped <= UBATCH);
+
+                        for (bsl::size_t i = 0; i < numPopped; ++i) {
+                            LOOP4_ASSERT(CAP, BATCH, nextPop, results[i],
+                                         nextPop == results[i]);
+                            ++nextPop;
+                        }
+                    }
+
+                    LOOP2_ASSERT(CAP, BATCH, nextPush == nextPop);
+
+                    num = 99;
+
+                    ASSERT(0 != mX.tryPopFrontBatch(&num,
+                                                    results.data(),
+                                                    BATCH));
+                    ASSERT(0 == num);
+                }
+
+                // Disabled queues reject batch pushes.
+
+                mX.disable();
+
+                bsl::size_t num = 99;
+
+                ASSERT(0 > mX.pushBackBatch(&num, values.data(), BATCH));
+                ASSERT(0 == num);
+                ASSERT(0 != mX.tryPushBackBatch(&num, values.data(), BATCH));
+                ASSERT(0 == num);
+
+                mX.enable();
+            }
+            }
+        }
+
+        {
+            enum {
+                k_NUM_PRODUCERS = 3,
+                k_NUM_CONSUMERS = 3,
+                k_NUM_ITEMS     = 20000,
+                k_BATCH         = 50
+            };
+
+            bdlcc::FixedQueue<int> queue(64);
+
+            bsls::AtomicInt    numPopped(0);
+            bsls::AtomicInt64  sum(0);
+            bslmt::ThreadGroup producers;
+            bslmt::ThreadGroup consumers;
+
+            consumers.addThreads(bdlf::BindUtil::bind(&batchPopper,
+                                                      &queue,
+                                                      static_cast<int>(
+                                                                     k_BATCH),
+                                                      &numPopped,
+                                                      &sum),
+                                 k_NUM_CONSUMERS);
+
+            producers.addThreads(bdlf::BindUtil::bind(&batchPusher,
+                                                      &queue,
+                                                      static_cast<int>(
+                                                                 k_NUM_ITEMS),
+                                                      static_cast<int>(
+                                                                     k_BATCH)),
+                                 k_NUM_PRODUCERS);
+
+            producers.joinAll();
+
+            for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                queue.pushBack(-1);
+            }
+
+            consumers.joinAll();
+
+            ASSERTV(numPopped, k_NUM_PRODUCERS * k_NUM_ITEMS == numPopped);
+            ASSERTV(sum.load(), static_cast<bsls::Types::Int64>(
+                                           k_NUM_PRODUCERS) * k_NUM_ITEMS *
+                                                (k_NUM_ITEMS - 1) / 2 == sum);
+        }
+      } break;
       case 18: {
           // ---------------------------------------------------------
           // Moving tests
@@ -283,6 +283,22 @@ static unsigned int discardDisabledFlag(unsigned int encodedPushIndex)
     return (encodedPushIndex & ~k_DISABLED_STATE_MASK);
 }
 
+static int capacityShift(bsl::size_t capacity)
+    // Return the base-2 logarithm of the specified 'capacity' if 'capacity'
+    // is a power of two, and -1 otherwise.
+{
+    if (0 == capacity || 0 != (capacity & (capacity - 1))) {
+        return -1;                                                    // RETURN
+    }
+
+    int shift = 0;
+    while (capacity > 1) {
+        capacity >>= 1;
+        ++shift;
+    }
+    return shift;
+}
+
 }  // close unnamed namespace
 
 namespace bdlcc {
@@ -329,6 +345,7 @@ FixedQueueIndexManager::FixedQueueIndexManager(
 , d_popIndex(0)
 , d_popIndexPad()
 , d_capacity(capacity)
+, d_capacityShift(capacityShift(capacity))
 , d_maxGeneration   (numRepresentableGenerations(capacity) - 1)
 , d_maxCombinedIndex(numRepresentableGenerations(capacity)
                      * static_cast<unsigned int>(capacity) - 1)
@@ -383,8 +400,7 @@ int FixedQueueIndexManager::reservePushIndex(unsigned int *generation,
 
         combinedIndex  = discardDisabledFlag(loadedPushIndex);
 
-        currGeneration = static_cast<unsigned int>(combinedIndex / d_capacity);
-        currIndex      = static_cast<unsigned int>(combinedIndex % d_capacity);
+        splitCombinedIndex(&currGeneration, &currIndex, combinedIndex);
 
         const int compare = encodeElementState(currGeneration, e_EMPTY);
         const int swap    = encodeElementState(currGeneration, e_WRITING);
@@ -510,10 +526,7 @@ int FixedQueueIndexManager::reservePopIndex(unsigned int *generation,
     unsigned int currIndex, currGeneration;
 
     for (;;) {
-        currGeneration = static_cast<unsigned int>(loadedPopIndex
-                                                 / d_capacity);
-        currIndex      = static_cast<unsigned int>(loadedPopIndex
-                                                 % d_capacity);
+        splitCombinedIndex(&currGeneration, &currIndex, loadedPopIndex);
 
         // Attempt to swap this cell's state from e_FULL to 'e_READING'
 
@@ -242,6 +242,11 @@ class FixedQueueIndexManager {
                            // maximum number of elements that can be held in
                            // the circular buffer
 
+    const int           d_capacityShift;
+                           // base-2 logarithm of 'd_capacity' if 'd_capacity'
+                           // is a power of two, and -1 otherwise (used to
+                           // decompose a combined index without a division)
+
     const unsigned int  d_maxGeneration;
                            // maximum generation count for this object (see
                            // implementation note in the .cpp file for more
@@ -281,6 +286,14 @@ class FixedQueueIndexManager {
     unsigned int nextGeneration(unsigned int generation) const;
         // Return the generation subsequent to the specified 'generation'.
 
+    void splitCombinedIndex(unsigned int *generation,
+                            unsigned int *index,
+                            unsigned int  combinedIndex) const;
+        // Load into the specified 'generation' and 'index' the generation
+        // count and element index of the specified 'combinedIndex'.  If
+        // 'd_capacity' is a power of two, the decomposition is performed
+        // using a shift and a mask rather than a division.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FixedQueueIndexManager,
@@ -501,6 +514,22 @@ unsigned int FixedQueueIndexManager::nextGeneration(
     return generation + 1;
 }
 
+inline
+void FixedQueueIndexManager::splitCombinedIndex(
+                                           unsigned int *generation,
+                                           unsigned int *index,
+                                           unsigned int  combinedIndex) const
+{
+    if (0 <= d_capacityShift) {
+        *generation = combinedIndex >> d_capacityShift;
+        *index      = combinedIndex & ((1u << d_capacityShift) - 1);
+    }
+    else {
+        *generation = static_cast<unsigned int>(combinedIndex / d_capacity);
+        *index      = static_cast<unsigned int>(combinedIndex % d_capacity);
+    }
+}
+
 // ACCESSORS
 inline
 bsl::size_t FixedQueueIndexManager::capacity() const
@@ -423,6 +423,7 @@ struct FixedQueueIndexManagerDataMembers {
     bsls::AtomicInt     d_popIndex;
     const char          d_popIndexPad[e_PADDING];
     const bsl::size_t   d_capacity;
+    const int           d_capacityShift;
     const unsigned int  d_maxGeneration;
     const unsigned int  d_maxCombinedIndex;
     bsls::AtomicInt    *d_states;
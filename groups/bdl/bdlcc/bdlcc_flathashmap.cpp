@@ -0,0 +1,63 @@
+// bdlcc_flathashmap.cpp                                              -*-C++-*-
+#include <bdlcc_flathashmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_flathashmap_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The number of stripes must be a power of 2.
+//
+// 'bdlc::FlatHashTable' uses the seven lowest-order bits of the hash value of
+// a key as its hashlet and the highest-order bits to select the first group
+// probed.  The stripe is selected by the bits just above the hashlet, so that
+// the keys of a stripe do not share hashlet bits (which would increase the
+// number of false matches in a group) or probe-start bits (which would cluster
+// them in the stripe's table).  The two ranges of bits overlap only for tables
+// larger than '2 ** (bits in size_t - 7 - log2(numStripes))' groups.
+//
+// The hash value of a key is computed twice per operation, once to select the
+// stripe and once by the stripe's table.  'bdlc::FlatHashMap' provides no
+// interface accepting a precomputed hash value.
+//
+// Readers take the read lock of their stripe.  The read epoch used by the
+// read-optimized mode of 'bdlcc::StripedUnorderedContainerImpl'
+// ('StripedUnorderedContainerImpl_ReadEpoch') is not reused for lock-free
+// reads here, because it only defers the *freeing* of memory: that mode is
+// safe because a writer never modifies a node that a reader may be visiting,
+// but instead publishes a new node and retires the old one.  The elements of
+// a flat table are stored in its slots and are modified in place: 'setValue'
+// and 'update' assign to the value in its slot, 'erase' destroys an element
+// whose slot (and control byte) a later 'insert' may reuse at once, and
+// 'insert' constructs an element in a slot that a reader may be probing.  A
+// reader racing with any of these could observe a partially written 'KEY' or
+// 'VALUE', whether or not the table's memory is retired through an epoch.
+// Making reads lock-free would therefore require either copying a stripe's
+// table on every write, or storing pointers to immutable nodes in the slots,
+// which is the node-based design of 'bdlcc::StripedUnorderedMap'.
+//
+// Optimistic reads (a per-stripe sequence number, validated after the read)
+// are not used either: a visitor or a copy of 'VALUE' made while a writer is
+// modifying the value is undefined behavior unless 'VALUE' is trivially
+// copyable, and the visitors of 'visitReadOnly' may have side effects that
+// cannot be retried.  Locking individual control-byte groups is not used
+// because a probe sequence (and so a lookup) may span several groups, and
+// growing a stripe moves all of its elements, which would require every group
+// lock of the stripe; per-stripe locks, with each stripe growing
+// independently, bound the work done under any one lock in the same way.
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
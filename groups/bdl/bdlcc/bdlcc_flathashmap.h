@@ -0,0 +1,977 @@
+// bdlcc_flathashmap.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_FLATHASHMAP
+#define INCLUDED_BDLCC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fully thread-safe open-addressed (flat) hash map.
+//
+//@CLASSES:
+//  bdlcc::FlatHashMap: concurrent open-addressed hash map
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component provides a single concurrent (fully thread-safe)
+// associative container, 'bdlcc::FlatHashMap', that maps keys (of template
+// parameter type 'KEY') to values (of template parameter type 'VALUE') and
+// stores its elements in open-addressed hash tables (see 'bdlc_flathashmap').
+//
+// The map is partitioned into a (user defined, fixed) number of "stripes".
+// Each stripe is an independent 'bdlc::FlatHashMap' -- an array of entries
+// and a parallel array of one-byte control values (hashlets), with no
+// allocation per element -- guarded by its own reader-writer lock.  The hash
+// value of a key selects its stripe, so operations on keys in different
+// stripes proceed without contention, and lookups on keys in the same stripe
+// proceed concurrently with each other.
+//
+// Like 'bdlcc::StripedUnorderedMap', 'bdlcc::FlatHashMap' does not provide
+// iterators.  Values are returned by copy ('getValue'), and elements are
+// modified in place through user supplied functors ('setComputedValue',
+// 'update', and 'visit').
+//
+// The 'bdlcc::FlatHashMap' class is an *irregular* value-semantic type, even
+// if 'KEY' and 'VALUE' are VSTs.  This class does not implement equality
+// comparison, assignment operator, or copy constructor.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::FlatHashMap' class template is fully thread-safe (see
+// {'bsldoc_glossary'|Fully Thread-Safe}), assuming that the allocator is fully
+// thread-safe.  Each method is executed by the calling thread.
+//
+///Resizing
+///--------
+// Each stripe grows independently: an insertion that takes a stripe above its
+// maximum load factor (7/8) rehashes that stripe, and only that stripe, into
+// a table of twice the capacity.  The write lock of the growing stripe is held
+// for the duration of the rehash, while operations on all other stripes
+// proceed concurrently.  The work of growing the map is thereby spread over
+// many smaller rehashes, each blocking a '1 / numStripes()' fraction of the
+// key space.  'reserve' pre-sizes the stripes one at a time.
+//
+///Exception Safety
+///----------------
+// 'bdlcc::FlatHashMap' is exception neutral, and its manipulators provide the
+// basic exception-safety guarantee, as do those of 'bdlc::FlatHashMap': if a
+// stripe fails to grow, the elements of that stripe may be lost.  A stripe's
+// lock is always released when an exception propagates.
+//
+///Comparison with 'bdlcc::StripedUnorderedMap'
+///--------------------------------------------
+// 'bdlcc::StripedUnorderedMap' allocates a node per element and chains nodes
+// in buckets; a rehash of the whole map is performed while all stripes are
+// locked.  'bdlcc::FlatHashMap' stores elements contiguously, so a lookup
+// usually touches one group of control bytes and one entry, and an element
+// costs 'sizeof(bsl::pair<KEY, VALUE>)' plus one control byte (divided by the
+// load factor), rather than a node allocation.  The benefits are largest for
+// small, trivially copyable 'KEY' and 'VALUE' types.  On the other hand,
+// 'bdlcc::FlatHashMap' does not support duplicate keys, rehash control, or
+// lock-free reads, and the values of elements move when a stripe grows.
+// Clients whose workload is dominated by reads may prefer the read-optimized
+// mode of 'bdlcc::StripedUnorderedMap', in which 'getValue' and
+// 'visitReadOnly' take no lock.  That mode relies on writers never modifying
+// an element in place, which does not hold for an open-addressed table whose
+// elements are stored in its slots.
+//
+///Requirements on 'KEY', 'VALUE', 'HASH', and 'EQUAL'
+///---------------------------------------------------
+// The requirements are those of 'bdlc::FlatHashMap' (see
+// {'bdlc_flathashmap'|Requirements on 'KEY', 'HASH', and 'EQUAL'}).  In
+// addition, 'VALUE' must be copy-assignable, and must be default-constructible
+// for 'setComputedValue' to be used.
+//
+// The stripe of a key is selected by the bits of its hash value just above the
+// seven bits used as the hashlet by 'bdlc::FlatHashTable'.  The default 'HASH'
+// ('bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >') distributes those bits
+// well even when 'bsl::hash<KEY>' is the identity.
+//
+///Runtime Complexity
+///------------------
+//..
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | insert, setValue, setComputedValue, update         | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | erase, getValue                                    | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | visit(key, visitor)                                | Average: O[1]      |
+//  | visitReadOnly(key, visitor)                        | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | insertBulk, k elements                             | Average: O[k]      |
+//  |                                                    | Worst:   O[n*k]    |
+//  +----------------------------------------------------+--------------------+
+//  | eraseBulk, k elements                              | Average: O[k]      |
+//  |                                                    | Worst:   O[n*k]    |
+//  +----------------------------------------------------+--------------------+
+//  | reserve, visit(visitor), visitReadOnly(visitor)    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Number of Stripes
+///-----------------
+// The number of stripes is rounded up to a power of two.  As with
+// 'bdlcc::StripedUnorderedMap', throughput improves with the number of stripes
+// until it is a few times the number of threads *concurrently* using the map.
+// Since every stripe is a separate table, a larger number of stripes also
+// makes each resize smaller.  The per-stripe overhead is a reader-writer
+// mutex, an empty table, and padding to a cache line.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Tallying Events from Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads process a stream of trades and we want to keep
+// a running count of trades per instrument, where instruments are identified
+// by an 'int'.  Both keys and values are small and trivially copyable, which
+// is the ideal use of 'bdlcc::FlatHashMap'.
+//
+// First, we define a functor that increments a count:
+//..
+//  bool incrementCount(int *count, const int& /* instrumentId */)
+//      // Increment the specified 'count' and return 'true'.
+//  {
+//      ++*count;
+//      return true;
+//  }
+//..
+// Then, we create the map, shared by all threads:
+//..
+//  bdlcc::FlatHashMap<int, int> tradeCounts;
+//..
+// Next, each thread records a trade by calling 'setComputedValue', which
+// inserts a zero count (a value-initialized 'int') for an instrument seen for
+// the first time and then invokes the functor under the stripe's write lock:
+//..
+//  tradeCounts.setComputedValue(17, &incrementCount);
+//  tradeCounts.setComputedValue(42, &incrementCount);
+//  tradeCounts.setComputedValue(17, &incrementCount);
+//..
+// Now, any thread can read a count:
+//..
+//  int count;
+//  bsl::size_t rc = tradeCounts.getValue(&count, 17);
+//  assert(1 == rc);
+//  assert(2 == count);
+//
+//  rc = tradeCounts.getValue(&count, 99);
+//  assert(0 == rc);
+//..
+// Finally, at the end of the day, we reset every count to zero with 'visit':
+//..
+//  struct Reset {
+//      static bool reset(int *count, const int&)
+//      {
+//          *count = 0;
+//          return true;
+//      }
+//  };
+//
+//  int numVisited = tradeCounts.visit(&Reset::reset);
+//  assert(2 == numVisited);
+//
+//  tradeCounts.getValue(&count, 42);
+//  assert(0 == count);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashmap.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_autoarraydestructor.h>
+
+#include <bslh_fibonaccibadhashwrapper.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_functional.h>
+#include <bsl_new.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                          // ========================
+                          // class FlatHashMap_Stripe
+                          // ========================
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class FlatHashMap_Stripe {
+    // This component-private class holds one stripe of a 'bdlcc::FlatHashMap':
+    // an open-addressed hash table and the reader-writer mutex guarding it.
+    // Objects of this class are padded so that the mutexes of adjacent stripes
+    // do not share a cache line.
+
+  public:
+    // PUBLIC TYPES
+    typedef bdlc::FlatHashMap<KEY, VALUE, HASH, EQUAL> Map;
+
+    // PUBLIC DATA
+    bslmt::ReaderWriterMutex d_lock;  // guards 'd_map'
+
+    Map                      d_map;   // elements of this stripe
+
+    char                     d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                      // padding against false sharing
+
+  private:
+    // NOT IMPLEMENTED
+    FlatHashMap_Stripe(const FlatHashMap_Stripe&);             // = delete
+    FlatHashMap_Stripe& operator=(const FlatHashMap_Stripe&);  // = delete
+
+  public:
+    // CREATORS
+    FlatHashMap_Stripe(bsl::size_t       capacity,
+                       const HASH&       hash,
+                       const EQUAL&      equal,
+                       bslma::Allocator *basicAllocator);
+        // Create an empty stripe having at least the specified 'capacity',
+        // and using the specified 'hash' and 'equal' functors, and the
+        // specified 'basicAllocator' to supply memory.
+};
+
+                             // =================
+                             // class FlatHashMap
+                             // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template defines a fully thread-safe container that provides
+    // a mapping from keys (of template parameter type 'KEY') to their
+    // associated mapped values (of template parameter type 'VALUE').
+    //
+    // The elements are partitioned among 'numStripes' open-addressed hash
+    // tables, a value specified on construction, each guarded by its own
+    // reader-writer lock and resized independently of the others.
+    //
+    // The interface follows that of 'bdlcc::StripedUnorderedMap'.
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashMap_Stripe<KEY, VALUE, HASH, EQUAL>     Stripe;
+    typedef typename Stripe::Map                            Map;
+    typedef bslmt::ReadLockGuard<bslmt::ReaderWriterMutex>  ReadGuard;
+    typedef bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> WriteGuard;
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_HASHLET_BITS = 7  // hash bits used by the stripes as hashlets
+    };
+
+    // DATA
+    Stripe           *d_stripes_p;     // array of 'd_numStripes' stripes
+
+    bsl::size_t       d_numStripes;    // number of stripes (a power of 2)
+
+    HASH              d_hasher;        // selects the stripe of a key
+
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    FlatHashMap(const FlatHashMap&);                                // = delete
+    FlatHashMap& operator=(const FlatHashMap&);                     // = delete
+
+    // PRIVATE MANIPULATORS
+    void createStripes(bsl::size_t capacity);
+        // Allocate and construct the 'd_numStripes' stripes of this hash map,
+        // each having a capacity of at least '1 / d_numStripes' of the
+        // specified 'capacity', and load their address into 'd_stripes_p'.
+
+    // PRIVATE ACCESSORS
+    Stripe& stripe(const KEY& key) const;
+        // Return a reference to the stripe of the specified 'key'.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_STRIPES = 16  // Default number of stripes
+    };
+
+    // PUBLIC TYPES
+    typedef bsl::pair<KEY, VALUE> KVType;
+        // Value type of a bulk insert entry.
+
+    typedef bsl::function<bool (VALUE *, const KEY&)> VisitorFunction;
+        // An alias to a function meeting the following contract:
+        //..
+        //  bool visitorFunction(VALUE *value, const KEY& key);
+        //      // Visit the specified 'value' attribute associated with the
+        //      // specified 'key'.  Return 'true' if this function may be
+        //      // called on additional elements, and 'false' otherwise (i.e.,
+        //      // if no other elements should be visited).  Note that this
+        //      // functor can change the value associated with 'key'.
+        //..
+
+    typedef bsl::function<bool (const VALUE&, const KEY&)>
+                                                       ReadOnlyVisitorFunction;
+        // An alias to a function meeting the following contract:
+        //..
+        //  bool visitorFunction(const VALUE& value, const KEY& key);
+        //      // Visit the specified 'value' attribute associated with the
+        //      // specified 'key'.  Return 'true' if this function may be
+        //      // called on additional elements, and 'false' otherwise (i.e.,
+        //      // if no other elements should be visited).  Note that this
+        //      // functor can *not* change the value associated with 'key'
+        //      // and 'value'.
+        //..
+
+    // CREATORS
+    explicit FlatHashMap(
+                      bsl::size_t       capacity       = 0,
+                      bsl::size_t       numStripes     = k_DEFAULT_NUM_STRIPES,
+                      bslma::Allocator *basicAllocator = 0);
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+        // Create an empty 'FlatHashMap' object, a fully thread-safe hash map
+        // whose elements are partitioned into "stripes" (open-addressed hash
+        // tables each guarded by a reader-writer mutex).  Optionally specify
+        // 'capacity', the number of entries initially allocated across all
+        // stripes, and 'numStripes', which is rounded up to the nearest power
+        // of 2 and is fixed for the lifetime of this map.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < numStripes'.  Note that a stripe having no
+        // capacity allocates no memory until an element is inserted into it.
+
+    ~FlatHashMap();
+        // Destroy this hash map.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all elements from this hash map.  The stripes are cleared one
+        // at a time, so elements inserted concurrently with this call may
+        // remain after it returns.  Note that the capacity of each stripe is
+        // retained.
+
+    bsl::size_t erase(const KEY& key);
+        // Erase from this hash map the element having the specified 'key'.
+        // Return 1 on success and 0 if 'key' does not exist.
+
+    template <class RANDOM_ITER>
+    bsl::size_t eraseBulk(RANDOM_ITER first, RANDOM_ITER last);
+        // Erase from this hash map the elements having the keys in the range
+        // specified by '[first, last)'.  Return the number of elements erased.
+        // The behavior is undefined unless 'first <= last'.
+
+    bsl::size_t insert(const KEY& key, const VALUE& value);
+        // Insert into this hash map an element having the specified 'key' and
+        // 'value'.  If 'key' already exists in this hash map, the value
+        // attribute of that element is set to 'value'.  Return 1 if an element
+        // is inserted, and 0 if an existing element is updated.  Note that the
+        // return value equals the number of elements inserted.
+
+    template <class RANDOM_ITER>
+    bsl::size_t insertBulk(RANDOM_ITER first, RANDOM_ITER last);
+        // Insert into this hash map elements having the key-value pairs in the
+        // range specified by '[first, last)'.  If a key already exists in this
+        // hash map, the value attribute of that element is set to the value of
+        // the pair.  Return the number of elements inserted.  The behavior is
+        // undefined unless 'first <= last'.  Note that the elements of the
+        // range must be convertible to 'KVType'.
+
+    void reserve(bsl::size_t numElements);
+        // Grow the stripes of this hash map so that they can, in total, hold
+        // at least the specified 'numElements' elements, distributed evenly,
+        // without further resizing.  The stripes are grown one at a time, and
+        // each stripe is locked only while it is grown.  A stripe that can
+        // already hold its share of 'numElements' is not shrunk.
+
+    int setComputedValue(const KEY&             key,
+                         const VisitorFunction& visitor);
+        // Invoke the specified 'visitor' on the value associated with the
+        // specified 'key'.  The 'visitor' will be passed the address of the
+        // value, and 'key'.  If 'key' is not in the map, 'value' will be
+        // default constructed.  That is, 'visitor' must be invocable with the
+        // 'VisitorFunction' signature:
+        //..
+        //  bool visitor(VALUE *value, const Key& key);
+        //..
+        // If no element in the map has 'key', insert '(key, VALUE())' and
+        // invoke 'visitor' with 'value' pointing to the default constructed
+        // value.  Return 1 if 'key' was found and 'visitor' returned 'true', 0
+        // if 'key' was not found, and -1 if 'key' was found and 'visitor'
+        // returned 'false'.  'visitor', when invoked, has exclusive access
+        // (i.e., write access) to the element.  The behavior is undefined if
+        // hash map manipulators and 'getValue' methods are invoked from within
+        // 'visitor', as it may lead to a deadlock.  Note that a return value
+        // of '0' implies that an element was inserted.
+
+    bsl::size_t setValue(const KEY& key, const VALUE& value);
+        // Set the value attribute of the element in this hash map having the
+        // specified 'key' to the specified 'value'.  If no such such element
+        // exists, insert '(key, value)'.  Return 1 if 'key' was found, and 0
+        // otherwise.  Note that the return value equals the number of elements
+        // found having 'key'.
+
+    int update(const KEY& key, const VisitorFunction& visitor);
+        // Call the specified 'visitor' with the element (if one exists) in
+        // this hash map having the specified 'key'.  That is:
+        //..
+        //  bool visitor(&value, key);
+        //..
+        // Return the number of elements updated or -1 if 'visitor' returned
+        // 'false'.  'visitor' has exclusive access (i.e., write access) the
+        // element for during its invocation.  The behavior is undefined if
+        // hash map manipulators and 'getValue' methods are invoked from within
+        // 'visitor', as it may lead to a deadlock.  Note that this method is
+        // equivalent to 'visit(key, visitor)'.
+
+    int visit(const VisitorFunction& visitor);
+        // Call the specified 'visitor' (in an unspecified order) on all
+        // elements in this hash table until each such element has been visited
+        // or 'visitor' returns 'false'.  That is, for '(key, value)', invoke:
+        //..
+        //  bool visitor(&value, key);
+        //..
+        // Return the number of elements visited or the negation of that value
+        // if visitations stopped because 'visitor' returned 'false'.
+        // 'visitor' has exclusive access (i.e., write access) to each element
+        // for duration of each invocation.  The stripes are visited one at a
+        // time, each while write locked.  Every element present in this hash
+        // map at the time 'visit' is invoked will be visited unless it is
+        // removed before its stripe is visited.  Elements inserted during the
+        // execution of 'visit' may or may not be visited.  The behavior is
+        // undefined if hash map manipulators and 'getValue' methods are
+        // invoked from within 'visitor', as it may lead to a deadlock.
+
+    int visit(const KEY& key, const VisitorFunction& visitor);
+        // Call the specified 'visitor' with the element (if one exists) in
+        // this hash map having the specified 'key'.  That is:
+        //..
+        //  bool visitor(&value, key);
+        //..
+        // Return the number of elements updated or -1 if 'visitor' returned
+        // 'false'.  'visitor' has exclusive access (i.e., write access) the
+        // element for during its invocation.  The behavior is undefined if
+        // hash map manipulators and 'getValue' methods are invoked from within
+        // 'visitor', as it may lead to a deadlock.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the total number of entries allocated by the stripes of this
+        // hash map.
+
+    bool empty() const;
+        // Return 'true' if this hash map contains no elements, and 'false'
+        // otherwise.
+
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this hash map.
+        // The returned function will return 'true' if two 'KEY' objects have
+        // the same value, and 'false' otherwise.
+
+    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        // Load, into the specified '*value', the value attribute of the
+        // element in this hash map having the specified 'key'.  Return 1 on
+        // success, and 0 if 'key' does not exist in this hash map.  Note that
+        // the return value equals the number of values returned.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this hash map.
+        // The return function will generate a hash value (of type
+        // 'bsl::size_t') for a 'KEY' object.
+
+    float loadFactor() const;
+        // Return the current quotient of the size of this hash map and its
+        // capacity, or 0 if the capacity is 0.
+
+    bsl::size_t numStripes() const;
+        // Return the number of stripes in this hash map.
+
+    bsl::size_t size() const;
+        // Return the current number of elements in this hash map.  Note that
+        // the stripes are counted one at a time, so the result may not reflect
+        // concurrent modifications.
+
+    int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+        // Call the specified 'visitor' (in an unspecified order) on all
+        // elements in this hash table until each such element has been visited
+        // or 'visitor' returns 'false'.  That is, for '(key, value)', invoke:
+        //..
+        //  bool visitor(value, key);
+        //..
+        // Return the number of elements visited or the negation of that value
+        // if visitations stopped because 'visitor' returned 'false'.
+        // 'visitor' has read-only access to each element for duration of each
+        // invocation.  The stripes are visited one at a time, each while read
+        // locked.  Every element present in this hash map at the time
+        // 'visitReadOnly' is invoked will be visited unless it is removed
+        // before its stripe is visited.  Elements inserted during the
+        // execution of 'visitReadOnly' may or may not be visited.  The
+        // behavior is undefined if hash map manipulators are invoked from
+        // within 'visitor', as it may lead to a deadlock.
+
+    int visitReadOnly(const KEY&                     key,
+                      const ReadOnlyVisitorFunction& visitor) const;
+        // Call the specified 'visitor' with the element (if one exists) in
+        // this hash map having the specified 'key'.  That is:
+        //..
+        //  bool visitor(value, key);
+        //..
+        // Return the number of elements visited or -1 if 'visitor' returned
+        // 'false'.  'visitor' has read-only access to the element during its
+        // invocation.  The behavior is undefined if hash map manipulators are
+        // invoked from within 'visitor', as it may lead to a deadlock.
+
+                               // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this hash map to supply memory.  Note
+        // that if no allocator was supplied at construction the default
+        // allocator installed at that time is used.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class FlatHashMap_Stripe
+                          // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap_Stripe<KEY, VALUE, HASH, EQUAL>::FlatHashMap_Stripe(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_lock()
+, d_map(capacity, hash, equal, basicAllocator)
+{
+}
+
+                             // -----------------
+                             // class FlatHashMap
+                             // -----------------
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::Stripe&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::stripe(const KEY& key) const
+{
+    const bsl::size_t hashValue = d_hasher(key);
+
+    return d_stripes_p[(hashValue >> k_HASHLET_BITS) & (d_numStripes - 1)];
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::createStripes(
+                                                          bsl::size_t capacity)
+{
+    const bsl::size_t stripeCapacity = (capacity + d_numStripes - 1)
+                                                                / d_numStripes;
+
+    Stripe *stripes = static_cast<Stripe *>(
+                       d_allocator_p->allocate(d_numStripes * sizeof(Stripe)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(stripes,
+                                                            d_allocator_p);
+    bslalg::AutoArrayDestructor<Stripe>         destructor(stripes, stripes);
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        new (stripes + i) Stripe(stripeCapacity,
+                                 d_hasher,
+                                 EQUAL(),
+                                 d_allocator_p);
+        destructor.moveEnd(1);
+    }
+
+    destructor.release();
+    deallocator.release();
+
+    d_stripes_p = stripes;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bsl::size_t       numStripes,
+                                              bslma::Allocator *basicAllocator)
+: d_stripes_p(0)
+, d_numStripes(static_cast<bsl::size_t>(
+                                     bdlb::BitUtil::roundUpToBinaryPower(
+                                      static_cast<bsl::uint64_t>(numStripes))))
+, d_hasher()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numStripes);
+
+    createStripes(capacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_stripes_p(0)
+, d_numStripes(k_DEFAULT_NUM_STRIPES)
+, d_hasher()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    createStripes(0);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::~FlatHashMap()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].~Stripe();
+    }
+    d_allocator_p->deallocate(d_stripes_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        WriteGuard guard(&d_stripes_p[i].d_lock);
+
+        d_stripes_p[i].d_map.clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    Stripe&    s = stripe(key);
+    WriteGuard guard(&s.d_lock);
+
+    return s.d_map.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class RANDOM_ITER>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::eraseBulk(RANDOM_ITER first,
+                                                            RANDOM_ITER last)
+{
+    BSLS_ASSERT(first <= last);
+
+    bsl::size_t count = 0;
+    for (; first != last; ++first) {
+        count += erase(*first);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                         const VALUE& value)
+{
+    // The entry is built before the lock is taken, to keep the critical
+    // section short, and is inserted with a single probe.
+
+    KVType     entry(key, value, d_allocator_p);
+    Stripe&    s = stripe(key);
+    WriteGuard guard(&s.d_lock);
+
+    bsl::pair<typename Map::iterator, bool> rc =
+                        s.d_map.insert(bslmf::MovableRefUtil::move(entry));
+    if (!rc.second) {
+        rc.first->second = value;
+        return 0;                                                     // RETURN
+    }
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class RANDOM_ITER>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::insertBulk(RANDOM_ITER first,
+                                                             RANDOM_ITER last)
+{
+    BSLS_ASSERT(first <= last);
+
+    bsl::size_t count = 0;
+    for (; first != last; ++first) {
+        count += insert(first->first, first->second);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    const bsl::size_t stripeElements = (numElements + d_numStripes - 1)
+                                                                / d_numStripes;
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        WriteGuard guard(&d_stripes_p[i].d_lock);
+
+        Map& map = d_stripes_p[i].d_map;
+
+        // 'bdlc::FlatHashMap::reserve' may shrink the table, so it is called
+        // only if the stripe cannot already hold 'stripeElements' elements.
+
+        const float maxElements = map.max_load_factor()
+                                      * static_cast<float>(map.capacity());
+
+        if (static_cast<float>(stripeElements) > maxElements) {
+            map.reserve(stripeElements);
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int FlatHashMap<KEY, VALUE, HASH, EQUAL>::setComputedValue(
+                                                const KEY&             key,
+                                                const VisitorFunction& visitor)
+{
+    Stripe&    s = stripe(key);
+    WriteGuard guard(&s.d_lock);
+
+    typename Map::iterator it = s.d_map.find(key);
+    if (s.d_map.end() != it) {
+        return visitor(&it->second, key) ? 1 : -1;                   // RETURN
+    }
+
+    visitor(&s.d_map[key], key);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::setValue(const KEY&   key,
+                                                           const VALUE& value)
+{
+    return 1 - insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int FlatHashMap<KEY, VALUE, HASH, EQUAL>::update(
+                                                const KEY&             key,
+                                                const VisitorFunction& visitor)
+{
+    return visit(key, visitor);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int FlatHashMap<KEY, VALUE, HASH, EQUAL>::visit(const VisitorFunction& visitor)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        WriteGuard guard(&d_stripes_p[i].d_lock);
+
+        Map& map = d_stripes_p[i].d_map;
+        for (typename Map::iterator it = map.begin(); map.end() != it; ++it) {
+            ++count;
+            if (!visitor(&it->second, it->first)) {
+                return -count;                                        // RETURN
+            }
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int FlatHashMap<KEY, VALUE, HASH, EQUAL>::visit(const KEY&             key,
+                                                const VisitorFunction& visitor)
+{
+    Stripe&    s = stripe(key);
+    WriteGuard guard(&s.d_lock);
+
+    typename Map::iterator it = s.d_map.find(key);
+    if (s.d_map.end() == it) {
+        return 0;                                                     // RETURN
+    }
+    return visitor(&it->second, key) ? 1 : -1;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        ReadGuard guard(&d_stripes_p[i].d_lock);
+
+        result += d_stripes_p[i].d_map.capacity();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        ReadGuard guard(&d_stripes_p[i].d_lock);
+
+        if (!d_stripes_p[i].d_map.empty()) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_stripes_p[0].d_map.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::getValue(
+                                                       VALUE      *value,
+                                                       const KEY&  key) const
+{
+    BSLS_ASSERT(value);
+
+    Stripe&   s = stripe(key);
+    ReadGuard guard(&s.d_lock);
+
+    typename Map::const_iterator it = s.d_map.find(key);
+    if (s.d_map.end() == it) {
+        return 0;                                                     // RETURN
+    }
+    *value = it->second;
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::loadFactor() const
+{
+    bsl::size_t numElements = 0;
+    bsl::size_t numEntries  = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        ReadGuard guard(&d_stripes_p[i].d_lock);
+
+        numElements += d_stripes_p[i].d_map.size();
+        numEntries  += d_stripes_p[i].d_map.capacity();
+    }
+    return numEntries ? static_cast<float>(numElements)
+                                             / static_cast<float>(numEntries)
+                      : 0.0f;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::numStripes() const
+{
+    return d_numStripes;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        ReadGuard guard(&d_stripes_p[i].d_lock);
+
+        result += d_stripes_p[i].d_map.size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int FlatHashMap<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
+                                  const ReadOnlyVisitorFunction& visitor) const
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        ReadGuard guard(&d_stripes_p[i].d_lock);
+
+        const Map& map = d_stripes_p[i].d_map;
+        for (typename Map::const_iterator it = map.begin();
+                                                   map.end() != it; ++it) {
+            ++count;
+            if (!visitor(it->second, it->first)) {
+                return -count;                                        // RETURN
+            }
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int FlatHashMap<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
+                                  const KEY&                     key,
+                                  const ReadOnlyVisitorFunction& visitor) const
+{
+    Stripe&   s = stripe(key);
+    ReadGuard guard(&s.d_lock);
+
+    typename Map::const_iterator it = s.d_map.find(key);
+    if (s.d_map.end() == it) {
+        return 0;                                                     // RETURN
+    }
+    return visitor(it->second, key) ? 1 : -1;
+}
+
+                               // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::FlatHashMap<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type {
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
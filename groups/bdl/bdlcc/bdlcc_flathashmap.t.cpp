@@ -0,0 +1,1880 @@
+// bdlcc_flathashmap.t.cpp                                            -*-C++-*-
+
+#include <bdlcc_flathashmap.h>
+
+#include <bdlcc_stripedunorderedmap.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsltf_alloctesttype.h>
+#include <bsltf_bitwisecopyabletesttype.h>
+#include <bsltf_movablealloctesttype.h>
+#include <bsltf_simpletesttype.h>
+#include <bsltf_templatetestfacility.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_nameof.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a fully thread-safe container template,
+// 'bdlcc::FlatHashMap', that partitions its elements among a number of
+// 'bdlc::FlatHashMap' "stripes", each guarded by a reader-writer mutex.  The
+// container is an *irregular* value-semantic type (no copy, assignment, or
+// equality), so the canonical VST test cases do not apply.
+//
+// Single-threaded behavior is tested in test cases [1 .. 8], for an 'int' key
+// and a selection of 'VALUE' types (including allocator-aware types).
+// Concurrent access, including concurrent growth of the stripes, is tested in
+// test case 9.  A negatively numbered performance test compares this
+// container with 'bdlcc::StripedUnorderedMap'.
+//
+// Global Concerns:
+//: o All allocations are from the intended allocator.
+//: o The default and global allocators are never used.
+//: o All memory is returned on destruction.
+//: o Exceptions leave the hash map in an unlocked state.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap(capacity, numStripes, *basicAllocator);
+// [ 2] FlatHashMap(bslma::Allocator *basicAllocator);
+// [ 2] ~FlatHashMap();
+//
+// MANIPULATORS
+// [ 4] void clear();
+// [ 4] bsl::size_t erase(const KEY& key);
+// [ 4] bsl::size_t eraseBulk(RANDOM_ITER first, RANDOM_ITER last);
+// [ 3] bsl::size_t insert(const KEY& key, const VALUE& value);
+// [ 5] bsl::size_t insertBulk(RANDOM_ITER first, RANDOM_ITER last);
+// [ 8] void reserve(bsl::size_t numElements);
+// [ 6] int setComputedValue(const KEY& key, const VisitorFunction& visitor);
+// [ 5] bsl::size_t setValue(const KEY& key, const VALUE& value);
+// [ 6] int update(const KEY& key, const VisitorFunction& visitor);
+// [ 7] int visit(const VisitorFunction& visitor);
+// [ 6] int visit(const KEY& key, const VisitorFunction& visitor);
+//
+// ACCESSORS
+// [ 8] bsl::size_t capacity() const;
+// [ 3] bool empty() const;
+// [ 2] EQUAL equalFunction() const;
+// [ 3] bsl::size_t getValue(VALUE *value, const KEY& key) const;
+// [ 2] HASH hashFunction() const;
+// [ 8] float loadFactor() const;
+// [ 2] bsl::size_t numStripes() const;
+// [ 3] bsl::size_t size() const;
+// [ 7] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+// [ 6] int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] MULTI-THREADED STRESS TEST
+// [10] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARISON WITH 'bdlcc::StripedUnorderedMap'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+#define RUN_EACH_TYPE BSLTF_TEMPLATETESTFACILITY_RUN_EACH_TYPE
+
+#define TEST_TYPES                                                            \
+    int,                                                                      \
+    bsltf::SimpleTestType,                                                    \
+    bsltf::AllocTestType,                                                     \
+    bsltf::BitwiseCopyableTestType,                                           \
+    bsltf::MovableAllocTestType
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bsltf::TemplateTestFacility TstFacility;
+typedef bsls::Types::Int64          Int64;
+
+// ============================================================================
+//                            USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Tallying Events from Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads process a stream of trades and we want to keep
+// a running count of trades per instrument, where instruments are identified
+// by an 'int'.  Both keys and values are small and trivially copyable, which
+// is the ideal use of 'bdlcc::FlatHashMap'.
+//
+// First, we define a functor that increments a count:
+//..
+    bool incrementCount(int *count, const int& /* instrumentId */)
+        // Increment the specified 'count' and return 'true'.
+    {
+        ++*count;
+        return true;
+    }
+//..
+
+void example1()
+    // Usage example 1.
+{
+// Then, we create the map, shared by all threads:
+//..
+    bdlcc::FlatHashMap<int, int> tradeCounts;
+//..
+// Next, each thread records a trade by calling 'setComputedValue', which
+// inserts a zero count (a value-initialized 'int') for an instrument seen for
+// the first time and then invokes the functor under the stripe's write lock:
+//..
+    tradeCounts.setComputedValue(17, &incrementCount);
+    tradeCounts.setComputedValue(42, &incrementCount);
+    tradeCounts.setComputedValue(17, &incrementCount);
+//..
+// Now, any thread can read a count:
+//..
+    int count;
+    bsl::size_t rc = tradeCounts.getValue(&count, 17);
+    ASSERT(1 == rc);
+    ASSERT(2 == count);
+
+    rc = tradeCounts.getValue(&count, 99);
+    ASSERT(0 == rc);
+//..
+// Finally, at the end of the day, we reset every count to zero with 'visit':
+//..
+    struct Reset {
+        static bool reset(int *count, const int&)
+        {
+            *count = 0;
+            return true;
+        }
+    };
+
+    int numVisited = tradeCounts.visit(&Reset::reset);
+    ASSERT(2 == numVisited);
+
+    tradeCounts.getValue(&count, 42);
+    ASSERT(0 == count);
+//..
+}
+
+}  // close namespace usage
+
+// ============================================================================
+//                       HELPER CLASSES AND FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                            // ===============
+                            // class TestValue
+                            // ===============
+
+template <class VALUE>
+class TestValue {
+    // This class holds a 'VALUE' object created by 'TemplateTestFacility' from
+    // an identifier, using a specified allocator (rather than the default
+    // allocator, as 'TemplateTestFacility::create' would).
+
+    // DATA
+    bsls::ObjectBuffer<VALUE> d_buffer;
+
+    // NOT IMPLEMENTED
+    TestValue(const TestValue&);
+    TestValue& operator=(const TestValue&);
+
+  public:
+    // CREATORS
+    TestValue(int identifier, bslma::Allocator *basicAllocator)
+        // Create a 'VALUE' object having the state identified by the specified
+        // 'identifier' and using the specified 'basicAllocator'.
+    {
+        TstFacility::emplace(d_buffer.address(), identifier, basicAllocator);
+    }
+
+    ~TestValue()
+        // Destroy this object.
+    {
+        d_buffer.object().~VALUE();
+    }
+
+    // ACCESSORS
+    const VALUE& value() const
+        // Return a reference providing non-modifiable access to the held
+        // object.
+    {
+        return d_buffer.object();
+    }
+};
+
+                           // ===================
+                           // class AssignVisitor
+                           // ===================
+
+template <class VALUE>
+class AssignVisitor {
+    // This functor assigns a fixed value to each visited element and counts
+    // the visitations, returning 'false' once a specified number of elements
+    // has been visited.
+
+    // DATA
+    const VALUE *d_value_p;  // value to assign (held, not owned)
+    int         *d_count_p;  // number of visitations (held, not owned)
+    int          d_limit;    // number of visitations returning 'true'
+
+  public:
+    // CREATORS
+    AssignVisitor(const VALUE *value, int *count, int limit = INT_MAX)
+        // Create a visitor assigning the specified 'value' and incrementing
+        // the specified 'count' on each visitation.  Optionally specify the
+        // 'limit' number of visitations that return 'true'.
+    : d_value_p(value)
+    , d_count_p(count)
+    , d_limit(limit)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(VALUE *value, const int&) const
+        // Assign the value of this visitor to the specified 'value', and
+        // return 'false' if the visitation limit is reached, and 'true'
+        // otherwise.
+    {
+        *value = *d_value_p;
+        return ++*d_count_p < d_limit;
+    }
+};
+
+                           // ==================
+                           // class TallyVisitor
+                           // ==================
+
+template <class VALUE>
+class TallyVisitor {
+    // This functor accumulates the keys and the value identifiers of visited
+    // elements, returning 'false' once a specified number of elements has been
+    // visited.
+
+    // DATA
+    int   *d_count_p;     // number of visitations (held, not owned)
+    Int64 *d_keySum_p;    // sum of visited keys (held, not owned)
+    Int64 *d_valueSum_p;  // sum of visited value ids (held, not owned)
+    int    d_limit;       // number of visitations returning 'true'
+
+  public:
+    // CREATORS
+    TallyVisitor(int   *count,
+                 Int64 *keySum,
+                 Int64 *valueSum,
+                 int    limit = INT_MAX)
+        // Create a visitor incrementing the specified 'count', and adding to
+        // the specified 'keySum' and 'valueSum', on each visitation.
+        // Optionally specify the 'limit' number of visitations that return
+        // 'true'.
+    : d_count_p(count)
+    , d_keySum_p(keySum)
+    , d_valueSum_p(valueSum)
+    , d_limit(limit)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(const VALUE& value, const int& key) const
+        // Tally the specified 'value' and 'key', and return 'false' if the
+        // visitation limit is reached, and 'true' otherwise.
+    {
+        *d_keySum_p   += key;
+        *d_valueSum_p += TstFacility::getIdentifier(value);
+        return ++*d_count_p < d_limit;
+    }
+};
+
+                             // ================
+                             // class TestDriver
+                             // ================
+
+template <class VALUE>
+class TestDriver {
+    // This class template provides a namespace for testing
+    // 'bdlcc::FlatHashMap<int, VALUE>'.
+
+    // PRIVATE TYPES
+    typedef bdlcc::FlatHashMap<int, VALUE>         Obj;
+    typedef typename Obj::KVType                   KVType;
+    typedef typename Obj::VisitorFunction          VisitorFunction;
+    typedef typename Obj::ReadOnlyVisitorFunction  ReadOnlyVisitorFunction;
+
+    enum { k_NUM_IDS = 128 };  // number of distinct 'TemplateTestFacility'
+                               // values
+
+    // PRIVATE CLASS METHODS
+    static int id(const VALUE& value)
+        // Return the identifier of the specified 'value'.
+    {
+        return TstFacility::getIdentifier(value);
+    }
+
+  public:
+    // CLASS METHODS
+    static void testCase2();
+        // Test creators and basic accessors.
+
+    static void testCase3();
+        // Test 'insert', 'getValue', 'size', and 'empty'.
+
+    static void testCase4();
+        // Test 'erase', 'eraseBulk', and 'clear'.
+
+    static void testCase5();
+        // Test 'setValue' and 'insertBulk'.
+
+    static void testCase6();
+        // Test single-key visitation.
+
+    static void testCase7();
+        // Test 'visit' and 'visitReadOnly' of all elements.
+
+    static void testCase8();
+        // Test 'reserve', 'capacity', and 'loadFactor'.
+};
+
+template <class VALUE>
+void TestDriver<VALUE>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // CREATORS AND BASIC ACCESSORS
+    //
+    // Concerns:
+    //: 1 An object created with the value constructor has the specified (or
+    //:   default) number of stripes, rounded up to a power of 2.
+    //:
+    //: 2 The specified allocator is used to supply memory, and the default
+    //:   allocator is used if none is specified.
+    //:
+    //: 3 An object created with a capacity of 0 allocates only the stripe
+    //:   array; with a non-zero capacity, the stripes are pre-sized.
+    //:
+    //: 4 All memory is released on destruction.
+    //:
+    //: 5 The hash and equality functors are those of the template parameters.
+    //:
+    //: 6 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 Create objects using each constructor with a variety of numbers of
+    //:   stripes and capacities, using a test allocator, and verify the
+    //:   accessors and the allocations.  (C-1..5)
+    //:
+    //: 2 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered for a zero number of stripes.  (C-6)
+    //
+    // Testing:
+    //   FlatHashMap(capacity, numStripes, *basicAllocator);
+    //   FlatHashMap(bslma::Allocator *basicAllocator);
+    //   ~FlatHashMap();
+    //   EQUAL equalFunction() const;
+    //   HASH hashFunction() const;
+    //   bsl::size_t numStripes() const;
+    //   bslma::Allocator *allocator() const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << "\t" << bsls::NameOf<VALUE>() << endl;
+
+    bslma::TestAllocator& da = dynamic_cast<bslma::TestAllocator&>(
+                                               *bslma::Default::allocator());
+    bslma::TestAllocatorMonitor dam(&da);
+
+    static const struct {
+        int         d_line;
+        bsl::size_t d_numStripes;
+        bsl::size_t d_expStripes;
+    } DATA[] = {
+        { L_,    1,    1 },
+        { L_,    2,    2 },
+        { L_,    3,    4 },
+        { L_,   16,   16 },
+        { L_,   17,   32 },
+        { L_,  128,  128 },
+    };
+    const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE        = DATA[ti].d_line;
+        const bsl::size_t NUM_STRIPES = DATA[ti].d_numStripes;
+        const bsl::size_t EXP_STRIPES = DATA[ti].d_expStripes;
+
+        for (bsl::size_t capacity = 0; capacity < 1000; capacity += 333) {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            {
+                Obj mX(capacity, NUM_STRIPES, &sa);  const Obj& X = mX;
+
+                ASSERTV(LINE, EXP_STRIPES == X.numStripes());
+                ASSERTV(LINE, &sa         == X.allocator());
+                ASSERTV(LINE, X.empty());
+                ASSERTV(LINE, 0           == X.size());
+                ASSERTV(LINE, capacity <= X.capacity());
+
+                if (0 == capacity) {
+                    ASSERTV(LINE, 1 == sa.numBlocksTotal());
+                    ASSERTV(LINE, 0 == X.capacity());
+                }
+                else {
+                    ASSERTV(LINE, 1 + 2 * EXP_STRIPES == sa.numBlocksTotal());
+                }
+
+                ASSERTV(LINE, X.hashFunction()(7) ==
+                     bslh::FibonacciBadHashWrapper<bsl::hash<int> >()(7));
+                ASSERTV(LINE, X.equalFunction()(7, 7));
+                ASSERTV(LINE, !X.equalFunction()(7, 8));
+            }
+            ASSERTV(LINE, 0 == sa.numBlocksInUse());
+        }
+    }
+
+    if (verbose) cout << "\tDefault arguments." << endl;
+    {
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+            ASSERT(&sa                        == X.allocator());
+            ASSERT(0                          == X.capacity());
+            ASSERT(1                          == sa.numBlocksInUse());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(dam.isTotalSame());
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+            ASSERT(&da                        == X.allocator());
+            ASSERT(1                          == da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+    }
+
+    if (verbose) cout << "\tNegative Testing." << endl;
+    {
+        bsls::AssertTestHandlerGuard hG;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        ASSERT_PASS(Obj(0, 1, &sa));
+        ASSERT_FAIL(Obj(0, 0, &sa));
+    }
+}
+
+template <class VALUE>
+void TestDriver<VALUE>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // 'insert', 'getValue', 'size', AND 'empty'
+    //
+    // Concerns:
+    //: 1 'insert' of a new key adds an element and returns 1.
+    //:
+    //: 2 'insert' of an existing key replaces its value and returns 0.
+    //:
+    //: 3 'getValue' loads the value of an existing key and returns 1, and
+    //:   returns 0 (leaving the output unchanged) for a missing key.
+    //:
+    //: 4 'size' and 'empty' reflect the number of elements over all stripes.
+    //:
+    //: 5 The stripes grow as elements are inserted.
+    //:
+    //: 6 All memory comes from the object allocator.
+    //:
+    //: 7 'insert' is exception neutral, provides the basic guarantee, and
+    //:   leaves the stripe unlocked.
+    //
+    // Plan:
+    //: 1 Insert many keys, with a variety of numbers of stripes, verifying the
+    //:   return values and the accessors after each insertion.  (C-1, 4..6)
+    //:
+    //: 2 Re-insert every key with a different value, and verify the return
+    //:   values, size, and values.  (C-2..3)
+    //:
+    //: 3 Wrap 'insert' in the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros,
+    //:   and verify the map afterwards.  (C-7)
+    //
+    // Testing:
+    //   bsl::size_t insert(const KEY& key, const VALUE& value);
+    //   bool empty() const;
+    //   bsl::size_t getValue(VALUE *value, const KEY& key) const;
+    //   bsl::size_t size() const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << "\t" << bsls::NameOf<VALUE>() << endl;
+
+    bslma::TestAllocator& da = dynamic_cast<bslma::TestAllocator&>(
+                                               *bslma::Default::allocator());
+    bslma::TestAllocatorMonitor dam(&da);
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+    const int NUM_KEYS = 500;
+
+    for (bsl::size_t numStripes = 1; numStripes <= 32; numStripes *= 4) {
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            Obj mX(0, numStripes, &sa);  const Obj& X = mX;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                TestValue<VALUE> v(i % k_NUM_IDS, &scratch);
+
+                ASSERTV(numStripes, i, 1 == mX.insert(i * 7, v.value()));
+                ASSERTV(numStripes, i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(numStripes, i, !X.empty());
+            }
+            ASSERTV(numStripes, NUM_KEYS <= static_cast<int>(X.capacity()));
+            ASSERTV(numStripes, 0 < sa.numBlocksInUse());
+
+            TestValue<VALUE> result(0, &scratch);
+            VALUE&           value = const_cast<VALUE&>(result.value());
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(numStripes, i, 1 == X.getValue(&value, i * 7));
+                ASSERTV(numStripes, i, i % k_NUM_IDS == id(value));
+            }
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                TestValue<VALUE> v((i + 1) % k_NUM_IDS, &scratch);
+
+                ASSERTV(numStripes, i, 0 == mX.insert(i * 7, v.value()));
+            }
+            ASSERTV(numStripes, NUM_KEYS == static_cast<int>(X.size()));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(numStripes, i, 1 == X.getValue(&value, i * 7));
+                ASSERTV(numStripes, i, (i + 1) % k_NUM_IDS == id(value));
+
+                // Missing keys leave 'value' unchanged.
+
+                ASSERTV(numStripes, i, 0 == X.getValue(&value, i * 7 + 1));
+                ASSERTV(numStripes, i, (i + 1) % k_NUM_IDS == id(value));
+            }
+        }
+        ASSERTV(numStripes, 0 == sa.numBlocksInUse());
+    }
+
+    if (verbose) cout << "\tException testing." << endl;
+    {
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            Obj mX(0, 2, &sa);  const Obj& X = mX;
+
+            TestValue<VALUE> v(3, &scratch);
+
+            for (int i = 0; i < 100; ++i) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                    mX.insert(i, v.value());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END;
+
+                // The element is present after a successful insertion.
+
+                ASSERTV(i, 0 == mX.insert(i, v.value()));
+            }
+
+            // A stripe provides only the basic guarantee: elements may be
+            // lost if a rehash of the stripe throws.  Verify that the stripes
+            // were left unlocked and consistent.
+
+            TestValue<VALUE> result(0, &scratch);
+            VALUE&           value = const_cast<VALUE&>(result.value());
+
+            bsl::size_t numFound = 0;
+            for (int i = 0; i < 100; ++i) {
+                if (X.getValue(&value, i)) {
+                    ASSERTV(i, 3 == id(value));
+                    ++numFound;
+                }
+            }
+            ASSERT(numFound == X.size());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i, v.value());
+            }
+            ASSERT(100 == X.size());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+    }
+
+    ASSERT(dam.isTotalSame());
+}
+
+template <class VALUE>
+void TestDriver<VALUE>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // 'erase', 'eraseBulk', AND 'clear'
+    //
+    // Concerns:
+    //: 1 'erase' removes the element having the key and returns 1, and
+    //:   returns 0 for a missing key.
+    //:
+    //: 2 'eraseBulk' removes the elements having the keys in the range and
+    //:   returns the number of elements removed.
+    //:
+    //: 3 'clear' removes all elements and retains the capacity.
+    //:
+    //: 4 Other elements are unaffected.
+    //
+    // Plan:
+    //: 1 Populate a map, erase every third key with 'erase' and the keys of
+    //:   a range (including missing keys) with 'eraseBulk', and verify the
+    //:   return values and the remaining elements.  (C-1..2, 4)
+    //:
+    //: 2 'clear' the map and verify 'size', 'capacity', and that the map can
+    //:   be repopulated.  (C-3)
+    //
+    // Testing:
+    //   void clear();
+    //   bsl::size_t erase(const KEY& key);
+    //   bsl::size_t eraseBulk(RANDOM_ITER first, RANDOM_ITER last);
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << "\t" << bsls::NameOf<VALUE>() << endl;
+
+    bslma::TestAllocator& da = dynamic_cast<bslma::TestAllocator&>(
+                                               *bslma::Default::allocator());
+    bslma::TestAllocatorMonitor dam(&da);
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+    bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+    const int NUM_KEYS = 300;
+    {
+        Obj mX(0, 8, &sa);  const Obj& X = mX;
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            TestValue<VALUE> v(i % k_NUM_IDS, &scratch);
+            mX.insert(i, v.value());
+        }
+
+        for (int i = 0; i < NUM_KEYS; i += 3) {
+            ASSERTV(i, 1 == mX.erase(i));
+            ASSERTV(i, 0 == mX.erase(i));
+        }
+        ASSERT(NUM_KEYS - NUM_KEYS / 3 == static_cast<int>(X.size()));
+
+        // Erase '[100, 200)' in bulk, including the keys already erased.
+
+        bsl::vector<int> keys(&scratch);
+        for (int i = 100; i < 200; ++i) {
+            keys.push_back(i);
+        }
+        const bsl::size_t expErased = 100 - 33;
+
+        ASSERT(expErased == mX.eraseBulk(keys.begin(), keys.end()));
+        ASSERT(0         == mX.eraseBulk(keys.begin(), keys.end()));
+        ASSERT(0         == mX.eraseBulk(keys.begin(), keys.begin()));
+
+        TestValue<VALUE> result(0, &scratch);
+        VALUE&           value = const_cast<VALUE&>(result.value());
+
+        bsl::size_t expSize = 0;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const bool present = 0 != i % 3 && (i < 100 || 200 <= i);
+
+            ASSERTV(i, present == (1 == X.getValue(&value, i)));
+            if (present) {
+                ASSERTV(i, i % k_NUM_IDS == id(value));
+                ++expSize;
+            }
+        }
+        ASSERT(expSize == X.size());
+
+        const bsl::size_t capacity = X.capacity();
+
+        mX.clear();
+
+        ASSERT(0        == X.size());
+        ASSERT(X.empty());
+        ASSERT(capacity == X.capacity());
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            ASSERTV(i, 0 == X.getValue(&value, i));
+        }
+
+        TestValue<VALUE> v(5, &scratch);
+        ASSERT(1 == mX.insert(5, v.value()));
+        ASSERT(1 == X.size());
+    }
+    ASSERT(0 == sa.numBlocksInUse());
+
+    if (verbose) cout << "\tNegative Testing." << endl;
+    {
+        bsls::AssertTestHandlerGuard hG;
+
+        Obj mX(&sa);
+
+        int keys[] = { 1, 2 };
+
+        ASSERT_PASS(mX.eraseBulk(keys,     keys + 2));
+        ASSERT_FAIL(mX.eraseBulk(keys + 2, keys));
+    }
+
+    ASSERT(dam.isTotalSame());
+}
+
+template <class VALUE>
+void TestDriver<VALUE>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // 'setValue' AND 'insertBulk'
+    //
+    // Concerns:
+    //: 1 'setValue' has the effect of 'insert', and returns the number of
+    //:   elements found (rather than inserted).
+    //:
+    //: 2 'insertBulk' inserts or updates the element of each pair in the
+    //:   range, and returns the number of elements inserted.
+    //
+    // Plan:
+    //: 1 Call 'setValue' for new and existing keys, and verify the return
+    //:   values and the values of the elements.  (C-1)
+    //:
+    //: 2 Call 'insertBulk' for a range of pairs, some of whose keys exist,
+    //:   and verify the return value and the values of the elements.  (C-2)
+    //
+    // Testing:
+    //   bsl::size_t setValue(const KEY& key, const VALUE& value);
+    //   bsl::size_t insertBulk(RANDOM_ITER first, RANDOM_ITER last);
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << "\t" << bsls::NameOf<VALUE>() << endl;
+
+    bslma::TestAllocator& da = dynamic_cast<bslma::TestAllocator&>(
+                                               *bslma::Default::allocator());
+    bslma::TestAllocatorMonitor dam(&da);
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+    bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+    {
+        Obj mX(0, 4, &sa);  const Obj& X = mX;
+
+        TestValue<VALUE> result(0, &scratch);
+        VALUE&           value = const_cast<VALUE&>(result.value());
+
+        for (int i = 0; i < 100; ++i) {
+            TestValue<VALUE> v1(i % k_NUM_IDS, &scratch);
+            TestValue<VALUE> v2((i + 7) % k_NUM_IDS, &scratch);
+
+            ASSERTV(i, 0 == mX.setValue(i, v1.value()));
+            ASSERTV(i, 1 == X.getValue(&value, i));
+            ASSERTV(i, i % k_NUM_IDS == id(value));
+
+            ASSERTV(i, 1 == mX.setValue(i, v2.value()));
+            ASSERTV(i, 1 == X.getValue(&value, i));
+            ASSERTV(i, (i + 7) % k_NUM_IDS == id(value));
+        }
+        ASSERT(100 == X.size());
+
+        // Pairs for keys '[50, 150)'; half of the keys exist.
+
+        bsl::vector<KVType> data(&scratch);
+        for (int i = 50; i < 150; ++i) {
+            TestValue<VALUE> v((i + 3) % k_NUM_IDS, &scratch);
+            data.push_back(KVType(i, v.value(), &scratch));
+        }
+
+        ASSERT(50  == mX.insertBulk(data.begin(), data.end()));
+        ASSERT(150 == X.size());
+        ASSERT(0   == mX.insertBulk(data.begin(), data.end()));
+        ASSERT(0   == mX.insertBulk(data.begin(), data.begin()));
+        ASSERT(150 == X.size());
+
+        for (int i = 0; i < 150; ++i) {
+            const int expId = i < 50 ? (i + 7) % k_NUM_IDS
+                                     : (i + 3) % k_NUM_IDS;
+
+            ASSERTV(i, 1     == X.getValue(&value, i));
+            ASSERTV(i, expId == id(value));
+        }
+    }
+    ASSERT(0 == sa.numBlocksInUse());
+
+    if (verbose) cout << "\tNegative Testing." << endl;
+    {
+        bsls::AssertTestHandlerGuard hG;
+
+        Obj mX(&sa);
+
+        bsl::vector<KVType> data(&scratch);
+        TestValue<VALUE> v(1, &scratch);
+        data.push_back(KVType(1, v.value(), &scratch));
+
+        ASSERT_PASS(mX.insertBulk(data.begin(), data.end()));
+        ASSERT_FAIL(mX.insertBulk(data.end(),   data.begin()));
+    }
+
+    ASSERT(dam.isTotalSame());
+}
+
+template <class VALUE>
+void TestDriver<VALUE>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // SINGLE-KEY VISITATION
+    //
+    // Concerns:
+    //: 1 'visit(key, visitor)' and 'update' invoke 'visitor' on the element
+    //:   having 'key', whose value 'visitor' can modify, and return 1 (or -1
+    //:   if 'visitor' returns 'false'), and return 0 without invoking
+    //:   'visitor' for a missing key.
+    //:
+    //: 2 'visitReadOnly(key, visitor)' behaves likewise, with read-only
+    //:   access.
+    //:
+    //: 3 'setComputedValue' invokes 'visitor' on the element having 'key',
+    //:   returning 1 or -1, or inserts a default-constructed value, invokes
+    //:   'visitor' on it, and returns 0.
+    //
+    // Plan:
+    //: 1 Using 'AssignVisitor' and 'TallyVisitor' objects (which count their
+    //:   invocations and can return 'false'), call each method on present
+    //:   and missing keys, and verify the return values, the number of
+    //:   invocations, and the values of the elements.  (C-1..3)
+    //
+    // Testing:
+    //   int setComputedValue(const KEY& key, const VisitorFunction& visitor);
+    //   int update(const KEY& key, const VisitorFunction& visitor);
+    //   int visit(const KEY& key, const VisitorFunction& visitor);
+    //   int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&) const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << "\t" << bsls::NameOf<VALUE>() << endl;
+
+    bslma::TestAllocator& da = dynamic_cast<bslma::TestAllocator&>(
+                                               *bslma::Default::allocator());
+    bslma::TestAllocatorMonitor dam(&da);
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+    bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+    {
+        Obj mX(0, 4, &sa);  const Obj& X = mX;
+
+        TestValue<VALUE> v1(1, &scratch);
+        TestValue<VALUE> v2(2, &scratch);
+        TestValue<VALUE> v3(3, &scratch);
+
+        TestValue<VALUE> result(0, &scratch);
+        VALUE&           value = const_cast<VALUE&>(result.value());
+
+        mX.insert(10, v1.value());
+
+        int   count    = 0;
+        Int64 keySum   = 0;
+        Int64 valueSum = 0;
+
+        // 'visit' and 'update'
+
+        ASSERT(1 == mX.visit(10, AssignVisitor<VALUE>(&v2.value(), &count)));
+        ASSERT(1 == count);
+        ASSERT(1 == X.getValue(&value, 10));
+        ASSERT(2 == id(value));
+
+        ASSERT(1 == mX.update(10, AssignVisitor<VALUE>(&v3.value(), &count)));
+        ASSERT(2 == count);
+        ASSERT(1 == X.getValue(&value, 10));
+        ASSERT(3 == id(value));
+
+        ASSERT(-1 == mX.visit(10,
+                              AssignVisitor<VALUE>(&v1.value(), &count, 3)));
+        ASSERT(3  == count);
+        ASSERT(-1 == mX.update(10,
+                               AssignVisitor<VALUE>(&v2.value(), &count, 4)));
+        ASSERT(4  == count);
+        ASSERT(1  == X.getValue(&value, 10));
+        ASSERT(2  == id(value));
+
+        ASSERT(0 == mX.visit(11, AssignVisitor<VALUE>(&v1.value(), &count)));
+        ASSERT(0 == mX.update(11, AssignVisitor<VALUE>(&v1.value(), &count)));
+        ASSERT(4 == count);
+        ASSERT(1 == X.size());
+
+        // 'visitReadOnly'
+
+        count = 0;
+        ASSERT(1  == X.visitReadOnly(10, TallyVisitor<VALUE>(&count,
+                                                             &keySum,
+                                                             &valueSum)));
+        ASSERT(1  == count);
+        ASSERT(10 == keySum);
+        ASSERT(2  == valueSum);
+
+        ASSERT(-1 == X.visitReadOnly(10, TallyVisitor<VALUE>(&count,
+                                                             &keySum,
+                                                             &valueSum,
+                                                             2)));
+        ASSERT(2  == count);
+        ASSERT(0  == X.visitReadOnly(11, TallyVisitor<VALUE>(&count,
+                                                             &keySum,
+                                                             &valueSum)));
+        ASSERT(2  == count);
+
+        // 'setComputedValue'
+
+        count = 0;
+        ASSERT(1 == mX.setComputedValue(
+                                  10,
+                                  AssignVisitor<VALUE>(&v3.value(), &count)));
+        ASSERT(1 == count);
+        ASSERT(1 == X.getValue(&value, 10));
+        ASSERT(3 == id(value));
+
+        ASSERT(-1 == mX.setComputedValue(
+                               10,
+                               AssignVisitor<VALUE>(&v1.value(), &count, 2)));
+        ASSERT(2  == count);
+        ASSERT(1  == X.getValue(&value, 10));
+        ASSERT(1  == id(value));
+
+        ASSERT(0 == mX.setComputedValue(
+                                  11,
+                                  AssignVisitor<VALUE>(&v2.value(), &count)));
+        ASSERT(3 == count);
+        ASSERT(2 == X.size());
+        ASSERT(1 == X.getValue(&value, 11));
+        ASSERT(2 == id(value));
+
+        ASSERT(0 == mX.setComputedValue(
+                               12,
+                               AssignVisitor<VALUE>(&v3.value(), &count, 4)));
+        ASSERT(4 == count);
+        ASSERT(3 == X.size());
+        ASSERT(1 == X.getValue(&value, 12));
+        ASSERT(3 == id(value));
+    }
+    ASSERT(0 == sa.numBlocksInUse());
+
+    ASSERT(dam.isTotalSame());
+}
+
+template <class VALUE>
+void TestDriver<VALUE>::testCase7()
+{
+    // ------------------------------------------------------------------------
+    // 'visit' AND 'visitReadOnly' OF ALL ELEMENTS
+    //
+    // Concerns:
+    //: 1 'visit(visitor)' invokes 'visitor' once on every element, across all
+    //:   stripes, and returns the number of elements visited.
+    //:
+    //: 2 'visitor' can modify the visited values.
+    //:
+    //: 3 Visitation stops as soon as 'visitor' returns 'false', and the
+    //:   negated number of visited elements is returned.
+    //:
+    //: 4 'visitReadOnly(visitor)' behaves likewise with read-only access.
+    //:
+    //: 5 Visiting an empty map invokes no visitor and returns 0.
+    //
+    // Plan:
+    //: 1 For a variety of numbers of stripes and elements, visit all elements
+    //:   with a 'TallyVisitor' and verify the sums of the keys and values,
+    //:   and the return value.  (C-4..5)
+    //:
+    //: 2 Assign a value to every element with an 'AssignVisitor' and verify
+    //:   with 'getValue'.  (C-1..2)
+    //:
+    //: 3 Repeat with visitors that return 'false' after 'k' visitations.
+    //:   (C-3)
+    //
+    // Testing:
+    //   int visit(const VisitorFunction& visitor);
+    //   int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << "\t" << bsls::NameOf<VALUE>() << endl;
+
+    bslma::TestAllocator& da = dynamic_cast<bslma::TestAllocator&>(
+                                               *bslma::Default::allocator());
+    bslma::TestAllocatorMonitor dam(&da);
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+
+    for (bsl::size_t numStripes = 1; numStripes <= 16; numStripes *= 2) {
+    for (int numKeys = 0; numKeys < 200; numKeys = numKeys * 3 + 1) {
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            Obj mX(0, numStripes, &sa);  const Obj& X = mX;
+
+            Int64 expKeySum   = 0;
+            Int64 expValueSum = 0;
+            for (int i = 0; i < numKeys; ++i) {
+                TestValue<VALUE> v(i % k_NUM_IDS, &scratch);
+                mX.insert(i, v.value());
+                expKeySum   += i;
+                expValueSum += i % k_NUM_IDS;
+            }
+
+            int   count    = 0;
+            Int64 keySum   = 0;
+            Int64 valueSum = 0;
+
+            ASSERTV(numStripes, numKeys, numKeys == X.visitReadOnly(
+                      TallyVisitor<VALUE>(&count, &keySum, &valueSum)));
+            ASSERTV(numStripes, numKeys, numKeys     == count);
+            ASSERTV(numStripes, numKeys, expKeySum   == keySum);
+            ASSERTV(numStripes, numKeys, expValueSum == valueSum);
+
+            TestValue<VALUE> v9(9, &scratch);
+
+            count = 0;
+            ASSERTV(numStripes, numKeys, numKeys == mX.visit(
+                                  AssignVisitor<VALUE>(&v9.value(), &count)));
+            ASSERTV(numStripes, numKeys, numKeys == count);
+
+            TestValue<VALUE> result(0, &scratch);
+            VALUE&           value = const_cast<VALUE&>(result.value());
+
+            for (int i = 0; i < numKeys; ++i) {
+                ASSERTV(numStripes, i, 1 == X.getValue(&value, i));
+                ASSERTV(numStripes, i, 9 == id(value));
+            }
+
+            for (int k = 1; k <= numKeys; k = k * 2 + 1) {
+                count = 0;
+                ASSERTV(numStripes, numKeys, k, -k == mX.visit(
+                               AssignVisitor<VALUE>(&v9.value(), &count, k)));
+                ASSERTV(numStripes, numKeys, k, k == count);
+
+                count = 0;
+                ASSERTV(numStripes, numKeys, k, -k == X.visitReadOnly(
+                   TallyVisitor<VALUE>(&count, &keySum, &valueSum, k)));
+                ASSERTV(numStripes, numKeys, k, k == count);
+            }
+        }
+        ASSERTV(numStripes, numKeys, 0 == sa.numBlocksInUse());
+    }
+    }
+
+    ASSERT(dam.isTotalSame());
+}
+
+template <class VALUE>
+void TestDriver<VALUE>::testCase8()
+{
+    // ------------------------------------------------------------------------
+    // 'reserve', 'capacity', AND 'loadFactor'
+    //
+    // Concerns:
+    //: 1 'reserve(n)' grows the stripes so that 'n' evenly distributed
+    //:   elements fit without further allocation.
+    //:
+    //: 2 'reserve' preserves all elements and their values.
+    //:
+    //: 3 'reserve' of fewer elements than the current size of a stripe has
+    //:   no effect.
+    //:
+    //: 4 'capacity' is the total capacity of the stripes, and 'loadFactor'
+    //:   is 'size() / capacity()', or 0 for a map with no capacity.
+    //
+    // Plan:
+    //: 1 Reserve space in an empty map, and verify 'capacity'.  (C-1, 4)
+    //:
+    //: 2 Populate a map, reserve a larger and a smaller number of elements,
+    //:   and verify the elements, 'capacity', and 'loadFactor'.  (C-2..4)
+    //
+    // Testing:
+    //   void reserve(bsl::size_t numElements);
+    //   bsl::size_t capacity() const;
+    //   float loadFactor() const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << "\t" << bsls::NameOf<VALUE>() << endl;
+
+    bslma::TestAllocator& da = dynamic_cast<bslma::TestAllocator&>(
+                                               *bslma::Default::allocator());
+    bslma::TestAllocatorMonitor dam(&da);
+
+    bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
+    bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+    {
+        Obj mX(0, 4, &sa);  const Obj& X = mX;
+
+        ASSERT(0    == X.capacity());
+        ASSERT(0.0f == X.loadFactor());
+
+        mX.reserve(1000);
+
+        const bsl::size_t capacity = X.capacity();
+        ASSERT(1000 <= capacity);
+        ASSERT(0.0f == X.loadFactor());
+
+        mX.reserve(10);
+        ASSERT(capacity == X.capacity());
+
+        for (int i = 0; i < 500; ++i) {
+            TestValue<VALUE> v(i % k_NUM_IDS, &scratch);
+            mX.insert(i, v.value());
+        }
+        ASSERT(500 == X.size());
+        ASSERT(static_cast<float>(500) / static_cast<float>(X.capacity())
+                                                           == X.loadFactor());
+
+        mX.reserve(8000);
+        ASSERT(8000 <= X.capacity());
+        ASSERT(static_cast<float>(500) / static_cast<float>(X.capacity())
+                                                           == X.loadFactor());
+
+        // Insertions up to the reserved size do not allocate.
+
+        TestValue<VALUE> v(1, &scratch);
+
+        bslma::TestAllocatorMonitor sam(&sa);
+        for (int i = 500; i < 1500; ++i) {
+            mX.insert(i, v.value());
+        }
+        if (!bslma::UsesBslmaAllocator<VALUE>::value) {
+            ASSERT(sam.isTotalSame());
+        }
+
+        TestValue<VALUE> result(0, &scratch);
+        VALUE&           value = const_cast<VALUE&>(result.value());
+
+        for (int i = 0; i < 1500; ++i) {
+            ASSERTV(i, 1 == X.getValue(&value, i));
+            ASSERTV(i, (i < 500 ? i % k_NUM_IDS : 1) == id(value));
+        }
+    }
+    ASSERT(0 == sa.numBlocksInUse());
+
+    ASSERT(dam.isTotalSame());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                         MULTI-THREADED TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace threaded {
+
+typedef bdlcc::FlatHashMap<int, Int64> Obj;
+
+enum {
+    k_NUM_KEYS = 4096  // every value 'v' of key 'k' has 'k == v % k_NUM_KEYS'
+};
+
+bool addNumKeys(Int64 *value, const int& key)
+    // Add 'k_NUM_KEYS' to the specified 'value', which must be associated with
+    // the specified 'key', and return 'true'.  If 'value' is 0 (e.g., was
+    // just inserted by 'setComputedValue'), set it to 'key' instead.  Note
+    // that the value remains congruent to 'key'.
+{
+    if (0 == *value) {
+        *value = key;
+        return true;                                                  // RETURN
+    }
+
+    ASSERTV(key, *value, key == *value % k_NUM_KEYS);
+
+    *value += k_NUM_KEYS;
+    return true;
+}
+
+bool checkValue(const Int64& value, const int& key)
+    // Verify that the specified 'value' is consistent with the specified
+    // 'key', and return 'true'.
+{
+    ASSERTV(key, value, key == value % k_NUM_KEYS);
+    return true;
+}
+
+struct StressArgs {
+    // This 'struct' holds the state shared by the threads of the stress test.
+
+    Obj              *d_map_p;        // map under test
+    bsls::AtomicBool  d_done;         // 'true' once the writers complete
+    bslmt::Barrier   *d_barrier_p;    // start line
+    int               d_numIterations;
+};
+
+void writer(StressArgs *args, int threadIndex)
+    // Modify 'args->d_map_p' with a pseudo-random mix of operations on random
+    // keys, maintaining the value-key congruence.  Operate on 'threadIndex'
+    // with a distinct random sequence.
+{
+    Obj&         map  = *args->d_map_p;
+    unsigned int seed = 12345u + 7919u * threadIndex;
+
+    args->d_barrier_p->wait();
+
+    for (int i = 0; i < args->d_numIterations; ++i) {
+        seed = seed * 1103515245u + 12345u;
+
+        const int key = static_cast<int>((seed >> 8) % k_NUM_KEYS);
+        const int op  = static_cast<int>((seed >> 24) % 8);
+
+        switch (op) {
+          case 0: {
+            map.erase(key);
+          } break;
+          case 1: {
+            map.setComputedValue(key, &addNumKeys);
+          } break;
+          case 2: {
+            map.visit(key, &addNumKeys);
+          } break;
+          case 3: {
+            int keys[3] = { key, (key + 1) % k_NUM_KEYS,
+                                 (key + 2) % k_NUM_KEYS };
+            map.eraseBulk(keys, keys + 3);
+          } break;
+          default: {
+            map.insert(key, key + static_cast<Int64>(i) * k_NUM_KEYS);
+          } break;
+        }
+    }
+}
+
+void reader(StressArgs *args)
+    // Look up random keys in 'args->d_map_p', verifying the value-key
+    // congruence, and occasionally call 'reserve', until 'args->d_done' is
+    // 'true'.
+{
+    Obj&         map  = *args->d_map_p;
+    unsigned int seed = 54321u;
+
+    args->d_barrier_p->wait();
+
+    int numIterations = 0;
+    while (!args->d_done || numIterations < 1000) {
+        seed = seed * 1103515245u + 12345u;
+
+        const int key = static_cast<int>((seed >> 8) % k_NUM_KEYS);
+
+        Int64 value;
+        if (map.getValue(&value, key)) {
+            ASSERTV(key, value, key == value % k_NUM_KEYS);
+        }
+        if (0 == numIterations % 64) {
+            map.visitReadOnly(key, &checkValue);
+        }
+        if (0 == numIterations % 4096) {
+            map.visitReadOnly(&checkValue);
+            map.size();
+            map.reserve(static_cast<bsl::size_t>(numIterations % k_NUM_KEYS));
+        }
+        ++numIterations;
+    }
+}
+
+void insertDisjoint(Obj *map, int threadIndex, int numThreads, int numKeys)
+    // Insert into the specified 'map' the keys in '[0, numKeys)' that are
+    // congruent to the specified 'threadIndex' modulo the specified
+    // 'numThreads', each with a value of twice the key.
+{
+    for (int key = threadIndex; key < numKeys; key += numThreads) {
+        ASSERTV(key, 1 == map->insert(key, 2 * static_cast<Int64>(key)));
+    }
+}
+
+}  // close namespace threaded
+
+// ============================================================================
+//                         PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace perf {
+
+template <class MAP>
+struct MixedArgs {
+    // This 'struct' holds the arguments of a thread of the mixed-workload
+    // benchmark.
+
+    MAP            *d_map_p;
+    int             d_numKeys;
+    int             d_numOps;
+    int             d_writePercent;
+    unsigned int    d_seed;
+    bslmt::Barrier *d_barrier_p;
+};
+
+template <class MAP>
+void mixedWorkload(MixedArgs<MAP> *args)
+    // Perform 'args->d_numOps' operations on random keys of 'args->d_map_p',
+    // 'args->d_writePercent' percent of which are 'setValue', and the rest
+    // are 'getValue'.
+{
+    MAP&         map  = *args->d_map_p;
+    unsigned int seed = args->d_seed;
+    Int64        value;
+
+    args->d_barrier_p->wait();
+
+    for (int i = 0; i < args->d_numOps; ++i) {
+        seed = seed * 1103515245u + 12345u;
+
+        const int key = static_cast<int>((seed >> 4) % args->d_numKeys);
+
+        if (static_cast<int>((seed >> 24) % 100) < args->d_writePercent) {
+            map.setValue(key, static_cast<Int64>(i));
+        }
+        else {
+            map.getValue(&value, key);
+        }
+    }
+}
+
+template <class MAP>
+struct Factory;
+    // This 'struct' provides a namespace for creating a map of type 'MAP'
+    // having a specified number of stripes.
+
+template <>
+struct Factory<bdlcc::FlatHashMap<int, Int64> > {
+    static bdlcc::FlatHashMap<int, Int64> *create(int               numStripes,
+                                                  bslma::Allocator *allocator)
+        // Return a new map having the specified 'numStripes' and using the
+        // specified 'allocator'.
+    {
+        return new (*allocator) bdlcc::FlatHashMap<int, Int64>(0,
+                                                               numStripes,
+                                                               allocator);
+    }
+};
+
+template <>
+struct Factory<bdlcc::StripedUnorderedMap<int, Int64> > {
+    static bdlcc::StripedUnorderedMap<int, Int64> *create(
+                                                  int               numStripes,
+                                                  bslma::Allocator *allocator)
+        // Return a new map having the specified 'numStripes' and using the
+        // specified 'allocator'.
+    {
+        return new (*allocator) bdlcc::StripedUnorderedMap<int, Int64>(
+                                                                   numStripes,
+                                                                   numStripes,
+                                                                   allocator);
+    }
+};
+
+template <class MAP>
+void runBenchmark(const char *name,
+                  int         numKeys,
+                  int         numThreads,
+                  int         numStripes,
+                  int         writePercent)
+    // Measure and print, for a map of type 'MAP' identified by the specified
+    // 'name' and having the specified 'numStripes', the time to insert
+    // 'numKeys' keys, to look each up, the memory used, and the throughput
+    // of a workload of 'numThreads' threads doing 'writePercent' writes.
+{
+    bslma::TestAllocator     ta("bench", false);
+    bslma::Allocator        *fa = bslma::NewDeleteAllocator::allocator(0);
+    bsls::Types::Int64       t0;
+
+    // Memory
+
+    {
+        MAP *map = Factory<MAP>::create(numStripes, &ta);
+        for (int i = 0; i < numKeys; ++i) {
+            map->insert(i, i);
+        }
+        cout << name << ": bytes/element = "
+             << static_cast<double>(ta.numBytesInUse()) / numKeys
+             << ", blocks = " << ta.numBlocksInUse() << endl;
+        ta.deleteObject(map);
+    }
+
+    MAP *map = Factory<MAP>::create(numStripes, fa);
+
+    // Insertion and lookup, single-threaded
+
+    t0 = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numKeys; ++i) {
+        map->insert(i, i);
+    }
+    const double insertNs = static_cast<double>(
+                           bsls::TimeUtil::getTimer() - t0) / numKeys;
+
+    Int64 value;
+    Int64 sum = 0;
+    t0 = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numKeys; ++i) {
+        map->getValue(&value, (i * 7919) % numKeys);
+        sum += value;
+    }
+    const double lookupNs = static_cast<double>(
+                           bsls::TimeUtil::getTimer() - t0) / numKeys;
+
+    cout << name << ": insert ns/op = " << insertNs
+         << ", getValue ns/op = " << lookupNs
+         << " (" << sum << ")" << endl;
+
+    // Mixed workload, multi-threaded
+
+    const int                   numOps = 1000000;
+    bslmt::Barrier              barrier(numThreads + 1);
+    bsl::vector<MixedArgs<MAP> > args(numThreads);
+    bslmt::ThreadGroup          threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        MixedArgs<MAP> a = { map, numKeys, numOps, writePercent,
+                             static_cast<unsigned int>(i * 31 + 7),
+                             &barrier };
+        args[i] = a;
+        threads.addThread(bdlf::BindUtil::bind(&mixedWorkload<MAP>,
+                                               &args[i]));
+    }
+    barrier.wait();
+    t0 = bsls::TimeUtil::getTimer();
+    threads.joinAll();
+    const double elapsed = static_cast<double>(
+                                bsls::TimeUtil::getTimer() - t0) / 1.0e9;
+
+    cout << name << ": " << numThreads << " threads, " << writePercent
+         << "% writes: Mops/s = "
+         << numThreads * static_cast<double>(numOps) / elapsed / 1.0e6
+         << endl;
+
+    fa->deleteObject(map);
+}
+
+}  // close namespace perf
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5 && test > 0;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usage::example1();
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // MULTI-THREADED STRESS TEST
+        //
+        // Concerns:
+        //: 1 Concurrent insertions into an initially empty map, which grow
+        //:   the stripes concurrently, lose no elements.
+        //:
+        //: 2 Concurrent lookups observe only values that were stored, while
+        //:   other threads insert, update, erase, and reserve.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Have several threads insert disjoint sets of keys into a map
+        //:   with a capacity of 0, and verify all elements afterwards.
+        //:   (C-1)
+        //:
+        //: 2 Have writer threads apply a random mix of manipulators that
+        //:   maintain an invariant relating each value to its key, while
+        //:   reader threads check the invariant with 'getValue' and
+        //:   'visitReadOnly' and call 'reserve'.  Verify the invariant and
+        //:   'size' afterwards.  (C-2)
+        //:
+        //: 3 Verify that all memory is returned to the test allocator.  (C-3)
+        //
+        // Testing:
+        //   MULTI-THREADED STRESS TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MULTI-THREADED STRESS TEST" << endl
+                          << "==========================" << endl;
+
+        using namespace threaded;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tConcurrent growth." << endl;
+
+        for (bsl::size_t numStripes = 1; numStripes <= 16; numStripes *= 4) {
+            const int k_NUM_THREADS = 4;
+            const int NUM_INSERTED  = 20000;
+
+            Obj mX(0, numStripes, &sa);  const Obj& X = mX;
+
+            bslmt::ThreadGroup threads;
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&insertDisjoint,
+                                                       &mX,
+                                                       i,
+                                                       k_NUM_THREADS,
+                                                       NUM_INSERTED));
+            }
+            threads.joinAll();
+
+            ASSERTV(numStripes, NUM_INSERTED == static_cast<int>(X.size()));
+            for (int key = 0; key < NUM_INSERTED; ++key) {
+                Int64 value = -1;
+                ASSERTV(numStripes, key, 1 == X.getValue(&value, key));
+                ASSERTV(numStripes, key, 2 * key == value);
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tConcurrent readers and writers." << endl;
+        {
+            const int k_NUM_WRITERS = 4;
+            const int k_NUM_READERS = 4;
+
+            Obj mX(0, 8, &sa);  const Obj& X = mX;
+
+            bslmt::Barrier barrier(k_NUM_WRITERS + k_NUM_READERS);
+            StressArgs     args;
+            args.d_map_p         = &mX;
+            args.d_barrier_p     = &barrier;
+            args.d_numIterations = 100000;
+
+            bslmt::ThreadGroup writers;
+            bslmt::ThreadGroup readers;
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                readers.addThread(bdlf::BindUtil::bind(&reader, &args));
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                writers.addThread(bdlf::BindUtil::bind(&writer, &args, i));
+            }
+            writers.joinAll();
+            args.d_done = true;
+            readers.joinAll();
+
+            int   count    = 0;
+            Int64 keySum   = 0;
+            Int64 valueSum = 0;
+            ASSERT(static_cast<int>(X.size()) ==
+                  X.visitReadOnly(TallyVisitor<Int64>(&count,
+                                                      &keySum,
+                                                      &valueSum)));
+            ASSERT(X.visitReadOnly(&checkValue) == count);
+            if (veryVerbose) {
+                P_(X.size()); P_(X.capacity()); P(X.loadFactor());
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // 'reserve', 'capacity', AND 'loadFactor'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'reserve', 'capacity', AND 'loadFactor'" << endl
+                          << "=======================================" << endl;
+
+        RUN_EACH_TYPE(TestDriver, testCase8, TEST_TYPES);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'visit' AND 'visitReadOnly' OF ALL ELEMENTS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'visit' AND 'visitReadOnly' OF ALL ELEMENTS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        RUN_EACH_TYPE(TestDriver, testCase7, TEST_TYPES);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // SINGLE-KEY VISITATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SINGLE-KEY VISITATION" << endl
+                          << "=====================" << endl;
+
+        RUN_EACH_TYPE(TestDriver, testCase6, TEST_TYPES);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'setValue' AND 'insertBulk'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'setValue' AND 'insertBulk'" << endl
+                          << "===========================" << endl;
+
+        RUN_EACH_TYPE(TestDriver, testCase5, TEST_TYPES);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'erase', 'eraseBulk', AND 'clear'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'erase', 'eraseBulk', AND 'clear'" << endl
+                          << "=================================" << endl;
+
+        RUN_EACH_TYPE(TestDriver, testCase4, TEST_TYPES);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'insert', 'getValue', 'size', AND 'empty'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'insert', 'getValue', 'size', AND 'empty'"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        RUN_EACH_TYPE(TestDriver, testCase3, TEST_TYPES);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        RUN_EACH_TYPE(TestDriver, testCase2, TEST_TYPES);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up, update, visit, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            bdlcc::FlatHashMap<int, int> mX(&sa);
+            const bdlcc::FlatHashMap<int, int>& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(1 == mX.insert(1, 10));
+            ASSERT(1 == mX.insert(2, 20));
+            ASSERT(0 == mX.insert(1, 11));
+            ASSERT(2 == X.size());
+
+            int value;
+            ASSERT(1  == X.getValue(&value, 1));
+            ASSERT(11 == value);
+            ASSERT(0  == X.getValue(&value, 3));
+
+            ASSERT(1 == mX.setValue(2, 21));
+            ASSERT(1 == X.getValue(&value, 2));
+            ASSERT(21 == value);
+
+            ASSERT(1 == mX.erase(1));
+            ASSERT(0 == mX.erase(1));
+            ASSERT(1 == X.size());
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH 'bdlcc::StripedUnorderedMap'
+        //
+        // Concerns:
+        //: 1 'bdlcc::FlatHashMap' uses less memory and is faster than
+        //:   'bdlcc::StripedUnorderedMap' for small, trivially copyable keys
+        //:   and values.
+        //
+        // Plan:
+        //: 1 For both containers, mapping 'int' to 'Int64', measure the
+        //:   memory used by 'numKeys' elements, the time to insert and look
+        //:   up each key, and the throughput of 'numThreads' threads doing a
+        //:   mix of 'getValue' and 'setValue'.
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH 'bdlcc::StripedUnorderedMap'
+        //
+        // Arguments (all optional):
+        //   numKeys      = 1000000
+        //   numThreads   = 4
+        //   numStripes   = 16
+        //   writePercent = 10
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE COMPARISON WITH 'bdlcc::StripedUnorderedMap'"
+             << endl
+             << "========================================================"
+             << endl;
+
+        const int numKeys      = argc > 2 ? atoi(argv[2]) : 1000000;
+        const int numThreads   = argc > 3 ? atoi(argv[3]) : 4;
+        const int numStripes   = argc > 4 ? atoi(argv[4]) : 16;
+        const int writePercent = argc > 5 ? atoi(argv[5]) : 10;
+
+        P_(numKeys); P_(numThreads); P_(numStripes); P(writePercent);
+
+        perf::runBenchmark<bdlcc::FlatHashMap<int, Int64> >(
+                                                            "FlatHashMap",
+                                                            numKeys,
+                                                            numThreads,
+                                                            numStripes,
+                                                            writePercent);
+        perf::runBenchmark<bdlcc::StripedUnorderedMap<int, Int64> >(
+                                                        "StripedUnorderedMap",
+                                                          numKeys,
+                                                          numThreads,
+                                                          numStripes,
+                                                          writePercent);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the global allocator.
+
+        ASSERT(gam.isTotalSame());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -19,6 +19,99 @@ BSLS_IDENT_RCSID(bdlcc_stripedunorderedcontainerimpl,"$Id$ $CSID$")
 // table, but the stripes are locked one at a time.
 //
 // The number of stripes must not be bigger than the number of buckets.
+//
+// In read-optimized mode, readers do not lock the stripes; the safety of their
+// traversal rests on three rules:
+//
+//: o A node is published (i.e., linked into a bucket) with a release store
+//:   only once fully constructed, and is never modified afterward, except for
+//:   its link to the next node.  Updates create a replacement node.
+//:
+//: o A node unlinked from its bucket is not deleted until every reader that
+//:   was registered in 'StripedUnorderedContainerImpl_ReadEpoch' when it was
+//:   unlinked has left.  Unlinking does not modify the link of the unlinked
+//:   node, so that a reader positioned on it continues into the live list.
+//:
+//: o 'rehash' and 'clear', which move or delete nodes and reallocate the
+//:   bucket array, increment 'd_numReadSuspensions' and then call
+//:   'synchronize'.  A reader registers before checking
+//:   'd_numReadSuspensions' (both operations being sequentially consistent),
+//:   so either the reader observes the suspension and takes the locked path,
+//:   or 'synchronize' observes the reader and waits for it.
+//
+// 'StripedUnorderedContainerImpl_ReadEpoch' is a two-parity reader-count
+// scheme: a reader increments the counter, for the current epoch parity, of
+// the slot of its thread, and re-reads the epoch to verify that it did not
+// change in the meantime.  'synchronize' increments the epoch and waits for
+// all the counters of the previous parity to drop to zero.  Since calls to
+// 'synchronize' are serialized, and each waits for its previous parity to
+// drain, readers of the new parity all registered after the increment.
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+              // ---------------------------------------------
+              // class StripedUnorderedContainerImpl_ReadEpoch
+              // ---------------------------------------------
+
+// CREATORS
+StripedUnorderedContainerImpl_ReadEpoch::
+                                       StripedUnorderedContainerImpl_ReadEpoch(
+                                              bool              enabled,
+                                              bslma::Allocator *basicAllocator)
+: d_epoch(0)
+, d_epochPad()
+, d_slots_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    (void)d_epochPad;
+
+    if (enabled) {
+        d_slots_p = static_cast<Slot *>(
+                         d_allocator_p->allocate(k_NUM_SLOTS * sizeof(Slot)));
+        for (int i = 0; i < k_NUM_SLOTS; ++i) {
+            new (d_slots_p + i) Slot();
+        }
+    }
+}
+
+StripedUnorderedContainerImpl_ReadEpoch::
+                                     ~StripedUnorderedContainerImpl_ReadEpoch()
+{
+    if (d_slots_p) {
+        for (int i = 0; i < k_NUM_SLOTS; ++i) {
+            BSLS_ASSERT(0 == d_slots_p[i].d_count[0].loadRelaxed());
+            BSLS_ASSERT(0 == d_slots_p[i].d_count[1].loadRelaxed());
+
+            d_slots_p[i].~Slot();
+        }
+        d_allocator_p->deallocate(d_slots_p);
+    }
+}
+
+// MANIPULATORS
+void StripedUnorderedContainerImpl_ReadEpoch::synchronize()
+{
+    BSLS_ASSERT(d_slots_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    const int parity = (d_epoch.add(1) - 1) & 1;
+
+    for (int i = 0; i < k_NUM_SLOTS; ++i) {
+        while (0 != d_slots_p[i].d_count[parity].load()) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
@@ -90,6 +90,39 @@ BSLS_IDENT("$Id: $")
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Read-Optimized Mode
+///-------------------
+// By default ('e_READ_LOCKED'), 'getValue' and 'visitReadOnly(key, visitor)'
+// acquire the read lock of the stripe holding 'key'.  Even uncontended, that
+// acquisition writes to the cache line of the lock, so that readers of the
+// same stripe running on different cores serialize on that cache line.  A
+// container constructed with 'e_READ_OPTIMIZED' instead lets those methods
+// traverse the bucket without taking any lock, while all manipulators still
+// take the stripe's write lock:
+//
+//: o Manipulators never modify an element in place: a new value (or the
+//:   result of a visitor) is stored in a newly allocated node that replaces
+//:   the old one in the bucket, and removed or replaced nodes are *retired*
+//:   rather than deleted.
+//:
+//: o Lock-free readers register themselves, for the duration of a lookup, in
+//:   one of a fixed number of cache-line-padded reader slots, chosen by
+//:   thread id.  Retired nodes are deleted in batches, after waiting for all
+//:   readers that may still reference them to finish (epoch-based
+//:   reclamation).
+//:
+//: o 'rehash' and 'clear' first wait for in-flight lock-free readers to
+//:   finish and, until they complete, direct new readers to the locked path.
+//
+// The read-optimized mode therefore trades more expensive updates (an
+// allocation per 'setValue', 'setComputedValue', and 'visit' of an existing
+// element) for reads that scale with the number of reading threads.  The
+// full-container 'visitReadOnly(visitor)' method locks each stripe in turn in
+// both modes.  The read-optimized mode requires 'VALUE' to be
+// copy-constructible.  Note that, on C++03 platforms, a 'VALUE' type that is
+// not copy-constructible must specialize 'bsl::is_copy_constructible' (see
+// 'bslmf_iscopyconstructible') to be usable with this component.
+//
 ///Usage
 ///-----
 // There is no usage example for this component since it is not meant for
@@ -112,11 +145,16 @@ BSLS_IDENT("$Id: $")
 #include <bslma_rawdeleterproctor.h>
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_integralconstant.h>
+#include <bslmf_iscopyconstructible.h>
 #include <bslmf_movableref.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_readerwritermutex.h>
 #include <bslmt_readlockguard.h>
+#include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
@@ -155,11 +193,15 @@ class StripedUnorderedContainerImpl;
 template <class KEY, class VALUE>
 class StripedUnorderedContainerImpl_Node {
     // This class template represents a node in the singly-linked list of
-    // '(KEY, VALUE)' elements for each bucket of a hash map.
+    // '(KEY, VALUE)' elements for each bucket of a hash map.  The link to the
+    // next node is published with release semantics and read with acquire
+    // semantics, so that a lock-free reader observing a node also observes
+    // its fully constructed key and value.
 
   private:
     // DATA
-    mutable StripedUnorderedContainerImpl_Node *d_next_p;
+    bsls::AtomicPointer<StripedUnorderedContainerImpl_Node>
+                                       d_next_p;
         // Pointer to next element of the bucket
 
     bsls::ObjectBuffer<KEY>            d_key;
@@ -212,9 +254,6 @@ class StripedUnorderedContainerImpl_Node {
         // Destroy this object.
 
     // MANIPULATORS
-    StripedUnorderedContainerImpl_Node **nextAddress();
-        // Return the address of the pointer to the next node.
-
     void setNext(StripedUnorderedContainerImpl_Node *nextPtr);
         // Set this node's pointer-to-next-node to the specified 'nextPtr'.
 
@@ -256,7 +295,8 @@ class StripedUnorderedContainerImpl_Bucket {
         // movable references.
 
     // DATA
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *d_head_p;
+    bsls::AtomicPointer<StripedUnorderedContainerImpl_Node<KEY, VALUE> >
+                                           d_head_p;
         // Pointer to the first element in the bucket
 
     StripedUnorderedContainerImpl_Node<KEY, VALUE> *d_tail_p;
@@ -314,13 +354,20 @@ class StripedUnorderedContainerImpl_Bucket {
     void clear();
         // Empty 'StripedUnorderedContainerImpl_Bucket' and delete all nodes.
 
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> **headAddress();
-        // Return the address of the head (node) of this bucket list.
-
     void incrementSize(int amount);
         // Increment the 'size' attribute of this bucket by the specified
         // 'amount'.
 
+    void replaceNode(StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevPtr,
+                     StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr,
+                     StripedUnorderedContainerImpl_Node<KEY, VALUE> *newPtr);
+        // Replace, in this bucket, the specified 'nodePtr' node, that follows
+        // the specified 'prevPtr' node (or is the head if 'prevPtr' is 0),
+        // with the specified 'newPtr' node.  The next node of 'nodePtr' is
+        // left unchanged, so that a concurrent lock-free reader positioned on
+        // 'nodePtr' can continue its traversal.  Note that 'nodePtr' is not
+        // deleted.
+
     void setHead(StripedUnorderedContainerImpl_Node<KEY, VALUE> *value);
         // Set the address of the head of this bucket list to the specified
         // 'value'.
@@ -332,6 +379,14 @@ class StripedUnorderedContainerImpl_Bucket {
         // Set the pointer of the tail of this bucket list to the specified
         // 'value'.
 
+    void unlinkNode(StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevPtr,
+                    StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr);
+        // Remove from this bucket the specified 'nodePtr' node, that follows
+        // the specified 'prevPtr' node (or is the head if 'prevPtr' is 0).
+        // The next node of 'nodePtr' is left unchanged, so that a concurrent
+        // lock-free reader positioned on 'nodePtr' can continue its
+        // traversal.  Note that 'nodePtr' is not deleted.
+
     template <class EQUAL>
     bsl::size_t setValue(const KEY&   key,
                          const EQUAL& equal,
@@ -391,6 +446,166 @@ class StripedUnorderedContainerImpl_Bucket {
         // to allocate memory.
 };
 
+              // =============================================
+              // class StripedUnorderedContainerImpl_ReadEpoch
+              // =============================================
+
+class StripedUnorderedContainerImpl_ReadEpoch {
+    // This class provides the reader registration and grace-period detection
+    // used by the read-optimized mode of 'StripedUnorderedContainerImpl'.  A
+    // reader brackets each lock-free traversal with 'enter' and 'leave'; a
+    // writer calls 'synchronize' to wait until every traversal that may have
+    // observed memory it has since unlinked has completed.  Readers are
+    // counted in a fixed number of cache-line-padded slots, selected by thread
+    // id, so that readers on different cores rarely write to the same cache
+    // line.  Each slot has two counters, one per *parity* of the epoch:
+    // 'synchronize' advances the epoch and then waits only for the counters
+    // of the previous parity to drain, so that a continuous stream of new
+    // readers cannot delay it indefinitely.
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_SLOTS_LOG2 = 6,
+        k_NUM_SLOTS      = 1 << k_NUM_SLOTS_LOG2,
+        // Number of reader slots
+
+    #if BSLS_PLATFORM_CPU_X86 || BSLS_PLATFORM_CPU_X86_64
+        k_PREFETCH_ENABLED = 1,
+    #else
+        k_PREFETCH_ENABLED = 0,
+    #endif
+        // Can be 0 or 1; if prefetch, we use 2 cachelines at a time
+        k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
+                                            bslmt::Platform::e_CACHE_LINE_SIZE,
+        // Cacheline size to use; may be 1 or 2 cachelines
+        k_INT_PADDING  = k_EFFECTIVE_CACHELINE_SIZE - sizeof(bsls::AtomicInt),
+        k_SLOT_PADDING = k_EFFECTIVE_CACHELINE_SIZE -
+                                                  2 * sizeof(bsls::AtomicInt)
+    };
+
+    // PRIVATE TYPES
+    struct Slot {
+        // Reader counts of one slot, padded to the cacheline size.
+
+        // DATA
+        bsls::AtomicInt d_count[2];  // # of readers for each epoch parity
+        char            d_pad[k_SLOT_PADDING];
+    };
+
+    // DATA
+    bsls::AtomicInt   d_epoch;
+        // current epoch; its parity selects the counter used by new readers
+
+    const char        d_epochPad[k_INT_PADDING];
+        // padding, so that 'd_epoch' will have its own cache line
+
+    Slot             *d_slots_p;
+        // array of 'k_NUM_SLOTS' reader slots, or 0 if not enabled
+
+    bslmt::Mutex      d_mutex;
+        // serializes 'synchronize'
+
+    bslma::Allocator *d_allocator_p;
+        // memory allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    StripedUnorderedContainerImpl_ReadEpoch(
+                               const StripedUnorderedContainerImpl_ReadEpoch&);
+                                                                    // = delete
+    StripedUnorderedContainerImpl_ReadEpoch& operator=(
+                               const StripedUnorderedContainerImpl_ReadEpoch&);
+                                                                    // = delete
+
+    // PRIVATE CLASS METHODS
+    static int slotIndex();
+        // Return the index of the reader slot of the calling thread.
+
+  public:
+    // CREATORS
+    explicit StripedUnorderedContainerImpl_ReadEpoch(
+                                        bool              enabled,
+                                        bslma::Allocator *basicAllocator = 0);
+        // Create a 'StripedUnorderedContainerImpl_ReadEpoch' object.  If the
+        // specified 'enabled' is 'true', allocate the reader slots; otherwise,
+        // the object allocates no memory and only 'isEnabled' may be called.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~StripedUnorderedContainerImpl_ReadEpoch();
+        // Destroy this object.  The behavior is undefined unless no reader is
+        // registered.
+
+    // MANIPULATORS
+    int enter();
+        // Register the calling thread as a reader in the current epoch, and
+        // return a token to be passed to 'leave'.  The behavior is undefined
+        // unless 'isEnabled()'.
+
+    void leave(int token);
+        // Unregister the reader identified by the specified 'token' returned
+        // by 'enter'.  Memory reads performed by the reader between 'enter'
+        // and 'leave' happen before the return of any 'synchronize' call that
+        // waits for it.
+
+    void synchronize();
+        // Block until every reader registered before this call has called
+        // 'leave'.  Readers registering after the start of this call do not
+        // delay it.  The behavior is undefined unless 'isEnabled()', and if
+        // the calling thread is itself registered as a reader.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if this object was created enabled, and 'false'
+        // otherwise.
+};
+
+           // ==================================================
+           // class StripedUnorderedContainerImpl_ReadEpochGuard
+           // ==================================================
+
+class StripedUnorderedContainerImpl_ReadEpochGuard {
+    // A guard pattern on 'StripedUnorderedContainerImpl_ReadEpoch', to leave
+    // the epoch on exception.
+
+  private:
+    // DATA
+    StripedUnorderedContainerImpl_ReadEpoch *d_readEpoch_p;
+        // Guarded epoch, or 0 if none or released
+
+    int                                      d_token;
+        // token returned by 'enter'
+
+    // NOT IMPLEMENTED
+    StripedUnorderedContainerImpl_ReadEpochGuard(
+                          const StripedUnorderedContainerImpl_ReadEpochGuard&);
+                                                                    // = delete
+    StripedUnorderedContainerImpl_ReadEpochGuard& operator=(
+                          const StripedUnorderedContainerImpl_ReadEpochGuard&);
+                                                                    // = delete
+
+  public:
+    // CREATORS
+    explicit StripedUnorderedContainerImpl_ReadEpochGuard(
+                               StripedUnorderedContainerImpl_ReadEpoch *epoch);
+        // Create a guard object that registers the calling thread as a reader
+        // of the specified 'epoch', and unregisters it on destruction.  If
+        // 'epoch' is 0, this guard has no effect.
+
+    ~StripedUnorderedContainerImpl_ReadEpochGuard();
+        // Release the guarded object.
+
+    // MANIPULATORS
+    void release();
+        // Release the guarded object.
+
+    // ACCESSORS
+    bool isActive() const;
+        // Return 'true' if this guard holds a reader registration, and
+        // 'false' otherwise.
+};
+
 template <class KEY,
           class VALUE,
           class HASH  = bsl::hash<KEY>,
@@ -417,6 +632,14 @@ class StripedUnorderedContainerImpl {
         k_DEFAULT_NUM_STRIPES  =  4  // Default # of stripes
     };
 
+    enum ReadMode {
+        // Enumeration of the synchronization used by the 'getValue' and
+        // 'visitReadOnly(key, visitor)' methods (see {Read-Optimized Mode}).
+
+        e_READ_LOCKED = 0,  // Readers take the read lock of the stripe.
+        e_READ_OPTIMIZED    // Readers traverse the bucket without locking.
+    };
+
     typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
         // Node in a bucket.
 
@@ -452,6 +675,10 @@ class StripedUnorderedContainerImpl {
     static const int k_REHASH_IN_PROGRESS = 1; // d_state bit 0
     static const int k_REHASH_ENABLED     = 2; // d_state bit 1
 
+    static const bsl::size_t k_RETIRE_BATCH_SIZE = 64;
+        // number of retired nodes accumulated before they are deleted, in
+        // read-optimized mode
+
     // PRIVATE TYPES
     enum {
     #if BSLS_PLATFORM_CPU_X86 || BSLS_PLATFORM_CPU_X86_64
@@ -490,6 +717,9 @@ class StripedUnorderedContainerImpl {
     typedef StripedUnorderedContainerImpl_LockElement           LockElement;
     typedef StripedUnorderedContainerImpl_LockElementReadGuard  LERGuard;
     typedef StripedUnorderedContainerImpl_LockElementWriteGuard LEWGuard;
+    typedef StripedUnorderedContainerImpl_ReadEpoch             ReadEpoch;
+    typedef StripedUnorderedContainerImpl_ReadEpochGuard        REGuard;
+    typedef StripedUnorderedContainerImpl_Bucket<KEY, VALUE>    Bucket;
 
     // DATA
     bsl::size_t                       d_numStripes;
@@ -525,6 +755,28 @@ class StripedUnorderedContainerImpl {
     const char                        d_numElementsPad[k_INT_PADDING];
         // padding, so that 'd_numElements' will have its own cache line
 
+    bsls::AtomicInt                   d_numReadSuspensions;
+        // # of operations (i.e., 'rehash' and 'clear') in progress that
+        // require lock-free readers to take the stripe locks instead
+
+    const char                        d_numReadSuspensionsPad[k_INT_PADDING];
+        // padding, so that 'd_numReadSuspensions' will have its own cache
+        // line
+
+    const ReadMode                    d_readMode;
+        // synchronization of 'getValue' and 'visitReadOnly(key, visitor)'
+
+    mutable ReadEpoch                 d_readEpoch;
+        // registration of lock-free readers; enabled only in read-optimized
+        // mode
+
+    bslmt::Mutex                      d_retiredMutex;
+        // protects 'd_retired'
+
+    bsl::vector<Node *>               d_retired;
+        // nodes unlinked in read-optimized mode, awaiting deletion; its
+        // capacity is reserved at construction
+
     bsl::vector<StripedUnorderedContainerImpl_Bucket<KEY,VALUE> >
                                       d_buckets;
         // hash table data, storing key-value pairs
@@ -565,6 +817,13 @@ class StripedUnorderedContainerImpl {
         // Perform a rehash if the 'loadFactor() > maxLoadFactor()', and
         // 'true == canRehash()'.
 
+    Node *cloneNode(const Node& node, bsl::true_type);
+    Node *cloneNode(const Node& node, bsl::false_type);
+        // Return a newly allocated node having the key and value of the
+        // specified 'node', and no next node.  The second parameter is
+        // 'bsl::is_copy_constructible<VALUE>'.  The behavior is undefined
+        // if 'VALUE' is not copy-constructible.
+
     bsl::size_t erase(const KEY& key, Scope scope);
         // Remove from this hash map the element, if any, having the specified
         // 'key'.  If there a multiple elements having 'key' and the specified
@@ -637,6 +896,16 @@ class StripedUnorderedContainerImpl {
         // having 'key', the selection of "first" is unspecified and subject to
         // change.
 
+    void resumeLockFreeReads();
+        // End the suspension of lock-free reads started by the matching call
+        // to 'suspendLockFreeReads'.  This method has no effect unless this
+        // container is in read-optimized mode.
+
+    void retireNode(Node *node);
+        // Delete the specified 'node', that has been unlinked from its
+        // bucket.  In read-optimized mode, defer the deletion until no
+        // lock-free reader may still reference 'node'.
+
     int setComputedValue(const KEY&             key,
                          const VisitorFunction& visitor,
                          Scope                  scope);
@@ -684,6 +953,42 @@ class StripedUnorderedContainerImpl {
         // note that specifying 'e_SCOPE_FIRST' is more performant when there
         // is a single element in the bucket having 'key'.
 
+    bsl::size_t setValueCopyOnWrite(Bucket       *bucket,
+                                    const KEY&    key,
+                                    const VALUE&  value,
+                                    Scope         scope);
+    bsl::size_t setValueCopyOnWrite(Bucket                   *bucket,
+                                    const KEY&                key,
+                                    bslmf::MovableRef<VALUE>  value);
+        // Set the value attribute of the element in the specified 'bucket'
+        // having the specified 'key' to the specified 'value', as the
+        // corresponding 'StripedUnorderedContainerImpl_Bucket::setValue'
+        // method does, optionally specifying a 'scope' (the default is
+        // 'e_SCOPE_FIRST').  Rather than assigning to an element, replace it
+        // by a new node and retire the old node.  The behavior is undefined
+        // unless this container is in read-optimized mode and the stripe of
+        // 'bucket' is locked for write.
+
+    void suspendLockFreeReads();
+        // Direct new readers to the locked path, and wait for lock-free
+        // readers in progress to complete, so that the caller may restructure
+        // the buckets once it holds the stripe locks.  This method has no
+        // effect unless this container is in read-optimized mode.
+
+    bool visitNode(Bucket                 *bucket,
+                   Node                  **nodePtr,
+                   Node                   *prevPtr,
+                   const KEY&              key,
+                   const VisitorFunction&  visitor);
+        // Invoke the specified 'visitor' on the value of the node at the
+        // specified '*nodePtr', that follows the specified 'prevPtr' node (or
+        // is the head if 'prevPtr' is 0) in the specified 'bucket', and the
+        // specified 'key', and return the value returned by 'visitor'.  In
+        // read-optimized mode, 'visitor' is applied to a copy of the node
+        // that then replaces the node in 'bucket', '*nodePtr' is set to the
+        // new node, and the old node is retired.  The behavior is undefined
+        // unless the stripe of 'bucket' is locked for write.
+
     // PRIVATE ACCESSORS
     bsl::size_t bucketIndex(const KEY& key, bsl::size_t numBuckets) const;
         // Return the index of the bucket, in the array of buckets maintained
@@ -709,6 +1014,16 @@ class StripedUnorderedContainerImpl {
         // Return the address to the lock-element associated with the returned
         // 'bucketIdx'.
 
+    LockElement *lockReadIfNeeded(bsl::size_t *bucketIdx,
+                                  REGuard     *readerGuard,
+                                  const KEY&   key) const;
+        // Set the specified 'bucketIdx' to the bucket index associated with
+        // the specified 'key'.  If the specified 'readerGuard' holds a reader
+        // registration and lock-free reads are not suspended, return 0.
+        // Otherwise, release 'readerGuard', lock for read the stripe related
+        // to 'key', and return the address to its lock-element.  The buckets
+        // may be traversed without a lock if and only if 0 is returned.
+
     LockElement *lockWrite(bsl::size_t *bucketIdx, const KEY& key) const;
         // Lock for write the stripe related to the specified 'key', setting
         // the specified 'bucketIdx' to the bucket index associated with 'key'.
@@ -730,6 +1045,21 @@ class StripedUnorderedContainerImpl {
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.  The hash map has rehash enabled.
 
+    StripedUnorderedContainerImpl(bsl::size_t       numInitialBuckets,
+                                  bsl::size_t       numStripes,
+                                  ReadMode          readMode,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'StripedUnorderedContainerImpl' object having the
+        // specified 'numInitialBuckets' minimum number of buckets, the
+        // specified (fixed) 'numStripes' number of stripes, and using the
+        // specified 'readMode' synchronization for 'getValue' and
+        // 'visitReadOnly(key, visitor)' (see {Read-Optimized Mode}).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The hash map has rehash enabled.  The behavior is undefined
+        // if 'e_READ_OPTIMIZED == readMode' and 'VALUE' is not
+        // copy-constructible.
+
     ~StripedUnorderedContainerImpl();
         // Destroy this hash map.  This method is *not* thread-safe.
 
@@ -1049,6 +1379,10 @@ class StripedUnorderedContainerImpl {
     bsl::size_t numStripes() const;
         // Return the number of stripes in the hash.
 
+    ReadMode readMode() const;
+        // Return the synchronization used by 'getValue' and
+        // 'visitReadOnly(key, visitor)' in this hash map.
+
     int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
         // Call the specified 'visitor' (in an unspecified order) on the
         // elements in this hash table until each element has been visited or
@@ -1352,20 +1686,12 @@ StripedUnorderedContainerImpl_Node<KEY, VALUE>::
 
 
 // MANIPULATORS
-template <class KEY, class VALUE>
-inline
-StripedUnorderedContainerImpl_Node<KEY, VALUE> **
-                  StripedUnorderedContainerImpl_Node<KEY, VALUE>::nextAddress()
-{
-    return &d_next_p;
-}
-
 template <class KEY, class VALUE>
 inline
 void StripedUnorderedContainerImpl_Node<KEY, VALUE>::setNext(
                        StripedUnorderedContainerImpl_Node<KEY, VALUE> *nextPtr)
 {
-    d_next_p = nextPtr;
+    d_next_p.storeRelease(nextPtr);
 }
 
 template <class KEY, class VALUE>
@@ -1388,7 +1714,7 @@ inline
 StripedUnorderedContainerImpl_Node<KEY, VALUE> *
                    StripedUnorderedContainerImpl_Node<KEY, VALUE>::next() const
 {
-    return d_next_p;
+    return d_next_p.loadAcquire();
 }
 
 template <class KEY, class VALUE>
@@ -1432,12 +1758,12 @@ StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::
            bslmf::MovableRef<StripedUnorderedContainerImpl_Bucket<KEY, VALUE> >
                                                                       original,
            bslma::Allocator                                          *)
-: d_head_p(MoveUtil::move(MoveUtil::access(original).d_head_p))
+: d_head_p(MoveUtil::access(original).d_head_p.loadRelaxed())
 , d_tail_p(MoveUtil::move(MoveUtil::access(original).d_tail_p))
 , d_size(  MoveUtil::access(original).d_size)
 , d_allocator_p(MoveUtil::access(original).d_allocator_p)
 {
-    MoveUtil::access(original).d_head_p = NULL;
+    MoveUtil::access(original).d_head_p.storeRelaxed(NULL);
     MoveUtil::access(original).d_tail_p = NULL;
     MoveUtil::access(original).d_size   = 0;
 }
@@ -1458,8 +1784,8 @@ void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::addNode(
 {
     BSLS_ASSERT(nodePtr->next() == NULL);
 
-    if (d_head_p == NULL) {
-        d_head_p = nodePtr;
+    if (head() == NULL) {
+        setHead(nodePtr);
     }
     else {
         d_tail_p->setNext(nodePtr);
@@ -1473,32 +1799,49 @@ inline
 void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::clear()
 {
     // Delete all content in a loop
-    for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
+    for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = head();
                                                             curNode != NULL;) {
         StripedUnorderedContainerImpl_Node<KEY, VALUE> *nextPtr =
                                                                curNode->next();
         d_allocator_p->deleteObject(curNode);
         curNode = nextPtr;
     }
-    d_head_p = NULL;
+    setHead(NULL);
     d_tail_p = NULL;
     d_size = 0;
 }
 
 template <class KEY, class VALUE>
 inline
-StripedUnorderedContainerImpl_Node<KEY, VALUE>
-              **StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::headAddress()
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::incrementSize(
+                                                                    int amount)
 {
-    return &d_head_p;
+    d_size += amount;
 }
 
 template <class KEY, class VALUE>
 inline
-void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::incrementSize(
-                                                                    int amount)
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::replaceNode(
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevPtr,
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr,
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *newPtr)
 {
-    d_size += amount;
+    BSLS_ASSERT(nodePtr);
+    BSLS_ASSERT(newPtr);
+    BSLS_ASSERT(prevPtr ? prevPtr->next() == nodePtr : head() == nodePtr);
+
+    // 'newPtr' must be complete before it is published.
+
+    newPtr->setNext(nodePtr->next());
+    if (prevPtr) {
+        prevPtr->setNext(newPtr);
+    }
+    else {
+        setHead(newPtr);
+    }
+    if (d_tail_p == nodePtr) {
+        d_tail_p = newPtr;
+    }
 }
 
 template <class KEY, class VALUE>
@@ -1506,7 +1849,7 @@ inline
 void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setHead(
                          StripedUnorderedContainerImpl_Node<KEY, VALUE> *value)
 {
-    d_head_p = value;
+    d_head_p.storeRelease(value);
 }
 
 template <class KEY, class VALUE>
@@ -1525,6 +1868,27 @@ void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setTail(
     d_tail_p = value;
 }
 
+template <class KEY, class VALUE>
+inline
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::unlinkNode(
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevPtr,
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr)
+{
+    BSLS_ASSERT(nodePtr);
+    BSLS_ASSERT(prevPtr ? prevPtr->next() == nodePtr : head() == nodePtr);
+
+    if (prevPtr) {
+        prevPtr->setNext(nodePtr->next());
+    }
+    else {
+        setHead(nodePtr->next());
+    }
+    if (d_tail_p == nodePtr) {
+        d_tail_p = prevPtr;
+    }
+    --d_size;
+}
+
 template <class KEY, class VALUE>
 template <class EQUAL>
 bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
@@ -1533,19 +1897,19 @@ bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
                                                             const VALUE& value,
                                                             BucketScope  scope)
 {
-    if (d_head_p == NULL) {
-        d_head_p = new (*d_allocator_p)
+    if (head() == NULL) {
+        d_tail_p = new (*d_allocator_p)
                                 StripedUnorderedContainerImpl_Node<KEY, VALUE>(
                                                                 key,
                                                                 value,
                                                                 NULL,
                                                                 d_allocator_p);
-        d_tail_p = d_head_p;
+        setHead(d_tail_p);
         d_size = 1;
         return 0;                                                     // RETURN
     }
 
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = head();
     int                                             count   = 0;
     for (; curNode != NULL; curNode = curNode->next()) {
         if (equal(curNode->key(), key)) {
@@ -1578,18 +1942,18 @@ bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
                                                 const EQUAL&             equal,
                                                 bslmf::MovableRef<VALUE> value)
 {
-    if (d_head_p == NULL) {
-        d_head_p = new (*d_allocator_p)
+    if (head() == NULL) {
+        d_tail_p = new (*d_allocator_p)
                                 StripedUnorderedContainerImpl_Node<KEY, VALUE>(
                                             key,
                                             bslmf::MovableRefUtil::move(value),
                                             NULL,
                                             d_allocator_p);
-        d_tail_p = d_head_p;
+        setHead(d_tail_p);
         d_size = 1;
         return 0;                                                     // RETURN
     }
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = head();
     for (; curNode != NULL; curNode = curNode->next()) {
         if (equal(curNode->key(), key)) {
 #if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
@@ -1625,7 +1989,7 @@ inline
 StripedUnorderedContainerImpl_Node<KEY, VALUE>
                 *StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::head() const
 {
-    return d_head_p;
+    return d_head_p.loadAcquire();
 }
 
 template <class KEY, class VALUE>
@@ -1653,6 +2017,102 @@ bslma::Allocator *StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::allocator()
     return d_allocator_p;
 }
 
+              // ---------------------------------------------
+              // class StripedUnorderedContainerImpl_ReadEpoch
+              // ---------------------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+int StripedUnorderedContainerImpl_ReadEpoch::slotIndex()
+{
+    // Thread ids are frequently aligned addresses, so use the high bits of a
+    // multiplicative hash of the id.
+
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<int>((bslmt::ThreadUtil::selfIdAsUint64() *
+                             k_MULTIPLIER) >> (64 - k_NUM_SLOTS_LOG2));
+}
+
+// MANIPULATORS
+inline
+int StripedUnorderedContainerImpl_ReadEpoch::enter()
+{
+    BSLS_ASSERT(d_slots_p);
+
+    Slot& slot = d_slots_p[slotIndex()];
+
+    // The increment of the counter must be ordered before the following
+    // reads of the epoch, and of the data protected by it; sequentially
+    // consistent operations are used for both.  If the epoch changed after it
+    // was read, 'synchronize' may already have scanned this slot: retry in the
+    // new epoch.
+
+    for (;;) {
+        const int parity = d_epoch.load() & 1;
+        slot.d_count[parity].add(1);
+        if ((d_epoch.load() & 1) == parity) {
+            return (static_cast<int>(&slot - d_slots_p) << 1) | parity;
+                                                                      // RETURN
+        }
+        slot.d_count[parity].addRelaxed(-1);
+    }
+}
+
+inline
+void StripedUnorderedContainerImpl_ReadEpoch::leave(int token)
+{
+    BSLS_ASSERT(d_slots_p);
+    BSLS_ASSERT(0 <= token && token < 2 * k_NUM_SLOTS);
+
+    d_slots_p[token >> 1].d_count[token & 1].addAcqRel(-1);
+}
+
+// ACCESSORS
+inline
+bool StripedUnorderedContainerImpl_ReadEpoch::isEnabled() const
+{
+    return 0 != d_slots_p;
+}
+
+           // --------------------------------------------------
+           // class StripedUnorderedContainerImpl_ReadEpochGuard
+           // --------------------------------------------------
+
+// CREATORS
+inline
+StripedUnorderedContainerImpl_ReadEpochGuard::
+                                  StripedUnorderedContainerImpl_ReadEpochGuard(
+                                StripedUnorderedContainerImpl_ReadEpoch *epoch)
+: d_readEpoch_p(epoch)
+, d_token(epoch ? epoch->enter() : 0)
+{
+}
+
+inline
+StripedUnorderedContainerImpl_ReadEpochGuard::
+                                ~StripedUnorderedContainerImpl_ReadEpochGuard()
+{
+    release();
+}
+
+// MANIPULATORS
+inline
+void StripedUnorderedContainerImpl_ReadEpochGuard::release()
+{
+    if (d_readEpoch_p) {
+        d_readEpoch_p->leave(d_token);
+        d_readEpoch_p = NULL;
+    }
+}
+
+// ACCESSORS
+inline
+bool StripedUnorderedContainerImpl_ReadEpochGuard::isActive() const
+{
+    return 0 != d_readEpoch_p;
+}
+
              // -----------------------------------------------
              // class StripedUnorderedContainerImpl_LockElement
              // -----------------------------------------------
@@ -1808,6 +2268,31 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::checkRehash()
     }
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedContainerImpl_Node<KEY, VALUE> *
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::cloneNode(
+                                                         const Node& node,
+                                                         bsl::true_type)
+{
+    return new (*d_allocator_p) Node(node.key(),
+                                     node.value(),
+                                     NULL,
+                                     d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedContainerImpl_Node<KEY, VALUE> *
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::cloneNode(
+                                                         const Node&,
+                                                         bsl::false_type)
+{
+    BSLS_ASSERT_INVOKE_NORETURN(
+                 "read-optimized mode requires copy-constructible 'VALUE'");
+    return NULL;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
                                                               const KEY& key,
@@ -1824,17 +2309,13 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
 
     bsl::size_t count = 0;
 
-    Node **prevNodeAddress = bucket.headAddress();
-    Node  *prevNode        = NULL;
-    while (*prevNodeAddress) {
-        Node *node = *prevNodeAddress;
+    Node *prevNode = NULL;
+    Node *node     = bucket.head();
+    while (node) {
+        Node *nextNode = node->next();
         if (d_comparator(node->key(), key)) {
-            *prevNodeAddress = node->next();
-            if (bucket.tail() == node) {
-                bucket.setTail(prevNode);
-            }
-            d_allocator_p->deleteObject(node);
-            bucket.incrementSize(-1);
+            bucket.unlinkNode(prevNode, node);
+            retireNode(node);
             d_numElements.addRelaxed(-1);
             ++count;
             if (!eraseAll) {
@@ -1842,9 +2323,9 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
             }
         }
         else {
-            prevNode        = node;
-            prevNodeAddress = node->nextAddress();
+            prevNode = node;
         }
+        node = nextNode;
     }
     return count;
 }
@@ -1896,17 +2377,13 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
 
             const KEY& key  = first[dataIdx];
 
-            Node **prevNodeAddress = bucket.headAddress();
-            Node  *prevNode        = NULL;
-            while (*prevNodeAddress) {
-                Node *node = *prevNodeAddress;
+            Node *prevNode = NULL;
+            Node *node     = bucket.head();
+            while (node) {
+                Node *nextNode = node->next();
                 if (d_comparator(node->key(), key)) {
-                    *prevNodeAddress = node->next();
-                    if (bucket.tail() == node) {
-                        bucket.setTail(prevNode);
-                    }
-                    d_allocator_p->deleteObject(node);
-                    bucket.incrementSize(-1);
+                    bucket.unlinkNode(prevNode, node);
+                    retireNode(node);
                     d_numElements.addRelaxed(-1);
                     ++count;
                     if (!eraseAll) {
@@ -1914,9 +2391,9 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
                     }
                 }
                 else {
-                    prevNode        = node;
-                    prevNodeAddress = node->nextAddress();
+                    prevNode = node;
                 }
+                node = nextNode;
             }
         }
     }
@@ -1946,6 +2423,12 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
                                                                 d_allocator_p);
         d_buckets[bucketIdx].addNode(node);
     }
+    else if (e_READ_OPTIMIZED == d_readMode) {
+        ret = setValueCopyOnWrite(&d_buckets[bucketIdx],
+                                  key,
+                                  value,
+                                  e_SCOPE_FIRST);
+    }
     else {
         // Update only the first value if key exists.  Use only in hash map.
         ret = d_buckets[bucketIdx].setValue(
@@ -1982,6 +2465,11 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
             Node(key, bslmf::MovableRefUtil::move(value), NULL, d_allocator_p);
         d_buckets[bucketIdx].addNode(node);
     }
+    else if (e_READ_OPTIMIZED == d_readMode) {
+        ret = setValueCopyOnWrite(&d_buckets[bucketIdx],
+                                  key,
+                                  bslmf::MovableRefUtil::move(value));
+    }
     else {
         // Update only the first value if key exists.  Use only in hash map.
         ret = d_buckets[bucketIdx].setValue(
@@ -2057,12 +2545,18 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
                 ++count;
                 d_numElements.addRelaxed(1);
             } else {
-                bsl::size_t ret = d_buckets[bucketIdx].setValue(
-                    key,
-                    d_comparator,
-                    value,
-                    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::
-                                                          e_BUCKETSCOPE_FIRST);
+                bsl::size_t ret = e_READ_OPTIMIZED == d_readMode
+                                ? setValueCopyOnWrite(&d_buckets[bucketIdx],
+                                                      key,
+                                                      value,
+                                                      e_SCOPE_FIRST)
+                                : d_buckets[bucketIdx].setValue(
+                                      key,
+                                      d_comparator,
+                                      value,
+                                      StripedUnorderedContainerImpl_Bucket<
+                                          KEY,
+                                          VALUE>::e_BUCKETSCOPE_FIRST);
                 if (ret == 0) {
                     ++count;
                     d_numElements.addRelaxed(1);
@@ -2074,6 +2568,40 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
     return count;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::resumeLockFreeReads()
+{
+    if (e_READ_OPTIMIZED == d_readMode) {
+        d_numReadSuspensions.add(-1);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::retireNode(
+                                                                    Node *node)
+{
+    if (e_READ_LOCKED == d_readMode) {
+        d_allocator_p->deleteObject(node);
+        return;                                                       // RETURN
+    }
+
+    // The capacity of 'd_retired' is 'k_RETIRE_BATCH_SIZE', and it is emptied
+    // whenever it fills up, so 'push_back' does not allocate.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredMutex);
+
+    d_retired.push_back(node);
+    if (d_retired.size() == k_RETIRE_BATCH_SIZE) {
+        d_readEpoch.synchronize();
+        for (bsl::size_t i = 0; i < d_retired.size(); ++i) {
+            d_allocator_p->deleteObject(d_retired[i]);
+        }
+        d_retired.clear();
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setComputedValue(
                                                 const KEY&             key,
@@ -2091,11 +2619,12 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setComputedValue(
     StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
                                                           d_buckets[bucketIdx];
     // Loop on the elements in the list
-    int                                             count = 0;
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
-    for (; curNode != NULL; curNode = curNode->next()) {
+    int   count    = 0;
+    Node *prevNode = NULL;
+    Node *curNode  = bucket.head();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
         if (d_comparator(curNode->key(), key)) {
-            bool ret = visitor(&curNode->value(), key);
+            bool ret = visitNode(&bucket, &curNode, prevNode, key, visitor);
             if (false == setAll) {
                 return ret ? 1 : -1;                                  // RETURN
             }
@@ -2158,7 +2687,9 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValue(
     StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
                                                           d_buckets[bucketIdx];
 
-    bsl::size_t count = bucket.setValue(key, d_comparator, value, setAll);
+    bsl::size_t count = e_READ_OPTIMIZED == d_readMode
+                      ? setValueCopyOnWrite(&bucket, key, value, scope)
+                      : bucket.setValue(key, d_comparator, value, setAll);
     if (count == 0) {
         guard.release();
         d_numElements.addRelaxed(1);
@@ -2167,6 +2698,112 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValue(
     return count;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValueCopyOnWrite(
+                                                         Bucket       *bucket,
+                                                         const KEY&    key,
+                                                         const VALUE&  value,
+                                                         Scope         scope)
+{
+    BSLS_ASSERT(e_READ_OPTIMIZED == d_readMode);
+
+    bsl::size_t  count    = 0;
+    Node        *prevNode = NULL;
+    Node        *curNode  = bucket->head();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
+        if (d_comparator(curNode->key(), key)) {
+            Node *newNode = new (*d_allocator_p) Node(curNode->key(),
+                                                      value,
+                                                      NULL,
+                                                      d_allocator_p);
+            bucket->replaceNode(prevNode, curNode, newNode);
+            retireNode(curNode);
+            if (e_SCOPE_FIRST == scope) {
+                return 1;                                             // RETURN
+            }
+            ++count;
+            curNode = newNode;
+        }
+    }
+    if (count > 0) {
+        return count;                                                 // RETURN
+    }
+    bucket->addNode(new (*d_allocator_p) Node(key,
+                                              value,
+                                              NULL,
+                                              d_allocator_p));
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValueCopyOnWrite(
+                                             Bucket                   *bucket,
+                                             const KEY&                key,
+                                             bslmf::MovableRef<VALUE>  value)
+{
+    BSLS_ASSERT(e_READ_OPTIMIZED == d_readMode);
+
+    Node *prevNode = NULL;
+    Node *curNode  = bucket->head();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
+        if (d_comparator(curNode->key(), key)) {
+            Node *newNode = new (*d_allocator_p) Node(
+                                            curNode->key(),
+                                            bslmf::MovableRefUtil::move(value),
+                                            NULL,
+                                            d_allocator_p);
+            bucket->replaceNode(prevNode, curNode, newNode);
+            retireNode(curNode);
+            return 1;                                                 // RETURN
+        }
+    }
+    bucket->addNode(new (*d_allocator_p) Node(
+                                            key,
+                                            bslmf::MovableRefUtil::move(value),
+                                            NULL,
+                                            d_allocator_p));
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::suspendLockFreeReads()
+{
+    if (e_READ_OPTIMIZED == d_readMode) {
+        d_numReadSuspensions.add(1);
+        d_readEpoch.synchronize();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitNode(
+                                        Bucket                 *bucket,
+                                        Node                  **nodePtr,
+                                        Node                   *prevPtr,
+                                        const KEY&              key,
+                                        const VisitorFunction&  visitor)
+{
+    if (e_READ_LOCKED == d_readMode) {
+        return visitor(&(*nodePtr)->value(), key);                    // RETURN
+    }
+
+    Node *newNode = cloneNode(**nodePtr,
+                              bsl::is_copy_constructible<VALUE>());
+    bslma::RawDeleterProctor<Node, bslma::Allocator> proctor(newNode,
+                                                             d_allocator_p);
+    bool ret = visitor(&newNode->value(), key);
+    proctor.release();
+
+    bucket->replaceNode(prevPtr, *nodePtr, newNode);
+    retireNode(*nodePtr);
+    *nodePtr = newNode;
+    return ret;
+}
+
 // PRIVATE ACCESSORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
@@ -2211,7 +2848,8 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValueImpl(
     valuesPtr->clear();
 
     bsl::size_t bucketIdx;
-    LERGuard    guard(lockRead(&bucketIdx, key));
+    REGuard     epochGuard(e_READ_OPTIMIZED == d_readMode ? &d_readEpoch : 0);
+    LERGuard    guard(lockReadIfNeeded(&bucketIdx, &epochGuard, key));
 
     bsl::size_t                                             count  = 0;
     const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = d_buckets[
@@ -2251,6 +2889,29 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockRead(
     return &lockElement;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedContainerImpl_LockElement *
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockReadIfNeeded(
+                                                  bsl::size_t  *bucketIdx,
+                                                  REGuard      *readerGuard,
+                                                  const KEY&    key) const
+{
+    BSLS_ASSERT(readerGuard);
+
+    // The reader is registered in 'd_readEpoch' before checking for a
+    // suspension, so a subsequent 'rehash' or 'clear' waits for it to leave.
+
+    if (readerGuard->isActive() && 0 == d_numReadSuspensions.load()) {
+        *bucketIdx = bslalg::HashTableImpUtil::computeBucketIndex(
+                                                                d_hasher(key),
+                                                                d_numBuckets);
+        return NULL;                                                  // RETURN
+    }
+    readerGuard->release();
+    return lockRead(bucketIdx, key);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 StripedUnorderedContainerImpl_LockElement *
@@ -2292,12 +2953,61 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
 , d_comparator()
 , d_statePad()
 , d_numElementsPad()
+, d_numReadSuspensions(0)
+, d_numReadSuspensionsPad()
+, d_readMode(e_READ_LOCKED)
+, d_readEpoch(false, basicAllocator)
+, d_retiredMutex()
+, d_retired(basicAllocator)
+, d_buckets(d_numBuckets, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
+    d_numElements = 0; // Hash empty
+
+    // Allocate array of 'LockElement' objects, and construct them.
+    d_locks_p = reinterpret_cast<LockElement*>(
+                  d_allocator_p->allocate(d_numStripes * sizeof(LockElement)));
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        bslma::ConstructionUtil::construct(&d_locks_p[i], d_allocator_p);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
+                                                 StripedUnorderedContainerImpl(
+                                           bsl::size_t       numInitialBuckets,
+                                           bsl::size_t       numStripes,
+                                           ReadMode          readMode,
+                                           bslma::Allocator *basicAllocator)
+: d_numStripes(powerCeil(numStripes))
+, d_numBuckets(adjustBuckets(numInitialBuckets, d_numStripes))
+, d_hashMask(d_numStripes - 1)
+, d_maxLoadFactor(1.0)
+, d_hasher()
+, d_comparator()
+, d_statePad()
+, d_numElementsPad()
+, d_numReadSuspensions(0)
+, d_numReadSuspensionsPad()
+, d_readMode(readMode)
+, d_readEpoch(e_READ_OPTIMIZED == readMode, basicAllocator)
+, d_retiredMutex()
+, d_retired(basicAllocator)
 , d_buckets(d_numBuckets, basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    BSLS_ASSERT(e_READ_LOCKED == readMode || e_READ_OPTIMIZED == readMode);
+    BSLS_ASSERT(e_READ_LOCKED == readMode
+             || bsl::is_copy_constructible<VALUE>::value);
+
     d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
     d_numElements = 0; // Hash empty
 
+    if (e_READ_OPTIMIZED == d_readMode) {
+        d_retired.reserve(k_RETIRE_BATCH_SIZE);
+    }
+
     // Allocate array of 'LockElement' objects, and construct them.
     d_locks_p = reinterpret_cast<LockElement*>(
                   d_allocator_p->allocate(d_numStripes * sizeof(LockElement)));
@@ -2311,6 +3021,9 @@ inline
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
                                                ~StripedUnorderedContainerImpl()
 {
+    for (bsl::size_t i = 0; i < d_retired.size(); ++i) {
+        d_allocator_p->deleteObject(d_retired[i]);
+    }
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         bslma::DestructionUtil::destroy(&d_locks_p[i]);
     }
@@ -2322,6 +3035,9 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::clear()
 {
+    // Lock-free readers are drained first, as the nodes are deleted directly.
+    suspendLockFreeReads();
+
     // Locking all stripes will inherently block until a rehash will complete
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].lockW();
@@ -2333,6 +3049,8 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::clear()
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].unlockW();
     }
+
+    resumeLockFreeReads();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2511,6 +3229,10 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehash(
                                                                 numBuckets,
                                                                 d_allocator_p);
 
+    // Nodes are relinked in place and 'd_buckets' is replaced, so lock-free
+    // readers are drained first and diverted to the locked path meanwhile.
+    suspendLockFreeReads();
+
     // Main loop on stripes: lock a stripe and process all buckets in it
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].lockW();
@@ -2552,6 +3274,8 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehash(
         d_locks_p[i].unlockW();
     }
 
+    resumeLockFreeReads();
+
     // Rehash no longer in progress
     d_state = d_state & ~k_REHASH_IN_PROGRESS;
 }
@@ -2609,7 +3333,11 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValueFirst(
     StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
                                                           d_buckets[bucketIdx];
 
-    bsl::size_t count = bucket.setValue(key,
+    bsl::size_t count = e_READ_OPTIMIZED == d_readMode
+                      ? setValueCopyOnWrite(&bucket,
+                                            key,
+                                            bslmf::MovableRefUtil::move(value))
+                      : bucket.setValue(key,
                                         d_comparator,
                                         bslmf::MovableRefUtil::move(value));
     if (count == 0) {
@@ -2645,11 +3373,16 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visit(
             StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
                                                                   d_buckets[j];
             // Loop on the nodes in the bucket.
-            for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
-                                                bucket.head(); curNode != NULL;
-                                                   curNode = curNode->next()) {
+            Node *prevNode = NULL;
+            for (Node *curNode = bucket.head();
+                 curNode != NULL;
+                 prevNode = curNode, curNode = curNode->next()) {
                 ++count;
-                bool ret = visitor(&(curNode->value()), curNode->key());
+                bool ret = visitNode(&bucket,
+                                     &curNode,
+                                     prevNode,
+                                     curNode->key(),
+                                     visitor);
                 if (!ret) {
                     d_locks_p[i].unlockW();
                     return -count;                                    // RETURN
@@ -2674,12 +3407,13 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visit(
                                                           d_buckets[bucketIdx];
 
     // Loop on the elements in the list
-    int                                             count = 0;
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
-    for (; curNode != NULL; curNode = curNode->next()) {
+    int   count    = 0;
+    Node *prevNode = NULL;
+    Node *curNode  = bucket.head();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
         if (d_comparator(curNode->key(), key)) {
             ++count;
-            bool ret = visitor(&curNode->value(), key);
+            bool ret = visitNode(&bucket, &curNode, prevNode, key, visitor);
             if (ret == false) {
                 return -count;                                        // RETURN
             }
@@ -2752,7 +3486,8 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
     BSLS_ASSERT(NULL != value);
 
     bsl::size_t bucketIdx;
-    LERGuard    guard(lockRead(&bucketIdx, key));
+    REGuard     epochGuard(e_READ_OPTIMIZED == d_readMode ? &d_readEpoch : 0);
+    LERGuard    guard(lockReadIfNeeded(&bucketIdx, &epochGuard, key));
 
     const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = d_buckets[
                                                                     bucketIdx];
@@ -2837,6 +3572,14 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::numStripes() const
     return static_cast<bsl::size_t>(d_numStripes);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::ReadMode
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::readMode() const
+{
+    return d_readMode;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
                                   const ReadOnlyVisitorFunction& visitor) const
@@ -2876,7 +3619,8 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
                                   const ReadOnlyVisitorFunction& visitor) const
 {
     bsl::size_t bucketIdx;
-    LERGuard    guard(lockRead(&bucketIdx, key));
+    REGuard     epochGuard(e_READ_OPTIMIZED == d_readMode ? &d_readEpoch : 0);
+    LERGuard    guard(lockReadIfNeeded(&bucketIdx, &epochGuard, key));
 
     const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
                                                           d_buckets[bucketIdx];
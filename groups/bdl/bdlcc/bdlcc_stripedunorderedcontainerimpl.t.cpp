@@ -8,6 +8,8 @@
 
 #include <bdlb_random.h>
 #include <bdlb_randomdevice.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
 
 #include <bslim_testutil.h>
 #include <bslmt_threadutil.h>
@@ -86,7 +88,7 @@ using namespace bsl;
 // other types in special cases.
 //
 // Single-threaded behavior is tested in test cases [1 .. 19].  Multi-threaded
-// issues are addressed in test cases [20 .. 22].  Two techniques are used:
+// issues are addressed in test cases [20 .. 23].  Two techniques are used:
 //
 //: 1 The component defines a component "private" class, a 'friend' of the hash
 //:   map, that allows users to explicitly lock and unlock specified stripes.
@@ -107,6 +109,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] StripedUnorderedContainerImpl(numInitialBuckets, numStripes, *ba);
+// [23] StripedUnorderedContainerImpl(numBuckets, numStripes, mode, *ba);
 // [ 2] ~StripedUnorderedContainerImpl();
 //
 // MANIPULATORS
@@ -148,6 +151,7 @@ using namespace bsl;
 // [15] float loadFactor() const;
 // [15] float maxLoadFactor() const;
 // [ 4] bsl::size_t numStripes() const;
+// [23] ReadMode readMode() const;
 // [ 4] bsl::size_t size() const;
 // [19] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
 // [19] int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&) const;
@@ -159,6 +163,7 @@ using namespace bsl;
 // [20] LOCKING TEST UTIL
 // [21] LOCKING
 // [22] MULTI-THREADED STRESS TEST
+// [23] READ-OPTIMIZED MODE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -262,6 +267,12 @@ typedef bsltf::TemplateTestFacility TstFacility;
 
 }  // close unnamed namespace
 
+namespace bsl {
+template <>
+struct is_copy_constructible<BloombergLP::bsltf::NonCopyConstructibleTestType>
+        : bsl::false_type {};
+}  // close namespace bsl
+
 
 namespace testLock {
 
@@ -1167,6 +1178,382 @@ void threadedTest1()
             initialNumBuckets < finalNumBuckets);
 }
 
+                      // ===========================
+                      // read-optimized mode helpers
+                      // ===========================
+
+const int k_RO_VALUE_LENGTH = 32;
+    // Minimum length of a value stored by the read-optimized tests; long
+    // enough to defeat the short string optimization.
+
+bsl::string makeValue(int key, int version, bslma::Allocator *allocator)
+    // Return a string, using the specified 'allocator', whose characters are
+    // all derived from the specified 'key' and whose length is derived from
+    // the specified 'version'.
+{
+    return bsl::string(k_RO_VALUE_LENGTH + version % 8,
+                       static_cast<char>('a' + key % 26),
+                       allocator);
+}
+
+bool isValidValue(const bsl::string& value, int key)
+    // Return 'true' if the specified 'value' was produced by 'makeValue' for
+    // the specified 'key', and 'false' otherwise.
+{
+    if (value.size() < static_cast<bsl::size_t>(k_RO_VALUE_LENGTH) ||
+        value.size() >= static_cast<bsl::size_t>(k_RO_VALUE_LENGTH + 8)) {
+        return false;                                                 // RETURN
+    }
+    const char c = static_cast<char>('a' + key % 26);
+    for (bsl::size_t i = 0; i < value.size(); ++i) {
+        if (value[i] != c) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool appendVisitor(bsl::string *value, const int& key)
+    // Grow the specified 'value' by one character derived from the specified
+    // 'key', wrapping back to the minimum length.  Return 'true'.
+{
+    if (value->empty()) {
+        *value = makeValue(key, 0, value->get_allocator().mechanism());
+    }
+    else if (value->size() + 1 >= k_RO_VALUE_LENGTH + 8u) {
+        value->resize(k_RO_VALUE_LENGTH);
+    }
+    else {
+        value->push_back(static_cast<char>('a' + key % 26));
+    }
+    return true;
+}
+
+bool checkVisitor(bsls::AtomicInt    *numErrors,
+                  const bsl::string&  value,
+                  const int&          key)
+    // Increment the specified 'numErrors' unless the specified 'value' is
+    // valid for the specified 'key'.  Return 'true'.
+{
+    if (!isValidValue(value, key)) {
+        ++*numErrors;
+    }
+    return true;
+}
+
+struct ReadOptimizedArg {
+    typedef bdlcc::StripedUnorderedContainerImpl<int, bsl::string> StripType;
+
+    StripType       *d_strip_p;
+    bsls::AtomicInt *d_stop_p;
+    bsls::AtomicInt *d_numErrors_p;
+    bsls::AtomicInt *d_numReads_p;
+    int              d_numItems;
+    int              d_threadId;
+};
+
+extern "C" void *readOptimizedReader(void *v_arg)
+    // Repeatedly look up random keys in the container described by the
+    // specified 'v_arg', and count the values found that are not valid.
+{
+    ReadOptimizedArg *arg = static_cast<ReadOptimizedArg *>(v_arg);
+
+    int         seed = arg->d_threadId * 7919 + 1;
+    int         numReads = 0;
+    bsl::string value;
+    const bsl::function<bool(const bsl::string&, const int&)> visitor(
+              bdlf::BindUtil::bind(&checkVisitor,
+                                   arg->d_numErrors_p,
+                                   bdlf::PlaceHolders::_1,
+                                   bdlf::PlaceHolders::_2));
+
+    while (0 == *arg->d_stop_p) {
+        int key = bdlb::Random::generate15(&seed) % arg->d_numItems;
+        if (key & 1) {
+            if (1 == arg->d_strip_p->getValue(&value, key) &&
+                !isValidValue(value, key)) {
+                ++*arg->d_numErrors_p;
+            }
+        }
+        else {
+            int rc = arg->d_strip_p->visitReadOnly(key, visitor);
+            if (rc < 0 || rc > 1) {
+                ++*arg->d_numErrors_p;
+            }
+        }
+        ++numReads;
+    }
+    arg->d_numReads_p->add(numReads);
+    return v_arg;
+}
+
+extern "C" void *readOptimizedWriter(void *v_arg)
+    // Repeatedly update, visit, erase, and re-insert random keys in the
+    // container described by the specified 'v_arg', occasionally rehashing.
+{
+    ReadOptimizedArg *arg = static_cast<ReadOptimizedArg *>(v_arg);
+
+    bslma::Allocator *allocator = arg->d_strip_p->allocator();
+    int               seed      = arg->d_threadId * 104729 + 3;
+    int               version   = 0;
+
+    while (0 == *arg->d_stop_p) {
+        int key = bdlb::Random::generate15(&seed) % arg->d_numItems;
+        switch (bdlb::Random::generate15(&seed) % 8) {
+          case 0: {
+            arg->d_strip_p->eraseFirst(key);
+          } break;
+          case 1: {
+            arg->d_strip_p->insertUnique(key,
+                                         makeValue(key, ++version, allocator));
+          } break;
+          case 2: {
+            arg->d_strip_p->setComputedValueFirst(key, &appendVisitor);
+          } break;
+          case 3: {
+            arg->d_strip_p->visit(key, &appendVisitor);
+          } break;
+          case 4: {
+            if (0 == arg->d_threadId &&
+                0 == bdlb::Random::generate15(&seed) % 64) {
+                const bsl::size_t numBuckets = arg->d_strip_p->bucketCount();
+                arg->d_strip_p->rehash(numBuckets > 64 ? 16
+                                                       : numBuckets * 2);
+            }
+          } break;
+          default: {
+            ++version;
+            arg->d_strip_p->setValueFirst(key,
+                                          makeValue(key, version, allocator));
+          } break;
+        }
+    }
+    return v_arg;
+}
+
+void readOptimizedTest()
+    // Test the read-optimized mode.
+{
+    // ------------------------------------------------------------------------
+    // READ-OPTIMIZED MODE
+    //   The read-optimized mode lets 'getValue' and 'visitReadOnly(key, ...)'
+    //   run without locks, relying on copy-on-write updates and deferred
+    //   reclamation of replaced and removed nodes.
+    //
+    // Concerns:
+    //: 1 The mode supplied at construction is reported by 'readMode', and
+    //:   the default is 'e_READ_LOCKED'.
+    //:
+    //: 2 All manipulators and accessors behave as in the locked mode,
+    //:   including when more nodes are retired than fit in a single batch.
+    //:
+    //: 3 Lock-free readers running concurrently with 'setValue',
+    //:   'setComputedValue', 'visit', 'erase', 'insert', and 'rehash' never
+    //:   observe a partially updated or deleted value.
+    //:
+    //: 4 All memory, including retired nodes, is returned to the allocator.
+    //
+    // Plan:
+    //: 1 Construct objects in each mode and verify 'readMode'.  (C-1)
+    //:
+    //: 2 Using a read-optimized object with 'bsl::string' values, apply
+    //:   every manipulator many times and verify the content with
+    //:   'getValue', 'visitReadOnly', and 'size'.  (C-2)
+    //:
+    //: 3 Run reader threads validating every value found, while writer
+    //:   threads update, erase, insert, and rehash.  Freed memory is
+    //:   scribbled by the test allocator, so that use-after-free shows up as
+    //:   an invalid value.  (C-3)
+    //:
+    //: 4 Verify that the test allocator has no outstanding blocks after the
+    //:   objects are destroyed.  (C-4)
+    //
+    // Testing:
+    //   StripedUnorderedContainerImpl(numBuckets, numStripes, mode, *ba);
+    //   ReadMode readMode() const;
+    //   READ-OPTIMIZED MODE
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "READ-OPTIMIZED MODE" << endl
+                      << "-------------------" << endl;
+
+    typedef ReadOptimizedArg::StripType Obj;
+
+    bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+
+    if (verbose) cout << "\nTesting 'readMode'." << endl;
+    {
+        Obj mX(16, 4, &supplied);
+        ASSERT(Obj::e_READ_LOCKED == mX.readMode());
+
+        Obj mY(16, 4, Obj::e_READ_LOCKED, &supplied);
+        ASSERT(Obj::e_READ_LOCKED == mY.readMode());
+
+        Obj mZ(16, 4, Obj::e_READ_OPTIMIZED, &supplied);
+        ASSERT(Obj::e_READ_OPTIMIZED == mZ.readMode());
+        ASSERT(16 == mZ.bucketCount());
+        ASSERT( 4 == mZ.numStripes());
+    }
+    ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+
+    if (verbose) cout << "\nTesting manipulators." << endl;
+    {
+        const int k_NUM_ITEMS = 100;
+
+        Obj mX(16, 4, Obj::e_READ_OPTIMIZED, &supplied);  const Obj& X = mX;
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            ASSERTV(i, 1 == mX.insertUnique(i, makeValue(i, 0, &supplied)));
+        }
+        ASSERTV(X.size(), k_NUM_ITEMS == X.size());
+        ASSERTV(X.bucketCount(), 16 < X.bucketCount());
+
+        // Replace every value several times, retiring many batches of nodes.
+
+        for (int v = 1; v < 5; ++v) {
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                ASSERTV(v, i, 1 == mX.setValueFirst(i,
+                                                 makeValue(i, v, &supplied)));
+            }
+        }
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            bsl::string value;
+            ASSERTV(i, 1 == X.getValue(&value, i));
+            ASSERTV(i, makeValue(i, 4, &supplied) == value);
+        }
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            ASSERTV(i, 1 == mX.setComputedValueFirst(i, &appendVisitor));
+            ASSERTV(i, 1 == mX.visit(i, &appendVisitor));
+        }
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            bsl::string value;
+            ASSERTV(i, 1 == X.getValue(&value, i));
+            ASSERTV(i, makeValue(i, 6, &supplied) == value);
+        }
+
+        ASSERTV(k_NUM_ITEMS == mX.visit(&appendVisitor));
+
+        bsls::AtomicInt numErrors(0);
+        const bsl::function<bool(const bsl::string&, const int&)> visitor(
+                                bdlf::BindUtil::bind(&checkVisitor,
+                                                     &numErrors,
+                                                     bdlf::PlaceHolders::_1,
+                                                     bdlf::PlaceHolders::_2));
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            ASSERTV(i, 1 == X.visitReadOnly(i, visitor));
+        }
+        ASSERTV(k_NUM_ITEMS == X.visitReadOnly(visitor));
+        ASSERTV(numErrors, 0 == numErrors);
+
+        for (int i = 0; i < k_NUM_ITEMS; i += 2) {
+            ASSERTV(i, 1 == mX.eraseFirst(i));
+        }
+        ASSERTV(X.size(), k_NUM_ITEMS / 2 == X.size());
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            bsl::string value;
+            ASSERTV(i, (i & 1) == static_cast<int>(X.getValue(&value, i)));
+        }
+
+        mX.rehash(4 * X.bucketCount());
+        for (int i = 1; i < k_NUM_ITEMS; i += 2) {
+            bsl::string value;
+            ASSERTV(i, 1 == X.getValue(&value, i));
+            ASSERTV(i, isValidValue(value, i));
+        }
+
+        // Multiple values per key.
+
+        mX.insertAlways(1, makeValue(1, 1, &supplied));
+        mX.insertAlways(1, makeValue(1, 2, &supplied));
+        ASSERTV(3 == mX.setValueAll(1, makeValue(1, 3, &supplied)));
+        {
+            bsl::vector<bsl::string> values(&supplied);
+            ASSERTV(3 == X.getValue(&values, 1));
+            for (bsl::size_t j = 0; j < values.size(); ++j) {
+                ASSERTV(j, makeValue(1, 3, &supplied) == values[j]);
+            }
+        }
+        ASSERTV(3 == mX.setComputedValueAll(1, &appendVisitor));
+        ASSERTV(3 == mX.eraseAll(1));
+
+        mX.clear();
+        ASSERTV(X.size(), 0 == X.size());
+        bsl::string value;
+        ASSERTV(0 == X.getValue(&value, 3));
+
+        mX.insertUnique(3, makeValue(3, 0, &supplied));
+        ASSERTV(1 == X.getValue(&value, 3));
+    }
+    ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+
+    if (verbose) cout << "\nMulti-threaded stress test." << endl;
+    {
+        const int k_NUM_READERS = 6;
+        const int k_NUM_WRITERS = 3;
+        const int k_NUM_THREADS = k_NUM_READERS + k_NUM_WRITERS;
+        const int k_NUM_ITEMS   = 64;
+
+        bslma::TestAllocator ta("stress", veryVeryVeryVerbose);
+        {
+            Obj mX(16, 4, Obj::e_READ_OPTIMIZED, &ta);
+
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                mX.insertUnique(i, makeValue(i, 0, &ta));
+            }
+
+            bsls::AtomicInt stop(0);
+            bsls::AtomicInt numErrors(0);
+            bsls::AtomicInt numReads(0);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            ReadOptimizedArg          args[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ReadOptimizedArg arg = { &mX,
+                                         &stop,
+                                         &numErrors,
+                                         &numReads,
+                                         k_NUM_ITEMS,
+                                         i < k_NUM_WRITERS
+                                         ? i
+                                         : i - k_NUM_WRITERS };
+                args[i] = arg;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                                &handles[i],
+                                                i < k_NUM_WRITERS
+                                                ? readOptimizedWriter
+                                                : readOptimizedReader,
+                                                &args[i]));
+            }
+
+            bslmt::ThreadUtil::microSleep(0, 2);
+
+            stop = 1;
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            ASSERTV(numErrors, 0 == numErrors);
+            ASSERTV(numReads, 0 < numReads);
+
+            if (veryVerbose) {
+                P_(numReads) P_(mX.size()) P(mX.bucketCount());
+            }
+
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                bsl::string value;
+                if (1 == mX.getValue(&value, i)) {
+                    ASSERTV(i, value, isValidValue(value, i));
+                }
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+    }
+}
+
 }  // close namespace threaded
 
 // TestDriver template
@@ -9474,6 +9861,9 @@ int main(int argc, char *argv[])
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
+      case 23: {
+        threaded::readOptimizedTest();
+      } break;
       case 22: {
         threaded::threadedTest1();
       } break;
@@ -89,7 +89,8 @@ using namespace bsl;
 // special cases.
 //
 // Single-threaded behavior is tested in test cases [1 .. 18].  Multi-threaded
-// issues are addressed in test cases 19.
+// issues are addressed in test cases 19.  The read-optimized mode is tested in
+// test case 22.
 //
 // As this component simply forwards its methods to
 // 'bdlcc:StripedUnorderedImpl', we simply need to test that the various
@@ -113,6 +114,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] StripedUnorderedMap(numInitialBuckets, numStripes, *basicAllocator);
+// [22] StripedUnorderedMap(numBuckets, numStripes, readMode, *ba);
 // [ 2] ~StripedUnorderedMap();
 //
 // MANIPULATORS
@@ -145,6 +147,7 @@ using namespace bsl;
 // [14] float loadFactor() const;
 // [14] float maxLoadFactor() const;
 // [ 4] bsl::size_t numStripes() const;
+// [22] ReadMode readMode() const;
 // [ 4] bsl::size_t size() const;
 // [18] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
 // [18] int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&) const;
@@ -152,7 +155,8 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [22] USAGE EXAMPLE
+// [23] USAGE EXAMPLE
+// [22] READ-OPTIMIZED MODE
 // [21] DRQS 169188100: ALLOCATOR AWARE DEFAULT CONSTRUCTION
 // [15] TYPE TRAITS
 // [19] MULTI-THREADED STRESS TEST
@@ -161,6 +165,7 @@ using namespace bsl;
 // [-2] PERFORMANCE TEST STRING->INT64
 // [-4] READ WRITE PERFORMANCE
 // [-8] READ/WRITE PERFORMANCE TEST WITH LONG KEY
+// [-9] READ-SCALING BENCHMARK
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -511,6 +516,23 @@ void example3()
 namespace {
 typedef bsltf::TemplateTestFacility TstFacility;
 
+bool isLong(const bsl::string& value, const int&)
+    // Return 'true' if the specified 'value' is too long for the short string
+    // optimization, and 'false' otherwise.
+{
+    return value.size() > 20;
+}
+
+bool truncateValue(bsl::string *value, const int&)
+    // Truncate the specified 'value' to its first character, if any.  Return
+    // 'true'.
+{
+    if (value->size() > 1) {
+        value->resize(1);
+    }
+    return true;
+}
+
 }  // close unnamed namespace
 
 
@@ -6540,6 +6562,13 @@ class HBenchmark {
   public:
     typedef bdlcc::StripedUnorderedMap<KEY, VAL> MapType;
 
+    enum {
+        k_MAX_THREADS    = 128,  // Maximal thread index of the '*Spread'
+                                 // test functions
+        k_CURSOR_STRIDE  =  16   // Distance, in 'int's, between the cursors
+                                 // of two threads (one cache line)
+    };
+
   private:
     // DATA
     int               d_numStripes;  // # of stripes in input.  0 - use the
@@ -6548,13 +6577,24 @@ class HBenchmark {
     int               d_maxSize;     // Maximal number of elements in the map
     bool              d_enblRehash;  // Enable / disable rehash
 
+    typename MapType::ReadMode
+                      d_readMode;    // Read mode of the map
+
     MapType          *d_map_p;       // bdlcc::StripedUnorderedMultiMap
 
     int               d_curValue;    // Internal counter for the pushed value
     int               d_countErr;    // Internal counter for the number of
                                      // tryPopFront errors
+    bsl::vector<int>  d_cursors;     // Per-thread key counters of the
+                                     // '*Spread' test functions, one cache
+                                     // line apart
     bslma::Allocator *d_allocator_p; // memory allocator
 
+    // PRIVATE MANIPULATORS
+    int nextSpreadKey(int cursorIndex);
+        // Return the next key, in '[0 .. maxSize)', for the per-thread cursor
+        // having the specified 'cursorIndex'.
+
     // PRIVATE ACCESSORS
     KEY makeKey(int key) const
         // Return a KEY type from the specified 'key'.
@@ -6618,6 +6658,10 @@ class HBenchmark {
     void cleanupSample(bool);
         // Run after a sample.
 
+    void setReadMode(typename MapType::ReadMode readMode);
+        // Use the specified 'readMode' for the maps created by subsequent
+        // samples.
+
     // ACCESSORS
     int countErr() const;
         // Return the error count accumulated through the run.
@@ -6635,6 +6679,15 @@ class HBenchmark {
     void erase(int);
         // Erase a single element from the hash map. Test type 4
 
+    void findExistSpread(int threadIndex);
+        // Find a single element that exists in the hash map, using a key
+        // sequence private to the specified 'threadIndex', so that threads do
+        // not share any state other than the hash map.
+
+    void setValueSpread(int threadIndex);
+        // Update the value of a single existing element of the hash map, using
+        // a key sequence private to the specified 'threadIndex'.
+
 };  // END class HBenchmark
 
 // CREATORS
@@ -6648,13 +6701,27 @@ HBenchmark<KEY, VAL>::HBenchmark(int               numStripes,
 , d_numBuckets(numBuckets)
 , d_maxSize(maxSize)
 , d_enblRehash(enblRehash)
+, d_readMode(MapType::e_READ_LOCKED)
 , d_map_p(0)
 , d_curValue(0)
 , d_countErr(0)
+, d_cursors(2 * k_MAX_THREADS * k_CURSOR_STRIDE, 0, basicAllocator)
 , d_allocator_p(basicAllocator)
 {
 }
 
+// PRIVATE MANIPULATORS
+template <class KEY, class VAL>
+inline
+int HBenchmark<KEY, VAL>::nextSpreadKey(int cursorIndex)
+{
+    int& cursor = d_cursors[cursorIndex * k_CURSOR_STRIDE];
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(++cursor >= d_maxSize)) {
+        cursor = 0;
+    }
+    return (cursor + cursorIndex * 997) % d_maxSize;
+}
+
 template <class KEY, class VAL>
 void HBenchmark<KEY, VAL>::initializeSample(bool)
 {
@@ -6676,6 +6743,7 @@ void HBenchmark<KEY, VAL>::initializeSampleNoInsert(bool)
     d_map_p = new (*d_allocator_p) MapType(
                                         static_cast<bsl::size_t>(d_numBuckets),
                                         static_cast<bsl::size_t>(d_numStripes),
+                                        d_readMode,
                                         d_allocator_p);
     d_curValue = 0;
     d_countErr = 0;
@@ -6687,6 +6755,12 @@ void HBenchmark<KEY, VAL>::cleanupSample(bool)
     d_allocator_p->deleteObject(d_map_p);
 }
 
+template <class KEY, class VAL>
+void HBenchmark<KEY, VAL>::setReadMode(typename MapType::ReadMode readMode)
+{
+    d_readMode = readMode;
+}
+
 // ACCESSORS
 template <class KEY, class VAL>
 inline
@@ -6749,6 +6823,26 @@ void HBenchmark<KEY, VAL>::erase(int)
         d_curValue = 0;
 }
 
+template <class KEY, class VAL>
+void HBenchmark<KEY, VAL>::findExistSpread(int threadIndex)
+{
+    BSLS_ASSERT(0 <= threadIndex && threadIndex < k_MAX_THREADS);
+
+    KEY         ky = makeKey(nextSpreadKey(threadIndex));
+    VAL         value;
+    bsl::size_t num = d_map_p->getValue(&value, ky);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == num)) ++d_countErr;
+}
+
+template <class KEY, class VAL>
+void HBenchmark<KEY, VAL>::setValueSpread(int threadIndex)
+{
+    BSLS_ASSERT(0 <= threadIndex && threadIndex < k_MAX_THREADS);
+
+    int key = nextSpreadKey(k_MAX_THREADS + threadIndex);
+    d_map_p->setValue(makeKey(key), makeValue(key));
+}
+
 }  // close namespace hPerf
 
 int main(int argc, char *argv[])
@@ -6772,7 +6866,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 22: {
+      case 23: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -6795,6 +6889,123 @@ int main(int argc, char *argv[])
         usage::example3();
 
       } break;
+      case 22: {
+        // --------------------------------------------------------------------
+        // READ-OPTIMIZED MODE
+        //
+        // Concerns:
+        //: 1 The read mode supplied at construction is reported by 'readMode',
+        //:   and the default read mode is 'e_READ_LOCKED'.
+        //:
+        //: 2 The methods of a read-optimized map behave as those of a map
+        //:   constructed with the default read mode.
+        //:
+        //: 3 All memory, including that of replaced and erased elements, is
+        //:   supplied by the specified allocator and is returned on
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 Construct objects with and without a read mode, and verify the
+        //:   value returned by 'readMode'.  (C-1)
+        //:
+        //: 2 For each read mode, apply the same sequence of 'insert',
+        //:   'setValue', 'setComputedValue', 'update', 'erase', 'rehash', and
+        //:   'clear' operations, verifying the state with 'getValue' and
+        //:   'visitReadOnly' after each step.  (C-2)
+        //:
+        //: 3 Use a test allocator, and verify that the default allocator is
+        //:   not used and that no memory is in use after destruction.  (C-3)
+        //
+        // Testing:
+        //   StripedUnorderedMap(numBuckets, numStripes, readMode, *ba);
+        //   ReadMode readMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "READ-OPTIMIZED MODE\n"
+                          << "===================\n";
+
+        typedef bdlcc::StripedUnorderedMap<int, bsl::string> Obj;
+
+        bslma::TestAllocator         supplied("supplied",
+                                              veryVeryVeryVerbose);
+        bslma::TestAllocatorMonitor  dam(&defaultAllocator);
+
+        {
+            Obj mX(&supplied);
+            ASSERT(Obj::e_READ_LOCKED == mX.readMode());
+
+            Obj mY(16, 4, Obj::e_READ_OPTIMIZED, &supplied);
+            ASSERT(Obj::e_READ_OPTIMIZED == mY.readMode());
+            ASSERT(&supplied == mY.allocator());
+        }
+
+        const int NUM_KEYS = 200;
+
+        for (int mode = 0; mode < 2; ++mode) {
+            const Obj::ReadMode READ_MODE = 0 == mode
+                                          ? Obj::e_READ_LOCKED
+                                          : Obj::e_READ_OPTIMIZED;
+            if (veryVerbose) { T_ P(READ_MODE) }
+
+            Obj mX(4, 4, READ_MODE, &supplied);  const Obj& X = mX;
+            ASSERTV(READ_MODE, READ_MODE == X.readMode());
+
+            const bsl::string A("a value long enough to allocate memory",
+                                &supplied);
+            const bsl::string B("another value long enough to allocate",
+                                &supplied);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(READ_MODE, i, 1 == mX.insert(i, A));
+            }
+            ASSERTV(READ_MODE, X.size(), NUM_KEYS == X.size());
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(READ_MODE, i, 1 == mX.setValue(i, B));
+                ASSERTV(READ_MODE, i, 0 == mX.insert(i, A));
+            }
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                bsl::string value(&supplied);
+                ASSERTV(READ_MODE, i, 1 == X.getValue(&value, i));
+                ASSERTV(READ_MODE, i, value, A == value);
+            }
+
+            for (int i = 0; i < NUM_KEYS; i += 2) {
+                ASSERTV(READ_MODE, i, 1 == mX.erase(i));
+            }
+            ASSERTV(READ_MODE, X.size(), NUM_KEYS / 2 == X.size());
+
+            mX.rehash(8 * X.bucketCount());
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                bsl::string value(&supplied);
+                ASSERTV(READ_MODE,
+                        i,
+                        (i % 2) == static_cast<int>(X.getValue(&value, i)));
+            }
+
+            ASSERTV(READ_MODE, NUM_KEYS / 2 == X.visitReadOnly(&isLong));
+            ASSERTV(READ_MODE, 1 == X.visitReadOnly(1, &isLong));
+
+            ASSERTV(READ_MODE, 1 == mX.setComputedValue(1, &truncateValue));
+            ASSERTV(READ_MODE, 1 == mX.update(3, &truncateValue));
+            ASSERTV(READ_MODE, 0 == mX.setComputedValue(0, &truncateValue));
+            {
+                bsl::string value(&supplied);
+                ASSERTV(READ_MODE, 1 == X.getValue(&value, 1));
+                ASSERTV(READ_MODE, value, "a" == value);
+                ASSERTV(READ_MODE, 1 == X.getValue(&value, 3));
+                ASSERTV(READ_MODE, value, "a" == value);
+                ASSERTV(READ_MODE, 1 == X.getValue(&value, 0));
+                ASSERTV(READ_MODE, value, value.empty());
+            }
+
+            mX.clear();
+            ASSERTV(READ_MODE, X.size(), 0 == X.size());
+            ASSERTV(READ_MODE, 1 == mX.insert(5, B));
+        }
+        ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+        ASSERT(dam.isTotalSame());
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // DRQS 169188100: ALLOCATOR AWARE DEFAULT CONSTRUCTION
@@ -7613,6 +7824,147 @@ int main(int argc, char *argv[])
         hp.runTests(&times, args, hashPerf::HashPerformance::testReadWrite2);
         hp.printResult();
       } break;
+      case -9: {
+        // --------------------------------------------------------------------
+        // READ-SCALING BENCHMARK
+        //   Measure how the lookup throughput of the hash map, which is int
+        //   to string, scales with the number of reader threads, in each read
+        //   mode.  To provide control over the test, command line parameters
+        //   are used.
+        //   2nd parameter: maximal number of reader threads; the benchmark is
+        //       run for 1, 2, 4, ... readers up to this number (defaults to
+        //       64).
+        //   3rd parameter: number of writer threads updating existing
+        //       elements concurrently with the readers (defaults to 0).
+        //   4th parameter: number of stripes (defaults to 4).
+        //   5th parameter: number of elements (defaults to 10000).
+        //   6th parameter: number of milliseconds each sample runs (defaults
+        //       to 1000).
+        //   7th parameter: number of samples to run (defaults to 5).
+        //
+        // Concerns:
+        //: 1 Report the throughput percentiles (0%-min, 25%, 50%-median, 75%,
+        //:   and 100%-max) of the reader threads, and of the writer threads
+        //:   if any, for each number of readers and each read mode, so that
+        //:   the scaling of 'e_READ_OPTIMIZED' can be compared with that of
+        //:   'e_READ_LOCKED'.
+        //
+        // Plan:
+        //: 1 For each read mode and number of readers, use
+        //:   'bslmt::ThroughputBenchmark' to run 'findExistSpread' in the
+        //:   reader threads and 'setValueSpread' in the writer threads, on a
+        //:   pre-loaded hash map.  Each thread uses its own key sequence, so
+        //:   that the hash map is the only shared state.  (C-1)
+        //
+        // Testing:
+        //   READ-SCALING BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "READ-SCALING BENCHMARK" << endl
+                 << "======================" << endl;
+
+        bslma::NewDeleteAllocator nalloc;
+
+        typedef hPerf::HBenchmark<int, bsl::string> Bench;
+
+        int maxReaders  = argc > 2 ? atoi(argv[2]) :    64;
+        int numWriters  = argc > 3 ? atoi(argv[3]) :     0;
+        int numStripe   = argc > 4 ? atoi(argv[4]) :     4;
+        int numElements = argc > 5 ? atoi(argv[5]) : 10000;
+        int numMillis   = argc > 6 ? atoi(argv[6]) :  1000;
+        int numSamples  = argc > 7 ? atoi(argv[7]) :     5;
+
+        ASSERTV(maxReaders, 0 < maxReaders);
+        ASSERTV(maxReaders, maxReaders <= Bench::k_MAX_THREADS);
+        ASSERTV(numWriters, numWriters <= Bench::k_MAX_THREADS);
+        ASSERTV(numElements, 0 < numElements);
+        if (testStatus) {
+            break;
+        }
+
+        bsl::cout << "Mode,NR,NW,NS,NE,0%,25%,50%,75%,100%,ErrCount,"
+                     "0%,25%,50%,75%,100%\n";
+
+        for (int mode = 0; mode < 2; ++mode) {
+            typedef Bench::MapType MapType;
+
+            const MapType::ReadMode readMode = 0 == mode
+                                             ? MapType::e_READ_LOCKED
+                                             : MapType::e_READ_OPTIMIZED;
+
+            for (int numReaders = 1; numReaders <= maxReaders;
+                                                             numReaders *= 2) {
+                Bench hb(numStripe,
+                         numElements,
+                         numElements,
+                         false,
+                         &nalloc);
+                hb.setReadMode(readMode);
+
+                bslmt::ThroughputBenchmark       tb(&nalloc);
+                bslmt::ThroughputBenchmarkResult res(&nalloc);
+
+                int tGId1 = tb.addThreadGroup(
+                                  bdlf::BindUtil::bind(&Bench::findExistSpread,
+                                                       &hb,
+                                                       bdlf::PlaceHolders::_1),
+                                  numReaders,
+                                  0);
+                int tGId2 = -1;
+                if (0 < numWriters) {
+                    tGId2 = tb.addThreadGroup(
+                                  bdlf::BindUtil::bind(&Bench::setValueSpread,
+                                                       &hb,
+                                                       bdlf::PlaceHolders::_1),
+                                  numWriters,
+                                  0);
+                }
+
+                typedef bslmt::ThroughputBenchmark::ShutdownSampleFunction
+                                                                    Shutdown;
+
+                tb.execute(&res,
+                           numMillis,
+                           numSamples,
+                           bdlf::BindUtil::bind(&Bench::initializeSample,
+                                                &hb,
+                                                bdlf::PlaceHolders::_1),
+                           Shutdown(),
+                           bdlf::BindUtil::bind(&Bench::cleanupSample,
+                                                &hb,
+                                                bdlf::PlaceHolders::_1));
+
+                vector<double> percentiles(5);
+                res.getPercentiles(&percentiles, tGId1);
+                bsl::cout << bsl::fixed << bsl::setprecision(0)
+                          << (0 == mode ? "LOCKED" : "OPTIMIZED") << ","
+                          << numReaders << "," << numWriters << ","
+                          << numStripe << "," << numElements << ","
+                          << percentiles[0] << ","
+                          << percentiles[1] << ","
+                          << percentiles[2] << ","
+                          << percentiles[3] << ","
+                          << percentiles[4] << ","
+                          << hb.countErr();
+                if (tGId2 >= 0) {
+                    res.getPercentiles(&percentiles, tGId2);
+                    bsl::cout << ","
+                              << percentiles[0] << ","
+                              << percentiles[1] << ","
+                              << percentiles[2] << ","
+                              << percentiles[3] << ","
+                              << percentiles[4];
+                }
+                bsl::cout << "\n";
+
+                if (numReaders < maxReaders && numReaders * 2 > maxReaders) {
+                    numReaders = maxReaders / 2;
+                }
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
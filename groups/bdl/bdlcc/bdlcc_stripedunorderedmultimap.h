@@ -122,6 +122,23 @@ BSLS_IDENT("$Id: $")
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Read-Optimized Mode
+///-------------------
+// A hash multimap constructed with the 'e_READ_OPTIMIZED' read mode performs
+// 'getValueFirst', 'getValueAll', and 'visitReadOnly(key, visitor)' without
+// acquiring any lock, so that lookups from many threads, including lookups of
+// the same key, do not contend on the stripe's lock.  All manipulators still
+// acquire the stripe's write lock, and the semantics of every method are
+// unchanged.  In exchange, an update of an existing element (by
+// 'setValueFirst', 'setValueAll', 'setComputedValueFirst',
+// 'setComputedValueAll', 'update', or 'visit') allocates a new element that
+// replaces the old one, and memory used by removed or replaced elements is
+// released in batches, once no lock-free lookup can still be referencing it.
+// This mode is appropriate for read-mostly workloads, and requires 'VALUE' to
+// be copy-constructible.  A 'visitor' supplied to any method must not call
+// manipulators of the same hash multimap.  See
+// {'bdlcc_stripedunorderedcontainerimpl'|Read-Optimized Mode}.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -260,6 +277,14 @@ class StripedUnorderedMultiMap {
         k_DEFAULT_NUM_STRIPES  =  4  // Default number of stripes
     };
 
+    enum ReadMode {
+        // Enumeration of the synchronization used by lookups (see
+        // {Read-Optimized Mode}).
+
+        e_READ_LOCKED    = Impl::e_READ_LOCKED,    // lookups take stripe lock
+        e_READ_OPTIMIZED = Impl::e_READ_OPTIMIZED  // lookups are lock-free
+    };
+
     // PUBLIC TYPES
     typedef bsl::pair<KEY, VALUE> KVType;
         // Value type of a bulk insert entry.
@@ -306,6 +331,19 @@ class StripedUnorderedMultiMap {
         // stripes will not change after construction, but the number of
         // buckets may (unless rehashing is disabled via 'disableRehash').
 
+    StripedUnorderedMultiMap(bsl::size_t       numInitialBuckets,
+                             bsl::size_t       numStripes,
+                             ReadMode          readMode,
+                             bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'StripedUnorderedMultiMap' object having the
+        // specified 'numInitialBuckets' minimum number of buckets,
+        // 'numStripes' number of stripes, and 'readMode' synchronization of
+        // lookups (see {Read-Optimized Mode}).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The hash
+        // multimap has rehash enabled.  The behavior is undefined unless
+        // 'e_READ_LOCKED == readMode' or 'VALUE' is copy-constructible.
+
     //! ~StripedUnorderedMultiMap() = default;
         // Destroy this hash map.
 
@@ -581,6 +619,9 @@ class StripedUnorderedMultiMap {
     bsl::size_t numStripes() const;
         // Return the number of stripes in the hash.
 
+    ReadMode readMode() const;
+        // Return the synchronization used by lookups in this hash multimap.
+
     int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
         // Call the specified 'visitor' (in an unspecified order) on the
         // elements in this hash table until each such element has been visited
@@ -652,6 +693,20 @@ StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::StripedUnorderedMultiMap(
 {
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::StripedUnorderedMultiMap(
+                                           bsl::size_t       numInitialBuckets,
+                                           bsl::size_t       numStripes,
+                                           ReadMode          readMode,
+                                           bslma::Allocator *basicAllocator)
+: d_imp(numInitialBuckets,
+        numStripes,
+        static_cast<typename Impl::ReadMode>(readMode),
+        basicAllocator)
+{
+}
+
 // MANIPULATORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
@@ -939,6 +994,14 @@ bsl::size_t StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::numStripes()
     return d_imp.numStripes();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::ReadMode
+StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::readMode() const
+{
+    return static_cast<ReadMode>(d_imp.readMode());
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 int StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
@@ -88,8 +88,8 @@ using namespace bsl;
 // 'BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR' macro and other types in
 // special cases.
 //
-// Single-threaded behavior is tested in test cases [1 .. 22].  Multi-threaded
-// issues are addressed in test case 23.
+// Single-threaded behavior is tested in test cases [1 .. 22] and 25.
+// Multi-threaded issues are addressed in test case 23.
 //
 // As this component simply forwards its methods to
 // 'bdlcc:StripedUnorderedImpl', we simply need to test that the various
@@ -110,6 +110,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] StripedUnorderedMultiMap(nInitialBuckets, nStripes, *basicAllocator);
+// [25] StripedUnorderedMultiMap(nBuckets, nStripes, readMode, *ba);
 // [ 2] ~StripedUnorderedMultiMap();
 //
 // MANIPULATORS
@@ -146,6 +147,7 @@ using namespace bsl;
 // [18] float loadFactor() const;
 // [18] float maxLoadFactor() const;
 // [ 4] bsl::size_t numStripes() const;
+// [25] ReadMode readMode() const;
 // [ 4] bsl::size_t size() const;
 // [22] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
 // [22] int visitReadOnly(const KEY&, const ReadOnlyVisitorFunction&) const;
@@ -155,7 +157,8 @@ using namespace bsl;
 // [ 1] BREATHING TEST
 // [19] TYPE TRAITS
 // [23] MULTI-THREADED STRESS TEST
-// [25] USAGE EXAMPLE
+// [26] USAGE EXAMPLE
+// [25] READ-OPTIMIZED MODE
 // [24] DRQS 169188100: ALLOCATOR AWARE DEFAULT CONSTRUCTION
 // [-1] PERFORMANCE TEST INT->STRING
 // [-2] PERFORMANCE TEST STRING->INT64
@@ -338,6 +341,13 @@ void example1()
 namespace {
 typedef bsltf::TemplateTestFacility TstFacility;
 
+bool appendBang(bsl::string *value, const int&)
+    // Append '!' to the specified 'value'.  Return 'true'.
+{
+    value->push_back('!');
+    return true;
+}
+
 }  // close unnamed namespace
 
 
@@ -7806,7 +7816,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -7826,6 +7836,99 @@ int main(int argc, char *argv[])
 
         usage::example1();
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // READ-OPTIMIZED MODE
+        //
+        // Concerns:
+        //: 1 The read mode supplied at construction is reported by 'readMode',
+        //:   and the default read mode is 'e_READ_LOCKED'.
+        //:
+        //: 2 Methods acting on all the elements having a key behave the same
+        //:   in each read mode.
+        //:
+        //: 3 All memory is supplied by the specified allocator and returned
+        //:   on destruction.
+        //
+        // Plan:
+        //: 1 Construct objects with and without a read mode, and verify the
+        //:   value returned by 'readMode'.  (C-1)
+        //:
+        //: 2 For each read mode, insert several elements per key, update them
+        //:   with 'setValueAll' and 'setComputedValueAll', verify the values
+        //:   with 'getValueAll', then erase them with 'eraseAll'.  (C-2)
+        //:
+        //: 3 Use a test allocator, and verify that no memory is in use after
+        //:   destruction.  (C-3)
+        //
+        // Testing:
+        //   StripedUnorderedMultiMap(nBuckets, nStripes, readMode, *ba);
+        //   ReadMode readMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "READ-OPTIMIZED MODE\n"
+                          << "===================\n";
+
+        typedef bdlcc::StripedUnorderedMultiMap<int, bsl::string> Obj;
+
+        bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&supplied);
+            ASSERT(Obj::e_READ_LOCKED == mX.readMode());
+
+            Obj mY(16, 4, Obj::e_READ_OPTIMIZED, &supplied);
+            ASSERT(Obj::e_READ_OPTIMIZED == mY.readMode());
+        }
+
+        const int NUM_KEYS   = 50;
+        const int NUM_VALUES =  4;
+
+        for (int mode = 0; mode < 2; ++mode) {
+            const Obj::ReadMode READ_MODE = 0 == mode
+                                          ? Obj::e_READ_LOCKED
+                                          : Obj::e_READ_OPTIMIZED;
+
+            Obj mX(4, 4, READ_MODE, &supplied);  const Obj& X = mX;
+
+            const bsl::string A("a value long enough to allocate memory",
+                                &supplied);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                for (int j = 0; j < NUM_VALUES; ++j) {
+                    mX.insert(i, "short");
+                }
+            }
+            ASSERTV(READ_MODE, X.size(), NUM_KEYS * NUM_VALUES == X.size());
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(READ_MODE, i, NUM_VALUES == mX.setValueAll(i, A));
+                ASSERTV(READ_MODE, i, NUM_VALUES ==
+                                       mX.setComputedValueAll(i, &appendBang));
+            }
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                bsl::vector<bsl::string> values(&supplied);
+                ASSERTV(READ_MODE, i, NUM_VALUES == X.getValueAll(&values, i));
+                for (bsl::size_t j = 0; j < values.size(); ++j) {
+                    ASSERTV(READ_MODE, i, j, A + "!" == values[j]);
+                }
+
+                bsl::string value(&supplied);
+                ASSERTV(READ_MODE, i, 1 == X.getValueFirst(&value, i));
+                ASSERTV(READ_MODE, i, A + "!" == value);
+            }
+
+            for (int i = 0; i < NUM_KEYS; i += 2) {
+                ASSERTV(READ_MODE, i, NUM_VALUES == mX.eraseAll(i));
+                ASSERTV(READ_MODE, i, 0 == mX.eraseFirst(i));
+            }
+            ASSERTV(READ_MODE,
+                    X.size(),
+                    NUM_KEYS / 2 * NUM_VALUES == X.size());
+        }
+        ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // DRQS 169188100: ALLOCATOR AWARE DEFAULT CONSTRUCTION
@@ -0,0 +1,31 @@
+// bdlf_inplacefunction.cpp                                           -*-C++-*-
+#include <bdlf_inplacefunction.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlf_inplacefunction_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The type of the target is erased by a table of three function pointers
+// ('InplaceFunction_Manager'), one static table being instantiated per
+// target type and prototype, so that an 'InplaceFunction' object is its
+// buffer plus a single pointer, and an empty object is recognized by a null
+// table pointer.  Invocation forwards the arguments through 'ARGS&&...',
+// which for by-value parameters moves them into the target's parameters
+// rather than copying them a second time.
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
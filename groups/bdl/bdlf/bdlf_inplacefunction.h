@@ -0,0 +1,736 @@
+// bdlf_inplacefunction.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLF_INPLACEFUNCTION
+#define INCLUDED_BDLF_INPLACEFUNCTION
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a move-only function wrapper that never allocates memory.
+//
+//@CLASSES:
+//  bdlf::InplaceFunction: move-only invocable wrapper with an inline buffer
+//
+//@SEE_ALSO: bslstl_function, bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlf::InplaceFunction', that holds and invokes an arbitrary invocable
+// object (its "target") conforming to a specified function prototype, in the
+// manner of 'std::move_only_function' (C++23).  Unlike 'bsl::function',
+// 'bdlf::InplaceFunction':
+//
+//: o is move-only, and can therefore hold move-only targets, such as a lambda
+//:   that captures a 'bslma::ManagedPtr' or a 'bsl::unique_ptr';
+//:
+//: o stores its target in a buffer, of a size specified as a template
+//:   parameter, within the 'bdlf::InplaceFunction' object itself, and *never*
+//:   allocates memory.
+//
+// The type of the held object is erased: two 'bdlf::InplaceFunction' objects
+// having the same prototype and buffer size have the same type whatever their
+// targets.  An 'InplaceFunction<RET(ARGS...), BUFFER_SIZE>' can be created
+// from any object 'f' of a move-constructible type 'FUNC' for which
+// 'f(args...)' is well-formed and convertible to 'RET', provided that
+// 'sizeof(FUNC) <= BUFFER_SIZE' and the alignment of 'FUNC' is at most the
+// maximum fundamental alignment.  A target that does not fit is rejected at
+// compile time, rather than being silently moved to the heap.  Note that
+// pointers to member functions are not directly supported; they can be
+// adapted with 'bdlf::MemFnUtil' or 'bdlf::BindUtil'.
+//
+// The default 'BUFFER_SIZE' is eight pointers, which is enough for a lambda
+// capturing several pointers or a 'bdlf::BindUtil' binder with a few bound
+// arguments.  Users queuing larger targets can choose a larger buffer, at the
+// cost of a larger 'bdlf::InplaceFunction' object.
+//
+///Empty Objects
+///-------------
+// A default-constructed 'bdlf::InplaceFunction', one created from 'nullptr',
+// a null pointer to function, or an empty 'bsl::function', and one that has
+// been moved from, is *empty*: it holds no target, converts to 'false', and
+// compares equal to 'nullptr'.  The behavior is undefined if an empty
+// 'bdlf::InplaceFunction' is invoked.
+//
+///Use with Thread Pools
+///---------------------
+// 'bdlmt::ThreadPool' and 'bdlmt::FixedThreadPool' provide an 'InplaceJob'
+// type, which is a 'bdlf::InplaceFunction<void()>' sized to also hold a
+// 'bsl::function<void()>', and store their pending jobs as 'InplaceJob'
+// objects.  A job enqueued with 'enqueueInplaceJob' is moved into the queue
+// without allocating memory (beyond the amortized growth of the queue itself),
+// whereas a job enqueued as a 'bsl::function' whose target does not fit in the
+// small buffer of 'bsl::function' allocates for every job.
+//
+///Language Support
+///----------------
+// 'bdlf::InplaceFunction' requires variadic templates and rvalue references,
+// and is not available in C++03 builds.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Deferring Work Owning a Move-Only Resource
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to defer some work that consumes a resource managed by a
+// move-only handle, such as a 'bslma::ManagedPtr'.  'bsl::function' cannot
+// hold a functor owning such a handle, because it requires its target to be
+// copyable; 'bdlf::InplaceFunction' can.
+//
+// First, we define a functor that owns an 'int' resource and adds its value
+// to its argument:
+//..
+//  struct AddResource {
+//      // DATA
+//      bslma::ManagedPtr<int> d_resource;
+//
+//      // ACCESSORS
+//      int operator()(int n) const
+//          // Return the sum of the specified 'n' and the resource.
+//      {
+//          return *d_resource + n;
+//      }
+//  };
+//..
+// Then, we define a callback type taking an 'int' and returning an 'int':
+//..
+//  typedef bdlf::InplaceFunction<int(int)> Callback;
+//..
+// Next, we create a resource owned by a 'bslma::ManagedPtr', and a callback
+// that takes ownership of it:
+//..
+//  bslma::TestAllocator   ta;
+//  bslma::ManagedPtr<int> resource(new (ta) int(40), &ta);
+//
+//  AddResource adder = { bslmf::MovableRefUtil::move(resource) };
+//  Callback    callback(bslmf::MovableRefUtil::move(adder));
+//  assert(callback);
+//  assert(!adder.d_resource);
+//  assert(1 == ta.numBlocksInUse());
+//..
+// Then, we move the callback, for instance into a queue of pending work.
+// Note that moving does not allocate:
+//..
+//  Callback pending(bslmf::MovableRefUtil::move(callback));
+//  assert(!callback);
+//  assert(pending);
+//..
+// Finally, we invoke the callback, and then release the resource by resetting
+// it:
+//..
+//  assert(42 == pending(2));
+//
+//  pending = nullptr;
+//  assert(0 == ta.numBlocksInUse());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_decay.h>
+#include <bslmf_enableif.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_issame.h>
+#include <bslmf_isvoid.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>
+#include <bslmf_voidtype.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_nullptr.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_new.h>
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+
+namespace BloombergLP {
+namespace bdlf {
+
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE = 8 * sizeof(void *)>
+class InplaceFunction;
+
+                        // ==============================
+                        // struct InplaceFunction_Manager
+                        // ==============================
+
+template <class RET, class... ARGS>
+struct InplaceFunction_Manager {
+    // This component-private 'struct' is a table of the operations on the
+    // target of a 'bdlf::InplaceFunction' having the prototype
+    // 'RET(ARGS...)'.  One such table is instantiated for each target type.
+
+    // TYPES
+    typedef RET  InvokeFunction(void *target, ARGS&&... args);
+        // Invoke the target at the specified 'target' address with the
+        // specified 'args' and return the result.
+
+    typedef void RelocateFunction(void *destination, void *source);
+        // Move-construct a target at the specified 'destination' address from
+        // the target at the specified 'source' address, and destroy the
+        // latter.
+
+    typedef void DestroyFunction(void *target);
+        // Destroy the target at the specified 'target' address.
+
+    // DATA
+    InvokeFunction   *d_invoke_p;
+    RelocateFunction *d_relocate_p;
+    DestroyFunction  *d_destroy_p;
+};
+
+                      // =================================
+                      // struct InplaceFunction_Operations
+                      // =================================
+
+template <class FUNC, class RET, class... ARGS>
+struct InplaceFunction_Operations {
+    // This component-private 'struct' provides the operations of
+    // 'InplaceFunction_Manager<RET, ARGS...>' for a target of type 'FUNC',
+    // and the table of those operations.
+
+    // CLASS DATA
+    static const InplaceFunction_Manager<RET, ARGS...> s_manager;
+
+    // CLASS METHODS
+    static RET invoke(void *target, ARGS&&... args);
+        // Invoke the 'FUNC' object at the specified 'target' address with the
+        // specified 'args' and return the result.
+
+    static void relocate(void *destination, void *source);
+        // Move-construct a 'FUNC' object at the specified 'destination'
+        // address from the 'FUNC' object at the specified 'source' address,
+        // and destroy the latter.
+
+    static void destroy(void *target);
+        // Destroy the 'FUNC' object at the specified 'target' address.
+};
+
+                      // ==================================
+                      // struct InplaceFunction_IsInvocable
+                      // ==================================
+
+template <class FUNC, class PROTOTYPE, class = void>
+struct InplaceFunction_IsInvocable : bsl::false_type {
+    // This component-private metafunction derives from 'bsl::true_type' if an
+    // lvalue of the specified 'FUNC' type can be invoked with arguments of the
+    // parameter types of the specified 'PROTOTYPE', yielding a result that is
+    // implicitly convertible to the return type of 'PROTOTYPE' (or that
+    // return type is 'void'), and from 'bsl::false_type' otherwise.  This
+    // primary template matches 'FUNC' types that cannot be invoked at all.
+};
+
+template <class FUNC, class RET, class... ARGS>
+struct InplaceFunction_IsInvocable<
+            FUNC,
+            RET(ARGS...),
+            typename bslmf::VoidType<
+                decltype(bslmf::Util::declval<FUNC&>()(
+                                  bslmf::Util::declval<ARGS>()...))>::type>
+: bsl::integral_constant<
+      bool,
+      bsl::is_void<RET>::value
+   || bsl::is_convertible<decltype(bslmf::Util::declval<FUNC&>()(
+                                        bslmf::Util::declval<ARGS>()...)),
+                          RET>::value> {
+    // This partial specialization of 'InplaceFunction_IsInvocable' matches
+    // 'FUNC' types that can be invoked with 'ARGS...'.
+};
+
+                          // ===========================
+                          // struct InplaceFunction_Util
+                          // ===========================
+
+struct InplaceFunction_Util {
+    // This component-private 'struct' provides a namespace for determining
+    // whether an object from which a 'bdlf::InplaceFunction' is created
+    // represents no target.
+
+    // CLASS METHODS
+    template <class FUNC>
+    static bool isNull(const FUNC&);
+        // Return 'false'.
+
+    template <class RET, class... ARGS>
+    static bool isNull(RET (*function)(ARGS...));
+        // Return 'true' if the specified 'function' is null, and 'false'
+        // otherwise.
+
+    template <class PROTOTYPE>
+    static bool isNull(const bsl::function<PROTOTYPE>& function);
+        // Return 'true' if the specified 'function' is empty, and 'false'
+        // otherwise.
+};
+
+                           // =====================
+                           // class InplaceFunction
+                           // =====================
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+class InplaceFunction<RET(ARGS...), BUFFER_SIZE> {
+    // This class template provides a move-only, type-erased holder of an
+    // invocable object having the prototype 'RET(ARGS...)' and fitting in
+    // 'BUFFER_SIZE' bytes.  The held object is stored within the
+    // 'InplaceFunction' object, which never allocates memory.
+
+    // PRIVATE TYPES
+    typedef InplaceFunction_Manager<RET, ARGS...> Manager;
+
+    // DATA
+    bsls::AlignedBuffer<static_cast<int>(BUFFER_SIZE)>
+                                      d_buffer;     // storage of the target
+
+    const Manager                    *d_manager_p;  // operations on the
+                                                    // target, or 0 if empty
+
+    // NOT IMPLEMENTED
+    InplaceFunction(const InplaceFunction&) BSLS_KEYWORD_DELETED;
+    InplaceFunction& operator=(const InplaceFunction&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+    template <class FUNC>
+    void emplace(FUNC&& func);
+        // Create a target in the buffer of this object from the specified
+        // 'func', unless 'func' represents no target.  The behavior is
+        // undefined unless this object is empty.
+
+    void moveFrom(InplaceFunction& original);
+        // Relocate the target of the specified 'original' object, if any, to
+        // this object, leaving 'original' empty.  The behavior is undefined
+        // unless this object is empty.
+
+  public:
+    // TYPES
+    typedef RET result_type;
+
+    // CONSTANTS
+    static const bsl::size_t k_BUFFER_SIZE = BUFFER_SIZE;
+
+    // CREATORS
+    InplaceFunction() BSLS_KEYWORD_NOEXCEPT;
+    InplaceFunction(bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;          // IMPLICIT
+        // Create an empty 'InplaceFunction' object.
+
+    InplaceFunction(bslmf::MovableRef<InplaceFunction> original);
+        // Create an 'InplaceFunction' object holding the target of the
+        // specified 'original' object, if any, which is moved into this
+        // object.  'original' is left empty.  Note that this constructor does
+        // not throw unless the move constructor of the target throws, in
+        // which case 'original' is unchanged.
+
+    template <class FUNC>
+    InplaceFunction(FUNC&& func,
+                    typename bsl::enable_if<
+                        !bsl::is_same<typename bsl::decay<FUNC>::type,
+                                      InplaceFunction>::value
+                     && InplaceFunction_IsInvocable<
+                                        typename bsl::decay<FUNC>::type,
+                                        RET(ARGS...)>::value,
+                        int>::type = 0);                            // IMPLICIT
+        // Create an 'InplaceFunction' object holding a target that is moved
+        // or copied from the specified 'func'.  If 'func' is a null pointer to
+        // function or an empty 'bsl::function', create an empty object.  This
+        // constructor participates in overload resolution only if
+        // 'bsl::decay<FUNC>::type' is not 'InplaceFunction', and an lvalue of
+        // that type is invocable with 'ARGS...' yielding a result implicitly
+        // convertible to 'RET' (or 'RET' is 'void').  Note that compilation
+        // fails unless 'bsl::decay<FUNC>::type' has a size of at most
+        // 'BUFFER_SIZE' and at most the maximum fundamental alignment.
+
+    ~InplaceFunction();
+        // Destroy this object and its target, if any.
+
+    // MANIPULATORS
+    InplaceFunction& operator=(bslmf::MovableRef<InplaceFunction> rhs);
+        // Destroy the target of this object, if any, move the target of the
+        // specified 'rhs', if any, into this object, leave 'rhs' empty, and
+        // return a reference providing modifiable access to this object.  If
+        // an exception is thrown, this object is left empty.
+
+    InplaceFunction& operator=(bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+        // Destroy the target of this object, if any, leaving this object
+        // empty, and return a reference providing modifiable access to this
+        // object.
+
+    template <class FUNC>
+    typename bsl::enable_if<
+        !bsl::is_same<typename bsl::decay<FUNC>::type,
+                      InplaceFunction>::value
+     && InplaceFunction_IsInvocable<typename bsl::decay<FUNC>::type,
+                                    RET(ARGS...)>::value,
+        InplaceFunction&>::type
+    operator=(FUNC&& func);
+        // Destroy the target of this object, if any, replace it with a target
+        // moved or copied from the specified 'func', and return a reference
+        // providing modifiable access to this object.  If 'func' is a null
+        // pointer to function or an empty 'bsl::function', leave this object
+        // empty.  If an exception is thrown, this object is left empty.  This
+        // operator participates in overload resolution only if
+        // 'bsl::decay<FUNC>::type' is not 'InplaceFunction', and an lvalue of
+        // that type is invocable with 'ARGS...' yielding a result implicitly
+        // convertible to 'RET' (or 'RET' is 'void').
+
+    RET operator()(ARGS... args);
+        // Invoke the target of this object with the specified 'args' and
+        // return the result.  The behavior is undefined if this object is
+        // empty.
+
+    void swap(InplaceFunction& other);
+        // Exchange the targets of this object and the specified 'other'
+        // object.  Note that this method does not throw unless the move
+        // constructor of one of the targets throws, in which case both
+        // objects are left in a valid but unspecified state.
+
+    // ACCESSORS
+    explicit operator bool() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this object holds a target, and 'false' otherwise.
+};
+
+// FREE OPERATORS
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+bool operator==(const InplaceFunction<PROTOTYPE, BUFFER_SIZE>& function,
+                bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+bool operator==(bsl::nullptr_t,
+                const InplaceFunction<PROTOTYPE, BUFFER_SIZE>& function)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    // Return 'true' if the specified 'function' is empty, and 'false'
+    // otherwise.
+
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+bool operator!=(const InplaceFunction<PROTOTYPE, BUFFER_SIZE>& function,
+                bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+bool operator!=(bsl::nullptr_t,
+                const InplaceFunction<PROTOTYPE, BUFFER_SIZE>& function)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    // Return 'true' if the specified 'function' holds a target, and 'false'
+    // otherwise.
+
+// FREE FUNCTIONS
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+void swap(InplaceFunction<PROTOTYPE, BUFFER_SIZE>& a,
+          InplaceFunction<PROTOTYPE, BUFFER_SIZE>& b);
+    // Exchange the targets of the specified 'a' and 'b' objects.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // ---------------------------------
+                      // struct InplaceFunction_Operations
+                      // ---------------------------------
+
+// CLASS DATA
+template <class FUNC, class RET, class... ARGS>
+const InplaceFunction_Manager<RET, ARGS...>
+InplaceFunction_Operations<FUNC, RET, ARGS...>::s_manager = {
+    &InplaceFunction_Operations<FUNC, RET, ARGS...>::invoke,
+    &InplaceFunction_Operations<FUNC, RET, ARGS...>::relocate,
+    &InplaceFunction_Operations<FUNC, RET, ARGS...>::destroy
+};
+
+// CLASS METHODS
+template <class FUNC, class RET, class... ARGS>
+RET InplaceFunction_Operations<FUNC, RET, ARGS...>::invoke(void     *target,
+                                                          ARGS&&... args)
+{
+    FUNC& func = *static_cast<FUNC *>(target);
+
+    return static_cast<RET>(func(BSLS_COMPILERFEATURES_FORWARD(ARGS,
+                                                               args)...));
+}
+
+template <class FUNC, class RET, class... ARGS>
+void InplaceFunction_Operations<FUNC, RET, ARGS...>::relocate(
+                                                           void *destination,
+                                                           void *source)
+{
+    FUNC& original = *static_cast<FUNC *>(source);
+
+    ::new (destination) FUNC(bslmf::MovableRefUtil::move(original));
+    original.~FUNC();
+}
+
+template <class FUNC, class RET, class... ARGS>
+void InplaceFunction_Operations<FUNC, RET, ARGS...>::destroy(void *target)
+{
+    static_cast<FUNC *>(target)->~FUNC();
+}
+
+                          // ---------------------------
+                          // struct InplaceFunction_Util
+                          // ---------------------------
+
+// CLASS METHODS
+template <class FUNC>
+inline
+bool InplaceFunction_Util::isNull(const FUNC&)
+{
+    return false;
+}
+
+template <class RET, class... ARGS>
+inline
+bool InplaceFunction_Util::isNull(RET (*function)(ARGS...))
+{
+    return 0 == function;
+}
+
+template <class PROTOTYPE>
+inline
+bool InplaceFunction_Util::isNull(const bsl::function<PROTOTYPE>& function)
+{
+    return !function;
+}
+
+                           // ---------------------
+                           // class InplaceFunction
+                           // ---------------------
+
+// CLASS DATA
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+const bsl::size_t InplaceFunction<RET(ARGS...), BUFFER_SIZE>::k_BUFFER_SIZE;
+
+// PRIVATE MANIPULATORS
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+template <class FUNC>
+inline
+void InplaceFunction<RET(ARGS...), BUFFER_SIZE>::emplace(FUNC&& func)
+{
+    typedef typename bsl::decay<FUNC>::type Target;
+
+    BSLMF_ASSERT(sizeof(Target) <= BUFFER_SIZE);
+    BSLMF_ASSERT(static_cast<int>(bsls::AlignmentFromType<Target>::VALUE) <=
+                  static_cast<int>(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+
+    BSLS_ASSERT(0 == d_manager_p);
+
+    if (InplaceFunction_Util::isNull(func)) {
+        return;                                                       // RETURN
+    }
+
+    ::new (d_buffer.buffer()) Target(BSLS_COMPILERFEATURES_FORWARD(FUNC,
+                                                                   func));
+    d_manager_p = &InplaceFunction_Operations<Target, RET, ARGS...>::s_manager;
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+void InplaceFunction<RET(ARGS...), BUFFER_SIZE>::moveFrom(
+                                                     InplaceFunction& original)
+{
+    BSLS_ASSERT(0 == d_manager_p);
+
+    if (original.d_manager_p) {
+        original.d_manager_p->d_relocate_p(d_buffer.buffer(),
+                                           original.d_buffer.buffer());
+        d_manager_p          = original.d_manager_p;
+        original.d_manager_p = 0;
+    }
+}
+
+// CREATORS
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::InplaceFunction()
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_manager_p(0)
+{
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::InplaceFunction(bsl::nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_manager_p(0)
+{
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::InplaceFunction(
+                                  bslmf::MovableRef<InplaceFunction> original)
+: d_manager_p(0)
+{
+    moveFrom(bslmf::MovableRefUtil::access(original));
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+template <class FUNC>
+inline
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::InplaceFunction(
+                   FUNC&& func,
+                   typename bsl::enable_if<
+                       !bsl::is_same<typename bsl::decay<FUNC>::type,
+                                     InplaceFunction>::value
+                    && InplaceFunction_IsInvocable<
+                                       typename bsl::decay<FUNC>::type,
+                                       RET(ARGS...)>::value,
+                       int>::type)
+: d_manager_p(0)
+{
+    emplace(BSLS_COMPILERFEATURES_FORWARD(FUNC, func));
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::~InplaceFunction()
+{
+    if (d_manager_p) {
+        d_manager_p->d_destroy_p(d_buffer.buffer());
+    }
+}
+
+// MANIPULATORS
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>&
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::operator=(
+                                       bslmf::MovableRef<InplaceFunction> rhs)
+{
+    InplaceFunction& other = bslmf::MovableRefUtil::access(rhs);
+
+    if (this != &other) {
+        *this = nullptr;
+        moveFrom(other);
+    }
+    return *this;
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>&
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::operator=(bsl::nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    if (d_manager_p) {
+        const Manager *manager = d_manager_p;
+
+        d_manager_p = 0;
+        manager->d_destroy_p(d_buffer.buffer());
+    }
+    return *this;
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+template <class FUNC>
+inline
+typename bsl::enable_if<
+    !bsl::is_same<typename bsl::decay<FUNC>::type,
+                  InplaceFunction<RET(ARGS...), BUFFER_SIZE> >::value
+ && InplaceFunction_IsInvocable<typename bsl::decay<FUNC>::type,
+                                RET(ARGS...)>::value,
+    InplaceFunction<RET(ARGS...), BUFFER_SIZE>&>::type
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::operator=(FUNC&& func)
+{
+    *this = nullptr;
+    emplace(BSLS_COMPILERFEATURES_FORWARD(FUNC, func));
+    return *this;
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+RET InplaceFunction<RET(ARGS...), BUFFER_SIZE>::operator()(ARGS... args)
+{
+    BSLS_ASSERT(d_manager_p);
+
+    return d_manager_p->d_invoke_p(d_buffer.buffer(),
+                                   BSLS_COMPILERFEATURES_FORWARD(ARGS,
+                                                                 args)...);
+}
+
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+void InplaceFunction<RET(ARGS...), BUFFER_SIZE>::swap(InplaceFunction& other)
+{
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+
+    InplaceFunction temp(bslmf::MovableRefUtil::move(other));
+
+    other.moveFrom(*this);
+    moveFrom(temp);
+}
+
+// ACCESSORS
+template <class RET, class... ARGS, bsl::size_t BUFFER_SIZE>
+inline
+InplaceFunction<RET(ARGS...), BUFFER_SIZE>::operator bool() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return 0 != d_manager_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+inline
+bool bdlf::operator==(const InplaceFunction<PROTOTYPE, BUFFER_SIZE>& function,
+                      bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT
+{
+    return !function;
+}
+
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+inline
+bool bdlf::operator==(bsl::nullptr_t,
+                      const InplaceFunction<PROTOTYPE, BUFFER_SIZE>& function)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return !function;
+}
+
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+inline
+bool bdlf::operator!=(const InplaceFunction<PROTOTYPE, BUFFER_SIZE>& function,
+                      bsl::nullptr_t) BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(function);
+}
+
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+inline
+bool bdlf::operator!=(bsl::nullptr_t,
+                      const InplaceFunction<PROTOTYPE, BUFFER_SIZE>& function)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(function);
+}
+
+// FREE FUNCTIONS
+template <class PROTOTYPE, bsl::size_t BUFFER_SIZE>
+inline
+void bdlf::swap(InplaceFunction<PROTOTYPE, BUFFER_SIZE>& a,
+                InplaceFunction<PROTOTYPE, BUFFER_SIZE>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif  // !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1167 @@
+// bdlf_inplacefunction.t.cpp                                         -*-C++-*-
+#include <bdlf_inplacefunction.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_managedptr.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_type_traits.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a move-only, type-erasing function wrapper that
+// stores its target in an internal buffer.  We verify that targets of various
+// kinds (function objects, lambdas, pointers to functions, 'bsl::function'
+// objects, and move-only functors) are held, invoked with correctly forwarded
+// arguments, moved, and destroyed exactly once, that the wrapper never
+// allocates memory, and that empty wrappers are recognized.
+//
+// The component is available only in C++11 and later; in C++03 builds the
+// test driver does nothing.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] InplaceFunction();
+// [ 2] InplaceFunction(bsl::nullptr_t);
+// [ 3] InplaceFunction(FUNC&& func);
+// [ 4] InplaceFunction(bslmf::MovableRef<InplaceFunction> original);
+// [ 3] ~InplaceFunction();
+//
+// MANIPULATORS
+// [ 4] InplaceFunction& operator=(bslmf::MovableRef<InplaceFunction> rhs);
+// [ 4] InplaceFunction& operator=(bsl::nullptr_t);
+// [ 4] InplaceFunction& operator=(FUNC&& func);
+// [ 3] RET operator()(ARGS... args);
+// [ 4] void swap(InplaceFunction& other);
+//
+// ACCESSORS
+// [ 2] explicit operator bool() const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const InplaceFunction&, bsl::nullptr_t);
+// [ 2] bool operator==(bsl::nullptr_t, const InplaceFunction&);
+// [ 2] bool operator!=(const InplaceFunction&, bsl::nullptr_t);
+// [ 2] bool operator!=(bsl::nullptr_t, const InplaceFunction&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(InplaceFunction& a, InplaceFunction& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] EXCEPTION SAFETY OF MOVE
+// [ 6] CONSTRAINTS ON CONVERSION FROM A FUNCTOR
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARISON WITH 'bsl::function'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+
+// ============================================================================
+//                            USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Deferring Work Owning a Move-Only Resource
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to defer some work that consumes a resource managed by a
+// move-only handle, such as a 'bslma::ManagedPtr'.  'bsl::function' cannot
+// hold a functor owning such a handle, because it requires its target to be
+// copyable; 'bdlf::InplaceFunction' can.
+//
+// First, we define a functor that owns an 'int' resource and adds its value
+// to its argument:
+//..
+    struct AddResource {
+        // DATA
+        bslma::ManagedPtr<int> d_resource;
+
+        // ACCESSORS
+        int operator()(int n) const
+            // Return the sum of the specified 'n' and the resource.
+        {
+            return *d_resource + n;
+        }
+    };
+//..
+
+void example1()
+    // Usage example 1.
+{
+// Then, we define a callback type taking an 'int' and returning an 'int':
+//..
+    typedef bdlf::InplaceFunction<int(int)> Callback;
+//..
+// Next, we create a resource owned by a 'bslma::ManagedPtr', and a callback
+// that takes ownership of it:
+//..
+    bslma::TestAllocator   ta;
+    bslma::ManagedPtr<int> resource(new (ta) int(40), &ta);
+
+    AddResource adder = { bslmf::MovableRefUtil::move(resource) };
+    Callback    callback(bslmf::MovableRefUtil::move(adder));
+    ASSERT(callback);
+    ASSERT(!adder.d_resource);
+    ASSERT(1 == ta.numBlocksInUse());
+//..
+// Then, we move the callback, for instance into a queue of pending work.
+// Note that moving does not allocate:
+//..
+    Callback pending(bslmf::MovableRefUtil::move(callback));
+    ASSERT(!callback);
+    ASSERT(pending);
+//..
+// Finally, we invoke the callback, and then release the resource by resetting
+// it:
+//..
+    ASSERT(42 == pending(2));
+
+    pending = nullptr;
+    ASSERT(0 == ta.numBlocksInUse());
+//..
+}
+
+}  // close namespace usage
+
+// ============================================================================
+//                       HELPER CLASSES AND FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                              // ==============
+                              // class Tracked
+                              // ==============
+
+class Tracked {
+    // This move-only functor adds a value to its argument and counts, in
+    // class data, its live instances and the number of times it has been
+    // moved.
+
+    // CLASS DATA
+    static int s_numLive;
+    static int s_numMoves;
+
+    // DATA
+    int  d_value;
+    bool d_movedFrom;
+
+    // NOT IMPLEMENTED
+    Tracked(const Tracked&) BSLS_KEYWORD_DELETED;
+    Tracked& operator=(const Tracked&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CLASS METHODS
+    static int numLive()
+        // Return the number of live 'Tracked' objects.
+    {
+        return s_numLive;
+    }
+
+    static int numMoves()
+        // Return the number of 'Tracked' objects move-constructed.
+    {
+        return s_numMoves;
+    }
+
+    // CREATORS
+    explicit Tracked(int value)
+        // Create a functor adding the specified 'value'.
+    : d_value(value)
+    , d_movedFrom(false)
+    {
+        ++s_numLive;
+    }
+
+    Tracked(bslmf::MovableRef<Tracked> original)
+        // Create a functor having the value of the specified 'original', and
+        // mark 'original' as moved-from.
+    : d_value(bslmf::MovableRefUtil::access(original).d_value)
+    , d_movedFrom(false)
+    {
+        bslmf::MovableRefUtil::access(original).d_movedFrom = true;
+        ++s_numLive;
+        ++s_numMoves;
+    }
+
+    ~Tracked()
+        // Destroy this object.
+    {
+        --s_numLive;
+    }
+
+    // MANIPULATORS
+    int operator()(int n)
+        // Return the sum of the specified 'n' and the value of this functor.
+    {
+        ASSERT(!d_movedFrom);
+        return d_value + n;
+    }
+
+    // ACCESSORS
+    bool isMovedFrom() const
+        // Return 'true' if this object has been moved from.
+    {
+        return d_movedFrom;
+    }
+};
+
+int Tracked::s_numLive  = 0;
+int Tracked::s_numMoves = 0;
+
+                           // ===================
+                           // class ThrowingMove
+                           // ===================
+
+class ThrowingMove {
+    // This functor throws from its move constructor if a class flag is set.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static bool s_throwOnMove;
+
+    // CREATORS
+    explicit ThrowingMove(int value)
+        // Create a functor returning the specified 'value'.
+    : d_value(value)
+    {
+    }
+
+    ThrowingMove(const ThrowingMove& original)
+        // Create a functor having the value of the specified 'original'.
+        // Throw 'int' if 's_throwOnMove' is 'true'.
+    : d_value(original.d_value)
+    {
+        if (s_throwOnMove) {
+            throw 17;
+        }
+    }
+
+    // MANIPULATORS
+    int operator()()
+        // Return the value of this functor.
+    {
+        return d_value;
+    }
+};
+
+bool ThrowingMove::s_throwOnMove = false;
+
+int twice(int n)
+    // Return twice the specified 'n'.
+{
+    return 2 * n;
+}
+
+void appendTo(bsl::string *result, const bsl::string& suffix)
+    // Append the specified 'suffix' to the specified 'result'.
+{
+    *result += suffix;
+}
+
+int sinkSize(bslma::ManagedPtr<bsl::vector<int> > vector)
+    // Return the size of the specified 'vector', which is destroyed.
+{
+    return static_cast<int>(vector->size());
+}
+
+struct Large {
+    // This functor has a size of 64 bytes.
+
+    // DATA
+    bsls::Types::Int64 d_data[8];
+
+    // MANIPULATORS
+    bsls::Types::Int64 operator()()
+        // Return the sum of the elements of this object.
+    {
+        bsls::Types::Int64 sum = 0;
+        for (int i = 0; i < 8; ++i) {
+            sum += d_data[i];
+        }
+        return sum;
+    }
+};
+
+struct NotInvocable {
+    // This type has no function-call operator.
+};
+
+struct TakesString {
+    // This functor can be invoked only with a 'bsl::string'.
+
+    // MANIPULATORS
+    void operator()(const bsl::string&)
+        // Do nothing.
+    {
+    }
+};
+
+struct ReturnsString {
+    // This functor returns a 'bsl::string', which is not convertible to
+    // 'int'.
+
+    // MANIPULATORS
+    bsl::string operator()(int)
+        // Return an empty string.
+    {
+        return bsl::string();
+    }
+};
+
+struct ConstCall {
+    // This functor has only a 'const' function-call operator.
+
+    // ACCESSORS
+    int operator()(int value) const
+        // Return the specified 'value'.
+    {
+        return value;
+    }
+};
+
+int overloaded(const bdlf::InplaceFunction<void(int)>&)
+    // Return 1.
+{
+    return 1;
+}
+
+int overloaded(const bdlf::InplaceFunction<void(const char *)>&)
+    // Return 2.
+{
+    return 2;
+}
+
+}  // close unnamed namespace
+
+#endif  // !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+#if BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    if (verbose) cout << "'bdlf::InplaceFunction' requires C++11." << endl;
+#else
+    // CONCERN: In no case does memory come from the default or global
+    // allocators.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+    bslma::TestAllocatorMonitor  dam(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usage::example1();
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONSTRAINTS ON CONVERSION FROM A FUNCTOR
+        //
+        // Concerns:
+        //: 1 An 'InplaceFunction' is not constructible or assignable from a
+        //:   type that has no function-call operator.
+        //:
+        //: 2 It is not constructible or assignable from a functor that cannot
+        //:   be invoked (as an lvalue) with the arguments of the prototype.
+        //:
+        //: 3 It is not constructible or assignable from a functor whose
+        //:   result is not convertible to the return type of the prototype,
+        //:   unless that return type is 'void'.
+        //:
+        //: 4 A call with a functor argument resolves to the single overload
+        //:   taking an 'InplaceFunction' that the functor can be invoked as.
+        //:
+        //: 5 Compatible functors remain constructible and assignable, and
+        //:   copy and move of 'InplaceFunction' itself are unaffected.
+        //
+        // Plan:
+        //: 1 Using 'bsl::is_constructible', 'bsl::is_convertible', and
+        //:   'bsl::is_assignable', verify that incompatible functors are
+        //:   rejected and compatible ones accepted.  (C-1..3, 5)
+        //:
+        //: 2 Call a function overloaded on 'InplaceFunction<void(int)>' and
+        //:   'InplaceFunction<void(const char *)>' with functors accepting
+        //:   only one of the argument types, and verify the overload chosen.
+        //:   (C-4)
+        //
+        // Testing:
+        //   CONSTRAINTS ON CONVERSION FROM A FUNCTOR
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "CONSTRAINTS ON CONVERSION FROM A FUNCTOR" << endl
+                        << "========================================" << endl;
+
+        typedef bdlf::InplaceFunction<int(int)>  IntObj;
+        typedef bdlf::InplaceFunction<void(int)> VoidObj;
+
+        if (veryVerbose) cout << "\tIncompatible functors." << endl;
+
+        ASSERT(!(bsl::is_constructible<IntObj, NotInvocable>::value));
+        ASSERT(!(bsl::is_convertible<NotInvocable, IntObj>::value));
+        ASSERT(!(bsl::is_assignable<IntObj&, NotInvocable>::value));
+
+        ASSERT(!(bsl::is_constructible<IntObj, int>::value));
+        ASSERT(!(bsl::is_assignable<IntObj&, int>::value));
+
+        ASSERT(!(bsl::is_constructible<VoidObj, TakesString>::value));
+        ASSERT(!(bsl::is_convertible<TakesString, VoidObj>::value));
+        ASSERT(!(bsl::is_assignable<VoidObj&, TakesString>::value));
+
+        ASSERT(!(bsl::is_constructible<IntObj, ReturnsString>::value));
+        ASSERT(!(bsl::is_convertible<ReturnsString, IntObj>::value));
+        ASSERT(!(bsl::is_assignable<IntObj&, ReturnsString>::value));
+
+        ASSERT(!(bsl::is_constructible<IntObj, int (*)(int, int)>::value));
+
+        if (veryVerbose) cout << "\tCompatible functors." << endl;
+
+        ASSERT( (bsl::is_constructible<VoidObj, ReturnsString>::value));
+        ASSERT( (bsl::is_convertible<ReturnsString, VoidObj>::value));
+        ASSERT( (bsl::is_assignable<VoidObj&, ReturnsString>::value));
+
+        ASSERT( (bsl::is_constructible<IntObj, ConstCall>::value));
+        ASSERT( (bsl::is_assignable<IntObj&, ConstCall>::value));
+
+        ASSERT( (bsl::is_constructible<IntObj, int (*)(long)>::value));
+        ASSERT( (bsl::is_constructible<IntObj, long (*)(int)>::value));
+        ASSERT( (bsl::is_constructible<IntObj, bsl::function<int(int)> >
+                                                                    ::value));
+
+        ASSERT( (bsl::is_constructible<IntObj, IntObj>::value));
+        ASSERT( (bsl::is_assignable<IntObj&, IntObj>::value));
+
+        if (veryVerbose) cout << "\tOverload resolution." << endl;
+
+        ASSERT(1 == overloaded([](int) {}));
+        ASSERT(2 == overloaded([](const char *) {}));
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY OF MOVE
+        //
+        // Concerns:
+        //: 1 If the move constructor of the target throws when an
+        //:   'InplaceFunction' is move-constructed, the original object is
+        //:   unchanged.
+        //:
+        //: 2 If it throws during move assignment, the assigned-to object is
+        //:   left empty and the original object is unchanged.
+        //:
+        //: 3 If it throws during construction from a functor, nothing is
+        //:   leaked.
+        //
+        // Plan:
+        //: 1 Using a functor whose copy (and therefore move) constructor
+        //:   throws on demand, verify the state of the objects after each
+        //:   operation throws.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY OF MOVE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY OF MOVE" << endl
+                          << "========================" << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        typedef bdlf::InplaceFunction<int()> Obj;
+
+        Obj mX(ThrowingMove(5));  const Obj& X = mX;
+
+        ThrowingMove::s_throwOnMove = true;
+
+        bool caught = false;
+        try {
+            Obj mY(bslmf::MovableRefUtil::move(mX));
+        }
+        catch (int) {
+            caught = true;
+        }
+        ASSERT(caught);
+        ASSERT(X);
+        ASSERT(5 == mX());
+
+        Obj mZ([]() { return 3; });  const Obj& Z = mZ;
+
+        caught = false;
+        try {
+            mZ = bslmf::MovableRefUtil::move(mX);
+        }
+        catch (int) {
+            caught = true;
+        }
+        ASSERT(caught);
+        ASSERT(!Z);
+        ASSERT(X);
+        ASSERT(5 == mX());
+
+        caught = false;
+        try {
+            ThrowingMove f(7);
+            Obj          mW(f);
+        }
+        catch (int) {
+            caught = true;
+        }
+        ASSERT(caught);
+
+        ThrowingMove::s_throwOnMove = false;
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MOVE, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 The move constructor relocates the target, leaving the original
+        //:   object empty, and moves the target exactly once.
+        //:
+        //: 2 Move assignment destroys the target of the assigned-to object,
+        //:   relocates the target of the original, and leaves the original
+        //:   empty.  Self-assignment has no effect.
+        //:
+        //: 3 Assignment of 'nullptr' destroys the target.
+        //:
+        //: 4 Assignment of a functor replaces the target; assignment of a null
+        //:   pointer to function leaves the object empty.
+        //:
+        //: 5 'swap' (member and free) exchanges the targets of two objects,
+        //:   including when one or both are empty.
+        //:
+        //: 6 No target is leaked or destroyed twice.
+        //
+        // Plan:
+        //: 1 Using 'Tracked' functors, which count their live instances and
+        //:   moves, perform each operation and verify the results of
+        //:   invocation, 'operator bool', and the counts.  (C-1..6)
+        //
+        // Testing:
+        //   InplaceFunction(bslmf::MovableRef<InplaceFunction> original);
+        //   InplaceFunction& operator=(bslmf::MovableRef<InplaceFunction>);
+        //   InplaceFunction& operator=(bsl::nullptr_t);
+        //   InplaceFunction& operator=(FUNC&& func);
+        //   void swap(InplaceFunction& other);
+        //   void swap(InplaceFunction& a, InplaceFunction& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MOVE, ASSIGNMENT, AND SWAP" << endl
+                          << "==========================" << endl;
+
+        typedef bdlf::InplaceFunction<int(int)> Obj;
+
+        if (verbose) cout << "\tMove construction." << endl;
+        {
+            Obj mX(Tracked(10));  const Obj& X = mX;
+            ASSERT(1 == Tracked::numLive());
+
+            const int moves = Tracked::numMoves();
+
+            Obj mY(bslmf::MovableRefUtil::move(mX));  const Obj& Y = mY;
+
+            ASSERT(moves + 1 == Tracked::numMoves());
+            ASSERT(1         == Tracked::numLive());
+            ASSERT(!X);
+            ASSERT(Y);
+            ASSERT(15 == mY(5));
+
+            Obj mZ(bslmf::MovableRefUtil::move(mX));  const Obj& Z = mZ;
+            ASSERT(!Z);
+            ASSERT(moves + 1 == Tracked::numMoves());
+        }
+        ASSERT(0 == Tracked::numLive());
+
+        if (verbose) cout << "\tMove assignment." << endl;
+        {
+            Obj mX(Tracked(10));  const Obj& X = mX;
+            Obj mY(Tracked(20));  const Obj& Y = mY;
+            ASSERT(2 == Tracked::numLive());
+
+            mY = bslmf::MovableRefUtil::move(mX);
+            ASSERT(1  == Tracked::numLive());
+            ASSERT(!X);
+            ASSERT(Y);
+            ASSERT(11 == mY(1));
+
+            Obj& rY = mY;
+            mY = bslmf::MovableRefUtil::move(rY);
+            ASSERT(Y);
+            ASSERT(11 == mY(1));
+            ASSERT(1  == Tracked::numLive());
+
+            mY = bslmf::MovableRefUtil::move(mX);
+            ASSERT(!X);
+            ASSERT(!Y);
+            ASSERT(0 == Tracked::numLive());
+        }
+        ASSERT(0 == Tracked::numLive());
+
+        if (verbose) cout << "\tAssignment of 'nullptr' and functors." << endl;
+        {
+            Obj mX(Tracked(10));  const Obj& X = mX;
+
+            mX = nullptr;
+            ASSERT(!X);
+            ASSERT(0 == Tracked::numLive());
+
+            mX = nullptr;
+            ASSERT(!X);
+
+            mX = Tracked(3);
+            ASSERT(X);
+            ASSERT(1 == Tracked::numLive());
+            ASSERT(4 == mX(1));
+
+            mX = &twice;
+            ASSERT(X);
+            ASSERT(0 == Tracked::numLive());
+            ASSERT(8 == mX(4));
+
+            int (*nullFunction)(int) = 0;
+            mX = nullFunction;
+            ASSERT(!X);
+
+            mX = [](int n) { return n - 1; };
+            ASSERT(X);
+            ASSERT(6 == mX(7));
+        }
+
+        if (verbose) cout << "\tSwap." << endl;
+        {
+            Obj mX(Tracked(10));  const Obj& X = mX;
+            Obj mY(&twice);       const Obj& Y = mY;
+            Obj mZ;               const Obj& Z = mZ;
+
+            mX.swap(mY);
+            ASSERT(2  == mX(1));
+            ASSERT(11 == mY(1));
+            ASSERT(1  == Tracked::numLive());
+
+            swap(mY, mZ);
+            ASSERT(!Y);
+            ASSERT(11 == mZ(1));
+
+            bdlf::swap(mY, mZ);
+            ASSERT(!Z);
+            ASSERT(11 == mY(1));
+
+            mZ.swap(mZ);
+            ASSERT(!Z);
+            mX.swap(mX);
+            ASSERT(2 == mX(1));
+
+            Obj mW;  const Obj& W = mW;
+            mW.swap(mZ);
+            ASSERT(!W);
+            ASSERT(!Z);
+            ASSERT(X);
+        }
+        ASSERT(0 == Tracked::numLive());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VALUE CONSTRUCTION AND INVOCATION
+        //
+        // Concerns:
+        //: 1 An object can be created from a function object, a lambda, a
+        //:   pointer to function, a function, a 'bsl::function', and a binder,
+        //:   and invoking it invokes the target.
+        //:
+        //: 2 An rvalue functor is moved into the object, and an lvalue functor
+        //:   is copied.
+        //:
+        //: 3 Arguments are forwarded with their value category: lvalue
+        //:   references refer to the caller's objects, and move-only arguments
+        //:   passed by value are accepted.
+        //:
+        //: 4 The result of the target is converted to 'RET'; for a 'void'
+        //:   prototype, any result is discarded.
+        //:
+        //: 5 The target is destroyed exactly once, when the object is
+        //:   destroyed.
+        //:
+        //: 6 The target can be as large as 'BUFFER_SIZE'.
+        //:
+        //: 7 No memory is allocated.
+        //:
+        //: 8 QoI: Invoking an empty object is detected when assertions are
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Create objects from each kind of target and invoke them, checking
+        //:   the result and the side effects.  (C-1, 3..4)
+        //:
+        //: 2 Use 'Tracked' functors to verify moves and destruction.
+        //:   (C-2, 5)
+        //:
+        //: 3 Hold a 64-byte functor in an object having a 64-byte buffer.
+        //:   (C-6)
+        //:
+        //: 4 Verify that the default and global allocators are unused, in
+        //:   'main'.  (C-7)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered when invoking an empty object.  (C-8)
+        //
+        // Testing:
+        //   InplaceFunction(FUNC&& func);
+        //   ~InplaceFunction();
+        //   RET operator()(ARGS... args);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE CONSTRUCTION AND INVOCATION" << endl
+                          << "=================================" << endl;
+
+        if (verbose) cout << "\tKinds of targets." << endl;
+        {
+            bdlf::InplaceFunction<int(int)> mA(&twice);
+            ASSERT(6 == mA(3));
+
+            bdlf::InplaceFunction<int(int)> mB(twice);
+            ASSERT(8 == mB(4));
+
+            int                             offset = 100;
+            bdlf::InplaceFunction<int(int)> mC([&offset](int n) {
+                return n + offset;
+            });
+            ASSERT(101 == mC(1));
+            offset = 200;
+            ASSERT(201 == mC(1));
+
+            bslma::TestAllocator      ta("function", veryVeryVeryVerbose);
+            bsl::function<int(int)>   f(bsl::allocator_arg, &ta, &twice);
+
+            bdlf::InplaceFunction<int(int), 128> mD(f);
+            ASSERT(10 == mD(5));
+
+            bdlf::InplaceFunction<int(int)> mE(
+                  bdlf::BindUtil::bind(&twice, bdlf::PlaceHolders::_1));
+            ASSERT(14 == mE(7));
+
+            // Return type conversion, and discarded results.
+
+            bdlf::InplaceFunction<double(int)> mF(&twice);
+            ASSERT(4.0 == mF(2));
+
+            bdlf::InplaceFunction<void(int)> mG(&twice);
+            mG(2);
+        }
+
+        if (verbose) cout << "\tArgument forwarding." << endl;
+        {
+            bslma::TestAllocator ta("strings", veryVeryVeryVerbose);
+
+            bsl::string result(&ta);
+
+            bdlf::InplaceFunction<void(bsl::string *, const bsl::string&)>
+                                                               mA(&appendTo);
+            mA(&result, bsl::string("abc", &ta));
+            mA(&result, bsl::string("def", &ta));
+            ASSERT("abcdef" == result);
+
+            bdlf::InplaceFunction<void(int&)> mB([](int& n) { n = 42; });
+            int                               value = 0;
+            mB(value);
+            ASSERT(42 == value);
+
+            typedef bslma::ManagedPtr<bsl::vector<int> > VectorPtr;
+
+            bdlf::InplaceFunction<int(VectorPtr)> mC(&sinkSize);
+
+            VectorPtr vector(new (ta) bsl::vector<int>(3, 0, &ta), &ta);
+            ASSERT(3 == mC(bslmf::MovableRefUtil::move(vector)));
+            ASSERT(!vector);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tMoving and copying the target." << endl;
+        {
+            {
+                bdlf::InplaceFunction<int(int)> mX(Tracked(1));
+                ASSERT(1 == Tracked::numLive());
+                ASSERT(3 == mX(2));
+
+                Tracked t(5);
+
+                bdlf::InplaceFunction<int(int)> mY(
+                                              bslmf::MovableRefUtil::move(t));
+                ASSERT(t.isMovedFrom());
+                ASSERT(3 == Tracked::numLive());
+                ASSERT(7 == mY(2));
+            }
+            ASSERT(0 == Tracked::numLive());
+
+            ThrowingMove                  f(9);
+            bdlf::InplaceFunction<int()>  mZ(f);  // copies 'f'
+            ASSERT(9 == mZ());
+            ASSERT(9 == f());
+        }
+
+        if (verbose) cout << "\tBuffer size." << endl;
+        {
+            ASSERT(64 == (bdlf::InplaceFunction<void(), 64>::k_BUFFER_SIZE));
+            ASSERT(8 * sizeof(void *) ==
+                                 bdlf::InplaceFunction<void()>::k_BUFFER_SIZE);
+
+            Large large;
+            for (int i = 0; i < 8; ++i) {
+                large.d_data[i] = i;
+            }
+
+            bdlf::InplaceFunction<bsls::Types::Int64(), 64> mX(large);
+            ASSERT(28 == mX());
+
+            bdlf::InplaceFunction<bsls::Types::Int64(), 64> mY(
+                                             bslmf::MovableRefUtil::move(mX));
+            ASSERT(28 == mY());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlf::InplaceFunction<int(int)> mX;
+            bdlf::InplaceFunction<int(int)> mY(&twice);
+
+            ASSERT_PASS(mY(1));
+            ASSERT_FAIL(mX(1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // EMPTY OBJECTS
+        //
+        // Concerns:
+        //: 1 Default-constructed objects, and objects created from 'nullptr',
+        //:   from a null pointer to function, or from an empty
+        //:   'bsl::function', are empty.
+        //:
+        //: 2 An object holding a target is not empty.
+        //:
+        //: 3 'operator bool' and comparison with 'nullptr' (in either order)
+        //:   report emptiness.
+        //
+        // Plan:
+        //: 1 Create empty and non-empty objects in each way, and verify
+        //:   'operator bool' and the four comparison operators.  (C-1..3)
+        //
+        // Testing:
+        //   InplaceFunction();
+        //   InplaceFunction(bsl::nullptr_t);
+        //   explicit operator bool() const;
+        //   bool operator==(const InplaceFunction&, bsl::nullptr_t);
+        //   bool operator==(bsl::nullptr_t, const InplaceFunction&);
+        //   bool operator!=(const InplaceFunction&, bsl::nullptr_t);
+        //   bool operator!=(bsl::nullptr_t, const InplaceFunction&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EMPTY OBJECTS" << endl
+                          << "=============" << endl;
+
+        // The buffer is large enough for a 'bsl::function'.
+
+        typedef bdlf::InplaceFunction<int(int), 128> Obj;
+
+        int (*nullFunction)(int) = 0;
+
+        bslma::TestAllocator    ta("function", veryVeryVeryVerbose);
+        bsl::function<int(int)> emptyFunction(bsl::allocator_arg, &ta);
+
+        const Obj A;
+        const Obj B(nullptr);
+        const Obj C(nullFunction);
+        const Obj D(emptyFunction);
+        const Obj E(&twice);
+
+        const Obj *EMPTY[] = { &A, &B, &C, &D };
+        for (int i = 0; i < 4; ++i) {
+            const Obj& X = *EMPTY[i];
+
+            ASSERTV(i, !X);
+            ASSERTV(i, X == nullptr);
+            ASSERTV(i, nullptr == X);
+            ASSERTV(i, !(X != nullptr));
+            ASSERTV(i, !(nullptr != X));
+        }
+
+        ASSERT(static_cast<bool>(E));
+        ASSERT(!(E == nullptr));
+        ASSERT(!(nullptr == E));
+        ASSERT(E != nullptr);
+        ASSERT(nullptr != E);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create, invoke, move, and reset a few objects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        typedef bdlf::InplaceFunction<int(int)> Obj;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(!X);
+
+        mX = &twice;
+        ASSERT(X);
+        ASSERT(4 == mX(2));
+
+        Obj mY(bslmf::MovableRefUtil::move(mX));  const Obj& Y = mY;
+        ASSERT(!X);
+        ASSERT(Y);
+        ASSERT(6 == mY(3));
+
+        int base = 10;
+        mX = [base](int n) { return base + n; };
+        ASSERT(11 == mX(1));
+
+        mY = nullptr;
+        ASSERT(!Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH 'bsl::function'
+        //
+        // Concerns:
+        //: 1 Creating, moving, and invoking an 'InplaceFunction' holding a
+        //:   target larger than the small buffer of 'bsl::function' does not
+        //:   allocate, and is faster than doing the same with a
+        //:   'bsl::function'.
+        //
+        // Plan:
+        //: 1 For each wrapper, repeatedly create a wrapper holding a 64-byte
+        //:   functor (the size of a lambda capturing eight pointers), move it
+        //:   twice (as when pushing it into and popping it from a queue), and
+        //:   invoke it.  Report the time per iteration and the number of
+        //:   allocations.
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH 'bsl::function'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE COMPARISON WITH 'bsl::function'" << endl
+             << "===========================================" << endl;
+
+        const int numIterations = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        struct Job {
+            // This functor has the size of a lambda capturing eight pointers,
+            // which exceeds the small buffer of 'bsl::function'.
+
+            // DATA
+            int *d_counter_p[8];
+
+            // MANIPULATORS
+            void operator()()
+                // Increment each counter.
+            {
+                for (int i = 0; i < 8; ++i) {
+                    ++*d_counter_p[i];
+                }
+            }
+        };
+
+        int counter = 0;
+        Job job     = { { &counter, &counter, &counter, &counter,
+                          &counter, &counter, &counter, &counter } };
+
+        bslma::TestAllocator ta("bench", false);
+
+        bsls::Types::Int64 t0 = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < numIterations; ++i) {
+            bsl::function<void()> a(bsl::allocator_arg, &ta, job);
+            bsl::function<void()> b(bslmf::MovableRefUtil::move(a));
+            bsl::function<void()> c(bslmf::MovableRefUtil::move(b));
+            c();
+        }
+        const double functionNs =
+                 static_cast<double>(bsls::TimeUtil::getTimer() - t0) /
+                                                                 numIterations;
+        const bsls::Types::Int64 functionAllocs = ta.numAllocations();
+
+        t0 = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < numIterations; ++i) {
+            bdlf::InplaceFunction<void()> a(job);
+            bdlf::InplaceFunction<void()> b(bslmf::MovableRefUtil::move(a));
+            bdlf::InplaceFunction<void()> c(bslmf::MovableRefUtil::move(b));
+            c();
+        }
+        const double inplaceNs =
+                 static_cast<double>(bsls::TimeUtil::getTimer() - t0) /
+                                                                 numIterations;
+
+        ASSERT(16 * numIterations == counter);
+
+        cout << "bsl::function:         " << functionNs << " ns/iteration, "
+             << functionAllocs << " allocations" << endl;
+        cout << "bdlf::InplaceFunction: " << inplaceNs << " ns/iteration, "
+             << ta.numAllocations() - functionAllocs << " allocations"
+             << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default or global
+    // allocators.
+
+    ASSERT(dam.isTotalSame());
+    ASSERT(gam.isTotalSame());
+#endif  // BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License.  You may obtain a copy
+// of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
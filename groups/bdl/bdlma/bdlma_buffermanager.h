@@ -380,6 +380,15 @@ class BufferManager {
         // of this object with no effect on the outstanding allocated memory
         // blocks.
 
+    void setCursor(bsls::Types::size_type cursor);
+        // Set the position within the buffer currently managed by this object
+        // from which subsequent allocations are satisfied to the specified
+        // 'cursor' offset (in bytes) from the beginning of the buffer.  The
+        // behavior is undefined unless this object is currently managing a
+        // buffer and 'cursor <= bufferSize()'.  Note that, used together with
+        // 'replaceBuffer' and the 'cursor' accessor, this method allows the
+        // state of a buffer manager to be saved and later restored.
+
     bsls::Types::size_type truncate(void                   *address,
                                     bsls::Types::size_type  originalSize,
                                     bsls::Types::size_type  newSize);
@@ -419,6 +428,11 @@ class BufferManager {
         // method is identical to the result for '0 == size' and maximal
         // alignment.
 
+    bsls::Types::size_type cursor() const;
+        // Return the offset (in bytes) from the beginning of the buffer
+        // currently managed by this object to the first byte that has not
+        // been allocated, or 0 if this object currently manages no buffer.
+
     bool hasSufficientCapacity(bsls::Types::size_type size) const;
         // Return 'true' if there is sufficient memory space in the buffer to
         // allocate a contiguous memory block of the specified 'size' (in
@@ -566,6 +580,15 @@ void BufferManager::reset()
     d_cursor     = 0;
 }
 
+inline
+void BufferManager::setCursor(bsls::Types::size_type cursor)
+{
+    BSLS_ASSERT(d_buffer_p);
+    BSLS_ASSERT(cursor <= d_bufferSize);
+
+    d_cursor = static_cast<bsls::Types::IntPtr>(cursor);
+}
+
 // ACCESSORS
 inline
 bsls::Alignment::Strategy BufferManager::alignmentStrategy() const
@@ -607,6 +630,12 @@ int BufferManager::calculateAlignmentOffsetFromSize(
               & (alignment - 1));
 }
 
+inline
+bsls::Types::size_type BufferManager::cursor() const
+{
+    return static_cast<bsls::Types::size_type>(d_cursor);
+}
+
 inline
 bool BufferManager::hasSufficientCapacity(bsls::Types::size_type size) const
 {
@@ -70,6 +70,7 @@ using namespace bsl;
 // [ 4] char *replaceBuffer(char *newBuffer, int newBufferSize);
 // [ 5] void release();
 // [ 6] void reset();
+// [12] void setCursor(size_type cursor);
 // [10] int truncate(void *address, int originalSize, int newSize);
 //
 // // ACCESSORS
@@ -77,10 +78,11 @@ using namespace bsl;
 // [ 2] char *buffer() const;
 // [ 2] int bufferSize() const;
 // [11] int calculateAlignmentOffsetFromSize(address, size) const;
+// [12] size_type cursor() const;
 // [ 7] bool hasSufficientCapacity(int size) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -383,7 +385,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -413,6 +415,166 @@ int main(int argc, char *argv[])
         result = detectNOccurrences(3, array, 5);
         ASSERT(false == result);
 
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'cursor' AND 'setCursor'
+        //
+        // Concerns:
+        //: 1 'cursor' returns 0 for an object that manages no buffer, and for
+        //:   an object whose buffer was just supplied or released.
+        //:
+        //: 2 'cursor' returns the offset just past the most recent allocation,
+        //:   including any padding required for alignment.
+        //:
+        //: 3 'setCursor' sets the position from which subsequent allocations
+        //:   are satisfied, whether it moves the cursor forward or backward.
+        //:
+        //: 4 Saving 'buffer', 'bufferSize', and 'cursor' and later restoring
+        //:   them with 'replaceBuffer' and 'setCursor' restores the state of
+        //:   the object.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify 'cursor' on default-constructed objects, and after
+        //:   'replaceBuffer' and 'release'.  (C-1)
+        //:
+        //: 2 For each alignment strategy, perform a sequence of allocations
+        //:   and verify that 'cursor' matches the end of each.  (C-2)
+        //:
+        //: 3 Move the cursor forward and backward with 'setCursor' and verify
+        //:   the address returned by the next allocation.  (C-3)
+        //:
+        //: 4 Save the state of an object, allocate from a different buffer,
+        //:   restore the state, and verify that the next allocation is the
+        //:   one that would have been made had the state not changed.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments, using the 'BSLS_ASSERTTEST_*'
+        //:   macros.  (C-5)
+        //
+        // Testing:
+        //   void setCursor(size_type cursor);
+        //   size_type cursor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'cursor' AND 'setCursor'" << endl
+                          << "================================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        if (verbose) cout << "\nTesting 'cursor' on an empty object." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == X.cursor());
+
+            mX.replaceBuffer(buffer, k_BUFFER_SIZE);
+            ASSERT(0 == X.cursor());
+
+            mX.allocate(8);
+            ASSERT(8 == X.cursor());
+
+            mX.release();
+            ASSERT(0 == X.cursor());
+
+            mX.allocate(8);
+            mX.reset();
+            ASSERT(0 == X.cursor());
+        }
+
+        if (verbose) cout << "\nTesting 'cursor' after allocations." << endl;
+        {
+            const bsls::Alignment::Strategy STRATEGIES[] = {
+                bsls::Alignment::BSLS_NATURAL,
+                bsls::Alignment::BSLS_MAXIMUM,
+                bsls::Alignment::BSLS_BYTEALIGNED
+            };
+            enum { k_NUM_STRATEGIES = sizeof  STRATEGIES
+                                    / sizeof *STRATEGIES };
+
+            static const int SIZES[] = { 1, 2, 1, 4, 3, 8, 1, 16, 5 };
+            enum { k_NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+            for (int i = 0; i < k_NUM_STRATEGIES; ++i) {
+                Obj mX(buffer, k_BUFFER_SIZE, STRATEGIES[i]);
+                const Obj& X = mX;
+
+                for (int j = 0; j < k_NUM_SIZES; ++j) {
+                    char *p = static_cast<char *>(mX.allocate(SIZES[j]));
+                    LOOP2_ASSERT(i, j, p);
+                    LOOP2_ASSERT(i, j,
+                       static_cast<bsls::Types::size_type>(p + SIZES[j]
+                                                          - buffer)
+                                                               == X.cursor());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'setCursor'." << endl;
+        {
+            Obj mX(buffer, k_BUFFER_SIZE, bsls::Alignment::BSLS_BYTEALIGNED);
+            const Obj& X = mX;
+
+            mX.setCursor(100);
+            ASSERT(100 == X.cursor());
+            ASSERT(buffer + 100 == mX.allocate(1));
+
+            mX.setCursor(10);
+            ASSERT(10 == X.cursor());
+            ASSERT(buffer + 10 == mX.allocate(1));
+
+            mX.setCursor(k_BUFFER_SIZE);
+            ASSERT(k_BUFFER_SIZE == X.cursor());
+            ASSERT(0 == mX.allocate(1));
+
+            mX.setCursor(0);
+            ASSERT(buffer == mX.allocate(1));
+        }
+
+        if (verbose) cout << "\nTesting saving and restoring state." << endl;
+        {
+            char otherBuffer[k_BUFFER_SIZE];
+
+            Obj mX(buffer, k_BUFFER_SIZE);  const Obj& X = mX;
+
+            mX.allocate(3);
+            mX.allocate(8);
+
+            char                   *savedBuffer = X.buffer();
+            bsls::Types::size_type  savedSize   = X.bufferSize();
+            bsls::Types::size_type  savedCursor = X.cursor();
+
+            void *expected = mX.allocate(16);
+
+            mX.replaceBuffer(otherBuffer, sizeof otherBuffer);
+            mX.allocate(32);
+
+            mX.replaceBuffer(savedBuffer, savedSize);
+            mX.setCursor(savedCursor);
+
+            ASSERT(buffer        == X.buffer());
+            ASSERT(k_BUFFER_SIZE == X.bufferSize());
+            ASSERT(savedCursor   == X.cursor());
+            ASSERT(expected      == mX.allocate(16));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_FAIL(mX.setCursor(0));
+
+            mX.replaceBuffer(buffer, k_BUFFER_SIZE);
+
+            ASSERT_PASS(mX.setCursor(0));
+            ASSERT_PASS(mX.setCursor(k_BUFFER_SIZE));
+            ASSERT_FAIL(mX.setCursor(k_BUFFER_SIZE + 1));
+        }
+
       } break;
       case 11: {
         // -------------------------------------------------------------------
@@ -130,6 +130,83 @@ void replenishImp(bsls::AtomicPointer<LLink>       *nextList,
     } while (old != nextList->testAndSwap(old, toLink(start)));
 }
 
+static inline
+bool releaseLink(LLink *link)
+    // Release the reference held by the owner of the allocated block at the
+    // specified 'link', and return 'true' if the block must now be pushed onto
+    // the free list, or 'false' if a thread concurrently popping the block
+    // from the free list has taken ownership of it.
+{
+    int refCount = bsls::AtomicOperations::getIntRelaxed(&link->d_refCount);
+    for (;;) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
+            refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                          &link->d_refCount,
+                                                          2,
+                                                          0);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
+                return true;                                          // RETURN
+            }
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        const int oldRefCount = refCount;
+        refCount = bsls::AtomicOperations::testAndSwapInt(&link->d_refCount,
+                                                          refCount,
+                                                          refCount - 1);
+        if (oldRefCount == refCount) {
+            // Someone else is still trying to pop this item.  Just let them
+            // have it.
+
+            return false;                                             // RETURN
+        }
+    }
+}
+
+namespace {
+
+class ListProctor {
+    // This class implements a proctor that, unless released, returns a list
+    // of blocks (see {Transferring Lists of Blocks} in the header) to a
+    // 'bdlma::ConcurrentPool' on destruction.
+
+    // DATA
+    bdlma::ConcurrentPool  *d_pool_p;  // pool owning the blocks
+    void                  **d_head_p;  // address of the head of the list
+
+  private:
+    // NOT IMPLEMENTED
+    ListProctor(const ListProctor&);
+    ListProctor& operator=(const ListProctor&);
+
+  public:
+    // CREATORS
+    ListProctor(bdlma::ConcurrentPool *pool, void **head)
+        // Create a proctor returning the list whose head is at the specified
+        // 'head' address to the specified 'pool'.
+    : d_pool_p(pool)
+    , d_head_p(head)
+    {
+    }
+
+    ~ListProctor()
+        // Return the list managed by this proctor, if any, to its pool.
+    {
+        if (d_head_p) {
+            d_pool_p->deallocateList(*d_head_p);
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+        // Release from management the list managed by this proctor.
+    {
+        d_head_p = 0;
+    }
+};
+
+}  // close unnamed namespace
+
 namespace bdlma {
 
                            // --------------------
@@ -303,39 +380,117 @@ void *ConcurrentPool::allocate()
     return static_cast<void *>(const_cast<Link **>(&p->d_next_p));
 }
 
+void *ConcurrentPool::allocateList(int numBlocks)
+{
+    BSLS_ASSERT(1 <= numBlocks);
+
+    // Blocks are taken under 'd_mutex' (which also serializes 'replenish') by
+    // detaching the whole free list, and the blocks not needed are pushed
+    // back.  Each block taken is marked allocated just as if it were popped
+    // by 'allocate', so that threads concurrently popping it off the
+    // free list behave as they would had they lost a race with 'allocate'.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    void        *head  = 0;
+    int          count = 0;
+    ListProctor  proctor(this, &head);
+
+    while (count < numBlocks) {
+        Link *list = d_freeList.swap(0);
+        if (!list) {
+            replenish();
+            continue;
+        }
+
+        for (; list && count < numBlocks; ++count) {
+            Link *next = list->d_next_p;
+
+            bsls::AtomicOperations::addInt(&list->d_refCount, 2);
+            list->d_next_p = static_cast<Link *>(head);
+            head           = const_cast<Link **>(&list->d_next_p);
+
+            list = next;
+        }
+
+        if (list && 0 != d_freeList.testAndSwap(0, list)) {
+            Link *last = list;
+            while (last->d_next_p) {
+                last = last->d_next_p;
+            }
+
+            Link *old = d_freeList.loadRelaxed();
+            for (;;) {
+                last->d_next_p = old;
+                const Link * const swap = old;
+                old = d_freeList.testAndSwap(old, list);
+                if (swap == old) {
+                    break;
+                }
+            }
+        }
+    }
+
+    proctor.release();
+
+    return head;
+}
+
 void ConcurrentPool::deallocate(void *address)
 {
     Link *p = static_cast<Link *>(static_cast<void *>(
                      static_cast<char *>(address) - offsetof(Link, d_next_p)));
-    int refCount = bsls::AtomicOperations::getIntRelaxed(&p->d_refCount);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                 !releaseLink(reinterpret_cast<LLink *>(p)))) {
+        return;                                                       // RETURN
+    }
+
+    Link *old = d_freeList.loadRelaxed();
     for (;;) {
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-            refCount = bsls::AtomicOperations::testAndSwapInt(&p->d_refCount,
-                                                              2,
-                                                              0);
-            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-                break;
-            }
+        p->d_next_p = old;
+        const Link * const swap = old;
+        old = d_freeList.testAndSwap(old, p);  // release
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(swap == old)) {
+            break;
         }
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+}
 
-        const int oldRefCount = refCount;
-        refCount = bsls::AtomicOperations::testAndSwapInt(&p->d_refCount,
-                                                          refCount,
-                                                          refCount - 1);
-        if (oldRefCount == refCount) {
-            // Someone else is still trying to pop this item.  Just let them
-            // have it.
-
-            return;                                                   // RETURN
+void ConcurrentPool::deallocateList(void *head)
+{
+    // Build a list of the blocks that are not being concurrently popped, and
+    // push it onto the free list with a single update.
+
+    Link *first = 0;
+    Link *last  = 0;
+
+    while (head) {
+        void *next = *static_cast<void **>(head);
+        Link *p    = static_cast<Link *>(static_cast<void *>(
+                        static_cast<char *>(head) - offsetof(Link, d_next_p)));
+
+        if (releaseLink(reinterpret_cast<LLink *>(p))) {
+            p->d_next_p = first;
+            first       = p;
+            if (!last) {
+                last = p;
+            }
         }
+
+        head = next;
+    }
+
+    if (!first) {
+        return;                                                       // RETURN
     }
 
     Link *old = d_freeList.loadRelaxed();
     for (;;) {
-        p->d_next_p = old;
+        last->d_next_p = old;
         const Link * const swap = old;
-        old = d_freeList.testAndSwap(old, p);  // release
+        old = d_freeList.testAndSwap(old, first);  // release
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(swap == old)) {
             break;
         }
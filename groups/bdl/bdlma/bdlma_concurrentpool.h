@@ -82,6 +82,16 @@ BSLS_IDENT("$Id: $")
 // currently installed default allocator at the time the
 // 'bdlma::ConcurrentPool' was created.
 //
+///Transferring Lists of Blocks
+///-----------------------------
+// A client that caches blocks (for example, a per-thread cache in front of a
+// shared pool) can exchange many blocks with the pool at once: 'allocateList'
+// returns a list of blocks taken from the pool in a single critical section,
+// and 'deallocateList' returns a list of blocks to the free list of the pool
+// with a single atomic update.  In such a list, the first 'sizeof(void *)'
+// bytes of each block hold the address of the next block in the list, and
+// those of the last block hold 0.
+//
 ///Overloaded Global Operator 'new'
 ///--------------------------------
 // This component overloads the global 'operator new' to allow convenient
@@ -379,12 +389,27 @@ class ConcurrentPool {
         // Return the address of a contiguous block of memory having the fixed
         // block size specified at construction.
 
+    void *allocateList(int numBlocks);
+        // Return the address of the first of the specified 'numBlocks' memory
+        // blocks, each having the fixed block size specified at construction,
+        // allocated from this pool and linked into a list as described in
+        // {Transferring Lists of Blocks}.  If an exception is thrown, no
+        // blocks are allocated.  The behavior is undefined unless
+        // '1 <= numBlocks'.
+
     void deallocate(void *address);
         // Relinquish the memory block at the specified 'address' back to this
         // pool object for reuse.  The behavior is undefined unless 'address'
         // is non-zero, was allocated by this pool, and has not already been
         // deallocated.
 
+    void deallocateList(void *head);
+        // Relinquish the memory blocks in the list starting at the specified
+        // 'head' (see {Transferring Lists of Blocks}) back to this pool object
+        // for reuse.  This method has no effect if 'head' is 0.  The behavior
+        // is undefined unless every block in the list was allocated by this
+        // pool and has not already been deallocated.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
@@ -24,9 +24,11 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cmath.h>       // 'log'
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_cstring.h>     // 'memcpy'
@@ -73,7 +75,9 @@ using namespace bsl;  // automatically added by script
 // [12] bdlma::ConcurrentPool(int, int, bslma::allocator *);
 // [ 7] ~bdlma::ConcurrentPool();
 // [ 2] void *allocate();
+// [17] void *allocateList(int numBlocks);
 // [ 6] void deallocate(address);
+// [17] void deallocateList(void *head);
 // [10] void deleteObject(const TYPE *object);
 // [10] void deleteObjectRaw(const TYPE *object);
 // [ 7] void release();
@@ -81,7 +85,7 @@ using namespace bsl;  // automatically added by script
 // [ 9] template<typename TYPE> void deleteObject(TYPE *object)
 // [13] bslma::Allocator *allocator() const;
 //-----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
 // [16] ORIGINAL USAGE EXAMPLE
 // [15] PERFORMANCE TEST
 // [14] CONCURRENCY TEST
@@ -611,6 +615,76 @@ void *workerThread(void *arg) {
     return arg;
 }
 
+//=============================================================================
+//                   HELPER FUNCTION FOR LIST TRANSFER TEST
+//-----------------------------------------------------------------------------
+
+struct ListBlock {
+    // This 'struct' overlays a block in a list transferred by 'allocateList'
+    // or 'deallocateList', recording the thread owning the block.
+
+    ListBlock           *d_next_p;   // next block in the list
+    bsls::Types::Uint64  d_ownerId;  // identifier of the owning thread
+};
+
+extern "C"
+void *listWorkerThread(void *arg)
+    // Repeatedly take blocks from the 'Obj' at the specified 'arg', using
+    // 'allocateList' or 'allocate' depending on the thread, mark them as
+    // owned by this thread, yield, verify that no other thread took them in
+    // the meantime, and return them with 'deallocateList' or 'deallocate'.
+{
+    static bsls::AtomicInt numWorkers;
+
+    Obj *mX = static_cast<Obj *>(arg);
+
+    const bsls::Types::Uint64 id      = bslmt::ThreadUtil::selfIdAsUint64();
+    const bool                useList = 0 == numWorkers++ % 2;
+
+    barrier.wait();
+
+    for (int i = 0; i < k_NUM_OBJECTS / 10; ++i) {
+        const int  numBlocks = i % 17 + 1;
+        ListBlock *head      = 0;
+
+        if (useList) {
+            head = static_cast<ListBlock *>(mX->allocateList(numBlocks));
+        }
+        else {
+            for (int j = 0; j < numBlocks; ++j) {
+                ListBlock *block = static_cast<ListBlock *>(mX->allocate());
+                block->d_next_p = head;
+                head            = block;
+            }
+        }
+
+        int count = 0;
+        for (ListBlock *block = head; block; block = block->d_next_p) {
+            block->d_ownerId = id;
+            ++count;
+        }
+        LOOP2_ASSERT(numBlocks, count, numBlocks == count);
+
+        bslmt::ThreadUtil::yield();
+
+        for (ListBlock *block = head; block; block = block->d_next_p) {
+            LOOP_ASSERT(i, id == block->d_ownerId);
+        }
+
+        if (useList || 0 == i % 2) {
+            mX->deallocateList(head);
+        }
+        else {
+            while (head) {
+                ListBlock *next = head->d_next_p;
+                mX->deallocate(head);
+                head = next;
+            }
+        }
+    }
+    return arg;
+}
+
 //=============================================================================
 //                              BENCHMARKS
 //-----------------------------------------------------------------------------
@@ -695,7 +769,7 @@ int main(int argc, char *argv[]) {
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Make sure main usage example compiles and works.
@@ -729,6 +803,159 @@ int main(int argc, char *argv[]) {
         array.removeAll();
         ASSERT(0 == array.length());
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocateList' AND 'deallocateList'
+        //
+        // Concerns:
+        //: 1 'allocateList' returns the requested number of distinct, usable
+        //:   blocks linked into a null-terminated list, replenishing the pool
+        //:   as needed.
+        //:
+        //: 2 'deallocateList' returns every block in the list for reuse, and
+        //:   has no effect on an empty list.
+        //:
+        //: 3 'allocateList' is exception neutral: if replenishing the pool
+        //:   throws, the blocks already taken are returned to the pool.
+        //:
+        //: 4 The list methods may be used concurrently with each other and
+        //:   with 'allocate' and 'deallocate', and no block is ever owned by
+        //:   two threads.
+        //
+        // Plan:
+        //: 1 For a range of list lengths, allocate a list, verify its length
+        //:   and that its blocks are distinct and writable, return it, and
+        //:   verify that allocating the same number of blocks again does not
+        //:   request more memory.  (C-1..2)
+        //:
+        //: 2 With three blocks on the free list, allocate a longer list in an
+        //:   exception test loop; when an exception is thrown, verify that
+        //:   the three blocks are still available.  (C-3)
+        //:
+        //: 3 Run several threads that take and return blocks, marking each
+        //:   block with the owning thread and verifying the mark after
+        //:   yielding.  (C-4)
+        //
+        // Testing:
+        //   void *allocateList(int numBlocks);
+        //   void deallocateList(void *head);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'allocateList' AND 'deallocateList'"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        if (verbose) cout << "\nTesting list contents." << endl;
+        {
+            const int LENGTHS[] = { 1, 2, 3, 7, 32, 33, 100 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(k_OBJECT_SIZE, &ta);
+
+            mX.deallocateList(0);
+            ASSERT(0 == ta.numBlocksInUse());
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                ListBlock *head = static_cast<ListBlock *>(
+                                                   mX.allocateList(LENGTH));
+
+                bsl::vector<ListBlock *> blocks;
+                for (ListBlock *block = head; block; block = block->d_next_p) {
+                    block->d_ownerId = ti;
+                    blocks.push_back(block);
+                }
+                LOOP2_ASSERT(LENGTH, blocks.size(),
+                             LENGTH == static_cast<int>(blocks.size()));
+
+                bsl::sort(blocks.begin(), blocks.end());
+                LOOP_ASSERT(LENGTH, blocks.end() ==
+                             bsl::adjacent_find(blocks.begin(), blocks.end()));
+
+                mX.deallocateList(head);
+
+                const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+                head = static_cast<ListBlock *>(mX.allocateList(LENGTH));
+                LOOP_ASSERT(LENGTH, NUM_BYTES == ta.numBytesInUse());
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    ListBlock *next = head->d_next_p;
+                    mX.deallocate(head);
+                    head = next;
+                }
+                LOOP_ASSERT(LENGTH, 0 == head);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    mX.allocate();
+                }
+                LOOP_ASSERT(LENGTH, NUM_BYTES == ta.numBytesInUse());
+                mX.release();
+            }
+        }
+
+        if (verbose) cout << "\nTesting exception neutrality." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                Obj mX(k_OBJECT_SIZE,
+                       bsls::BlockGrowth::BSLS_CONSTANT,
+                       3,
+                       &ta);
+
+                void *blocks[3];
+                for (int i = 0; i < 3; ++i) {
+                    blocks[i] = mX.allocate();
+                }
+                for (int i = 0; i < 3; ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+
+                try {
+                    mX.deallocateList(mX.allocateList(10));
+                }
+                catch (...) {
+                    // The three blocks taken before the exception must have
+                    // been returned.
+
+                    bsl::vector<void *> expected(blocks, blocks + 3);
+                    bsl::sort(expected.begin(), expected.end());
+
+                    bsl::vector<void *> actual;
+                    for (int i = 0; i < 3; ++i) {
+                        actual.push_back(mX.allocate());
+                    }
+                    bsl::sort(actual.begin(), actual.end());
+
+                    ASSERT(expected == actual);
+
+                    throw;
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+
+        if (verbose) cout << "\nTesting concurrent use." << endl;
+        {
+            bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+            Obj mX(sizeof(ListBlock));
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::create(&threads[i],
+                                                   listWorkerThread,
+                                                   &mX);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::join(threads[i]);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // ORIGINAL USAGE EXAMPLE
@@ -375,6 +375,41 @@ void Multipool::reserveCapacity(bsls::Types::size_type size, int numBlocks)
     }
 }
 
+void Multipool::enableTrimming(bsls::Types::size_type idleThreshold)
+{
+    for (int i = 0; i < d_numPools; ++i) {
+        d_pools_p[i].enableTrimming(idleThreshold);
+    }
+}
+
+bsls::Types::size_type Multipool::trim()
+{
+    bsls::Types::size_type numBytes = 0;
+    for (int i = 0; i < d_numPools; ++i) {
+        numBytes += d_pools_p[i].trim();
+    }
+    return numBytes;
+}
+
+// ACCESSORS
+bsls::Types::size_type Multipool::numBytesInUse() const
+{
+    bsls::Types::size_type numBytes = 0;
+    for (int i = 0; i < d_numPools; ++i) {
+        numBytes += d_pools_p[i].numBytesInUse();
+    }
+    return numBytes;
+}
+
+bsls::Types::size_type Multipool::numBytesRetained() const
+{
+    bsls::Types::size_type numBytes = 0;
+    for (int i = 0; i < d_numPools; ++i) {
+        numBytes += d_pools_p[i].numBytesRetained();
+    }
+    return numBytes;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -94,6 +94,20 @@ BSLS_IDENT("$Id: $")
 // single value applying to all of the maintained pools, or as an array of
 // values, with the elements applying to each individually maintained pool.
 //
+///Trimming Idle Memory
+///--------------------
+// By default, memory obtained by the internal pools is retained until
+// 'release' is called or the multipool is destroyed.  Calling
+// 'enableTrimming' enables trimming on every internal pool (see
+// 'bdlma_pool'): 'trim' then returns to the underlying allocator each chunk,
+// allocated after trimming was enabled, that has no block in use, and, if a
+// non-zero 'idleThreshold' is supplied, each pool trims itself once its idle
+// memory has grown by that amount.  The 'numBytesRetained' and
+// 'numBytesInUse' accessors report the memory held by, and the memory
+// dispensed from, the internal pools; memory blocks larger than
+// 'maxPooledBlockSize()' are not included, as they are returned to the
+// underlying allocator when deallocated.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -695,10 +709,35 @@ class Multipool {
         // no effect.  The behavior is undefined unless
         // 'size <= maxPooledBlockSize()' and '0 <= numBlocks'.
 
+    void enableTrimming(bsls::Types::size_type idleThreshold = 0);
+        // Enable trimming for each pool managed by this multipool object.
+        // Optionally specify an 'idleThreshold' (in bytes) that, if non-zero,
+        // causes each pool to trim itself automatically whenever its idle
+        // memory has grown by at least 'idleThreshold' since its previous
+        // trim.  See 'bdlma::Pool::enableTrimming'.
+
+    bsls::Types::size_type trim();
+        // Return to the underlying allocator every chunk held by the pools of
+        // this multipool object that was allocated after trimming was enabled
+        // and none of whose blocks is currently in use, and return the number
+        // of bytes released.  Note that this method returns 0 if trimming has
+        // never been enabled.
+
     // ACCESSORS
     int numPools() const;
         // Return the number of pools managed by this multipool object.
 
+    bsls::Types::size_type numBytesInUse() const;
+        // Return the number of bytes of pooled memory currently dispensed by
+        // this multipool object, including the per-block overhead.  Note that
+        // memory blocks larger than 'maxPooledBlockSize()' are not included.
+
+    bsls::Types::size_type numBytesRetained() const;
+        // Return the number of bytes currently obtained from the underlying
+        // allocator by the pools of this multipool object.  Note that
+        // 'numBytesRetained() - numBytesInUse()' is the pooled memory held
+        // idle by this multipool object.
+
     bsls::Types::size_type maxPooledBlockSize() const;
         // Return the maximum size of memory blocks that are pooled by this
         // multipool object.  Note that the maximum value is defined as:
@@ -66,9 +66,13 @@ using namespace bsl;
 // [ 9] int numPools() const;
 // [ 9] bsls::Types::size_type maxPooledBlockSize() const;
 // [10] bslma::Allocator *allocator() const;
+// [11] void enableTrimming(bsls::Types::size_type idleThreshold = 0);
+// [11] bsls::Types::size_type trim();
+// [11] bsls::Types::size_type numBytesInUse() const;
+// [11] bsls::Types::size_type numBytesRetained() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 // [ *] CONCERN: Precondition violations are detected when enabled.
 
 //=============================================================================
@@ -634,7 +638,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -683,6 +687,152 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING TRIMMING
+        //
+        // Concerns:
+        //: 1 'numBytesInUse' and 'numBytesRetained' sum the corresponding
+        //:   values over all pools, and exclude blocks that are not pooled.
+        //:
+        //: 2 'trim' releases no memory unless trimming is enabled.
+        //:
+        //: 3 After 'enableTrimming', 'trim' returns idle chunks of every pool
+        //:   to the underlying allocator, and reports the bytes released.
+        //:
+        //: 4 A non-zero 'idleThreshold' is applied to every pool.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of several sizes from multipools
+        //:   supplied with a test allocator, with and without trimming
+        //:   enabled, and verify the accessors, the values returned by 'trim',
+        //:   and the memory in use by the test allocator.  (C-1..4)
+        //
+        // Testing:
+        //   void enableTrimming(bsls::Types::size_type idleThreshold = 0);
+        //   bsls::Types::size_type trim();
+        //   bsls::Types::size_type numBytesInUse() const;
+        //   bsls::Types::size_type numBytesRetained() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING TRIMMING" << endl
+                                  << "================" << endl;
+
+        const int NUM_POOLS  = 4;
+        const int MAX_CHUNK  = 4;
+        const int NUM_BLOCKS = 4 * MAX_CHUNK;
+        const int SIZES[]    = { 1, 8, 20, 64 };
+        const int NUM_SIZES  = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (verbose) cout << "\nTesting with trimming disabled." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   MAX_CHUNK,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesRetained());
+
+            void *p = mX.allocate(X.maxPooledBlockSize() + 1);
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesRetained());
+            mX.deallocate(p);
+
+            void *q[NUM_SIZES][NUM_BLOCKS];
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                for (int j = 0; j < NUM_BLOCKS; ++j) {
+                    q[i][j] = mX.allocate(SIZES[i]);
+                }
+            }
+            ASSERT(0 <  X.numBytesInUse());
+            ASSERT(X.numBytesInUse() == X.numBytesRetained());
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                for (int j = 0; j < NUM_BLOCKS; ++j) {
+                    mX.deallocate(q[i][j]);
+                }
+            }
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 <  X.numBytesRetained());
+
+            const bsls::Types::Int64 numBytes = ta.numBytesInUse();
+            ASSERT(0        == mX.trim());
+            ASSERT(numBytes == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting with trimming enabled." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   MAX_CHUNK,
+                   &ta);
+            const Obj& X = mX;
+
+            mX.enableTrimming();
+
+            const bsls::Types::Int64 numBytesEmpty = ta.numBytesInUse();
+
+            void *q[NUM_SIZES][NUM_BLOCKS];
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                for (int j = 0; j < NUM_BLOCKS; ++j) {
+                    q[i][j] = mX.allocate(SIZES[i]);
+                }
+            }
+            ASSERT(0 == mX.trim());
+
+            // Keep the first block of each size.
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                for (int j = 1; j < NUM_BLOCKS; ++j) {
+                    mX.deallocate(q[i][j]);
+                }
+            }
+
+            const bsls::Types::size_type RETAINED = X.numBytesRetained();
+            const bsls::Types::size_type RELEASED = mX.trim();
+
+            ASSERT(0 < RELEASED);
+            ASSERT(RETAINED - RELEASED == X.numBytesRetained());
+            ASSERT(0 == mX.trim());
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                mX.deallocate(q[i][0]);
+            }
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 <  mX.trim());
+            ASSERT(0 == X.numBytesRetained());
+            ASSERT(numBytesEmpty == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting automatic trimming." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(NUM_POOLS,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   MAX_CHUNK,
+                   &ta);
+            const Obj& X = mX;
+
+            mX.enableTrimming(1);  // trim whenever a pool is fully idle
+
+            void *q[NUM_BLOCKS];
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                q[j] = mX.allocate(SIZES[0]);
+            }
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                mX.deallocate(q[j]);
+            }
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesRetained());
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // ALLOCATOR ACCESSOR TEST
@@ -30,9 +30,13 @@ BSLS_IDENT("$Id: $")
 //  ( bdlma::MultipoolAllocator )
 //   `-------------------------'
 //                |         ctor/dtor
+//                |         enableTrimming
 //                |         maxPooledBlockSize
+//                |         numBytesInUse
+//                |         numBytesRetained
 //                |         numPools
 //                |         reserveCapacity
+//                |         trim
 //                V
 //    ,-----------------------.
 //   ( bdlma::ManagedAllocator )
@@ -756,6 +760,19 @@ class MultipoolAllocator : public ManagedAllocator {
         // is 0, this method has no effect.  The behavior is undefined unless
         // 'size <= maxPooledBlockSize()' and '0 <= numObjects'.
 
+    void enableTrimming(bsls::Types::size_type idleThreshold = 0);
+        // Enable trimming for each pool managed by this multipool allocator.
+        // Optionally specify an 'idleThreshold' (in bytes) that, if non-zero,
+        // causes each pool to trim itself automatically whenever its idle
+        // memory has grown by at least 'idleThreshold' since its previous
+        // trim.  See 'bdlma::Multipool::enableTrimming'.
+
+    bsls::Types::size_type trim();
+        // Return to the underlying allocator every chunk held by the pools of
+        // this multipool allocator that was allocated after trimming was
+        // enabled and none of whose blocks is currently in use, and return
+        // the number of bytes released.
+
                                 // Virtual Functions
 
     virtual void *allocate(bsls::Types::size_type size);
@@ -779,6 +796,16 @@ class MultipoolAllocator : public ManagedAllocator {
     int numPools() const;
         // Return the number of pools managed by this multipool allocator.
 
+    bsls::Types::size_type numBytesInUse() const;
+        // Return the number of bytes of pooled memory currently dispensed by
+        // this multipool allocator, including the per-block overhead.  Note
+        // that memory blocks larger than 'maxPooledBlockSize()' are not
+        // included.
+
+    bsls::Types::size_type numBytesRetained() const;
+        // Return the number of bytes currently obtained from the underlying
+        // allocator by the pools of this multipool allocator.
+
     bsls::Types::size_type maxPooledBlockSize() const;
         // Return the maximum size of memory blocks that are pooled by this
         // multipool allocator.  Note that the maximum value is defined as:
@@ -910,6 +937,18 @@ void MultipoolAllocator::reserveCapacity(bsls::Types::size_type size,
     d_multipool.reserveCapacity(size, numObjects);
 }
 
+inline
+void MultipoolAllocator::enableTrimming(bsls::Types::size_type idleThreshold)
+{
+    d_multipool.enableTrimming(idleThreshold);
+}
+
+inline
+bsls::Types::size_type MultipoolAllocator::trim()
+{
+    return d_multipool.trim();
+}
+
 // ACCESSORS
 inline
 int MultipoolAllocator::numPools() const
@@ -917,6 +956,18 @@ int MultipoolAllocator::numPools() const
     return d_multipool.numPools();
 }
 
+inline
+bsls::Types::size_type MultipoolAllocator::numBytesInUse() const
+{
+    return d_multipool.numBytesInUse();
+}
+
+inline
+bsls::Types::size_type MultipoolAllocator::numBytesRetained() const
+{
+    return d_multipool.numBytesRetained();
+}
+
 inline
 bsls::Types::size_type MultipoolAllocator::maxPooledBlockSize() const
 {
@@ -61,9 +61,13 @@ using namespace bsl;
 // [ 5] void release();
 // [ 7] int numPools() const;
 // [ 7] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 8] void enableTrimming(bsls::Types::size_type idleThreshold = 0);
+// [ 8] bsls::Types::size_type trim();
+// [ 8] bsls::Types::size_type numBytesInUse() const;
+// [ 8] bsls::Types::size_type numBytesRetained() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ *] CONCERN: Precondition violations are detected when enabled.
 
 //=============================================================================
@@ -731,7 +735,7 @@ int main(int argc, char *argv[])
     bslma::Allocator     *Z = &testAllocator;
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -775,6 +779,58 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING TRIMMING
+        //
+        // Concerns:
+        //: 1 The trimming methods forward to the underlying multipool.
+        //
+        // Plan:
+        //: 1 Enable trimming on a multipool allocator supplied with a test
+        //:   allocator, allocate and deallocate blocks through the
+        //:   'bslma::Allocator' protocol, and verify the accessors and the
+        //:   memory returned by 'trim'.  (C-1)
+        //
+        // Testing:
+        //   void enableTrimming(bsls::Types::size_type idleThreshold = 0);
+        //   bsls::Types::size_type trim();
+        //   bsls::Types::size_type numBytesInUse() const;
+        //   bsls::Types::size_type numBytesRetained() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING TRIMMING" << endl
+                                  << "================" << endl;
+
+        enum { k_NUM_BLOCKS = 64 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Obj mX(4, bsls::BlockGrowth::BSLS_CONSTANT, 8, &ta);
+        const Obj& X = mX;
+        bslma::Allocator& alloc = mX;
+
+        mX.enableTrimming();
+        const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+        void *p[k_NUM_BLOCKS];
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            p[i] = alloc.allocate(1 + i % 32);
+        }
+        ASSERT(0 <  X.numBytesInUse());
+        ASSERT(X.numBytesInUse() == X.numBytesRetained());
+        ASSERT(0 == mX.trim());
+
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            alloc.deallocate(p[i]);
+        }
+        ASSERT(0 == X.numBytesInUse());
+
+        const bsls::Types::size_type RETAINED = X.numBytesRetained();
+        ASSERT(RETAINED  == mX.trim());
+        ASSERT(0         == X.numBytesRetained());
+        ASSERT(NUM_BYTES == ta.numBytesInUse());
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING 'numPools' and 'maxPooledBlockSize'
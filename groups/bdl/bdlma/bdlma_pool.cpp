@@ -44,6 +44,54 @@ bsls::Types::size_type roundUp(bsls::Types::size_type x,
     return (x + y - 1) / y * y;
 }
 
+}  // close unnamed namespace
+
+                             // -----------------
+                             // struct Pool::Chunk
+                             // -----------------
+
+struct Pool::Chunk {
+    // This 'struct' describes a chunk allocated while trimming is enabled.
+
+    char                   *d_begin_p;    // address of the first block
+    bsls::Types::size_type  d_numBlocks;  // number of blocks in the chunk
+    bsls::Types::size_type  d_numFree;    // number of free blocks found in
+                                          // the chunk (used only by 'trim')
+
+    bool operator<(const Chunk& rhs) const
+        // Return 'true' if this chunk is located before the specified 'rhs'
+        // chunk, and 'false' otherwise.
+    {
+        return d_begin_p < rhs.d_begin_p;
+    }
+};
+
+namespace {
+
+template <class CHUNK>
+CHUNK *findChunk(CHUNK                  *chunks,
+                 int                     numChunks,
+                 bsls::Types::size_type  internalBlockSize,
+                 void                   *address)
+    // Return the address of the element of the specified 'chunks' array of
+    // the specified 'numChunks' elements (sorted by address) that contains
+    // the specified 'address', given the specified 'internalBlockSize', or 0
+    // if no such chunk exists.
+{
+    CHUNK key;
+    key.d_begin_p = static_cast<char *>(address);
+
+    CHUNK *it = bsl::upper_bound(chunks, chunks + numChunks, key);
+    if (it == chunks) {
+        return 0;                                                     // RETURN
+    }
+    --it;
+    return key.d_begin_p < it->d_begin_p
+                                         + it->d_numBlocks * internalBlockSize
+           ? it
+           : 0;
+}
+
 }  // close unnamed namespace
 
                                 // ----------
@@ -51,11 +99,62 @@ bsls::Types::size_type roundUp(bsls::Types::size_type x,
                                 // ----------
 
 // PRIVATE MANIPULATORS
+char *Pool::allocateChunk(int numBlocks)
+{
+    const bsls::Types::size_type size = numBlocks * d_internalBlockSize;
+
+    char *chunk;
+
+    if (!d_trimmingEnabled) {
+        chunk = static_cast<char *>(d_blockList.allocate(size));
+    }
+    else {
+        bslma::Allocator *allocator = d_blockList.allocator();
+
+        if (d_numChunks == d_chunkCapacity) {
+            const int newCapacity = d_chunkCapacity ? d_chunkCapacity * 2 : 8;
+
+            Chunk *newChunks = static_cast<Chunk *>(allocator->allocate(
+                                                newCapacity * sizeof(Chunk)));
+            if (d_chunks_p) {
+                bsl::copy(d_chunks_p, d_chunks_p + d_numChunks, newChunks);
+                allocator->deallocate(d_chunks_p);
+            }
+            d_chunks_p      = newChunks;
+            d_chunkCapacity = newCapacity;
+        }
+
+        chunk = static_cast<char *>(allocator->allocate(size));
+
+        Chunk& descriptor      = d_chunks_p[d_numChunks++];
+        descriptor.d_begin_p   = chunk;
+        descriptor.d_numBlocks = numBlocks;
+        descriptor.d_numFree   = 0;
+    }
+
+    d_numBytesRetained += size;
+
+    return chunk;
+}
+
+void Pool::releaseTrackedChunks()
+{
+    bslma::Allocator *allocator = d_blockList.allocator();
+
+    for (int i = 0; i < d_numChunks; ++i) {
+        allocator->deallocate(d_chunks_p[i].d_begin_p);
+    }
+    allocator->deallocate(d_chunks_p);
+
+    d_chunks_p      = 0;
+    d_numChunks     = 0;
+    d_chunkCapacity = 0;
+}
+
 void Pool::replenish()
 {
-    d_begin_p = static_cast<char *>(d_blockList.allocate(d_chunkSize
-                                                       * d_internalBlockSize));
-    d_end_p = d_begin_p + d_chunkSize * d_internalBlockSize;
+    d_begin_p = allocateChunk(d_chunkSize);
+    d_end_p   = d_begin_p + d_chunkSize * d_internalBlockSize;
 
     if (   bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
         && d_chunkSize < d_maxBlocksPerChunk) {
@@ -71,6 +170,19 @@ void Pool::replenish()
     }
 }
 
+void Pool::trimIfIdle()
+{
+    const bsls::Types::size_type idleBytes = d_numBytesRetained
+                                                           - numBytesInUse();
+
+    if (idleBytes >= d_nextTrimIdleBytes) {
+        trim();
+
+        d_nextTrimIdleBytes = d_numBytesRetained - numBytesInUse()
+                                                            + d_idleThreshold;
+    }
+}
+
 // CREATORS
 Pool::Pool(bsls::Types::size_type blockSize, bslma::Allocator *basicAllocator)
 : d_blockSize(blockSize)
@@ -81,6 +193,14 @@ Pool::Pool(bsls::Types::size_type blockSize, bslma::Allocator *basicAllocator)
 , d_blockList(basicAllocator)
 , d_begin_p(0)
 , d_end_p(0)
+, d_numBlocksInUse(0)
+, d_numBytesRetained(0)
+, d_trimmingEnabled(false)
+, d_idleThreshold(0)
+, d_nextTrimIdleBytes(0)
+, d_chunks_p(0)
+, d_numChunks(0)
+, d_chunkCapacity(0)
 {
     BSLS_ASSERT(1 <= blockSize);
 
@@ -101,6 +221,14 @@ Pool::Pool(bsls::Types::size_type       blockSize,
 , d_blockList(basicAllocator)
 , d_begin_p(0)
 , d_end_p(0)
+, d_numBlocksInUse(0)
+, d_numBytesRetained(0)
+, d_trimmingEnabled(false)
+, d_idleThreshold(0)
+, d_nextTrimIdleBytes(0)
+, d_chunks_p(0)
+, d_numChunks(0)
+, d_chunkCapacity(0)
 {
     BSLS_ASSERT(1 <= blockSize);
 
@@ -122,6 +250,14 @@ Pool::Pool(bsls::Types::size_type       blockSize,
 , d_blockList(basicAllocator)
 , d_begin_p(0)
 , d_end_p(0)
+, d_numBlocksInUse(0)
+, d_numBytesRetained(0)
+, d_trimmingEnabled(false)
+, d_idleThreshold(0)
+, d_nextTrimIdleBytes(0)
+, d_chunks_p(0)
+, d_numChunks(0)
+, d_chunkCapacity(0)
 {
     BSLS_ASSERT(1 <= blockSize);
     BSLS_ASSERT(1 <= maxBlocksPerChunk);
@@ -134,9 +270,21 @@ Pool::~Pool()
 {
     BSLS_ASSERT(sizeof(Link) <= d_internalBlockSize);
     BSLS_ASSERT(0 < d_chunkSize);
+
+    if (d_chunks_p) {
+        releaseTrackedChunks();
+    }
 }
 
 // MANIPULATORS
+void Pool::enableTrimming(bsls::Types::size_type idleThreshold)
+{
+    d_trimmingEnabled   = true;
+    d_idleThreshold     = idleThreshold;
+    d_nextTrimIdleBytes = d_numBytesRetained - numBytesInUse()
+                                                              + idleThreshold;
+}
+
 void Pool::reserveCapacity(int numBlocks)
 {
     BSLS_ASSERT(0 <= numBlocks);
@@ -148,9 +296,8 @@ void Pool::reserveCapacity(int numBlocks)
     }
 
     if (numBlocks > 0 && d_end_p == d_begin_p) {
-        d_begin_p = static_cast<char *>(d_blockList.allocate(numBlocks
-                                                       * d_internalBlockSize));
-        d_end_p = d_begin_p + numBlocks * d_internalBlockSize;
+        d_begin_p = allocateChunk(numBlocks);
+        d_end_p   = d_begin_p + numBlocks * d_internalBlockSize;
         return;                                                       // RETURN
     }
 
@@ -160,7 +307,7 @@ void Pool::reserveCapacity(int numBlocks)
 
         // Allocate memory and add its blocks to the free list.
 
-        void *blocks = d_blockList.allocate(numBlocks * d_internalBlockSize);
+        void *blocks = allocateChunk(numBlocks);
         char *p = static_cast<char *>(blocks);
         for (int i = 1; i < numBlocks; ++i) {
             Link *plink = static_cast<Link *>(static_cast<void *>(p));
@@ -175,6 +322,97 @@ void Pool::reserveCapacity(int numBlocks)
     }
 }
 
+bsls::Types::size_type Pool::trim()
+{
+    if (0 == d_numChunks) {
+        return 0;                                                     // RETURN
+    }
+
+    Chunk *const chunks    = d_chunks_p;
+    const int    numChunks = d_numChunks;
+
+    bsl::sort(chunks, chunks + numChunks);
+    for (int i = 0; i < numChunks; ++i) {
+        chunks[i].d_numFree = 0;
+    }
+
+    // Count the free blocks of each tracked chunk, including the blocks of the
+    // current chunk that have not yet been dispensed.
+
+    for (Link *p = d_freeList_p; p; p = p->d_next_p) {
+        Chunk *chunk = findChunk(chunks, numChunks, d_internalBlockSize, p);
+        if (chunk) {
+            ++chunk->d_numFree;
+        }
+    }
+
+    Chunk *current = 0;
+    if (d_begin_p != d_end_p) {
+        current = findChunk(chunks, numChunks, d_internalBlockSize, d_begin_p);
+        if (current) {
+            current->d_numFree += (d_end_p - d_begin_p) / d_internalBlockSize;
+        }
+    }
+
+    bool found = false;
+    for (int i = 0; i < numChunks; ++i) {
+        if (chunks[i].d_numFree == chunks[i].d_numBlocks) {
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        return 0;                                                     // RETURN
+    }
+
+    // Unlink the blocks of the idle chunks from the free list.
+
+    Link **prevNext = &d_freeList_p;
+    while (*prevNext) {
+        Chunk *chunk = findChunk(chunks,
+                                 numChunks,
+                                 d_internalBlockSize,
+                                 *prevNext);
+        if (chunk && chunk->d_numFree == chunk->d_numBlocks) {
+            *prevNext = (*prevNext)->d_next_p;
+        }
+        else {
+            prevNext = &(*prevNext)->d_next_p;
+        }
+    }
+
+    if (current && current->d_numFree == current->d_numBlocks) {
+        d_begin_p = 0;
+        d_end_p   = 0;
+    }
+
+    // Return the idle chunks to the underlying allocator, compacting the array
+    // of remaining chunks.
+
+    bslma::Allocator       *allocator = d_blockList.allocator();
+    bsls::Types::size_type  released  = 0;
+    int                     numKept   = 0;
+
+    for (int i = 0; i < numChunks; ++i) {
+        if (chunks[i].d_numFree == chunks[i].d_numBlocks) {
+            released += chunks[i].d_numBlocks * d_internalBlockSize;
+            allocator->deallocate(chunks[i].d_begin_p);
+        }
+        else {
+            chunks[numKept++] = chunks[i];
+        }
+    }
+
+    d_numChunks         = numKept;
+    d_numBytesRetained -= released;
+
+    if (0 == numKept) {
+        releaseTrackedChunks();
+    }
+
+    return released;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -72,6 +72,26 @@ BSLS_IDENT("$Id: $")
 // currently installed default allocator at the time the 'bdlma::Pool' was
 // created.
 //
+///Trimming Idle Memory
+///--------------------
+// By default, a 'bdlma::Pool' returns the chunks it allocates to the
+// underlying allocator only when 'release' is called or the pool is destroyed,
+// so that a long-lived pool retains the memory needed at its peak usage.
+// Clients that prefer to give idle memory back can opt in to *trimming* by
+// calling 'enableTrimming'.  Chunks allocated while trimming is enabled are
+// tracked individually, and each call to 'trim' returns every tracked chunk
+// none of whose blocks is in use to the underlying allocator (which, in turn,
+// may return the memory to the operating system).  If a non-zero
+// 'idleThreshold' is supplied to 'enableTrimming', 'deallocate' calls 'trim'
+// automatically whenever the number of idle bytes held by the pool has grown
+// by more than 'idleThreshold' since the previous trim.  Note that 'trim'
+// sweeps the free list, and so takes time proportional to the number of free
+// blocks; the fast paths of 'allocate' and 'deallocate' are unaffected.
+//
+// The 'numBytesRetained' and 'numBytesInUse' accessors report, respectively,
+// the number of bytes obtained from the underlying allocator (and not yet
+// returned), and the number of those bytes currently dispensed to clients.
+//
 ///Overloaded Global Operator 'new'
 ///--------------------------------
 // This component overloads the global 'operator new' to allow convenient
@@ -270,6 +290,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_blockgrowth.h>
+#include <bsls_performancehint.h>
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>
@@ -299,6 +320,10 @@ class Pool {
         Link *d_next_p;  // pointer to next link
     };
 
+    struct Chunk;
+        // Descriptor of a chunk allocated while trimming is enabled (defined
+        // in the '.cpp' file).
+
     // DATA
     bsls::Types::size_type  d_blockSize;          // size (in bytes) of each
                                                   // allocated memory block
@@ -332,12 +357,49 @@ class Pool {
     char                   *d_end_p;              // end of a contiguous group
                                                   // of memory blocks
 
+    bsls::Types::size_type  d_numBlocksInUse;     // number of blocks currently
+                                                  // dispensed to clients
+
+    bsls::Types::size_type  d_numBytesRetained;   // number of bytes allocated
+                                                  // from the underlying
+                                                  // allocator for chunks
+
+    bool                    d_trimmingEnabled;    // 'true' if new chunks are
+                                                  // tracked for trimming
+
+    bsls::Types::size_type  d_idleThreshold;      // idle-byte growth that
+                                                  // triggers an automatic
+                                                  // 'trim' (0 if none)
+
+    bsls::Types::size_type  d_nextTrimIdleBytes;  // number of idle bytes at
+                                                  // which 'deallocate' next
+                                                  // calls 'trim'
+
+    Chunk                  *d_chunks_p;           // array of tracked chunks
+
+    int                     d_numChunks;          // number of tracked chunks
+
+    int                     d_chunkCapacity;      // capacity of 'd_chunks_p'
+
   private:
     // PRIVATE MANIPULATORS
+    char *allocateChunk(int numBlocks);
+        // Return the address of a newly allocated chunk of the specified
+        // 'numBlocks' blocks, tracking the chunk for trimming if trimming is
+        // enabled.
+
+    void releaseTrackedChunks();
+        // Return every tracked chunk, and the array describing them, to the
+        // underlying allocator.
+
     void replenish();
         // Dynamically allocate a new chunk using this pool's underlying growth
         // strategy.
 
+    void trimIfIdle();
+        // Call 'trim' if the number of idle bytes held by this pool has
+        // reached 'd_nextTrimIdleBytes', and recompute 'd_nextTrimIdleBytes'.
+
   private:
     // NOT IMPLEMENTED
     Pool(const Pool&);
@@ -406,6 +468,17 @@ class Pool {
         // it was originally dispensed by this pool), was allocated using this
         // pool, and has not already been deallocated.
 
+    void enableTrimming(bsls::Types::size_type idleThreshold = 0);
+        // Enable trimming for this pool: chunks allocated after this call are
+        // tracked so that 'trim' can return them to the underlying allocator
+        // once none of their blocks is in use.  Optionally specify an
+        // 'idleThreshold' (in bytes); if 'idleThreshold' is non-zero,
+        // 'deallocate' calls 'trim' whenever the number of idle bytes held by
+        // this pool (i.e., 'numBytesRetained() - numBytesInUse()') has grown
+        // by at least 'idleThreshold' since the previous trim.  Calling this
+        // method again changes the threshold.  Note that chunks allocated
+        // before trimming was enabled are never trimmed.
+
     void release();
         // Relinquish all memory currently allocated via this pool object.
 
@@ -414,12 +487,32 @@ class Pool {
         // least the specified 'numBlocks' before the pool replenishes.  The
         // behavior is undefined unless '0 <= numBlocks'.
 
+    bsls::Types::size_type trim();
+        // Return to the underlying allocator every chunk allocated while
+        // trimming was enabled none of whose blocks is currently in use, and
+        // return the number of bytes so released.  This method has no effect
+        // if trimming has never been enabled.
+
     // ACCESSORS
     bsls::Types::size_type blockSize() const;
         // Return the size (in bytes) of the memory blocks allocated from this
         // pool object.  Note that all blocks dispensed by this pool have the
         // same size.
 
+    bool isTrimmingEnabled() const;
+        // Return 'true' if trimming is enabled for this pool, and 'false'
+        // otherwise.
+
+    bsls::Types::size_type numBytesInUse() const;
+        // Return the number of bytes in the blocks currently dispensed by this
+        // pool, including the per-block alignment overhead.
+
+    bsls::Types::size_type numBytesRetained() const;
+        // Return the number of bytes of chunk memory currently obtained by
+        // this pool from the underlying allocator.  Note that the difference
+        // 'numBytesRetained() - numBytesInUse()' is the memory held idle by
+        // this pool.
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -513,12 +606,18 @@ void *Pool::allocate()
         if (d_freeList_p) {
             Link *p      = d_freeList_p;
             d_freeList_p = p->d_next_p;
+            ++d_numBlocksInUse;
             return p;                                                 // RETURN
         }
 
         replenish();
     }
 
+    // 'd_numBlocksInUse' is incremented only once a block is obtained, so
+    // that it is not left inflated if 'replenish' throws.
+
+    ++d_numBlocksInUse;
+
     char *p = d_begin_p;
     d_begin_p += d_internalBlockSize;
     return p;
@@ -528,9 +627,18 @@ inline
 void Pool::deallocate(void *address)
 {
     BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(0 < d_numBlocksInUse);
 
     static_cast<Link *>(address)->d_next_p = d_freeList_p;
     d_freeList_p = static_cast<Link *>(address);
+
+    --d_numBlocksInUse;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != d_idleThreshold)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        trimIfIdle();
+    }
 }
 
 template <class TYPE>
@@ -551,9 +659,15 @@ inline
 void Pool::release()
 {
     d_blockList.release();
+    if (d_chunks_p) {
+        releaseTrackedChunks();
+    }
     d_freeList_p = 0;
     d_begin_p = 0;
     d_end_p = 0;
+    d_numBlocksInUse    = 0;
+    d_numBytesRetained  = 0;
+    d_nextTrimIdleBytes = d_idleThreshold;
 }
 
 // ACCESSORS
@@ -563,6 +677,24 @@ bsls::Types::size_type Pool::blockSize() const
     return d_blockSize;
 }
 
+inline
+bool Pool::isTrimmingEnabled() const
+{
+    return d_trimmingEnabled;
+}
+
+inline
+bsls::Types::size_type Pool::numBytesInUse() const
+{
+    return d_numBlocksInUse * d_internalBlockSize;
+}
+
+inline
+bsls::Types::size_type Pool::numBytesRetained() const
+{
+    return d_numBytesRetained;
+}
+
 // Aspects
 
 inline
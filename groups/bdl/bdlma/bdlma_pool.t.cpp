@@ -69,8 +69,13 @@ using namespace bsl;
 // [ 7] void *operator new(bsl::size_t size, bdlma::Pool& pool);
 // [ 8] void operator delete(void *address, bdlma::Pool& pool);
 // [12] bslma::Allocator *allocator() const;
+// [13] void enableTrimming(idleThreshold = 0);
+// [13] bsls::Types::size_type trim();
+// [13] bool isTrimmingEnabled() const;
+// [13] bsls::Types::size_type numBytesInUse() const;
+// [13] bsls::Types::size_type numBytesRetained() const;
 //-----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 2] 'allocate' returns memory of the correct block size.
 // [ 1] int blockSize(numBytes);
 // [ 1] int poolBlockSize(size);
@@ -508,7 +513,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -564,6 +569,248 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TRIMMING TEST
+        //
+        // Concerns:
+        //: 1 Trimming is disabled by default, and 'trim' then releases no
+        //:   memory.
+        //:
+        //: 2 'numBytesInUse' and 'numBytesRetained' track, respectively, the
+        //:   blocks handed out and the chunks obtained from the allocator.
+        //:
+        //: 3 'trim' returns to the allocator exactly those chunks allocated
+        //:   after 'enableTrimming' none of whose blocks is in use, and
+        //:   returns the number of bytes released.
+        //:
+        //: 4 Blocks remaining after a trim are still usable, and the pool
+        //:   allocates new chunks as needed after a trim.
+        //:
+        //: 5 A non-zero 'idleThreshold' causes 'deallocate' to trim
+        //:   automatically.
+        //:
+        //: 6 'release' and the destructor free tracked chunks.
+        //:
+        //: 7 An 'allocate' that fails to obtain memory does not change
+        //:   'numBytesInUse'.
+        //
+        // Plan:
+        //: 1 Using a test allocator, allocate and deallocate blocks with and
+        //:   without trimming enabled, and verify the accessors and the
+        //:   memory in use by the test allocator after each 'trim'.
+        //:   (C-1..4)
+        //:
+        //: 2 Enable trimming with a threshold, deallocate all blocks, and
+        //:   verify that the idle memory was returned.  (C-5)
+        //:
+        //: 3 Invoke 'release', and let a pool holding tracked chunks go out
+        //:   of scope, verifying that all memory is returned.  (C-6)
+        //:
+        //: 4 Allocate blocks using a test allocator that throws, then verify
+        //:   that 'numBytesInUse' reflects only the blocks obtained, and that
+        //:   all memory can be trimmed once they are freed.  (C-7)
+        //
+        // Testing:
+        //   void enableTrimming(idleThreshold = 0);
+        //   bsls::Types::size_type trim();
+        //   bool isTrimmingEnabled() const;
+        //   bsls::Types::size_type numBytesInUse() const;
+        //   bsls::Types::size_type numBytesRetained() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TRIMMING TEST" << endl
+                                  << "=============" << endl;
+
+        const int BLOCK_SIZE = 8;
+        const int CHUNK_SIZE = 4;
+        const int NUM_BLOCKS = 4 * CHUNK_SIZE;
+        const int IBS        = poolBlockSize(BLOCK_SIZE);
+
+        if (verbose) cout << "\nTesting with trimming disabled." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   CHUNK_SIZE,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERT(false == X.isTrimmingEnabled());
+            ASSERT(0     == X.numBytesInUse());
+            ASSERT(0     == X.numBytesRetained());
+
+            void *p[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                p[i] = mX.allocate();
+            }
+            ASSERT(NUM_BLOCKS * IBS == static_cast<int>(X.numBytesInUse()));
+            ASSERT(NUM_BLOCKS * IBS == static_cast<int>(X.numBytesRetained()));
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(p[i]);
+            }
+            ASSERT(0                == X.numBytesInUse());
+            ASSERT(NUM_BLOCKS * IBS == static_cast<int>(X.numBytesRetained()));
+
+            const bsls::Types::Int64 numBytes = ta.numBytesInUse();
+            ASSERT(0        == mX.trim());
+            ASSERT(numBytes == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting explicit 'trim'." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   CHUNK_SIZE,
+                   &ta);
+            const Obj& X = mX;
+
+            // A chunk allocated before trimming is enabled is never trimmed.
+
+            void *q = mX.allocate();
+            mX.deallocate(q);
+
+            mX.enableTrimming();
+            ASSERT(true == X.isTrimmingEnabled());
+
+            for (int i = 0; i < CHUNK_SIZE; ++i) {
+                mX.allocate();  // exhaust the untracked chunk
+            }
+
+            void *p[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                p[i] = mX.allocate();
+            }
+            ASSERT((NUM_BLOCKS + CHUNK_SIZE) * IBS ==
+                                         static_cast<int>(X.numBytesInUse()));
+            ASSERT((NUM_BLOCKS + CHUNK_SIZE) * IBS ==
+                                      static_cast<int>(X.numBytesRetained()));
+
+            // Nothing is idle yet.
+
+            ASSERT(0 == mX.trim());
+
+            // Free every block except one in the first tracked chunk.
+
+            for (int i = 1; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(p[i]);
+            }
+
+            const bsls::Types::Int64 numBytes = ta.numBytesInUse();
+
+            const int RELEASED = static_cast<int>(mX.trim());
+            ASSERTV(RELEASED, (NUM_BLOCKS - CHUNK_SIZE) * IBS == RELEASED);
+
+            ASSERT(2 * CHUNK_SIZE * IBS ==
+                                      static_cast<int>(X.numBytesRetained()));
+            ASSERT((CHUNK_SIZE + 1) * IBS ==
+                                         static_cast<int>(X.numBytesInUse()));
+            ASSERT(numBytes > ta.numBytesInUse());
+            ASSERT(0 == mX.trim());
+
+            // The remaining free blocks are still usable, and the pool grows
+            // again as needed.
+
+            for (int i = 1; i < NUM_BLOCKS; ++i) {
+                p[i] = mX.allocate();
+                memset(p[i], 0xa5, BLOCK_SIZE);
+            }
+            ASSERT((NUM_BLOCKS + CHUNK_SIZE) * IBS ==
+                                         static_cast<int>(X.numBytesInUse()));
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(p[i]);
+            }
+            ASSERT(CHUNK_SIZE * IBS == static_cast<int>(X.numBytesInUse()));
+
+            ASSERT(NUM_BLOCKS * IBS == static_cast<int>(mX.trim()));
+            ASSERT(CHUNK_SIZE * IBS ==
+                                      static_cast<int>(X.numBytesRetained()));
+
+            mX.release();
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesRetained());
+            ASSERT(0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting automatic trimming." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   CHUNK_SIZE,
+                   &ta);
+            const Obj& X = mX;
+
+            mX.enableTrimming(2 * CHUNK_SIZE * IBS);
+
+            void *p[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                p[i] = mX.allocate();
+            }
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(p[i]);
+            }
+            ASSERT(0 == X.numBytesInUse());
+            ASSERTV(X.numBytesRetained(),
+                    static_cast<int>(X.numBytesRetained())
+                                                      < 2 * CHUNK_SIZE * IBS);
+        }
+
+        if (verbose) cout << "\nTesting allocation failure." << endl;
+        {
+            // A failed 'allocate' must not leave the pool accounting for a
+            // block in use, or the pool would never again be found idle.
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   CHUNK_SIZE,
+                   &ta);
+            const Obj& X = mX;
+
+            mX.enableTrimming();
+
+            void *p[NUM_BLOCKS];
+            int   numAllocated = 0;
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                while (numAllocated < NUM_BLOCKS) {
+                    p[numAllocated] = mX.allocate();
+                    ++numAllocated;
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(X.numBytesInUse(),
+                    NUM_BLOCKS * IBS == static_cast<int>(X.numBytesInUse()));
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(p[i]);
+            }
+            ASSERT(0 == X.numBytesInUse());
+
+            mX.trim();
+            ASSERT(0 == X.numBytesRetained());
+        }
+
+        if (verbose) cout << "\nTesting destructor." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            {
+                Obj mX(BLOCK_SIZE, &ta);
+                mX.enableTrimming();
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    mX.allocate();
+                }
+                mX.reserveCapacity(NUM_BLOCKS);
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // ALLOCATOR ACCESSOR TEST
@@ -22,8 +22,10 @@ BSLS_IDENT("$Id: $")
 //   `--------------------------'
 //                |         ctor/dtor
 //                |         allocateAndExpand
+//                |         mark
 //                |         reserveCapacity
 //                |         rewind
+//                |         rewindTo
 //                |         truncate
 //                V
 //    ,-----------------------.
@@ -48,6 +50,13 @@ BSLS_IDENT("$Id: $")
 // growth of the allocator (i.e., large blocks).  Note that individually
 // allocated memory blocks cannot be separately deallocated.
 //
+// In addition, the 'mark' method returns a checkpoint capturing the current
+// allocation state of the allocator, and the 'rewindTo' method releases all
+// memory allocated through the allocator since a checkpoint was taken (see
+// 'Checkpoints' in 'bdlma_sequentialpool').  Checkpoints may be nested,
+// allowing a single allocator to be reused across nested phases of a
+// computation (e.g., the phases of a parser) without destroying its arena.
+//
 // The main difference between a 'bdlma::SequentialAllocator' and a
 // 'bdlma::SequentialPool' is that, very often, a 'bdlma::SequentialAllocator'
 // is managed through a 'bslma::Allocator' pointer.  Hence, every call to the
@@ -238,6 +247,11 @@ class SequentialAllocator : public ManagedAllocator {
     SequentialAllocator& operator=(const SequentialAllocator&);
 
   public:
+    // TYPES
+    typedef SequentialPool::Checkpoint Checkpoint;
+        // 'Checkpoint' is an alias for an opaque token capturing the
+        // allocation state of a sequential allocator (see 'mark').
+
     // CREATORS
     explicit SequentialAllocator(bslma::Allocator *basicAllocator = 0);
     explicit SequentialAllocator(
@@ -373,6 +387,21 @@ class SequentialAllocator : public ManagedAllocator {
         // 'rewind' - using a pointer obtained from this object prior to this
         // call to 'rewind' is undefined.
 
+    void rewindTo(const Checkpoint& checkpoint);
+        // Release all memory allocated through this allocator since the
+        // specified 'checkpoint' was obtained from 'mark', and return to the
+        // underlying allocator *only* memory obtained since then that was
+        // allocated outside of the typical internal buffer growth of this
+        // allocator (i.e., large blocks).  All retained memory will be used to
+        // satisfy subsequent allocations.  Every checkpoint obtained before
+        // 'checkpoint' remains valid, and every checkpoint obtained after it
+        // is invalidated.  The behavior is undefined unless 'checkpoint' is
+        // default-constructed, or was obtained from this allocator and has
+        // not been invalidated by a call to 'release', 'rewind', or
+        // 'rewindTo'.  The effect of subsequently - to this invocation of
+        // 'rewindTo' - using a pointer obtained from this object after
+        // 'checkpoint' was obtained is undefined.
+
     void reserveCapacity(bsls::Types::size_type numBytes);
         // Reserve sufficient memory to satisfy allocation requests for at
         // least the specified 'numBytes' without replenishment (i.e., without
@@ -396,6 +425,12 @@ class SequentialAllocator : public ManagedAllocator {
         // at 'address' is 'originalSize', 'newSize <= originalSize', and
         // 'release' was not called after allocating the memory block at
         // 'address'.
+
+    // ACCESSORS
+    Checkpoint mark() const;
+        // Return a checkpoint capturing the current allocation state of this
+        // allocator, which may be supplied to 'rewindTo' to release all memory
+        // allocated through this allocator after this call.
 };
 
 // ============================================================================
@@ -581,6 +616,12 @@ void SequentialAllocator::rewind()
     d_sequentialPool.rewind();
 }
 
+inline
+void SequentialAllocator::rewindTo(const Checkpoint& checkpoint)
+{
+    d_sequentialPool.rewindTo(checkpoint);
+}
+
 inline
 bsls::Types::size_type SequentialAllocator::truncate(
                                           void                   *address,
@@ -590,6 +631,13 @@ bsls::Types::size_type SequentialAllocator::truncate(
     return d_sequentialPool.truncate(address, originalSize, newSize);
 }
 
+// ACCESSORS
+inline
+SequentialAllocator::Checkpoint SequentialAllocator::mark() const
+{
+    return d_sequentialPool.mark();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -76,11 +76,15 @@ using namespace bsl;
 // [ 3] void deallocate(void *address);
 // [ 4] void release();
 // [ 5] void rewind();
+// [ 8] void rewindTo(const Checkpoint& checkpoint);
 // [ 7] void reserveCapacity(int numBytes);
 // [ 6] int truncate(void *address, int originalSize, int newSize);
+//
+// // ACCESSORS
+// [ 8] Checkpoint mark() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE TEST
+// [ 9] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -286,7 +290,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -316,6 +320,89 @@ int main(int argc, char *argv[])
         my_DoubleStack dstack(&sequentialAlloc);
 //..
 
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // 'mark' AND 'rewindTo' TEST
+        //
+        // Concerns:
+        //   1) That 'mark' and 'rewindTo' are correctly proxied to the
+        //      sequential pool, so that memory allocated after a checkpoint
+        //      is reused after rewinding to it.
+        //
+        //   2) That 'rewindTo' returns large blocks allocated after the
+        //      checkpoint (and only those) to the underlying allocator.
+        //
+        //   3) That checkpoints nest.
+        //
+        // Plan:
+        //   Create a sequential allocator and a sequential pool using two
+        //   different test allocators.  Perform the same allocations, take
+        //   checkpoints, and rewind to them on both, and verify that the
+        //   addresses returned by the allocator after each 'rewindTo' match
+        //   those originally returned, and that both test allocators hold the
+        //   same amount of memory throughout.  Use a maximum buffer size so
+        //   that large blocks are involved.
+        //
+        // Testing:
+        //   void rewindTo(const Checkpoint& checkpoint);
+        //   Checkpoint mark() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'mark' AND 'rewindTo' TEST" << endl
+                                  << "==========================" << endl;
+
+        enum { k_INITIAL_SIZE = 64, k_MAX_BUFFER_SIZE = 1024 };
+
+        bslma::TestAllocator poolAllocator("Pool Allocator",
+                                           veryVeryVeryVerbose);
+        {
+            Obj mX(k_INITIAL_SIZE, k_MAX_BUFFER_SIZE, &objectAllocator);
+            const Obj& X = mX;
+
+            bdlma::SequentialPool pool(k_INITIAL_SIZE,
+                                       k_MAX_BUFFER_SIZE,
+                                       &poolAllocator);
+
+            mX.allocate(16);  pool.allocate(16);
+
+            const Obj::Checkpoint cp1 = X.mark();
+            const bdlma::SequentialPool::Checkpoint pcp1 = pool.mark();
+
+            void *b = mX.allocate(500);   pool.allocate(500);
+            mX.allocate(2000);            pool.allocate(2000);  // large
+
+            const Obj::Checkpoint cp2 = X.mark();
+            const bdlma::SequentialPool::Checkpoint pcp2 = pool.mark();
+
+            void *d = mX.allocate(700);   pool.allocate(700);
+            mX.allocate(5000);            pool.allocate(5000);  // large
+
+            ASSERT(objectAllocator.numBytesInUse() ==
+                                                poolAllocator.numBytesInUse());
+
+            const bsls::Types::Int64 numBlocks =
+                                              objectAllocator.numBlocksInUse();
+
+            mX.rewindTo(cp2);  pool.rewindTo(pcp2);
+
+            ASSERT(numBlocks - 1 == objectAllocator.numBlocksInUse());
+            ASSERT(objectAllocator.numBytesInUse() ==
+                                                poolAllocator.numBytesInUse());
+
+            ASSERT(d == mX.allocate(700));  pool.allocate(700);
+
+            mX.rewindTo(cp1);  pool.rewindTo(pcp1);
+
+            ASSERT(numBlocks - 2 == objectAllocator.numBlocksInUse());
+            ASSERT(objectAllocator.numBytesInUse() ==
+                                                poolAllocator.numBytesInUse());
+
+            ASSERT(b == mX.allocate(500));
+        }
+        ASSERT(0 == objectAllocator.numBytesInUse());
+        ASSERT(0 == poolAllocator.numBytesInUse());
+
       } break;
       case 7: {
         // --------------------------------------------------------------------
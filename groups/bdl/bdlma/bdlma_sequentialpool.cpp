@@ -606,6 +606,42 @@ void SequentialPool::rewind()
     }
 }
 
+void SequentialPool::rewindTo(const Checkpoint& checkpoint)
+{
+    // Restore the buffer (and position within it) current at 'checkpoint'.
+
+    if (checkpoint.d_buffer_p) {
+        d_bufferManager.replaceBuffer(checkpoint.d_buffer_p,
+                                      checkpoint.d_bufferSize);
+        d_bufferManager.setCursor(checkpoint.d_cursor);
+    }
+    else {
+        d_bufferManager.reset();
+    }
+
+    // Mark the constant growth blocks obtained after 'checkpoint' as reusable.
+
+    d_freeListPrevAddr_p = checkpoint.d_freeListPrevAddr_p
+                         ? checkpoint.d_freeListPrevAddr_p
+                         : &d_head_p;
+
+    // Mark the geometric growth blocks used after 'checkpoint' as reusable.
+
+    d_unavailable = checkpoint.d_unavailable | d_alwaysUnavailable;
+
+    // Return the blocks allocated outside the constant and growth strategies
+    // after 'checkpoint' to the underlying allocator.  Note that large blocks
+    // are kept in a stack, most recent first.
+
+    while (d_largeBlockList_p != checkpoint.d_largeBlockList_p) {
+        BSLS_ASSERT(d_largeBlockList_p);
+
+        void *lastBlock    = d_largeBlockList_p;
+        d_largeBlockList_p = d_largeBlockList_p->d_next_p;
+        d_allocator_p->deallocate(lastBlock);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
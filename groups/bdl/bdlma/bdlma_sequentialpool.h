@@ -30,6 +30,20 @@ BSLS_IDENT("$Id: $")
 // deallocation is needed, but the user does not know in advance the maximum
 // amount of memory needed.
 //
+///Checkpoints
+///-----------
+// The 'mark' method returns a 'bdlma::SequentialPool::Checkpoint' capturing
+// the current allocation state of the pool, and the 'rewindTo' method returns
+// the pool to the state captured by a checkpoint, releasing all memory
+// allocated through the pool after the checkpoint was taken.  As with
+// 'rewind', internal buffers obtained after the checkpoint are retained for
+// reuse by subsequent allocations, while large blocks (i.e., memory allocated
+// outside of the typical internal buffer growth of the pool) obtained after
+// the checkpoint are returned to the underlying allocator.  Checkpoints may be
+// nested: rewinding to a checkpoint invalidates every checkpoint taken after
+// it, but leaves every checkpoint taken before it valid.  Calling 'release' or
+// 'rewind' invalidates all outstanding checkpoints.
+//
 ///Optional 'initialSize' Parameter
 ///--------------------------------
 // An optional 'initialSize' parameter can be supplied at construction to
@@ -394,6 +408,51 @@ class SequentialPool {
     bslma::Allocator              *d_allocator_p;    // memory allocator (held,
                                                      // not owned)
 
+  public:
+    // PUBLIC TYPES
+    class Checkpoint {
+        // This class provides an opaque token, obtained from 'mark', that
+        // captures the allocation state of a 'SequentialPool' so that it can
+        // later be restored by 'rewindTo'.
+
+        // DATA
+        char                   *d_buffer_p;            // managed buffer (or 0)
+
+        bsls::Types::size_type  d_bufferSize;          // size of the buffer
+
+        bsls::Types::size_type  d_cursor;              // offset of the first
+                                                       // unallocated byte
+
+        Block                 **d_freeListPrevAddr_p;  // first constant growth
+                                                       // block available for
+                                                       // reuse
+
+        uint64_t                d_unavailable;         // unavailable geometric
+                                                       // bins
+
+        Block                  *d_largeBlockList_p;    // most recent large
+                                                       // block (or 0)
+
+        // FRIENDS
+        friend class SequentialPool;
+
+      public:
+        // CREATORS
+        Checkpoint();
+            // Create a checkpoint capturing the state of a
+            // default-constructed 'SequentialPool' that has not allocated any
+            // memory.  Note that rewinding a pool to such a checkpoint is
+            // equivalent to calling 'rewind', and that this constructor is
+            // provided so that checkpoints can be held in data members and
+            // containers.
+
+        // Checkpoint(const Checkpoint& original) = default;
+        // ~Checkpoint() = default;
+
+        // MANIPULATORS
+        // Checkpoint& operator=(const Checkpoint& rhs) = default;
+    };
+
   private:
     // PRIVATE MANIPULATORS
     void *allocateNonFastPath(bsls::Types::size_type size);
@@ -571,6 +630,21 @@ class SequentialPool {
         // a pointer obtained from this object prior to this call to 'rewind'
         // is undefined.
 
+    void rewindTo(const Checkpoint& checkpoint);
+        // Release all memory allocated through this pool since the specified
+        // 'checkpoint' was obtained from 'mark', and return to the underlying
+        // allocator *only* memory obtained since then that was allocated
+        // outside of the typical internal buffer growth of this pool (i.e.,
+        // large blocks).  All retained memory will be used to satisfy
+        // subsequent allocations.  Every checkpoint obtained before
+        // 'checkpoint' remains valid, and every checkpoint obtained after it
+        // is invalidated.  The behavior is undefined unless 'checkpoint' is
+        // default-constructed, or was obtained from this pool and has not been
+        // invalidated by a call to 'release', 'rewind', or 'rewindTo'.  The
+        // effect of subsequently - to this invocation of 'rewindTo' - using a
+        // pointer obtained from this object after 'checkpoint' was obtained is
+        // undefined.
+
     void reserveCapacity(bsls::Types::size_type numBytes);
         // Reserve sufficient memory to satisfy allocation requests for at
         // least the specified 'numBytes' without replenishment (i.e., without
@@ -595,6 +669,12 @@ class SequentialPool {
         // 'release' was not called after allocating the memory block at
         // 'address'.
 
+    // ACCESSORS
+    Checkpoint mark() const;
+        // Return a checkpoint capturing the current allocation state of this
+        // pool, which may be supplied to 'rewindTo' to release all memory
+        // allocated through this pool after this call.
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -672,6 +752,22 @@ void operator delete(void *address, BloombergLP::bdlma::SequentialPool& pool);
 namespace BloombergLP {
 namespace bdlma {
 
+                     // --------------------------------
+                     // class SequentialPool::Checkpoint
+                     // --------------------------------
+
+// CREATORS
+inline
+SequentialPool::Checkpoint::Checkpoint()
+: d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+, d_freeListPrevAddr_p(0)
+, d_unavailable(0)
+, d_largeBlockList_p(0)
+{
+}
+
                            // --------------------
                            // class SequentialPool
                            // --------------------
@@ -740,6 +836,22 @@ bsls::Types::size_type SequentialPool::truncate(
     return d_bufferManager.truncate(address, originalSize, newSize);
 }
 
+// ACCESSORS
+inline
+SequentialPool::Checkpoint SequentialPool::mark() const
+{
+    Checkpoint checkpoint;
+
+    checkpoint.d_buffer_p            = d_bufferManager.buffer();
+    checkpoint.d_bufferSize          = d_bufferManager.bufferSize();
+    checkpoint.d_cursor              = d_bufferManager.cursor();
+    checkpoint.d_freeListPrevAddr_p  = d_freeListPrevAddr_p;
+    checkpoint.d_unavailable         = d_unavailable;
+    checkpoint.d_largeBlockList_p    = d_largeBlockList_p;
+
+    return checkpoint;
+}
+
 // Aspects
 
 inline
@@ -19,6 +19,7 @@
 #include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_vector.h>
@@ -64,6 +65,7 @@ using namespace bsl;
 // memory had been released by the destructor of the pool.
 //-----------------------------------------------------------------------------
 // // CREATORS
+// [14] Checkpoint::Checkpoint();
 // [ 3] bdlma::SequentialPool(bslma::Allocator *a = 0);
 // [ 3] bdlma::SequentialPool(GS g, bslma::Allocator *a = 0);
 // [ 3] bdlma::SequentialPool(AS a, bslma::Allocator *a = 0);
@@ -91,14 +93,18 @@ using namespace bsl;
 // [ 6] void deleteObject(const TYPE *object);
 // [ 5] void release();
 // [11] void rewind();
+// [14] void rewindTo(const Checkpoint& checkpoint);
 // [ 9] void reserveCapacity(int numBytes);
 // [ 8] int truncate(void *address, int originalSize, int newSize);
 // [12] bslma::Allocator *allocator() const;
+//
+// // ACCESSORS
+// [14] Checkpoint mark() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: 'int blockSize(numBytes)'
 // [10] FREE FUNCTION: 'operator new(size_t, bdlma::SequentialPool)'
-// [14] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 // [13] DRQS 135423849: LARGE ALLOCATION FAILURE ON 32-BIT BUILDS
 
 //=============================================================================
@@ -525,7 +531,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -548,6 +554,301 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 14: {
+        // -------------------------------------------------------------------
+        // TESTING 'mark' AND 'rewindTo'
+        //   Ensure checkpoints allow memory allocated since a 'mark' to be
+        //   reused.
+        //
+        // Concerns:
+        //: 1 After 'rewindTo', the allocations made since the corresponding
+        //:   'mark' are reused: repeating them yields the same addresses.
+        //:
+        //: 2 'rewindTo' does not return internal buffers to the underlying
+        //:   allocator, but does return large blocks obtained after the
+        //:   checkpoint (and only those).
+        //:
+        //: 3 Checkpoints nest: rewinding to an inner checkpoint leaves outer
+        //:   checkpoints valid.
+        //:
+        //: 4 Rewinding to a default-constructed checkpoint, or to a checkpoint
+        //:   taken before any allocation, is equivalent to 'rewind'.
+        //:
+        //: 5 Memory allocated before the checkpoint is unaffected.
+        //:
+        //: 6 All memory is returned to the underlying allocator on
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 For all growth and alignment strategies, perform a set of
+        //:   allocations, take a checkpoint, perform a second set of
+        //:   allocations, 'rewindTo' the checkpoint, and verify that
+        //:   repeating the second set of allocations returns the same
+        //:   addresses without allocating from the underlying allocator.
+        //:   Verify that a pattern written to memory allocated before the
+        //:   checkpoint is preserved.  (C-1..2, 5)
+        //:
+        //: 2 Take three nested checkpoints separated by allocations, and
+        //:   rewind to each in turn, from the innermost outward, verifying
+        //:   the address of the next allocation each time.  (C-3)
+        //:
+        //: 3 Repeat P-1 using a default-constructed checkpoint and a
+        //:   checkpoint taken on an empty pool.  (C-4)
+        //:
+        //: 4 Using a pool with a maximum buffer size, allocate large blocks
+        //:   before and after a checkpoint and verify, using a test
+        //:   allocator, that 'rewindTo' returns exactly the blocks allocated
+        //:   after the checkpoint.  (C-2)
+        //:
+        //: 5 Allow each object to go out of scope and verify that all memory
+        //:   has been returned to the underlying allocator.  (C-6)
+        //
+        // Testing:
+        //   Checkpoint::Checkpoint();
+        //   void rewindTo(const Checkpoint& checkpoint);
+        //   Checkpoint mark() const;
+        // -------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'mark' AND 'rewindTo'" << endl
+                          << "=============================" << endl;
+
+        bsls::BlockGrowth::Strategy growthStrategy[] = {
+            bsls::BlockGrowth::BSLS_GEOMETRIC,
+            bsls::BlockGrowth::BSLS_CONSTANT
+        };
+        const bsl::size_t numGrowthStrategy = sizeof  growthStrategy
+                                            / sizeof *growthStrategy;
+
+        const bsls::Alignment::Strategy alignmentStrategy[] = {
+            bsls::Alignment::BSLS_NATURAL,
+            bsls::Alignment::BSLS_MAXIMUM,
+            bsls::Alignment::BSLS_BYTEALIGNED
+        };
+        const bsl::size_t numAlignmentStrategy = sizeof  alignmentStrategy
+                                               / sizeof *alignmentStrategy;
+
+        bsl::size_t allocationSize[] = {
+            4, 8, 1024, 256, 512, 4, 4, 16, 1, 2, 3, 4, 5, 2048, 12, 7
+        };
+        const bsl::size_t numAllocationSize = sizeof  allocationSize
+                                            / sizeof *allocationSize;
+
+        if (verbose) cout << "\nTesting reuse after 'rewindTo'." << endl;
+
+        for (bsl::size_t growthIndex = 0;
+             growthIndex < numGrowthStrategy;
+             ++growthIndex) {
+
+            for (bsl::size_t alignmentIndex = 0;
+                 alignmentIndex < numAlignmentStrategy;
+                 ++alignmentIndex) {
+
+                for (bsl::size_t markIndex = 0;
+                     markIndex <= numAllocationSize;
+                     ++markIndex) {
+
+                    std::vector<void *> address;
+                    address.reserve(numAllocationSize);
+
+                    bslma::TestAllocator allocator("Local Allocator",
+                                                   veryVeryVeryVerbose);
+
+                    {
+                        Obj mX(growthStrategy[growthIndex],
+                               alignmentStrategy[alignmentIndex],
+                               &allocator);
+                        const Obj& X = mX;
+
+                        // Allocations preceding the checkpoint.
+
+                        for (bsl::size_t i = 0; i < markIndex; ++i) {
+                            address.push_back(mX.allocate(allocationSize[i]));
+                            bsl::memset(address.back(),
+                                        static_cast<int>(i),
+                                        allocationSize[i]);
+                        }
+
+                        const Obj::Checkpoint checkpoint = X.mark();
+
+                        // Allocations following the checkpoint.
+
+                        for (bsl::size_t i = markIndex;
+                             i < numAllocationSize;
+                             ++i) {
+                            address.push_back(mX.allocate(allocationSize[i]));
+                        }
+
+                        bsls::Types::Int64 numBytesInUse =
+                                                     allocator.numBytesInUse();
+
+                        // Rewind to the checkpoint.
+
+                        mX.rewindTo(checkpoint);
+
+                        LOOP3_ASSERT(growthIndex, alignmentIndex, markIndex,
+                                   numBytesInUse == allocator.numBytesInUse());
+
+                        // Re-allocate.
+
+                        for (bsl::size_t i = markIndex;
+                             i < numAllocationSize;
+                             ++i) {
+                            LOOP4_ASSERT(growthIndex, alignmentIndex,
+                                         markIndex, i,
+                                         address[i] ==
+                                               mX.allocate(allocationSize[i]));
+                        }
+
+                        LOOP3_ASSERT(growthIndex, alignmentIndex, markIndex,
+                                   numBytesInUse == allocator.numBytesInUse());
+
+                        // Memory allocated before the checkpoint is intact.
+
+                        for (bsl::size_t i = 0; i < markIndex; ++i) {
+                            const char *p = static_cast<char *>(address[i]);
+                            for (bsl::size_t j = 0;
+                                 j < allocationSize[i];
+                                 ++j) {
+                                LOOP3_ASSERT(markIndex, i, j,
+                                             static_cast<char>(i) == p[j]);
+                            }
+                        }
+                    }
+
+                    ASSERT(0 == allocator.numBytesInUse());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting nested checkpoints." << endl;
+
+        for (bsl::size_t growthIndex = 0;
+             growthIndex < numGrowthStrategy;
+             ++growthIndex) {
+
+            bslma::TestAllocator allocator("Local Allocator",
+                                           veryVeryVeryVerbose);
+
+            {
+                Obj mX(growthStrategy[growthIndex], &allocator);
+                const Obj& X = mX;
+
+                const Obj::Checkpoint cp0 = X.mark();
+                void *p0 = mX.allocate(100);
+
+                const Obj::Checkpoint cp1 = X.mark();
+                void *p1 = mX.allocate(1000);
+
+                const Obj::Checkpoint cp2 = X.mark();
+                void *p2 = mX.allocate(10000);
+                mX.allocate(5);
+
+                bsls::Types::Int64 numBytesInUse = allocator.numBytesInUse();
+
+                mX.rewindTo(cp2);
+                LOOP_ASSERT(growthIndex, p2 == mX.allocate(10000));
+
+                mX.rewindTo(cp2);
+                mX.rewindTo(cp1);
+                LOOP_ASSERT(growthIndex, p1 == mX.allocate(1000));
+
+                mX.rewindTo(cp1);
+                mX.rewindTo(cp0);
+                LOOP_ASSERT(growthIndex, p0 == mX.allocate(100));
+
+                LOOP_ASSERT(growthIndex,
+                            numBytesInUse == allocator.numBytesInUse());
+            }
+
+            ASSERT(0 == allocator.numBytesInUse());
+        }
+
+        if (verbose) cout << "\nTesting empty checkpoints." << endl;
+
+        for (bsl::size_t growthIndex = 0;
+             growthIndex < numGrowthStrategy;
+             ++growthIndex) {
+
+            for (int useDefault = 0; useDefault < 2; ++useDefault) {
+                std::vector<void *> address;
+                address.reserve(numAllocationSize);
+
+                bslma::TestAllocator allocator("Local Allocator",
+                                               veryVeryVeryVerbose);
+
+                {
+                    Obj mX(growthStrategy[growthIndex], &allocator);
+                    const Obj& X = mX;
+
+                    const Obj::Checkpoint checkpoint = useDefault
+                                                     ? Obj::Checkpoint()
+                                                     : X.mark();
+
+                    for (bsl::size_t i = 0; i < numAllocationSize; ++i) {
+                        address.push_back(mX.allocate(allocationSize[i]));
+                    }
+
+                    bsls::Types::Int64 numBytesInUse =
+                                                     allocator.numBytesInUse();
+
+                    mX.rewindTo(checkpoint);
+
+                    for (bsl::size_t i = 0; i < numAllocationSize; ++i) {
+                        LOOP3_ASSERT(growthIndex, useDefault, i,
+                                     address[i] ==
+                                               mX.allocate(allocationSize[i]));
+                    }
+
+                    LOOP2_ASSERT(growthIndex, useDefault,
+                                 numBytesInUse == allocator.numBytesInUse());
+                }
+
+                ASSERT(0 == allocator.numBytesInUse());
+            }
+        }
+
+        if (verbose) cout << "\nTesting large blocks." << endl;
+        {
+            enum { k_INITIAL_SIZE = 64, k_MAX_BUFFER_SIZE = 256 };
+
+            bslma::TestAllocator allocator("Local Allocator",
+                                           veryVeryVeryVerbose);
+
+            {
+                Obj mX(k_INITIAL_SIZE, k_MAX_BUFFER_SIZE, &allocator);
+                const Obj& X = mX;
+
+                mX.allocate(8);
+                mX.allocate(1000);       // large block preceding checkpoint
+
+                const bsls::Types::Int64 numBlocks =
+                                                    allocator.numBlocksInUse();
+                const bsls::Types::Int64 numBytes  = allocator.numBytesInUse();
+
+                const Obj::Checkpoint checkpoint = X.mark();
+
+                mX.allocate(2000);       // large blocks following checkpoint
+                mX.allocate(3000);
+                mX.allocate(16);
+                ASSERT(numBlocks + 2 <= allocator.numBlocksInUse());
+
+                const bsls::Types::Int64 numBlocksAfter =
+                                                    allocator.numBlocksInUse();
+
+                mX.rewindTo(checkpoint);
+
+                ASSERT(numBlocksAfter - 2 == allocator.numBlocksInUse());
+                ASSERT(numBytes <= allocator.numBytesInUse());
+
+                mX.rewindTo(checkpoint);
+
+                ASSERT(numBlocksAfter - 2 == allocator.numBlocksInUse());
+            }
+
+            ASSERT(0 == allocator.numBytesInUse());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // DRQS 135423849: LARGE ALLOCATION FAILURE ON 32-BIT BUILDS
@@ -0,0 +1,490 @@
+// bdlma_shardedconcurrentpool.cpp                                    -*-C++-*-
+#include <bdlma_shardedconcurrentpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_shardedconcurrentpool_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>  // for 'max()'
+#include <bsl_new.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The head of each shard is a 64-bit word combining the address of the first
+// free block (in the low 'k_TAG_SHIFT' bits) with a tag (in the remaining high
+// bits) that is incremented, modulo its width, by every successful update of
+// the head.  Every update of a head is a compare-and-swap of the whole word,
+// so a thread that loaded a head (and the link of its first block) before an
+// intervening pop-and-push of that block by other threads fails its
+// compare-and-swap because the tag has changed, even though the address has
+// not.
+//
+// Stealing pops at most 'k_MAX_STEAL_COUNT' blocks off a victim shard, one
+// compare-and-swap each, after which the stolen blocks are private to the
+// stealing thread, which returns the first to its caller and pushes the
+// remainder onto its own shard.  Popping (rather than detaching a prefix of
+// the victim's list with a single compare-and-swap) is required because only
+// the link of the first block of a list may be read safely without owning the
+// list: the link of any later block may be arbitrary client data if that
+// block has been popped and allocated since the head was loaded.  A block may
+// be "in flight" (on no shard) for a short time, which affects only whether
+// concurrent 'allocate' calls find a free block or must replenish.
+//
+// The address of a block is checked against 'k_ADDRESS_MASK' (on 64-bit
+// platforms; a 32-bit address always fits) once per chunk, when the chunk is
+// allocated, and once per 'deallocate'.  A block whose address does not fit
+// is never placed on a shard; it is kept on 'd_untaggedList_p', a plain list
+// protected by 'd_mutex', from which 'refill' takes blocks before allocating
+// a new chunk.
+
+namespace BloombergLP {
+namespace {
+
+                                // ---------
+                                // CONSTANTS
+                                // ---------
+
+enum {
+    k_INITIAL_CHUNK_SIZE =  1,  // default initial chunk size
+
+    k_MAX_CHUNK_SIZE     = 32,  // default maximum chunk size
+
+    k_MAX_STEAL_COUNT    = 16   // maximum number of blocks stolen at once
+};
+
+#if defined(BSLS_PLATFORM_CPU_64_BIT)
+const int k_TAG_SHIFT = 48;     // number of low-order bits of a shard head
+                                // holding the address of the first block
+#else
+const int k_TAG_SHIFT = 32;
+#endif
+
+const bsls::Types::Uint64 k_ADDRESS_MASK =
+                                 (bsls::Types::Uint64(1) << k_TAG_SHIFT) - 1;
+
+const bsls::Types::Uint64 k_TAG_INCREMENT =
+                                       bsls::Types::Uint64(1) << k_TAG_SHIFT;
+
+const bsls::Types::Uint64 k_GOLDEN_RATIO = 0x9E3779B97F4A7C15ULL;
+                                // multiplier used to hash thread ids
+
+                          // -----------------------
+                          // local utility functions
+                          // -----------------------
+
+static inline
+bsls::Types::size_type roundUp(bsls::Types::size_type x,
+                               bsls::Types::size_type y)
+    // Round up the specified 'x' to the nearest whole integer multiple of the
+    // specified 'y'.
+{
+    return (x + y - 1) / y * y;
+}
+
+static inline
+bool fitsInHead(const void *address)
+    // Return 'true' if the specified 'address' can be stored in a tagged
+    // shard head, and 'false' otherwise.
+{
+    return 0 == (static_cast<bsls::Types::Uint64>(
+                           reinterpret_cast<bsls::Types::UintPtr>(address))
+                                                           & ~k_ADDRESS_MASK);
+}
+
+static inline
+void *headAddress(bsls::Types::Uint64 head)
+    // Return the address of the first block of the list having the specified
+    // tagged 'head'.
+{
+    return reinterpret_cast<void *>(static_cast<bsls::Types::UintPtr>(
+                                                      head & k_ADDRESS_MASK));
+}
+
+static inline
+bsls::Types::Uint64 nextHead(bsls::Types::Uint64  head,
+                             const void          *address)
+    // Return the tagged head that replaces the specified 'head' to make the
+    // list begin at the specified 'address'.
+{
+    BSLS_ASSERT_SAFE(fitsInHead(address));
+
+    const bsls::Types::UintPtr ptr = reinterpret_cast<bsls::Types::UintPtr>(
+                                                                      address);
+
+    return ((head & ~k_ADDRESS_MASK) + k_TAG_INCREMENT)
+         | static_cast<bsls::Types::Uint64>(ptr);
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                       // ---------------------------
+                       // class ShardedConcurrentPool
+                       // ---------------------------
+
+// PRIVATE MANIPULATORS
+void ShardedConcurrentPool::initialize(int numShards)
+{
+    BSLS_ASSERT(0 <= numShards);
+    BSLS_ASSERT(numShards <= k_MAX_NUM_SHARDS);
+    BSLS_ASSERT(0 == (numShards & (numShards - 1)));
+
+    if (0 == numShards) {
+        const int numThreads = static_cast<int>(
+                                   bslmt::ThreadUtil::hardwareConcurrency());
+
+        numShards = 1;
+        while (numShards < numThreads && numShards < k_MAX_NUM_SHARDS) {
+            numShards *= 2;
+        }
+    }
+
+    d_numShards  = numShards;
+    d_shardShift = 32;
+    for (int n = numShards; n > 1; n /= 2) {
+        --d_shardShift;
+    }
+
+    d_internalBlockSize = roundUp(bsl::max(d_blockSize,
+                                           static_cast<bsls::Types::size_type>(
+                                                                sizeof(Link))),
+                                  bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+    d_shards_p = static_cast<Shard *>(
+                   allocator()->allocate(d_numShards * sizeof *d_shards_p));
+
+    for (int i = 0; i < d_numShards; ++i) {
+        new (d_shards_p + i) Shard();
+    }
+}
+
+ShardedConcurrentPool::Link *ShardedConcurrentPool::pop(Shard *shard)
+{
+    bsls::Types::Uint64 head = shard->d_head.loadAcquire();
+
+    for (;;) {
+        Link *p = static_cast<Link *>(headAddress(head));
+        if (!p) {
+            return 0;                                                 // RETURN
+        }
+
+        // 'p->d_next_p' may be stale if 'p' has been popped by another thread
+        // since 'head' was loaded, in which case the tag of the head has
+        // changed, and the compare-and-swap fails.
+
+        const bsls::Types::Uint64 old = shard->d_head.testAndSwapAcqRel(
+                                                   head,
+                                                   nextHead(head,
+                                                            p->d_next_p));
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(old == head)) {
+            return p;                                                 // RETURN
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        head = old;
+    }
+}
+
+void ShardedConcurrentPool::pushList(Shard *shard, Link *first, Link *last)
+{
+    BSLS_ASSERT_SAFE(first);
+    BSLS_ASSERT_SAFE(last);
+
+    bsls::Types::Uint64 head = shard->d_head.loadRelaxed();
+
+    for (;;) {
+        last->d_next_p = static_cast<Link *>(headAddress(head));
+
+        const bsls::Types::Uint64 old = shard->d_head.testAndSwapAcqRel(
+                                                          head,
+                                                          nextHead(head,
+                                                                   first));
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(old == head)) {
+            return;                                                   // RETURN
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        head = old;
+    }
+}
+
+void ShardedConcurrentPool::pushReplenished(Shard *shard,
+                                            Link  *first,
+                                            Link  *last)
+{
+    BSLS_ASSERT_SAFE(first);
+    BSLS_ASSERT_SAFE(last);
+
+    // The blocks of a chunk are in increasing address order, so they all fit
+    // in a shard head if the last one does.
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(fitsInHead(last))) {
+        pushList(shard, first, last);
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        last->d_next_p   = d_untaggedList_p;
+        d_untaggedList_p = first;
+    }
+}
+
+void *ShardedConcurrentPool::refill(Shard *shard)
+{
+    const int index = static_cast<int>(shard - d_shards_p);
+
+    // Try to steal a batch of blocks from another shard.
+
+    for (int i = 1; i < d_numShards; ++i) {
+        Shard *victim = d_shards_p + ((index + i) & (d_numShards - 1));
+
+        Link *first = pop(victim);
+        if (!first) {
+            continue;
+        }
+
+        Link *last = first;
+        for (int n = 1; n < k_MAX_STEAL_COUNT; ++n) {
+            Link *p = pop(victim);
+            if (!p) {
+                break;
+            }
+            last->d_next_p = p;
+            last           = p;
+        }
+
+        if (last != first) {
+            pushList(shard, first->d_next_p, last);
+        }
+        return first;                                                 // RETURN
+    }
+
+    // Every shard appeared empty: take a block that could not be placed on a
+    // shard, or replenish this shard, unless another thread did so while we
+    // were waiting for the lock.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Link *p = pop(shard);
+    if (p) {
+        return p;                                                     // RETURN
+    }
+
+    if (d_untaggedList_p) {
+        p                = d_untaggedList_p;
+        d_untaggedList_p = p->d_next_p;
+        return p;                                                     // RETURN
+    }
+
+    const int  numBlocks = d_chunkSize;
+    Link      *first     = replenish(numBlocks);
+
+    if (bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
+     && d_chunkSize < d_maxBlocksPerChunk) {
+        d_chunkSize = d_chunkSize * 2 <= d_maxBlocksPerChunk
+                    ? d_chunkSize * 2
+                    : d_maxBlocksPerChunk;
+    }
+
+    if (1 < numBlocks) {
+        Link *last = reinterpret_cast<Link *>(reinterpret_cast<char *>(first)
+                                     + (numBlocks - 1) * d_internalBlockSize);
+
+        pushReplenished(shard, first->d_next_p, last);
+    }
+    return first;                                                     // RETURN
+}
+
+ShardedConcurrentPool::Link *ShardedConcurrentPool::replenish(int numBlocks)
+{
+    BSLS_ASSERT(1 <= numBlocks);
+
+    char *start = static_cast<char *>(
+                        d_blockList.allocate(numBlocks * d_internalBlockSize));
+    char *last  = start + (numBlocks - 1) * d_internalBlockSize;
+
+    for (char *p = start; p < last; p += d_internalBlockSize) {
+        reinterpret_cast<Link *>(p)->d_next_p =
+                             reinterpret_cast<Link *>(p + d_internalBlockSize);
+    }
+    reinterpret_cast<Link *>(last)->d_next_p = 0;
+
+    return reinterpret_cast<Link *>(start);
+}
+
+ShardedConcurrentPool::Shard *ShardedConcurrentPool::shardForCurrentThread()
+{
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                                              * k_GOLDEN_RATIO;
+
+    return d_shards_p + static_cast<int>((hash >> 32) >> d_shardShift);
+}
+
+// CREATORS
+ShardedConcurrentPool::ShardedConcurrentPool(
+                                        bsls::Types::size_type  blockSize,
+                                        bslma::Allocator       *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
+, d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
+, d_untaggedList_p(0)
+, d_blockList(basicAllocator)
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    initialize(0);
+}
+
+ShardedConcurrentPool::ShardedConcurrentPool(
+                                bsls::Types::size_type       blockSize,
+                                bsls::BlockGrowth::Strategy  growthStrategy,
+                                bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? k_MAX_CHUNK_SIZE : k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
+, d_growthStrategy(growthStrategy)
+, d_untaggedList_p(0)
+, d_blockList(basicAllocator)
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    initialize(0);
+}
+
+ShardedConcurrentPool::ShardedConcurrentPool(
+                                bsls::Types::size_type       blockSize,
+                                bsls::BlockGrowth::Strategy  growthStrategy,
+                                int                          maxBlocksPerChunk,
+                                bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? maxBlocksPerChunk : k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(maxBlocksPerChunk)
+, d_growthStrategy(growthStrategy)
+, d_untaggedList_p(0)
+, d_blockList(basicAllocator)
+{
+    BSLS_ASSERT(1 <= blockSize);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    initialize(0);
+}
+
+ShardedConcurrentPool::ShardedConcurrentPool(
+                                bsls::Types::size_type       blockSize,
+                                int                          numShards,
+                                bsls::BlockGrowth::Strategy  growthStrategy,
+                                int                          maxBlocksPerChunk,
+                                bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? maxBlocksPerChunk : k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(maxBlocksPerChunk)
+, d_growthStrategy(growthStrategy)
+, d_untaggedList_p(0)
+, d_blockList(basicAllocator)
+{
+    BSLS_ASSERT(1 <= blockSize);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    initialize(numShards);
+}
+
+ShardedConcurrentPool::~ShardedConcurrentPool()
+{
+    BSLS_ASSERT(d_shards_p);
+
+    d_blockList.release();
+    allocator()->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+void *ShardedConcurrentPool::allocate()
+{
+    Shard *shard = shardForCurrentThread();
+
+    Link *p = pop(shard);
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(p)) {
+        return p;                                                     // RETURN
+    }
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    return refill(shard);
+}
+
+void ShardedConcurrentPool::deallocate(void *address)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    Link *p = static_cast<Link *>(address);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!fitsInHead(p))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        p->d_next_p      = d_untaggedList_p;
+        d_untaggedList_p = p;
+        return;                                                       // RETURN
+    }
+
+    pushList(shardForCurrentThread(), p, p);
+}
+
+void ShardedConcurrentPool::release()
+{
+    for (int i = 0; i < d_numShards; ++i) {
+        Shard& shard = d_shards_p[i];
+        shard.d_head.storeRelease(nextHead(shard.d_head.loadRelaxed(), 0));
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_untaggedList_p = 0;
+    d_blockList.release();
+}
+
+void ShardedConcurrentPool::reserveCapacity(int numBlocks)
+{
+    BSLS_ASSERT(0 <= numBlocks);
+
+    if (0 == numBlocks) {
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Link *first = replenish(numBlocks);
+    Link *last  = reinterpret_cast<Link *>(reinterpret_cast<char *>(first)
+                                     + (numBlocks - 1) * d_internalBlockSize);
+
+    pushReplenished(shardForCurrentThread(), first, last);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
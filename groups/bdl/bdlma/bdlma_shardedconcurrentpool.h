@@ -0,0 +1,512 @@
+// bdlma_shardedconcurrentpool.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMA_SHARDEDCONCURRENTPOOL
+#define INCLUDED_BDLMA_SHARDEDCONCURRENTPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe pool with per-thread-sharded free lists.
+//
+//@CLASSES:
+//  bdlma::ShardedConcurrentPool: thread-safe pool having sharded free lists
+//
+//@SEE_ALSO: bdlma_concurrentpool, bdlma_threadcachingmultipoolallocator
+//
+//@DESCRIPTION: This component implements a thread-safe memory pool,
+// 'bdlma::ShardedConcurrentPool', that allocates and manages memory blocks of
+// some uniform size specified at construction, and that has the same
+// interface as 'bdlma::ConcurrentPool'.  Whereas a 'bdlma::ConcurrentPool'
+// keeps all of its free blocks on a single lock-free list, so that every
+// 'allocate' and 'deallocate' performed by every thread updates the same
+// atomic list head, a 'bdlma::ShardedConcurrentPool' partitions its free
+// blocks among a number of independent lock-free lists (the "shards"), each
+// occupying its own cache line.  Each thread is associated with one shard, by
+// hashing its thread id, and both allocates from and deallocates to that
+// shard, so that threads associated with different shards do not contend.
+//
+// When the shard of the allocating thread is empty, the pool first tries to
+// *steal* free blocks from each of the other shards in turn: a bounded batch
+// of blocks (at most 16) is taken from the first non-empty shard found, one
+// block is returned to the caller, and the remainder is transferred to the
+// allocating thread's shard.  Only if every shard is empty is a new chunk of
+// memory obtained from the underlying allocator (under a mutex, as with
+// 'bdlma::ConcurrentPool').  This makes the pool well suited to
+// producer-consumer patterns, in which blocks allocated by one thread are
+// freed by another: the consumer's shard accumulates the freed blocks, which
+// the producer then reclaims a batch at a time, while bounding both the work
+// done by one steal and the number of blocks taken from a shard whose own
+// thread may still need them.
+//
+///Choosing Between 'ConcurrentPool' and 'ShardedConcurrentPool'
+///-------------------------------------------------------------
+// With few threads, the two pools perform similarly, and
+// 'bdlma::ConcurrentPool' (which holds all of its free blocks in one list, and
+// so never needs to steal) is the better choice.  When many threads (more than
+// a handful of cores' worth) allocate blocks of the same size at high rates,
+// the single list head of a 'bdlma::ConcurrentPool' becomes a point of
+// contention, and a 'bdlma::ShardedConcurrentPool' having (roughly) one shard
+// per core scales considerably better.  Test case -1 of the test driver of
+// this component compares the two pools for 1 to 64 threads.
+//
+// The number of shards is a power of two specified at construction; by
+// default it is the number of hardware threads, rounded up to a power of two,
+// and capped at 'k_MAX_NUM_SHARDS'.  Note that because threads are mapped to
+// shards by a hash of the thread id, two threads may share a shard even when
+// there are as many shards as threads; such threads remain correct (the
+// shards are lock-free lists), but contend with each other.
+//
+///ABA Safety
+///----------
+// Each shard's list head is a *tagged* *pointer*: the address of the first
+// free block, combined with a counter that is incremented on every update of
+// the head, and the two are updated together by a single compare-and-swap.  A
+// thread that reads the head, is preempted while the block at its head is
+// popped and pushed back by other threads, and then resumes, therefore fails
+// its compare-and-swap instead of corrupting the list.  On 64-bit platforms,
+// the counter occupies the 16 bits of the head that are unused by user-space
+// addresses that fit in 48 bits; on 32-bit platforms, it occupies 32 bits.
+// The address of every block is checked (once per chunk when the chunk is
+// allocated, and on every 'deallocate'), and a free block whose address does
+// not fit in 48 bits (as may happen on a platform having 57-bit virtual
+// addresses) is never placed on a shard: it is instead kept on a separate
+// list protected by the pool's mutex.  Such blocks are therefore correct, but
+// slower to allocate and deallocate.  Note that the memory of a free block is
+// never returned to the underlying allocator (except by 'release' and the
+// destructor), so reading the link stored in a block that has since been
+// allocated by another thread is harmless.
+//
+///Thread Safety
+///-------------
+// 'allocate', 'deallocate', 'deleteObject', 'deleteObjectRaw', and
+// 'reserveCapacity' may be called concurrently from any number of threads.
+// 'release' (and the destructor) must not be called while any other thread is
+// using the pool.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Pool Shared by Many Producer Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server has many threads, each of which builds, processes,
+// and then discards a large number of small, fixed-size message objects, and
+// that we want to draw the memory for those objects from a single pool that
+// does not become a bottleneck as the number of threads grows.
+//
+// First, we define the message type:
+//..
+//  struct my_Message {
+//      int    d_id;
+//      double d_value;
+//  };
+//..
+// Then, we define the work performed by each thread, which repeatedly
+// allocates a batch of messages from the pool, and returns them:
+//..
+//  extern "C" void *processMessages(void *arg)
+//  {
+//      bdlma::ShardedConcurrentPool *pool =
+//                            static_cast<bdlma::ShardedConcurrentPool *>(arg);
+//
+//      enum { k_BATCH_SIZE = 32 };
+//
+//      my_Message *batch[k_BATCH_SIZE];
+//
+//      for (int i = 0; i < 1000; ++i) {
+//          for (int j = 0; j < k_BATCH_SIZE; ++j) {
+//              batch[j] = new (*pool) my_Message();
+//              batch[j]->d_id = j;
+//          }
+//          for (int j = 0; j < k_BATCH_SIZE; ++j) {
+//              pool->deleteObject(batch[j]);
+//          }
+//      }
+//      return 0;
+//  }
+//..
+// Next, we create a pool having 8 shards:
+//..
+//  bdlma::ShardedConcurrentPool pool(sizeof(my_Message),
+//                                    8,
+//                                    bsls::BlockGrowth::BSLS_GEOMETRIC,
+//                                    32);
+//  assert(8 == pool.numShards());
+//..
+// Then, we start a number of threads, each of which uses the pool:
+//..
+//  enum { k_NUM_THREADS = 8 };
+//
+//  bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      bslmt::ThreadUtil::create(&handles[i], processMessages, &pool);
+//  }
+//..
+// Finally, we wait for the threads to finish.  The blocks they allocated
+// remain in the pool, available for reuse, until the pool is released or
+// destroyed:
+//..
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_infrequentdeleteblocklist.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deleterhelper.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                       // ===========================
+                       // class ShardedConcurrentPool
+                       // ===========================
+
+class ShardedConcurrentPool {
+    // This class implements a memory pool that allocates and manages memory
+    // blocks of some uniform size specified at construction.  Free blocks are
+    // kept on a number of lock-free lists (shards), one of which is associated
+    // with each thread by hashing its thread id; a thread whose shard is empty
+    // steals the free blocks of another shard before allocating a new chunk of
+    // memory.
+    //
+    // This class guarantees thread safety while allocating or releasing
+    // memory.
+
+    // PRIVATE TYPES
+    struct Link {
+        // This 'struct' implements a link data structure that stores the
+        // address of the next link, and is used to implement the internal
+        // linked lists of free memory blocks.
+
+        Link *volatile d_next_p;  // pointer to next link
+    };
+
+    struct Shard {
+        // This 'struct' holds the head of one free list, padded to occupy
+        // its own cache line.
+
+        bsls::AtomicUint64 d_head;  // tagged pointer to the first free block
+
+        char               d_pad[bslmt::Platform::e_CACHE_LINE_SIZE
+                                                 - sizeof(bsls::AtomicUint64)];
+    };
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_NUM_SHARDS = 256  // largest number of shards a pool may have
+    };
+
+  private:
+    // DATA
+    bsls::Types::size_type      d_blockSize;  // size of each allocated memory
+                                              // block returned to client
+
+    bsls::Types::size_type      d_internalBlockSize;
+                                              // actual size of each block
+                                              // maintained on a free list
+
+    int                         d_chunkSize;  // current chunk size (in
+                                              // blocks-per-chunk)
+
+    int                         d_maxBlocksPerChunk;
+                                              // maximum chunk size (in
+                                              // blocks-per-chunk)
+
+    bsls::BlockGrowth::Strategy d_growthStrategy;
+                                              // growth strategy of the chunk
+                                              // size
+
+    Shard                      *d_shards_p;   // array of 'd_numShards' free
+                                              // lists
+
+    int                         d_numShards;  // number of shards (a power of
+                                              // two)
+
+    int                         d_shardShift; // right shift applied to the
+                                              // hashed thread id to obtain a
+                                              // shard index
+
+    Link                       *d_untaggedList_p;
+                                              // free blocks whose addresses
+                                              // do not fit in a shard head
+
+    InfrequentDeleteBlockList   d_blockList;  // memory manager for allocated
+                                              // memory
+
+    bslmt::Mutex                d_mutex;      // protects access to the block
+                                              // list, the chunk size, and
+                                              // 'd_untaggedList_p'
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedConcurrentPool(const ShardedConcurrentPool&);
+    ShardedConcurrentPool& operator=(const ShardedConcurrentPool&);
+
+    // PRIVATE MANIPULATORS
+    void initialize(int numShards);
+        // Allocate and initialize 'numShards' empty shards, or, if
+        // 'numShards' is 0, an implementation-defined number of shards.  The
+        // behavior is undefined unless '0 <= numShards', and 'numShards' is 0
+        // or a power of two no greater than 'k_MAX_NUM_SHARDS'.
+
+    Link *pop(Shard *shard);
+        // Remove the first block from the free list of the specified 'shard',
+        // and return its address, or return 0 if 'shard' is empty.
+
+    void pushList(Shard *shard, Link *first, Link *last);
+        // Prepend the list of free blocks beginning at the specified 'first'
+        // and ending at the specified 'last' to the free list of the specified
+        // 'shard'.  The behavior is undefined unless 'last' is reachable from
+        // 'first'.
+
+    void pushReplenished(Shard *shard, Link *first, Link *last);
+        // Add the list of free blocks of one chunk, beginning at the specified
+        // 'first' and ending at the specified 'last', to the free list of the
+        // specified 'shard' if the address of every block fits in a shard
+        // head, and to 'd_untaggedList_p' otherwise.  The behavior is
+        // undefined unless the calling thread has a lock on 'd_mutex', and
+        // 'first' and 'last' are blocks of the same chunk, in increasing
+        // address order.
+
+    void *refill(Shard *shard);
+        // Return the address of a free block, obtained by stealing a bounded
+        // batch of free blocks from another shard (the remainder of which is
+        // transferred to the specified 'shard'), or, if every shard is empty,
+        // from the list of blocks that do not fit in a shard head or by
+        // allocating a new chunk of memory and adding its remaining blocks to
+        // 'shard'.
+
+    Link *replenish(int numBlocks);
+        // Allocate a new chunk of the specified 'numBlocks' blocks, link them
+        // into a list, and return the address of the first.  The behavior is
+        // undefined unless the calling thread has a lock on 'd_mutex' and
+        // '1 <= numBlocks'.
+
+    Shard *shardForCurrentThread();
+        // Return the address of the shard associated with the calling thread.
+
+  public:
+    // CREATORS
+    explicit ShardedConcurrentPool(bsls::Types::size_type  blockSize,
+                                   bslma::Allocator       *basicAllocator = 0);
+    ShardedConcurrentPool(bsls::Types::size_type       blockSize,
+                          bsls::BlockGrowth::Strategy  growthStrategy,
+                          bslma::Allocator            *basicAllocator = 0);
+    ShardedConcurrentPool(bsls::Types::size_type       blockSize,
+                          bsls::BlockGrowth::Strategy  growthStrategy,
+                          int                          maxBlocksPerChunk,
+                          bslma::Allocator            *basicAllocator = 0);
+    ShardedConcurrentPool(bsls::Types::size_type       blockSize,
+                          int                          numShards,
+                          bsls::BlockGrowth::Strategy  growthStrategy,
+                          int                          maxBlocksPerChunk,
+                          bslma::Allocator            *basicAllocator = 0);
+        // Create a memory pool that returns blocks of contiguous memory of the
+        // specified 'blockSize' (in bytes) for each 'allocate' method
+        // invocation.  Optionally specify 'numShards', the number of free
+        // lists among which free blocks are partitioned; if 'numShards' is not
+        // specified, or is 0, the number of hardware threads, rounded up to a
+        // power of two and capped at 'k_MAX_NUM_SHARDS', is used.  Optionally
+        // specify a 'growthStrategy' used to control the growth of internal
+        // memory chunks (from which memory blocks are dispensed).  If
+        // 'growthStrategy' is not specified, geometric growth is used.
+        // Optionally specify 'maxBlocksPerChunk' as the maximum chunk size.
+        // If geometric growth is used, the chunk size grows starting at
+        // 'blockSize', doubling in size until the size is exactly
+        // 'blockSize * maxBlocksPerChunk'.  If constant growth is used, the
+        // chunk size is always 'maxBlocksPerChunk'.  If 'maxBlocksPerChunk'
+        // is not specified, an implementation-defined value is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= blockSize',
+        // '1 <= maxBlocksPerChunk', and 'numShards' is 0 or a power of two no
+        // greater than 'k_MAX_NUM_SHARDS'.
+
+    ~ShardedConcurrentPool();
+        // Destroy this pool, releasing all associated memory back to the
+        // underlying allocator.
+
+    // MANIPULATORS
+    void *allocate();
+        // Return the address of a contiguous block of memory having the fixed
+        // block size specified at construction.
+
+    void deallocate(void *address);
+        // Relinquish the memory block at the specified 'address' back to this
+        // pool object for reuse.  The behavior is undefined unless 'address'
+        // is non-zero, was allocated by this pool, and has not already been
+        // deallocated.
+
+    template <class TYPE>
+    void deleteObject(const TYPE *object);
+        // Destroy the specified 'object' based on its dynamic type and then
+        // use this pool to deallocate its memory footprint.  This method has
+        // no effect if 'object' is 0.  The behavior is undefined unless
+        // 'object', when cast appropriately to 'void *', was allocated using
+        // this pool and has not already been deallocated.  Note that
+        // 'dynamic_cast<void *>(object)' is applied if 'TYPE' is polymorphic,
+        // and 'static_cast<void *>(object)' is applied otherwise.
+
+    template <class TYPE>
+    void deleteObjectRaw(const TYPE *object);
+        // Destroy the specified 'object' and then use this pool to deallocate
+        // its memory footprint.  This method has no effect if 'object' is 0.
+        // The behavior is undefined unless 'object' is !not! a secondary base
+        // class pointer (i.e., the address is (numerically) the same as when
+        // it was originally dispensed by this pool), was allocated using this
+        // pool, and has not already been deallocated.
+
+    void release();
+        // Relinquish all memory currently allocated via this pool object.  The
+        // behavior is undefined if any other thread is using this pool.
+
+    void reserveCapacity(int numBlocks);
+        // Add the specified 'numBlocks' newly-allocated free blocks to the
+        // shard of the calling thread, so that at least 'numBlocks' requests
+        // are satisfied before the pool replenishes.  The behavior is
+        // undefined unless '0 <= numBlocks'.  Note that, unlike
+        // 'bdlma::ConcurrentPool::reserveCapacity', this method does not
+        // account for blocks that are already free.
+
+    // ACCESSORS
+    bsls::Types::size_type blockSize() const;
+        // Return the size (in bytes) of the memory blocks allocated from this
+        // pool object.  Note that all blocks dispensed by this pool have the
+        // same size.
+
+    int numShards() const;
+        // Return the number of free lists among which the free blocks of this
+        // pool are partitioned.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to allocate memory.  Note
+        // that this allocator can not be used to deallocate memory
+        // allocated through this pool.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// FREE OPERATORS
+void *operator new(bsl::size_t                                size,
+                   BloombergLP::bdlma::ShardedConcurrentPool& pool);
+    // Return a block of memory of the specified 'size' (in bytes) allocated
+    // from the specified 'pool'.  The behavior is undefined unless 'size' is
+    // the same or smaller than the 'blockSize' with which 'pool' was
+    // constructed.  Note that, as with 'bdlma::ConcurrentPool', objects
+    // created this way should be destroyed with 'pool.deleteObject'.
+
+void operator delete(void                                      *address,
+                     BloombergLP::bdlma::ShardedConcurrentPool&  pool);
+    // Use the specified 'pool' to deallocate the memory at the specified
+    // 'address'.  The behavior is undefined unless 'address' was allocated
+    // using 'pool' and has not already been deallocated.  This operator is
+    // supplied solely to allow the compiler to arrange for it to be called in
+    // case of an exception.  Client code should not call it; use
+    // 'bdlma::ShardedConcurrentPool::deleteObject()' instead.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bdlma {
+
+                       // ---------------------------
+                       // class ShardedConcurrentPool
+                       // ---------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void ShardedConcurrentPool::deleteObject(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObject(object, this);
+}
+
+template <class TYPE>
+inline
+void ShardedConcurrentPool::deleteObjectRaw(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObjectRaw(object, this);
+}
+
+// ACCESSORS
+inline
+bsls::Types::size_type ShardedConcurrentPool::blockSize() const
+{
+    return d_blockSize;
+}
+
+inline
+int ShardedConcurrentPool::numShards() const
+{
+    return d_numShards;
+}
+
+// Aspects
+
+inline
+bslma::Allocator *ShardedConcurrentPool::allocator() const
+{
+    return d_blockList.allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// FREE OPERATORS
+inline
+void *operator new(bsl::size_t                                size,
+                   BloombergLP::bdlma::ShardedConcurrentPool& pool)
+{
+    using namespace BloombergLP;
+
+    BSLS_ASSERT_SAFE(size <= pool.blockSize());
+
+    static_cast<void>(size);  // suppress "unused parameter" warnings
+    return pool.allocate();
+}
+
+inline
+void operator delete(void                                      *address,
+                     BloombergLP::bdlma::ShardedConcurrentPool&  pool)
+{
+    BSLS_ASSERT_SAFE(address);
+
+    pool.deallocate(address);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1086 @@
+// bdlma_shardedconcurrentpool.t.cpp                                  -*-C++-*-
+#include <bdlma_shardedconcurrentpool.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ShardedConcurrentPool' is a thread-safe pool of fixed-size blocks
+// whose free blocks are partitioned among per-thread shards.  The primary
+// concerns are that the pool dispenses properly sized and aligned, distinct
+// blocks, that freed blocks are reused, that the chunk growth strategy is
+// honored, that a thread whose shard is empty steals the blocks freed to
+// other shards before allocating new memory, and that the pool is correct
+// when used concurrently by many threads.  A benchmark (case -1) compares the
+// scaling of this pool with that of 'bdlma::ConcurrentPool'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ShardedConcurrentPool(size_type blockSize, Allocator *ba = 0);
+// [ 2] ShardedConcurrentPool(size_type, Strategy, Allocator *ba = 0);
+// [ 2] ShardedConcurrentPool(size_type, Strategy, int, Allocator *ba);
+// [ 2] ShardedConcurrentPool(size_type, int, Strategy, int, Allocator * = 0);
+// [ 2] ~ShardedConcurrentPool();
+//
+// MANIPULATORS
+// [ 3] void *allocate();
+// [ 3] void deallocate(void *address);
+// [ 6] void deleteObject(const TYPE *object);
+// [ 6] void deleteObjectRaw(const TYPE *object);
+// [ 5] void release();
+// [ 5] void reserveCapacity(int numBlocks);
+//
+// ACCESSORS
+// [ 2] size_type blockSize() const;
+// [ 2] int numShards() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 6] void *operator new(size_t size, ShardedConcurrentPool& pool);
+// [ 6] void operator delete(void *address, ShardedConcurrentPool& pool);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] WORK STEALING
+// [ 7] CONCURRENCY
+// [ 8] USAGE EXAMPLE
+// [-1] SCALING BENCHMARK
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ShardedConcurrentPool Obj;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+// ============================================================================
+//                  HELPER FUNCTIONS AND TYPES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                             // ================
+                             // class my_Counted
+                             // ================
+
+class my_Counted {
+    // This class counts the number of live objects of its type.
+
+    // DATA
+    int d_value;
+
+  public:
+    // PUBLIC CLASS DATA
+    static int s_numLive;
+
+    // CREATORS
+    explicit my_Counted(int value) : d_value(value) { ++s_numLive; }
+    ~my_Counted() { --s_numLive; }
+
+    // ACCESSORS
+    int value() const { return d_value; }
+};
+
+int my_Counted::s_numLive = 0;
+
+struct FreeArgs {
+    // Arguments for 'freeBlocks'.
+
+    Obj   *d_obj_p;
+    void **d_blocks_p;
+    int    d_numBlocks;
+};
+
+extern "C" void *freeBlocks(void *arg)
+    // Deallocate the blocks described by the 'FreeArgs' object at the
+    // specified 'arg'.
+{
+    FreeArgs& args = *static_cast<FreeArgs *>(arg);
+
+    for (int i = 0; i < args.d_numBlocks; ++i) {
+        args.d_obj_p->deallocate(args.d_blocks_p[i]);
+    }
+    return 0;
+}
+
+struct StressArgs {
+    // Arguments for 'stressThread'.
+
+    Obj            *d_obj_p;
+    bslmt::Barrier *d_barrier_p;
+    void          **d_exchange_p;  // one slot per thread
+    int             d_numThreads;
+    int             d_index;
+    int             d_blockSize;
+};
+
+extern "C" void *stressThread(void *arg)
+    // Repeatedly allocate and fill blocks from the pool described by the
+    // 'StressArgs' object at the specified 'arg', verifying that no block is
+    // handed out twice, and free half of the blocks allocated by another
+    // thread.
+{
+    StressArgs& args = *static_cast<StressArgs *>(arg);
+
+    enum { k_NUM_BLOCKS = 100, k_NUM_ROUNDS = 50 };
+
+    bsl::vector<unsigned char *> blocks(k_NUM_BLOCKS);
+
+    const unsigned char mark = static_cast<unsigned char>(args.d_index + 1);
+
+    for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            blocks[i] = static_cast<unsigned char *>(args.d_obj_p->allocate());
+            bsl::memset(blocks[i], mark, args.d_blockSize);
+        }
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            ASSERTV(args.d_index, i, mark == blocks[i][0]);
+            ASSERTV(args.d_index, i,
+                    mark == blocks[i][args.d_blockSize - 1]);
+        }
+
+        // Free the first half locally, and hand the second half to the next
+        // thread, freeing whatever the previous thread handed to us.
+
+        for (int i = 0; i < k_NUM_BLOCKS / 2; ++i) {
+            args.d_obj_p->deallocate(blocks[i]);
+        }
+
+        unsigned char **handoff = static_cast<unsigned char **>(
+                            args.d_obj_p->allocator()->allocate(
+                                   (k_NUM_BLOCKS / 2) * sizeof *handoff));
+        for (int i = 0; i < k_NUM_BLOCKS / 2; ++i) {
+            handoff[i] = blocks[k_NUM_BLOCKS / 2 + i];
+        }
+        args.d_exchange_p[args.d_index] = handoff;
+
+        args.d_barrier_p->wait();
+
+        const int previous = (args.d_index + args.d_numThreads - 1)
+                                                          % args.d_numThreads;
+        unsigned char **received = static_cast<unsigned char **>(
+                                                args.d_exchange_p[previous]);
+
+        args.d_barrier_p->wait();
+
+        const unsigned char previousMark =
+                                      static_cast<unsigned char>(previous + 1);
+        for (int i = 0; i < k_NUM_BLOCKS / 2; ++i) {
+            ASSERTV(args.d_index, i, previousMark == received[i][0]);
+            args.d_obj_p->deallocate(received[i]);
+        }
+        args.d_obj_p->allocator()->deallocate(received);
+    }
+    return 0;
+}
+
+                          // ========================
+                          // namespace scalingBenchmark
+                          // ========================
+
+namespace scalingBenchmark {
+
+template <class POOL>
+struct Args {
+    // Arguments for 'run'.
+
+    POOL           *d_pool_p;
+    bslmt::Barrier *d_barrier_p;
+    int             d_numIterations;
+    int             d_batchSize;
+};
+
+template <class POOL>
+void *run(void *arg)
+    // Allocate and deallocate batches of blocks from the pool described by
+    // the 'Args<POOL>' object at the specified 'arg'.
+{
+    Args<POOL>& args = *static_cast<Args<POOL> *>(arg);
+
+    bsl::vector<void *> blocks(args.d_batchSize);
+
+    args.d_barrier_p->wait();
+
+    for (int i = 0; i < args.d_numIterations; ++i) {
+        for (int j = 0; j < args.d_batchSize; ++j) {
+            blocks[j] = args.d_pool_p->allocate();
+            *static_cast<int *>(blocks[j]) = j;
+        }
+        for (int j = 0; j < args.d_batchSize; ++j) {
+            args.d_pool_p->deallocate(blocks[j]);
+        }
+    }
+
+    args.d_barrier_p->wait();
+    return 0;
+}
+
+extern "C" void *runConcurrentPool(void *arg)
+    // Run the benchmark loop on a 'bdlma::ConcurrentPool' described by the
+    // 'Args' object at the specified 'arg'.
+{
+    return run<bdlma::ConcurrentPool>(arg);
+}
+
+extern "C" void *runShardedPool(void *arg)
+    // Run the benchmark loop on a 'bdlma::ShardedConcurrentPool' described by
+    // the 'Args' object at the specified 'arg'.
+{
+    return run<bdlma::ShardedConcurrentPool>(arg);
+}
+
+template <class POOL>
+double measure(POOL                            *pool,
+               bslmt_ThreadFunction             function,
+               int                              numThreads,
+               int                              numIterations,
+               int                              batchSize)
+    // Return the number of millions of 'allocate'/'deallocate' pairs per
+    // second achieved by the specified 'numThreads' threads, each running the
+    // specified 'function' for the specified 'numIterations' of a batch of
+    // the specified 'batchSize' blocks from the specified 'pool'.
+{
+    bslmt::Barrier barrier(numThreads + 1);
+
+    Args<POOL> args;
+    args.d_pool_p        = pool;
+    args.d_barrier_p     = &barrier;
+    args.d_numIterations = numIterations;
+    args.d_batchSize     = batchSize;
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], function, &args);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start(false);
+    barrier.wait();
+    barrier.wait();
+    timer.stop();
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    const double numOperations = static_cast<double>(numThreads)
+                                                  * numIterations * batchSize;
+
+    return numOperations / timer.accumulatedWallTime() / 1.0e6;
+}
+
+}  // close namespace scalingBenchmark
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Pool Shared by Many Producer Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server has many threads, each of which builds, processes,
+// and then discards a large number of small, fixed-size message objects, and
+// that we want to draw the memory for those objects from a single pool that
+// does not become a bottleneck as the number of threads grows.
+//
+// First, we define the message type:
+//..
+    struct my_Message {
+        int    d_id;
+        double d_value;
+    };
+//..
+// Then, we define the work performed by each thread, which repeatedly
+// allocates a batch of messages from the pool, and returns them:
+//..
+    extern "C" void *processMessages(void *arg)
+    {
+        bdlma::ShardedConcurrentPool *pool =
+                              static_cast<bdlma::ShardedConcurrentPool *>(arg);
+
+        enum { k_BATCH_SIZE = 32 };
+
+        my_Message *batch[k_BATCH_SIZE];
+
+        for (int i = 0; i < 1000; ++i) {
+            for (int j = 0; j < k_BATCH_SIZE; ++j) {
+                batch[j] = new (*pool) my_Message();
+                batch[j]->d_id = j;
+            }
+            for (int j = 0; j < k_BATCH_SIZE; ++j) {
+                pool->deleteObject(batch[j]);
+            }
+        }
+        return 0;
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+// Next, we create a pool having 8 shards:
+//..
+    bdlma::ShardedConcurrentPool pool(sizeof(my_Message),
+                                      8,
+                                      bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                      32);
+    ASSERT(8 == pool.numShards());
+//..
+// Then, we start a number of threads, each of which uses the pool:
+//..
+    enum { k_NUM_THREADS = 8 };
+
+    bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], processMessages, &pool);
+    }
+//..
+// Finally, we wait for the threads to finish.  The blocks they allocated
+// remain in the pool, available for reuse, until the pool is released or
+// destroyed:
+//..
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Many threads may allocate and deallocate concurrently, including
+        //:   deallocating blocks allocated by other threads, without any block
+        //:   being dispensed to two threads at once.
+        //:
+        //: 2 The pool behaves correctly whether there are fewer, as many, or
+        //:   more shards than threads.
+        //
+        // Plan:
+        //: 1 For several numbers of shards, start a number of threads that
+        //:   each repeatedly allocate a batch of blocks, fill every block with
+        //:   a thread-specific mark, verify the marks, free half of the batch,
+        //:   and pass the other half to a neighboring thread to be verified
+        //:   and freed.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENCY\n"
+                             "===========\n";
+
+        enum { k_NUM_THREADS = 8 };
+
+        static const int NUM_SHARDS[] = { 1, 2, 8, 32 };
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const int SHARDS = NUM_SHARDS[ti];
+
+            if (veryVerbose) { T_; P(SHARDS); }
+
+            bslma::TestAllocator ta("test", veryVerbose);
+            {
+                Obj mX(24, SHARDS, bsls::BlockGrowth::BSLS_GEOMETRIC, 16, &ta);
+
+                bslmt::Barrier barrier(k_NUM_THREADS);
+                void          *exchange[k_NUM_THREADS];
+
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                StressArgs                args[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    args[i].d_obj_p      = &mX;
+                    args[i].d_barrier_p  = &barrier;
+                    args[i].d_exchange_p = exchange;
+                    args[i].d_numThreads = k_NUM_THREADS;
+                    args[i].d_index      = i;
+                    args[i].d_blockSize  = 24;
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          stressThread,
+                                                          &args[i]));
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                }
+
+                // Every block must now be free: allocating, from one thread,
+                // as many blocks as were certainly live at once must yield
+                // distinct addresses and require no more memory.
+
+                const bsls::Types::Int64 numBlocksInUse = ta.numBlocksInUse();
+
+                bsl::set<void *> addresses;
+                for (int i = 0; i < k_NUM_THREADS * 50; ++i) {
+                    ASSERTV(SHARDS, i,
+                            addresses.insert(mX.allocate()).second);
+                }
+                ASSERTV(SHARDS, numBlocksInUse == ta.numBlocksInUse());
+            }
+            ASSERTV(SHARDS, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'deleteObject', 'deleteObjectRaw', AND FREE OPERATORS
+        //
+        // Concerns:
+        //: 1 'operator new' allocates an object from the pool, and
+        //:   'deleteObject' and 'deleteObjectRaw' destroy the object and
+        //:   return its memory to the pool.
+        //:
+        //: 2 'deleteObject' and 'deleteObjectRaw' have no effect on a null
+        //:   pointer.
+        //:
+        //: 3 The placement 'operator delete' returns memory to the pool.
+        //
+        // Plan:
+        //: 1 Create objects that count the number of live instances with
+        //:   'operator new', destroy them with 'deleteObject' and
+        //:   'deleteObjectRaw', and verify the count and that the memory is
+        //:   reused.  (C-1)
+        //:
+        //: 2 Call 'deleteObject' and 'deleteObjectRaw' with null pointers.
+        //:   (C-2)
+        //:
+        //: 3 Call 'operator delete' directly, and verify that the memory is
+        //:   reused.  (C-3)
+        //
+        // Testing:
+        //   void deleteObject(const TYPE *object);
+        //   void deleteObjectRaw(const TYPE *object);
+        //   void *operator new(size_t size, ShardedConcurrentPool& pool);
+        //   void operator delete(void *address, ShardedConcurrentPool& pool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "'deleteObject', 'deleteObjectRaw', AND FREE "
+                             "OPERATORS\n"
+                             "============================================"
+                             "=========\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj mX(sizeof(my_Counted), 1, bsls::BlockGrowth::BSLS_CONSTANT,
+                   4, &ta);
+
+            my_Counted *p = new (mX) my_Counted(7);
+            ASSERT(1 == my_Counted::s_numLive);
+            ASSERT(7 == p->value());
+
+            mX.deleteObject(p);
+            ASSERT(0 == my_Counted::s_numLive);
+
+            my_Counted *q = new (mX) my_Counted(8);
+            ASSERT(p == q);
+            ASSERT(1 == my_Counted::s_numLive);
+
+            mX.deleteObjectRaw(q);
+            ASSERT(0 == my_Counted::s_numLive);
+
+            mX.deleteObject(static_cast<my_Counted *>(0));
+            mX.deleteObjectRaw(static_cast<my_Counted *>(0));
+
+            void *r = operator new(sizeof(my_Counted), mX);
+            ASSERT(r == q);
+            operator delete(r, mX);
+            ASSERT(r == mX.allocate());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'release' AND 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 'release' returns all memory to the underlying allocator, and
+        //:   the pool is usable afterwards.
+        //:
+        //: 2 'reserveCapacity' obtains memory for the specified number of
+        //:   blocks, after which that many requests are satisfied without
+        //:   further allocation.
+        //:
+        //: 3 'reserveCapacity(0)' has no effect.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks, call 'release', verify that the test allocator
+        //:   has only the shard array in use, and allocate again.  (C-1)
+        //:
+        //: 2 Call 'reserveCapacity' and verify that subsequent requests do not
+        //:   allocate from the test allocator.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void release();
+        //   void reserveCapacity(int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'release' AND 'reserveCapacity'\n"
+                             "=======================================\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj mX(16, 4, bsls::BlockGrowth::BSLS_GEOMETRIC, 8, &ta);
+
+            ASSERT(1 == ta.numBlocksInUse());  // the shard array
+
+            for (int i = 0; i < 100; ++i) {
+                mX.allocate();
+            }
+            ASSERT(1 < ta.numBlocksInUse());
+
+            mX.release();
+            ASSERT(1 == ta.numBlocksInUse());
+
+            void *p = mX.allocate();
+            ASSERT(p);
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(16, 4, bsls::BlockGrowth::BSLS_CONSTANT, 1, &ta);
+
+            mX.reserveCapacity(0);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            mX.reserveCapacity(50);
+            ASSERT(2 == ta.numBlocksInUse());
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            bsl::set<void *> addresses;
+            for (int i = 0; i < 50; ++i) {
+                ASSERTV(i, addresses.insert(mX.allocate()).second);
+            }
+            ASSERT(numAllocations == ta.numAllocations());
+
+            mX.allocate();
+            ASSERT(numAllocations + 1 == ta.numAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(16, &ta);
+
+            ASSERT_PASS(mX.reserveCapacity(0));
+            ASSERT_FAIL(mX.reserveCapacity(-1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // WORK STEALING
+        //
+        // Concerns:
+        //: 1 Blocks freed by another thread (and so, in general, to another
+        //:   shard) are reused by a thread whose shard is empty, rather than
+        //:   new memory being allocated.
+        //:
+        //: 2 All of the blocks freed to another shard are reclaimed, not just
+        //:   one, even though each steal takes a bounded batch of blocks
+        //:   (fewer than the number of blocks freed).
+        //
+        // Plan:
+        //: 1 For several numbers of shards, allocate a number of blocks in the
+        //:   main thread, free them all in a second thread, and then allocate
+        //:   the same number of blocks again in the main thread; verify that
+        //:   no memory was allocated from the test allocator, and that the
+        //:   same set of addresses was obtained.  (C-1..2)
+        //
+        // Testing:
+        //   WORK STEALING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "WORK STEALING\n"
+                             "=============\n";
+
+        enum { k_NUM_BLOCKS = 200 };
+
+        static const int NUM_SHARDS[] = { 1, 2, 4, 16, 64 };
+
+        for (int ti = 0; ti < 5; ++ti) {
+            const int SHARDS = NUM_SHARDS[ti];
+
+            bslma::TestAllocator ta("test", veryVerbose);
+
+            // Use chunks that exactly divide 'k_NUM_BLOCKS', so that no
+            // never-allocated blocks remain in the pool.
+
+            Obj mX(32, SHARDS, bsls::BlockGrowth::BSLS_CONSTANT, 8, &ta);
+
+            void *blocks[k_NUM_BLOCKS];
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate();
+            }
+            const bsl::set<void *> EXP(blocks, blocks + k_NUM_BLOCKS);
+
+            FreeArgs args = { &mX, blocks, k_NUM_BLOCKS };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, freeBlocks, &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            bsl::set<void *> addresses;
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                addresses.insert(mX.allocate());
+            }
+            ASSERTV(SHARDS, numAllocations == ta.numAllocations());
+            ASSERTV(SHARDS, EXP == addresses);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, distinct, writable blocks
+        //:   of (at least) the block size.
+        //:
+        //: 2 A deallocated block is reused by the next 'allocate' from the
+        //:   same thread.
+        //:
+        //: 3 Memory is obtained in chunks whose sizes follow the growth
+        //:   strategy and maximum blocks per chunk specified at construction.
+        //
+        // Plan:
+        //: 1 For a variety of block sizes, allocate a number of blocks, and
+        //:   verify their alignment and distinctness, and that they do not
+        //:   overlap when written.  (C-1)
+        //:
+        //: 2 Deallocate a block and verify that the next allocation returns
+        //:   it.  (C-2)
+        //:
+        //: 3 Allocate blocks one by one and verify that the test allocator
+        //:   is called exactly when expected, for geometric and constant
+        //:   growth.  (C-3)
+        //
+        // Testing:
+        //   void *allocate();
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "'allocate' AND 'deallocate'\n"
+                             "===========================\n";
+
+        if (verbose) cout << "\nAlignment, distinctness, and extent." << endl;
+        {
+            static const int SIZES[] = { 1, 7, 8, 15, 16, 17, 33, 100, 1000 };
+
+            for (int ti = 0; ti < 9; ++ti) {
+                const int SIZE = SIZES[ti];
+
+                bslma::TestAllocator ta("test", veryVerbose);
+                {
+                    Obj mX(SIZE, 4, bsls::BlockGrowth::BSLS_GEOMETRIC, 8, &ta);
+
+                    bsl::vector<unsigned char *> blocks;
+                    for (int i = 0; i < 50; ++i) {
+                        unsigned char *p = static_cast<unsigned char *>(
+                                                                mX.allocate());
+                        ASSERTV(SIZE, i,
+                                0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                               % k_MAX_ALIGN);
+                        bsl::memset(p, i, SIZE);
+                        blocks.push_back(p);
+                    }
+                    for (int i = 0; i < 50; ++i) {
+                        ASSERTV(SIZE, i, i == blocks[i][0]);
+                        ASSERTV(SIZE, i, i == blocks[i][SIZE - 1]);
+                    }
+
+                    mX.deallocate(blocks[17]);
+                    ASSERTV(SIZE, blocks[17] == mX.allocate());
+                }
+                ASSERTV(SIZE, 0 == ta.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nGrowth strategy." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVerbose);
+
+            Obj mX(8, 1, bsls::BlockGrowth::BSLS_GEOMETRIC, 4, &ta);
+
+            // Chunks of 1, 2, 4, 4, ... blocks.
+
+            static const int EXP_ALLOCATIONS[] = {
+                1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5
+            };
+
+            const bsls::Types::Int64 base = ta.numAllocations();
+            for (int i = 0; i < 13; ++i) {
+                mX.allocate();
+                ASSERTV(i, EXP_ALLOCATIONS[i] == ta.numAllocations() - base);
+            }
+
+            Obj mY(8, 1, bsls::BlockGrowth::BSLS_CONSTANT, 3, &ta);
+
+            const bsls::Types::Int64 baseY = ta.numAllocations();
+            for (int i = 0; i < 9; ++i) {
+                mY.allocate();
+                ASSERTV(i, i / 3 + 1 == ta.numAllocations() - baseY);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a pool having the specified block size,
+        //:   using the specified allocator, or the default allocator if none
+        //:   is specified.
+        //:
+        //: 2 The number of shards is that specified, or, by default, the
+        //:   number of hardware threads rounded up to a power of two and
+        //:   capped at 'k_MAX_NUM_SHARDS'.
+        //:
+        //: 3 The destructor returns all memory to the allocator.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create pools with each constructor, and verify the values of the
+        //:   accessors and the source of memory.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   ShardedConcurrentPool(size_type blockSize, Allocator *ba = 0);
+        //   ShardedConcurrentPool(size_type, Strategy, Allocator *ba = 0);
+        //   ShardedConcurrentPool(size_type, Strategy, int, Allocator *ba);
+        //   ShardedConcurrentPool(size_type, int, Strategy, int, Allocator *);
+        //   ~ShardedConcurrentPool();
+        //   size_type blockSize() const;
+        //   int numShards() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CREATORS AND ACCESSORS\n"
+                             "======================\n";
+
+        int expNumShards = 1;
+        while (expNumShards <
+                     static_cast<int>(bslmt::ThreadUtil::hardwareConcurrency())
+            && expNumShards < Obj::k_MAX_NUM_SHARDS) {
+            expNumShards *= 2;
+        }
+
+        if (veryVerbose) { T_; P(expNumShards); }
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         ta("test", veryVerbose);
+
+        for (char cfg = 'a'; cfg <= 'h'; ++cfg) {
+            const bool useDefault = cfg <= 'd';
+
+            bslma::TestAllocator&  sa = useDefault ? da : ta;
+            bslma::Allocator      *ba = useDefault ? 0 : &ta;
+
+            Obj *objPtr      = 0;
+            int  EXP_SHARDS  = expNumShards;
+
+            switch (cfg) {
+              case 'a':
+              case 'e': {
+                objPtr = new Obj(20, ba);
+              } break;
+              case 'b':
+              case 'f': {
+                objPtr = new Obj(20, bsls::BlockGrowth::BSLS_CONSTANT, ba);
+              } break;
+              case 'c':
+              case 'g': {
+                objPtr = new Obj(20, bsls::BlockGrowth::BSLS_GEOMETRIC, 5, ba);
+              } break;
+              case 'd':
+              case 'h': {
+                objPtr = new Obj(20,
+                                 16,
+                                 bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                 5,
+                                 ba);
+                EXP_SHARDS = 16;
+              } break;
+            }
+
+            const Obj& X = *objPtr;
+
+            ASSERTV(cfg, 20         == X.blockSize());
+            ASSERTV(cfg, EXP_SHARDS == X.numShards());
+            ASSERTV(cfg, &sa        == X.allocator());
+            ASSERTV(cfg, 1          == sa.numBlocksInUse());
+
+            objPtr->allocate();
+            ASSERTV(cfg, 2 == sa.numBlocksInUse());
+
+            delete objPtr;
+            ASSERTV(cfg, 0 == da.numBlocksInUse());
+            ASSERTV(cfg, 0 == ta.numBlocksInUse());
+        }
+
+        {
+            Obj mX(8, 0, bsls::BlockGrowth::BSLS_GEOMETRIC, 1, &ta);
+            ASSERT(expNumShards == mX.numShards());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsls::BlockGrowth::Strategy G =
+                                             bsls::BlockGrowth::BSLS_GEOMETRIC;
+
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(0, &ta));
+
+            ASSERT_PASS(Obj(8, 1, G, 1, &ta));
+            ASSERT_FAIL(Obj(8, 1, G, 0, &ta));
+
+            ASSERT_PASS(Obj(8, Obj::k_MAX_NUM_SHARDS, G, 1, &ta));
+            ASSERT_FAIL(Obj(8, 2 * Obj::k_MAX_NUM_SHARDS, G, 1, &ta));
+            ASSERT_FAIL(Obj(8, 3, G, 1, &ta));
+            ASSERT_FAIL(Obj(8, -1, G, 1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate a few blocks, and verify that they are
+        //:   distinct and reused.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj mX(sizeof(double), &ta);
+
+            void *p1 = mX.allocate();
+            void *p2 = mX.allocate();
+            void *p3 = mX.allocate();
+            ASSERT(p1);  ASSERT(p2);  ASSERT(p3);
+            ASSERT(p1 != p2);  ASSERT(p2 != p3);  ASSERT(p1 != p3);
+
+            mX.deallocate(p2);
+            ASSERT(p2 == mX.allocate());
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(p3);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // SCALING BENCHMARK
+        //
+        // Concerns:
+        //: 1 The throughput of 'bdlma::ShardedConcurrentPool' scales better
+        //:   with the number of threads than that of 'bdlma::ConcurrentPool'.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ..., 64 threads, measure the rate at which the
+        //:   threads, all allocating from and deallocating to the same pool,
+        //:   perform 'allocate'/'deallocate' pairs, for each of the two pools,
+        //:   and print the results.  The number of iterations and the batch
+        //:   size may be specified as the second and third arguments.
+        //
+        // Testing:
+        //   SCALING BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "SCALING BENCHMARK\n"
+                             "=================\n";
+
+        const int numIterations = argc > 2 ? bsl::atoi(argv[2]) : 20000;
+        const int batchSize     = argc > 3 ? bsl::atoi(argv[3]) : 16;
+
+        cout << "iterations: " << numIterations
+             << ", batch size: " << batchSize
+             << ", hardware threads: "
+             << bslmt::ThreadUtil::hardwareConcurrency() << "\n\n"
+             << "threads   ConcurrentPool   ShardedConcurrentPool"
+                "   (millions of allocate/deallocate pairs per second)\n";
+
+        for (int numThreads = 1; numThreads <= 64; numThreads *= 2) {
+            double concurrentRate;
+            {
+                bdlma::ConcurrentPool pool(64);
+                concurrentRate = scalingBenchmark::measure(
+                                         &pool,
+                                         scalingBenchmark::runConcurrentPool,
+                                         numThreads,
+                                         numIterations,
+                                         batchSize);
+            }
+
+            double shardedRate;
+            {
+                bdlma::ShardedConcurrentPool pool(64);
+                shardedRate = scalingBenchmark::measure(
+                                            &pool,
+                                            scalingBenchmark::runShardedPool,
+                                            numThreads,
+                                            numIterations,
+                                            batchSize);
+            }
+
+            cout << bsl::setw(7)  << numThreads
+                 << bsl::setw(17) << concurrentRate
+                 << bsl::setw(24) << shardedRate << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,52 @@
+// bdlma_sharedptrpool.cpp                                            -*-C++-*-
+#include <bdlma_sharedptrpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_sharedptrpool_cpp,"$Id$ $CSID$")
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES) &&              \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // ------------------------
+                          // struct SharedPtrPool_Imp
+                          // ------------------------
+
+// CREATORS
+SharedPtrPool_Imp::SharedPtrPool_Imp(
+                               bsls::Types::size_type       blockSize,
+                               int                          numShards,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               int                          maxBlocksPerChunk,
+                               bslma::Allocator            *basicAllocator)
+: d_pool(blockSize,
+         numShards,
+         growthStrategy,
+         maxBlocksPerChunk,
+         basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // variadic templates and rvalue references
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
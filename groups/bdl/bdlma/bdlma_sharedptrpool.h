@@ -0,0 +1,572 @@
+// bdlma_sharedptrpool.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMA_SHAREDPTRPOOL
+#define INCLUDED_BDLMA_SHAREDPTRPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a factory of shared pointers with pooled representations.
+//
+//@CLASSES:
+//  bdlma::SharedPtrPool: thread-safe factory of pooled 'bsl::shared_ptr'
+//
+//@SEE_ALSO: bdlma_shardedconcurrentpool, bslstl_sharedptr,
+//           bdlcc_sharedobjectpool
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlma::SharedPtrPool', that creates 'bsl::shared_ptr' objects whose
+// representations -- the reference counts together with the shared object,
+// allocated in a single block exactly as by 'bsl::allocate_shared' -- are
+// drawn from a thread-safe pool of blocks of the right size, rather than from
+// a general-purpose allocator.  When the last reference (shared or weak) to an
+// object created by the pool is released, the block is returned to the pool
+// for reuse by a subsequent call to 'makeShared'.  For applications that
+// create and destroy many short-lived shared objects of one type (e.g., a
+// message fanned out to many consumers), this replaces a general-purpose
+// allocation and deallocation per object with a pop from, and push to, a
+// free list.
+//
+// The pool is a 'bdlma::ShardedConcurrentPool', whose free list is split
+// among shards selected by the calling thread, so that threads creating (and
+// releasing) shared pointers concurrently rarely contend.  Note that a block
+// is returned to the shard of the thread that releases the last reference,
+// which need not be the thread that created the object; such blocks are
+// reclaimed by work stealing (see 'bdlma_shardedconcurrentpool').
+//
+///Compatibility with 'bsl::shared_ptr'
+///------------------------------------
+// The shared pointers created by 'makeShared' are ordinary
+// 'bsl::shared_ptr<TYPE>' objects: the pool merely supplies an allocator to
+// 'bsl::allocate_shared', so the representation is an instance of the
+// existing 'bslstl::SharedPtrAllocateInplaceRep' template, and the layout and
+// interface of 'bsl::shared_ptr' are unchanged.  Such shared pointers may be
+// copied, converted, stored in containers, and passed to code that knows
+// nothing of the pool.
+//
+///Allocator Propagation
+///---------------------
+// If 'TYPE' uses 'bslma::Allocator' to supply memory (see
+// 'bslma_usesbslmaallocator'), the object created by 'makeShared' is passed
+// the allocator supplied at the construction of the pool.  That allocator
+// also supplies the chunks of memory from which the pool carves its blocks.
+//
+///Lifetime
+///--------
+// The pool must outlive every shared pointer (and weak pointer) created by
+// it: the behavior is undefined if the last reference to such an object is
+// released after the pool is destroyed.
+//
+///Thread Safety
+///-------------
+// 'makeShared' and 'reserveCapacity' may be called concurrently from any
+// number of threads, and shared pointers created by the pool may be released
+// from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out Messages
+///- - - - - - - - - - - - - - - -
+// Suppose that each message received by a server is delivered to several
+// subscribers, each holding a shared pointer to the message until it has
+// been processed, and that the rate of messages is high enough that
+// allocating each message and its reference counts from a general-purpose
+// allocator is a measurable cost.
+//
+// First, we define a message type that uses an allocator:
+//..
+//  class my_Message {
+//      // This class represents a message with a sequence number and text.
+//
+//      // DATA
+//      int         d_sequenceNumber;
+//      bsl::string d_text;
+//
+//    public:
+//      // TRAITS
+//      BSLMF_NESTED_TRAIT_DECLARATION(my_Message,
+//                                     bslma::UsesBslmaAllocator);
+//
+//      // CREATORS
+//      my_Message(int                      sequenceNumber,
+//                 const bsl::string_view&  text,
+//                 bslma::Allocator        *basicAllocator = 0)
+//      : d_sequenceNumber(sequenceNumber)
+//      , d_text(text, basicAllocator)
+//      {
+//      }
+//
+//      // ACCESSORS
+//      int sequenceNumber() const { return d_sequenceNumber; }
+//      const bsl::string& text() const { return d_text; }
+//  };
+//..
+// Then, we create a pool for messages, typically one per process (or per
+// session) that lives as long as any message it creates:
+//..
+//  bslma::TestAllocator                  ta;
+//  bdlma::SharedPtrPool<my_Message>      messagePool(&ta);
+//..
+// Next, we create a message, and pass copies of the shared pointer to our
+// subscribers:
+//..
+//  bsl::vector<bsl::shared_ptr<my_Message> > subscriberQueue;
+//
+//  bsl::shared_ptr<my_Message> message = messagePool.makeShared(
+//                                          1,
+//                                          "a message too long for SSO");
+//  assert(1 == message->sequenceNumber());
+//  assert(message->text().get_allocator().mechanism() == &ta);
+//
+//  for (int i = 0; i < 3; ++i) {
+//      subscriberQueue.push_back(message);
+//  }
+//  assert(4 == message.use_count());
+//..
+// Finally, we release all references to the message.  The block holding the
+// message and its reference counts returns to the pool, and the next message
+// reuses it without further allocation:
+//..
+//  const void *address = message.get();
+//
+//  message.reset();
+//  subscriberQueue.clear();
+//
+//  const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//
+//  message = messagePool.makeShared(2, "");
+//  assert(address        == message.get());
+//  assert(numAllocations == ta.numAllocations());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_shardedconcurrentpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bslstl_sharedptr.h>
+#include <bslstl_sharedptrallocateinplacerep.h>
+
+#include <bsl_cstddef.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES) &&              \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // ========================
+                          // struct SharedPtrPool_Imp
+                          // ========================
+
+struct SharedPtrPool_Imp {
+    // [!PRIVATE!] This 'struct' holds the state of a 'SharedPtrPool' that is
+    // shared by all of its allocator adaptors.
+
+    // PUBLIC TYPES
+    enum {
+        k_DEFAULT_MAX_BLOCKS_PER_CHUNK = 32  // default maximum chunk size
+    };
+
+    // PUBLIC DATA
+    ShardedConcurrentPool  d_pool;         // pool of representations
+    bslma::Allocator      *d_allocator_p;  // allocator for the objects (held)
+
+    // CREATORS
+    SharedPtrPool_Imp(bsls::Types::size_type       blockSize,
+                      int                          numShards,
+                      bsls::BlockGrowth::Strategy  growthStrategy,
+                      int                          maxBlocksPerChunk,
+                      bslma::Allocator            *basicAllocator);
+        // Create a pool of blocks of the specified 'blockSize', having the
+        // specified 'numShards', 'growthStrategy', and 'maxBlocksPerChunk',
+        // and using the specified 'basicAllocator' to supply memory.
+};
+
+                       // =============================
+                       // class SharedPtrPool_Allocator
+                       // =============================
+
+template <class TYPE>
+class SharedPtrPool_Allocator {
+    // [!PRIVATE!] This class is a standard-compliant allocator that supplies
+    // single blocks from the pool of a 'SharedPtrPool', and constructs
+    // objects using the allocator of that pool.  It is passed to
+    // 'bsl::allocate_shared', which rebinds it to the type of the
+    // shared-pointer representation.
+
+    // DATA
+    SharedPtrPool_Imp *d_imp_p;  // pool state (held, not owned)
+
+    // FRIENDS
+    template <class OTHER_TYPE>
+    friend class SharedPtrPool_Allocator;
+
+  public:
+    // PUBLIC TYPES
+    typedef TYPE            value_type;
+    typedef TYPE           *pointer;
+    typedef const TYPE     *const_pointer;
+    typedef TYPE&           reference;
+    typedef const TYPE&     const_reference;
+    typedef bsl::size_t     size_type;
+    typedef bsl::ptrdiff_t  difference_type;
+
+    template <class OTHER_TYPE>
+    struct rebind {
+        // This 'struct' defines the type of this allocator rebound to the
+        // (template parameter) 'OTHER_TYPE'.
+
+        typedef SharedPtrPool_Allocator<OTHER_TYPE> other;
+    };
+
+    // CREATORS
+    explicit SharedPtrPool_Allocator(SharedPtrPool_Imp *imp);
+        // Create an allocator supplying memory from the specified 'imp'.
+
+    template <class OTHER_TYPE>
+    SharedPtrPool_Allocator(const SharedPtrPool_Allocator<OTHER_TYPE>& other);
+        // Create an allocator supplying memory from the same pool as the
+        // specified 'other' allocator.
+
+    //! SharedPtrPool_Allocator(const SharedPtrPool_Allocator&) = default;
+    //! ~SharedPtrPool_Allocator() = default;
+
+    // MANIPULATORS
+    //! SharedPtrPool_Allocator& operator=(
+    //                           const SharedPtrPool_Allocator&) = default;
+
+    TYPE *allocate(size_type n);
+        // Return a block from the pool suitable for the specified 'n' objects
+        // of 'TYPE'.  The behavior is undefined unless '1 == n' and a 'TYPE'
+        // fits in a block of the pool.
+
+    void deallocate(TYPE *address, size_type n);
+        // Return the block at the specified 'address', obtained by
+        // 'allocate(n)' for the specified 'n', to the pool.
+
+    template <class ELEMENT_TYPE, class... ARGS>
+    void construct(ELEMENT_TYPE *address, ARGS&&... arguments);
+        // Construct an object of the (template parameter) 'ELEMENT_TYPE' at
+        // the specified 'address' from the specified 'arguments', passing the
+        // allocator of the pool to the constructor if 'ELEMENT_TYPE' uses
+        // 'bslma::Allocator'.
+
+    template <class ELEMENT_TYPE>
+    void destroy(ELEMENT_TYPE *address);
+        // Destroy the object at the specified 'address'.
+
+    // ACCESSORS
+    SharedPtrPool_Imp *imp() const;
+        // Return the address of the pool state used by this allocator.
+};
+
+// FREE OPERATORS
+template <class TYPE1, class TYPE2>
+bool operator==(const SharedPtrPool_Allocator<TYPE1>& lhs,
+                const SharedPtrPool_Allocator<TYPE2>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' allocators use the same
+    // pool, and 'false' otherwise.
+
+template <class TYPE1, class TYPE2>
+bool operator!=(const SharedPtrPool_Allocator<TYPE1>& lhs,
+                const SharedPtrPool_Allocator<TYPE2>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' allocators use
+    // different pools, and 'false' otherwise.
+
+                            // ===================
+                            // class SharedPtrPool
+                            // ===================
+
+template <class TYPE>
+class SharedPtrPool {
+    // This class creates 'bsl::shared_ptr<TYPE>' objects whose in-place
+    // representations are supplied by a thread-safe pool, and recycled when
+    // the last reference to the object is released.
+
+  public:
+    // PUBLIC TYPES
+    typedef SharedPtrPool_Allocator<TYPE> AllocatorType;
+        // The allocator passed to 'bsl::allocate_shared'.
+
+    typedef bslstl::SharedPtrAllocateInplaceRep<TYPE, AllocatorType> Rep;
+        // The type of the representation of each shared pointer created by
+        // the pool.
+
+  private:
+    // DATA
+    SharedPtrPool_Imp d_imp;  // pool and object allocator
+
+    BSLMF_ASSERT(static_cast<int>(bsls::AlignmentFromType<Rep>::VALUE) <=
+                 static_cast<int>(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+
+  private:
+    // NOT IMPLEMENTED
+    SharedPtrPool(const SharedPtrPool&);
+    SharedPtrPool& operator=(const SharedPtrPool&);
+
+  public:
+    // CREATORS
+    explicit SharedPtrPool(bslma::Allocator *basicAllocator = 0);
+    explicit SharedPtrPool(int               numShards,
+                           bslma::Allocator *basicAllocator = 0);
+    SharedPtrPool(int                          numShards,
+                  bsls::BlockGrowth::Strategy  growthStrategy,
+                  int                          maxBlocksPerChunk,
+                  bslma::Allocator            *basicAllocator = 0);
+        // Create a pool of shared-pointer representations for objects of the
+        // (template parameter) 'TYPE'.  Optionally specify 'numShards', the
+        // number of shards of the underlying 'bdlma::ShardedConcurrentPool';
+        // if 'numShards' is 0 or not specified, the number of hardware threads
+        // (rounded up to a power of two) is used.  If 'numShards' is
+        // specified, optionally specify a 'growthStrategy' and
+        // 'maxBlocksPerChunk' governing how the pool obtains memory (see
+        // 'bdlma_shardedconcurrentpool'); if not specified, geometric growth
+        // and an implementation-defined maximum are used.  Optionally specify
+        // a 'basicAllocator' used to supply memory for the pool and for the
+        // objects created by 'makeShared'.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The behavior is
+        // undefined unless 'numShards' is 0 or a power of two no greater than
+        // 'ShardedConcurrentPool::k_MAX_NUM_SHARDS', and
+        // '1 <= maxBlocksPerChunk'.
+
+    //! ~SharedPtrPool() = default;
+        // Destroy this pool, releasing all of its memory.  The behavior is
+        // undefined if any shared or weak pointer created by this pool still
+        // refers to its object.
+
+    // MANIPULATORS
+    template <class... ARGS>
+    bsl::shared_ptr<TYPE> makeShared(ARGS&&... arguments);
+        // Return a shared pointer to a newly created object of the (template
+        // parameter) 'TYPE', constructed from the specified (variable number
+        // of) 'arguments' -- and, if 'TYPE' uses 'bslma::Allocator', the
+        // allocator of this pool -- in a representation supplied by this
+        // pool.  When the last shared or weak pointer to the object is
+        // released, the representation is returned to this pool.  If an
+        // exception is thrown by the constructor of 'TYPE', the
+        // representation is returned to this pool and the exception is
+        // propagated.
+
+    void reserveCapacity(int numObjects);
+        // Reserve memory for at least the specified 'numObjects'
+        // representations, in addition to any already available.  The
+        // behavior is undefined unless '0 <= numObjects'.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the address of the allocator used by this pool to supply
+        // memory, and passed to the objects it creates.
+
+    bsls::Types::size_type blockSize() const;
+        // Return the size (in bytes) of each representation supplied by this
+        // pool, i.e., 'sizeof(Rep)'.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class SharedPtrPool_Allocator
+                       // -----------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SharedPtrPool_Allocator<TYPE>::SharedPtrPool_Allocator(SharedPtrPool_Imp *imp)
+: d_imp_p(imp)
+{
+    BSLS_ASSERT_SAFE(imp);
+}
+
+template <class TYPE>
+template <class OTHER_TYPE>
+inline
+SharedPtrPool_Allocator<TYPE>::SharedPtrPool_Allocator(
+                             const SharedPtrPool_Allocator<OTHER_TYPE>& other)
+: d_imp_p(other.d_imp_p)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+TYPE *SharedPtrPool_Allocator<TYPE>::allocate(size_type n)
+{
+    BSLS_ASSERT_SAFE(1 == n);
+    BSLS_ASSERT_SAFE(sizeof(TYPE) <= d_imp_p->d_pool.blockSize());
+
+    (void)n;
+
+    return static_cast<TYPE *>(d_imp_p->d_pool.allocate());
+}
+
+template <class TYPE>
+inline
+void SharedPtrPool_Allocator<TYPE>::deallocate(TYPE *address, size_type)
+{
+    d_imp_p->d_pool.deallocate(address);
+}
+
+template <class TYPE>
+template <class ELEMENT_TYPE, class... ARGS>
+inline
+void SharedPtrPool_Allocator<TYPE>::construct(ELEMENT_TYPE *address,
+                                              ARGS&&...     arguments)
+{
+    bslma::ConstructionUtil::construct(
+                            address,
+                            d_imp_p->d_allocator_p,
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+
+template <class TYPE>
+template <class ELEMENT_TYPE>
+inline
+void SharedPtrPool_Allocator<TYPE>::destroy(ELEMENT_TYPE *address)
+{
+    bslma::DestructionUtil::destroy(address);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+SharedPtrPool_Imp *SharedPtrPool_Allocator<TYPE>::imp() const
+{
+    return d_imp_p;
+}
+
+// FREE OPERATORS
+template <class TYPE1, class TYPE2>
+inline
+bool operator==(const SharedPtrPool_Allocator<TYPE1>& lhs,
+                const SharedPtrPool_Allocator<TYPE2>& rhs)
+{
+    return lhs.imp() == rhs.imp();
+}
+
+template <class TYPE1, class TYPE2>
+inline
+bool operator!=(const SharedPtrPool_Allocator<TYPE1>& lhs,
+                const SharedPtrPool_Allocator<TYPE2>& rhs)
+{
+    return lhs.imp() != rhs.imp();
+}
+
+                            // -------------------
+                            // class SharedPtrPool
+                            // -------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SharedPtrPool<TYPE>::SharedPtrPool(bslma::Allocator *basicAllocator)
+: d_imp(sizeof(Rep),
+        0,
+        bsls::BlockGrowth::BSLS_GEOMETRIC,
+        SharedPtrPool_Imp::k_DEFAULT_MAX_BLOCKS_PER_CHUNK,
+        basicAllocator)
+{
+}
+
+template <class TYPE>
+inline
+SharedPtrPool<TYPE>::SharedPtrPool(int               numShards,
+                                   bslma::Allocator *basicAllocator)
+: d_imp(sizeof(Rep),
+        numShards,
+        bsls::BlockGrowth::BSLS_GEOMETRIC,
+        SharedPtrPool_Imp::k_DEFAULT_MAX_BLOCKS_PER_CHUNK,
+        basicAllocator)
+{
+}
+
+template <class TYPE>
+inline
+SharedPtrPool<TYPE>::SharedPtrPool(
+                              int                          numShards,
+                              bsls::BlockGrowth::Strategy  growthStrategy,
+                              int                          maxBlocksPerChunk,
+                              bslma::Allocator            *basicAllocator)
+: d_imp(sizeof(Rep),
+        numShards,
+        growthStrategy,
+        maxBlocksPerChunk,
+        basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+template <class... ARGS>
+inline
+bsl::shared_ptr<TYPE> SharedPtrPool<TYPE>::makeShared(ARGS&&... arguments)
+{
+    return bsl::allocate_shared<TYPE>(
+                            AllocatorType(&d_imp),
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+
+template <class TYPE>
+inline
+void SharedPtrPool<TYPE>::reserveCapacity(int numObjects)
+{
+    BSLS_ASSERT(0 <= numObjects);
+
+    d_imp.d_pool.reserveCapacity(numObjects);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bslma::Allocator *SharedPtrPool<TYPE>::allocator() const
+{
+    return d_imp.d_allocator_p;
+}
+
+template <class TYPE>
+inline
+bsls::Types::size_type SharedPtrPool<TYPE>::blockSize() const
+{
+    return d_imp.d_pool.blockSize();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // variadic templates and rvalue references
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
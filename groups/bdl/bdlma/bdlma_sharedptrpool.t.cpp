@@ -0,0 +1,1116 @@
+// bdlma_sharedptrpool.t.cpp                                          -*-C++-*-
+#include <bdlma_sharedptrpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::SharedPtrPool' is a factory of 'bsl::shared_ptr' objects whose
+// in-place representations are drawn from a 'bdlma::ShardedConcurrentPool'
+// through a private standard allocator, 'SharedPtrPool_Allocator', passed to
+// 'bsl::allocate_shared'.  We first test the allocator, then the factory:
+// that arguments are forwarded, that the pool's allocator is propagated to
+// objects that use one, that representations are returned to the pool (and
+// reused) when the last shared *and* weak reference is released, that
+// exceptions thrown by constructors do not leak representations, and that the
+// factory may be used concurrently.
+// ----------------------------------------------------------------------------
+// SharedPtrPool_Allocator
+// [ 2] SharedPtrPool_Allocator(SharedPtrPool_Imp *imp);
+// [ 2] SharedPtrPool_Allocator(const SharedPtrPool_Allocator<OTHER>&);
+// [ 2] TYPE *allocate(size_type n);
+// [ 2] void deallocate(TYPE *address, size_type n);
+// [ 2] void construct(ELEMENT_TYPE *address, ARGS&&... arguments);
+// [ 2] void destroy(ELEMENT_TYPE *address);
+// [ 2] SharedPtrPool_Imp *imp() const;
+// [ 2] bool operator==(const SPPA<T1>& lhs, const SPPA<T2>& rhs);
+// [ 2] bool operator!=(const SPPA<T1>& lhs, const SPPA<T2>& rhs);
+//
+// SharedPtrPool
+// [ 3] SharedPtrPool(bslma::Allocator *basicAllocator = 0);
+// [ 3] SharedPtrPool(int numShards, bslma::Allocator *basicAllocator = 0);
+// [ 3] SharedPtrPool(int, Strategy, int, bslma::Allocator * = 0);
+// [ 3] ~SharedPtrPool();
+// [ 4] bsl::shared_ptr<TYPE> makeShared(ARGS&&... arguments);
+// [ 6] void reserveCapacity(int numObjects);
+// [ 3] bslma::Allocator *allocator() const;
+// [ 3] bsls::Types::size_type blockSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] EXCEPTION SAFETY
+// [ 7] CONCURRENCY
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'makeShared' VS. 'bsl::allocate_shared'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES) &&              \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+
+// ============================================================================
+//                  HELPER FUNCTIONS AND TYPES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                              // ===============
+                              // class my_Simple
+                              // ===============
+
+class my_Simple {
+    // This class records its constructor arguments and counts live objects.
+
+    // DATA
+    int d_a;
+    int d_b;
+    int d_c;
+
+  public:
+    // PUBLIC CLASS DATA
+    static int s_numLive;
+
+    // CREATORS
+    my_Simple() : d_a(0), d_b(0), d_c(0) { ++s_numLive; }
+    explicit my_Simple(int a) : d_a(a), d_b(0), d_c(0) { ++s_numLive; }
+    my_Simple(int a, int b) : d_a(a), d_b(b), d_c(0) { ++s_numLive; }
+    my_Simple(int a, int b, int c) : d_a(a), d_b(b), d_c(c) { ++s_numLive; }
+    ~my_Simple() { --s_numLive; }
+
+    // ACCESSORS
+    int a() const { return d_a; }
+    int b() const { return d_b; }
+    int c() const { return d_c; }
+};
+
+int my_Simple::s_numLive = 0;
+
+                           // ======================
+                           // class my_AllocatorAware
+                           // ======================
+
+class my_AllocatorAware {
+    // This class holds a string and uses 'bslma::Allocator'.
+
+    // DATA
+    bsl::string d_text;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(my_AllocatorAware,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit my_AllocatorAware(const bsl::string_view&  text,
+                               bslma::Allocator        *basicAllocator = 0)
+    : d_text(text, basicAllocator)
+    {
+    }
+
+    // ACCESSORS
+    const bsl::string& text() const { return d_text; }
+    bslma::Allocator *allocator() const
+    {
+        return d_text.get_allocator().mechanism();
+    }
+};
+
+                             // ==================
+                             // class my_MoveOnly
+                             // ==================
+
+class my_MoveOnly {
+    // This class holds an 'int' and can be moved but not copied.
+
+    // DATA
+    int d_value;
+
+    // NOT IMPLEMENTED
+    my_MoveOnly(const my_MoveOnly&);
+    my_MoveOnly& operator=(const my_MoveOnly&);
+
+  public:
+    // CREATORS
+    explicit my_MoveOnly(int value) : d_value(value) {}
+    my_MoveOnly(my_MoveOnly&& original)
+    : d_value(original.d_value)
+    {
+        original.d_value = -1;
+    }
+
+    // ACCESSORS
+    int value() const { return d_value; }
+};
+
+                           // =====================
+                           // class my_TakesMoveOnly
+                           // =====================
+
+class my_TakesMoveOnly {
+    // This class is constructed from an rvalue 'my_MoveOnly'.
+
+    // DATA
+    my_MoveOnly d_held;
+
+  public:
+    // CREATORS
+    explicit my_TakesMoveOnly(my_MoveOnly&& held)
+    : d_held(static_cast<my_MoveOnly&&>(held))
+    {
+    }
+
+    // ACCESSORS
+    int value() const { return d_held.value(); }
+};
+
+                              // ================
+                              // class my_Thrower
+                              // ================
+
+class my_Thrower {
+    // This class throws from its constructor if asked to.
+
+  public:
+    // CREATORS
+    explicit my_Thrower(bool shouldThrow)
+    {
+        if (shouldThrow) {
+            throw 42;
+        }
+    }
+};
+
+struct StressArgs {
+    // Arguments for 'stressThread'.
+
+    bdlma::SharedPtrPool<my_Simple>             *d_pool_p;
+    bslmt::Barrier                              *d_barrier_p;
+    bsl::vector<bsl::shared_ptr<my_Simple> >    *d_exchange_p;
+    int                                          d_index;
+    int                                          d_numThreads;
+};
+
+extern "C" void *stressThread(void *arg)
+    // Repeatedly create shared objects from the pool described by the
+    // 'StressArgs' object at the specified 'arg', verify them, and hand half
+    // of them to another thread to release.
+{
+    StressArgs& args = *static_cast<StressArgs *>(arg);
+
+    enum { k_NUM_OBJECTS = 64, k_NUM_ROUNDS = 50 };
+
+    bsl::vector<bsl::shared_ptr<my_Simple> > mine;
+
+    for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+        for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+            mine.push_back(args.d_pool_p->makeShared(args.d_index, i, round));
+        }
+        for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+            ASSERTV(args.d_index, i, args.d_index == mine[i]->a());
+            ASSERTV(args.d_index, i, i            == mine[i]->b());
+            ASSERTV(args.d_index, i, round        == mine[i]->c());
+        }
+
+        args.d_exchange_p[args.d_index].assign(
+                                             mine.begin(),
+                                             mine.begin() + k_NUM_OBJECTS / 2);
+        mine.clear();
+
+        args.d_barrier_p->wait();
+
+        const int previous = (args.d_index + args.d_numThreads - 1)
+                                                          % args.d_numThreads;
+        bsl::vector<bsl::shared_ptr<my_Simple> > received;
+        received.swap(args.d_exchange_p[previous]);
+
+        args.d_barrier_p->wait();
+
+        for (bsl::size_t i = 0; i < received.size(); ++i) {
+            ASSERTV(args.d_index, i, previous == received[i]->a());
+        }
+    }
+    return 0;
+}
+
+                            // ===================
+                            // namespace benchmark
+                            // ===================
+
+namespace benchmark {
+
+struct Message {
+    // The object created by the benchmark.
+
+    int    d_id;
+    double d_payload[4];
+};
+
+struct Args {
+    // Arguments for the benchmark threads.
+
+    bdlma::SharedPtrPool<Message> *d_pool_p;
+    bslmt::Barrier                *d_barrier_p;
+    int                            d_numIterations;
+    int                            d_fanOut;
+};
+
+extern "C" void *runPool(void *arg)
+    // Create, fan out, and release messages using the pool in the 'Args'
+    // object at the specified 'arg'.
+{
+    Args& args = *static_cast<Args *>(arg);
+
+    bsl::vector<bsl::shared_ptr<Message> > subscribers(args.d_fanOut);
+
+    args.d_barrier_p->wait();
+    for (int i = 0; i < args.d_numIterations; ++i) {
+        bsl::shared_ptr<Message> message = args.d_pool_p->makeShared();
+        message->d_id = i;
+        for (int j = 0; j < args.d_fanOut; ++j) {
+            subscribers[j] = message;
+        }
+    }
+    args.d_barrier_p->wait();
+    return 0;
+}
+
+extern "C" void *runAllocateShared(void *arg)
+    // Create, fan out, and release messages using 'bsl::allocate_shared' with
+    // the new/delete allocator, using the 'Args' object at the specified
+    // 'arg'.
+{
+    Args& args = *static_cast<Args *>(arg);
+
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    bsl::vector<bsl::shared_ptr<Message> > subscribers(args.d_fanOut);
+
+    args.d_barrier_p->wait();
+    for (int i = 0; i < args.d_numIterations; ++i) {
+        bsl::shared_ptr<Message> message =
+                                    bsl::allocate_shared<Message>(allocator);
+        message->d_id = i;
+        for (int j = 0; j < args.d_fanOut; ++j) {
+            subscribers[j] = message;
+        }
+    }
+    args.d_barrier_p->wait();
+    return 0;
+}
+
+double measure(bslmt_ThreadFunction function, int numThreads, Args *args)
+    // Return the wall time, in seconds, taken by the specified 'numThreads'
+    // threads each running the specified 'function' with the specified
+    // 'args'.
+{
+    bslmt::Barrier barrier(numThreads + 1);
+    args->d_barrier_p = &barrier;
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], function, args);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+    barrier.wait();
+    timer.stop();
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    return timer.accumulatedWallTime();
+}
+
+}  // close namespace benchmark
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out Messages
+///- - - - - - - - - - - - - - - -
+// Suppose that each message received by a server is delivered to several
+// subscribers, each holding a shared pointer to the message until it has
+// been processed, and that the rate of messages is high enough that
+// allocating each message and its reference counts from a general-purpose
+// allocator is a measurable cost.
+//
+// First, we define a message type that uses an allocator:
+//..
+    class my_Message {
+        // This class represents a message with a sequence number and text.
+
+        // DATA
+        int         d_sequenceNumber;
+        bsl::string d_text;
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(my_Message,
+                                       bslma::UsesBslmaAllocator);
+
+        // CREATORS
+        my_Message(int                      sequenceNumber,
+                   const bsl::string_view&  text,
+                   bslma::Allocator        *basicAllocator = 0)
+        : d_sequenceNumber(sequenceNumber)
+        , d_text(text, basicAllocator)
+        {
+        }
+
+        // ACCESSORS
+        int sequenceNumber() const { return d_sequenceNumber; }
+        const bsl::string& text() const { return d_text; }
+    };
+//..
+
+#endif  // variadic templates and rvalue references
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    (void)verbose;
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES) &&              \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+// Then, we create a pool for messages, typically one per process (or per
+// session) that lives as long as any message it creates:
+//..
+    bslma::TestAllocator                  ta;
+    bdlma::SharedPtrPool<my_Message>      messagePool(&ta);
+//..
+// Next, we create a message, and pass copies of the shared pointer to our
+// subscribers:
+//..
+    bsl::vector<bsl::shared_ptr<my_Message> > subscriberQueue;
+
+    bsl::shared_ptr<my_Message> message = messagePool.makeShared(
+                                            1,
+                                            "a message too long for SSO");
+    ASSERT(1 == message->sequenceNumber());
+    ASSERT(message->text().get_allocator().mechanism() == &ta);
+
+    for (int i = 0; i < 3; ++i) {
+        subscriberQueue.push_back(message);
+    }
+    ASSERT(4 == message.use_count());
+//..
+// Finally, we release all references to the message.  The block holding the
+// message and its reference counts returns to the pool, and the next message
+// reuses it without further allocation:
+//..
+    const void *address = message.get();
+
+    message.reset();
+    subscriberQueue.clear();
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+    message = messagePool.makeShared(2, "");
+    ASSERT(address        == message.get());
+    ASSERT(numAllocations == ta.numAllocations());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Several threads may create shared objects from one pool
+        //:   concurrently, and release objects created by other threads.
+        //:
+        //: 2 Every representation is returned to the pool.
+        //
+        // Plan:
+        //: 1 Start several threads that each repeatedly create a batch of
+        //:   objects, verify them, release half, and hand the other half to a
+        //:   neighboring thread to verify and release.  (C-1)
+        //:
+        //: 2 Afterwards, verify that no objects are alive, and that creating
+        //:   as many objects as were live at once in the test requires no
+        //:   more memory.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENCY\n"
+                             "===========\n";
+
+        enum { k_NUM_THREADS = 8 };
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            bdlma::SharedPtrPool<my_Simple> mX(&ta);
+
+            bslmt::Barrier                           barrier(k_NUM_THREADS);
+            bsl::vector<bsl::shared_ptr<my_Simple> > exchange[k_NUM_THREADS];
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            StressArgs                args[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_pool_p      = &mX;
+                args[i].d_barrier_p   = &barrier;
+                args[i].d_exchange_p  = exchange;
+                args[i].d_index       = i;
+                args[i].d_numThreads  = k_NUM_THREADS;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      stressThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERT(0 == my_Simple::s_numLive);
+
+            const bsls::Types::Int64 numBlocksInUse = ta.numBlocksInUse();
+
+            bsl::vector<bsl::shared_ptr<my_Simple> > objects;
+            for (int i = 0; i < k_NUM_THREADS * 32; ++i) {
+                objects.push_back(mX.makeShared());
+            }
+            ASSERT(numBlocksInUse == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 After 'reserveCapacity(n)', 'n' objects can be created without
+        //:   further allocation.
+        //:
+        //: 2 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Reserve capacity, then create that many objects and verify that
+        //:   the allocator was not used.  (C-1)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-2)
+        //
+        // Testing:
+        //   void reserveCapacity(int numObjects);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'reserveCapacity'\n"
+                             "=========================\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            bdlma::SharedPtrPool<my_Simple> mX(1, &ta);
+
+            mX.reserveCapacity(100);
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            bsl::vector<bsl::shared_ptr<my_Simple> > objects;
+            objects.reserve(100);
+
+            bslma::DefaultAllocatorGuard dag(&ta);
+            for (int i = 0; i < 100; ++i) {
+                objects.push_back(mX.makeShared(i));
+            }
+            ASSERT(numAllocations == ta.numAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlma::SharedPtrPool<my_Simple> mX(&ta);
+
+            ASSERT_PASS(mX.reserveCapacity(0));
+            ASSERT_FAIL(mX.reserveCapacity(-1));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If the constructor of the object throws, the exception propagates
+        //:   and the representation is returned to the pool.
+        //
+        // Plan:
+        //: 1 Create an object whose constructor throws, catch the exception,
+        //:   and verify that the next object created occupies the same block
+        //:   (for a single-shard pool) with no further allocation.  (C-1)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "EXCEPTION SAFETY\n"
+                             "================\n";
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            bdlma::SharedPtrPool<my_Thrower> mX(1, &ta);
+
+            bsl::shared_ptr<my_Thrower> p = mX.makeShared(false);
+            const void *address = p.get();
+            p.reset();
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            bool caught = false;
+            try {
+                p = mX.makeShared(true);
+            }
+            catch (int e) {
+                ASSERT(42 == e);
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(!p);
+
+            p = mX.makeShared(false);
+            ASSERT(address        == p.get());
+            ASSERT(numAllocations == ta.numAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'makeShared'
+        //
+        // Concerns:
+        //: 1 'makeShared' forwards any number of arguments (including rvalues
+        //:   of move-only types) to the constructor of 'TYPE'.
+        //:
+        //: 2 If 'TYPE' uses 'bslma::Allocator', the pool's allocator is
+        //:   passed to the constructor.
+        //:
+        //: 3 The object is destroyed when the last shared reference is
+        //:   released, but the representation is returned to the pool only
+        //:   when the last weak reference is also released.
+        //:
+        //: 4 A representation returned to the pool is reused without
+        //:   allocating from the pool's allocator or the default allocator.
+        //:
+        //: 5 The returned shared pointer interoperates with ordinary shared
+        //:   pointers (conversion to 'bsl::shared_ptr<const TYPE>', aliasing).
+        //
+        // Plan:
+        //: 1 Create objects with 0 to 3 arguments and with a move-only
+        //:   argument, and verify their values.  (C-1)
+        //:
+        //: 2 Create an allocator-aware object, and verify its allocator.
+        //:   (C-2)
+        //:
+        //: 3 Hold a weak pointer past the release of the last shared pointer,
+        //:   and verify the live count of objects and the identity of the
+        //:   block used by subsequent objects.  (C-3..4)
+        //:
+        //: 4 Install a test allocator as the default, and verify that it is
+        //:   never used.  (C-4)
+        //:
+        //: 5 Convert and alias the result.  (C-5)
+        //
+        // Testing:
+        //   bsl::shared_ptr<TYPE> makeShared(ARGS&&... arguments);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'makeShared'\n"
+                             "====================\n";
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        if (verbose) cout << "\nArgument forwarding." << endl;
+        {
+            bdlma::SharedPtrPool<my_Simple> mX(&ta);
+
+            bsl::shared_ptr<my_Simple> p0 = mX.makeShared();
+            bsl::shared_ptr<my_Simple> p1 = mX.makeShared(1);
+            bsl::shared_ptr<my_Simple> p2 = mX.makeShared(1, 2);
+            bsl::shared_ptr<my_Simple> p3 = mX.makeShared(1, 2, 3);
+
+            ASSERT(4 == my_Simple::s_numLive);
+
+            ASSERT(0 == p0->a() && 0 == p0->b() && 0 == p0->c());
+            ASSERT(1 == p1->a() && 0 == p1->b() && 0 == p1->c());
+            ASSERT(1 == p2->a() && 2 == p2->b() && 0 == p2->c());
+            ASSERT(1 == p3->a() && 2 == p3->b() && 3 == p3->c());
+
+            bdlma::SharedPtrPool<my_TakesMoveOnly> mY(&ta);
+
+            my_MoveOnly                       arg(7);
+            bsl::shared_ptr<my_TakesMoveOnly> q = mY.makeShared(
+                                        static_cast<my_MoveOnly&&>(arg));
+            ASSERT( 7 == q->value());
+            ASSERT(-1 == arg.value());
+        }
+        ASSERT(0 == my_Simple::s_numLive);
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nAllocator propagation." << endl;
+        {
+            bdlma::SharedPtrPool<my_AllocatorAware> mX(&ta);
+
+            bsl::shared_ptr<my_AllocatorAware> p =
+                      mX.makeShared("a string that is too long for the SSO");
+            ASSERT(&ta == p->allocator());
+            ASSERT("a string that is too long for the SSO" == p->text());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nRecycling and weak references." << endl;
+        {
+            bdlma::SharedPtrPool<my_Simple> mX(1, &ta);
+
+            bsl::shared_ptr<my_Simple> p = mX.makeShared(5);
+            const void *address = p.get();
+
+            bsl::weak_ptr<my_Simple> w(p);
+            p.reset();
+            ASSERT(0 == my_Simple::s_numLive);
+            ASSERT(w.expired());
+
+            // The block is still held by 'w'.
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            p = mX.makeShared(6);
+            ASSERT(address != p.get());
+
+            w.reset();
+
+            bsl::shared_ptr<my_Simple> q = mX.makeShared(7);
+            ASSERT(address == q.get());
+            ASSERT(7 == q->a());
+
+            for (int i = 0; i < 10; ++i) {
+                q.reset();
+                q = mX.makeShared(i);
+                ASSERT(address == q.get());
+            }
+            ASSERTV(numAllocations, ta.numAllocations(),
+                    numAllocations + 1 >= ta.numAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nInteroperation." << endl;
+        {
+            bdlma::SharedPtrPool<bsl::pair<int, int> > mX(&ta);
+
+            bsl::shared_ptr<bsl::pair<int, int> > p = mX.makeShared(1, 2);
+
+            bsl::shared_ptr<const bsl::pair<int, int> > c(p);
+            bsl::shared_ptr<int>                        s(p, &p->second);
+
+            p.reset();
+            ASSERT(2 == c.use_count());
+            ASSERT(2 == *s);
+            ASSERT(1 == c->first);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        ASSERT(0 == da.numAllocations());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a pool using the specified allocator, or
+        //:   the default allocator if none is specified.
+        //:
+        //: 2 'blockSize' is the size of the representation type.
+        //:
+        //: 3 The destructor releases all memory.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create pools with each constructor and verify the accessors.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   SharedPtrPool(bslma::Allocator *basicAllocator = 0);
+        //   SharedPtrPool(int numShards, bslma::Allocator *basicAllocator);
+        //   SharedPtrPool(int, Strategy, int, bslma::Allocator * = 0);
+        //   ~SharedPtrPool();
+        //   bslma::Allocator *allocator() const;
+        //   bsls::Types::size_type blockSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CREATORS AND ACCESSORS\n"
+                             "======================\n";
+
+        typedef bdlma::SharedPtrPool<my_Simple> Obj;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         ta("test", veryVerbose);
+
+        ASSERT(sizeof(Obj::Rep) > sizeof(my_Simple));
+
+        {
+            Obj mX;
+            ASSERT(&da               == mX.allocator());
+            ASSERT(sizeof(Obj::Rep)  <= mX.blockSize());
+        }
+        {
+            Obj mX(&ta);
+            ASSERT(&ta               == mX.allocator());
+            ASSERT(sizeof(Obj::Rep)  <= mX.blockSize());
+            mX.makeShared();
+        }
+        {
+            Obj mX(4, &ta);
+            ASSERT(&ta == mX.allocator());
+            mX.makeShared();
+        }
+        {
+            Obj mX(2, bsls::BlockGrowth::BSLS_CONSTANT, 8, &ta);
+            ASSERT(&ta == mX.allocator());
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+            bsl::vector<bsl::shared_ptr<my_Simple> > objects;
+            objects.reserve(8);
+            for (int i = 0; i < 8; ++i) {
+                objects.push_back(mX.makeShared());
+            }
+            ASSERT(numAllocations + 1 == ta.numAllocations());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsls::BlockGrowth::Strategy G =
+                                             bsls::BlockGrowth::BSLS_GEOMETRIC;
+
+            // The arguments are checked by 'bdlma::ShardedConcurrentPool'.
+
+            ASSERT_PASS_RAW(Obj(2, G, 1, &ta));
+            ASSERT_FAIL_RAW(Obj(3, G, 1, &ta));
+            ASSERT_FAIL_RAW(Obj(2, G, 0, &ta));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'SharedPtrPool_Allocator'
+        //
+        // Concerns:
+        //: 1 The allocator supplies blocks from, and returns them to, the pool
+        //:   it refers to.
+        //:
+        //: 2 Allocators rebound to other types, and copies, compare equal and
+        //:   use the same pool; allocators referring to different pools
+        //:   compare unequal.
+        //:
+        //: 3 'construct' passes the pool's allocator to allocator-aware types,
+        //:   and not to other types.
+        //
+        // Plan:
+        //: 1 Exercise each method directly on an allocator referring to a
+        //:   'SharedPtrPool_Imp'.  (C-1..3)
+        //
+        // Testing:
+        //   SharedPtrPool_Allocator(SharedPtrPool_Imp *imp);
+        //   SharedPtrPool_Allocator(const SharedPtrPool_Allocator<OTHER>&);
+        //   TYPE *allocate(size_type n);
+        //   void deallocate(TYPE *address, size_type n);
+        //   void construct(ELEMENT_TYPE *address, ARGS&&... arguments);
+        //   void destroy(ELEMENT_TYPE *address);
+        //   SharedPtrPool_Imp *imp() const;
+        //   bool operator==(const SPPA<T1>& lhs, const SPPA<T2>& rhs);
+        //   bool operator!=(const SPPA<T1>& lhs, const SPPA<T2>& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "'SharedPtrPool_Allocator'\n"
+                             "=========================\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            bdlma::SharedPtrPool_Imp imp1(64,
+                                          1,
+                                          bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                          4,
+                                          &ta);
+            bdlma::SharedPtrPool_Imp imp2(64,
+                                          1,
+                                          bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                          4,
+                                          &ta);
+
+            typedef bdlma::SharedPtrPool_Allocator<my_Simple>         AS;
+            typedef bdlma::SharedPtrPool_Allocator<my_AllocatorAware> AA;
+            typedef AS::rebind<my_AllocatorAware>::other              ASA;
+
+            ASSERT((bsl::is_same<AA, ASA>::value));
+
+            AS a1(&imp1);
+            AA a2(a1);
+            AS a3(&imp2);
+
+            ASSERT(&imp1 == a1.imp());
+            ASSERT(&imp1 == a2.imp());
+            ASSERT(a1 == a2);   ASSERT(!(a1 != a2));
+            ASSERT(a1 != a3);   ASSERT(!(a1 == a3));
+
+            my_Simple *s = a1.allocate(1);
+            a1.construct(s, 1, 2);
+            ASSERT(1 == s->a() && 2 == s->b());
+            ASSERT(1 == my_Simple::s_numLive);
+            a1.destroy(s);
+            ASSERT(0 == my_Simple::s_numLive);
+            a1.deallocate(s, 1);
+
+            ASSERT(static_cast<void *>(s) == a1.allocate(1));
+
+            my_AllocatorAware *w = a2.allocate(1);
+            a2.construct(w, "a string that is too long for the SSO");
+            ASSERT(&ta == w->allocator());
+            a2.destroy(w);
+            a2.deallocate(w, 1);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create and release a few shared objects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            bdlma::SharedPtrPool<my_Simple> mX(&ta);
+
+            bsl::shared_ptr<my_Simple> p = mX.makeShared(1, 2, 3);
+            ASSERT(p);
+            ASSERT(1 == p->a());
+            ASSERT(1 == p.use_count());
+
+            bsl::shared_ptr<my_Simple> q = p;
+            ASSERT(2 == p.use_count());
+
+            p.reset();
+            q.reset();
+            ASSERT(0 == my_Simple::s_numLive);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'makeShared' VS. 'bsl::allocate_shared'
+        //
+        // Concerns:
+        //: 1 Report the cost of creating shared pointers from the pool
+        //:   relative to 'bsl::allocate_shared' with a general-purpose
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, time the creation, fan-out to 4
+        //:   subscribers, and release of shared messages using each approach,
+        //:   and print the results.  The number of iterations may be given as
+        //:   the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: 'makeShared' VS. 'bsl::allocate_shared'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: 'makeShared' VS. "
+                             "'bsl::allocate_shared'\n"
+                             "=============================="
+                             "======================\n";
+
+        const int numIterations = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        cout << "threads   allocate_shared (s)   makeShared (s)\n";
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            bdlma::SharedPtrPool<benchmark::Message> pool;
+
+            benchmark::Args args;
+            args.d_pool_p        = &pool;
+            args.d_numIterations = numIterations;
+            args.d_fanOut        = 4;
+
+            const double general = benchmark::measure(
+                                                 benchmark::runAllocateShared,
+                                                 numThreads,
+                                                 &args);
+            const double pooled  = benchmark::measure(benchmark::runPool,
+                                                      numThreads,
+                                                      &args);
+
+            cout << numThreads << "\t  " << general << "\t\t" << pooled
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+#else
+    if (verbose) cout << "Requires variadic templates and rvalue references."
+                      << endl;
+    (void)argv;
+#endif
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,840 @@
+// bdlma_staticmultipoolallocator.h                                   -*-C++-*-
+#ifndef INCLUDED_BDLMA_STATICMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_STATICMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with compile-time size classes.
+//
+//@CLASSES:
+//  bdlma::StaticMultipoolAllocator: pooling allocator with fixed size classes
+//
+//@SEE_ALSO: bdlma_multipoolallocator, bdlma_pool, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides a managed allocator class template,
+// 'bdlma::StaticMultipoolAllocator', that implements the
+// 'bdlma::ManagedAllocator' protocol and maintains one pool for each of a
+// *fixed* set of block sizes (the "size classes") supplied as template
+// arguments.  Each allocation (deallocation) request allocates memory from
+// (returns memory to) the pool having the smallest size class not less than
+// the requested size, or else from a separately managed list of memory blocks,
+// if the requested size exceeds the largest size class.  Both the 'release'
+// method and the destructor of a 'bdlma::StaticMultipoolAllocator' release all
+// memory currently allocated via the object.
+//..
+//   ,-------------------------------.
+//  ( bdlma::StaticMultipoolAllocator )
+//   `-------------------------------'
+//                   |         ctor/dtor
+//                   |         findPool
+//                   |         maxPooledBlockSize
+//                   |         numPools
+//                   |         poolBlockSize
+//                   |         reserveCapacity
+//                   V
+//        ,-----------------------.
+//       ( bdlma::ManagedAllocator )
+//        `-----------------------'
+//                   |         release
+//                   V
+//           ,----------------.
+//          ( bslma::Allocator )
+//           `----------------'
+//                             allocate
+//                             deallocate
+//..
+// 'bdlma::MultipoolAllocator' selects among geometrically-sized pools whose
+// number is chosen at run time, so every request computes the pool index and
+// follows a pointer to a heap-allocated array of pools.  Many clients,
+// however, allocate objects of only a small, known set of sizes (e.g., the
+// node sizes of a few container types).  'bdlma::StaticMultipoolAllocator'
+// lets such clients name those sizes directly:
+//..
+//  bdlma::StaticMultipoolAllocator<bdlma::Pool, 24, 40, 64> allocator;
+//..
+// Because the size classes are template arguments, the mapping from a request
+// size to a pool is computed at compile time into a small table indexed by
+// the request size divided by 8, so that 'findPool' is a single (constexpr)
+// table lookup, the pools themselves are stored inline in the allocator
+// object, and no size class need be a power of two.
+//
+///Size Classes
+///------------
+// The size classes are specified as a non-empty, strictly increasing list of
+// positive sizes (in bytes), the largest of which may not exceed
+// 'k_MAX_SIZE_CLASS' (65536).  Each size class is rounded up to a multiple of
+// 8 bytes, so a size class that is not a multiple of 8 may dispense slightly
+// larger blocks than requested; a size class that rounds up to the same value
+// as its predecessor is never selected.  Each pooled block is preceded by a
+// maximally-aligned header that records the pool from which it came, which is
+// used to return the block to that pool when it is deallocated.  A block
+// returned through the *sized* 'deallocate(address, size, alignment)'
+// overload (as all blocks obtained by 'bsl::allocator' are), however, is
+// returned to the pool selected by 'findPool(size)' without reading its
+// header, since the 'size' supplied must be the size originally requested
+// (see {'bslma_allocator'|Sized Deallocation}).
+//
+///Thread Safety
+///-------------
+// The 'POOL' template parameter selects between a single-threaded and a
+// thread-safe allocator:
+//
+//: o 'bdlma::StaticMultipoolAllocator<bdlma::Pool, SIZES...>' is *not*
+//:   thread-safe; it is the faster choice when an allocator is used by only
+//:   one thread at a time.
+//:
+//: o 'bdlma::StaticMultipoolAllocator<bdlma::ConcurrentPool, SIZES...>' is
+//:   *thread-safe*: 'allocate' and 'deallocate' may be called concurrently
+//:   from any number of threads (the list of blocks larger than the largest
+//:   size class is protected by a mutex).  As with the other concurrent
+//:   allocators in this package, 'release' (and the destructor) must not be
+//:   called while another thread is using the allocator.
+//
+// No other types are supported for 'POOL'.  Note that this component requires
+// C++14 ('bslmf::IntegerSequence' is used to build the size-class table), and
+// is empty when compiled with an earlier standard.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying Memory to Node-Based Containers
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a subsystem keeps a 'bsl::map' from integer keys to integer
+// values, and a 'bsl::list' of integers, and that, having measured the sizes
+// of the nodes allocated by these containers on our platform, we want to
+// supply them from dedicated pools of exactly those sizes.
+//
+// First, we define the allocator type, naming the size classes we need.  On
+// our platform the nodes of a 'bsl::list<int>' occupy 24 bytes, and those of a
+// 'bsl::map<int, int>' occupy 40 bytes; a third, larger size class serves
+// small strings and hash-table bucket arrays:
+//..
+//  typedef bdlma::StaticMultipoolAllocator<bdlma::Pool, 24, 40, 128>
+//                                                            NodeAllocator;
+//..
+// Then, we observe that the pool used for a request of a given size is a
+// compile-time constant:
+//..
+//  static_assert(0 == NodeAllocator::findPool(24), "");
+//  static_assert(1 == NodeAllocator::findPool(40), "");
+//  static_assert(2 == NodeAllocator::findPool(41), "");
+//  static_assert(-1 == NodeAllocator::findPool(129), "");
+//..
+// Next, we create an allocator and supply it to our containers:
+//..
+//  NodeAllocator allocator;
+//
+//  bsl::list<int>     list(&allocator);
+//  bsl::map<int, int> map(&allocator);
+//
+//  for (int i = 0; i < 100; ++i) {
+//      list.push_back(i);
+//      map[i] = i * i;
+//  }
+//  assert(100 == list.size());
+//  assert(100 == map.size());
+//..
+// Then, we note that blocks returned by the containers are reused by
+// subsequent allocations of the same size class:
+//..
+//  list.clear();
+//  for (int i = 0; i < 100; ++i) {
+//      list.push_front(i);
+//  }
+//..
+// Finally, if the containers are no longer needed, and their elements need no
+// destruction, all memory can be reclaimed at once by calling 'release' --
+// but, since a 'bsl::list' and a 'bsl::map' will deallocate their nodes when
+// destroyed, we simply let the containers and then the allocator go out of
+// scope.
+//
+///Example 2: A Thread-Safe Allocator
+/// - - - - - - - - - - - - - - - - -
+// A thread-safe allocator having the same size classes is obtained by naming
+// 'bdlma::ConcurrentPool' as the 'POOL' type:
+//..
+//  typedef bdlma::StaticMultipoolAllocator<bdlma::ConcurrentPool,
+//                                          24,
+//                                          40,
+//                                          128> SharedNodeAllocator;
+//
+//  SharedNodeAllocator sharedAllocator;
+//
+//  void *p = sharedAllocator.allocate(40);
+//  sharedAllocator.deallocate(p);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_concurrentallocatoradapter.h>
+#include <bdlma_concurrentpool.h>
+#include <bdlma_managedallocator.h>
+#include <bdlma_pool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_autodestructor.h>
+#include <bslma_default.h>
+
+#include <bslmf_integersequence.h>
+#include <bslmf_makeintegersequence.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_keyword.h>
+#include <bsls_libraryfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP14_INTEGER_SEQUENCE
+
+namespace BloombergLP {
+namespace bdlma {
+
+            // ==============================================
+            // struct StaticMultipoolAllocator_NullMutex
+            // ==============================================
+
+struct StaticMultipoolAllocator_NullMutex {
+    // This component-private 'struct' provides a mutex type having no effect,
+    // used to protect the list of large blocks of a single-threaded
+    // 'StaticMultipoolAllocator'.
+
+    // MANIPULATORS
+    void lock()
+        // Do nothing.
+    {
+    }
+
+    void unlock()
+        // Do nothing.
+    {
+    }
+};
+
+                // =======================================
+                // struct StaticMultipoolAllocator_Mutex
+                // =======================================
+
+template <class POOL>
+struct StaticMultipoolAllocator_Mutex;
+    // This component-private 'struct' template provides, as 'Type', the mutex
+    // type with which a 'StaticMultipoolAllocator' using the (template
+    // parameter) 'POOL' protects its list of large blocks.
+
+template <>
+struct StaticMultipoolAllocator_Mutex<Pool> {
+    // TYPES
+    typedef StaticMultipoolAllocator_NullMutex Type;
+};
+
+template <>
+struct StaticMultipoolAllocator_Mutex<ConcurrentPool> {
+    // TYPES
+    typedef bslmt::Mutex Type;
+};
+
+              // ============================================
+              // class StaticMultipoolAllocator_PoolAllocator
+              // ============================================
+
+template <class POOL>
+class StaticMultipoolAllocator_PoolAllocator;
+    // This component-private class template provides, as 'allocator()', the
+    // allocator from which the pools of a 'StaticMultipoolAllocator' using
+    // the (template parameter) 'POOL' obtain memory.  Since each
+    // 'bdlma::ConcurrentPool' may replenish concurrently with the others, the
+    // allocator supplied at construction is, in that case, accessed through a
+    // 'bdlma::ConcurrentAllocatorAdapter'.
+
+template <>
+class StaticMultipoolAllocator_PoolAllocator<Pool> {
+    // DATA
+    bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    StaticMultipoolAllocator_PoolAllocator(
+                                const StaticMultipoolAllocator_PoolAllocator&);
+    StaticMultipoolAllocator_PoolAllocator& operator=(
+                                const StaticMultipoolAllocator_PoolAllocator&);
+
+  public:
+    // CREATORS
+    StaticMultipoolAllocator_PoolAllocator(
+                                StaticMultipoolAllocator_NullMutex *,
+                                bslma::Allocator                   *allocator)
+        // Create an object supplying the specified 'allocator' to the pools.
+        // The behavior is undefined unless 'allocator' is not 0.
+    : d_allocator_p(allocator)
+    {
+    }
+
+    // MANIPULATORS
+    bslma::Allocator *allocator()
+        // Return the allocator from which the pools obtain memory.
+    {
+        return d_allocator_p;
+    }
+};
+
+template <>
+class StaticMultipoolAllocator_PoolAllocator<ConcurrentPool> {
+    // DATA
+    ConcurrentAllocatorAdapter d_allocAdapter;  // thread-safe adapter
+
+  private:
+    // NOT IMPLEMENTED
+    StaticMultipoolAllocator_PoolAllocator(
+                                const StaticMultipoolAllocator_PoolAllocator&);
+    StaticMultipoolAllocator_PoolAllocator& operator=(
+                                const StaticMultipoolAllocator_PoolAllocator&);
+
+  public:
+    // CREATORS
+    StaticMultipoolAllocator_PoolAllocator(bslmt::Mutex     *mutex,
+                                           bslma::Allocator *allocator)
+        // Create an object supplying the specified 'allocator' to the pools,
+        // using the specified 'mutex' to synchronize access to 'allocator'.
+        // The behavior is undefined unless 'allocator' is not 0.
+    : d_allocAdapter(mutex, allocator)
+    {
+    }
+
+    // MANIPULATORS
+    bslma::Allocator *allocator()
+        // Return the allocator from which the pools obtain memory.
+    {
+        return &d_allocAdapter;
+    }
+};
+
+              // ============================================
+              // struct StaticMultipoolAllocator_SizeClasses
+              // ============================================
+
+template <bsls::Types::size_type... SIZES>
+struct StaticMultipoolAllocator_SizeClasses {
+    // This component-private 'struct' template computes, at compile time, the
+    // rounded size classes specified by the (template parameter) 'SIZES', and
+    // a table mapping each request size (divided by 'k_GRANULARITY') to the
+    // index of the smallest size class able to satisfy it.
+
+    // TYPES
+    typedef bsls::Types::size_type size_type;
+
+    // CONSTANTS
+    static constexpr size_type k_GRANULARITY = 8;
+        // granularity (in bytes) of the size classes
+
+    static constexpr int k_NUM_CLASSES = static_cast<int>(sizeof...(SIZES));
+        // number of size classes
+
+    static constexpr size_type k_SPECIFIED[] = { SIZES... };
+        // size classes, as specified
+
+    static constexpr size_type k_SIZES[] = {
+                  (SIZES + k_GRANULARITY - 1) / k_GRANULARITY * k_GRANULARITY
+                                                                      ... };
+        // size classes, rounded up to a multiple of 'k_GRANULARITY'
+
+    static constexpr size_type k_MAX_SIZE = k_SIZES[k_NUM_CLASSES - 1];
+        // largest size class
+
+    // CLASS METHODS
+    static constexpr bool isValid(int index = 0)
+        // Return 'true' if the specified size classes, from the optionally
+        // specified 'index' on, are positive and strictly increasing, and
+        // 'false' otherwise.
+    {
+        return index == k_NUM_CLASSES
+            || (0 < k_SPECIFIED[index]
+                && (0 == index || k_SPECIFIED[index - 1] < k_SPECIFIED[index])
+                && isValid(index + 1));
+    }
+
+    static constexpr int classOf(size_type size, int index = 0)
+        // Return the index of the smallest size class, from the optionally
+        // specified 'index' on, that is not less than the specified 'size'.
+        // The behavior is undefined unless 'size <= k_MAX_SIZE'.
+    {
+        return size <= k_SIZES[index] ? index : classOf(size, index + 1);
+    }
+
+    template <class SEQUENCE>
+    struct Table;
+
+    template <size_type... GRANULES>
+    struct Table<bslmf::IntegerSequence<size_type, GRANULES...> > {
+        // This 'struct' provides, as 'k_DATA', the index of the size class
+        // for a request of each size from 0 to 'k_MAX_SIZE', in steps of
+        // 'k_GRANULARITY' bytes.
+
+        static constexpr unsigned char k_DATA[] = {
+                    static_cast<unsigned char>(classOf(GRANULES
+                                                       * k_GRANULARITY))... };
+    };
+
+    typedef Table<bslmf::MakeIntegerSequence<size_type,
+                                             k_MAX_SIZE / k_GRANULARITY + 1> >
+                                                                  LookupTable;
+};
+
+                      // ==============================
+                      // class StaticMultipoolAllocator
+                      // ==============================
+
+template <class POOL, bsls::Types::size_type... SIZES>
+class StaticMultipoolAllocator : public ManagedAllocator {
+    // This class implements the 'bdlma::ManagedAllocator' protocol to provide
+    // an allocator that maintains one (template parameter) 'POOL' object for
+    // each of the (template parameter) 'SIZES', selecting the pool for each
+    // request by a compile-time table lookup.  Requests larger than the
+    // largest size class are satisfied by a separately managed list of memory
+    // blocks.  Both the 'release' method and the destructor release all
+    // memory currently allocated via the object.  'POOL' must be either
+    // 'bdlma::Pool' (for a single-threaded allocator) or
+    // 'bdlma::ConcurrentPool' (for a thread-safe allocator).
+
+    // PRIVATE TYPES
+    typedef StaticMultipoolAllocator_SizeClasses<SIZES...>   SizeClasses;
+
+    typedef typename StaticMultipoolAllocator_Mutex<POOL>::Type Mutex;
+
+    struct Header {
+        // This 'struct' provides header information for each allocated memory
+        // block.  The header stores the index to the pool used for the memory
+        // allocation.
+
+        union {
+            int                    d_poolIdx;  // index to pool used for this
+                                               // memory block, or -1 if from
+                                               // 'd_blockList'
+
+            bsls::AlignmentUtil::MaxAlignedType
+                                   d_dummy;    // force maximum alignment
+        } d_header;
+    };
+
+    enum {
+        k_DEFAULT_MAX_CHUNK_SIZE = 32  // default maximum number of blocks per
+                                       // chunk
+    };
+
+  public:
+    // PUBLIC CONSTANTS
+    static constexpr size_type k_MAX_SIZE_CLASS = 65536;
+        // largest size class that may be specified
+
+  private:
+    static_assert(0 < sizeof...(SIZES),
+                  "At least one size class must be specified");
+    static_assert(SizeClasses::isValid(),
+                  "Size classes must be positive and strictly increasing");
+    static_assert(SizeClasses::k_MAX_SIZE <= k_MAX_SIZE_CLASS,
+                  "Size classes may not exceed 'k_MAX_SIZE_CLASS'");
+
+    // DATA
+    bsls::ObjectBuffer<POOL>  d_pools[sizeof...(SIZES)];
+                                                // memory pools, one for each
+                                                // size class
+
+    BlockList                 d_blockList;      // memory manager for "large"
+                                                // memory blocks
+
+    Mutex                     d_mutex;          // protects 'd_blockList'
+                                                // and, if 'POOL' is
+                                                // 'ConcurrentPool', the
+                                                // allocator of the pools
+
+    StaticMultipoolAllocator_PoolAllocator<POOL>
+                              d_poolAllocator;  // allocator of the pools
+
+  private:
+    // NOT IMPLEMENTED
+    StaticMultipoolAllocator(const StaticMultipoolAllocator&);
+    StaticMultipoolAllocator& operator=(const StaticMultipoolAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void initialize(bsls::BlockGrowth::Strategy growthStrategy,
+                    int                         maxBlocksPerChunk);
+        // Initialize the pools of this allocator, using the specified
+        // 'growthStrategy' and 'maxBlocksPerChunk' for each of them.
+
+    POOL& pool(int index);
+        // Return a reference providing modifiable access to the pool at the
+        // specified 'index'.
+
+  protected:
+    // PROTECTED MANIPULATORS
+    void doDeallocate(void      *address,
+                      size_type  size,
+                      size_type  alignment) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' back to this
+        // allocator, using the specified 'size' (in bytes) of the block to
+        // select the pool to which it is returned, and ignoring the specified
+        // 'alignment'.  If 'address' is 0, this function has no effect.  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object with a request for 'size' bytes, and has not
+        // already been deallocated.
+
+  public:
+    // CLASS METHODS
+    static constexpr int findPool(size_type size);
+        // Return the index of the pool from which a request for the specified
+        // 'size' (in bytes) is satisfied, or -1 if 'size' exceeds the largest
+        // size class.  Note that 0 is returned if 'size' is 0.
+
+    static constexpr size_type maxPooledBlockSize();
+        // Return the largest size class (in bytes), rounded up to a multiple
+        // of 8.  Requests for larger blocks are not pooled.
+
+    static constexpr int numPools();
+        // Return the number of pools managed by this allocator, i.e., the
+        // number of size classes.
+
+    static constexpr size_type poolBlockSize(int index);
+        // Return the largest request size (in bytes) satisfied by the pool at
+        // the specified 'index', i.e., the size class at 'index' rounded up to
+        // a multiple of 8.  The behavior is undefined unless
+        // '0 <= index < numPools()'.
+
+    // CREATORS
+    explicit StaticMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit StaticMultipoolAllocator(
+                          bsls::BlockGrowth::Strategy  growthStrategy,
+                          bslma::Allocator            *basicAllocator = 0);
+    StaticMultipoolAllocator(bsls::BlockGrowth::Strategy  growthStrategy,
+                             int                          maxBlocksPerChunk,
+                             bslma::Allocator            *basicAllocator = 0);
+        // Create a multipool allocator having one pool for each of the size
+        // classes specified by 'SIZES'.  Optionally specify a
+        // 'growthStrategy' used to control the growth of internal memory
+        // chunks (from which memory blocks are dispensed).  If
+        // 'growthStrategy' is not specified, geometric growth is used.  If
+        // 'growthStrategy' is specified, optionally specify a
+        // 'maxBlocksPerChunk', indicating the maximum number of blocks to be
+        // allocated at once when a pool must be replenished.  If
+        // 'maxBlocksPerChunk' is not specified, an implementation-defined
+        // value is used.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= maxBlocksPerChunk'.
+
+    ~StaticMultipoolAllocator() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this allocator.  All memory allocated from this allocator is
+        // released.
+
+    // MANIPULATORS
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size > maxPooledBlockSize()', the memory allocation is managed
+        // directly by the underlying allocator, and is not pooled.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Relinquish the memory block at the specified 'address' back to this
+        // allocator for reuse.  If 'address' is 0, this method has no effect.
+        // The behavior is undefined unless 'address' was allocated by this
+        // allocator, and has not already been deallocated.
+
+    using ManagedAllocator::deallocate;
+        // Bring the sized 'deallocate(address, size, alignment)' overload of
+        // 'bslma::Allocator' into scope.
+
+    void release() BSLS_KEYWORD_OVERRIDE;
+        // Relinquish all memory currently allocated through this allocator.
+        // If 'POOL' is 'bdlma::ConcurrentPool', the behavior is undefined if
+        // any other thread is using this allocator.
+
+    void reserveCapacity(size_type size, int numBlocks);
+        // Reserve memory from this allocator to satisfy memory requests for at
+        // least the specified 'numBlocks' having the specified 'size' (in
+        // bytes) before the pool replenishes.  If 'size' is 0, this method has
+        // no effect.  The behavior is undefined unless
+        // 'size <= maxPooledBlockSize()' and '0 <= numBlocks'.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+              // --------------------------------------------
+              // struct StaticMultipoolAllocator_SizeClasses
+              // --------------------------------------------
+
+// CONSTANTS
+template <bsls::Types::size_type... SIZES>
+constexpr bsls::Types::size_type
+StaticMultipoolAllocator_SizeClasses<SIZES...>::k_GRANULARITY;
+
+template <bsls::Types::size_type... SIZES>
+constexpr int StaticMultipoolAllocator_SizeClasses<SIZES...>::k_NUM_CLASSES;
+
+template <bsls::Types::size_type... SIZES>
+constexpr bsls::Types::size_type
+StaticMultipoolAllocator_SizeClasses<SIZES...>::k_SPECIFIED[];
+
+template <bsls::Types::size_type... SIZES>
+constexpr bsls::Types::size_type
+StaticMultipoolAllocator_SizeClasses<SIZES...>::k_SIZES[];
+
+template <bsls::Types::size_type... SIZES>
+constexpr bsls::Types::size_type
+StaticMultipoolAllocator_SizeClasses<SIZES...>::k_MAX_SIZE;
+
+template <bsls::Types::size_type... SIZES>
+template <bsls::Types::size_type... GRANULES>
+constexpr unsigned char StaticMultipoolAllocator_SizeClasses<SIZES...>::Table<
+                  bslmf::IntegerSequence<bsls::Types::size_type, GRANULES...> >
+                                                                   ::k_DATA[];
+
+                      // ------------------------------
+                      // class StaticMultipoolAllocator
+                      // ------------------------------
+
+// PUBLIC CONSTANTS
+template <class POOL, bsls::Types::size_type... SIZES>
+constexpr bsls::Types::size_type
+StaticMultipoolAllocator<POOL, SIZES...>::k_MAX_SIZE_CLASS;
+
+// PRIVATE MANIPULATORS
+template <class POOL, bsls::Types::size_type... SIZES>
+void StaticMultipoolAllocator<POOL, SIZES...>::initialize(
+                                bsls::BlockGrowth::Strategy growthStrategy,
+                                int                         maxBlocksPerChunk)
+{
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    bslma::AutoDestructor<POOL> autoDtor(&d_pools[0].object(), 0);
+
+    for (int i = 0; i < numPools(); ++i, ++autoDtor) {
+        new (d_pools[i].buffer()) POOL(poolBlockSize(i) + sizeof(Header),
+                                       growthStrategy,
+                                       maxBlocksPerChunk,
+                                       d_poolAllocator.allocator());
+    }
+
+    autoDtor.release();
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+inline
+POOL& StaticMultipoolAllocator<POOL, SIZES...>::pool(int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numPools());
+
+    return d_pools[index].object();
+}
+
+// PROTECTED MANIPULATORS
+template <class POOL, bsls::Types::size_type... SIZES>
+void StaticMultipoolAllocator<POOL, SIZES...>::doDeallocate(
+                                                 void      *address,
+                                                 size_type  size,
+                                                 size_type  alignment)
+{
+    (void)alignment;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    const int index = findPool(size);
+
+    BSLS_ASSERT_SAFE(index == h->d_header.d_poolIdx);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 <= index)) {
+        pool(index).deallocate(h);
+    }
+    else {
+        bslmt::LockGuard<Mutex> guard(&d_mutex);
+        d_blockList.deallocate(h);
+    }
+}
+
+// CLASS METHODS
+template <class POOL, bsls::Types::size_type... SIZES>
+inline
+constexpr int StaticMultipoolAllocator<POOL, SIZES...>::findPool(
+                                                                size_type size)
+{
+    return size <= SizeClasses::k_MAX_SIZE
+         ? SizeClasses::LookupTable::k_DATA[(size
+                                             + SizeClasses::k_GRANULARITY - 1)
+                                            / SizeClasses::k_GRANULARITY]
+         : -1;
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+inline
+constexpr bsls::Types::size_type
+StaticMultipoolAllocator<POOL, SIZES...>::maxPooledBlockSize()
+{
+    return SizeClasses::k_MAX_SIZE;
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+inline
+constexpr int StaticMultipoolAllocator<POOL, SIZES...>::numPools()
+{
+    return SizeClasses::k_NUM_CLASSES;
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+inline
+constexpr bsls::Types::size_type
+StaticMultipoolAllocator<POOL, SIZES...>::poolBlockSize(int index)
+{
+    return SizeClasses::k_SIZES[index];
+}
+
+// CREATORS
+template <class POOL, bsls::Types::size_type... SIZES>
+StaticMultipoolAllocator<POOL, SIZES...>::StaticMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_blockList(basicAllocator)
+, d_poolAllocator(&d_mutex, bslma::Default::allocator(basicAllocator))
+{
+    initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+StaticMultipoolAllocator<POOL, SIZES...>::StaticMultipoolAllocator(
+                                  bsls::BlockGrowth::Strategy  growthStrategy,
+                                  bslma::Allocator            *basicAllocator)
+: d_blockList(basicAllocator)
+, d_poolAllocator(&d_mutex, bslma::Default::allocator(basicAllocator))
+{
+    initialize(growthStrategy, k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+StaticMultipoolAllocator<POOL, SIZES...>::StaticMultipoolAllocator(
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               int                          maxBlocksPerChunk,
+                               bslma::Allocator            *basicAllocator)
+: d_blockList(basicAllocator)
+, d_poolAllocator(&d_mutex, bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    initialize(growthStrategy, maxBlocksPerChunk);
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+StaticMultipoolAllocator<POOL, SIZES...>::~StaticMultipoolAllocator()
+{
+    d_blockList.release();
+    for (int i = 0; i < numPools(); ++i) {
+        pool(i).~POOL();
+    }
+}
+
+// MANIPULATORS
+template <class POOL, bsls::Types::size_type... SIZES>
+inline
+void *StaticMultipoolAllocator<POOL, SIZES...>::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size)) {
+        const int index = findPool(size);
+
+        Header *p;
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 <= index)) {
+            p = static_cast<Header *>(pool(index).allocate());
+        }
+        else {
+            bslmt::LockGuard<Mutex> guard(&d_mutex);
+            p = static_cast<Header *>(
+                                d_blockList.allocate(size + sizeof(Header)));
+        }
+
+        p->d_header.d_poolIdx = index;
+
+        return p + 1;                                                 // RETURN
+    }
+
+    return 0;
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+inline
+void StaticMultipoolAllocator<POOL, SIZES...>::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    const int index = h->d_header.d_poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 <= index)) {
+        pool(index).deallocate(h);
+    }
+    else {
+        bslmt::LockGuard<Mutex> guard(&d_mutex);
+        d_blockList.deallocate(h);
+    }
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+void StaticMultipoolAllocator<POOL, SIZES...>::release()
+{
+    for (int i = 0; i < numPools(); ++i) {
+        pool(i).release();
+    }
+
+    bslmt::LockGuard<Mutex> guard(&d_mutex);
+    d_blockList.release();
+}
+
+template <class POOL, bsls::Types::size_type... SIZES>
+inline
+void StaticMultipoolAllocator<POOL, SIZES...>::reserveCapacity(
+                                                        size_type size,
+                                                        int       numBlocks)
+{
+    BSLS_ASSERT(size <= maxPooledBlockSize());
+    BSLS_ASSERT(0    <= numBlocks);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size)) {
+        pool(findPool(size)).reserveCapacity(numBlocks);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BSLS_LIBRARYFEATURES_HAS_CPP14_INTEGER_SEQUENCE
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,870 @@
+// bdlma_staticmultipoolallocator.t.cpp                               -*-C++-*-
+#include <bdlma_staticmultipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslmt_threadutil.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_libraryfeatures.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::StaticMultipoolAllocator' is a managed allocator class template
+// whose size classes are template arguments.  The primary concerns are that
+// the compile-time mapping from request size to pool is correct (including
+// for size classes that are not multiples of 8), that requests are satisfied
+// by the pool for the correct size class (or, for large requests, by the
+// underlying allocator), that blocks are returned to the correct pool through
+// both the unsized and the sized 'deallocate' methods, that 'release' returns
+// all memory, and that the 'bdlma::ConcurrentPool' instantiation may be used
+// concurrently.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static constexpr int findPool(size_type size);
+// [ 2] static constexpr size_type maxPooledBlockSize();
+// [ 2] static constexpr int numPools();
+// [ 2] static constexpr size_type poolBlockSize(int index);
+//
+// CREATORS
+// [ 3] StaticMultipoolAllocator(Allocator *ba = 0);
+// [ 3] StaticMultipoolAllocator(Strategy gs, Allocator *ba = 0);
+// [ 3] StaticMultipoolAllocator(Strategy gs, int mbpc, Allocator *ba = 0);
+// [ 3] ~StaticMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void deallocate(void *address, size_type size, size_type alignment);
+// [ 5] void release();
+// [ 5] void reserveCapacity(size_type size, int numBlocks);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCURRENCY
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP14_INTEGER_SEQUENCE
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::size_type size_type;
+
+typedef bdlma::StaticMultipoolAllocator<bdlma::Pool, 8, 20, 64, 100>  Obj;
+typedef bdlma::StaticMultipoolAllocator<bdlma::ConcurrentPool, 16, 48, 256>
+                                                                      CObj;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+// ============================================================================
+//                  HELPER FUNCTIONS AND TYPES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int expectedPool(size_type size, const size_type *sizes, int numSizes)
+    // Return the index of the first of the specified 'numSizes' elements of
+    // the specified 'sizes', each rounded up to a multiple of 8, that is not
+    // less than the specified 'size', or -1 if there is no such element.
+{
+    for (int i = 0; i < numSizes; ++i) {
+        if (size <= (sizes[i] + 7) / 8 * 8) {
+            return i;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+struct ThreadArgs {
+    // Arguments for 'churnThread'.
+
+    CObj *d_obj_p;
+    int   d_index;
+};
+
+extern "C" void *churnThread(void *arg)
+    // Repeatedly allocate, fill, verify, and deallocate blocks of assorted
+    // sizes from the allocator supplied by the 'ThreadArgs' object at the
+    // specified 'arg'.
+{
+    ThreadArgs& args = *static_cast<ThreadArgs *>(arg);
+
+    enum { k_NUM_BLOCKS = 64 };
+
+    void      *blocks[k_NUM_BLOCKS];
+    size_type  sizes[k_NUM_BLOCKS];
+
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            sizes[i]  = 1 + (i * 37 + iteration) % 300;
+            blocks[i] = args.d_obj_p->allocate(sizes[i]);
+            bsl::memset(blocks[i], args.d_index, sizes[i]);
+        }
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            const unsigned char *p = static_cast<unsigned char *>(blocks[i]);
+            ASSERTV(args.d_index, i, args.d_index == p[sizes[i] - 1]);
+            if (i % 2) {
+                args.d_obj_p->deallocate(blocks[i]);
+            }
+            else {
+                static_cast<bslma::Allocator *>(args.d_obj_p)->deallocate(
+                                                                   blocks[i],
+                                                                   sizes[i],
+                                                                   1);
+            }
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying Memory to Node-Based Containers
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a subsystem keeps a 'bsl::map' from integer keys to integer
+// values, and a 'bsl::list' of integers, and that, having measured the sizes
+// of the nodes allocated by these containers on our platform, we want to
+// supply them from dedicated pools of exactly those sizes.
+//
+// First, we define the allocator type, naming the size classes we need.  On
+// our platform the nodes of a 'bsl::list<int>' occupy 24 bytes, and those of a
+// 'bsl::map<int, int>' occupy 40 bytes; a third, larger size class serves
+// small strings and hash-table bucket arrays:
+//..
+    typedef bdlma::StaticMultipoolAllocator<bdlma::Pool, 24, 40, 128>
+                                                              NodeAllocator;
+//..
+// Then, we observe that the pool used for a request of a given size is a
+// compile-time constant:
+//..
+    static_assert(0 == NodeAllocator::findPool(24), "");
+    static_assert(1 == NodeAllocator::findPool(40), "");
+    static_assert(2 == NodeAllocator::findPool(41), "");
+    static_assert(-1 == NodeAllocator::findPool(129), "");
+//..
+
+#endif  // BSLS_LIBRARYFEATURES_HAS_CPP14_INTEGER_SEQUENCE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    (void)verbose;
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP14_INTEGER_SEQUENCE
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+// Next, we create an allocator and supply it to our containers:
+//..
+    NodeAllocator allocator;
+
+    bsl::list<int>     list(&allocator);
+    bsl::map<int, int> map(&allocator);
+
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+        map[i] = i * i;
+    }
+    ASSERT(100 == list.size());
+    ASSERT(100 == map.size());
+//..
+// Then, we note that blocks returned by the containers are reused by
+// subsequent allocations of the same size class:
+//..
+    list.clear();
+    for (int i = 0; i < 100; ++i) {
+        list.push_front(i);
+    }
+//..
+// Finally, if the containers are no longer needed, and their elements need no
+// destruction, all memory can be reclaimed at once by calling 'release' --
+// but, since a 'bsl::list' and a 'bsl::map' will deallocate their nodes when
+// destroyed, we simply let the containers and then the allocator go out of
+// scope.
+//
+///Example 2: A Thread-Safe Allocator
+/// - - - - - - - - - - - - - - - - -
+// A thread-safe allocator having the same size classes is obtained by naming
+// 'bdlma::ConcurrentPool' as the 'POOL' type:
+//..
+    typedef bdlma::StaticMultipoolAllocator<bdlma::ConcurrentPool,
+                                            24,
+                                            40,
+                                            128> SharedNodeAllocator;
+
+    SharedNodeAllocator sharedAllocator;
+
+    void *p = sharedAllocator.allocate(40);
+    sharedAllocator.deallocate(p);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 The 'bdlma::ConcurrentPool' instantiation may be used to allocate
+        //:   and deallocate, through both 'deallocate' overloads, from many
+        //:   threads at once, for pooled and unpooled sizes alike.
+        //:
+        //: 2 All memory is returned when the allocator is destroyed.
+        //
+        // Plan:
+        //: 1 Start several threads that each repeatedly allocate blocks of
+        //:   assorted sizes (some exceeding the largest size class), fill
+        //:   them with a thread-specific value, verify the value, and free
+        //:   them alternately through the unsized and sized 'deallocate'.
+        //:   (C-1)
+        //:
+        //: 2 Verify that the test allocator has no outstanding memory after
+        //:   the allocator is destroyed.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENCY\n"
+                             "===========\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            CObj mX(&ta);
+
+            enum { k_NUM_THREADS = 6 };
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            ThreadArgs                args[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_obj_p = &mX;
+                args[i].d_index = i + 1;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      churnThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'release' AND 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 'release' returns all memory, pooled and unpooled, to the
+        //:   underlying allocator, and the allocator is usable afterwards.
+        //:
+        //: 2 'reserveCapacity' obtains memory for the pool of the size class
+        //:   of the specified size, after which that many requests of the
+        //:   size are satisfied without further allocation.
+        //:
+        //: 3 'reserveCapacity' for a size of 0 has no effect.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks of pooled and unpooled sizes, call 'release',
+        //:   and verify that the test allocator has no memory in use; then
+        //:   allocate again.  (C-1)
+        //:
+        //: 2 Call 'reserveCapacity' and verify that subsequent requests do not
+        //:   allocate from the test allocator.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void release();
+        //   void reserveCapacity(size_type size, int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'release' AND 'reserveCapacity'\n"
+                             "=======================================\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj mX(&ta);
+
+            for (int i = 0; i < 50; ++i) {
+                mX.allocate(1 + i * 3);
+            }
+            mX.allocate(1000);
+            mX.allocate(5000);
+            ASSERT(0 < ta.numBlocksInUse());
+
+            mX.release();
+            ASSERT(0 == ta.numBlocksInUse());
+
+            void *p = mX.allocate(20);
+            ASSERT(p);
+            mX.deallocate(p);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(bsls::BlockGrowth::BSLS_CONSTANT, 1, &ta);
+
+            mX.reserveCapacity(0, 100);
+            ASSERT(0 == ta.numBlocksInUse());
+
+            mX.reserveCapacity(50, 10);
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            for (int i = 0; i < 10; ++i) {
+                mX.allocate(64);
+            }
+            ASSERT(numAllocations == ta.numAllocations());
+
+            mX.allocate(33);
+            ASSERT(numAllocations + 1 == ta.numAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            ASSERT_PASS(mX.reserveCapacity(Obj::maxPooledBlockSize(), 1));
+            ASSERT_FAIL(mX.reserveCapacity(Obj::maxPooledBlockSize() + 1, 1));
+            ASSERT_PASS(mX.reserveCapacity(8, 0));
+            ASSERT_FAIL(mX.reserveCapacity(8, -1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING SIZED 'deallocate'
+        //
+        // Concerns:
+        //: 1 A block returned through the sized 'deallocate' overload is
+        //:   returned to the pool of its size class, and is reused by the next
+        //:   request of that size class.
+        //:
+        //: 2 Unpooled blocks may be returned through the sized overload.
+        //:
+        //: 3 Returning a null address through the sized overload has no
+        //:   effect.
+        //:
+        //: 4 Blocks allocated through 'bsl::allocator' (which deallocates
+        //:   through the sized overload) are correctly returned.
+        //:
+        //: 5 A block returned with a size other than the size requested for
+        //:   it, or with an alignment that is not a power of two, is detected
+        //:   in appropriate build modes.
+        //
+        // Plan:
+        //: 1 For each of a set of sizes, allocate a block, return it through
+        //:   the sized overload, and verify that the next allocation of a size
+        //:   in the same class returns the same address.  (C-1)
+        //:
+        //: 2 Allocate and return an unpooled block through the sized overload
+        //:   and verify that its memory is returned to the test allocator.
+        //:   (C-2)
+        //:
+        //: 3 Call the sized overload with a null address.  (C-3)
+        //:
+        //: 4 Twice, grow a 'bsl::vector' supplied by the allocator through
+        //:   each of the size classes and beyond, then destroy it, and verify
+        //:   that the second time leaves no additional memory in use.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a size selecting another size class (or an
+        //:   unpooled size) and for an invalid alignment (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   void deallocate(void *address, size_type size, size_type align);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING SIZED 'deallocate'\n"
+                             "==========================\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj               mX(&ta);
+            bslma::Allocator& base = mX;
+
+            static const size_type SIZES[] = { 1, 8, 9, 20, 24, 33, 64, 65,
+                                               100, 104 };
+
+            for (int ti = 0; ti < 10; ++ti) {
+                const size_type SIZE = SIZES[ti];
+
+                void *p = mX.allocate(SIZE);
+                base.deallocate(p, SIZE, 1);
+
+                void *q = mX.allocate(Obj::poolBlockSize(
+                                                       Obj::findPool(SIZE)));
+                ASSERTV(SIZE, p == q);
+
+                base.deallocate(q,
+                                Obj::poolBlockSize(Obj::findPool(SIZE)),
+                                k_MAX_ALIGN);
+            }
+
+            bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+            void *p = mX.allocate(1000);
+            ASSERT(numBlocks + 1 == ta.numBlocksInUse());
+
+            base.deallocate(p, 1000, k_MAX_ALIGN);
+            ASSERT(numBlocks == ta.numBlocksInUse());
+
+            base.deallocate(0, 8, 1);
+            ASSERT(numBlocks == ta.numBlocksInUse());
+
+            for (int ti = 0; ti < 2; ++ti) {
+                {
+                    bsl::vector<int> v(&mX);
+                    for (int i = 0; i < 1000; ++i) {
+                        v.push_back(i);
+                    }
+                }
+
+                // The first iteration may replenish the pools; the second
+                // must be satisfied entirely by blocks returned in the first.
+
+                if (ti) {
+                    ASSERT(numBlocks == ta.numBlocksInUse());
+                }
+                numBlocks = ta.numBlocksInUse();
+            }
+
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj               mX(&ta);
+            bslma::Allocator& base = mX;
+
+            void *p = mX.allocate(20);
+
+            ASSERT_SAFE_FAIL(base.deallocate(p, 64, 1));
+            ASSERT_SAFE_FAIL(base.deallocate(p, 1000, 1));
+            ASSERT_SAFE_FAIL_RAW(base.deallocate(p, 20, 0));
+            ASSERT_SAFE_FAIL_RAW(base.deallocate(p, 20, 3));
+            ASSERT_SAFE_PASS(base.deallocate(p, 20, 4));
+
+            p = mX.allocate(1000);
+
+            ASSERT_SAFE_FAIL(base.deallocate(p, 64, 1));
+            ASSERT_SAFE_PASS(base.deallocate(p, 1000, 1));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CTORS, 'allocate', AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 Each constructor creates an allocator that obtains its memory
+        //:   from the supplied allocator, or from the default allocator if
+        //:   none is supplied.
+        //:
+        //: 2 'allocate' returns maximally aligned, writable blocks of at least
+        //:   the requested size, or 0 if the requested size is 0.
+        //:
+        //: 3 Blocks of pooled sizes are obtained from, and returned to, the
+        //:   pool of their size class; blocks of unpooled sizes are obtained
+        //:   from, and returned to, the underlying allocator.
+        //:
+        //: 4 Deallocating a null address has no effect.
+        //:
+        //: 5 The destructor returns all memory to the underlying allocator.
+        //
+        // Plan:
+        //: 1 Create allocators with each constructor, with and without a test
+        //:   allocator, and verify the source of memory.  (C-1, 5)
+        //:
+        //: 2 For every size from 0 to somewhat beyond the largest size class,
+        //:   allocate a block, verify its alignment, and write to all of it.
+        //:   (C-2)
+        //:
+        //: 3 Deallocate a block of each size, and verify that the next block
+        //:   of the same size class has the same address; verify that
+        //:   deallocating an unpooled block returns memory to the underlying
+        //:   allocator.  (C-3)
+        //:
+        //: 4 Deallocate a null address.  (C-4)
+        //
+        // Testing:
+        //   StaticMultipoolAllocator(Allocator *ba = 0);
+        //   StaticMultipoolAllocator(Strategy gs, Allocator *ba = 0);
+        //   StaticMultipoolAllocator(Strategy, int mbpc, Allocator *ba = 0);
+        //   ~StaticMultipoolAllocator();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CTORS, 'allocate', AND 'deallocate'\n"
+                             "===================================\n";
+
+        if (verbose) cout << "\nSource of memory." << endl;
+        {
+            bslma::TestAllocator         da("default", veryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+            bslma::TestAllocator         ta("test", veryVerbose);
+
+            for (char cfg = 'a'; cfg <= 'f'; ++cfg) {
+                Obj *objPtr = 0;
+
+                bslma::TestAllocator&  sa = cfg <= 'c' ? da : ta;
+                bslma::Allocator      *ba = cfg <= 'c' ? 0 : &ta;
+
+                switch (cfg) {
+                  case 'a':
+                  case 'd': {
+                    objPtr = new Obj(ba);
+                  } break;
+                  case 'b':
+                  case 'e': {
+                    objPtr = new Obj(bsls::BlockGrowth::BSLS_CONSTANT, ba);
+                  } break;
+                  case 'c':
+                  case 'f': {
+                    objPtr = new Obj(bsls::BlockGrowth::BSLS_GEOMETRIC, 4, ba);
+                  } break;
+                }
+
+                const bsls::Types::Int64 numBlocks = sa.numBlocksInUse();
+
+                void *p = objPtr->allocate(20);
+                void *q = objPtr->allocate(500);
+                ASSERTV(cfg, p && q);
+                ASSERTV(cfg, numBlocks + 2 == sa.numBlocksInUse());
+
+                delete objPtr;
+                ASSERTV(cfg, 0 == da.numBlocksInUse());
+                ASSERTV(cfg, 0 == ta.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nAlignment and extent." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVerbose);
+            {
+                Obj mX(&ta);
+
+                ASSERT(0 == mX.allocate(0));
+
+                for (size_type size = 1; size <= 300; ++size) {
+                    void *p = mX.allocate(size);
+                    ASSERTV(size, p);
+                    ASSERTV(size,
+                            0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                               % k_MAX_ALIGN);
+                    bsl::memset(p, 0xa5, size);
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nReuse of pooled blocks." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVerbose);
+            {
+                Obj mX(&ta);
+
+                for (size_type size = 1; size <= Obj::maxPooledBlockSize();
+                                                                      ++size) {
+                    void *p = mX.allocate(size);
+                    mX.deallocate(p);
+
+                    void *q = mX.allocate(Obj::poolBlockSize(
+                                                       Obj::findPool(size)));
+                    ASSERTV(size, p == q);
+                    mX.deallocate(q);
+                }
+
+                const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+                void *p = mX.allocate(Obj::maxPooledBlockSize() + 1);
+                ASSERT(numBlocks + 1 == ta.numBlocksInUse());
+
+                mX.deallocate(p);
+                ASSERT(numBlocks == ta.numBlocksInUse());
+
+                mX.deallocate(0);
+                ASSERT(numBlocks == ta.numBlocksInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS
+        //
+        // Concerns:
+        //: 1 'numPools' returns the number of size classes.
+        //:
+        //: 2 'poolBlockSize' returns each size class, rounded up to a multiple
+        //:   of 8, and 'maxPooledBlockSize' returns the largest of them.
+        //:
+        //: 3 'findPool' returns the index of the smallest size class not less
+        //:   than the specified size, 0 for a size of 0, and -1 for a size
+        //:   exceeding the largest size class.
+        //:
+        //: 4 All of the class methods may be evaluated at compile time.
+        //
+        // Plan:
+        //: 1 For several instantiations, including ones having size classes
+        //:   that are not multiples of 8 and ones whose rounded size classes
+        //:   coincide, compare the results of 'findPool' for every size up to
+        //:   somewhat beyond the largest size class with those of a
+        //:   brute-force search.  (C-1..3)
+        //:
+        //: 2 Use the class methods in 'static_assert' declarations.  (C-4)
+        //
+        // Testing:
+        //   static constexpr int findPool(size_type size);
+        //   static constexpr size_type maxPooledBlockSize();
+        //   static constexpr int numPools();
+        //   static constexpr size_type poolBlockSize(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CLASS METHODS\n"
+                             "=============\n";
+
+        static_assert(4   == Obj::numPools(),            "");
+        static_assert(104 == Obj::maxPooledBlockSize(),  "");
+        static_assert(24  == Obj::poolBlockSize(1),      "");
+        static_assert(0   == Obj::findPool(0),           "");
+        static_assert(1   == Obj::findPool(9),           "");
+        static_assert(3   == Obj::findPool(101),         "");
+        static_assert(-1  == Obj::findPool(105),         "");
+
+        {
+            static const size_type SIZES[] = { 8, 20, 64, 100 };
+
+            ASSERT(4 == Obj::numPools());
+            for (int i = 0; i < Obj::numPools(); ++i) {
+                ASSERTV(i, (SIZES[i] + 7) / 8 * 8 == Obj::poolBlockSize(i));
+            }
+            for (size_type size = 0; size <= 200; ++size) {
+                const int EXP = expectedPool(size, SIZES, 4);
+                ASSERTV(size, EXP, Obj::findPool(size),
+                        (size ? EXP : 0) == Obj::findPool(size));
+            }
+        }
+        {
+            typedef bdlma::StaticMultipoolAllocator<bdlma::Pool, 1> Single;
+
+            static const size_type SIZES[] = { 1 };
+
+            ASSERT(1 == Single::numPools());
+            ASSERT(8 == Single::maxPooledBlockSize());
+            for (size_type size = 0; size <= 20; ++size) {
+                const int EXP = expectedPool(size, SIZES, 1);
+                ASSERTV(size, (size ? EXP : 0) == Single::findPool(size));
+            }
+        }
+        {
+            typedef bdlma::StaticMultipoolAllocator<bdlma::ConcurrentPool,
+                                                    3,
+                                                    5,
+                                                    17,
+                                                    4096> Mixed;
+
+            static const size_type SIZES[] = { 3, 5, 17, 4096 };
+
+            ASSERT(4    == Mixed::numPools());
+            ASSERT(4096 == Mixed::maxPooledBlockSize());
+            ASSERT(8    == Mixed::poolBlockSize(0));
+            ASSERT(8    == Mixed::poolBlockSize(1));
+            ASSERT(24   == Mixed::poolBlockSize(2));
+            for (size_type size = 0; size <= 5000; ++size) {
+                const int EXP = expectedPool(size, SIZES, 4);
+                ASSERTV(size, (size ? EXP : 0) == Mixed::findPool(size));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of pooled and unpooled sizes from
+        //:   both instantiations.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *p1 = mX.allocate(5);
+            void *p2 = mX.allocate(50);
+            void *p3 = mX.allocate(100000);
+            ASSERT(p1);  ASSERT(p2);  ASSERT(p3);
+            ASSERT(p1 != p2);
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(p3);
+
+            ASSERT(p1 == mX.allocate(5));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            CObj mX(&ta);
+
+            void *p1 = mX.allocate(16);
+            void *p2 = mX.allocate(256);
+            void *p3 = mX.allocate(257);
+            ASSERT(p1);  ASSERT(p2);  ASSERT(p3);
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(p3);
+
+            ASSERT(p2 == mX.allocate(200));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+#endif  // BSLS_LIBRARYFEATURES_HAS_CPP14_INTEGER_SEQUENCE
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,488 @@
+// bdlma_threadcachingmultipoolallocator.cpp                          -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_concurrentpool.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+
+#include <new>           // placement 'new'
+
+namespace BloombergLP {
+
+enum {
+    k_DEFAULT_NUM_POOLS         = 10,
+    k_DEFAULT_MAX_CACHED_BLOCKS = 64,
+    k_MAX_CHUNK_SIZE            = 32,
+    k_MIN_BLOCK_SIZE            = 8
+};
+
+namespace bdlma {
+
+namespace {
+
+struct FreeBlock {
+    // This 'struct' overlays the header of a free memory block held in a
+    // thread cache, linking it to the next free block of the same size.
+
+    FreeBlock *d_next_p;  // next free block, or 0
+};
+
+struct Magazine {
+    // This 'struct' holds the free blocks of one size cached by one thread.
+
+    FreeBlock *d_head_p;     // first free block, or 0
+    int        d_numBlocks;  // number of blocks in the list at 'd_head_p'
+};
+
+}  // close unnamed namespace
+
+                // --------------------------------------------------
+                // struct ThreadCachingMultipoolAllocator::ThreadCache
+                // --------------------------------------------------
+
+struct ThreadCachingMultipoolAllocator::ThreadCache {
+    // This 'struct' describes the cache of free blocks owned by one thread.
+    // The magazines (one per pool) are stored immediately following the
+    // 'struct' itself, in the same memory block.
+
+    ThreadCachingMultipoolAllocator *d_owner_p;  // allocator owning this cache
+    ThreadCache                     *d_next_p;   // next cache in owner's list
+    ThreadCache                     *d_prev_p;   // previous cache in owner's
+                                                 // list
+
+    Magazine *magazines()
+        // Return the address of the array of magazines of this cache.
+    {
+        return reinterpret_cast<Magazine *>(this + 1);
+    }
+};
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachingMultipoolAllocator::removeThreadCache(void *cache)
+{
+    ThreadCache *threadCache = static_cast<ThreadCache *>(cache);
+
+    threadCache->d_owner_p->destroyThreadCache(threadCache, true);
+}
+
+// PRIVATE MANIPULATORS
+void ThreadCachingMultipoolAllocator::initialize(int numPools)
+{
+    BSLS_ASSERT(1 <= numPools);
+    BSLS_ASSERT(0 <= d_maxCachedBlocks);
+
+    d_numPools     = numPools;
+    d_maxBlockSize = k_MIN_BLOCK_SIZE;
+
+    d_pools_p = static_cast<ConcurrentPool *>(
+                      d_allocAdapter.allocate(d_numPools * sizeof *d_pools_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                              d_pools_p,
+                                                              &d_allocAdapter);
+    bslma::AutoDestructor<ConcurrentPool> autoDtor(d_pools_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDtor) {
+        new (d_pools_p + i) ConcurrentPool(
+                             d_maxBlockSize + static_cast<int>(sizeof(Header)),
+                             bsls::BlockGrowth::BSLS_GEOMETRIC,
+                             k_MAX_CHUNK_SIZE,
+                             &d_allocAdapter);
+
+        BSLS_ASSERT(d_maxBlockSize <=
+                       bsl::numeric_limits<bsls::Types::size_type>::max() / 2);
+
+        d_maxBlockSize *= 2;
+    }
+
+    d_maxBlockSize /= 2;
+
+    if (0 < d_maxCachedBlocks) {
+        const int rc = bslmt::ThreadUtil::createKey(
+                                     &d_cacheKey,
+                                     (bslmt::ThreadUtil::Destructor)
+                                     ThreadCachingMultipoolAllocator::
+                                                           removeThreadCache);
+        if (0 != rc) {
+            // No thread-specific storage key is available (e.g., the process
+            // has exhausted 'PTHREAD_KEYS_MAX'), so disable thread caching and
+            // serve every request from the shared pools.
+
+            d_maxCachedBlocks = 0;
+        }
+    }
+
+    autoDtor.release();
+    autoPoolsDeallocator.release();
+}
+
+ThreadCachingMultipoolAllocator::ThreadCache *
+ThreadCachingMultipoolAllocator::createThreadCache()
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(d_allocAdapter.allocate(
+                                   sizeof(ThreadCache)
+                                   + d_numPools * sizeof(Magazine)));
+
+    cache->d_owner_p = this;
+    cache->d_prev_p  = 0;
+
+    Magazine *magazines = cache->magazines();
+    for (int i = 0; i < d_numPools; ++i) {
+        magazines[i].d_head_p    = 0;
+        magazines[i].d_numBlocks = 0;
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        cache->d_next_p = d_caches_p;
+        if (d_caches_p) {
+            d_caches_p->d_prev_p = cache;
+        }
+        d_caches_p = cache;
+        ++d_numCaches;
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+
+    return cache;
+}
+
+void ThreadCachingMultipoolAllocator::destroyThreadCache(ThreadCache *cache,
+                                                         bool flushFlag)
+{
+    BSLS_ASSERT(cache);
+
+    if (flushFlag) {
+        Magazine *magazines = cache->magazines();
+        for (int i = 0; i < d_numPools; ++i) {
+            flushMagazine(cache, i, magazines[i].d_numBlocks);
+        }
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (cache->d_prev_p) {
+            cache->d_prev_p->d_next_p = cache->d_next_p;
+        }
+        else {
+            d_caches_p = cache->d_next_p;
+        }
+        if (cache->d_next_p) {
+            cache->d_next_p->d_prev_p = cache->d_prev_p;
+        }
+        --d_numCaches;
+    }
+
+    d_allocAdapter.deallocate(cache);
+}
+
+void ThreadCachingMultipoolAllocator::flushMagazine(ThreadCache *cache,
+                                                    int          pool,
+                                                    int          numBlocks)
+{
+    Magazine& magazine = cache->magazines()[pool];
+
+    BSLS_ASSERT(numBlocks <= magazine.d_numBlocks);
+
+    if (0 == numBlocks) {
+        return;                                                       // RETURN
+    }
+
+    // Detach the first 'numBlocks' blocks, and return them to the shared pool
+    // as a single list.  Note that 'FreeBlock' has the list layout expected
+    // by 'ConcurrentPool::deallocateList'.
+
+    FreeBlock *head = magazine.d_head_p;
+    FreeBlock *last = head;
+    for (int i = 1; i < numBlocks; ++i) {
+        last = last->d_next_p;
+    }
+
+    magazine.d_head_p     = last->d_next_p;
+    magazine.d_numBlocks -= numBlocks;
+
+    last->d_next_p = 0;
+    d_pools_p[pool].deallocateList(head);
+}
+
+// PRIVATE ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::findPool(
+                                             bsls::Types::size_type size) const
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+// CREATORS
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_maxCachedBlocks(k_DEFAULT_MAX_CACHED_BLOCKS)
+, d_caches_p(0)
+, d_numCaches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(k_DEFAULT_NUM_POOLS);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_maxCachedBlocks(k_DEFAULT_MAX_CACHED_BLOCKS)
+, d_caches_p(0)
+, d_numCaches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(numPools);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                      int               numPools,
+                                      int               maxCachedBlocksPerPool,
+                                      bslma::Allocator *basicAllocator)
+: d_maxCachedBlocks(maxCachedBlocksPerPool)
+, d_caches_p(0)
+, d_numCaches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(numPools);
+}
+
+ThreadCachingMultipoolAllocator::~ThreadCachingMultipoolAllocator()
+{
+    // Delete the key first, so that no thread-exit cleanup can run for a
+    // cache belonging to this (partially destroyed) object.  Note that no key
+    // is held if thread caching is disabled.
+
+    if (0 < d_maxCachedBlocks) {
+        bslmt::ThreadUtil::deleteKey(d_cacheKey);
+    }
+
+    while (d_caches_p) {
+        ThreadCache *cache = d_caches_p;
+        d_caches_p = cache->d_next_p;
+        d_allocAdapter.deallocate(cache);
+    }
+
+    d_blockList.release();
+    for (int i = 0; i < d_numPools; ++i) {
+        d_pools_p[i].release();
+        d_pools_p[i].~ConcurrentPool();
+    }
+    d_allocAdapter.deallocate(d_pools_p);
+}
+
+// MANIPULATORS
+void *ThreadCachingMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_maxBlockSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The requested size is large and will not be pooled.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        Header *p = static_cast<Header *>(
+                d_blockList.allocate(size + static_cast<int>(sizeof(Header))));
+
+        p->d_header.d_poolIdx = -1;
+
+        return p + 1;                                                 // RETURN
+    }
+
+    const int pool = findPool(size);
+
+    Header *p;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_maxCachedBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        p = static_cast<Header *>(d_pools_p[pool].allocate());
+    }
+    else {
+        ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            cache = createThreadCache();
+        }
+
+        Magazine& magazine = cache->magazines()[pool];
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(magazine.d_head_p)) {
+            FreeBlock *block   = magazine.d_head_p;
+            magazine.d_head_p  = block->d_next_p;
+            --magazine.d_numBlocks;
+
+            p = reinterpret_cast<Header *>(block);
+        }
+        else {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // Refill the empty magazine to half its capacity, so that the
+            // next several requests (and deallocations) for this size are
+            // served without touching the shared pool.  The blocks (plus the
+            // one returned) are taken from the shared pool as a single list,
+            // and the magazine is updated only once that succeeds.
+
+            const int  numRefill = d_maxCachedBlocks / 2;
+            FreeBlock *block     = static_cast<FreeBlock *>(
+                                  d_pools_p[pool].allocateList(numRefill + 1));
+
+            magazine.d_head_p    = block->d_next_p;
+            magazine.d_numBlocks = numRefill;
+
+            p = reinterpret_cast<Header *>(block);
+        }
+    }
+
+    p->d_header.d_poolIdx = pool;
+
+    return p + 1;
+}
+
+void ThreadCachingMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        return;                                                       // RETURN
+    }
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    const int pool = h->d_header.d_poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(-1 == pool)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_blockList.deallocate(h);
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_maxCachedBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_pools_p[pool].deallocate(h);
+        return;                                                       // RETURN
+    }
+
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        cache = createThreadCache();
+    }
+
+    Magazine&  magazine = cache->magazines()[pool];
+    FreeBlock *block    = reinterpret_cast<FreeBlock *>(h);
+
+    block->d_next_p   = magazine.d_head_p;
+    magazine.d_head_p = block;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                             ++magazine.d_numBlocks > d_maxCachedBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Return half of the (full) magazine to the owning pool, leaving room
+        // for subsequent deallocations by this thread.
+
+        flushMagazine(cache, pool, magazine.d_numBlocks / 2 + 1);
+    }
+}
+
+void ThreadCachingMultipoolAllocator::flushThreadCache()
+{
+    if (0 == d_maxCachedBlocks) {
+        return;                                                       // RETURN
+    }
+
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (cache) {
+        bslmt::ThreadUtil::setSpecific(d_cacheKey, 0);
+        destroyThreadCache(cache, true);
+    }
+}
+
+void ThreadCachingMultipoolAllocator::release()
+{
+    {
+        // The blocks held by the thread caches are about to be returned to
+        // the underlying allocator along with the pools' chunks, so the caches
+        // are simply emptied (the caches themselves remain registered with
+        // their threads).
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (ThreadCache *cache = d_caches_p; cache; cache = cache->d_next_p) {
+            Magazine *magazines = cache->magazines();
+            for (int i = 0; i < d_numPools; ++i) {
+                magazines[i].d_head_p    = 0;
+                magazines[i].d_numBlocks = 0;
+            }
+        }
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        d_pools_p[i].release();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_blockList.release();
+}
+
+// ACCESSORS
+int ThreadCachingMultipoolAllocator::numThreadCaches() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numCaches;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,408 @@
+// bdlma_threadcachingmultipoolallocator.h                            -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingMultipoolAllocator: thread-caching multipool allocator
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides an allocator,
+// 'bdlma::ThreadCachingMultipoolAllocator', that implements the
+// 'bdlma::ManagedAllocator' protocol and, like
+// 'bdlma::ConcurrentMultipoolAllocator', maintains a configurable number of
+// 'bdlma::ConcurrentPool' objects, each dispensing memory blocks of a unique
+// size (the block size of the first pool is 8 bytes, with each successive pool
+// managing blocks of twice the size of the previous pool).  In addition, each
+// thread that uses a 'bdlma::ThreadCachingMultipoolAllocator' is given a
+// private *thread* *cache* holding, for each pool, a bounded singly-linked
+// list (a "magazine") of free blocks.  Allocation requests are served from,
+// and deallocation requests returned to, the calling thread's magazine without
+// accessing any state shared with other threads; the shared pools are
+// consulted only when a magazine is empty (in which case it is refilled to
+// half its capacity) or full (in which case half of its blocks are returned to
+// the owning pool).  A refill or flush transfers its blocks to or from the
+// owning pool as a single list (see 'bdlma::ConcurrentPool::allocateList' and
+// 'bdlma::ConcurrentPool::deallocateList'), so that it costs one critical
+// section, or one atomic update of the free list of the pool, rather than one
+// per block.
+//..
+//   ,--------------------------------------.
+//  ( bdlma::ThreadCachingMultipoolAllocator )
+//   `--------------------------------------'
+//               |         ctor/dtor
+//               |         flushThreadCache
+//               |         maxCachedBlocksPerPool
+//               |         maxPooledBlockSize
+//               |         numPools
+//               |         numThreadCaches
+//               V
+//    ,-----------------------.
+//   ( bdlma::ManagedAllocator )
+//    `-----------------------'
+//               |         release
+//               V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                        allocate
+//                        deallocate
+//..
+// Requests for blocks larger than 'maxPooledBlockSize()' are not cached; they
+// are satisfied by a separately managed (and mutex-protected) list of memory
+// blocks, as with 'bdlma::ConcurrentMultipoolAllocator'.
+//
+///Thread Caches
+///-------------
+// A thread cache is created the first time a thread allocates (or deallocates)
+// a pooled block through a given allocator, and is located on subsequent calls
+// through thread-specific storage (see 'bslmt_threadutil').  A block freed by
+// a thread other than the one that allocated it is simply placed in the
+// freeing thread's cache; since all caches draw from the same shared pools,
+// such *cross-thread* frees never touch the allocating thread's cache, and any
+// excess is returned to the pool that owns the block.
+//
+// The number of blocks held by each magazine is bounded by the
+// 'maxCachedBlocksPerPool' value supplied at construction, so the memory held
+// idle by any one thread is at most:
+//..
+//  maxCachedBlocksPerPool * (8 + 16 + 32 + ... + maxPooledBlockSize())
+//..
+// plus per-block overhead.  Specifying a 'maxCachedBlocksPerPool' of 0
+// disables caching entirely, in which case this allocator behaves like a
+// 'bdlma::ConcurrentMultipoolAllocator'.
+//
+// When a thread exits, the blocks in its cache are automatically returned to
+// the shared pools (the "flush-on-thread-exit hook"), making them available to
+// the remaining threads.  A thread that becomes idle for a long period (but
+// does not exit) may call 'flushThreadCache' to do the same explicitly.
+//
+///Thread Safety
+///-------------
+// 'allocate', 'deallocate', and 'flushThreadCache' may be called concurrently
+// from any number of threads.  'release' (and the destructor) must not be
+// called while any other thread is using the allocator; 'release' discards the
+// contents of every thread's cache before returning all memory to the
+// underlying allocator.
+//
+///Thread-Specific Storage Keys
+///- - - - - - - - - - - - - - -
+// Each 'bdlma::ThreadCachingMultipoolAllocator' object having a non-zero
+// 'maxCachedBlocksPerPool' consumes one thread-specific storage key (see
+// 'bslmt::ThreadUtil::createKey') for its lifetime.  The number of such keys
+// available to a process is limited on most platforms (e.g., to
+// 'PTHREAD_KEYS_MAX', which is 1024 on Linux), and is shared with every other
+// user of thread-specific storage in the process.  If no key is available when
+// an allocator is constructed, thread caching is disabled for that allocator
+// ('maxCachedBlocksPerPool()' returns 0), which then behaves like a
+// 'bdlma::ConcurrentMultipoolAllocator'.  This allocator is therefore intended
+// to be used as a small number of long-lived objects (e.g., one per service),
+// rather than created per request.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Across Worker Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a number of worker threads build short-lived node-based
+// containers, and that we want all of them to draw memory from a single pool
+// without contending on the pool's free lists.
+//
+// First, we define the work performed by each thread, which creates and
+// destroys a 'bsl::list' whose nodes are supplied by the shared allocator:
+//..
+//  extern "C" void *workerThread(void *arg)
+//  {
+//      bslma::Allocator *allocator = static_cast<bslma::Allocator *>(arg);
+//
+//      for (int i = 0; i < 100; ++i) {
+//          bsl::list<int> list(allocator);
+//          for (int j = 0; j < 100; ++j) {
+//              list.push_back(j);
+//          }
+//      }
+//      return 0;
+//  }
+//..
+// Then, we create the allocator, specifying that each thread may cache at most
+// 64 free blocks of each size:
+//..
+//  bdlma::ThreadCachingMultipoolAllocator allocator(8, 64);
+//..
+// Next, we start the worker threads:
+//..
+//  enum { k_NUM_THREADS = 4 };
+//
+//  bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      bslmt::ThreadUtil::create(&handles[i], workerThread, &allocator);
+//  }
+//..
+// Then, we wait for the threads to complete.  Each exiting thread returns the
+// contents of its cache to the shared pools:
+//..
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//  assert(0 == allocator.numThreadCaches());
+//..
+// Finally, note that the memory obtained by the threads is retained by the
+// pools until the allocator is released or destroyed:
+//..
+//  allocator.release();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_concurrentallocatoradapter.h>
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+class ConcurrentPool;
+
+                   // =====================================
+                   // class ThreadCachingMultipoolAllocator
+                   // =====================================
+
+class ThreadCachingMultipoolAllocator : public ManagedAllocator {
+    // This class implements the 'bdlma::ManagedAllocator' protocol to provide
+    // a thread-safe allocator that maintains a configurable number of
+    // 'bdlma::ConcurrentPool' objects, each dispensing memory blocks of a
+    // unique size, fronted by a bounded per-thread cache of free blocks for
+    // each pool.  Allocation and deallocation requests are satisfied from the
+    // calling thread's cache whenever possible.  Both the 'release' method and
+    // the destructor release all memory currently allocated via the object.
+
+    // PRIVATE TYPES
+    struct Header {
+        // This 'struct' provides header information for each allocated memory
+        // block.  The header stores the index to the pool used for the memory
+        // allocation, or -1 if the block was not pooled.
+
+        union {
+            int                    d_poolIdx;  // pool used for this memory
+                                               // block
+
+            bsls::AlignmentUtil::MaxAlignedType
+                                   d_dummy;    // force maximum alignment
+        } d_header;
+    };
+
+    struct ThreadCache;
+        // Per-thread cache of free blocks (defined in the '.cpp' file).
+
+    // DATA
+    ConcurrentPool            *d_pools_p;        // array of memory pools,
+                                                 // each dispensing fixed-size
+                                                 // memory blocks
+
+    int                        d_numPools;       // number of memory pools
+
+    bsls::Types::size_type     d_maxBlockSize;   // largest pooled block size
+
+    int                        d_maxCachedBlocks;
+                                                 // maximum number of free
+                                                 // blocks held by a thread
+                                                 // cache for each pool
+
+    bslmt::ThreadUtil::Key     d_cacheKey;       // key locating the calling
+                                                 // thread's cache
+
+    ThreadCache               *d_caches_p;       // list of all thread caches
+                                                 // (guarded by 'd_mutex')
+
+    int                        d_numCaches;      // number of thread caches
+                                                 // (guarded by 'd_mutex')
+
+    BlockList                  d_blockList;      // memory manager for "large"
+                                                 // memory blocks (guarded by
+                                                 // 'd_mutex')
+
+    mutable bslmt::Mutex       d_mutex;          // synchronize access to
+                                                 // shared data
+
+    ConcurrentAllocatorAdapter d_allocAdapter;   // thread-safe adapter
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingMultipoolAllocator(const ThreadCachingMultipoolAllocator&);
+    ThreadCachingMultipoolAllocator& operator=(
+                                      const ThreadCachingMultipoolAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static void removeThreadCache(void *cache);
+        // Return the blocks held by the specified 'cache' to the pools of the
+        // allocator owning it, and destroy 'cache'.  This method is the
+        // thread-specific storage cleanup function invoked when a thread
+        // having a cache exits.
+
+    // PRIVATE MANIPULATORS
+    void initialize(int numPools);
+        // Initialize this allocator with the specified 'numPools'.
+
+    ThreadCache *createThreadCache();
+        // Create a cache for the calling thread, register it with this
+        // allocator, and return its address.
+
+    void destroyThreadCache(ThreadCache *cache, bool flushFlag);
+        // Unregister and destroy the specified 'cache'.  If the specified
+        // 'flushFlag' is 'true', first return the blocks held by 'cache' to
+        // the shared pools.
+
+    void flushMagazine(ThreadCache *cache, int pool, int numBlocks);
+        // Return the specified 'numBlocks' free blocks of the specified 'pool'
+        // held by the specified 'cache' to 'pool'.  The behavior is undefined
+        // unless 'cache' holds at least 'numBlocks' blocks for 'pool'.
+
+    // PRIVATE ACCESSORS
+    int findPool(bsls::Types::size_type size) const;
+        // Return the index of the memory pool in this allocator for an
+        // allocation request of the specified 'size' (in bytes).
+
+  public:
+    // CREATORS
+    explicit ThreadCachingMultipoolAllocator(
+                                         bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingMultipoolAllocator(
+                                         int               numPools,
+                                         bslma::Allocator *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(int               numPools,
+                                    int               maxCachedBlocksPerPool,
+                                    bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching multipool allocator.  Optionally specify
+        // 'numPools', indicating the number of internally created pools; the
+        // block size of the first pool is 8 bytes, with the block size of each
+        // additional pool successively doubling.  If 'numPools' is not
+        // specified, an implementation-defined number of pools is created.
+        // If 'numPools' is specified, optionally specify
+        // 'maxCachedBlocksPerPool', indicating the maximum number of free
+        // blocks of each size that a single thread may hold in its cache; if
+        // 'maxCachedBlocksPerPool' is not specified, an implementation-defined
+        // value is used.  A 'maxCachedBlocksPerPool' of 0 disables thread
+        // caching; thread caching is also disabled if no thread-specific
+        // storage key is available (see {Thread-Specific Storage Keys}).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numPools' and
+        // '0 <= maxCachedBlocksPerPool'.
+
+    ~ThreadCachingMultipoolAllocator() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this allocator.  All memory allocated from this allocator,
+        // including the memory held by thread caches, is released.  The
+        // behavior is undefined if any other thread is using this allocator.
+
+    // MANIPULATORS
+    void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a contiguous block of maximally aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size <= maxPooledBlockSize()', the block is taken from the calling
+        // thread's cache, if available; otherwise the memory allocation is
+        // managed directly by the underlying allocator, and is not pooled.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Relinquish the memory block at the specified 'address' back to this
+        // allocator for reuse.  If 'address' is 0, this method has no effect.
+        // The block need not have been allocated by the calling thread.  The
+        // behavior is undefined unless 'address' was allocated by this
+        // allocator, and has not already been deallocated.
+
+    void flushThreadCache();
+        // Return all blocks held by the calling thread's cache to the shared
+        // pools, and destroy that cache.  A new cache is created if the
+        // calling thread subsequently uses this allocator.  This method has no
+        // effect if the calling thread has no cache.
+
+    void release() BSLS_KEYWORD_OVERRIDE;
+        // Relinquish all memory currently allocated through this allocator,
+        // including the blocks held by every thread cache.  The behavior is
+        // undefined if any other thread is using this allocator.
+
+    // ACCESSORS
+    int maxCachedBlocksPerPool() const;
+        // Return the maximum number of free blocks of each size that a single
+        // thread cache may hold.  Note that 0 is returned if thread caching is
+        // disabled.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // allocator.  Note that the maximum value is defined as:
+        //..
+        //  2 ^ (numPools + 2)
+        //..
+
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+
+    int numThreadCaches() const;
+        // Return the number of thread caches currently held by this allocator.
+        // Note that the returned value may be out of date by the time it is
+        // used if other threads are using this allocator.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::maxCachedBlocksPerPool() const
+{
+    return d_maxCachedBlocks;
+}
+
+inline
+bsls::Types::size_type
+ThreadCachingMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+int ThreadCachingMultipoolAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
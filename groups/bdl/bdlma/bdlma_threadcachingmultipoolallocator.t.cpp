@@ -0,0 +1,753 @@
+// bdlma_threadcachingmultipoolallocator.t.cpp                        -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ThreadCachingMultipoolAllocator' is a thread-safe managed allocator
+// that keeps a bounded cache of free blocks per thread in front of a set of
+// shared 'bdlma::ConcurrentPool' objects.  The primary concerns are that the
+// allocator dispenses properly sized and aligned memory, that blocks are
+// recycled through the calling thread's cache, that the cache size is bounded
+// as configured, that thread caches are flushed and destroyed when threads
+// exit (or call 'flushThreadCache'), that blocks may be freed by a thread
+// other than the one that allocated them, and that the allocator remains
+// usable when no thread-specific storage key is available.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingMultipoolAllocator(Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int numPools, Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int, int, Allocator *ba = 0);
+// [ 2] ~ThreadCachingMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void flushThreadCache();
+// [ 6] void release();
+//
+// ACCESSORS
+// [ 2] int maxCachedBlocksPerPool() const;
+// [ 2] size_type maxPooledBlockSize() const;
+// [ 2] int numPools() const;
+// [ 4] int numThreadCaches() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY: CROSS-THREAD FREE AND THREAD-EXIT FLUSH
+// [ 7] THREAD-SPECIFIC STORAGE KEY EXHAUSTION
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingMultipoolAllocator Obj;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+// ============================================================================
+//                  HELPER FUNCTIONS AND TYPES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct ExchangeArgs {
+    // Arguments for 'exchangeThread': each thread allocates 'd_numBlocks'
+    // blocks into its own slot of 'd_slots', waits on 'd_barrier', then frees
+    // the blocks allocated by its neighbor.
+
+    Obj            *d_obj_p;
+    bslmt::Barrier *d_barrier_p;
+    void          **d_slots_p;
+    int             d_numThreads;
+    int             d_numBlocks;
+    int             d_index;
+};
+
+extern "C" void *exchangeThread(void *arg)
+{
+    ExchangeArgs& args = *static_cast<ExchangeArgs *>(arg);
+
+    void **mine = args.d_slots_p + args.d_index * args.d_numBlocks;
+    for (int i = 0; i < args.d_numBlocks; ++i) {
+        const int size = 1 + (i * 7) % 200;
+        mine[i] = args.d_obj_p->allocate(size);
+        bsl::memset(mine[i], args.d_index, size);
+    }
+
+    args.d_barrier_p->wait();
+
+    const int neighbor = (args.d_index + 1) % args.d_numThreads;
+    void **theirs = args.d_slots_p + neighbor * args.d_numBlocks;
+    for (int i = 0; i < args.d_numBlocks; ++i) {
+        const unsigned char *p = static_cast<unsigned char *>(theirs[i]);
+        ASSERTV(args.d_index, i, neighbor == p[0]);
+        args.d_obj_p->deallocate(theirs[i]);
+    }
+
+    args.d_barrier_p->wait();
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Across Worker Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a number of worker threads build short-lived node-based
+// containers, and that we want all of them to draw memory from a single pool
+// without contending on the pool's free lists.
+//
+// First, we define the work performed by each thread, which creates and
+// destroys a 'bsl::list' whose nodes are supplied by the shared allocator:
+//..
+    extern "C" void *workerThread(void *arg)
+    {
+        bslma::Allocator *allocator = static_cast<bslma::Allocator *>(arg);
+
+        for (int i = 0; i < 100; ++i) {
+            bsl::list<int> list(allocator);
+            for (int j = 0; j < 100; ++j) {
+                list.push_back(j);
+            }
+        }
+        return 0;
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+// Then, we create the allocator, specifying that each thread may cache at most
+// 64 free blocks of each size:
+//..
+    bdlma::ThreadCachingMultipoolAllocator allocator(8, 64);
+//..
+// Next, we start the worker threads:
+//..
+    enum { k_NUM_THREADS = 4 };
+
+    bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], workerThread, &allocator);
+    }
+//..
+// Then, we wait for the threads to complete.  Each exiting thread returns the
+// contents of its cache to the shared pools:
+//..
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    ASSERT(0 == allocator.numThreadCaches());
+//..
+// Finally, note that the memory obtained by the threads is retained by the
+// pools until the allocator is released or destroyed:
+//..
+    allocator.release();
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // THREAD-SPECIFIC STORAGE KEY EXHAUSTION
+        //
+        // Concerns:
+        //: 1 An allocator constructed when no thread-specific storage key is
+        //:   available disables thread caching, rather than failing.
+        //:
+        //: 2 An allocator without thread caching allocates and deallocates
+        //:   correctly, and creates no thread caches.
+        //:
+        //: 3 The key of an allocator is released on destruction, so that a
+        //:   subsequently created allocator can cache blocks again.
+        //
+        // Plan:
+        //: 1 Create allocators until one reports a 'maxCachedBlocksPerPool'
+        //:   of 0, or until a limit well above 'PTHREAD_KEYS_MAX' on common
+        //:   platforms is reached.  (C-1)
+        //:
+        //: 2 Allocate, verify, and free blocks through the last allocator
+        //:   created, and verify that it has no thread caches.  (C-2)
+        //:
+        //: 3 Destroy all of the allocators, create another, and verify that
+        //:   thread caching is enabled.  (C-3)
+        //
+        // Testing:
+        //   THREAD-SPECIFIC STORAGE KEY EXHAUSTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "THREAD-SPECIFIC STORAGE KEY EXHAUSTION\n"
+                             "======================================\n";
+
+        enum { k_MAX_NUM_OBJECTS = 8192, k_NUM_BLOCKS = 100 };
+
+        bslma::TestAllocator ta("supplied", veryVerbose);
+        {
+            bsl::vector<Obj *> objects(&ta);
+            objects.reserve(k_MAX_NUM_OBJECTS);
+
+            bool exhausted = false;
+            while (!exhausted && k_MAX_NUM_OBJECTS > objects.size()) {
+                objects.push_back(new (ta) Obj(2, 16, &ta));
+                exhausted = 0 == objects.back()->maxCachedBlocksPerPool();
+            }
+
+            if (veryVerbose) { P_(objects.size()) P(exhausted) }
+
+            Obj& mX = *objects.back();  const Obj& X = mX;
+
+            void *blocks[k_NUM_BLOCKS];
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                const int size = 1 + i % 64;
+                blocks[i] = mX.allocate(size);
+                bsl::memset(blocks[i], i, size);
+            }
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                ASSERTV(i, i == *static_cast<unsigned char *>(blocks[i]));
+                mX.deallocate(blocks[i]);
+            }
+
+            if (exhausted) {
+                ASSERTV(X.numThreadCaches(), 0 == X.numThreadCaches());
+
+                mX.flushThreadCache();
+                ASSERTV(X.numThreadCaches(), 0 == X.numThreadCaches());
+            }
+
+            for (bsl::size_t i = 0; i < objects.size(); ++i) {
+                ta.deleteObject(objects[i]);
+            }
+        }
+        {
+            Obj mX(2, 16, &ta);  const Obj& X = mX;
+
+            ASSERTV(X.maxCachedBlocksPerPool(),
+                    16 == X.maxCachedBlocksPerPool());
+
+            mX.deallocate(mX.allocate(8));
+            ASSERTV(X.numThreadCaches(), 1 == X.numThreadCaches());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'release'
+        //
+        // Concerns:
+        //: 1 'release' returns all memory, including blocks held in thread
+        //:   caches, to the underlying allocator.
+        //:
+        //: 2 The allocator, and the calling thread's (emptied) cache, remain
+        //:   usable after 'release'.
+        //
+        // Plan:
+        //: 1 Allocate and free blocks so that the calling thread's cache is
+        //:   populated, call 'release', and verify that only the memory for
+        //:   the pool array and the thread cache itself remains in use.  Then
+        //:   allocate again.  (C-1..2)
+        //
+        // Testing:
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'release'\n"
+                             "=================\n";
+
+        bslma::TestAllocator ta("supplied", veryVerbose);
+        {
+            Obj mX(4, 16, &ta);
+
+            const bsls::Types::Int64 baseline = ta.numBytesInUse();
+
+            void *blocks[40];
+            for (int i = 0; i < 40; ++i) {
+                blocks[i] = mX.allocate(1 + i % 64);
+            }
+            void *big = mX.allocate(1000);
+            ASSERT(big);
+            for (int i = 0; i < 40; i += 2) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(1 == mX.numThreadCaches());
+            ASSERT(baseline < ta.numBytesInUse());
+
+            mX.release();
+
+            // Only the pool array and the thread cache remain in use.
+
+            ASSERT(baseline < ta.numBytesInUse());
+            ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+
+            for (int i = 0; i < 40; ++i) {
+                blocks[i] = mX.allocate(1 + i % 64);
+                ASSERT(blocks[i]);
+            }
+            for (int i = 0; i < 40; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: CROSS-THREAD FREE AND THREAD-EXIT FLUSH
+        //
+        // Concerns:
+        //: 1 Blocks allocated by one thread can be freed by another.
+        //:
+        //: 2 Blocks dispensed to concurrently running threads do not overlap.
+        //:
+        //: 3 The cache of an exiting thread is destroyed, and the blocks it
+        //:   held are made available to other threads.
+        //
+        // Plan:
+        //: 1 Start several threads that each allocate and fill blocks, then
+        //:   (after a barrier) verify and free the blocks of a neighbor.
+        //:   (C-1..2)
+        //:
+        //: 2 After joining, verify that no thread caches remain, and that the
+        //:   main thread can allocate the recycled blocks without growing the
+        //:   underlying allocator's usage.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY: CROSS-THREAD FREE AND THREAD-EXIT FLUSH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENCY: CROSS-THREAD FREE AND "
+                             "THREAD-EXIT FLUSH\n"
+                             "==================================="
+                             "=================\n";
+
+        enum { k_NUM_THREADS = 8, k_NUM_BLOCKS = 500 };
+
+        bslma::TestAllocator ta("supplied", veryVerbose);
+        {
+            Obj mX(8, 32, &ta);  const Obj& X = mX;
+
+            bsl::vector<void *> slots(k_NUM_THREADS * k_NUM_BLOCKS);
+
+            for (int round = 0; round < 3; ++round) {
+                bslmt::Barrier            barrier(k_NUM_THREADS);
+                ExchangeArgs              args[k_NUM_THREADS];
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    args[i].d_obj_p      = &mX;
+                    args[i].d_barrier_p  = &barrier;
+                    args[i].d_slots_p    = slots.data();
+                    args[i].d_numThreads = k_NUM_THREADS;
+                    args[i].d_numBlocks  = k_NUM_BLOCKS;
+                    args[i].d_index      = i;
+
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          exchangeThread,
+                                                          &args[i]));
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                ASSERTV(round, X.numThreadCaches(),
+                        0 == X.numThreadCaches());
+            }
+
+            // All memory is now held by the shared pools; reusing it from
+            // this thread does not require more memory (apart from this
+            // thread's cache).
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            void *p = mX.allocate(8);
+            ASSERT(p);
+            mX.deallocate(p);
+
+            ASSERTV(ta.numAllocations() - numAllocations,
+                    1 == ta.numAllocations() - numAllocations);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING CACHE BOUNDS AND 'flushThreadCache'
+        //
+        // Concerns:
+        //: 1 A thread cache is created on first use by a thread.
+        //:
+        //: 2 The number of blocks cached by a thread for each pool never
+        //:   exceeds 'maxCachedBlocksPerPool()'; excess blocks are returned to
+        //:   the shared pool, and subsequently reused.
+        //:
+        //: 3 'flushThreadCache' destroys the calling thread's cache, and has
+        //:   no effect if there is no cache.
+        //:
+        //: 4 No thread cache is created if caching is disabled.
+        //
+        // Plan:
+        //: 1 Allocate and free many blocks of one size, and verify the number
+        //:   of thread caches, and that the underlying allocator is not
+        //:   consulted again once the blocks are reused.  (C-1..2)
+        //:
+        //: 2 Call 'flushThreadCache' twice and verify the number of caches.
+        //:   (C-3)
+        //:
+        //: 3 Repeat with a 'maxCachedBlocksPerPool' of 0.  (C-4)
+        //
+        // Testing:
+        //   void flushThreadCache();
+        //   int numThreadCaches() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING CACHE BOUNDS AND 'flushThreadCache'\n"
+                             "===========================================\n";
+
+        enum { k_NUM_BLOCKS = 200 };
+
+        for (int maxCached = 0; maxCached <= 64; maxCached += 8) {
+            bslma::TestAllocator ta("supplied", veryVerbose);
+
+            Obj mX(4, maxCached, &ta);  const Obj& X = mX;
+
+            ASSERTV(maxCached, X.maxCachedBlocksPerPool(),
+                    maxCached == X.maxCachedBlocksPerPool());
+            ASSERT(0 == X.numThreadCaches());
+
+            void *blocks[k_NUM_BLOCKS];
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(24);
+            }
+            ASSERTV(maxCached, (0 != maxCached) == X.numThreadCaches());
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(24);
+            }
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERTV(maxCached, numAllocations == ta.numAllocations());
+
+            mX.flushThreadCache();
+            ASSERT(0 == X.numThreadCaches());
+
+            mX.flushThreadCache();
+            ASSERT(0 == X.numThreadCaches());
+
+            // All blocks are back in the shared pool.
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(24);
+            }
+            ASSERTV(maxCached, ta.numAllocations() - numAllocations,
+                    (0 != maxCached) == ta.numAllocations() - numAllocations);
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 2 Returned memory is maximally aligned, writable for the requested
+        //:   size, and distinct from all other outstanding blocks.
+        //:
+        //: 3 Blocks larger than 'maxPooledBlockSize()' are obtained from, and
+        //:   returned to, the underlying allocator.
+        //:
+        //: 4 A freed block is reused by a subsequent request of the same size
+        //:   class from the same thread.
+        //
+        // Plan:
+        //: 1 Allocate blocks of every size up to twice 'maxPooledBlockSize()',
+        //:   fill them with a pattern, verify alignment and patterns, then
+        //:   free them.  (C-1..3)
+        //:
+        //: 2 Free a block, allocate a block of the same size, and verify the
+        //:   address is the same.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'allocate' AND 'deallocate'\n"
+                             "===================================\n";
+
+        bslma::TestAllocator ta("supplied", veryVerbose);
+        {
+            Obj mX(5, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            const int MAX = static_cast<int>(X.maxPooledBlockSize());
+
+            bsl::vector<char *> blocks;
+            for (int size = 1; size <= 2 * MAX; ++size) {
+                const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+                char *p = static_cast<char *>(mX.allocate(size));
+                ASSERTV(size, p);
+                ASSERTV(size, 0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                         % k_MAX_ALIGN);
+                bsl::memset(p, size & 0xff, size);
+                blocks.push_back(p);
+
+                if (size > MAX) {
+                    ASSERTV(size, numBlocks + 1 == ta.numBlocksInUse());
+                }
+            }
+            for (int size = 1; size <= 2 * MAX; ++size) {
+                const char *p = blocks[size - 1];
+                for (int j = 0; j < size; ++j) {
+                    ASSERTV(size, j, static_cast<char>(size & 0xff) == p[j]);
+                }
+            }
+            for (int size = 1; size <= 2 * MAX; ++size) {
+                const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+                mX.deallocate(blocks[size - 1]);
+
+                if (size > MAX) {
+                    ASSERTV(size, numBlocks - 1 == ta.numBlocksInUse());
+                }
+            }
+
+            for (int size = 1; size <= MAX; size *= 2) {
+                void *p = mX.allocate(size);
+                mX.deallocate(p);
+                void *q = mX.allocate(size);
+                ASSERTV(size, p == q);
+                mX.deallocate(q);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the number of pools and maximum
+        //:   cached blocks as specified, or with default values.
+        //:
+        //: 2 Memory is supplied by the specified allocator, or the default
+        //:   allocator if none is specified, and is released at destruction.
+        //
+        // Plan:
+        //: 1 Construct objects with each constructor and verify the
+        //:   accessors, and the allocators' usage.  (C-1..2)
+        //
+        // Testing:
+        //   ThreadCachingMultipoolAllocator(Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int numPools, Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int, int, Allocator *ba = 0);
+        //   ~ThreadCachingMultipoolAllocator();
+        //   int maxCachedBlocksPerPool() const;
+        //   size_type maxPooledBlockSize() const;
+        //   int numPools() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING CREATORS AND ACCESSORS\n"
+                             "==============================\n";
+
+        bslma::TestAllocator ta("supplied", veryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 < X.numPools());
+            ASSERT(0 < X.maxCachedBlocksPerPool());
+            ASSERT(bsls::Types::size_type(4) << X.numPools()
+                                                   == X.maxPooledBlockSize());
+            ASSERT(0 < ta.numBytesInUse());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        for (int numPools = 1; numPools <= 12; ++numPools) {
+            {
+                Obj mX(numPools, &ta);  const Obj& X = mX;
+
+                ASSERTV(numPools, numPools == X.numPools());
+                ASSERTV(numPools, bsls::Types::size_type(4) << numPools
+                                                   == X.maxPooledBlockSize());
+                mX.deallocate(mX.allocate(X.maxPooledBlockSize()));
+            }
+            ASSERT(0 == ta.numBytesInUse());
+            {
+                Obj mX(numPools, numPools - 1, &ta);  const Obj& X = mX;
+
+                ASSERTV(numPools, numPools     == X.numPools());
+                ASSERTV(numPools, numPools - 1 == X.maxCachedBlocksPerPool());
+                mX.deallocate(mX.allocate(X.maxPooledBlockSize()));
+            }
+            ASSERT(0 == ta.numBytesInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, allocate and deallocate a few blocks.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        bslma::TestAllocator ta("supplied", veryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *p1 = mX.allocate(5);
+            void *p2 = mX.allocate(100);
+            void *p3 = mX.allocate(100000);
+            ASSERT(p1);  ASSERT(p2);  ASSERT(p3);
+            ASSERT(p1 != p2);
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(p3);
+
+            ASSERT(p1 == mX.allocate(5));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
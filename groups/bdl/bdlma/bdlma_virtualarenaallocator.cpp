@@ -0,0 +1,424 @@
+// bdlma_virtualarenaallocator.cpp                                    -*-C++-*-
+#include <bdlma_virtualarenaallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_virtualarenaallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'GetSystemInfo', 'VirtualAlloc', 'VirtualFree'
+
+#else
+
+#include <sys/mman.h>  // 'mmap', 'mprotect', 'madvise', 'munmap'
+#include <unistd.h>    // 'sysconf'
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+// The minimum number of bytes committed at a time in 'e_SYSTEM_PAGES' mode
+// (rounded up to a multiple of the system page size).  Committing several
+// pages at a time amortizes the cost of the system call.
+
+static const bsls::Types::size_type k_MIN_COMMIT_SIZE = 64 * 1024;
+
+// The size of a transparent huge page (in bytes).  This is the size of a
+// PMD-mapped page on the Linux platforms we support.
+
+static const bsls::Types::size_type k_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// HELPER FUNCTIONS
+
+bsls::Types::size_type getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+    static bsls::AtomicInt pageSize(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == pageSize.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        pageSize = static_cast<int>(info.dwPageSize);
+
+#else
+
+        pageSize = static_cast<int>(sysconf(_SC_PAGESIZE));
+
+#endif
+    }
+
+    return pageSize.loadRelaxed();
+}
+
+bool isHugePageSupported()
+    // Return 'true' if transparent huge pages can be requested on this
+    // platform, and 'false' otherwise.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline
+bsls::Types::size_type roundUp(bsls::Types::size_type size,
+                               bsls::Types::size_type granularity)
+    // Return the specified 'size' rounded up to the nearest multiple of the
+    // specified 'granularity'.  The behavior is undefined unless
+    // '0 < granularity'.
+{
+    return (size + granularity - 1) / granularity * granularity;
+}
+
+void *systemReserve(bsls::Types::size_type size)
+    // Reserve a page-aligned range of virtual address space of the specified
+    // 'size' (in bytes) that is not accessible until committed, and return
+    // the address of the range, or 0 if the range could not be reserved.  The
+    // behavior is undefined unless '0 < size'.
+{
+    BSLS_ASSERT(size > 0);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return VirtualAlloc(0, size, MEM_RESERVE, PAGE_NOACCESS);         // RETURN
+
+#else
+
+    int flags = MAP_ANON | MAP_PRIVATE;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+
+    void *address = mmap(0, size, PROT_NONE, flags, -1, 0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    return address;
+
+#endif
+}
+
+void systemUnreserve(void *address, bsls::Types::size_type size)
+    // Return the range of virtual address space of the specified 'size' (in
+    // bytes) at the specified 'address' back to the system.  The behavior is
+    // undefined unless 'address' and 'size' describe a range returned by
+    // 'systemReserve'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    munmap(static_cast<char *>(address), size);
+
+#endif
+}
+
+int systemCommit(void *address, bsls::Types::size_type size)
+    // Make the pages in the range of the specified 'size' (in bytes) at the
+    // specified 'address' readable and writable.  Return 0 on success, and a
+    // non-zero value otherwise.  The behavior is undefined unless the range
+    // is page-aligned and lies within a range returned by 'systemReserve'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return 0 == VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE);
+                                                                      // RETURN
+
+#else
+
+    return mprotect(static_cast<char *>(address),
+                    size,
+                    PROT_READ | PROT_WRITE);                          // RETURN
+
+#endif
+}
+
+void systemDecommit(void *address, bsls::Types::size_type size)
+    // Return the physical memory backing the pages in the range of the
+    // specified 'size' (in bytes) at the specified 'address' to the system,
+    // and make those pages inaccessible, while retaining the reservation of
+    // the range.  The behavior is undefined unless the range is page-aligned
+    // and lies within a range returned by 'systemReserve'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, size, MEM_DECOMMIT);
+
+#else
+
+    madvise(static_cast<char *>(address), size, MADV_DONTNEED);
+    mprotect(static_cast<char *>(address), size, PROT_NONE);
+
+#endif
+}
+
+void systemAdviseHugePages(void *address, bsls::Types::size_type size)
+    // Advise the system to back the range of the specified 'size' (in bytes)
+    // at the specified 'address' with transparent huge pages, if supported.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+
+    madvise(static_cast<char *>(address), size, MADV_HUGEPAGE);
+
+#else
+
+    (void)address;
+    (void)size;
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                   // ===================================
+                   // struct VirtualArenaAllocator::Header
+                   // ===================================
+
+struct VirtualArenaAllocator::Header {
+    // This 'struct' precedes each block dispensed by a
+    // 'VirtualArenaAllocator', and links it to the header of the block
+    // allocated immediately before it.
+
+    union {
+        struct {
+            Header *d_prev_p;       // header of the preceding block, or 0
+
+            bool    d_isAvailable;  // 'true' if the block was deallocated
+        } d_data;
+
+        bsls::AlignmentUtil::MaxAlignedType d_dummy;
+                                    // force maximal alignment of the block
+    };
+};
+
+                        // ---------------------------
+                        // class VirtualArenaAllocator
+                        // ---------------------------
+
+// CREATORS
+VirtualArenaAllocator::VirtualArenaAllocator(bsls::Types::size_type capacity,
+                                             PageMode               pageMode)
+: d_mapping_p(0)
+, d_mappingSize(0)
+, d_begin_p(0)
+, d_cursor_p(0)
+, d_committed_p(0)
+, d_end_p(0)
+, d_top_p(0)
+, d_commitGranularity(roundUp(k_MIN_COMMIT_SIZE, getSystemPageSize()))
+, d_pageMode(pageMode)
+{
+    BSLMF_ASSERT(0 ==
+                  sizeof(Header) % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+    BSLS_ASSERT(0 < capacity);
+
+    const bool useHugePages = e_HUGE_PAGES == pageMode
+                           && isHugePageSupported();
+
+    if (useHugePages) {
+        d_commitGranularity = roundUp(k_HUGE_PAGE_SIZE, getSystemPageSize());
+    }
+
+    const bsls::Types::size_type size = roundUp(capacity,
+                                                d_commitGranularity);
+
+    // Over-reserve by one huge page so that the arena can be aligned to a
+    // huge page boundary, making every committed unit eligible for a huge
+    // page.
+
+    d_mappingSize = useHugePages ? size + d_commitGranularity : size;
+
+    d_mapping_p = static_cast<char *>(systemReserve(d_mappingSize));
+
+    if (!d_mapping_p) {
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    d_begin_p = d_mapping_p;
+
+    if (useHugePages) {
+        const bsls::Types::size_type offset =
+                             reinterpret_cast<bsls::Types::UintPtr>(d_begin_p)
+                                                        % d_commitGranularity;
+        if (offset) {
+            d_begin_p += d_commitGranularity - offset;
+        }
+
+        systemAdviseHugePages(d_begin_p, size);
+    }
+
+    d_cursor_p    = d_begin_p;
+    d_committed_p = d_begin_p;
+    d_end_p       = d_begin_p + size;
+}
+
+VirtualArenaAllocator::~VirtualArenaAllocator()
+{
+    systemUnreserve(d_mapping_p, d_mappingSize);
+}
+
+// MANIPULATORS
+void *VirtualArenaAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    const bsls::Types::size_type available = d_end_p - d_cursor_p;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                  available < sizeof(Header)
+                               || available - sizeof(Header) < size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    const bsls::Types::size_type totalSize =
+                               bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                       sizeof(Header) + size);
+
+    char *newCursor = totalSize < available ? d_cursor_p + totalSize
+                                            : d_end_p;
+
+    if (newCursor > d_committed_p) {
+        bsls::Types::size_type commitSize =
+                            roundUp(newCursor - d_committed_p,
+                                    d_commitGranularity);
+        if (commitSize > static_cast<bsls::Types::size_type>(
+                                                  d_end_p - d_committed_p)) {
+            commitSize = d_end_p - d_committed_p;
+        }
+
+        if (0 != systemCommit(d_committed_p, commitSize)) {
+            BSLS_THROW(bsl::bad_alloc());
+        }
+
+        d_committed_p += commitSize;
+    }
+
+    Header *header = reinterpret_cast<Header *>(d_cursor_p);
+
+    header->d_data.d_prev_p      = d_top_p;
+    header->d_data.d_isAvailable = false;
+
+    d_top_p    = header;
+    d_cursor_p = newCursor;
+
+    return header + 1;
+}
+
+void VirtualArenaAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BSLS_ASSERT(d_begin_p <= reinterpret_cast<char *>(header));
+    BSLS_ASSERT(reinterpret_cast<char *>(header) < d_cursor_p);
+
+    header->d_data.d_isAvailable = true;
+
+    // Reclaim the most recently allocated blocks, as long as they have been
+    // deallocated.
+
+    while (d_top_p && d_top_p->d_data.d_isAvailable) {
+        d_cursor_p = reinterpret_cast<char *>(d_top_p);
+        d_top_p    = d_top_p->d_data.d_prev_p;
+    }
+}
+
+void VirtualArenaAllocator::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_committed_p != d_begin_p) {
+        systemDecommit(d_begin_p, d_committed_p - d_begin_p);
+    }
+
+    d_cursor_p    = d_begin_p;
+    d_committed_p = d_begin_p;
+    d_top_p       = 0;
+}
+
+void VirtualArenaAllocator::rewind()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_cursor_p = d_begin_p;
+    d_top_p    = 0;
+}
+
+// ACCESSORS
+bsls::Types::size_type VirtualArenaAllocator::numBytesCommitted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_committed_p - d_begin_p;
+}
+
+bsls::Types::size_type VirtualArenaAllocator::numBytesInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_cursor_p - d_begin_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
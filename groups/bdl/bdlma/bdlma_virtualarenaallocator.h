@@ -0,0 +1,333 @@
+// bdlma_virtualarenaallocator.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMA_VIRTUALARENAALLOCATOR
+#define INCLUDED_BDLMA_VIRTUALARENAALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator carving memory from a reserved virtual range.
+//
+//@CLASSES:
+//  bdlma::VirtualArenaAllocator: allocator over a reserved address range
+//
+//@SEE_ALSO: bdlma_sequentialallocator, bdlma_blocklist,
+//           bdlma_guardingallocator
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::VirtualArenaAllocator', that implements the
+// 'bdlma::ManagedAllocator' protocol by reserving, at construction, a single
+// contiguous range of virtual address space of a user-specified capacity, and
+// dispensing maximally-aligned memory blocks from that range in increasing
+// address order.  Physical memory is committed lazily, a few pages at a time,
+// as the range is consumed:
+//..
+//   ,----------------------------.
+//  ( bdlma::VirtualArenaAllocator )
+//   `----------------------------'
+//                |         ctor/dtor
+//                |         rewind
+//                |         capacity
+//                |         commitGranularity
+//                |         numBytesCommitted
+//                |         numBytesInUse
+//                |         pageMode
+//                V
+//    ,-----------------------.
+//   ( bdlma::ManagedAllocator )
+//    `-----------------------'
+//                |         release
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                          allocate
+//                          deallocate
+//..
+// A 'bdlma::VirtualArenaAllocator' is intended to be the *underlying*
+// allocator of the sequential allocators in this package (e.g.,
+// 'bdlma::SequentialAllocator' and 'bdlma::BufferedSequentialAllocator').
+// Those allocators obtain their (geometrically growing) buffers from their
+// underlying allocator, and, when supplied with a virtual arena, each new
+// buffer is placed immediately after the previous one, so that the memory of
+// an arena remains contiguous however many times it grows.
+//
+///Deallocation
+///------------
+// Memory is dispensed by advancing a cursor through the reserved range.  When
+// the most recently allocated outstanding block is deallocated, the cursor is
+// moved back to the start of that block, and then past any other
+// already-deallocated blocks immediately preceding it.  Blocks deallocated
+// out of order are therefore reclaimed once every block allocated after them
+// has also been deallocated.  Since a sequential allocator returns all of its
+// buffers to its underlying allocator on 'release', releasing a sequential
+// allocator built on a virtual arena returns the cursor to where it was
+// before the sequential allocator's first buffer was obtained, without any
+// system call.  (Rewinding a sequential allocator retains its buffers, and so
+// leaves the arena unchanged.)
+//
+///Returning Memory to the System
+///------------------------------
+// The 'rewind' method makes all of the arena available for reuse while
+// keeping its committed pages resident, which is the cheapest way to reuse an
+// arena for a new request.  The 'release' method additionally advises the
+// operating system that the contents of the committed pages are no longer
+// needed (e.g., 'madvise(MADV_DONTNEED)' on Linux), so that the physical
+// memory backing them is reclaimed; the address range stays reserved.  The
+// reserved range itself is returned to the system only when the allocator is
+// destroyed.
+//
+///Huge Pages
+///----------
+// A constructor argument of type 'VirtualArenaAllocator::PageMode' determines
+// whether the arena requests *transparent* *huge* *pages* from the operating
+// system.  In 'e_HUGE_PAGES' mode, on platforms that support transparent huge
+// pages (currently Linux), the reserved range is aligned to the huge page
+// size, the operating system is advised to back it with huge pages, and
+// memory is committed in units of a huge page, which greatly reduces the
+// number of TLB misses incurred by large, randomly accessed working sets.  On
+// other platforms, 'e_HUGE_PAGES' is accepted and ignored.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::VirtualArenaAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary').  Note that the sequential allocators it is typically
+// used with are *not* thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Contiguous Request Arena
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that a service processes requests, each of which builds a large,
+// short-lived graph of objects that is discarded in its entirety when the
+// request completes.  A 'bdlma::SequentialAllocator' is a natural fit for
+// such data, but, for very large requests, its many upstream allocations are
+// scattered across the heap.  Instead, we supply the sequential allocator
+// with a virtual arena large enough for the biggest request we expect.
+//
+// First, we create a virtual arena reserving 64 megabytes of address space,
+// requesting huge pages:
+//..
+//  bdlma::VirtualArenaAllocator arena(
+//                                 64 * 1024 * 1024,
+//                                 bdlma::VirtualArenaAllocator::e_HUGE_PAGES);
+//  assert(64 * 1024 * 1024 == arena.capacity());
+//  assert(               0 == arena.numBytesInUse());
+//..
+// Then, we create a sequential allocator that obtains its buffers from the
+// arena, and use it to process a request:
+//..
+//  {
+//      bdlma::SequentialAllocator requestAllocator(&arena);
+//
+//      for (int i = 0; i < 1000; ++i) {
+//          requestAllocator.allocate(1024);
+//      }
+//      assert(1000 * 1024 < arena.numBytesInUse());
+//..
+// Next, we discard the request's data.  The sequential allocator returns all
+// of its buffers to the arena, so the arena's cursor rewinds to the start of
+// the range:
+//..
+//      requestAllocator.release();
+//      assert(0 == arena.numBytesInUse());
+//  }
+//..
+// Finally, when the service goes idle we return the physical memory committed
+// by the arena to the operating system, while keeping the address range
+// reserved for the next burst of requests:
+//..
+//  arena.release();
+//  assert(0 == arena.numBytesInUse());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // ===========================
+                        // class VirtualArenaAllocator
+                        // ===========================
+
+class VirtualArenaAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol to provide a
+    // thread-safe allocator that dispenses maximally-aligned memory blocks, in
+    // increasing address order, from a single range of virtual address space
+    // reserved at construction, committing physical memory lazily as the
+    // range is consumed.
+
+  public:
+    // TYPES
+    enum PageMode {
+        // Enumerate the page-size configurations that may be (optionally)
+        // supplied at construction.
+
+        e_SYSTEM_PAGES,  // use the default system page size
+        e_HUGE_PAGES     // request transparent huge pages, where supported
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Header;
+        // Header preceding each dispensed block (defined in the '.cpp').
+
+    // DATA
+    char                   *d_mapping_p;          // address of the reserved
+                                                  // range, as returned by the
+                                                  // system
+
+    bsls::Types::size_type  d_mappingSize;        // size of the reserved range
+
+    char                   *d_begin_p;            // start of the arena
+                                                  // (suitably aligned within
+                                                  // the reserved range)
+
+    char                   *d_cursor_p;           // first unused byte
+
+    char                   *d_committed_p;        // end of the committed
+                                                  // region
+
+    char                   *d_end_p;              // end of the arena
+
+    Header                 *d_top_p;              // header of the most
+                                                  // recently allocated
+                                                  // outstanding block, or 0
+
+    bsls::Types::size_type  d_commitGranularity;  // unit (in bytes) in which
+                                                  // memory is committed
+
+    PageMode                d_pageMode;           // page-size configuration
+
+    mutable bslmt::Mutex    d_mutex;              // serializes access to the
+                                                  // arena
+
+  private:
+    // NOT IMPLEMENTED
+    VirtualArenaAllocator(const VirtualArenaAllocator&);
+    VirtualArenaAllocator& operator=(const VirtualArenaAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    VirtualArenaAllocator(bsls::Types::size_type capacity,
+                          PageMode               pageMode = e_SYSTEM_PAGES);
+        // Create a virtual arena allocator that reserves a contiguous range of
+        // virtual address space able to hold the specified 'capacity' bytes.
+        // Optionally specify a 'pageMode' indicating whether the arena should
+        // be backed by transparent huge pages where the platform supports
+        // them.  If 'pageMode' is not specified, system pages are used.  If
+        // the address range cannot be reserved, a 'bsl::bad_alloc' exception
+        // is thrown.  The behavior is undefined unless '0 < capacity'.  Note
+        // that no physical memory is committed by this constructor.
+
+    ~VirtualArenaAllocator() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this allocator, returning the reserved address range, and
+        // all memory allocated from it, to the system.
+
+    // MANIPULATORS
+    void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes), placed after every
+        // outstanding block previously allocated from this arena.  If 'size'
+        // is 0, no memory is allocated and 0 is returned.  If the arena does
+        // not have enough unused capacity, or the memory cannot be committed,
+        // a 'bsl::bad_alloc' exception is thrown.
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this method has no effect.  The
+        // memory is made available for reuse once every block allocated after
+        // it has also been deallocated.  The behavior is undefined unless
+        // 'address' was allocated using this allocator and has not already
+        // been deallocated.
+
+    void release() BSLS_KEYWORD_OVERRIDE;
+        // Release all memory currently allocated through this allocator, and
+        // advise the system that the physical memory committed by this
+        // allocator may be reclaimed.  The address range reserved by this
+        // allocator is retained.
+
+    void rewind();
+        // Release all memory currently allocated through this allocator,
+        // retaining the committed memory for reuse.
+
+    // ACCESSORS
+    bsls::Types::size_type capacity() const;
+        // Return the number of bytes of address space reserved by this
+        // allocator.
+
+    bsls::Types::size_type commitGranularity() const;
+        // Return the number of bytes of memory committed by this allocator at
+        // a time.  Note that this value is a multiple of the system page size,
+        // and of the huge page size in 'e_HUGE_PAGES' mode on platforms that
+        // support huge pages.
+
+    bsls::Types::size_type numBytesCommitted() const;
+        // Return the number of bytes of the reserved range that are currently
+        // committed (i.e., accessible).
+
+    bsls::Types::size_type numBytesInUse() const;
+        // Return the number of bytes of the reserved range that are currently
+        // not available for allocation, including any per-block overhead and
+        // the memory of deallocated blocks that is not yet reclaimed.
+
+    PageMode pageMode() const;
+        // Return the page-size configuration of this allocator.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class VirtualArenaAllocator
+                        // ---------------------------
+
+// ACCESSORS
+inline
+bsls::Types::size_type VirtualArenaAllocator::capacity() const
+{
+    return d_end_p - d_begin_p;
+}
+
+inline
+bsls::Types::size_type VirtualArenaAllocator::commitGranularity() const
+{
+    return d_commitGranularity;
+}
+
+inline
+VirtualArenaAllocator::PageMode VirtualArenaAllocator::pageMode() const
+{
+    return d_pageMode;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,781 @@
+// bdlma_virtualarenaallocator.t.cpp                                  -*-C++-*-
+#include <bdlma_virtualarenaallocator.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_new.h>         // 'bsl::bad_alloc'
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::VirtualArenaAllocator' is a thread-safe managed allocator that
+// dispenses memory, in increasing address order, from a single range of
+// virtual address space reserved at construction.  The primary concerns are
+// that blocks are maximally aligned and laid out contiguously, that memory is
+// committed lazily in units of the commit granularity, that deallocated
+// blocks are reclaimed in LIFO order, that 'rewind' and 'release' reset the
+// arena (the latter also decommitting its memory), and that exhausting the
+// reserved range is reported by throwing 'bsl::bad_alloc'.  Since the arena
+// obtains its memory directly from the system, we also verify that no memory
+// is taken from the default or global allocators.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] VirtualArenaAllocator(size_type capacity, PageMode m = e_SYSTEM_PAGES);
+// [ 2] ~VirtualArenaAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void release();
+// [ 4] void rewind();
+//
+// ACCESSORS
+// [ 2] size_type capacity() const;
+// [ 2] size_type commitGranularity() const;
+// [ 3] size_type numBytesCommitted() const;
+// [ 3] size_type numBytesInUse() const;
+// [ 2] PageMode pageMode() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: Sequential allocators grow contiguously within the arena.
+// [ 6] CONCURRENCY: 'allocate' and 'deallocate' are thread-safe.
+// [ 7] USAGE EXAMPLE
+// [ *] CONCERN: No memory is obtained from the default/global allocators.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::VirtualArenaAllocator Obj;
+typedef bsls::Types::size_type       size_type;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+// ============================================================================
+//                  HELPER FUNCTIONS AND TYPES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address) % k_MAX_ALIGN;
+}
+
+extern "C" void *churnThread(void *arg)
+    // Repeatedly allocate, fill, verify, and deallocate blocks from the
+    // 'Obj' at the specified 'arg'.
+{
+    Obj *obj = static_cast<Obj *>(arg);
+
+    for (int i = 0; i < 1000; ++i) {
+        const int      size = 1 + (i * 13) % 500;
+        unsigned char *p    = static_cast<unsigned char *>(
+                                                          obj->allocate(size));
+        ASSERT(isMaximallyAligned(p));
+
+        bsl::memset(p, i & 0xff, size);
+        for (int j = 0; j < size; ++j) {
+            ASSERTV(i, j, (i & 0xff) == p[j]);
+        }
+        obj->deallocate(p);
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: No memory is obtained from the default/global allocators.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Contiguous Request Arena
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that a service processes requests, each of which builds a large,
+// short-lived graph of objects that is discarded in its entirety when the
+// request completes.  A 'bdlma::SequentialAllocator' is a natural fit for
+// such data, but, for very large requests, its many upstream allocations are
+// scattered across the heap.  Instead, we supply the sequential allocator
+// with a virtual arena large enough for the biggest request we expect.
+//
+// First, we create a virtual arena reserving 64 megabytes of address space,
+// requesting huge pages:
+//..
+    bdlma::VirtualArenaAllocator arena(
+                                   64 * 1024 * 1024,
+                                   bdlma::VirtualArenaAllocator::e_HUGE_PAGES);
+    ASSERT(64 * 1024 * 1024 == arena.capacity());
+    ASSERT(               0 == arena.numBytesInUse());
+//..
+// Then, we create a sequential allocator that obtains its buffers from the
+// arena, and use it to process a request:
+//..
+    {
+        bdlma::SequentialAllocator requestAllocator(&arena);
+
+        for (int i = 0; i < 1000; ++i) {
+            requestAllocator.allocate(1024);
+        }
+        ASSERT(1000 * 1024 < arena.numBytesInUse());
+//..
+// Next, we discard the request's data.  The sequential allocator returns all
+// of its buffers to the arena, so the arena's cursor rewinds to the start of
+// the range:
+//..
+        requestAllocator.release();
+        ASSERT(0 == arena.numBytesInUse());
+    }
+//..
+// Finally, when the service goes idle we return the physical memory committed
+// by the arena to the operating system, while keeping the address range
+// reserved for the next burst of requests:
+//..
+    arena.release();
+    ASSERT(0 == arena.numBytesInUse());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 'allocate' and 'deallocate' may be called concurrently from
+        //:   several threads, and each thread has exclusive use of the blocks
+        //:   it allocated.
+        //:
+        //: 2 Once every thread has deallocated all of its blocks, the arena
+        //:   is empty.
+        //
+        // Plan:
+        //: 1 Start several threads that repeatedly allocate a block, fill it
+        //:   with a thread- and iteration-specific value, verify the contents,
+        //:   and deallocate it.  Once the threads are joined, verify that no
+        //:   bytes are in use.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY: 'allocate' and 'deallocate' are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENCY\n"
+                             "===========\n";
+
+        enum { k_NUM_THREADS = 4 };
+
+        Obj mX(16 * 1024 * 1024);  const Obj& X = mX;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  churnThread,
+                                                  &mX));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        ASSERTV(X.numBytesInUse(), 0 == X.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: SEQUENTIAL ALLOCATORS GROW CONTIGUOUSLY
+        //
+        // Concerns:
+        //: 1 The buffers obtained by a 'bdlma::SequentialAllocator' are laid
+        //:   out one after another within the arena.
+        //:
+        //: 2 'release' on a sequential allocator returns the arena's cursor to
+        //:   where it was before the sequential allocator obtained its first
+        //:   buffer, while 'rewind' retains (and reuses) the buffers.
+        //:
+        //: 3 The same holds for a 'bdlma::BufferedSequentialAllocator' that
+        //:   overflows its initial buffer into the arena.
+        //
+        // Plan:
+        //: 1 Create a sequential allocator on an arena, allocate enough to
+        //:   force several buffers to be obtained, and verify that the
+        //:   addresses returned are increasing and that the arena's usage is
+        //:   bounded by the total buffer sizes plus per-block overhead.  Then
+        //:   'rewind' and 'release' the sequential allocator and verify the
+        //:   arena is empty.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for a buffered sequential allocator.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Sequential allocators grow contiguously within the arena.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCERN: SEQUENTIAL ALLOCATORS GROW "
+                             "CONTIGUOUSLY\n"
+                             "===================================="
+                             "============\n";
+
+        Obj mX(32 * 1024 * 1024);  const Obj& X = mX;
+
+        if (veryVerbose) cout << "\t'bdlma::SequentialAllocator'" << endl;
+        {
+            void *outer = mX.allocate(100);  // outstanding block below the
+                                             // sequential allocator's buffers
+
+            const size_type BASE = X.numBytesInUse();
+
+            bdlma::SequentialAllocator mY(&mX);
+
+            char *prev = 0;
+            for (int i = 0; i < 2000; ++i) {
+                char *p = static_cast<char *>(mY.allocate(1000));
+                ASSERTV(i, prev < p);
+                ASSERTV(i, X.numBytesInUse() > BASE);
+                prev = p;
+            }
+
+            // The arena spans the sequential allocator's buffers, which
+            // (growing geometrically) are at most about twice the memory
+            // requested.
+
+            ASSERTV(X.numBytesInUse(),
+                    X.numBytesInUse() - BASE < 2 * 2000 * 1000 + 64 * 1024);
+
+            // 'rewind' retains the sequential allocator's buffers, which are
+            // reused by subsequent allocations.
+
+            const size_type IN_USE = X.numBytesInUse();
+
+            mY.rewind();
+            ASSERTV(X.numBytesInUse(), IN_USE == X.numBytesInUse());
+
+            mY.allocate(50000);
+            ASSERTV(X.numBytesInUse(), IN_USE == X.numBytesInUse());
+
+            mY.release();
+            ASSERTV(X.numBytesInUse(), BASE == X.numBytesInUse());
+
+            mX.deallocate(outer);
+            ASSERT(0 == X.numBytesInUse());
+        }
+
+        if (veryVerbose) cout << "\t'bdlma::BufferedSequentialAllocator'"
+                              << endl;
+        {
+            char buffer[256];
+
+            bdlma::BufferedSequentialAllocator mY(buffer, sizeof buffer, &mX);
+
+            mY.allocate(128);
+            ASSERT(0 == X.numBytesInUse());
+
+            char *prev = 0;
+            for (int i = 0; i < 100; ++i) {
+                char *p = static_cast<char *>(mY.allocate(4096));
+                ASSERTV(i, prev < p);
+                ASSERTV(i, p <  buffer || buffer + sizeof buffer <= p);
+                prev = p;
+            }
+            ASSERT(0 < X.numBytesInUse());
+
+            mY.release();
+            ASSERTV(X.numBytesInUse(), 0 == X.numBytesInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'rewind' AND 'release'
+        //
+        // Concerns:
+        //: 1 'rewind' makes the entire arena available for allocation without
+        //:   decommitting any memory, so the next allocation reuses the start
+        //:   of the arena.
+        //:
+        //: 2 'release' makes the entire arena available for allocation and
+        //:   decommits all memory.
+        //:
+        //: 3 The arena is fully usable after 'rewind' and 'release', and
+        //:   memory re-committed after 'release' is writable.
+        //:
+        //: 4 'rewind' and 'release' on an empty arena have no effect.
+        //
+        // Plan:
+        //: 1 Allocate a number of blocks, 'rewind', and verify that nothing
+        //:   is in use, that the committed size is unchanged, and that the
+        //:   next allocation returns the first address.  (C-1, 3)
+        //:
+        //: 2 Repeat P-1 using 'release', verifying that nothing remains
+        //:   committed, and write to the block allocated afterwards.  (C-2..3)
+        //:
+        //: 3 Call 'rewind' and 'release' on an empty arena.  (C-4)
+        //
+        // Testing:
+        //   void release();
+        //   void rewind();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'rewind' AND 'release'\n"
+                             "==============================\n";
+
+        Obj mX(4 * 1024 * 1024);  const Obj& X = mX;
+
+        if (veryVerbose) cout << "\tEmpty arena." << endl;
+        {
+            mX.rewind();
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesCommitted());
+
+            mX.release();
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesCommitted());
+        }
+
+        void *first = mX.allocate(1);
+        mX.deallocate(first);
+
+        if (veryVerbose) cout << "\t'rewind'." << endl;
+        {
+            for (int i = 0; i < 100; ++i) {
+                mX.allocate(10000);
+            }
+            const size_type COMMITTED = X.numBytesCommitted();
+            ASSERT(100 * 10000 <= COMMITTED);
+
+            mX.rewind();
+            ASSERT(0         == X.numBytesInUse());
+            ASSERT(COMMITTED == X.numBytesCommitted());
+
+            ASSERT(first     == mX.allocate(1));
+            ASSERT(COMMITTED == X.numBytesCommitted());
+        }
+
+        if (veryVerbose) cout << "\t'release'." << endl;
+        {
+            for (int i = 0; i < 100; ++i) {
+                mX.allocate(10000);
+            }
+
+            mX.release();
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesCommitted());
+
+            char *p = static_cast<char *>(mX.allocate(100000));
+            ASSERT(first == p);
+            ASSERT(100000 <= X.numBytesCommitted());
+
+            bsl::memset(p, 0xab, 100000);
+            ASSERT('\xab' == p[99999]);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, writable blocks at
+        //:   increasing, non-overlapping addresses.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 Memory is committed lazily, in multiples of
+        //:   'commitGranularity()', and never beyond 'capacity()'.
+        //:
+        //: 4 Deallocating the most recently allocated block reclaims it, along
+        //:   with any already-deallocated blocks immediately preceding it;
+        //:   deallocating any other block reclaims nothing.
+        //:
+        //: 5 A request exceeding the unused capacity throws 'bsl::bad_alloc'
+        //:   and leaves the arena unchanged, while the whole capacity can be
+        //:   consumed.
+        //
+        // Plan:
+        //: 1 Allocate blocks of various sizes, verify alignment, ordering,
+        //:   and the accessors, and write to each block.  (C-1, 3)
+        //:
+        //: 2 Call 'allocate(0)' and 'deallocate(0)'.  (C-2)
+        //:
+        //: 3 Deallocate blocks out of order and verify 'numBytesInUse' after
+        //:   each deallocation.  (C-4)
+        //:
+        //: 4 Fill the arena to capacity, then request one more byte.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   size_type numBytesCommitted() const;
+        //   size_type numBytesInUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'allocate' AND 'deallocate'\n"
+                             "===================================\n";
+
+        if (veryVerbose) cout << "\tAlignment, ordering, and commit." << endl;
+        {
+            Obj mX(1024 * 1024);  const Obj& X = mX;
+
+            const size_type GRAN = X.commitGranularity();
+
+            static const int SIZES[] = { 1, 2, 7, 8, 15, 16, 33, 100, 1000,
+                                         4095, 4096, 4097, 70000, 200000 };
+            enum { k_NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+            char *prev    = 0;
+            int   prevLen = 0;
+            for (int i = 0; i < k_NUM_SIZES; ++i) {
+                const int  SIZE = SIZES[i];
+                char      *p    = static_cast<char *>(mX.allocate(SIZE));
+
+                ASSERTV(SIZE, isMaximallyAligned(p));
+                ASSERTV(SIZE, prev + prevLen <= p);
+                ASSERTV(SIZE, X.numBytesInUse() <= X.numBytesCommitted());
+                ASSERTV(SIZE, 0 == X.numBytesCommitted() % GRAN);
+                ASSERTV(SIZE, X.numBytesCommitted() <= X.capacity());
+
+                bsl::memset(p, SIZE & 0xff, SIZE);
+
+                prev    = p;
+                prevLen = SIZE;
+            }
+        }
+
+        if (veryVerbose) cout << "\tNull arguments." << endl;
+        {
+            Obj mX(1024 * 1024);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesCommitted());
+
+            mX.deallocate(0);
+            ASSERT(0 == X.numBytesInUse());
+        }
+
+        if (veryVerbose) cout << "\tLIFO reclamation." << endl;
+        {
+            Obj mX(1024 * 1024);  const Obj& X = mX;
+
+            void            *a  = mX.allocate(100);
+            const size_type  UA = X.numBytesInUse();
+            void            *b  = mX.allocate(100);
+            const size_type  UB = X.numBytesInUse();
+            void            *c  = mX.allocate(100);
+            const size_type  UC = X.numBytesInUse();
+            ASSERT(0 < UA);  ASSERT(UA < UB);  ASSERT(UB < UC);
+
+            mX.deallocate(b);                    // not the most recent
+            ASSERT(UC == X.numBytesInUse());
+
+            mX.deallocate(c);                    // reclaims 'c' and 'b'
+            ASSERT(UA == X.numBytesInUse());
+
+            ASSERT(b == mX.allocate(100));       // reuses 'b's address
+            ASSERT(UB == X.numBytesInUse());
+
+            mX.deallocate(a);                    // not the most recent
+            ASSERT(UB == X.numBytesInUse());
+
+            mX.deallocate(b);                    // reclaims everything
+            ASSERT(0 == X.numBytesInUse());
+        }
+
+        if (veryVerbose) cout << "\tExhaustion." << endl;
+        {
+            Obj mX(1024 * 1024);  const Obj& X = mX;
+
+            const size_type CAPACITY = X.capacity();
+            ASSERT(1024 * 1024 <= CAPACITY);
+
+            // Determine the per-block overhead from a small allocation.
+
+            void            *p        = mX.allocate(k_MAX_ALIGN);
+            const size_type  OVERHEAD = X.numBytesInUse() - k_MAX_ALIGN;
+            mX.deallocate(p);
+
+            char *big = static_cast<char *>(
+                                        mX.allocate(CAPACITY - OVERHEAD));
+            ASSERT(big);
+            ASSERT(CAPACITY == X.numBytesInUse());
+            ASSERT(CAPACITY == X.numBytesCommitted());
+
+            big[CAPACITY - OVERHEAD - 1] = 'x';
+
+            bool caught = false;
+            try {
+                mX.allocate(1);
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(CAPACITY == X.numBytesInUse());
+
+            mX.deallocate(big);
+            ASSERT(0 == X.numBytesInUse());
+
+            caught = false;
+            try {
+                mX.allocate(CAPACITY);
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == X.numBytesInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor reserves at least the requested capacity, which
+        //:   is a multiple of the commit granularity.
+        //:
+        //: 2 The page mode is recorded, and defaults to 'e_SYSTEM_PAGES'.
+        //:
+        //: 3 No memory is committed, or in use, on construction.
+        //:
+        //: 4 The commit granularity is a non-zero multiple of the alignment
+        //:   guaranteed by the allocator.
+        //:
+        //: 5 The destructor returns the reserved range even if blocks remain
+        //:   outstanding.
+        //
+        // Plan:
+        //: 1 Construct objects with a variety of capacities, with and without
+        //:   a page mode, and verify the accessors.  Allocate from each object
+        //:   before letting it go out of scope.  (C-1..5)
+        //
+        // Testing:
+        //   VirtualArenaAllocator(size_type capacity, PageMode m);
+        //   ~VirtualArenaAllocator();
+        //   size_type capacity() const;
+        //   size_type commitGranularity() const;
+        //   PageMode pageMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CREATORS AND BASIC ACCESSORS\n"
+                             "============================\n";
+
+        static const size_type CAPACITIES[] = {
+            1, 4096, 4097, 1024 * 1024, 3 * 1024 * 1024 + 1,
+            256 * 1024 * 1024
+        };
+        enum { k_NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES };
+
+        for (int i = 0; i < k_NUM_CAPACITIES; ++i) {
+            const size_type CAPACITY = CAPACITIES[i];
+
+            for (int mode = 0; mode < 3; ++mode) {
+                Obj *objPtr = 0;
+                switch (mode) {
+                  case 0: objPtr = new (defaultAllocator) Obj(CAPACITY);
+                    break;
+                  case 1: objPtr = new (defaultAllocator)
+                                         Obj(CAPACITY, Obj::e_SYSTEM_PAGES);
+                    break;
+                  case 2: objPtr = new (defaultAllocator)
+                                         Obj(CAPACITY, Obj::e_HUGE_PAGES);
+                    break;
+                }
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                const Obj::PageMode EXP_MODE = 2 == mode
+                                             ? Obj::e_HUGE_PAGES
+                                             : Obj::e_SYSTEM_PAGES;
+
+                if (veryVerbose) {
+                    T_ P_(CAPACITY) P_(mode)
+                    P_(X.capacity()) P(X.commitGranularity())
+                }
+
+                ASSERTV(CAPACITY, mode, EXP_MODE == X.pageMode());
+                ASSERTV(CAPACITY, mode, CAPACITY <= X.capacity());
+                ASSERTV(CAPACITY, mode, 0 < X.commitGranularity());
+                ASSERTV(CAPACITY, mode,
+                        0 == X.commitGranularity() % k_MAX_ALIGN);
+                ASSERTV(CAPACITY, mode,
+                        0 == X.capacity() % X.commitGranularity());
+                ASSERTV(CAPACITY, mode, 0 == X.numBytesCommitted());
+                ASSERTV(CAPACITY, mode, 0 == X.numBytesInUse());
+
+                void *p = mX.allocate(1);
+                ASSERTV(CAPACITY, mode, p);
+
+                defaultAllocator.deleteObject(objPtr);
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, allocate and deallocate a few blocks, and
+        //:   rewind and release it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        Obj mX(1024 * 1024);  const Obj& X = mX;
+
+        void *p1 = mX.allocate(5);
+        void *p2 = mX.allocate(100);
+        void *p3 = mX.allocate(100000);
+        ASSERT(p1);  ASSERT(p2);  ASSERT(p3);
+        ASSERT(p1 < p2);  ASSERT(p2 < p3);
+
+        bsl::memset(p3, 0, 100000);
+
+        mX.deallocate(p3);
+        mX.deallocate(p2);
+        ASSERT(p2 == mX.allocate(100));
+
+        mX.rewind();
+        ASSERT(0 == X.numBytesInUse());
+        ASSERT(p1 == mX.allocate(5));
+
+        mX.release();
+        ASSERT(0 == X.numBytesInUse());
+        ASSERT(0 == X.numBytesCommitted());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: No memory is obtained from the default/global allocators.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+    ASSERTV(defaultAllocator.numBlocksInUse(),
+            0 == defaultAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
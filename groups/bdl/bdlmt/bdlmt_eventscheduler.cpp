@@ -33,6 +33,14 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 // ensures that the events do not occur before the scheduled time on the clock
 // where the time was specified.
 
+// Implementation note: Unlike 'bdlmt::ThreadPool' and
+// 'bdlmt::FixedThreadPool', the scheduler does not use 'bdlf::InplaceFunction'
+// to hold callbacks.  Events are stored by value in 'bdlcc::SkipList' nodes,
+// which copy-construct their data, recurring events are invoked repeatedly
+// from the same node, and the public API accepts copyable
+// 'bsl::function<void()>' objects; a move-only callback type would not fit
+// any of these.
+
 // Implementation note: When casting, we often cast through 'void *' or
 // 'const void *' to avoid getting alignment warnings.
 
@@ -69,14 +69,18 @@ void FixedThreadPool::workerThread()
 {
     d_barrier.wait();  // initial synchronization in 'start'
 
-    Job functor;
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    InplaceJob functor;
+#else
+    Job        functor;
+#endif
 
     do {
         if (d_drainFlag) {
             d_barrier.wait();  // pool threads acknowledge drain
             d_barrier.wait();  // pool threads may proceed
         }
-        while (Queue::e_SUCCESS == d_queue.popFront(&functor)) {
+        while (JobQueue::e_SUCCESS == d_queue.popFront(&functor)) {
             d_numActiveThreads.addAcqRel(1);
             functor();
             functor = bsl::nullptr_t();  // ensure destructor is called
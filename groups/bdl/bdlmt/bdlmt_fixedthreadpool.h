@@ -321,9 +321,11 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>
 
 #include <bdlf_bind.h>
+#include <bdlf_inplacefunction.h>
 
 #include <bslma_allocator.h>
 
@@ -370,6 +372,14 @@ class FixedThreadPool {
     typedef bsl::function<void()>    Job;
     typedef bdlcc::BoundedQueue<Job> Queue;
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    typedef bdlf::InplaceFunction<void(), sizeof(Job) + 2 * sizeof(void *)>
+                                     InplaceJob;
+        // 'InplaceJob' is a move-only job type storing its functor within the
+        // job object itself, and therefore within the preallocated slots of
+        // the queue of pending jobs.
+#endif
+
     // PUBLIC CONSTANTS
     enum {
         e_SUCCESS  = Queue::e_SUCCESS,
@@ -396,13 +406,23 @@ class FixedThreadPool {
     };
 
   private:
+    // PRIVATE TYPES
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    typedef bdlcc::BoundedQueue<InplaceJob> JobQueue;
+        // 'JobQueue' is the type of the queue of pending jobs.  Note that it
+        // differs from the public 'Queue' type, which is retained for source
+        // compatibility.
+#else
+    typedef Queue                           JobQueue;
+#endif
+
     // PRIVATE CLASS DATA
     static const char       s_defaultThreadName[16];  // Thread name to use
                                                       // when none is
                                                       // specified.
 
     // PRIVATE DATA
-    Queue                   d_queue;              // underlying queue
+    JobQueue                d_queue;              // underlying queue
 
     bsls::AtomicInt         d_numActiveThreads;   // number of threads
                                                   // processing jobs
@@ -528,6 +548,29 @@ class FixedThreadPool {
         // and the underlying queue was full, and 'e_FAILED' if an error
         // occurs.  The behavior is undefined unless 'function' is not null.
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    int enqueueInplaceJob(bslmf::MovableRef<InplaceJob> functor);
+        // Enqueue the specified 'functor' to be executed by the next available
+        // thread, moving it into the queue without allocating memory.  Return
+        // 0 on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if '!isEnabled()', and
+        // 'e_FAILED' if an error occurs.  This operation will block if there
+        // is not sufficient capacity in the underlying queue until there is
+        // free capacity to successfully enqueue this job.  The behavior is
+        // undefined unless 'functor' is not empty.  Note that this method is
+        // named differently from 'enqueueJob' so that a lambda or other
+        // functor can be passed to either without ambiguity.
+
+    int tryEnqueueInplaceJob(bslmf::MovableRef<InplaceJob> functor);
+        // Enqueue the specified 'functor' to be executed by the next available
+        // thread, moving it into the queue without allocating memory.  Return
+        // 0 on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if '!isEnabled()', 'e_FULL' if
+        // 'isEnabled()' and the underlying queue was full, and 'e_FAILED' if
+        // an error occurs.  The behavior is undefined unless 'functor' is not
+        // empty.
+#endif
+
     void drain();
         // Wait until the underlying queue is empty without disabling this pool
         // (and may thus wait indefinitely), and then wait until all executing
@@ -614,7 +657,14 @@ int FixedThreadPool::enqueueJob(const Job& functor)
 {
     BSLS_ASSERT(functor);
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    return d_queue.pushBack(
+                   InplaceJob(Job(bsl::allocator_arg,
+                                  bsl::allocator<char>(d_queue.allocator()),
+                                  functor)));
+#else
     return d_queue.pushBack(functor);
+#endif
 }
 
 inline
@@ -622,7 +672,14 @@ int FixedThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
 {
     BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    return d_queue.pushBack(
+                   InplaceJob(Job(bsl::allocator_arg,
+                                  bsl::allocator<char>(d_queue.allocator()),
+                                  bslmf::MovableRefUtil::move(functor))));
+#else
     return d_queue.pushBack(bslmf::MovableRefUtil::move(functor));
+#endif
 }
 
 inline
@@ -639,7 +696,14 @@ int FixedThreadPool::tryEnqueueJob(const Job& functor)
 {
     BSLS_ASSERT(functor);
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    return d_queue.tryPushBack(
+                   InplaceJob(Job(bsl::allocator_arg,
+                                  bsl::allocator<char>(d_queue.allocator()),
+                                  functor)));
+#else
     return d_queue.tryPushBack(functor);
+#endif
 }
 
 inline
@@ -647,7 +711,14 @@ int FixedThreadPool::tryEnqueueJob(bslmf::MovableRef<Job> functor)
 {
     BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    return d_queue.tryPushBack(
+                   InplaceJob(Job(bsl::allocator_arg,
+                                  bsl::allocator<char>(d_queue.allocator()),
+                                  bslmf::MovableRefUtil::move(functor))));
+#else
     return d_queue.tryPushBack(bslmf::MovableRefUtil::move(functor));
+#endif
 }
 
 inline
@@ -659,6 +730,25 @@ int FixedThreadPool::tryEnqueueJob(FixedThreadPoolJobFunc  function,
     return tryEnqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
 }
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+inline
+int FixedThreadPool::enqueueInplaceJob(bslmf::MovableRef<InplaceJob> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    return d_queue.pushBack(bslmf::MovableRefUtil::move(functor));
+}
+
+inline
+int FixedThreadPool::tryEnqueueInplaceJob(
+                                         bslmf::MovableRef<InplaceJob> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    return d_queue.tryPushBack(bslmf::MovableRefUtil::move(functor));
+}
+#endif
+
 inline
 void FixedThreadPool::drain()
 {
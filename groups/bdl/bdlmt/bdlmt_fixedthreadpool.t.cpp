@@ -13,6 +13,9 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_testutil.h>
@@ -23,6 +26,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
+#include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
@@ -87,6 +91,8 @@ using bsl::flush;
 // [ 4] int queueCapacity() const;
 // [ 4] int numThreadsStarted() const;
 // [ 5] int tryEnqueueJob(FixedThreadPoolJobFunc, void *);
+// [19] int enqueueInplaceJob(bslmf::MovableRef<InplaceJob>);
+// [19] int tryEnqueueInplaceJob(bslmf::MovableRef<InplaceJob>);
 // ----------------------------------------------------------------------------
 // [ 2] TESTING HELPER FUNCTIONS
 // [ 2] Breathing test
@@ -164,6 +170,10 @@ void aSsErT(bool condition, const char *message, int line)
 
 typedef bdlmt::FixedThreadPool Obj;
 
+BSLMF_ASSERT((bsl::is_same<Obj::Queue,
+                           bdlcc::BoundedQueue<Obj::Job> >::value));
+    // 'Queue' is part of the public interface and must not change.
+
 const int k_DECISECOND = 100000;  // microseconds in 0.1 seconds
 
 #if defined(BSLS_PLATFORM_OS_WINDOWS) || defined(BSLS_PLATFORM_OS_AIX)
@@ -720,6 +730,50 @@ void CopyCountingFunctor::operator()()
 
 }  // close namespace FIXEDTHREADPOOL_USAGE
 
+// ============================================================================
+//                         CASE 19 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+namespace FIXEDTHREADPOOL_CASE_19 {
+
+class MoveOnlyRecordingJob {
+    // A move-only functor, larger than the small-object buffer of a
+    // 'bsl::function', that appends a value to a vector when invoked.
+
+    // DATA
+    bsl::vector<int> *d_results_p;  // vector to append to (held)
+    int               d_value;      // value to append
+    void             *d_padding[6]; // make this functor large
+
+  public:
+    // CREATORS
+    MoveOnlyRecordingJob(bsl::vector<int> *results, int value)
+        // Create a functor that appends the specified 'value' to the
+        // specified 'results' when invoked.
+    : d_results_p(results)
+    , d_value(value)
+    {
+        bsl::fill(d_padding, d_padding + 6, static_cast<void *>(0));
+    }
+
+    MoveOnlyRecordingJob(MoveOnlyRecordingJob&&) = default;
+        // Create a functor having the value of the specified object.
+
+    MoveOnlyRecordingJob(const MoveOnlyRecordingJob&) = delete;
+    MoveOnlyRecordingJob& operator=(const MoveOnlyRecordingJob&) = delete;
+
+    // MANIPULATORS
+    void operator()()
+        // Append the value of this functor to the vector of results.
+    {
+        d_results_p->push_back(d_value);
+    }
+};
+
+}  // close namespace FIXEDTHREADPOOL_CASE_19
+#endif
+
 // ============================================================================
 //                         CASE 14 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -959,6 +1013,117 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING 'enqueueInplaceJob' AND 'tryEnqueueInplaceJob'
+        //
+        // Concerns:
+        //: 1 Both methods accept move-only functors, move them into the queue,
+        //:   and leave the argument empty.
+        //:
+        //: 2 Neither method allocates memory.
+        //:
+        //: 3 'tryEnqueueInplaceJob' returns 'e_FULL' when the queue is full,
+        //:   and 'enqueueInplaceJob' returns 'e_DISABLED' when the pool is
+        //:   disabled, leaving the argument unchanged in both cases.
+        //:
+        //: 4 Jobs are run in the order in which they are enqueued.
+        //
+        // Plan:
+        //: 1 Block the single thread of a pool, fill its queue with move-only
+        //:   jobs recording their index using 'tryEnqueueInplaceJob', and
+        //:   verify that the arguments are left empty and that no memory is
+        //:   allocated.  Verify that one more job is rejected.  (C-1..3)
+        //:
+        //: 2 Unblock the thread, enqueue more jobs with 'enqueueInplaceJob',
+        //:   drain the pool and verify the order in which the jobs were run.
+        //:   (C-1, 4)
+        //:
+        //: 3 Stop the pool and verify that 'enqueueInplaceJob' fails without
+        //:   modifying its argument.  (C-3)
+        //
+        // Testing:
+        //   int enqueueInplaceJob(bslmf::MovableRef<InplaceJob>);
+        //   int tryEnqueueInplaceJob(bslmf::MovableRef<InplaceJob>);
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << "TESTING 'enqueueInplaceJob' AND 'tryEnqueueInplaceJob'\n"
+                    "======================================================\n";
+        }
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+        using FIXEDTHREADPOOL_CASE_19::MoveOnlyRecordingJob;
+
+        const int k_CAPACITY = 8;
+
+        bsl::vector<int> results(&testAllocator);
+        results.reserve(2 * k_CAPACITY);
+
+        bslmt::Barrier barrier(2);
+
+        Obj mX(1, k_CAPACITY, &testAllocator);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&bslmt::Barrier::wait,
+                                                       &barrier)));
+
+        // Wait until the job is running, and therefore no longer occupies a
+        // slot in the queue.  (The job is no longer counted as pending as
+        // soon as it is claimed, before its slot is released.)
+
+        while (1 != X.numActiveThreads()) {
+            bslmt::ThreadUtil::yield();
+        }
+
+        const bsls::Types::Int64 numAllocations =
+                                                testAllocator.numAllocations();
+        const bsls::Types::Int64 numDefaultAllocations =
+                                                    taDefault.numAllocations();
+
+        for (int i = 0; i < k_CAPACITY; ++i) {
+            Obj::InplaceJob job(MoveOnlyRecordingJob(&results, i));
+
+            ASSERTV(i, Obj::e_SUCCESS == mX.tryEnqueueInplaceJob(
+                                          bslmf::MovableRefUtil::move(job)));
+            ASSERTV(i, !job);
+        }
+        {
+            Obj::InplaceJob job(MoveOnlyRecordingJob(&results, -1));
+
+            ASSERT(Obj::e_FULL == mX.tryEnqueueInplaceJob(
+                                          bslmf::MovableRefUtil::move(job)));
+            ASSERT(job);
+        }
+
+        ASSERT(numAllocations        == testAllocator.numAllocations());
+        ASSERT(numDefaultAllocations == taDefault.numAllocations());
+
+        barrier.wait();
+
+        for (int i = k_CAPACITY; i < 2 * k_CAPACITY; ++i) {
+            Obj::InplaceJob job(MoveOnlyRecordingJob(&results, i));
+
+            ASSERTV(i, Obj::e_SUCCESS == mX.enqueueInplaceJob(
+                                          bslmf::MovableRefUtil::move(job)));
+            ASSERTV(i, !job);
+        }
+
+        mX.drain();
+
+        ASSERTV(results.size(), 2 * k_CAPACITY == results.size());
+        for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+            ASSERTV(i, results[i], i == results[i]);
+        }
+
+        mX.stop();
+
+        Obj::InplaceJob job(MoveOnlyRecordingJob(&results, -1));
+        ASSERT(Obj::e_DISABLED == mX.enqueueInplaceJob(
+                                          bslmf::MovableRefUtil::move(job)));
+        ASSERT(job);
+#endif
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // DRQS 167232024: 'drain' FAILS TO WAIT FOR ALL JOBS TO FINISH
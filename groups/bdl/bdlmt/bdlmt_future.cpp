@@ -0,0 +1,33 @@
+// bdlmt_future.cpp                                                   -*-C++-*-
+#include <bdlmt_future.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_future_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// A continuation registered with the shared state of a future holds a copy of
+// that future, and therefore a reference to the state, until it is invoked;
+// similarly, the callbacks registered by 'FutureUtil::whenAll' refer (through
+// the gathering object) to the states of all of its inputs.  These reference
+// cycles are broken when the state becomes ready, because the callbacks are
+// released as soon as they have been invoked, and a promise that is destroyed
+// without a value or error makes its state ready.  Hence, a state is freed
+// once its promise, its futures, and the continuations referring to it are
+// gone.
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1560 @@
+// bdlmt_future.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_FUTURE
+#define INCLUDED_BDLMT_FUTURE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide futures and promises with continuations run on executors.
+//
+//@CLASSES:
+//  bdlmt::Future: handle to a value, or error status, that may not be ready
+//  bdlmt::Promise: mechanism making the value of its futures ready
+//  bdlmt::FutureUtil: namespace for creating and combining futures
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool,
+//           bdlmt_workstealingthreadpool
+//
+//@DESCRIPTION: This component provides a class template, 'bdlmt::Future',
+// that refers to a value of its parameterized 'TYPE' that may be computed
+// asynchronously, a class template, 'bdlmt::Promise', through which the value
+// of its futures is made ready, and a 'struct', 'bdlmt::FutureUtil', providing
+// functions that create ready futures and that combine futures.
+//
+// A future becomes *ready* when its promise is given either a value (with
+// 'setValue') or a non-zero error status (with 'setError').  If a promise is
+// destroyed before it is given either, its futures become ready with the
+// status 'bdlmt::FutureUtil::e_BROKEN_PROMISE'.  Copies of a future share its
+// state, so that every copy becomes ready at once, and the value of a ready
+// future may be accessed concurrently from any number of threads.
+//
+///Continuations
+///-------------
+// Work that depends on the result of a future is best expressed as a
+// *continuation*, rather than by blocking a thread in 'get' or 'wait'.  The
+// 'then' method of a future takes a function that is invoked with the future
+// once it is ready, and returns a future for the result of that function.
+// The function is invoked whether the future holds a value or an error, so
+// that it may handle (or forward) the error, and is invoked exactly once:
+//
+//: o by the thread calling 'then', if the future is already ready, or
+//:
+//: o by the thread making the future ready, otherwise.
+//
+// Alternatively, 'then' may be passed an *executor*, on which a job invoking
+// the function is enqueued once the future is ready.  An executor may be a
+// 'bdlmt::FixedThreadPool', a 'bdlmt::ThreadPool', a
+// 'bdlmt::WorkStealingThreadPool', or any other type providing:
+//..
+//  int enqueueJob(const bsl::function<void()>& job);
+//      // Enqueue the specified 'job' to be executed.  Return 0 on success,
+//      // and a non-zero value otherwise.
+//..
+// If the executor fails to enqueue the job (for example, because the pool was
+// stopped), the function is invoked in the thread that made the future ready,
+// so that a chain of continuations is never abandoned.
+//
+// No thread blocks in a chain of continuations: a continuation is registered
+// with, and later run by, the shared state of its future, and the only
+// synchronization is a short critical section when a future becomes ready or
+// a continuation is registered.  A function returning 'void' yields a
+// 'bdlmt::Future<bslmf::Nil>'.
+//
+// If a continuation throws an exception, the exception is caught, and the
+// future returned by 'then' is made ready with the status
+// 'bdlmt::FutureUtil::e_CONTINUATION_EXCEPTION', so that the threads waiting
+// on that future, and the continuations attached to it, are not abandoned.
+// The exception object itself is not preserved.
+//
+// Note that a continuation attached without an executor makes its own
+// future ready from within its invocation, which in turn invokes the
+// continuations attached to that future.  Making the first future of a chain
+// of pending continuations ready therefore runs the whole chain inline and
+// recursively, using stack space proportional to the length of the chain.  A
+// very long chain (for example, one built by calling 'then' in a loop) may
+// overflow the stack of the thread making the first future ready, and should
+// instead pass an executor to 'then' for at least some of its links.
+//
+///Ready Futures
+///-------------
+// A future may be created already holding a value (with the value constructor
+// or 'bdlmt::FutureUtil::makeReady') or an error status (with
+// 'bdlmt::FutureUtil::makeError').  Such a future holds its value itself and
+// allocates no shared state, and calling 'then' without an executor on such a
+// future invokes the function immediately and returns a ready future, again
+// without allocating shared state.  This makes it inexpensive to return a
+// future from a function that usually (for example, on a cache hit) has its
+// result at hand.
+//
+///Combinators
+///-----------
+// 'bdlmt::FutureUtil::whenAll' returns a future that becomes ready once every
+// future in a range is ready, holding a 'bsl::vector' of their values, or the
+// first non-zero status (in the order of the range) if any of them failed.
+// 'bdlmt::FutureUtil::whenAny' returns a future that becomes ready once any
+// future in a range is ready, holding the index of that future in the range.
+//
+///Memory Allocation
+///-----------------
+// The shared state of a future, the value it holds, and the continuations
+// registered with it are allocated by the allocator supplied to the promise
+// (or to the combinator), or by the default allocator if none is supplied.
+// The futures returned by 'then' use the allocator of the future on which
+// 'then' is called.
+//
+///Thread Safety
+///-------------
+// The 'const' methods of 'bdlmt::Future' may be called concurrently on the
+// same object, and 'setValue' and 'setError' may be called on a
+// 'bdlmt::Promise' concurrently with any method of its futures.  A promise
+// must be given a value or error at most once.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Combining Asynchronous Results
+///- - - - - - - - - - - - - - - - - - - - -
+// In this example we compute two prices on a thread pool, and then compute
+// their total on the same pool once both are available, without blocking any
+// thread of the pool.
+//
+// First, we define a function that computes a price and makes it the value of
+// a promise:
+//..
+//  void computePrice(bdlmt::Promise<double> *promise, double base)
+//      // Set the value of the specified 'promise' to the price computed from
+//      // the specified 'base'.
+//  {
+//      promise->setValue(base * 1.25);
+//  }
+//..
+// Then, we define the continuation that totals the prices, or returns a
+// negative value if either could not be computed:
+//..
+//  struct TotalPrice {
+//      // TYPES
+//      typedef double result_type;
+//
+//      // ACCESSORS
+//      double operator()(
+//                    const bdlmt::Future<bsl::vector<double> >& prices) const
+//      {
+//          if (0 != prices.status()) {
+//              return -1.0;                                          // RETURN
+//          }
+//          return bsl::accumulate(prices.value().begin(),
+//                                 prices.value().end(),
+//                                 0.0);
+//      }
+//  };
+//..
+// Note that the 'result_type' is needed only by C++03 compilers, which cannot
+// otherwise deduce the type of the future returned by 'then'.
+//
+// Next, we create and start a pool, and create the promises and the jobs
+// that fulfill them:
+//..
+//  bdlmt::FixedThreadPool pool(2, 100);
+//  pool.start();
+//
+//  bdlmt::Promise<double> first;
+//  bdlmt::Promise<double> second;
+//
+//  bsl::vector<bdlmt::Future<double> > prices;
+//  prices.push_back(first.future());
+//  prices.push_back(second.future());
+//
+//  pool.enqueueJob(bdlf::BindUtil::bind(&computePrice, &first, 100.0));
+//  pool.enqueueJob(bdlf::BindUtil::bind(&computePrice, &second, 60.0));
+//..
+// Then, we combine the futures, and arrange for the total to be computed on
+// the pool once both prices are ready:
+//..
+//  bdlmt::Future<double> total =
+//                bdlmt::FutureUtil::whenAll(prices.begin(), prices.end())
+//                                                  .then(&pool, TotalPrice());
+//..
+// Finally, we wait for the total (which only the thread that consumes the
+// final result needs to do), and stop the pool:
+//..
+//  assert(200.0 == total.get());
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_decay.h>
+#include <bslmf_invokeresult.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_nil.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+template <class TYPE> class Future;
+template <class TYPE> class Promise;
+struct FutureUtil;
+
+                             // ==================
+                             // class Future_State
+                             // ==================
+
+template <class TYPE>
+class Future_State {
+    // This component-private class template provides the state shared by a
+    // promise and its futures: the value (or error status), once ready, and
+    // the callbacks to be invoked when it becomes ready.
+
+    // DATA
+    bsls::ObjectBuffer<TYPE>             d_value;        // value, if ready
+                                                         // with status 0
+
+    int                                  d_status;       // status, if ready
+
+    bsls::AtomicBool                     d_isReady;      // 'true' once the
+                                                         // value or status is
+                                                         // set
+
+    mutable int                          d_numWaiters;   // number of threads
+                                                         // blocked in 'wait'
+
+    bsl::function<void()>                d_firstCallback;
+                                                         // first callback to
+                                                         // invoke when ready,
+                                                         // held separately as
+                                                         // most states have
+                                                         // only one
+
+    bsl::vector<bsl::function<void()> >  d_callbacks;    // other callbacks
+                                                         // to invoke when
+                                                         // ready
+
+    mutable bslmt::Mutex                 d_mutex;        // protects all but
+                                                         // 'd_value'
+
+    mutable bslmt::Condition             d_condition;    // signaled when
+                                                         // ready
+
+    bslma::Allocator                    *d_allocator_p;  // memory allocator
+                                                         // (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    void complete();
+        // Mark this state as ready, wake any thread blocked in 'wait', and
+        // invoke (and release) the registered callbacks.
+
+  private:
+    // NOT IMPLEMENTED
+    Future_State(const Future_State&);
+    Future_State& operator=(const Future_State&);
+
+  public:
+    // CREATORS
+    explicit Future_State(bslma::Allocator *basicAllocator);
+        // Create a state that is not ready, using the specified
+        // 'basicAllocator' to supply memory.
+
+    ~Future_State();
+        // Destroy this object.
+
+    // MANIPULATORS
+    template <class CALLBACK>
+    void addCallback(const CALLBACK& callback);
+        // Invoke a copy of the specified 'callback' once this state is ready:
+        // now, if it is already ready, and otherwise in the thread that makes
+        // it ready.
+
+    void setError(int status);
+        // Make this state ready with the specified error 'status'.  The
+        // behavior is undefined unless '0 != status' and this state is not
+        // ready.
+
+    void setValue(const TYPE& value);
+        // Make this state ready with the specified 'value'.  The behavior is
+        // undefined unless this state is not ready.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bool isReady() const;
+        // Return 'true' if this state is ready, and 'false' otherwise.
+
+    int status() const;
+        // Return the status of this state.  The behavior is undefined unless
+        // this state is ready.
+
+    const TYPE& value() const;
+        // Return a reference providing non-modifiable access to the value of
+        // this state.  The behavior is undefined unless this state is ready
+        // and '0 == status()'.
+
+    void wait() const;
+        // Block until this state is ready.
+};
+
+                           // =====================
+                           // struct Future_Invoker
+                           // =====================
+
+template <class RESULT>
+struct Future_Invoker {
+    // This component-private 'struct' template invokes a continuation whose
+    // result has the parameterized 'RESULT' type, and provides the type of
+    // the value of the future holding that result.
+
+    // TYPES
+    typedef RESULT ValueType;
+
+    // CLASS METHODS
+    template <class FUNCTION, class ARGUMENT>
+    static ValueType invoke(FUNCTION& function, const ARGUMENT& argument);
+        // Return the result of invoking the specified 'function' with the
+        // specified 'argument'.
+};
+
+template <>
+struct Future_Invoker<void> {
+    // This specialization of 'Future_Invoker' invokes a continuation
+    // returning 'void', whose future holds a 'bslmf::Nil'.
+
+    // TYPES
+    typedef bslmf::Nil ValueType;
+
+    // CLASS METHODS
+    template <class FUNCTION, class ARGUMENT>
+    static ValueType invoke(FUNCTION& function, const ARGUMENT& argument);
+        // Invoke the specified 'function' with the specified 'argument', and
+        // return a 'bslmf::Nil'.
+};
+
+                          // ========================
+                          // struct Future_ThenResult
+                          // ========================
+
+template <class FUNCTION, class TYPE>
+struct Future_ThenResult {
+    // This component-private 'struct' template provides the types of the
+    // result of invoking a continuation of the parameterized 'FUNCTION' type
+    // with a 'Future<TYPE>', and of the value of the future holding it.
+
+    // TYPES
+    typedef typename bsl::decay<
+                typename bsl::invoke_result<FUNCTION&,
+                                            const Future<TYPE>&>::type>::type
+                                                              InvokeResultType;
+
+    typedef Future_Invoker<InvokeResultType>                  Invoker;
+
+    typedef typename Invoker::ValueType                       ValueType;
+};
+
+                         // =========================
+                         // class Future_Continuation
+                         // =========================
+
+template <class TYPE, class FUNCTION>
+class Future_Continuation {
+    // This component-private class template provides a callback that invokes
+    // a continuation with a ready future, and makes the state of the future
+    // returned by 'then' ready with the result.
+
+    // PRIVATE TYPES
+    typedef Future_ThenResult<FUNCTION, TYPE>  ThenResult;
+    typedef typename ThenResult::ValueType     ResultType;
+
+    // DATA
+    Future<TYPE>                             d_source;    // ready future
+    FUNCTION                                 d_function;  // continuation
+    bsl::shared_ptr<Future_State<ResultType> >
+                                             d_result;    // state of result
+
+  public:
+    // CREATORS
+    Future_Continuation(
+                    const Future<TYPE>&                               source,
+                    const FUNCTION&                                   function,
+                    const bsl::shared_ptr<Future_State<ResultType> >& result);
+        // Create a callback that invokes a copy of the specified 'function'
+        // with the specified 'source' and makes the specified 'result' ready
+        // with the value returned.
+
+    // MANIPULATORS
+    void operator()();
+        // Invoke the continuation held by this object and make the result
+        // state ready with the value returned, or with the status
+        // 'FutureUtil::e_CONTINUATION_EXCEPTION' if the continuation throws.
+};
+
+                          // =======================
+                          // class Future_Dispatcher
+                          // =======================
+
+template <class EXECUTOR, class JOB>
+class Future_Dispatcher {
+    // This component-private class template provides a callback that enqueues
+    // a job on an executor, or invokes the job if the executor rejects it.
+
+    // DATA
+    EXECUTOR         *d_executor_p;   // executor (held, not owned)
+    JOB               d_job;          // job to enqueue
+    bslma::Allocator *d_allocator_p;  // allocator for the enqueued job (held,
+                                      // not owned)
+
+  public:
+    // CREATORS
+    Future_Dispatcher(EXECUTOR         *executor,
+                      const JOB&        job,
+                      bslma::Allocator *basicAllocator);
+        // Create a callback that enqueues a copy of the specified 'job' on
+        // the specified 'executor', using the specified 'basicAllocator' to
+        // supply memory for the enqueued job.
+
+    // MANIPULATORS
+    void operator()();
+        // Enqueue the job held by this object on its executor, or invoke the
+        // job if it cannot be enqueued.
+};
+
+                                // ============
+                                // class Future
+                                // ============
+
+template <class TYPE>
+class Future {
+    // This class template provides a handle to a value of the parameterized
+    // 'TYPE', or to an error status, that is made ready by a 'Promise' or is
+    // ready on creation.  Copies of a future share the state of the original.
+
+    // DATA
+    bsl::shared_ptr<Future_State<TYPE> >  d_state;        // shared state, or
+                                                          // empty if this
+                                                          // future is invalid
+                                                          // or held its value
+                                                          // on creation
+
+    bsls::ObjectBuffer<TYPE>              d_value;        // value held by
+                                                          // this future, if
+                                                          // 'd_hasValue'
+
+    bool                                  d_hasValue;     // 'true' if this
+                                                          // future holds its
+                                                          // own value
+
+    int                                   d_status;       // error status held
+                                                          // by this future,
+                                                          // or 0
+
+    bslma::Allocator                     *d_allocator_p;  // memory allocator
+                                                          // (held, not owned)
+
+    // FRIENDS
+    template <class OTHER_TYPE> friend class Future;
+    friend class Promise<TYPE>;
+    friend struct FutureUtil;
+
+    // PRIVATE CREATORS
+    Future(const bsl::shared_ptr<Future_State<TYPE> >&  state,
+           bslma::Allocator                            *basicAllocator);
+        // Create a future sharing the specified 'state', using the specified
+        // 'basicAllocator' to supply memory.
+
+    // PRIVATE ACCESSORS
+    template <class CALLBACK>
+    void addCallback(const CALLBACK& callback) const;
+        // Invoke a copy of the specified 'callback' once this future is
+        // ready.  The behavior is undefined unless this future is valid.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Future, bslma::UsesBslmaAllocator);
+
+    // TYPES
+    typedef TYPE ValueType;
+
+    // CREATORS
+    explicit Future(bslma::Allocator *basicAllocator = 0);
+        // Create an invalid future, which will never be ready.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    explicit Future(const TYPE&       value,
+                    bslma::Allocator *basicAllocator = 0);
+        // Create a ready future holding a copy of the specified 'value',
+        // without allocating shared state.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    Future(const Future& original, bslma::Allocator *basicAllocator = 0);
+        // Create a future sharing the state of the specified 'original'
+        // future (or, if 'original' holds its own value or status, holding a
+        // copy of it).  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    ~Future();
+        // Destroy this object.
+
+    // MANIPULATORS
+    Future& operator=(const Future& rhs);
+        // Make this future share the state of the specified 'rhs' future (or
+        // hold a copy of its value or status), and return a reference
+        // providing modifiable access to this future.
+
+    // ACCESSORS
+    bool isReady() const;
+        // Return 'true' if this future is ready, and 'false' otherwise.
+
+    bool isValid() const;
+        // Return 'true' if this future is valid (i.e., it was not created by
+        // the default constructor, or was since assigned a valid future), and
+        // 'false' otherwise.
+
+    const TYPE& get() const;
+        // Block until this future is ready, and return a reference providing
+        // non-modifiable access to its value.  The behavior is undefined
+        // unless this future is valid and becomes ready with status 0.
+
+    int status() const;
+        // Return 0 if this future holds a value, and the non-zero error
+        // status with which it was made ready otherwise.  The behavior is
+        // undefined unless this future is ready.
+
+    template <class FUNCTION>
+    Future<typename Future_ThenResult<FUNCTION, TYPE>::ValueType>
+    then(FUNCTION function) const;
+        // Return a future for the result of invoking the specified 'function'
+        // with this future once it is ready: immediately in this thread, if
+        // this future is ready, and otherwise in the thread that makes it
+        // ready.  'function' must be invocable with a 'const Future<TYPE>&';
+        // if it returns 'void', the returned future holds a 'bslmf::Nil', and
+        // if it throws, the returned future has the status
+        // 'FutureUtil::e_CONTINUATION_EXCEPTION'.  The behavior is undefined
+        // unless this future is valid.  See {Continuations} for the stack
+        // usage of chains of continuations invoked in this way.
+
+    template <class EXECUTOR, class FUNCTION>
+    Future<typename Future_ThenResult<FUNCTION, TYPE>::ValueType>
+    then(EXECUTOR *executor, FUNCTION function) const;
+        // Return a future for the result of invoking the specified 'function'
+        // with this future in a job enqueued on the specified 'executor' once
+        // this future is ready, or, if the job cannot be enqueued, in the
+        // thread that makes this future ready.  'function' must be invocable
+        // with a 'const Future<TYPE>&'; if it returns 'void', the returned
+        // future holds a 'bslmf::Nil', and if it throws, the returned future
+        // has the status 'FutureUtil::e_CONTINUATION_EXCEPTION'.  The
+        // behavior is undefined unless this future is valid.  See
+        // {Continuations} for the requirements on 'EXECUTOR'.
+
+    const TYPE& value() const;
+        // Return a reference providing non-modifiable access to the value of
+        // this future.  The behavior is undefined unless this future is ready
+        // and '0 == status()'.
+
+    int wait() const;
+        // Block until this future is ready, and return its status.  The
+        // behavior is undefined unless this future is valid.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+                               // =============
+                               // class Promise
+                               // =============
+
+template <class TYPE>
+class Promise {
+    // This class template provides a mechanism to make the futures it
+    // provides ready with a value of the parameterized 'TYPE', or with an
+    // error status.  A promise destroyed before being given either makes its
+    // futures ready with the status 'FutureUtil::e_BROKEN_PROMISE'.
+
+    // DATA
+    bsl::shared_ptr<Future_State<TYPE> > d_state;  // state shared with the
+                                                   // futures
+
+  private:
+    // NOT IMPLEMENTED
+    Promise(const Promise&);
+    Promise& operator=(const Promise&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Promise, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit Promise(bslma::Allocator *basicAllocator = 0);
+        // Create a promise whose futures are not ready.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~Promise();
+        // Destroy this object, making its futures ready with the status
+        // 'FutureUtil::e_BROKEN_PROMISE' if it was given neither a value nor
+        // an error.
+
+    // MANIPULATORS
+    void setError(int status);
+        // Make the futures of this promise ready with the specified error
+        // 'status', and invoke their continuations.  The behavior is
+        // undefined unless '0 != status' and this promise has been given
+        // neither a value nor an error.
+
+    void setValue(const TYPE& value);
+        // Make the futures of this promise ready with a copy of the specified
+        // 'value', and invoke their continuations.  The behavior is undefined
+        // unless this promise has been given neither a value nor an error.
+
+    // ACCESSORS
+    Future<TYPE> future() const;
+        // Return a future that becomes ready when this promise is given a
+        // value or an error, or is destroyed.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+                            // ====================
+                            // class Future_WhenAll
+                            // ====================
+
+template <class TYPE>
+class Future_WhenAll {
+    // This component-private class template gathers the values of a range of
+    // futures for 'FutureUtil::whenAll'.
+
+    // DATA
+    bsl::vector<Future<TYPE> >                          d_inputs;
+                                                  // futures being waited on
+
+    bsls::AtomicInt64                                   d_numRemaining;
+                                                  // number of inputs not yet
+                                                  // ready
+
+    bsl::shared_ptr<Future_State<bsl::vector<TYPE> > >  d_result;
+                                                  // state of the result
+
+  private:
+    // NOT IMPLEMENTED
+    Future_WhenAll(const Future_WhenAll&);
+    Future_WhenAll& operator=(const Future_WhenAll&);
+
+  public:
+    // CREATORS
+    template <class INPUT_ITER>
+    Future_WhenAll(
+            INPUT_ITER                                                first,
+            INPUT_ITER                                                last,
+            const bsl::shared_ptr<Future_State<bsl::vector<TYPE> > >& result,
+            bslma::Allocator                                *basicAllocator);
+        // Create an object gathering the values of the futures in the
+        // specified range '[first .. last)' into the specified 'result', using
+        // the specified 'basicAllocator' to supply memory.
+
+    // MANIPULATORS
+    void notify();
+        // Record that one of the inputs is ready, and make the result ready
+        // if every input is.
+
+    // ACCESSORS
+    const bsl::vector<Future<TYPE> >& inputs() const;
+        // Return a reference providing non-modifiable access to the futures
+        // being waited on.
+};
+
+                        // ============================
+                        // class Future_WhenAllCallback
+                        // ============================
+
+template <class TYPE>
+class Future_WhenAllCallback {
+    // This component-private class template provides the callback notifying
+    // a 'Future_WhenAll' that one of its inputs is ready.
+
+    // DATA
+    bsl::shared_ptr<Future_WhenAll<TYPE> > d_whenAll;  // gathering object
+
+  public:
+    // CREATORS
+    explicit Future_WhenAllCallback(
+                        const bsl::shared_ptr<Future_WhenAll<TYPE> >& whenAll);
+        // Create a callback notifying the specified 'whenAll'.
+
+    // ACCESSORS
+    void operator()() const;
+        // Notify the 'Future_WhenAll' held by this object.
+};
+
+                        // ============================
+                        // class Future_WhenAnyCallback
+                        // ============================
+
+class Future_WhenAnyCallback {
+    // This component-private class provides the callback making the result of
+    // 'FutureUtil::whenAny' ready with the index of the first ready input.
+
+    // DATA
+    bsl::shared_ptr<Future_State<bsl::size_t> > d_result;  // state of result
+    bsl::shared_ptr<bsls::AtomicBool>           d_isDone;  // 'true' once the
+                                                           // result is ready
+    bsl::size_t                                 d_index;   // index of input
+
+  public:
+    // CREATORS
+    Future_WhenAnyCallback(
+                 const bsl::shared_ptr<Future_State<bsl::size_t> >& result,
+                 const bsl::shared_ptr<bsls::AtomicBool>&           isDone,
+                 bsl::size_t                                        index);
+        // Create a callback making the specified 'result' ready with the
+        // specified 'index', unless the specified 'isDone' flag is already
+        // set.
+
+    // ACCESSORS
+    void operator()() const;
+        // Make the result ready with the index held by this object, unless it
+        // is already ready.
+};
+
+                         // =========================
+                         // struct Future_ElementType
+                         // =========================
+
+template <class INPUT_ITER>
+struct Future_ElementType {
+    // This component-private 'struct' template provides the type of the value
+    // of the futures in a range of the parameterized 'INPUT_ITER' type.
+
+    // TYPES
+    typedef typename bsl::iterator_traits<INPUT_ITER>::value_type::ValueType
+                                                                          Type;
+};
+
+                             // =================
+                             // struct FutureUtil
+                             // =================
+
+struct FutureUtil {
+    // This 'struct' provides a namespace for functions that create ready
+    // futures and that combine futures.
+
+    // TYPES
+    enum {
+        e_BROKEN_PROMISE         = -1,  // status of the futures of a promise
+                                        // destroyed before being given a
+                                        // value or an error
+
+        e_CONTINUATION_EXCEPTION = -2   // status of the future returned by
+                                        // 'then' if the continuation threw
+    };
+
+    // CLASS METHODS
+    template <class TYPE>
+    static Future<TYPE> makeError(int               status,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Return a future that is ready with the specified error 'status',
+        // without allocating shared state.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 != status'.  Note that 'TYPE' must be specified
+        // explicitly.
+
+    template <class TYPE>
+    static Future<TYPE> makeReady(const TYPE&       value,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Return a future that is ready with a copy of the specified 'value',
+        // without allocating shared state.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    template <class INPUT_ITER>
+    static Future<bsl::vector<typename Future_ElementType<INPUT_ITER>::Type> >
+    whenAll(INPUT_ITER        first,
+            INPUT_ITER        last,
+            bslma::Allocator *basicAllocator = 0);
+        // Return a future that becomes ready once every future in the
+        // specified range '[first .. last)' is ready, holding their values in
+        // order, or, if any of them has a non-zero status, the first such
+        // status in the order of the range.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless every future in the range is valid.  Note that the
+        // returned future is ready immediately if the range is empty.
+
+    template <class INPUT_ITER>
+    static Future<bsl::size_t> whenAny(INPUT_ITER        first,
+                                       INPUT_ITER        last,
+                                       bslma::Allocator *basicAllocator = 0);
+        // Return a future that becomes ready once any future in the specified
+        // range '[first .. last)' is ready, holding the index of that future
+        // in the range.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless the range is
+        // non-empty and every future in it is valid.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class Future_State
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+void Future_State<TYPE>::complete()
+{
+    bsl::function<void()>               firstCallback(bsl::allocator_arg,
+                                                      d_allocator_p);
+    bsl::vector<bsl::function<void()> > callbacks(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        BSLS_ASSERT(!d_isReady.loadRelaxed());
+
+        d_isReady.storeRelease(true);
+        firstCallback.swap(d_firstCallback);
+        callbacks.swap(d_callbacks);
+
+        if (d_numWaiters) {
+            d_condition.broadcast();
+        }
+    }
+
+    if (firstCallback) {
+        firstCallback();
+    }
+    for (bsl::size_t i = 0; i < callbacks.size(); ++i) {
+        callbacks[i]();
+    }
+}
+
+// CREATORS
+template <class TYPE>
+Future_State<TYPE>::Future_State(bslma::Allocator *basicAllocator)
+: d_status(0)
+, d_isReady(false)
+, d_numWaiters(0)
+, d_firstCallback(bsl::allocator_arg, basicAllocator)
+, d_callbacks(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE>
+Future_State<TYPE>::~Future_State()
+{
+    if (d_isReady.loadRelaxed() && 0 == d_status) {
+        bslma::DestructionUtil::destroy(d_value.address());
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+template <class CALLBACK>
+void Future_State<TYPE>::addCallback(const CALLBACK& callback)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (!d_isReady.loadRelaxed()) {
+            if (!d_firstCallback) {
+                d_firstCallback = callback;
+            }
+            else {
+                d_callbacks.emplace_back(callback);
+            }
+            return;                                                   // RETURN
+        }
+    }
+
+    CALLBACK copy(callback);
+    copy();
+}
+
+template <class TYPE>
+inline
+void Future_State<TYPE>::setError(int status)
+{
+    BSLS_ASSERT(0 != status);
+
+    d_status = status;
+    complete();
+}
+
+template <class TYPE>
+inline
+void Future_State<TYPE>::setValue(const TYPE& value)
+{
+    BSLS_ASSERT(!d_isReady.loadRelaxed());
+
+    bslma::ConstructionUtil::construct(d_value.address(),
+                                       d_allocator_p,
+                                       value);
+    complete();
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bslma::Allocator *Future_State<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class TYPE>
+inline
+bool Future_State<TYPE>::isReady() const
+{
+    return d_isReady.loadAcquire();
+}
+
+template <class TYPE>
+inline
+int Future_State<TYPE>::status() const
+{
+    BSLS_ASSERT(isReady());
+
+    return d_status;
+}
+
+template <class TYPE>
+inline
+const TYPE& Future_State<TYPE>::value() const
+{
+    BSLS_ASSERT(isReady());
+    BSLS_ASSERT(0 == d_status);
+
+    return d_value.object();
+}
+
+template <class TYPE>
+void Future_State<TYPE>::wait() const
+{
+    if (d_isReady.loadAcquire()) {
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    ++d_numWaiters;
+    while (!d_isReady.loadRelaxed()) {
+        d_condition.wait(&d_mutex);
+    }
+    --d_numWaiters;
+}
+
+                           // ---------------------
+                           // struct Future_Invoker
+                           // ---------------------
+
+// CLASS METHODS
+template <class RESULT>
+template <class FUNCTION, class ARGUMENT>
+inline
+typename Future_Invoker<RESULT>::ValueType
+Future_Invoker<RESULT>::invoke(FUNCTION& function, const ARGUMENT& argument)
+{
+    return function(argument);
+}
+
+template <class FUNCTION, class ARGUMENT>
+inline
+Future_Invoker<void>::ValueType
+Future_Invoker<void>::invoke(FUNCTION& function, const ARGUMENT& argument)
+{
+    function(argument);
+    return ValueType();
+}
+
+                         // -------------------------
+                         // class Future_Continuation
+                         // -------------------------
+
+// CREATORS
+template <class TYPE, class FUNCTION>
+inline
+Future_Continuation<TYPE, FUNCTION>::Future_Continuation(
+                    const Future<TYPE>&                               source,
+                    const FUNCTION&                                   function,
+                    const bsl::shared_ptr<Future_State<ResultType> >& result)
+: d_source(source, result->allocator())
+, d_function(function)
+, d_result(result)
+{
+}
+
+// MANIPULATORS
+template <class TYPE, class FUNCTION>
+void Future_Continuation<TYPE, FUNCTION>::operator()()
+{
+    BSLS_TRY {
+        d_result->setValue(ThenResult::Invoker::invoke(d_function, d_source));
+    }
+    BSLS_CATCH(...) {
+        if (d_result->isReady()) {
+            // The result was made ready, so the exception was thrown by one
+            // of the callbacks of the result, which must see it.
+
+            BSLS_RETHROW;
+        }
+        d_result->setError(FutureUtil::e_CONTINUATION_EXCEPTION);
+    }
+}
+
+                          // -----------------------
+                          // class Future_Dispatcher
+                          // -----------------------
+
+// CREATORS
+template <class EXECUTOR, class JOB>
+inline
+Future_Dispatcher<EXECUTOR, JOB>::Future_Dispatcher(
+                                              EXECUTOR         *executor,
+                                              const JOB&        job,
+                                              bslma::Allocator *basicAllocator)
+: d_executor_p(executor)
+, d_job(job)
+, d_allocator_p(basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class EXECUTOR, class JOB>
+void Future_Dispatcher<EXECUTOR, JOB>::operator()()
+{
+    const bsl::function<void()> job(bsl::allocator_arg, d_allocator_p, d_job);
+
+    if (0 != d_executor_p->enqueueJob(job)) {
+        d_job();
+    }
+}
+
+                                // ------------
+                                // class Future
+                                // ------------
+
+// PRIVATE CREATORS
+template <class TYPE>
+inline
+Future<TYPE>::Future(
+                  const bsl::shared_ptr<Future_State<TYPE> >&  state,
+                  bslma::Allocator                            *basicAllocator)
+: d_state(state)
+, d_hasValue(false)
+, d_status(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+template <class CALLBACK>
+void Future<TYPE>::addCallback(const CALLBACK& callback) const
+{
+    BSLS_ASSERT(isValid());
+
+    if (d_state) {
+        d_state->addCallback(callback);
+    }
+    else {
+        CALLBACK copy(callback);
+        copy();
+    }
+}
+
+// CREATORS
+template <class TYPE>
+inline
+Future<TYPE>::Future(bslma::Allocator *basicAllocator)
+: d_hasValue(false)
+, d_status(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE>
+inline
+Future<TYPE>::Future(const TYPE& value, bslma::Allocator *basicAllocator)
+: d_hasValue(false)
+, d_status(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bslma::ConstructionUtil::construct(d_value.address(),
+                                       d_allocator_p,
+                                       value);
+    d_hasValue = true;
+}
+
+template <class TYPE>
+inline
+Future<TYPE>::Future(const Future&     original,
+                     bslma::Allocator *basicAllocator)
+: d_state(original.d_state)
+, d_hasValue(false)
+, d_status(original.d_status)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (original.d_hasValue) {
+        bslma::ConstructionUtil::construct(d_value.address(),
+                                           d_allocator_p,
+                                           original.d_value.object());
+        d_hasValue = true;
+    }
+}
+
+template <class TYPE>
+inline
+Future<TYPE>::~Future()
+{
+    if (d_hasValue) {
+        bslma::DestructionUtil::destroy(d_value.address());
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+Future<TYPE>& Future<TYPE>::operator=(const Future& rhs)
+{
+    if (this == &rhs) {
+        return *this;                                                 // RETURN
+    }
+
+    if (rhs.d_hasValue) {
+        if (d_hasValue) {
+            d_value.object() = rhs.d_value.object();
+        }
+        else {
+            bslma::ConstructionUtil::construct(d_value.address(),
+                                               d_allocator_p,
+                                               rhs.d_value.object());
+            d_hasValue = true;
+        }
+    }
+    else if (d_hasValue) {
+        bslma::DestructionUtil::destroy(d_value.address());
+        d_hasValue = false;
+    }
+
+    d_state  = rhs.d_state;
+    d_status = rhs.d_status;
+
+    return *this;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bool Future<TYPE>::isReady() const
+{
+    return d_state ? d_state->isReady() : d_hasValue || 0 != d_status;
+}
+
+template <class TYPE>
+inline
+bool Future<TYPE>::isValid() const
+{
+    return d_state || d_hasValue || 0 != d_status;
+}
+
+template <class TYPE>
+inline
+const TYPE& Future<TYPE>::get() const
+{
+    const int rc = wait();
+
+    (void)rc;
+    BSLS_ASSERT(0 == rc);
+
+    return value();
+}
+
+template <class TYPE>
+inline
+int Future<TYPE>::status() const
+{
+    BSLS_ASSERT(isReady());
+
+    return d_state ? d_state->status() : d_status;
+}
+
+template <class TYPE>
+template <class FUNCTION>
+Future<typename Future_ThenResult<FUNCTION, TYPE>::ValueType>
+Future<TYPE>::then(FUNCTION function) const
+{
+    BSLS_ASSERT(isValid());
+
+    typedef Future_ThenResult<FUNCTION, TYPE> ThenResult;
+    typedef typename ThenResult::ValueType    ResultType;
+
+    if (!d_state) {
+        // This future holds its own value or status, so the result is
+        // computed now, and is held by the returned future.
+
+        BSLS_TRY {
+            return Future<ResultType>(ThenResult::Invoker::invoke(function,
+                                                                  *this),
+                                      d_allocator_p);                 // RETURN
+        }
+        BSLS_CATCH(...) {
+        }
+        return FutureUtil::makeError<ResultType>(
+                                          FutureUtil::e_CONTINUATION_EXCEPTION,
+                                          d_allocator_p);             // RETURN
+    }
+
+    bsl::shared_ptr<Future_State<ResultType> > result;
+    result.createInplace(d_allocator_p, d_allocator_p);
+
+    d_state->addCallback(Future_Continuation<TYPE, FUNCTION>(*this,
+                                                             function,
+                                                             result));
+
+    return Future<ResultType>(result, d_allocator_p);
+}
+
+template <class TYPE>
+template <class EXECUTOR, class FUNCTION>
+Future<typename Future_ThenResult<FUNCTION, TYPE>::ValueType>
+Future<TYPE>::then(EXECUTOR *executor, FUNCTION function) const
+{
+    BSLS_ASSERT(isValid());
+    BSLS_ASSERT(executor);
+
+    typedef Future_ThenResult<FUNCTION, TYPE>   ThenResult;
+    typedef typename ThenResult::ValueType      ResultType;
+    typedef Future_Continuation<TYPE, FUNCTION> Continuation;
+
+    bsl::shared_ptr<Future_State<ResultType> > result;
+    result.createInplace(d_allocator_p, d_allocator_p);
+
+    addCallback(Future_Dispatcher<EXECUTOR, Continuation>(
+                                         executor,
+                                         Continuation(*this, function, result),
+                                         d_allocator_p));
+
+    return Future<ResultType>(result, d_allocator_p);
+}
+
+template <class TYPE>
+inline
+const TYPE& Future<TYPE>::value() const
+{
+    BSLS_ASSERT(isReady());
+
+    if (d_state) {
+        return d_state->value();                                      // RETURN
+    }
+
+    BSLS_ASSERT(d_hasValue);
+
+    return d_value.object();
+}
+
+template <class TYPE>
+inline
+int Future<TYPE>::wait() const
+{
+    BSLS_ASSERT(isValid());
+
+    if (d_state) {
+        d_state->wait();
+    }
+
+    return status();
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *Future<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+                            // --------------------
+                            // class Future_WhenAll
+                            // --------------------
+
+// CREATORS
+template <class TYPE>
+template <class INPUT_ITER>
+Future_WhenAll<TYPE>::Future_WhenAll(
+            INPUT_ITER                                                first,
+            INPUT_ITER                                                last,
+            const bsl::shared_ptr<Future_State<bsl::vector<TYPE> > >& result,
+            bslma::Allocator                                *basicAllocator)
+: d_inputs(first, last, basicAllocator)
+, d_numRemaining(static_cast<bsls::Types::Int64>(d_inputs.size()))
+, d_result(result)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+void Future_WhenAll<TYPE>::notify()
+{
+    if (0 != d_numRemaining.addAcqRel(-1)) {
+        return;                                                       // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < d_inputs.size(); ++i) {
+        const int status = d_inputs[i].status();
+
+        if (0 != status) {
+            d_result->setError(status);
+            return;                                                   // RETURN
+        }
+    }
+
+    bsl::vector<TYPE> values(d_result->allocator());
+    values.reserve(d_inputs.size());
+
+    for (bsl::size_t i = 0; i < d_inputs.size(); ++i) {
+        values.push_back(d_inputs[i].value());
+    }
+
+    d_result->setValue(values);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const bsl::vector<Future<TYPE> >& Future_WhenAll<TYPE>::inputs() const
+{
+    return d_inputs;
+}
+
+                        // ----------------------------
+                        // class Future_WhenAllCallback
+                        // ----------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+Future_WhenAllCallback<TYPE>::Future_WhenAllCallback(
+                        const bsl::shared_ptr<Future_WhenAll<TYPE> >& whenAll)
+: d_whenAll(whenAll)
+{
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+void Future_WhenAllCallback<TYPE>::operator()() const
+{
+    d_whenAll->notify();
+}
+
+                        // ----------------------------
+                        // class Future_WhenAnyCallback
+                        // ----------------------------
+
+// CREATORS
+inline
+Future_WhenAnyCallback::Future_WhenAnyCallback(
+                  const bsl::shared_ptr<Future_State<bsl::size_t> >& result,
+                  const bsl::shared_ptr<bsls::AtomicBool>&           isDone,
+                  bsl::size_t                                        index)
+: d_result(result)
+, d_isDone(isDone)
+, d_index(index)
+{
+}
+
+// ACCESSORS
+inline
+void Future_WhenAnyCallback::operator()() const
+{
+    if (false == d_isDone->testAndSwapAcqRel(false, true)) {
+        d_result->setValue(d_index);
+    }
+}
+
+                               // -------------
+                               // class Promise
+                               // -------------
+
+// CREATORS
+template <class TYPE>
+inline
+Promise<TYPE>::Promise(bslma::Allocator *basicAllocator)
+{
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    d_state.createInplace(allocator, allocator);
+}
+
+template <class TYPE>
+inline
+Promise<TYPE>::~Promise()
+{
+    if (!d_state->isReady()) {
+        d_state->setError(FutureUtil::e_BROKEN_PROMISE);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void Promise<TYPE>::setError(int status)
+{
+    BSLS_ASSERT(0 != status);
+
+    d_state->setError(status);
+}
+
+template <class TYPE>
+inline
+void Promise<TYPE>::setValue(const TYPE& value)
+{
+    d_state->setValue(value);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+Future<TYPE> Promise<TYPE>::future() const
+{
+    return Future<TYPE>(d_state, d_state->allocator());
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *Promise<TYPE>::allocator() const
+{
+    return d_state->allocator();
+}
+
+                             // -----------------
+                             // struct FutureUtil
+                             // -----------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+Future<TYPE> FutureUtil::makeError(int               status,
+                                   bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(0 != status);
+
+    Future<TYPE> result(basicAllocator);
+    result.d_status = status;
+    return result;
+}
+
+template <class TYPE>
+inline
+Future<TYPE> FutureUtil::makeReady(const TYPE&       value,
+                                   bslma::Allocator *basicAllocator)
+{
+    return Future<TYPE>(value, basicAllocator);
+}
+
+template <class INPUT_ITER>
+Future<bsl::vector<typename Future_ElementType<INPUT_ITER>::Type> >
+FutureUtil::whenAll(INPUT_ITER        first,
+                    INPUT_ITER        last,
+                    bslma::Allocator *basicAllocator)
+{
+    typedef typename Future_ElementType<INPUT_ITER>::Type TYPE;
+    typedef bsl::vector<TYPE>                             ResultType;
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    if (first == last) {
+        return Future<ResultType>(ResultType(allocator),
+                                  allocator);                         // RETURN
+    }
+
+    bsl::shared_ptr<Future_State<ResultType> > result;
+    result.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<Future_WhenAll<TYPE> > whenAll;
+    whenAll.createInplace(allocator, first, last, result, allocator);
+
+    const Future_WhenAllCallback<TYPE> callback(whenAll);
+
+    for (bsl::size_t i = 0; i < whenAll->inputs().size(); ++i) {
+        whenAll->inputs()[i].addCallback(callback);
+    }
+
+    return Future<ResultType>(result, allocator);
+}
+
+template <class INPUT_ITER>
+Future<bsl::size_t> FutureUtil::whenAny(INPUT_ITER        first,
+                                        INPUT_ITER        last,
+                                        bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(first != last);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    bsl::shared_ptr<Future_State<bsl::size_t> > result;
+    result.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<bsls::AtomicBool> isDone;
+    isDone.createInplace(allocator, false);
+
+    for (bsl::size_t i = 0; first != last; ++first, ++i) {
+        first->addCallback(Future_WhenAnyCallback(result, isDone, i));
+    }
+
+    return Future<bsl::size_t>(result, allocator);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
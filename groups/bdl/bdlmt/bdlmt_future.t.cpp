@@ -0,0 +1,1685 @@
+// bdlmt_future.t.cpp                                                 -*-C++-*-
+#include <bdlmt_future.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_latch.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_testutil.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_numeric.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test provides a future, a promise, and a utility for
+// creating and combining futures.  We first test the component-private shared
+// state directly, then the promise and the future it provides, then futures
+// that are ready on creation (verifying that they allocate no shared state),
+// then continuations, run inline and on executors, and finally the
+// combinators.  The thread invoking each continuation is recorded, to verify
+// where it runs.  A stress test attaches continuations while other threads
+// make the futures ready.
+//
+// In addition to positive test cases, a negative test case -1 can be run
+// manually to compare a fan-out/fan-in over a thread pool synchronized with a
+// latch with the same computation composed with futures.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 3] Promise(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~Promise();
+// [ 3] Future(bslma::Allocator *basicAllocator = 0);
+// [ 4] Future(const TYPE& value, bslma::Allocator *basicAllocator = 0);
+// [ 3] Future(const Future& original, bslma::Allocator *ba = 0);
+// [ 3] ~Future();
+//
+// MANIPULATORS
+// [ 3] void Promise::setError(int status);
+// [ 3] void Promise::setValue(const TYPE& value);
+// [ 3] Future& Future::operator=(const Future& rhs);
+//
+// ACCESSORS
+// [ 3] Future<TYPE> Promise::future() const;
+// [ 3] bslma::Allocator *Promise::allocator() const;
+// [ 3] bool Future::isReady() const;
+// [ 3] bool Future::isValid() const;
+// [ 3] const TYPE& Future::get() const;
+// [ 3] int Future::status() const;
+// [ 5] Future<RESULT> Future::then(FUNCTION function) const;
+// [ 6] Future<RESULT> Future::then(EXECUTOR *, FUNCTION) const;
+// [ 3] const TYPE& Future::value() const;
+// [ 3] int Future::wait() const;
+// [ 3] bslma::Allocator *Future::allocator() const;
+//
+// CLASS METHODS
+// [ 4] Future<TYPE> FutureUtil::makeError(int, bslma::Allocator *);
+// [ 4] Future<TYPE> FutureUtil::makeReady(const TYPE&, Allocator *);
+// [ 7] Future<vector<TYPE> > FutureUtil::whenAll(IT, IT, Allocator *);
+// [ 8] Future<size_t> FutureUtil::whenAny(IT, IT, Allocator *);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] Future_State
+// [ 9] CONCERN: CONCURRENT READINESS AND CONTINUATIONS
+// [10] USAGE EXAMPLE
+// [-1] PERFORMANCE: FAN-OUT/FAN-IN WITH FUTURES VS. A LATCH
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT                   BSLMT_TESTUTIL_ASSERT
+#define ASSERTV                  BSLMT_TESTUTIL_ASSERTV
+
+#define GUARD                    BSLMT_TESTUTIL_GUARD
+
+#define Q                        BSLMT_TESTUTIL_Q
+#define P                        BSLMT_TESTUTIL_P
+#define P_                       BSLMT_TESTUTIL_P_
+#define T_                       BSLMT_TESTUTIL_T_
+#define L_                       BSLMT_TESTUTIL_L_
+
+#define GUARDED_STREAM(STREAM)   BSLMT_TESTUTIL_GUARDED_STREAM(STREAM)
+#define COUT                     BSLMT_TESTUTIL_COUT
+#define CERR                     BSLMT_TESTUTIL_CERR
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::Future<int>          IntFuture;
+typedef bdlmt::Promise<int>         IntPromise;
+typedef bdlmt::Future<bsl::string>  StringFuture;
+typedef bdlmt::Promise<bsl::string> StringPromise;
+typedef bdlmt::FutureUtil           Util;
+typedef bsls::Types::Uint64         Uint64;
+
+const char *const LONG_STRING = "a string long enough to allocate memory";
+
+// ============================================================================
+//                           GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+int test;
+int verbose;
+int veryVerbose;
+int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct AddOne {
+    // This 'struct' returns one more than the value of a future, or the
+    // negation of its status if it failed, and records the calling thread.
+
+    // TYPES
+    typedef int result_type;
+
+    // DATA
+    Uint64 *d_threadId_p;  // if not 0, the calling thread is stored here
+
+    // ACCESSORS
+    int operator()(const IntFuture& future) const
+    {
+        if (d_threadId_p) {
+            *d_threadId_p = bslmt::ThreadUtil::selfIdAsUint64();
+        }
+
+        if (0 != future.status()) {
+            return -future.status();                                  // RETURN
+        }
+        return future.value() + 1;
+    }
+};
+
+struct Append {
+    // This 'struct' returns the value of a future with a suffix appended.
+
+    // TYPES
+    typedef bsl::string result_type;
+
+    // DATA
+    const char *d_suffix_p;
+
+    // ACCESSORS
+    bsl::string operator()(const StringFuture& future) const
+    {
+        return future.value() + d_suffix_p;
+    }
+};
+
+struct Increment {
+    // This 'struct' increments a counter and returns nothing.
+
+    // TYPES
+    typedef void result_type;
+
+    // DATA
+    bsls::AtomicInt *d_counter_p;
+
+    // ACCESSORS
+    void operator()(const IntFuture&) const
+    {
+        ++*d_counter_p;
+    }
+};
+
+int twice(const IntFuture& future)
+    // Return twice the value of the specified 'future'.
+{
+    return 2 * future.value();
+}
+
+#ifdef BDE_BUILD_TARGET_EXC
+int throwValue(const IntFuture& future)
+    // Throw the value of the specified 'future', or its status if it failed.
+{
+    throw 0 == future.status() ? future.value() : future.status();
+}
+#endif
+
+bsl::size_t sizeOf(const bdlmt::Future<bsl::vector<int> >& future)
+    // Return the number of values held by the specified 'future', or 999 if
+    // it failed.
+{
+    return 0 == future.status() ? future.value().size() : 999;
+}
+
+struct CountingExecutor {
+    // This 'struct' provides an executor that runs jobs on a pool and counts
+    // them, or rejects them if 'd_reject' is 'true'.
+
+    // DATA
+    bdlmt::FixedThreadPool *d_pool_p;
+    bsls::AtomicInt         d_numJobs;
+    bool                    d_reject;
+
+    // MANIPULATORS
+    int enqueueJob(const bsl::function<void()>& job)
+    {
+        if (d_reject) {
+            return -1;                                                // RETURN
+        }
+        ++d_numJobs;
+        return d_pool_p->enqueueJob(job);
+    }
+};
+
+void setValue(IntPromise *promise, int value)
+    // Give the specified 'promise' the specified 'value'.
+{
+    promise->setValue(value);
+}
+
+void setValueAfterDelay(IntPromise *promise, int value)
+    // Give the specified 'promise' the specified 'value' after a short delay.
+{
+    bslmt::ThreadUtil::microSleep(20 * 1000);
+    promise->setValue(value);
+}
+
+void recordThread(Uint64 *threadId)
+    // Store the id of the calling thread in the specified 'threadId'.
+{
+    *threadId = bslmt::ThreadUtil::selfIdAsUint64();
+}
+
+void setValues(bsl::vector<IntPromise *> *promises, int offset, int stride)
+    // Give each promise at the specified 'offset' modulo the specified
+    // 'stride' in the specified 'promises' its index as a value.
+{
+    for (bsl::size_t i = offset; i < promises->size(); i += stride) {
+        (*promises)[i]->setValue(static_cast<int>(i));
+    }
+}
+
+void attachContinuations(const bsl::vector<IntFuture> *futures,
+                         bsl::vector<IntFuture>       *results)
+    // Attach a continuation to each of the specified 'futures', and load the
+    // futures of the continuations into the specified 'results'.
+{
+    AddOne addOne = { 0 };
+
+    for (bsl::size_t i = 0; i < futures->size(); ++i) {
+        results->push_back((*futures)[i].then(addOne));
+    }
+}
+
+                          // =======================
+                          // Benchmark: fan-out/in
+                          // =======================
+
+int work(int value)
+    // Return a value computed from the specified 'value' with a little work.
+{
+    unsigned int state = value;
+    for (int i = 0; i < 100; ++i) {
+        state = state * 1103515245 + 12345;
+    }
+    return static_cast<int>(state >> 16);
+}
+
+void workWithLatch(int *result, int value, bslmt::Latch *latch)
+    // Load into the specified 'result' the work computed from the specified
+    // 'value', and count down the specified 'latch'.
+{
+    *result = work(value);
+    latch->arrive();
+}
+
+void workWithPromise(IntPromise *promise, int value)
+    // Give the specified 'promise' the work computed from the specified
+    // 'value'.
+{
+    promise->setValue(work(value));
+}
+
+struct Sum {
+    // This 'struct' returns the sum of the values of a future.
+
+    // TYPES
+    typedef int result_type;
+
+    // ACCESSORS
+    int operator()(const bdlmt::Future<bsl::vector<int> >& future) const
+    {
+        return bsl::accumulate(future.value().begin(),
+                               future.value().end(),
+                               0);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Combining Asynchronous Results
+///- - - - - - - - - - - - - - - - - - - - -
+// In this example we compute two prices on a thread pool, and then compute
+// their total on the same pool once both are available, without blocking any
+// thread of the pool.
+//
+// First, we define a function that computes a price and makes it the value of
+// a promise:
+//..
+    void computePrice(bdlmt::Promise<double> *promise, double base)
+        // Set the value of the specified 'promise' to the price computed from
+        // the specified 'base'.
+    {
+        promise->setValue(base * 1.25);
+    }
+//..
+// Then, we define the continuation that totals the prices, or returns a
+// negative value if either could not be computed:
+//..
+    struct TotalPrice {
+        // TYPES
+        typedef double result_type;
+
+        // ACCESSORS
+        double operator()(
+                      const bdlmt::Future<bsl::vector<double> >& prices) const
+        {
+            if (0 != prices.status()) {
+                return -1.0;                                          // RETURN
+            }
+            return bsl::accumulate(prices.value().begin(),
+                                   prices.value().end(),
+                                   0.0);
+        }
+    };
+//..
+// Note that the 'result_type' is needed only by C++03 compilers, which cannot
+// otherwise deduce the type of the future returned by 'then'.
+
+}  // close namespace USAGE_EXAMPLE_1
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2 ? (atoi(argv[2]) ? atoi(argv[2]) : 1) : 0;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE_1;
+
+// Next, we create and start a pool, and create the promises and the jobs
+// that fulfill them:
+//..
+    bdlmt::FixedThreadPool pool(2, 100);
+    pool.start();
+
+    bdlmt::Promise<double> first;
+    bdlmt::Promise<double> second;
+
+    bsl::vector<bdlmt::Future<double> > prices;
+    prices.push_back(first.future());
+    prices.push_back(second.future());
+
+    pool.enqueueJob(bdlf::BindUtil::bind(&computePrice, &first, 100.0));
+    pool.enqueueJob(bdlf::BindUtil::bind(&computePrice, &second, 60.0));
+//..
+// Then, we combine the futures, and arrange for the total to be computed on
+// the pool once both prices are ready:
+//..
+    bdlmt::Future<double> total =
+                  bdlmt::FutureUtil::whenAll(prices.begin(), prices.end())
+                                                    .then(&pool, TotalPrice());
+//..
+// Finally, we wait for the total (which only the thread that consumes the
+// final result needs to do), and stop the pool:
+//..
+    ASSERT(200.0 == total.get());
+
+    pool.stop();
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT READINESS AND CONTINUATIONS
+        //
+        // Concerns:
+        //: 1 A continuation attached while another thread makes its future
+        //:   ready is invoked exactly once, and its result is correct.
+        //:
+        //: 2 'whenAll' over futures made ready concurrently by several
+        //:   threads holds every value.
+        //:
+        //: 3 All memory is released.
+        //
+        // Plan:
+        //: 1 Create many promises; in one thread, attach a continuation to
+        //:   each future, while several other threads set the values of the
+        //:   promises.  Verify the result of every continuation.  (C-1)
+        //:
+        //: 2 Combine the futures with 'whenAll' before the values are set,
+        //:   and verify the combined value.  (C-2)
+        //:
+        //: 3 Verify that the default allocator has no outstanding blocks.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT READINESS AND CONTINUATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "CONCERN: CONCURRENT READINESS AND CONTINUATIONS"
+                      << endl
+                      << "==============================================="
+                      << endl;
+
+        const int NUM_PROMISES = 20000;
+        const int NUM_SETTERS  = 3;
+
+        for (int iteration = 0; iteration < 5; ++iteration) {
+            bsl::vector<IntPromise *> promises;
+            bsl::vector<IntFuture>    futures;
+            bsl::vector<IntFuture>    results;
+
+            for (int i = 0; i < NUM_PROMISES; ++i) {
+                promises.push_back(new (defaultAllocator) IntPromise());
+                futures.push_back(promises.back()->future());
+            }
+
+            bdlmt::Future<bsl::vector<int> > all =
+                                Util::whenAll(futures.begin(), futures.end());
+
+            bslmt::ThreadGroup threads;
+
+            threads.addThread(bdlf::BindUtil::bind(&attachContinuations,
+                                                   &futures,
+                                                   &results));
+            for (int i = 0; i < NUM_SETTERS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&setValues,
+                                                       &promises,
+                                                       i,
+                                                       NUM_SETTERS));
+            }
+            threads.joinAll();
+
+            ASSERT(NUM_PROMISES == static_cast<int>(results.size()));
+
+            for (int i = 0; i < NUM_PROMISES; ++i) {
+                ASSERTV(i, results[i].isReady());
+                ASSERTV(i, results[i].get(), i + 1 == results[i].get());
+            }
+
+            ASSERT(all.isReady());
+            ASSERT(0 == all.status());
+            for (int i = 0; i < NUM_PROMISES; ++i) {
+                ASSERTV(i, i == all.value()[i]);
+            }
+
+            for (int i = 0; i < NUM_PROMISES; ++i) {
+                defaultAllocator.deleteObject(promises[i]);
+            }
+        }
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'whenAny'
+        //
+        // Concerns:
+        //: 1 The result becomes ready, with the index of the input, as soon as
+        //:   any input is ready, whether with a value or an error.
+        //:
+        //: 2 If an input is already ready, the result is ready on return.
+        //:
+        //: 3 Inputs becoming ready later do not affect the result.
+        //:
+        //: 4 The supplied allocator is used, and all memory is released.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Combine the futures of several promises, make the promises ready
+        //:   one by one, and verify the result after each.  (C-1, 3)
+        //:
+        //: 2 Combine futures including one that is ready on creation.  (C-2)
+        //:
+        //: 3 Use a test allocator, and verify that it has no outstanding
+        //:   blocks at the end.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an empty range.  (C-5)
+        //
+        // Testing:
+        //   Future<size_t> FutureUtil::whenAny(IT, IT, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'whenAny'" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            IntPromise p0(&ta);
+            IntPromise p1(&ta);
+            IntPromise p2(&ta);
+
+            bsl::vector<IntFuture> futures(&ta);
+            futures.push_back(p0.future());
+            futures.push_back(p1.future());
+            futures.push_back(p2.future());
+
+            bdlmt::Future<bsl::size_t> any = Util::whenAny(futures.begin(),
+                                                           futures.end(),
+                                                           &ta);
+            ASSERT(!any.isReady());
+            ASSERT(&ta == any.allocator());
+
+            p2.setError(7);
+            ASSERT(any.isReady());
+            ASSERT(2 == any.value());
+
+            p0.setValue(1);
+            ASSERT(2 == any.value());
+
+            futures.push_back(IntFuture(5, &ta));
+
+            any = Util::whenAny(futures.begin() + 1, futures.end(), &ta);
+            ASSERT(any.isReady());
+            ASSERT(1 == any.value());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(0 < ta.numAllocations());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<IntFuture> futures(2, IntFuture(1));
+
+            ASSERT_FAIL(Util::whenAny(futures.begin(), futures.begin()));
+            ASSERT_PASS(Util::whenAny(futures.begin(), futures.end()));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'whenAll'
+        //
+        // Concerns:
+        //: 1 The result becomes ready once every input is ready, holding the
+        //:   values of the inputs in order.
+        //:
+        //: 2 If any input fails, the result holds the status of the first
+        //:   failed input in the order of the range, and is ready only once
+        //:   every input is ready.
+        //:
+        //: 3 An empty range, or a range of ready inputs, yields a ready
+        //:   result.
+        //:
+        //: 4 The supplied allocator is used, and all memory is released.
+        //
+        // Plan:
+        //: 1 Combine the futures of several promises, make the promises ready
+        //:   in an order different from that of the range, and verify the
+        //:   result.  Repeat with errors and a broken promise.  (C-1..2)
+        //:
+        //: 2 Combine an empty range, and a range of ready futures.  (C-3)
+        //:
+        //: 3 Use a test allocator, and verify that it has no outstanding
+        //:   blocks at the end.  (C-4)
+        //
+        // Testing:
+        //   Future<vector<TYPE> > FutureUtil::whenAll(IT, IT, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'whenAll'" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nCombining values." << endl;
+        {
+            IntPromise p0(&ta);
+            IntPromise p1(&ta);
+
+            bsl::vector<IntFuture> futures(&ta);
+            futures.push_back(p0.future());
+            futures.push_back(IntFuture(10, &ta));
+            futures.push_back(p1.future());
+
+            bdlmt::Future<bsl::vector<int> > all =
+                           Util::whenAll(futures.begin(), futures.end(), &ta);
+            ASSERT(!all.isReady());
+            ASSERT(&ta == all.allocator());
+
+            p1.setValue(2);
+            ASSERT(!all.isReady());
+
+            p0.setValue(0);
+            ASSERT(all.isReady());
+            ASSERT(0 == all.status());
+            ASSERT(3 == all.value().size());
+            ASSERT(0 == all.value()[0]);
+            ASSERT(10 == all.value()[1]);
+            ASSERT(2 == all.value()[2]);
+            ASSERT(&ta == all.value().get_allocator().mechanism());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nCombining errors." << endl;
+        {
+            IntPromise p0(&ta);
+            IntPromise p2(&ta);
+
+            bsl::vector<IntFuture> futures(&ta);
+            futures.push_back(p0.future());
+
+            bdlmt::Future<bsl::vector<int> > all(&ta);
+            {
+                IntPromise broken(&ta);
+
+                futures.push_back(broken.future());
+                futures.push_back(p2.future());
+
+                all = Util::whenAll(futures.begin(), futures.end(), &ta);
+
+                p2.setError(3);
+                ASSERT(!all.isReady());
+            }
+            ASSERT(!all.isReady());
+
+            p0.setValue(0);
+            ASSERT(all.isReady());
+            ASSERTV(all.status(), Util::e_BROKEN_PROMISE == all.status());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nCombining ready futures." << endl;
+        {
+            bsl::vector<IntFuture> futures(&ta);
+
+            bdlmt::Future<bsl::vector<int> > all =
+                           Util::whenAll(futures.begin(), futures.end(), &ta);
+            ASSERT(all.isReady());
+            ASSERT(all.value().empty());
+
+            futures.push_back(IntFuture(1, &ta));
+            futures.push_back(IntFuture(2, &ta));
+
+            all = Util::whenAll(futures.begin(), futures.end(), &ta);
+            ASSERT(all.isReady());
+            ASSERT(2 == all.value().size());
+
+            futures.push_back(Util::makeError<int>(4, &ta));
+            futures.push_back(Util::makeError<int>(5, &ta));
+
+            ASSERT(999 == Util::whenAll(futures.begin(), futures.end(), &ta)
+                                                       .then(&sizeOf).value());
+
+            all = Util::whenAll(futures.begin(), futures.end(), &ta);
+            ASSERT(all.isReady());
+            ASSERT(4 == all.status());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'then' WITH AN EXECUTOR
+        //
+        // Concerns:
+        //: 1 The continuation is invoked in a job enqueued on the executor
+        //:   once the future is ready, and not before.
+        //:
+        //: 2 If the future is already ready, the job is enqueued immediately.
+        //:
+        //: 3 If the executor rejects the job, the continuation is invoked by
+        //:   the thread making the future ready.
+        //:
+        //: 4 'FixedThreadPool', 'ThreadPool', and 'WorkStealingThreadPool' can
+        //:   be used as executors.
+        //:
+        //: 5 All memory is released.
+        //:
+        //: 6 A continuation that throws in a job makes its future ready with
+        //:   the status 'e_CONTINUATION_EXCEPTION'.
+        //
+        // Plan:
+        //: 1 Use an executor counting the jobs enqueued on a pool; attach a
+        //:   continuation recording its thread to a pending future, and
+        //:   verify that no job is enqueued before the promise is set, and
+        //:   that the continuation runs in a pool thread after.  (C-1)
+        //:
+        //: 2 Repeat with a ready future.  (C-2)
+        //:
+        //: 3 Have the executor reject jobs, and verify that the continuation
+        //:   runs in the thread setting the promise.  (C-3)
+        //:
+        //: 4 Chain continuations across each type of pool.  (C-4)
+        //:
+        //: 5 Verify that the default allocator has no outstanding blocks.
+        //:   (C-5)
+        //:
+        //: 6 Chain a continuation to one that throws on a pool, and verify
+        //:   the status it observes.  (C-6)
+        //
+        // Testing:
+        //   Future<RESULT> Future::then(EXECUTOR *, FUNCTION) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'then' WITH AN EXECUTOR" << endl
+                          << "===============================" << endl;
+
+        const Uint64 SELF = bslmt::ThreadUtil::selfIdAsUint64();
+
+        {
+            bdlmt::FixedThreadPool pool(1, 100);
+
+            ASSERT(0 == pool.start());
+
+            Uint64 poolThread = 0;
+            pool.enqueueJob(bdlf::BindUtil::bind(&recordThread, &poolThread));
+            pool.drain();
+            ASSERT(0 != poolThread && SELF != poolThread);
+
+            if (verbose) cout << "\nRunning on a pool." << endl;
+            {
+                CountingExecutor executor;
+                executor.d_pool_p = &pool;
+                executor.d_reject = false;
+
+                Uint64 thread = 0;
+                AddOne addOne = { &thread };
+
+                IntPromise promise;
+                IntFuture  result = promise.future().then(&executor, addOne);
+
+                ASSERT(0 == executor.d_numJobs);
+                ASSERT(!result.isReady());
+
+                promise.setValue(1);
+                ASSERT(1 == executor.d_numJobs);
+                ASSERT(2 == result.get());
+                ASSERT(poolThread == thread);
+
+                thread = 0;
+                result = IntFuture(4).then(&executor, addOne);
+                ASSERT(2 == executor.d_numJobs);
+                ASSERT(5 == result.get());
+                ASSERT(poolThread == thread);
+
+                thread = 0;
+                result = Util::makeError<int>(6).then(&executor, addOne);
+                ASSERT(-6 == result.get());
+                ASSERT(poolThread == thread);
+            }
+
+            if (verbose) cout << "\nRejected jobs." << endl;
+            {
+                CountingExecutor executor;
+                executor.d_pool_p = &pool;
+                executor.d_reject = true;
+
+                Uint64 thread = 0;
+                AddOne addOne = { &thread };
+
+                IntPromise promise;
+                IntFuture  result = promise.future().then(&executor, addOne);
+
+                pool.enqueueJob(bdlf::BindUtil::bind(&setValue, &promise, 3));
+
+                ASSERT(4 == result.get());
+                ASSERT(poolThread == thread);
+
+                result = IntFuture(7).then(&executor, addOne);
+                ASSERT(result.isReady());
+                ASSERT(8 == result.value());
+                ASSERT(SELF == thread);
+            }
+
+            if (verbose) cout << "\nChaining across pools." << endl;
+            {
+                bslmt::ThreadAttributes       attributes;
+                bdlmt::ThreadPool             threadPool(attributes,
+                                                         1,
+                                                         2,
+                                                         100);
+                bdlmt::WorkStealingThreadPool workStealingPool(2);
+
+                ASSERT(0 == threadPool.start());
+                ASSERT(0 == workStealingPool.start());
+
+                AddOne addOne = { 0 };
+
+                IntPromise promise;
+                IntFuture  result = promise.future()
+                                               .then(&pool, addOne)
+                                               .then(&threadPool, addOne)
+                                               .then(&workStealingPool, addOne)
+                                               .then(&twice);
+
+                pool.enqueueJob(bdlf::BindUtil::bind(&setValueAfterDelay,
+                                                     &promise,
+                                                     10));
+                ASSERT(26 == result.get());
+
+                workStealingPool.stop();
+
+                // Jobs rejected by the stopped pool run inline.
+
+                result = IntFuture(1).then(&workStealingPool, addOne);
+                ASSERT(result.isReady());
+                ASSERT(2 == result.value());
+
+                threadPool.stop();
+            }
+
+#ifdef BDE_BUILD_TARGET_EXC
+            if (verbose) cout << "\nContinuations that throw." << endl;
+            {
+                AddOne addOne = { 0 };
+
+                IntPromise promise;
+                IntFuture  result = promise.future().then(&pool, &throwValue)
+                                                    .then(&pool, addOne);
+
+                pool.enqueueJob(bdlf::BindUtil::bind(&setValue, &promise, 5));
+
+                ASSERTV(result.get(),
+                        -Util::e_CONTINUATION_EXCEPTION == result.get());
+            }
+#endif
+
+            pool.stop();
+        }
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'then'
+        //
+        // Concerns:
+        //: 1 A continuation attached to a pending future is invoked once, by
+        //:   the thread making the future ready, with the ready future.
+        //:
+        //: 2 A continuation attached to a ready future is invoked immediately.
+        //:
+        //: 3 The returned future holds the result of the continuation, and
+        //:   continuations can be chained.
+        //:
+        //: 4 The continuation is invoked for a failed future, and may handle
+        //:   the error.
+        //:
+        //: 5 Continuations may be functors, function pointers, or return
+        //:   'void' (yielding a 'Future<bslmf::Nil>').
+        //:
+        //: 6 Several continuations may be attached to the same future.
+        //:
+        //: 7 The returned future uses the allocator of the original, and all
+        //:   memory is released.
+        //:
+        //: 8 If a continuation throws, the returned future is made ready with
+        //:   the status 'e_CONTINUATION_EXCEPTION', and continuations chained
+        //:   to it are invoked, whether the original future is pending, ready,
+        //:   or holds its own value.
+        //
+        // Plan:
+        //: 1 Attach continuations of various kinds to pending and ready
+        //:   futures, make the futures ready (in another thread, for some),
+        //:   and verify the results and the calling threads.  (C-1..6)
+        //:
+        //: 2 Use a test allocator, and verify that it has no outstanding
+        //:   blocks at the end.  (C-7)
+        //:
+        //: 3 Attach a throwing continuation, followed by another one, to
+        //:   pending, ready, and value-holding futures, and verify the
+        //:   statuses of the returned futures.  (C-8)
+        //
+        // Testing:
+        //   Future<RESULT> Future::then(FUNCTION function) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'then'" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const Uint64 SELF = bslmt::ThreadUtil::selfIdAsUint64();
+
+        if (verbose) cout << "\nPending futures." << endl;
+        {
+            bdlmt::FixedThreadPool pool(1, 100);
+            ASSERT(0 == pool.start());
+
+            Uint64 thread = 0;
+            AddOne addOne = { &thread };
+
+            IntPromise promise(&ta);
+            IntFuture  future = promise.future();
+
+            IntFuture result = future.then(addOne).then(&twice);
+            ASSERT(!result.isReady());
+            ASSERT(&ta == result.allocator());
+            ASSERT(0 == thread);
+
+            bsls::AtomicInt counter;
+            Increment       increment = { &counter };
+
+            bdlmt::Future<bslmf::Nil> done = future.then(increment);
+            future.then(increment);
+            ASSERT(0 == counter);
+
+            pool.enqueueJob(bdlf::BindUtil::bind(&setValue, &promise, 20));
+
+            ASSERT(42 == result.get());
+            done.wait();
+            ASSERT(0 != thread);
+            ASSERT(SELF != thread);
+
+            pool.stop();
+            ASSERT(2 == counter);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nReady futures." << endl;
+        {
+            Uint64 thread = 0;
+            AddOne addOne = { &thread };
+
+            IntPromise promise(&ta);
+            promise.setValue(5);
+
+            IntFuture result = promise.future().then(addOne);
+            ASSERT(result.isReady());
+            ASSERT(6 == result.value());
+            ASSERT(SELF == thread);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nErrors." << endl;
+        {
+            AddOne addOne = { 0 };
+
+            IntFuture result(&ta);
+            {
+                IntPromise promise(&ta);
+                result = promise.future().then(addOne).then(addOne);
+            }
+            ASSERT(result.isReady());
+            ASSERT(0 == result.status());
+            ASSERTV(result.value(),
+                    1 - Util::e_BROKEN_PROMISE == result.value());
+
+            IntPromise promise(&ta);
+            result = promise.future().then(addOne);
+            promise.setError(9);
+            ASSERT(-9 == result.value());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nValues that allocate." << endl;
+        {
+            Append append = { "!" };
+
+            StringPromise promise(&ta);
+            StringFuture  result = promise.future().then(append);
+
+            promise.setValue(LONG_STRING);
+            ASSERT(bsl::string(LONG_STRING) + "!" == result.value());
+            ASSERT(&ta == result.value().get_allocator().mechanism());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nContinuations that throw." << endl;
+        {
+            AddOne addOne = { 0 };
+
+            IntPromise promise(&ta);
+            IntFuture  thrown = promise.future().then(&throwValue);
+            IntFuture  result = thrown.then(addOne);
+            ASSERT(!result.isReady());
+
+            promise.setValue(3);
+            ASSERT(thrown.isReady());
+            ASSERTV(thrown.status(),
+                    Util::e_CONTINUATION_EXCEPTION == thrown.status());
+            ASSERT(result.isReady());
+            ASSERTV(result.value(),
+                    -Util::e_CONTINUATION_EXCEPTION == result.value());
+
+            thrown = promise.future().then(&throwValue);
+            ASSERT(thrown.isReady());
+            ASSERT(Util::e_CONTINUATION_EXCEPTION == thrown.status());
+
+            thrown = IntFuture(4, &ta).then(&throwValue);
+            ASSERT(thrown.isReady());
+            ASSERT(Util::e_CONTINUATION_EXCEPTION == thrown.status());
+
+            result = thrown.then(addOne);
+            ASSERT(-Util::e_CONTINUATION_EXCEPTION == result.value());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+#endif
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            AddOne addOne = { 0 };
+
+            ASSERT_FAIL(IntFuture().then(addOne));
+            ASSERT_PASS(IntFuture(1).then(addOne));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING READY FUTURES
+        //
+        // Concerns:
+        //: 1 A future created with a value or an error is ready, and holds the
+        //:   value or error.
+        //:
+        //: 2 Creating, copying, and continuing a ready future allocates no
+        //:   shared state; memory is allocated only for values that allocate.
+        //:
+        //: 3 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create ready futures with the value constructor, 'makeReady', and
+        //:   'makeError', copy them, and continue them with 'then', and verify
+        //:   the results and that no memory is allocated for 'int' values.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that the value of a ready 'bsl::string' future uses the
+        //:   supplied allocator.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a zero status.  (C-3)
+        //
+        // Testing:
+        //   Future(const TYPE& value, bslma::Allocator *basicAllocator = 0);
+        //   Future<TYPE> FutureUtil::makeError(int, bslma::Allocator *);
+        //   Future<TYPE> FutureUtil::makeReady(const TYPE&, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING READY FUTURES" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            const IntFuture X(3, &ta);
+            ASSERT(X.isValid());
+            ASSERT(X.isReady());
+            ASSERT(0 == X.status());
+            ASSERT(3 == X.value());
+            ASSERT(3 == X.get());
+            ASSERT(0 == X.wait());
+            ASSERT(&ta == X.allocator());
+
+            const IntFuture Y = Util::makeReady(4, &ta);
+            ASSERT(4 == Y.value());
+
+            const IntFuture E = Util::makeError<int>(5, &ta);
+            ASSERT(E.isValid());
+            ASSERT(E.isReady());
+            ASSERT(5 == E.status());
+            ASSERT(5 == E.wait());
+
+            IntFuture mX(X, &ta);
+            ASSERT(3 == mX.value());
+
+            mX = E;
+            ASSERT(5 == mX.status());
+
+            mX = Y;
+            ASSERT(4 == mX.value());
+
+            AddOne    addOne = { 0 };
+            IntFuture result = X.then(addOne).then(&twice).then(addOne);
+            ASSERT(result.isReady());
+            ASSERT(9 == result.value());
+
+            result = E.then(addOne);
+            ASSERT(-5 == result.value());
+
+            bsls::AtomicInt counter;
+            Increment       increment = { &counter };
+
+            ASSERT(X.then(increment).isReady());
+            ASSERT(1 == counter);
+        }
+        ASSERTV(ta.numAllocations(), 0 == ta.numAllocations());
+        ASSERTV(defaultAllocator.numAllocations(),
+                0 == defaultAllocator.numAllocations());
+
+        {
+            const StringFuture X(LONG_STRING, &ta);
+            ASSERT(LONG_STRING == X.value());
+            ASSERT(&ta == X.value().get_allocator().mechanism());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Util::makeError<int>(0));
+            ASSERT_PASS(Util::makeError<int>(1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'Promise' AND 'Future'
+        //
+        // Concerns:
+        //: 1 A default-constructed future is invalid and not ready.
+        //:
+        //: 2 The futures of a promise, and their copies, become ready when the
+        //:   promise is given a value or an error, or is destroyed.
+        //:
+        //: 3 'get' and 'wait' block until the future is ready.
+        //:
+        //: 4 Assignment makes a future share the state of another.
+        //:
+        //: 5 The state and value use the allocator of the promise, and all
+        //:   memory is released.
+        //:
+        //: 6 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Exercise the futures of promises given a value, an error, and
+        //:   destroyed, and verify their accessors.  (C-1..2, 4)
+        //:
+        //: 2 Wait for futures whose promise is set by a pool thread after a
+        //:   delay.  (C-3)
+        //:
+        //: 3 Use a test allocator, and verify its use and that it has no
+        //:   outstanding blocks at the end.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   Promise(bslma::Allocator *basicAllocator = 0);
+        //   ~Promise();
+        //   Future(bslma::Allocator *basicAllocator = 0);
+        //   Future(const Future& original, bslma::Allocator *ba = 0);
+        //   ~Future();
+        //   void Promise::setError(int status);
+        //   void Promise::setValue(const TYPE& value);
+        //   Future& Future::operator=(const Future& rhs);
+        //   Future<TYPE> Promise::future() const;
+        //   bslma::Allocator *Promise::allocator() const;
+        //   bool Future::isReady() const;
+        //   bool Future::isValid() const;
+        //   const TYPE& Future::get() const;
+        //   int Future::status() const;
+        //   const TYPE& Future::value() const;
+        //   int Future::wait() const;
+        //   bslma::Allocator *Future::allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'Promise' AND 'Future'" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nDefault-constructed future." << endl;
+        {
+            const IntFuture X(&ta);
+            ASSERT(!X.isValid());
+            ASSERT(!X.isReady());
+            ASSERT(&ta == X.allocator());
+
+            const IntFuture D;
+            ASSERT(&defaultAllocator == D.allocator());
+        }
+
+        if (verbose) cout << "\nSetting values." << endl;
+        {
+            StringPromise promise(&ta);
+            ASSERT(&ta == promise.allocator());
+            ASSERT(0 < ta.numBlocksInUse());
+
+            const StringFuture X = promise.future();
+            StringFuture       mY(&ta);
+
+            ASSERT(X.isValid());
+            ASSERT(!X.isReady());
+            ASSERT(!mY.isValid());
+
+            mY = X;
+            ASSERT(mY.isValid());
+            ASSERT(!mY.isReady());
+
+            promise.setValue(LONG_STRING);
+
+            ASSERT(X.isReady());
+            ASSERT(mY.isReady());
+            ASSERT(0 == X.status());
+            ASSERT(LONG_STRING == X.value());
+            ASSERT(LONG_STRING == mY.get());
+            ASSERT(&X.value() == &mY.value());
+            ASSERT(&ta == X.value().get_allocator().mechanism());
+            ASSERT(0 == mY.wait());
+
+            StringFuture mZ(X, &ta);
+            ASSERT(&X.value() == &mZ.value());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nSetting errors." << endl;
+        {
+            IntPromise promise(&ta);
+            IntFuture  future = promise.future();
+
+            promise.setError(42);
+            ASSERT(future.isReady());
+            ASSERT(42 == future.status());
+            ASSERT(42 == future.wait());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nBroken promises." << endl;
+        {
+            IntFuture future(&ta);
+            {
+                IntPromise promise(&ta);
+                future = promise.future();
+            }
+            ASSERT(future.isReady());
+            ASSERT(Util::e_BROKEN_PROMISE == future.status());
+
+            // A promise that was given a value is not broken.
+
+            {
+                IntPromise promise(&ta);
+                future = promise.future();
+                promise.setValue(1);
+            }
+            ASSERT(0 == future.status());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nWaiting." << endl;
+        {
+            bdlmt::FixedThreadPool pool(1, 100);
+            ASSERT(0 == pool.start());
+
+            IntPromise promise(&ta);
+            IntFuture  future = promise.future();
+
+            pool.enqueueJob(bdlf::BindUtil::bind(&setValueAfterDelay,
+                                                 &promise,
+                                                 17));
+            ASSERT(17 == future.get());
+
+            IntPromise other(&ta);
+            future = other.future();
+
+            pool.enqueueJob(bdlf::BindUtil::bind(&setValueAfterDelay,
+                                                 &other,
+                                                 18));
+            ASSERT(0 == future.wait());
+            ASSERT(18 == future.value());
+
+            pool.stop();
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            IntPromise promise;
+            IntFuture  future = promise.future();
+
+            ASSERT_FAIL(IntFuture().wait());
+            ASSERT_FAIL(future.status());
+            ASSERT_FAIL(future.value());
+            ASSERT_FAIL(promise.setError(0));
+
+            promise.setError(1);
+            ASSERT_PASS(future.status());
+            ASSERT_FAIL(future.value());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'Future_State'
+        //
+        // Concerns:
+        //: 1 A state is not ready until it is given a value or an error, and
+        //:   then holds it.
+        //:
+        //: 2 Callbacks added before the state is ready are invoked, in order,
+        //:   when it becomes ready; callbacks added after are invoked
+        //:   immediately.
+        //:
+        //: 3 The value is created using the allocator of the state, and is
+        //:   destroyed with the state.
+        //
+        // Plan:
+        //: 1 Create states, add callbacks incrementing a counter, set a value
+        //:   or an error, and verify the accessors and the counter.  (C-1..2)
+        //:
+        //: 2 Use a test allocator, and verify its use and that it has no
+        //:   outstanding blocks at the end.  (C-3)
+        //
+        // Testing:
+        //   Future_State
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'Future_State'" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            bdlmt::Future_State<bsl::string> mX(&ta);
+            ASSERT(!mX.isReady());
+            ASSERT(&ta == mX.allocator());
+
+            bsls::AtomicInt counter;
+            IntFuture       ready(1);
+            Increment       increment = { &counter };
+
+            mX.addCallback(bdlf::BindUtil::bind(increment, ready));
+            mX.addCallback(bdlf::BindUtil::bind(increment, ready));
+            ASSERT(0 == counter);
+
+            mX.setValue(LONG_STRING);
+            ASSERT(mX.isReady());
+            ASSERT(0 == mX.status());
+            ASSERT(LONG_STRING == mX.value());
+            ASSERT(&ta == mX.value().get_allocator().mechanism());
+            ASSERT(2 == counter);
+
+            mX.addCallback(bdlf::BindUtil::bind(increment, ready));
+            ASSERT(3 == counter);
+
+            mX.wait();
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        {
+            bdlmt::Future_State<bsl::string> mX(&ta);
+
+            mX.setError(-5);
+            ASSERT(mX.isReady());
+            ASSERT(-5 == mX.status());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a promise, attach a continuation to its future, set the
+        //:   promise from a pool thread, and verify the result.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            bdlmt::FixedThreadPool pool(2, 100);
+            ASSERT(0 == pool.start());
+
+            AddOne addOne = { 0 };
+
+            IntPromise promise;
+            IntFuture  result = promise.future().then(&pool, addOne);
+
+            ASSERT(!result.isReady());
+
+            pool.enqueueJob(bdlf::BindUtil::bind(&setValue, &promise, 41));
+
+            ASSERT(42 == result.get());
+
+            IntFuture ready(1);
+            ASSERT(2 == ready.then(addOne).value());
+
+            pool.stop();
+        }
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FAN-OUT/FAN-IN WITH FUTURES VS. A LATCH
+        //
+        // Concerns:
+        //: 1 Composing work with futures costs little more than synchronizing
+        //:   it by hand with a latch.
+        //
+        // Plan:
+        //: 1 Repeatedly fan a batch of jobs out to a pool and sum their
+        //:   results, once waiting on a 'bslmt::Latch' and summing in the
+        //:   calling thread, and once combining promises with 'whenAll' and
+        //:   summing in a continuation.  Also time a chain of continuations on
+        //:   pending and on ready futures.  The number of iterations is given
+        //:   by the second command-line argument (1000 by default).  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: FAN-OUT/FAN-IN WITH FUTURES VS. A LATCH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+          << "PERFORMANCE: FAN-OUT/FAN-IN WITH FUTURES VS. A LATCH" << endl
+          << "====================================================" << endl;
+
+        // Time allocation as in production, not through the test allocator.
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        bslma::DefaultAllocatorGuard benchmarkGuard(allocator);
+
+        const int NUM_ITERATIONS = verbose > 1 ? verbose : 1000;
+        const int NUM_JOBS       = 64;
+        const int NUM_THREADS    = 4;
+
+        bdlmt::FixedThreadPool pool(NUM_THREADS, 1000);
+        ASSERT(0 == pool.start());
+
+        bsls::Stopwatch timer;
+        int             checksum = 0;
+
+        {
+            bsl::vector<int> results(NUM_JOBS);
+
+            timer.reset();
+            timer.start();
+            for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+                bslmt::Latch latch(NUM_JOBS);
+
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&workWithLatch,
+                                                         &results[i],
+                                                         i + iteration,
+                                                         &latch));
+                }
+                latch.wait();
+                checksum += bsl::accumulate(results.begin(),
+                                            results.end(),
+                                            0);
+
+                // Both loops drain the pool, so that each batch starts with
+                // idle threads.
+
+                pool.drain();
+            }
+            timer.stop();
+            cout << "latch:   " << timer.elapsedTime() << "s" << endl;
+        }
+        {
+            timer.reset();
+            timer.start();
+            for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+                bsl::vector<IntPromise *> promises(NUM_JOBS);
+                bsl::vector<IntFuture>    futures;
+
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    promises[i] = new (*allocator) IntPromise();
+                    futures.push_back(promises[i]->future());
+                }
+
+                IntFuture sum = Util::whenAll(futures.begin(), futures.end())
+                                                                 .then(Sum());
+
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&workWithPromise,
+                                                         promises[i],
+                                                         i + iteration));
+                }
+                checksum -= sum.get();
+
+                pool.drain();
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    allocator->deleteObject(promises[i]);
+                }
+            }
+            timer.stop();
+            cout << "futures: " << timer.elapsedTime() << "s" << endl;
+        }
+        ASSERTV(checksum, 0 == checksum);
+
+        {
+            const int CHAIN = 1000;
+
+            AddOne addOne = { 0 };
+
+            timer.reset();
+            timer.start();
+            for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+                IntPromise promise;
+                IntFuture  future = promise.future();
+
+                for (int i = 0; i < CHAIN; ++i) {
+                    future = future.then(addOne);
+                }
+                promise.setValue(0);
+                ASSERT(CHAIN == future.value());
+            }
+            timer.stop();
+            cout << "pending chain of " << CHAIN << ": "
+                 << timer.elapsedTime() / NUM_ITERATIONS * 1e6 << "us"
+                 << endl;
+
+            timer.reset();
+            timer.start();
+            for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+                IntFuture future(0);
+
+                for (int i = 0; i < CHAIN; ++i) {
+                    future = future.then(addOne);
+                }
+                ASSERT(CHAIN == future.value());
+            }
+            timer.stop();
+            cout << "ready chain of " << CHAIN << ":   "
+                 << timer.elapsedTime() / NUM_ITERATIONS * 1e6 << "us"
+                 << endl;
+        }
+
+        pool.stop();
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == globalAllocator.numAllocations());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
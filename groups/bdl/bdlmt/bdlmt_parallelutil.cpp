@@ -0,0 +1,110 @@
+// bdlmt_parallelutil.cpp                                             -*-C++-*-
+#include <bdlmt_parallelutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_parallelutil_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+
+///Implementation Notes
+///--------------------
+// A 'ParallelUtil_Scheduler' is shared, through a 'bsl::shared_ptr', by the
+// thread calling an algorithm and the jobs that it enqueues, because a job may
+// not start until after the algorithm has returned (for example, if the pool
+// was busy and the calling thread processed every chunk itself).  Such a job
+// fails to claim a chunk and returns without accessing the task, which refers
+// to objects on the stack of the calling thread; the task is accessed only
+// after a chunk has been claimed, and the calling thread does not return
+// before every claimed chunk has been processed.
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                          // -----------------------
+                          // class ParallelUtil_Task
+                          // -----------------------
+
+// CREATORS
+ParallelUtil_Task::~ParallelUtil_Task()
+{
+}
+
+                        // ----------------------------
+                        // class ParallelUtil_Scheduler
+                        // ----------------------------
+
+// CREATORS
+ParallelUtil_Scheduler::ParallelUtil_Scheduler(ParallelUtil_Task *task,
+                                               bsl::size_t        numChunks)
+: d_nextChunk(0)
+, d_numRemaining(static_cast<bsls::Types::Int64>(numChunks))
+, d_numChunks(static_cast<bsls::Types::Int64>(numChunks))
+, d_task_p(task)
+, d_isComplete(false)
+{
+    BSLS_ASSERT(task);
+    BSLS_ASSERT(0 < numChunks);
+}
+
+// MANIPULATORS
+void ParallelUtil_Scheduler::participate()
+{
+    while (true) {
+        const bsls::Types::Int64 chunk = d_nextChunk.addRelaxed(1) - 1;
+
+        if (chunk >= d_numChunks) {
+            return;                                                   // RETURN
+        }
+
+        d_task_p->execute(static_cast<bsl::size_t>(chunk));
+
+        if (0 == d_numRemaining.addAcqRel(-1)) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_isComplete = true;
+            d_condition.broadcast();
+        }
+    }
+}
+
+void ParallelUtil_Scheduler::wait()
+{
+    if (0 == d_numRemaining.loadAcquire()) {
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (!d_isComplete) {
+        d_condition.wait(&d_mutex);
+    }
+}
+
+                         // --------------------------
+                         // struct ParallelUtil_Helper
+                         // --------------------------
+
+// ACCESSORS
+void ParallelUtil_Helper::operator()() const
+{
+    d_scheduler->participate();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1663 @@
+// bdlmt_parallelutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLMT_PARALLELUTIL
+#define INCLUDED_BDLMT_PARALLELUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide parallel algorithms that run on a caller-supplied pool.
+//
+//@CLASSES:
+//  bdlmt::ParallelUtil: namespace for parallel algorithms over ranges
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool,
+//           bdlmt_workstealingthreadpool
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlmt::ParallelUtil',
+// that serves as a namespace for parallel versions of common algorithms over
+// ranges of random-access iterators: 'forEach', 'transform', 'reduce',
+// 'transformReduce', 'inclusiveScan', 'partition', and 'sort'.  Each algorithm
+// has the same effect as the like-named standard algorithm (or, for
+// 'inclusiveScan', 'reduce', and 'transformReduce', the standard algorithm
+// invoked with an execution policy), but spreads the work over the threads of
+// a thread pool supplied by the caller.
+//
+///Pool Requirements
+///-----------------
+// The 'POOL' template parameter of each algorithm may be
+// 'bdlmt::FixedThreadPool', 'bdlmt::ThreadPool',
+// 'bdlmt::WorkStealingThreadPool', or any other type providing:
+//..
+//  int enqueueJob(const bsl::function<void()>& job);
+//      // Enqueue the specified 'job', and return 0 on success, and a non-zero
+//      // value otherwise.
+//
+//  int numThreads() const;
+//      // Return the number of threads that execute jobs.
+//..
+// For 'bdlmt::ThreadPool', the maximum number of threads is used in place of
+// 'numThreads'.
+//
+// The pool is not required to be started: if it does not accept a job, or
+// does not run it promptly, the calling thread processes the work that the
+// job would have processed.
+//
+///Chunking
+///--------
+// Each algorithm divides its range into contiguous chunks of (nearly) equal
+// length and enqueues at most one job per thread of the pool, and the calling
+// thread then takes part in the computation.  The participating threads
+// repeatedly claim the next unprocessed chunk, with a single atomic
+// increment, until none remain.  The number of chunks adapts to the length of
+// the range and the size of the pool: there are several chunks per thread, so
+// that threads that are delayed (for example, by other jobs in the pool) or
+// that are handed more expensive elements do not hold up the others, but never
+// more chunks than elements.  If the pool has a single thread or the range
+// has fewer than two elements, the algorithm runs entirely in the calling
+// thread without enqueuing any job.
+//
+// Because the calling thread processes chunks itself, an algorithm can be
+// called from a job running in the same pool without risk of deadlock, even if
+// every other thread in the pool is busy.
+//
+///Requirements on Functors
+///------------------------
+// The functors supplied to an algorithm are invoked concurrently, from
+// several threads, on distinct elements, and must be safe to invoke in that
+// manner.  The binary operations supplied to 'reduce', 'transformReduce', and
+// 'inclusiveScan' must be associative; the elements are combined in an
+// unspecified grouping, but their order is preserved, so the operations need
+// not be commutative.  Functors and the element types' operations must not
+// throw.
+//
+///Memory Allocation
+///-----------------
+// Each algorithm takes an optional 'basicAllocator' argument, following its
+// functors, that supplies the temporary memory it needs: the state shared
+// with the jobs it enqueues, the jobs themselves, per-chunk partial results,
+// and, for 'sort', a buffer with room for every element of the range, used
+// to merge the sorted blocks.  If 'basicAllocator' is not supplied, the
+// currently installed default allocator is used.  All of this memory is
+// allocated in the calling thread, before any job is enqueued, so that an
+// allocation failure is reported to the caller (by an exception) and never
+// occurs in a thread of the pool.  Note that supplying 'basicAllocator'
+// requires supplying the optional functors that precede it.
+//
+// A job enqueued by an algorithm may not start until after the algorithm has
+// returned (see {Pool Requirements}); such a job does no work, but returns a
+// small block of shared state to the allocator that supplied it.  Therefore,
+// 'basicAllocator' must remain valid until every job enqueued by the
+// algorithm has run, for example until the pool has been drained or stopped.
+//
+///Thread Safety
+///-------------
+// The algorithms of 'bdlmt::ParallelUtil' may be called concurrently from any
+// number of threads, on the same pool, provided that the ranges they modify do
+// not overlap.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sorting and Summing on a Thread Pool
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we sort a large array of integers, and then compute the sum
+// of their squares, using the threads of a 'bdlmt::FixedThreadPool'.
+//
+// First, we define a functor that returns the square of its argument:
+//..
+//  struct Square {
+//      // ACCESSORS
+//      bsls::Types::Int64 operator()(int value) const
+//      {
+//          return static_cast<bsls::Types::Int64>(value) * value;
+//      }
+//  };
+//..
+// Then, we create and start a pool of four threads:
+//..
+//  bdlmt::FixedThreadPool pool(4, 100);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we create the data, in descending order:
+//..
+//  bsl::vector<int> data(100000);
+//  for (bsl::size_t i = 0; i < data.size(); ++i) {
+//      data[i] = static_cast<int>(data.size() - i);
+//  }
+//..
+// Then, we sort the data on the pool:
+//..
+//  bdlmt::ParallelUtil::sort(&pool, data.begin(), data.end());
+//
+//  assert(1      == data.front());
+//  assert(100000 == data.back());
+//..
+// Finally, we compute the sum of squares, converting each element to a 64-bit
+// integer before it is squared and summed:
+//..
+//  bsls::Types::Int64 sum = bdlmt::ParallelUtil::transformReduce(
+//                                       &pool,
+//                                       data.begin(),
+//                                       data.end(),
+//                                       bsls::Types::Int64(0),
+//                                       bsl::plus<bsls::Types::Int64>(),
+//                                       Square());
+//
+//  assert(333338333350000LL == sum);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlmt_threadpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_memory.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                          // =======================
+                          // class ParallelUtil_Task
+                          // =======================
+
+class ParallelUtil_Task {
+    // This component-private protocol class provides the interface through
+    // which the threads taking part in a parallel algorithm process the chunks
+    // of its range.
+
+  public:
+    // CREATORS
+    virtual ~ParallelUtil_Task();
+        // Destroy this object.
+
+    // MANIPULATORS
+    virtual void execute(bsl::size_t chunkIndex) = 0;
+        // Process the chunk having the specified 'chunkIndex'.
+};
+
+                       // ==============================
+                       // class ParallelUtil_TaskAdapter
+                       // ==============================
+
+template <class CHUNK_FUNCTOR>
+class ParallelUtil_TaskAdapter : public ParallelUtil_Task {
+    // This component-private class template implements the
+    // 'ParallelUtil_Task' protocol by invoking a (non-owned) functor of the
+    // parameterized 'CHUNK_FUNCTOR' type with the index of each chunk.
+
+    // DATA
+    CHUNK_FUNCTOR *d_functor_p;  // functor processing a chunk (held)
+
+  public:
+    // CREATORS
+    explicit ParallelUtil_TaskAdapter(CHUNK_FUNCTOR *functor);
+        // Create a task that processes each chunk by invoking the specified
+        // 'functor' with the index of the chunk.
+
+    // MANIPULATORS
+    void execute(bsl::size_t chunkIndex) BSLS_KEYWORD_OVERRIDE;
+        // Invoke the functor held by this task with the specified
+        // 'chunkIndex'.
+};
+
+                        // ============================
+                        // class ParallelUtil_Scheduler
+                        // ============================
+
+class ParallelUtil_Scheduler {
+    // This component-private class hands out the chunks of a parallel
+    // algorithm to the threads taking part in it, and allows the thread that
+    // started the algorithm to wait until every chunk has been processed.  An
+    // object of this class is shared by the calling thread and the jobs it
+    // enqueues, which may start after the algorithm has completed; the task
+    // is accessed only while chunks remain to be processed.
+
+    // DATA
+    bsls::AtomicInt64        d_nextChunk;     // index of next chunk to claim
+
+    bsls::AtomicInt64        d_numRemaining;  // number of chunks not yet
+                                              // processed
+
+    const bsls::Types::Int64 d_numChunks;     // total number of chunks
+
+    ParallelUtil_Task       *d_task_p;        // task processing each chunk
+                                              // (held, not owned)
+
+    bool                     d_isComplete;    // 'true' once every chunk has
+                                              // been processed
+
+    bslmt::Mutex             d_mutex;         // protects 'd_isComplete'
+
+    bslmt::Condition         d_condition;     // signaled when 'd_isComplete'
+                                              // is set
+
+  private:
+    // NOT IMPLEMENTED
+    ParallelUtil_Scheduler(const ParallelUtil_Scheduler&);
+    ParallelUtil_Scheduler& operator=(const ParallelUtil_Scheduler&);
+
+  public:
+    // CREATORS
+    ParallelUtil_Scheduler(ParallelUtil_Task *task, bsl::size_t numChunks);
+        // Create a scheduler that hands out the specified 'numChunks' chunks
+        // to be processed by the specified 'task'.  The behavior is undefined
+        // unless '0 < numChunks'.
+
+    // MANIPULATORS
+    void participate();
+        // Repeatedly claim the next unprocessed chunk and process it with the
+        // task held by this object, until no chunk remains to be claimed.
+
+    void wait();
+        // Block until every chunk has been processed.
+};
+
+                         // ==========================
+                         // struct ParallelUtil_Helper
+                         // ==========================
+
+struct ParallelUtil_Helper {
+    // This component-private 'struct' is the job that a parallel algorithm
+    // enqueues on the pool, once per thread that is to take part in the
+    // algorithm.
+
+    // DATA
+    bsl::shared_ptr<ParallelUtil_Scheduler> d_scheduler;  // shared scheduler
+
+    // ACCESSORS
+    void operator()() const;
+        // Take part in the algorithm of the scheduler held by this object.
+};
+
+                       // ==============================
+                       // struct ParallelUtil_PoolTraits
+                       // ==============================
+
+template <class POOL>
+struct ParallelUtil_PoolTraits {
+    // This component-private 'struct' template provides the number of threads
+    // of a pool of the parameterized 'POOL' type.
+
+    // CLASS METHODS
+    static int numThreads(const POOL& pool);
+        // Return 'pool.numThreads()'.
+};
+
+template <>
+struct ParallelUtil_PoolTraits<ThreadPool> {
+    // This specialization provides the number of threads of a
+    // 'bdlmt::ThreadPool'.
+
+    // CLASS METHODS
+    static int numThreads(const ThreadPool& pool);
+        // Return 'pool.maxThreads()'.
+};
+
+                          // =======================
+                          // struct ParallelUtil_Imp
+                          // =======================
+
+struct ParallelUtil_Imp {
+    // This component-private 'struct' provides a namespace for the functions
+    // used to divide a range into chunks and process them on a pool.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_CHUNKS_PER_THREAD = 4,   // chunks per pool thread, allowing threads
+                                   // that fall behind to be compensated for
+
+        k_MIN_SORT_BLOCK    = 4096 // minimum length of the blocks that 'sort'
+                                   // sorts independently before merging
+    };
+
+    // CLASS METHODS
+    static bsl::size_t chunkBoundary(bsl::size_t length,
+                                     bsl::size_t numChunks,
+                                     bsl::size_t chunkIndex);
+        // Return the offset of the first element of the chunk having the
+        // specified 'chunkIndex' when a range of the specified 'length' is
+        // divided into the specified 'numChunks' chunks of (nearly) equal
+        // length, or 'length' if 'chunkIndex == numChunks'.  The behavior is
+        // undefined unless '0 < numChunks' and 'chunkIndex <= numChunks'.
+
+    template <class POOL>
+    static bsl::size_t numChunks(const POOL& pool, bsl::size_t length);
+        // Return the number of chunks into which a range of the specified
+        // 'length' is divided for processing on the specified 'pool'.  The
+        // result is 1 if 'pool' has a single thread and 'length' is not 0, and
+        // is never greater than 'length'.
+
+    template <class POOL>
+    static void run(POOL              *pool,
+                    bsl::size_t        numChunks,
+                    ParallelUtil_Task *task,
+                    bslma::Allocator  *allocator);
+        // Process, with the specified 'task', the specified 'numChunks'
+        // chunks, in the calling thread and in jobs enqueued on the specified
+        // 'pool', and return once all have been processed.  Use the
+        // specified 'allocator' to supply the state shared with the jobs and
+        // the jobs themselves.  The behavior is undefined unless 'allocator'
+        // is not null.
+
+    template <class POOL, class CHUNK_FUNCTOR>
+    static void runChunks(POOL             *pool,
+                          bsl::size_t       numChunks,
+                          CHUNK_FUNCTOR    *functor,
+                          bslma::Allocator *allocator);
+        // Invoke the specified 'functor' with each index in the range
+        // '[0 .. numChunks)', where 'numChunks' is specified, in the calling
+        // thread and in jobs enqueued on the specified 'pool', and return
+        // once all invocations have completed.  Use the specified 'allocator'
+        // to supply memory.  The behavior is undefined unless 'allocator' is
+        // not null.
+};
+
+                   // =====================================
+                   // Component-private chunk functor types
+                   // =====================================
+
+template <class RANDOM_IT, class FUNCTION>
+struct ParallelUtil_ForEachChunk {
+    // This component-private 'struct' template applies a function to each
+    // element of a chunk.
+
+    // DATA
+    RANDOM_IT    d_first;      // start of the range
+    bsl::size_t  d_length;     // length of the range
+    bsl::size_t  d_numChunks;  // number of chunks
+    FUNCTION    *d_function_p; // function to apply (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Apply the function to each element of the chunk having the
+        // specified 'chunkIndex'.
+};
+
+template <class INPUT_IT, class OUTPUT_IT, class UNARY_OP>
+struct ParallelUtil_TransformChunk {
+    // This component-private 'struct' template stores the result of applying
+    // a unary operation to each element of a chunk.
+
+    // DATA
+    INPUT_IT     d_first;       // start of the input range
+    OUTPUT_IT    d_result;      // start of the output range
+    bsl::size_t  d_length;      // length of the ranges
+    bsl::size_t  d_numChunks;   // number of chunks
+    UNARY_OP    *d_operation_p; // operation to apply (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Store the result of the operation on each element of the chunk
+        // having the specified 'chunkIndex' to the output range.
+};
+
+template <class INPUT_IT1, class INPUT_IT2, class OUTPUT_IT, class BINARY_OP>
+struct ParallelUtil_BinaryTransformChunk {
+    // This component-private 'struct' template stores the result of applying
+    // a binary operation to each pair of corresponding elements of a chunk of
+    // two ranges.
+
+    // DATA
+    INPUT_IT1    d_first1;      // start of the first input range
+    INPUT_IT2    d_first2;      // start of the second input range
+    OUTPUT_IT    d_result;      // start of the output range
+    bsl::size_t  d_length;      // length of the ranges
+    bsl::size_t  d_numChunks;   // number of chunks
+    BINARY_OP   *d_operation_p; // operation to apply (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Store the result of the operation on each pair of elements of the
+        // chunk having the specified 'chunkIndex' to the output range.
+};
+
+struct ParallelUtil_Identity {
+    // This component-private 'struct' provides a unary functor returning its
+    // argument.
+
+    // ACCESSORS
+    template <class TYPE>
+    const TYPE& operator()(const TYPE& value) const;
+        // Return the specified 'value'.
+};
+
+template <class RANDOM_IT, class TYPE, class REDUCE_OP, class TRANSFORM_OP>
+struct ParallelUtil_TransformReduceChunk {
+    // This component-private 'struct' template computes the reduction of the
+    // transformed elements of a chunk.
+
+    // DATA
+    RANDOM_IT                 d_first;        // start of the range
+    bsl::size_t               d_length;       // length of the range
+    bsl::size_t               d_numChunks;    // number of chunks
+    bsls::ObjectBuffer<TYPE> *d_partials_p;   // result of each chunk
+    REDUCE_OP                *d_reduce_p;     // reduction (held)
+    TRANSFORM_OP             *d_transform_p;  // transformation (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Construct, at the element of the array of partial results having
+        // the specified 'chunkIndex', the reduction of the transformed
+        // elements of the chunk having 'chunkIndex'.
+};
+
+template <class RANDOM_IT1,
+          class RANDOM_IT2,
+          class TYPE,
+          class REDUCE_OP,
+          class TRANSFORM_OP>
+struct ParallelUtil_BinaryTransformReduceChunk {
+    // This component-private 'struct' template computes the reduction of the
+    // results of a binary transformation of the pairs of corresponding
+    // elements of a chunk of two ranges.
+
+    // DATA
+    RANDOM_IT1                d_first1;       // start of the first range
+    RANDOM_IT2                d_first2;       // start of the second range
+    bsl::size_t               d_length;       // length of the ranges
+    bsl::size_t               d_numChunks;    // number of chunks
+    bsls::ObjectBuffer<TYPE> *d_partials_p;   // result of each chunk
+    REDUCE_OP                *d_reduce_p;     // reduction (held)
+    TRANSFORM_OP             *d_transform_p;  // transformation (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Construct, at the element of the array of partial results having
+        // the specified 'chunkIndex', the reduction of the transformed pairs
+        // of elements of the chunk having 'chunkIndex'.
+};
+
+template <class RANDOM_IT, class OUTPUT_IT, class TYPE, class BINARY_OP>
+struct ParallelUtil_ScanChunk {
+    // This component-private 'struct' template stores the inclusive scan of
+    // a chunk, starting from the reduction of the preceding chunks.
+
+    // DATA
+    RANDOM_IT                       d_first;       // start of input range
+    OUTPUT_IT                       d_result;      // start of output range
+    bsl::size_t                     d_length;      // length of the ranges
+    bsl::size_t                     d_numChunks;   // number of chunks
+    const bsls::ObjectBuffer<TYPE> *d_prefixes_p;  // reduction of chunks
+                                                   // '[0 .. i]' at index 'i'
+    BINARY_OP                      *d_operation_p; // operation (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Store the inclusive scan of the chunk having the specified
+        // 'chunkIndex', combined with the reduction of the preceding chunks,
+        // to the output range.
+};
+
+template <class RANDOM_IT, class PREDICATE>
+struct ParallelUtil_PartitionChunk {
+    // This component-private 'struct' template partitions each chunk of a
+    // range independently.
+
+    // DATA
+    RANDOM_IT    d_first;        // start of the range
+    bsl::size_t  d_length;       // length of the range
+    bsl::size_t  d_numChunks;    // number of chunks
+    bsl::size_t *d_numTrue_p;    // number of elements satisfying the
+                                 // predicate in each chunk
+    PREDICATE   *d_predicate_p;  // predicate (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Partition the chunk having the specified 'chunkIndex', and store
+        // the number of its elements satisfying the predicate.
+};
+
+template <class RANDOM_IT>
+struct ParallelUtil_SwapChunk {
+    // This component-private 'struct' template exchanges the elements of two
+    // equal-length sequences of segments of a range, where the sequences are
+    // divided into chunks.
+
+    typedef bsl::pair<bsl::size_t, bsl::size_t> Segment;
+        // '[first, second)' offsets of a segment of elements
+
+    // DATA
+    RANDOM_IT                  d_first;       // start of the range
+    bsl::size_t                d_length;      // length of each sequence
+    bsl::size_t                d_numChunks;   // number of chunks
+    const bsl::vector<Segment> *d_left_p;     // first sequence of segments
+    const bsl::vector<Segment> *d_right_p;    // second sequence of segments
+    const bsl::vector<bsl::size_t>
+                               *d_leftStarts_p;
+                                              // offset in the first sequence
+                                              // of each of its segments
+    const bsl::vector<bsl::size_t>
+                               *d_rightStarts_p;
+                                              // offset in the second
+                                              // sequence of each of its
+                                              // segments
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Exchange the elements of the chunk having the specified
+        // 'chunkIndex' of the first sequence of segments with those of the
+        // same chunk of the second sequence.
+};
+
+template <class RANDOM_IT, class COMPARATOR>
+struct ParallelUtil_SortChunk {
+    // This component-private 'struct' template sorts each block of a range
+    // independently.
+
+    // DATA
+    RANDOM_IT    d_first;         // start of the range
+    bsl::size_t  d_length;        // length of the range
+    bsl::size_t  d_numBlocks;     // number of blocks
+    COMPARATOR  *d_comparator_p;  // comparator (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Sort the block having the specified 'chunkIndex'.
+};
+
+template <class RANDOM_IT, class COMPARATOR>
+struct ParallelUtil_MergeChunk {
+    // This component-private 'struct' template merges pairs of adjacent runs
+    // of sorted blocks, through a caller-supplied buffer having an element
+    // for each element of the range.
+
+    // TYPES
+    typedef typename bsl::iterator_traits<RANDOM_IT>::value_type ValueType;
+        // type of the elements of the range
+
+    // DATA
+    RANDOM_IT                      d_first;         // start of the range
+    bsl::size_t                    d_length;        // length of the range
+    bsl::size_t                    d_numBlocks;     // number of blocks
+    bsl::size_t                    d_width;         // number of blocks in
+                                                    // each sorted run
+    bsls::ObjectBuffer<ValueType> *d_buffer_p;      // uninitialized buffer
+                                                    // of 'd_length' elements
+    COMPARATOR                    *d_comparator_p;  // comparator (held)
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const;
+        // Merge the pair of sorted runs having the specified 'chunkIndex',
+        // moving the first run to the corresponding elements of the buffer
+        // and merging it with the second run back into the range.  No memory
+        // is allocated.
+};
+
+                            // ===================
+                            // struct ParallelUtil
+                            // ===================
+
+struct ParallelUtil {
+    // This 'struct' provides a namespace for parallel algorithms over ranges
+    // of random-access iterators, which run on a thread pool supplied by the
+    // caller.  See the component-level documentation for the requirements on
+    // the pool and on the supplied functors.
+
+    // CLASS METHODS
+    template <class POOL, class RANDOM_IT, class FUNCTION>
+    static void forEach(POOL             *pool,
+                        RANDOM_IT         first,
+                        RANDOM_IT         last,
+                        FUNCTION          function,
+                        bslma::Allocator *basicAllocator = 0);
+        // Invoke the specified 'function' on each element of the range
+        // '[first .. last)', where 'first' and 'last' are specified, using the
+        // threads of the specified 'pool' and the calling thread.  Optionally
+        // specify a 'basicAllocator' used to supply temporary memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class POOL, class RANDOM_IT, class OUTPUT_IT>
+    static OUTPUT_IT inclusiveScan(POOL      *pool,
+                                   RANDOM_IT  first,
+                                   RANDOM_IT  last,
+                                   OUTPUT_IT  result);
+    template <class POOL, class RANDOM_IT, class OUTPUT_IT, class BINARY_OP>
+    static OUTPUT_IT inclusiveScan(POOL             *pool,
+                                   RANDOM_IT         first,
+                                   RANDOM_IT         last,
+                                   OUTPUT_IT         result,
+                                   BINARY_OP         operation,
+                                   bslma::Allocator *basicAllocator = 0);
+        // Store, to the range starting at the specified 'result', the
+        // inclusive scan of the range '[first .. last)', where 'first' and
+        // 'last' are specified, using the threads of the specified 'pool' and
+        // the calling thread, and return the end of the output range.  The
+        // 'i'th output element is the combination, using the optionally
+        // specified (associative) 'operation', of the first 'i + 1' input
+        // elements; if 'operation' is not specified, 'operator+' is used.
+        // The output range must have random-access iterators, and may be the
+        // input range, but must not otherwise overlap it.  Optionally specify
+        // a 'basicAllocator' used to supply temporary memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class POOL, class RANDOM_IT, class PREDICATE>
+    static RANDOM_IT partition(POOL             *pool,
+                               RANDOM_IT         first,
+                               RANDOM_IT         last,
+                               PREDICATE         predicate,
+                               bslma::Allocator *basicAllocator = 0);
+        // Reorder the elements of the range '[first .. last)', where 'first'
+        // and 'last' are specified, such that all elements for which the
+        // specified 'predicate' returns 'true' precede all elements for which
+        // it returns 'false', using the threads of the specified 'pool' and
+        // the calling thread.  Return an iterator to the first element for
+        // which 'predicate' returns 'false', or 'last' if there is none.  The
+        // relative order of the elements is not preserved.  Optionally
+        // specify a 'basicAllocator' used to supply temporary memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class POOL, class RANDOM_IT, class TYPE>
+    static TYPE reduce(POOL        *pool,
+                       RANDOM_IT    first,
+                       RANDOM_IT    last,
+                       const TYPE&  initialValue);
+    template <class POOL, class RANDOM_IT, class TYPE, class BINARY_OP>
+    static TYPE reduce(POOL             *pool,
+                       RANDOM_IT         first,
+                       RANDOM_IT         last,
+                       const TYPE&       initialValue,
+                       BINARY_OP         operation,
+                       bslma::Allocator *basicAllocator = 0);
+        // Return the combination of the specified 'initialValue' and the
+        // elements of the range '[first .. last)', where 'first' and 'last'
+        // are specified, in that order, using the optionally specified
+        // (associative) 'operation', computed using the threads of the
+        // specified 'pool' and the calling thread.  If 'operation' is not
+        // specified, 'operator+' is used.  Optionally specify a
+        // 'basicAllocator' used to supply temporary memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class POOL, class RANDOM_IT>
+    static void sort(POOL *pool, RANDOM_IT first, RANDOM_IT last);
+    template <class POOL, class RANDOM_IT, class COMPARATOR>
+    static void sort(POOL             *pool,
+                     RANDOM_IT         first,
+                     RANDOM_IT         last,
+                     COMPARATOR        comparator,
+                     bslma::Allocator *basicAllocator = 0);
+        // Sort the elements of the range '[first .. last)', where 'first'
+        // and 'last' are specified, in ascending order according to the
+        // optionally specified 'comparator', using the threads of the
+        // specified 'pool' and the calling thread.  If 'comparator' is not
+        // specified, 'operator<' is used.  The sort is not stable.
+        // Optionally specify a 'basicAllocator' used to supply temporary
+        // memory, including a buffer for every element of the range if the
+        // range is sorted in more than one block.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    template <class POOL, class INPUT_IT, class OUTPUT_IT, class UNARY_OP>
+    static OUTPUT_IT transform(POOL             *pool,
+                               INPUT_IT          first,
+                               INPUT_IT          last,
+                               OUTPUT_IT         result,
+                               UNARY_OP          operation,
+                               bslma::Allocator *basicAllocator = 0);
+        // Store, to the range starting at the specified 'result', the result
+        // of applying the specified 'operation' to each element of the range
+        // '[first .. last)', where 'first' and 'last' are specified, using
+        // the threads of the specified 'pool' and the calling thread, and
+        // return the end of the output range.  Both ranges must have
+        // random-access iterators.  Optionally specify a 'basicAllocator'
+        // used to supply temporary memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.
+
+    template <class POOL,
+              class INPUT_IT1,
+              class INPUT_IT2,
+              class OUTPUT_IT,
+              class BINARY_OP>
+    static OUTPUT_IT transform(POOL             *pool,
+                               INPUT_IT1         first1,
+                               INPUT_IT1         last1,
+                               INPUT_IT2         first2,
+                               OUTPUT_IT         result,
+                               BINARY_OP         operation,
+                               bslma::Allocator *basicAllocator = 0);
+        // Store, to the range starting at the specified 'result', the result
+        // of applying the specified 'operation' to each element of the range
+        // '[first1 .. last1)', where 'first1' and 'last1' are specified, and
+        // the corresponding element of the range starting at the specified
+        // 'first2', using the threads of the specified 'pool' and the calling
+        // thread, and return the end of the output range.  All three ranges
+        // must have random-access iterators.  Optionally specify a
+        // 'basicAllocator' used to supply temporary memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class POOL,
+              class RANDOM_IT,
+              class TYPE,
+              class REDUCE_OP,
+              class TRANSFORM_OP>
+    static TYPE transformReduce(POOL             *pool,
+                                RANDOM_IT         first,
+                                RANDOM_IT         last,
+                                const TYPE&       initialValue,
+                                REDUCE_OP         reduce,
+                                TRANSFORM_OP      transform,
+                                bslma::Allocator *basicAllocator = 0);
+        // Return the combination of the specified 'initialValue' and the
+        // results of applying the specified 'transform' to the elements of
+        // the range '[first .. last)', where 'first' and 'last' are
+        // specified, in that order, using the specified (associative)
+        // 'reduce', computed using the threads of the specified 'pool' and
+        // the calling thread.  Optionally specify a 'basicAllocator' used to
+        // supply temporary memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    template <class POOL,
+              class RANDOM_IT1,
+              class RANDOM_IT2,
+              class TYPE,
+              class REDUCE_OP,
+              class TRANSFORM_OP>
+    static TYPE transformReduce(POOL             *pool,
+                                RANDOM_IT1        first1,
+                                RANDOM_IT1        last1,
+                                RANDOM_IT2        first2,
+                                const TYPE&       initialValue,
+                                REDUCE_OP         reduce,
+                                TRANSFORM_OP      transform,
+                                bslma::Allocator *basicAllocator = 0);
+        // Return the combination of the specified 'initialValue' and the
+        // results of applying the specified 'transform' to the elements of
+        // the range '[first1 .. last1)', where 'first1' and 'last1' are
+        // specified, and the corresponding elements of the range starting at
+        // the specified 'first2', in that order, using the specified
+        // (associative) 'reduce', computed using the threads of the specified
+        // 'pool' and the calling thread.  Optionally specify a
+        // 'basicAllocator' used to supply temporary memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+};
+
+               // ==============================================
+               //                             INLINE DEFINITIONS
+               // ==============================================
+
+                       // ------------------------------
+                       // class ParallelUtil_TaskAdapter
+                       // ------------------------------
+
+// CREATORS
+template <class CHUNK_FUNCTOR>
+inline
+ParallelUtil_TaskAdapter<CHUNK_FUNCTOR>::ParallelUtil_TaskAdapter(
+                                                        CHUNK_FUNCTOR *functor)
+: d_functor_p(functor)
+{
+}
+
+// MANIPULATORS
+template <class CHUNK_FUNCTOR>
+void ParallelUtil_TaskAdapter<CHUNK_FUNCTOR>::execute(bsl::size_t chunkIndex)
+{
+    (*d_functor_p)(chunkIndex);
+}
+
+                       // ------------------------------
+                       // struct ParallelUtil_PoolTraits
+                       // ------------------------------
+
+// CLASS METHODS
+template <class POOL>
+inline
+int ParallelUtil_PoolTraits<POOL>::numThreads(const POOL& pool)
+{
+    return pool.numThreads();
+}
+
+inline
+int ParallelUtil_PoolTraits<ThreadPool>::numThreads(const ThreadPool& pool)
+{
+    return pool.maxThreads();
+}
+
+                          // -----------------------
+                          // struct ParallelUtil_Imp
+                          // -----------------------
+
+// CLASS METHODS
+inline
+bsl::size_t ParallelUtil_Imp::chunkBoundary(bsl::size_t length,
+                                            bsl::size_t numChunks,
+                                            bsl::size_t chunkIndex)
+{
+    BSLS_ASSERT(0 < numChunks);
+    BSLS_ASSERT(chunkIndex <= numChunks);
+
+    return length / numChunks * chunkIndex
+         + bsl::min(chunkIndex, length % numChunks);
+}
+
+template <class POOL>
+inline
+bsl::size_t ParallelUtil_Imp::numChunks(const POOL& pool, bsl::size_t length)
+{
+    const int numThreads = ParallelUtil_PoolTraits<POOL>::numThreads(pool);
+
+    if (numThreads <= 1) {
+        return bsl::min<bsl::size_t>(length, 1);                      // RETURN
+    }
+
+    return bsl::min<bsl::size_t>(length, numThreads * k_CHUNKS_PER_THREAD);
+}
+
+template <class POOL>
+void ParallelUtil_Imp::run(POOL              *pool,
+                           bsl::size_t        numChunks,
+                           ParallelUtil_Task *task,
+                           bslma::Allocator  *allocator)
+{
+    BSLS_ASSERT(pool);
+    BSLS_ASSERT(task);
+    BSLS_ASSERT(allocator);
+
+    const int numThreads = ParallelUtil_PoolTraits<POOL>::numThreads(*pool);
+
+    if (numChunks <= 1 || numThreads <= 1) {
+        for (bsl::size_t i = 0; i < numChunks; ++i) {
+            task->execute(i);
+        }
+        return;                                                       // RETURN
+    }
+
+    ParallelUtil_Helper helper;
+    helper.d_scheduler = bsl::allocate_shared<ParallelUtil_Scheduler>(
+                                                                    allocator,
+                                                                    task,
+                                                                    numChunks);
+
+    const bsl::function<void()> job(bsl::allocator_arg, allocator, helper);
+
+    // The calling thread takes part, so at most 'numChunks - 1' helpers can
+    // be given a chunk.
+
+    const bsl::size_t numHelpers = bsl::min<bsl::size_t>(numThreads,
+                                                         numChunks - 1);
+
+    for (bsl::size_t i = 0; i < numHelpers; ++i) {
+        if (0 != pool->enqueueJob(job)) {
+            break;
+        }
+    }
+
+    helper.d_scheduler->participate();
+    helper.d_scheduler->wait();
+}
+
+template <class POOL, class CHUNK_FUNCTOR>
+inline
+void ParallelUtil_Imp::runChunks(POOL             *pool,
+                                 bsl::size_t       numChunks,
+                                 CHUNK_FUNCTOR    *functor,
+                                 bslma::Allocator *allocator)
+{
+    ParallelUtil_TaskAdapter<CHUNK_FUNCTOR> task(functor);
+
+    run(pool, numChunks, &task, allocator);
+}
+
+                   // -------------------------------------
+                   // Component-private chunk functor types
+                   // -------------------------------------
+
+// ACCESSORS
+template <class RANDOM_IT, class FUNCTION>
+void ParallelUtil_ForEachChunk<RANDOM_IT, FUNCTION>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    RANDOM_IT       it  = d_first + ParallelUtil_Imp::chunkBoundary(
+                                                                d_length,
+                                                                d_numChunks,
+                                                                chunkIndex);
+    const RANDOM_IT end = d_first + ParallelUtil_Imp::chunkBoundary(
+                                                            d_length,
+                                                            d_numChunks,
+                                                            chunkIndex + 1);
+
+    for (; it != end; ++it) {
+        (*d_function_p)(*it);
+    }
+}
+
+template <class INPUT_IT, class OUTPUT_IT, class UNARY_OP>
+void ParallelUtil_TransformChunk<INPUT_IT, OUTPUT_IT, UNARY_OP>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    const bsl::size_t begin = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                              d_numChunks,
+                                                              chunkIndex);
+    const bsl::size_t end   = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                              d_numChunks,
+                                                              chunkIndex + 1);
+
+    bsl::transform(d_first + begin,
+                   d_first + end,
+                   d_result + begin,
+                   *d_operation_p);
+}
+
+template <class INPUT_IT1, class INPUT_IT2, class OUTPUT_IT, class BINARY_OP>
+void ParallelUtil_BinaryTransformChunk<INPUT_IT1,
+                                       INPUT_IT2,
+                                       OUTPUT_IT,
+                                       BINARY_OP>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    const bsl::size_t begin = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                              d_numChunks,
+                                                              chunkIndex);
+    const bsl::size_t end   = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                              d_numChunks,
+                                                              chunkIndex + 1);
+
+    bsl::transform(d_first1 + begin,
+                   d_first1 + end,
+                   d_first2 + begin,
+                   d_result + begin,
+                   *d_operation_p);
+}
+
+template <class TYPE>
+inline
+const TYPE& ParallelUtil_Identity::operator()(const TYPE& value) const
+{
+    return value;
+}
+
+template <class RANDOM_IT, class TYPE, class REDUCE_OP, class TRANSFORM_OP>
+void ParallelUtil_TransformReduceChunk<RANDOM_IT,
+                                       TYPE,
+                                       REDUCE_OP,
+                                       TRANSFORM_OP>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    RANDOM_IT       it  = d_first + ParallelUtil_Imp::chunkBoundary(
+                                                                d_length,
+                                                                d_numChunks,
+                                                                chunkIndex);
+    const RANDOM_IT end = d_first + ParallelUtil_Imp::chunkBoundary(
+                                                            d_length,
+                                                            d_numChunks,
+                                                            chunkIndex + 1);
+
+    BSLS_ASSERT(it != end);
+
+    TYPE value((*d_transform_p)(*it));
+    for (++it; it != end; ++it) {
+        value = (*d_reduce_p)(value, (*d_transform_p)(*it));
+    }
+
+    ::new (d_partials_p[chunkIndex].buffer()) TYPE(value);
+}
+
+template <class RANDOM_IT1,
+          class RANDOM_IT2,
+          class TYPE,
+          class REDUCE_OP,
+          class TRANSFORM_OP>
+void ParallelUtil_BinaryTransformReduceChunk<RANDOM_IT1,
+                                             RANDOM_IT2,
+                                             TYPE,
+                                             REDUCE_OP,
+                                             TRANSFORM_OP>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    const bsl::size_t begin = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                              d_numChunks,
+                                                              chunkIndex);
+    const bsl::size_t end   = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                              d_numChunks,
+                                                              chunkIndex + 1);
+
+    BSLS_ASSERT(begin != end);
+
+    RANDOM_IT1       it1  = d_first1 + begin;
+    const RANDOM_IT1 end1 = d_first1 + end;
+    RANDOM_IT2       it2  = d_first2 + begin;
+
+    TYPE value((*d_transform_p)(*it1, *it2));
+    for (++it1, ++it2; it1 != end1; ++it1, ++it2) {
+        value = (*d_reduce_p)(value, (*d_transform_p)(*it1, *it2));
+    }
+
+    ::new (d_partials_p[chunkIndex].buffer()) TYPE(value);
+}
+
+template <class RANDOM_IT, class OUTPUT_IT, class TYPE, class BINARY_OP>
+void ParallelUtil_ScanChunk<RANDOM_IT, OUTPUT_IT, TYPE, BINARY_OP>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    const bsl::size_t begin = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                              d_numChunks,
+                                                              chunkIndex);
+    const bsl::size_t end   = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                              d_numChunks,
+                                                              chunkIndex + 1);
+
+    BSLS_ASSERT(begin != end);
+
+    RANDOM_IT       it     = d_first + begin;
+    const RANDOM_IT last   = d_first + end;
+    OUTPUT_IT       result = d_result + begin;
+
+    TYPE value = 0 == chunkIndex
+               ? TYPE(*it)
+               : TYPE((*d_operation_p)(d_prefixes_p[chunkIndex - 1].object(),
+                                       *it));
+    *result = value;
+
+    for (++it, ++result; it != last; ++it, ++result) {
+        value   = (*d_operation_p)(value, *it);
+        *result = value;
+    }
+}
+
+template <class RANDOM_IT, class PREDICATE>
+void ParallelUtil_PartitionChunk<RANDOM_IT, PREDICATE>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    const RANDOM_IT begin = d_first + ParallelUtil_Imp::chunkBoundary(
+                                                                d_length,
+                                                                d_numChunks,
+                                                                chunkIndex);
+    const RANDOM_IT end   = d_first + ParallelUtil_Imp::chunkBoundary(
+                                                            d_length,
+                                                            d_numChunks,
+                                                            chunkIndex + 1);
+
+    d_numTrue_p[chunkIndex] = bsl::partition(begin, end, *d_predicate_p)
+                            - begin;
+}
+
+template <class RANDOM_IT>
+void ParallelUtil_SwapChunk<RANDOM_IT>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    bsl::size_t       offset = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                               d_numChunks,
+                                                               chunkIndex);
+    const bsl::size_t end    = ParallelUtil_Imp::chunkBoundary(
+                                                            d_length,
+                                                            d_numChunks,
+                                                            chunkIndex + 1);
+
+    // Find the segments containing 'offset' in each sequence, and the
+    // position of 'offset' within them.
+
+    bsl::size_t left  = bsl::upper_bound(d_leftStarts_p->begin(),
+                                         d_leftStarts_p->end(),
+                                         offset)
+                      - d_leftStarts_p->begin() - 1;
+    bsl::size_t right = bsl::upper_bound(d_rightStarts_p->begin(),
+                                         d_rightStarts_p->end(),
+                                         offset)
+                      - d_rightStarts_p->begin() - 1;
+
+    bsl::size_t leftPosition  = (*d_left_p)[left].first
+                              + (offset - (*d_leftStarts_p)[left]);
+    bsl::size_t rightPosition = (*d_right_p)[right].first
+                              + (offset - (*d_rightStarts_p)[right]);
+
+    while (offset != end) {
+        if (leftPosition == (*d_left_p)[left].second) {
+            leftPosition = (*d_left_p)[++left].first;
+        }
+        if (rightPosition == (*d_right_p)[right].second) {
+            rightPosition = (*d_right_p)[++right].first;
+        }
+
+        bsl::iter_swap(d_first + leftPosition, d_first + rightPosition);
+
+        ++leftPosition;
+        ++rightPosition;
+        ++offset;
+    }
+}
+
+template <class RANDOM_IT, class COMPARATOR>
+void ParallelUtil_SortChunk<RANDOM_IT, COMPARATOR>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    bsl::sort(d_first + ParallelUtil_Imp::chunkBoundary(d_length,
+                                                        d_numBlocks,
+                                                        chunkIndex),
+              d_first + ParallelUtil_Imp::chunkBoundary(d_length,
+                                                        d_numBlocks,
+                                                        chunkIndex + 1),
+              *d_comparator_p);
+}
+
+template <class RANDOM_IT, class COMPARATOR>
+void ParallelUtil_MergeChunk<RANDOM_IT, COMPARATOR>::operator()(
+                                                  bsl::size_t chunkIndex) const
+{
+    const bsl::size_t lowBlock    = 2 * d_width * chunkIndex;
+    const bsl::size_t middleBlock = bsl::min(lowBlock + d_width,
+                                             d_numBlocks);
+    const bsl::size_t highBlock   = bsl::min(lowBlock + 2 * d_width,
+                                             d_numBlocks);
+
+    if (middleBlock == highBlock) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t low    = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                               d_numBlocks,
+                                                               lowBlock);
+    const bsl::size_t middle = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                               d_numBlocks,
+                                                               middleBlock);
+    const bsl::size_t high   = ParallelUtil_Imp::chunkBoundary(d_length,
+                                                               d_numBlocks,
+                                                               highBlock);
+
+    // Move the first run to the part of the buffer that corresponds to it,
+    // which no other chunk uses, and merge it with the second run back into
+    // the range.  An element of the second run is always read before its
+    // position is written, as the output never catches up with the input.
+
+    bsls::ObjectBuffer<ValueType> *buffer    = d_buffer_p + low;
+    const bsl::size_t              numBuffer = middle - low;
+
+    for (bsl::size_t i = 0; i < numBuffer; ++i) {
+        ::new (buffer[i].buffer()) ValueType(
+                              bslmf::MovableRefUtil::move(d_first[low + i]));
+    }
+
+    bsl::size_t from  = 0;
+    bsl::size_t right = middle;
+    bsl::size_t to    = low;
+
+    while (from < numBuffer && right < high) {
+        if ((*d_comparator_p)(d_first[right], buffer[from].object())) {
+            d_first[to] = bslmf::MovableRefUtil::move(d_first[right]);
+            ++right;
+        }
+        else {
+            d_first[to] = bslmf::MovableRefUtil::move(buffer[from].object());
+            ++from;
+        }
+        ++to;
+    }
+
+    while (from < numBuffer) {
+        d_first[to] = bslmf::MovableRefUtil::move(buffer[from].object());
+        ++from;
+        ++to;
+    }
+
+    for (bsl::size_t i = 0; i < numBuffer; ++i) {
+        bslma::DestructionUtil::destroy(buffer[i].address());
+    }
+}
+
+                            // -------------------
+                            // struct ParallelUtil
+                            // -------------------
+
+// CLASS METHODS
+template <class POOL, class RANDOM_IT, class FUNCTION>
+void ParallelUtil::forEach(POOL             *pool,
+                           RANDOM_IT         first,
+                           RANDOM_IT         last,
+                           FUNCTION          function,
+                           bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    const bsl::size_t length    = last - first;
+    const bsl::size_t numChunks = ParallelUtil_Imp::numChunks(*pool, length);
+
+    ParallelUtil_ForEachChunk<RANDOM_IT, FUNCTION> functor = {
+                                      first, length, numChunks, &function };
+
+    ParallelUtil_Imp::runChunks(pool, numChunks, &functor, allocator);
+}
+
+template <class POOL, class RANDOM_IT, class OUTPUT_IT>
+inline
+OUTPUT_IT ParallelUtil::inclusiveScan(POOL      *pool,
+                                      RANDOM_IT  first,
+                                      RANDOM_IT  last,
+                                      OUTPUT_IT  result)
+{
+    typedef typename bsl::iterator_traits<RANDOM_IT>::value_type ValueType;
+
+    return inclusiveScan(pool, first, last, result, bsl::plus<ValueType>());
+}
+
+template <class POOL, class RANDOM_IT, class OUTPUT_IT, class BINARY_OP>
+OUTPUT_IT ParallelUtil::inclusiveScan(POOL             *pool,
+                                      RANDOM_IT         first,
+                                      RANDOM_IT         last,
+                                      OUTPUT_IT         result,
+                                      BINARY_OP         operation,
+                                      bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    typedef typename bsl::iterator_traits<RANDOM_IT>::value_type ValueType;
+
+    const bsl::size_t length    = last - first;
+    const bsl::size_t numChunks = ParallelUtil_Imp::numChunks(*pool, length);
+
+    if (0 == length) {
+        return result;                                                // RETURN
+    }
+
+    // First, reduce every chunk but the last; then, replace each such
+    // reduction with that of all chunks up to and including it; finally, scan
+    // each chunk starting from the reduction of the chunks preceding it.
+
+    bsl::vector<bsls::ObjectBuffer<ValueType> > prefixes(numChunks - 1,
+                                                         allocator);
+
+    ParallelUtil_Identity identity;
+
+    ParallelUtil_TransformReduceChunk<RANDOM_IT,
+                                      ValueType,
+                                      BINARY_OP,
+                                      ParallelUtil_Identity> reduceFunctor = {
+                first, length, numChunks, prefixes.data(), &operation,
+                &identity };
+
+    ParallelUtil_Imp::runChunks(pool,
+                                numChunks - 1,
+                                &reduceFunctor,
+                                allocator);
+
+    for (bsl::size_t i = 1; i < prefixes.size(); ++i) {
+        prefixes[i].object() = operation(prefixes[i - 1].object(),
+                                         prefixes[i].object());
+    }
+
+    ParallelUtil_ScanChunk<RANDOM_IT, OUTPUT_IT, ValueType, BINARY_OP>
+                                                                scanFunctor = {
+                first, result, length, numChunks, prefixes.data(),
+                &operation };
+
+    ParallelUtil_Imp::runChunks(pool, numChunks, &scanFunctor, allocator);
+
+    for (bsl::size_t i = 0; i < prefixes.size(); ++i) {
+        bslma::DestructionUtil::destroy(prefixes[i].address());
+    }
+
+    return result + length;
+}
+
+template <class POOL, class RANDOM_IT, class PREDICATE>
+RANDOM_IT ParallelUtil::partition(POOL             *pool,
+                                  RANDOM_IT         first,
+                                  RANDOM_IT         last,
+                                  PREDICATE         predicate,
+                                  bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    typedef ParallelUtil_SwapChunk<RANDOM_IT> SwapChunk;
+    typedef typename SwapChunk::Segment       Segment;
+
+    const bsl::size_t length    = last - first;
+    const bsl::size_t numChunks = ParallelUtil_Imp::numChunks(*pool, length);
+
+    if (numChunks <= 1) {
+        return bsl::partition(first, last, predicate);                // RETURN
+    }
+
+    // First, partition every chunk independently.
+
+    bsl::vector<bsl::size_t> numTrue(numChunks, allocator);
+
+    ParallelUtil_PartitionChunk<RANDOM_IT, PREDICATE> partitionFunctor = {
+                     first, length, numChunks, numTrue.data(), &predicate };
+
+    ParallelUtil_Imp::runChunks(pool,
+                                numChunks,
+                                &partitionFunctor,
+                                allocator);
+
+    // Then, collect the segments of elements that are on the wrong side of
+    // the partition point: the elements failing the predicate that precede
+    // it ('left'), and those satisfying the predicate that follow it
+    // ('right').  Both sequences of segments have the same total length.
+
+    bsl::size_t middle = 0;
+    for (bsl::size_t i = 0; i < numChunks; ++i) {
+        middle += numTrue[i];
+    }
+
+    bsl::vector<Segment>     left(allocator);
+    bsl::vector<Segment>     right(allocator);
+    bsl::vector<bsl::size_t> leftStarts(allocator);
+    bsl::vector<bsl::size_t> rightStarts(allocator);
+    bsl::size_t              numLeft  = 0;
+    bsl::size_t              numRight = 0;
+
+    for (bsl::size_t i = 0; i < numChunks; ++i) {
+        const bsl::size_t begin = ParallelUtil_Imp::chunkBoundary(length,
+                                                                  numChunks,
+                                                                  i);
+        const bsl::size_t end   = ParallelUtil_Imp::chunkBoundary(length,
+                                                                  numChunks,
+                                                                  i + 1);
+        const bsl::size_t split = begin + numTrue[i];
+
+        if (split < middle && split < end) {
+            const bsl::size_t segmentEnd = bsl::min(end, middle);
+
+            left.push_back(Segment(split, segmentEnd));
+            leftStarts.push_back(numLeft);
+            numLeft += segmentEnd - split;
+        }
+        if (middle < split && begin < split) {
+            const bsl::size_t segmentBegin = bsl::max(begin, middle);
+
+            right.push_back(Segment(segmentBegin, split));
+            rightStarts.push_back(numRight);
+            numRight += split - segmentBegin;
+        }
+    }
+
+    BSLS_ASSERT(numLeft == numRight);
+
+    // Finally, exchange the misplaced elements.
+
+    if (0 != numLeft) {
+        const bsl::size_t numSwapChunks = ParallelUtil_Imp::numChunks(*pool,
+                                                                      numLeft);
+
+        SwapChunk swapFunctor = { first,
+                                  numLeft,
+                                  numSwapChunks,
+                                  &left,
+                                  &right,
+                                  &leftStarts,
+                                  &rightStarts };
+
+        ParallelUtil_Imp::runChunks(pool,
+                                    numSwapChunks,
+                                    &swapFunctor,
+                                    allocator);
+    }
+
+    return first + middle;
+}
+
+template <class POOL, class RANDOM_IT, class TYPE>
+inline
+TYPE ParallelUtil::reduce(POOL        *pool,
+                          RANDOM_IT    first,
+                          RANDOM_IT    last,
+                          const TYPE&  initialValue)
+{
+    return reduce(pool, first, last, initialValue, bsl::plus<TYPE>());
+}
+
+template <class POOL, class RANDOM_IT, class TYPE, class BINARY_OP>
+inline
+TYPE ParallelUtil::reduce(POOL             *pool,
+                          RANDOM_IT         first,
+                          RANDOM_IT         last,
+                          const TYPE&       initialValue,
+                          BINARY_OP         operation,
+                          bslma::Allocator *basicAllocator)
+{
+    return transformReduce(pool,
+                           first,
+                           last,
+                           initialValue,
+                           operation,
+                           ParallelUtil_Identity(),
+                           basicAllocator);
+}
+
+template <class POOL, class RANDOM_IT>
+inline
+void ParallelUtil::sort(POOL *pool, RANDOM_IT first, RANDOM_IT last)
+{
+    typedef typename bsl::iterator_traits<RANDOM_IT>::value_type ValueType;
+
+    sort(pool, first, last, bsl::less<ValueType>());
+}
+
+template <class POOL, class RANDOM_IT, class COMPARATOR>
+void ParallelUtil::sort(POOL             *pool,
+                        RANDOM_IT         first,
+                        RANDOM_IT         last,
+                        COMPARATOR        comparator,
+                        bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    typedef typename bsl::iterator_traits<RANDOM_IT>::value_type ValueType;
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    // Sort one block per thread independently, then merge adjacent runs of
+    // sorted blocks pairwise, doubling the length of the runs in each round.
+    // The merges use a buffer allocated here, rather than
+    // 'bsl::inplace_merge', which may allocate (from the global heap) in a
+    // thread of the pool.
+
+    const bsl::size_t length     = last - first;
+    const int         numThreads = ParallelUtil_PoolTraits<POOL>::numThreads(
+                                                                        *pool);
+    const bsl::size_t numBlocks  = bsl::min<bsl::size_t>(
+                                  numThreads,
+                                  length / ParallelUtil_Imp::k_MIN_SORT_BLOCK);
+
+    if (numBlocks <= 1) {
+        bsl::sort(first, last, comparator);
+        return;                                                       // RETURN
+    }
+
+    ParallelUtil_SortChunk<RANDOM_IT, COMPARATOR> sortFunctor = {
+                                     first, length, numBlocks, &comparator };
+
+    bsl::vector<bsls::ObjectBuffer<ValueType> > buffer(length, allocator);
+
+    ParallelUtil_Imp::runChunks(pool, numBlocks, &sortFunctor, allocator);
+
+    for (bsl::size_t width = 1; width < numBlocks; width *= 2) {
+        ParallelUtil_MergeChunk<RANDOM_IT, COMPARATOR> mergeFunctor = {
+              first, length, numBlocks, width, buffer.data(), &comparator };
+
+        ParallelUtil_Imp::runChunks(pool,
+                                    (numBlocks + 2 * width - 1) / (2 * width),
+                                    &mergeFunctor,
+                                    allocator);
+    }
+}
+
+template <class POOL, class INPUT_IT, class OUTPUT_IT, class UNARY_OP>
+OUTPUT_IT ParallelUtil::transform(POOL             *pool,
+                                  INPUT_IT          first,
+                                  INPUT_IT          last,
+                                  OUTPUT_IT         result,
+                                  UNARY_OP          operation,
+                                  bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    const bsl::size_t length    = last - first;
+    const bsl::size_t numChunks = ParallelUtil_Imp::numChunks(*pool, length);
+
+    ParallelUtil_TransformChunk<INPUT_IT, OUTPUT_IT, UNARY_OP> functor = {
+                              first, result, length, numChunks, &operation };
+
+    ParallelUtil_Imp::runChunks(pool, numChunks, &functor, allocator);
+
+    return result + length;
+}
+
+template <class POOL,
+          class INPUT_IT1,
+          class INPUT_IT2,
+          class OUTPUT_IT,
+          class BINARY_OP>
+OUTPUT_IT ParallelUtil::transform(POOL             *pool,
+                                  INPUT_IT1         first1,
+                                  INPUT_IT1         last1,
+                                  INPUT_IT2         first2,
+                                  OUTPUT_IT         result,
+                                  BINARY_OP         operation,
+                                  bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    const bsl::size_t length    = last1 - first1;
+    const bsl::size_t numChunks = ParallelUtil_Imp::numChunks(*pool, length);
+
+    ParallelUtil_BinaryTransformChunk<INPUT_IT1,
+                                      INPUT_IT2,
+                                      OUTPUT_IT,
+                                      BINARY_OP> functor = {
+                     first1, first2, result, length, numChunks, &operation };
+
+    ParallelUtil_Imp::runChunks(pool, numChunks, &functor, allocator);
+
+    return result + length;
+}
+
+template <class POOL,
+          class RANDOM_IT,
+          class TYPE,
+          class REDUCE_OP,
+          class TRANSFORM_OP>
+TYPE ParallelUtil::transformReduce(POOL             *pool,
+                                   RANDOM_IT         first,
+                                   RANDOM_IT         last,
+                                   const TYPE&       initialValue,
+                                   REDUCE_OP         reduce,
+                                   TRANSFORM_OP      transform,
+                                   bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    const bsl::size_t length    = last - first;
+    const bsl::size_t numChunks = ParallelUtil_Imp::numChunks(*pool, length);
+
+    bsl::vector<bsls::ObjectBuffer<TYPE> > partials(numChunks, allocator);
+
+    ParallelUtil_TransformReduceChunk<RANDOM_IT,
+                                      TYPE,
+                                      REDUCE_OP,
+                                      TRANSFORM_OP> functor = {
+        first, length, numChunks, partials.data(), &reduce, &transform };
+
+    ParallelUtil_Imp::runChunks(pool, numChunks, &functor, allocator);
+
+    TYPE value(initialValue);
+    for (bsl::size_t i = 0; i < numChunks; ++i) {
+        value = reduce(value, partials[i].object());
+        bslma::DestructionUtil::destroy(partials[i].address());
+    }
+
+    return value;
+}
+
+template <class POOL,
+          class RANDOM_IT1,
+          class RANDOM_IT2,
+          class TYPE,
+          class REDUCE_OP,
+          class TRANSFORM_OP>
+TYPE ParallelUtil::transformReduce(POOL             *pool,
+                                   RANDOM_IT1        first1,
+                                   RANDOM_IT1        last1,
+                                   RANDOM_IT2        first2,
+                                   const TYPE&       initialValue,
+                                   REDUCE_OP         reduce,
+                                   TRANSFORM_OP      transform,
+                                   bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(pool);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    const bsl::size_t length    = last1 - first1;
+    const bsl::size_t numChunks = ParallelUtil_Imp::numChunks(*pool, length);
+
+    bsl::vector<bsls::ObjectBuffer<TYPE> > partials(numChunks, allocator);
+
+    ParallelUtil_BinaryTransformReduceChunk<RANDOM_IT1,
+                                            RANDOM_IT2,
+                                            TYPE,
+                                            REDUCE_OP,
+                                            TRANSFORM_OP> functor = {
+        first1, first2, length, numChunks, partials.data(), &reduce,
+        &transform };
+
+    ParallelUtil_Imp::runChunks(pool, numChunks, &functor, allocator);
+
+    TYPE value(initialValue);
+    for (bsl::size_t i = 0; i < numChunks; ++i) {
+        value = reduce(value, partials[i].object());
+        bslma::DestructionUtil::destroy(partials[i].address());
+    }
+
+    return value;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
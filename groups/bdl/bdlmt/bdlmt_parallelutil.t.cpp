@@ -0,0 +1,1490 @@
+// bdlmt_parallelutil.t.cpp                                           -*-C++-*-
+#include <bdlmt_parallelutil.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_semaphore.h>
+#include <bslmt_testutil.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_numeric.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test provides parallel algorithms that divide a range
+// into chunks and process the chunks in the calling thread and in jobs
+// enqueued on a thread pool.  We first test the component-private functions
+// that compute chunk boundaries and hand chunks out to threads, and then test
+// each algorithm by comparing its result with that of the corresponding
+// sequential standard algorithm, for ranges of various lengths, on pools of
+// each supported type and size, including a pool that is not started (so that
+// the calling thread does all of the work).  Non-commutative operations are
+// used to verify that 'reduce', 'transformReduce', and 'inclusiveScan'
+// preserve the order of the elements.  Finally, we verify that an algorithm
+// can be called from a job running in the same pool when every other thread
+// of the pool is busy, and from several threads concurrently.
+//
+// In addition to positive test cases, a negative test case -1 can be run
+// manually to measure the scaling of each algorithm with the number of
+// threads.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void forEach(POOL *, RANDOM_IT, RANDOM_IT, FUNCTION, *bA = 0);
+// [ 5] OUTPUT_IT inclusiveScan(POOL *, RANDOM_IT, RANDOM_IT, OUTPUT_IT);
+// [ 5] OUTPUT_IT inclusiveScan(POOL *, IT, IT, OUT_IT, BIN_OP, *bA = 0);
+// [ 6] RANDOM_IT partition(POOL *, RANDOM_IT, RANDOM_IT, PRED, *bA = 0);
+// [ 4] TYPE reduce(POOL *, RANDOM_IT, RANDOM_IT, const TYPE&);
+// [ 4] TYPE reduce(POOL *, IT, IT, const TYPE&, BINARY_OP, *bA = 0);
+// [ 7] void sort(POOL *, RANDOM_IT, RANDOM_IT);
+// [ 7] void sort(POOL *, RANDOM_IT, RANDOM_IT, COMPARATOR, *bA = 0);
+// [ 3] OUTPUT_IT transform(POOL *, IT, IT, OUTPUT_IT, UNARY_OP, *bA = 0);
+// [ 3] OUTPUT_IT transform(POOL *, I1, I1, I2, OUT_IT, BIN_OP, *bA = 0);
+// [ 4] TYPE transformReduce(POOL *, IT, IT, const T&, RED, TR, *bA = 0);
+// [ 4] TYPE transformReduce(POOL *, I1, I1, I2, const T&, RED, TR, *bA);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] ParallelUtil_Imp
+// [ 8] CONCERN: CALLING FROM A JOB IN THE SAME POOL
+// [ 8] CONCERN: CALLING FROM SEVERAL THREADS
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT                   BSLMT_TESTUTIL_ASSERT
+#define ASSERTV                  BSLMT_TESTUTIL_ASSERTV
+
+#define GUARD                    BSLMT_TESTUTIL_GUARD
+
+#define Q                        BSLMT_TESTUTIL_Q
+#define P                        BSLMT_TESTUTIL_P
+#define P_                       BSLMT_TESTUTIL_P_
+#define T_                       BSLMT_TESTUTIL_T_
+#define L_                       BSLMT_TESTUTIL_L_
+
+#define GUARDED_STREAM(STREAM)   BSLMT_TESTUTIL_GUARDED_STREAM(STREAM)
+#define COUT                     BSLMT_TESTUTIL_COUT
+#define CERR                     BSLMT_TESTUTIL_CERR
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::ParallelUtil     Util;
+typedef bdlmt::ParallelUtil_Imp Imp;
+typedef bsls::Types::Int64      Int64;
+
+const bsl::size_t LENGTHS[] = { 0, 1, 2, 3, 7, 16, 100, 1000, 10007, 50000 };
+const int         NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+// ============================================================================
+//                           GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+int test;
+int verbose;
+int veryVerbose;
+int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void generate(bsl::vector<int> *result, bsl::size_t length, int modulus)
+    // Load into the specified 'result' the specified 'length' pseudo-random
+    // integers in the range '[0 .. modulus)', where 'modulus' is specified.
+{
+    result->resize(length);
+
+    unsigned int state = 12345;
+    for (bsl::size_t i = 0; i < length; ++i) {
+        state = state * 1103515245 + 12345;
+        (*result)[i] = static_cast<int>((state >> 8) % modulus);
+    }
+}
+
+void generate(bsl::vector<bsl::string> *result, bsl::size_t length)
+    // Load into the specified 'result' the specified 'length' strings, each
+    // consisting of a single letter.
+{
+    result->clear();
+    for (bsl::size_t i = 0; i < length; ++i) {
+        result->push_back(bsl::string(1, static_cast<char>('a' + i % 26)));
+    }
+}
+
+struct AddOne {
+    // This 'struct' increments its argument.
+
+    // ACCESSORS
+    void operator()(int& value) const
+    {
+        ++value;
+    }
+};
+
+struct Twice {
+    // This 'struct' returns twice its argument.
+
+    // ACCESSORS
+    Int64 operator()(int value) const
+    {
+        return 2 * static_cast<Int64>(value);
+    }
+};
+
+struct SquareOf {
+    // This 'struct' returns the square of its argument.
+
+    // ACCESSORS
+    Int64 operator()(int value) const
+    {
+        return static_cast<Int64>(value) * value;
+    }
+};
+
+struct Multiply {
+    // This 'struct' returns the product of its arguments.
+
+    // ACCESSORS
+    Int64 operator()(int lhs, int rhs) const
+    {
+        return static_cast<Int64>(lhs) * rhs;
+    }
+};
+
+struct Concatenate {
+    // This 'struct' returns the concatenation of its arguments, which is an
+    // associative but not commutative operation.
+
+    // ACCESSORS
+    bsl::string operator()(const bsl::string& lhs,
+                           const bsl::string& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+struct IsEven {
+    // This 'struct' returns 'true' if its argument is even.
+
+    // ACCESSORS
+    bool operator()(int value) const
+    {
+        return 0 == value % 2;
+    }
+};
+
+struct IsLessThan {
+    // This 'struct' returns 'true' if its argument is less than 'd_limit'.
+
+    // DATA
+    int d_limit;
+
+    // ACCESSORS
+    bool operator()(int value) const
+    {
+        return value < d_limit;
+    }
+};
+
+struct ChunkRecorder {
+    // This 'struct' counts the number of times each chunk is processed.
+
+    // DATA
+    bsls::AtomicInt *d_counts_p;
+
+    // ACCESSORS
+    void operator()(bsl::size_t chunkIndex) const
+    {
+        ++d_counts_p[chunkIndex];
+    }
+};
+
+template <class TEST>
+void runOnPools()
+    // Invoke 'TEST::run' with each of a variety of pools.
+{
+    bslmt::ThreadAttributes attributes;
+
+    {
+        if (veryVerbose) { T_ Q(FixedThreadPool(1)); }
+
+        bdlmt::FixedThreadPool pool(1, 100);
+        ASSERT(0 == pool.start());
+        TEST::run(&pool);
+        pool.stop();
+    }
+    {
+        if (veryVerbose) { T_ Q(FixedThreadPool(4)); }
+
+        bdlmt::FixedThreadPool pool(4, 100);
+        ASSERT(0 == pool.start());
+        TEST::run(&pool);
+        pool.stop();
+    }
+    {
+        if (veryVerbose) { T_ Q(FixedThreadPool(4) not started); }
+
+        bdlmt::FixedThreadPool pool(4, 100);
+        TEST::run(&pool);
+    }
+    {
+        if (veryVerbose) { T_ Q(WorkStealingThreadPool(3)); }
+
+        bdlmt::WorkStealingThreadPool pool(3);
+        ASSERT(0 == pool.start());
+        TEST::run(&pool);
+        pool.stop();
+    }
+    {
+        if (veryVerbose) { T_ Q(ThreadPool(1, 4)); }
+
+        bdlmt::ThreadPool pool(attributes, 1, 4, 100);
+        ASSERT(0 == pool.start());
+        TEST::run(&pool);
+        pool.stop();
+    }
+}
+
+struct BreathingTest {
+    template <class POOL>
+    static void run(POOL *pool)
+    {
+        bsl::vector<int> data;
+        generate(&data, 10000, 1000);
+
+        Int64 sum = Util::reduce(pool, data.begin(), data.end(), Int64(0));
+        ASSERTV(sum, bsl::accumulate(data.begin(), data.end(), Int64(0))
+                                                                      == sum);
+
+        bsl::vector<int> expected(data);
+        bsl::sort(expected.begin(), expected.end());
+
+        Util::sort(pool, data.begin(), data.end());
+        ASSERT(expected == data);
+    }
+};
+
+struct ForEachAndTransformTest {
+    template <class POOL>
+    static void run(POOL *pool)
+    {
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            if (veryVeryVerbose) { T_ T_ P(LENGTH); }
+
+            bsl::vector<int> data;
+            generate(&data, LENGTH, 1000);
+
+            const bsl::vector<int> original(data);
+
+            Util::forEach(pool, data.begin(), data.end(), AddOne());
+
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                ASSERTV(LENGTH, i, original[i] + 1 == data[i]);
+            }
+
+            bsl::vector<Int64> output(LENGTH, -1);
+
+            bsl::vector<Int64>::iterator end = Util::transform(
+                                                             pool,
+                                                             original.begin(),
+                                                             original.end(),
+                                                             output.begin(),
+                                                             Twice());
+            ASSERT(output.end() == end);
+
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                ASSERTV(LENGTH, i, 2 * original[i] == output[i]);
+            }
+
+            bsl::fill(output.begin(), output.end(), -1);
+
+            end = Util::transform(pool,
+                                  original.begin(),
+                                  original.end(),
+                                  data.begin(),
+                                  output.begin(),
+                                  Multiply());
+            ASSERT(output.end() == end);
+
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                ASSERTV(LENGTH, i,
+                        Int64(original[i]) * data[i] == output[i]);
+            }
+
+            // Transform in place, through pointers.
+
+            if (LENGTH) {
+                int *begin = &data[0];
+                Util::transform(pool, begin, begin + LENGTH, begin, Twice());
+
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LENGTH, i, 2 * (original[i] + 1) == data[i]);
+                }
+            }
+        }
+    }
+};
+
+struct ReduceTest {
+    template <class POOL>
+    static void run(POOL *pool)
+    {
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            if (veryVeryVerbose) { T_ T_ P(LENGTH); }
+
+            bsl::vector<int> data;
+            generate(&data, LENGTH, 1000);
+
+            Int64 expected = 5;
+            Int64 expectedSquares = 5;
+            Int64 expectedProducts = 5;
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                expected         += data[i];
+                expectedSquares  += Int64(data[i]) * data[i];
+                expectedProducts += Int64(data[i]) * data[LENGTH - 1 - i];
+            }
+
+            ASSERTV(LENGTH, expected == Util::reduce(pool,
+                                                     data.begin(),
+                                                     data.end(),
+                                                     Int64(5)));
+
+            ASSERTV(LENGTH, expected == Util::reduce(pool,
+                                                     data.begin(),
+                                                     data.end(),
+                                                     Int64(5),
+                                                     bsl::plus<Int64>()));
+
+            ASSERTV(LENGTH,
+                    expectedSquares == Util::transformReduce(
+                                                       pool,
+                                                       data.begin(),
+                                                       data.end(),
+                                                       Int64(5),
+                                                       bsl::plus<Int64>(),
+                                                       SquareOf()));
+
+            ASSERTV(LENGTH,
+                    expectedProducts == Util::transformReduce(
+                                                       pool,
+                                                       data.begin(),
+                                                       data.end(),
+                                                       data.rbegin(),
+                                                       Int64(5),
+                                                       bsl::plus<Int64>(),
+                                                       Multiply()));
+
+            // Verify that the order of the elements is preserved.
+
+            bsl::vector<bsl::string> strings;
+            generate(&strings, LENGTH);
+
+            bsl::string expectedString("init:");
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                expectedString += strings[i];
+            }
+
+            ASSERTV(LENGTH,
+                    expectedString == Util::reduce(pool,
+                                                   strings.begin(),
+                                                   strings.end(),
+                                                   bsl::string("init:"),
+                                                   Concatenate()));
+        }
+    }
+};
+
+struct InclusiveScanTest {
+    template <class POOL>
+    static void run(POOL *pool)
+    {
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            if (veryVeryVerbose) { T_ T_ P(LENGTH); }
+
+            bsl::vector<int> data;
+            generate(&data, LENGTH, 1000);
+
+            bsl::vector<int> expected(LENGTH);
+            bsl::partial_sum(data.begin(), data.end(), expected.begin());
+
+            bsl::vector<int> output(LENGTH, -1);
+
+            bsl::vector<int>::iterator end = Util::inclusiveScan(
+                                                              pool,
+                                                              data.begin(),
+                                                              data.end(),
+                                                              output.begin());
+            ASSERT(output.end() == end);
+            ASSERTV(LENGTH, expected == output);
+
+            end = Util::inclusiveScan(pool,
+                                      data.begin(),
+                                      data.end(),
+                                      data.begin(),
+                                      bsl::plus<int>());
+            ASSERT(data.end() == end);
+            ASSERTV(LENGTH, expected == data);
+
+            // Verify that the order of the elements is preserved.
+
+            bsl::vector<bsl::string> strings;
+            generate(&strings, LENGTH);
+
+            bsl::vector<bsl::string> stringOutput(LENGTH);
+
+            Util::inclusiveScan(pool,
+                                strings.begin(),
+                                strings.end(),
+                                stringOutput.begin(),
+                                Concatenate());
+
+            bsl::string expectedString;
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                expectedString += strings[i];
+                ASSERTV(LENGTH, i, expectedString == stringOutput[i]);
+            }
+        }
+    }
+};
+
+struct PartitionTest {
+    static void verify(const bsl::vector<int>&          original,
+                       bsl::vector<int>&                data,
+                       bsl::vector<int>::const_iterator middle,
+                       int                              limit)
+        // Verify that the specified 'data' is a permutation of the specified
+        // 'original' and is partitioned at the specified 'middle' according
+        // to 'IsLessThan' with the specified 'limit'.
+    {
+        IsLessThan predicate = { limit };
+
+        for (bsl::vector<int>::const_iterator it = data.begin();
+             it != data.end();
+             ++it) {
+            ASSERTV(original.size(), limit, it - data.begin(),
+                    (it < middle) == predicate(*it));
+        }
+
+        bsl::vector<int> sortedOriginal(original);
+        bsl::sort(sortedOriginal.begin(), sortedOriginal.end());
+        bsl::sort(data.begin(), data.end());
+        ASSERTV(original.size(), limit, sortedOriginal == data);
+    }
+
+    template <class POOL>
+    static void run(POOL *pool)
+    {
+        const int LIMITS[] = { -1, 0, 1, 10, 500, 990, 1000, 1001 };
+        const int NUM_LIMITS = sizeof LIMITS / sizeof *LIMITS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            if (veryVeryVerbose) { T_ T_ P(LENGTH); }
+
+            bsl::vector<int> original;
+            generate(&original, LENGTH, 1000);
+
+            for (int li = 0; li < NUM_LIMITS; ++li) {
+                const int LIMIT = LIMITS[li];
+
+                IsLessThan predicate = { LIMIT };
+
+                bsl::vector<int> data(original);
+
+                bsl::vector<int>::iterator middle = Util::partition(
+                                                                pool,
+                                                                data.begin(),
+                                                                data.end(),
+                                                                predicate);
+
+                ASSERTV(LENGTH, LIMIT,
+                        bsl::count_if(original.begin(),
+                                      original.end(),
+                                      predicate) == middle - data.begin());
+
+                verify(original, data, middle, LIMIT);
+            }
+
+            // Partition elements that are already partitioned, in either
+            // direction.
+
+            bsl::vector<int> data(original);
+            bsl::sort(data.begin(), data.end());
+
+            IsLessThan predicate = { 500 };
+
+            bsl::vector<int>::iterator middle = Util::partition(pool,
+                                                                data.begin(),
+                                                                data.end(),
+                                                                predicate);
+            verify(original, data, middle, 500);
+
+            bsl::sort(data.begin(), data.end(), bsl::greater<int>());
+
+            middle = Util::partition(pool, data.begin(), data.end(), IsEven());
+
+            for (bsl::vector<int>::iterator it = data.begin();
+                 it != data.end();
+                 ++it) {
+                ASSERTV(LENGTH, (it < middle) == IsEven()(*it));
+            }
+        }
+    }
+};
+
+struct SortTest {
+    template <class POOL>
+    static void run(POOL *pool)
+    {
+        const int MODULI[] = { 1, 10, 1000000 };
+        const int NUM_MODULI = sizeof MODULI / sizeof *MODULI;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            for (int mi = 0; mi < NUM_MODULI; ++mi) {
+                const bsl::size_t LENGTH  = LENGTHS[ti];
+                const int         MODULUS = MODULI[mi];
+
+                if (veryVeryVerbose) { T_ T_ P_(LENGTH); P(MODULUS); }
+
+                bsl::vector<int> data;
+                generate(&data, LENGTH, MODULUS);
+
+                bsl::vector<int> expected(data);
+                bsl::sort(expected.begin(), expected.end());
+
+                bsl::vector<int> copy(data);
+
+                Util::sort(pool, copy.begin(), copy.end());
+                ASSERTV(LENGTH, MODULUS, expected == copy);
+
+                // Sort sorted data.
+
+                Util::sort(pool, copy.begin(), copy.end());
+                ASSERTV(LENGTH, MODULUS, expected == copy);
+
+                bsl::reverse(expected.begin(), expected.end());
+
+                Util::sort(pool,
+                           data.begin(),
+                           data.end(),
+                           bsl::greater<int>());
+                ASSERTV(LENGTH, MODULUS, expected == data);
+
+                // Sort reverse-sorted data.
+
+                Util::sort(pool, data.begin(), data.end());
+                ASSERTV(LENGTH, MODULUS, copy == data);
+            }
+
+            // Sort strings, which are not bitwise movable.
+
+            bsl::vector<bsl::string> strings;
+            generate(&strings, LENGTHS[ti]);
+
+            bsl::vector<bsl::string> expected(strings);
+            bsl::sort(expected.begin(), expected.end());
+
+            Util::sort(pool, strings.begin(), strings.end());
+            ASSERTV(LENGTHS[ti], expected == strings);
+        }
+    }
+};
+
+void reduceInPool(bdlmt::FixedThreadPool *pool,
+                  const bsl::vector<int> *data,
+                  Int64                  *result,
+                  bslmt::Semaphore       *done)
+    // Load into the specified 'result' the sum of the specified 'data',
+    // computed on the specified 'pool', and post to the specified 'done'.
+{
+    *result = Util::reduce(pool, data->begin(), data->end(), Int64(0));
+    done->post();
+}
+
+void sortConcurrently(bdlmt::WorkStealingThreadPool *pool,
+                      bsl::vector<int>              *data)
+    // Sort the specified 'data' on the specified 'pool'.
+{
+    Util::sort(pool, data->begin(), data->end());
+}
+
+void blockOnSemaphore(bslmt::Semaphore *started, bslmt::Semaphore *release)
+    // Post to the specified 'started' and wait on the specified 'release'.
+{
+    started->post();
+    release->wait();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sorting and Summing on a Thread Pool
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we sort a large array of integers, and then compute the sum
+// of their squares, using the threads of a 'bdlmt::FixedThreadPool'.
+//
+// First, we define a functor that returns the square of its argument:
+//..
+    struct Square {
+        // ACCESSORS
+        bsls::Types::Int64 operator()(int value) const
+        {
+            return static_cast<bsls::Types::Int64>(value) * value;
+        }
+    };
+//..
+
+}  // close namespace USAGE_EXAMPLE_1
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2 ? (atoi(argv[2]) ? atoi(argv[2]) : 1) : 0;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE_1;
+
+// Then, we create and start a pool of four threads:
+//..
+    bdlmt::FixedThreadPool pool(4, 100);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we create the data, in descending order:
+//..
+    bsl::vector<int> data(100000);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>(data.size() - i);
+    }
+//..
+// Then, we sort the data on the pool:
+//..
+    bdlmt::ParallelUtil::sort(&pool, data.begin(), data.end());
+
+    ASSERT(1      == data.front());
+    ASSERT(100000 == data.back());
+//..
+// Finally, we compute the sum of squares, converting each element to a 64-bit
+// integer before it is squared and summed:
+//..
+    bsls::Types::Int64 sum = bdlmt::ParallelUtil::transformReduce(
+                                         &pool,
+                                         data.begin(),
+                                         data.end(),
+                                         bsls::Types::Int64(0),
+                                         bsl::plus<bsls::Types::Int64>(),
+                                         Square());
+
+    ASSERT(333338333350000LL == sum);
+
+    pool.stop();
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: CALLING FROM A JOB AND FROM SEVERAL THREADS
+        //
+        // Concerns:
+        //: 1 An algorithm called from a job running in the pool it uses
+        //:   completes even if every other thread of the pool is busy.
+        //:
+        //: 2 Algorithms can be called concurrently on the same pool from
+        //:   several threads.
+        //:
+        //: 3 All memory allocated by the algorithms is released.
+        //
+        // Plan:
+        //: 1 Occupy one thread of a pool of two with a job that blocks on a
+        //:   semaphore, then enqueue a job that calls 'reduce' on the same
+        //:   pool, and wait for it to complete before releasing the blocked
+        //:   job.  (C-1)
+        //:
+        //: 2 Sort a different array from each of several threads, on the same
+        //:   pool, and verify the results.  (C-2)
+        //:
+        //: 3 Verify that the default allocator has no outstanding blocks.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: CALLING FROM A JOB IN THE SAME POOL
+        //   CONCERN: CALLING FROM SEVERAL THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CONCERN: CALLING FROM A JOB AND FROM SEVERAL THREADS"
+                 << endl
+                 << "===================================================="
+                 << endl;
+
+        bsl::vector<int> data;
+        generate(&data, 100000, 1000);
+
+        const Int64 EXPECTED = bsl::accumulate(data.begin(),
+                                               data.end(),
+                                               Int64(0));
+
+        if (verbose) cout << "\nCalling from a job in the same pool." << endl;
+        {
+            bdlmt::FixedThreadPool pool(2, 100);
+            ASSERT(0 == pool.start());
+
+            bslmt::Semaphore started;
+            bslmt::Semaphore release;
+            bslmt::Semaphore done;
+            Int64            result = 0;
+
+            ASSERT(0 == pool.enqueueJob(bdlf::BindUtil::bind(
+                                                             &blockOnSemaphore,
+                                                             &started,
+                                                             &release)));
+            started.wait();
+
+            ASSERT(0 == pool.enqueueJob(bdlf::BindUtil::bind(&reduceInPool,
+                                                             &pool,
+                                                             &data,
+                                                             &result,
+                                                             &done)));
+            done.wait();
+            ASSERTV(result, EXPECTED == result);
+
+            release.post();
+            pool.stop();
+        }
+
+        if (verbose) cout << "\nCalling from several threads." << endl;
+        {
+            const int NUM_THREADS = 4;
+
+            bdlmt::WorkStealingThreadPool pool(3);
+            ASSERT(0 == pool.start());
+
+            bsl::vector<bsl::vector<int> > arrays(NUM_THREADS);
+            bslmt::ThreadGroup             threads;
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                generate(&arrays[i], 20000 + i, 1000 + i);
+                threads.addThread(bdlf::BindUtil::bind(&sortConcurrently,
+                                                       &pool,
+                                                       &arrays[i]));
+            }
+            threads.joinAll();
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                bsl::vector<int> expected;
+                generate(&expected, 20000 + i, 1000 + i);
+                bsl::sort(expected.begin(), expected.end());
+
+                ASSERTV(i, expected == arrays[i]);
+            }
+            pool.stop();
+        }
+
+        bsl::vector<int>().swap(data);
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'sort'
+        //
+        // Concerns:
+        //: 1 'sort' sorts the range according to the comparator, or
+        //:   'operator<' if none is supplied.
+        //:
+        //: 2 Ranges of every length, including ones too short to be divided
+        //:   into blocks and ones whose length is not a multiple of the number
+        //:   of blocks, are sorted.
+        //:
+        //: 3 Ranges with many duplicates, sorted ranges, and reverse-sorted
+        //:   ranges are sorted.
+        //:
+        //: 4 Elements that are not bitwise movable are sorted.
+        //:
+        //: 5 Temporary memory, including the buffer used to merge the sorted
+        //:   blocks, comes from the supplied allocator, if any, and not from
+        //:   the default allocator, and is allocated in the calling thread.
+        //
+        // Plan:
+        //: 1 For each pool and for a variety of lengths and ranges of values,
+        //:   sort pseudo-random data with and without a comparator, sort the
+        //:   (reverse-)sorted results, and compare with 'bsl::sort'.  Also
+        //:   sort strings.  (C-1..4)
+        //:
+        //: 2 Sort a range long enough to be sorted in several blocks on a
+        //:   started pool, supplying a test allocator, and verify that the
+        //:   default allocator is not used, and that the supplied allocator
+        //:   provided at least a block for every element.  (C-5)
+        //
+        // Testing:
+        //   void sort(POOL *, RANDOM_IT, RANDOM_IT);
+        //   void sort(POOL *, RANDOM_IT, RANDOM_IT, COMPARATOR, *bA = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'sort'" << endl
+                          << "==============" << endl;
+
+        runOnPools<SortTest>();
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting the supplied allocator." << endl;
+        {
+            bslma::TestAllocator poolAllocator("pool", veryVeryVerbose);
+            bslma::TestAllocator ta("supplied", veryVeryVerbose);
+
+            bdlmt::FixedThreadPool pool(4, 100, &poolAllocator);
+            ASSERT(0 == pool.start());
+
+            const bsl::size_t LENGTH = 50000;
+
+            bsl::vector<int> data(&poolAllocator);
+            generate(&data, LENGTH, 1000000);
+
+            bsl::vector<int> expected(data, &poolAllocator);
+            bsl::sort(expected.begin(), expected.end());
+
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            Util::sort(&pool,
+                       data.begin(),
+                       data.end(),
+                       bsl::less<int>(),
+                       &ta);
+
+            ASSERT(expected == data);
+            ASSERT(dam.isTotalSame());
+            ASSERTV(ta.numAllocations(), 0 < ta.numAllocations());
+            ASSERTV(ta.numBytesMax(), LENGTH * sizeof(int) <=
+                               static_cast<bsl::size_t>(ta.numBytesMax()));
+
+            pool.stop();
+
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'partition'
+        //
+        // Concerns:
+        //: 1 'partition' reorders the range so that the elements satisfying
+        //:   the predicate precede the others, and returns the partition
+        //:   point.
+        //:
+        //: 2 The range is a permutation of the original range.
+        //:
+        //: 3 Ranges in which no element, or every element, satisfies the
+        //:   predicate, and ranges that are already partitioned, either way,
+        //:   are handled.
+        //
+        // Plan:
+        //: 1 For each pool, and for a variety of lengths and predicates,
+        //:   partition pseudo-random data, and verify the partition point,
+        //:   that the result is partitioned, and that the sorted result
+        //:   equals the sorted original.  Repeat with sorted and
+        //:   reverse-sorted data.  (C-1..3)
+        //
+        // Testing:
+        //   RANDOM_IT partition(POOL *, RANDOM_IT, RANDOM_IT, PRED, *bA = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'partition'" << endl
+                          << "===================" << endl;
+
+        runOnPools<PartitionTest>();
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'inclusiveScan'
+        //
+        // Concerns:
+        //: 1 'inclusiveScan' stores the inclusive scan of the input range to
+        //:   the output range, using the supplied operation, or 'operator+'
+        //:   if none is supplied, and returns the end of the output range.
+        //:
+        //: 2 The output range may be the input range.
+        //:
+        //: 3 The order of the elements is preserved, so that non-commutative
+        //:   operations can be used.
+        //
+        // Plan:
+        //: 1 For each pool, and for a variety of lengths, compare the result
+        //:   of 'inclusiveScan' with that of 'bsl::partial_sum', to a
+        //:   separate output range and in place.  (C-1..2)
+        //:
+        //: 2 Scan a range of strings with concatenation.  (C-3)
+        //
+        // Testing:
+        //   OUTPUT_IT inclusiveScan(POOL *, RANDOM_IT, RANDOM_IT, OUTPUT_IT);
+        //   OUTPUT_IT inclusiveScan(POOL *, IT, IT, OUT_IT, BIN_OP, *bA = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'inclusiveScan'" << endl
+                          << "=======================" << endl;
+
+        runOnPools<InclusiveScanTest>();
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'reduce' AND 'transformReduce'
+        //
+        // Concerns:
+        //: 1 'reduce' returns the combination of the initial value and the
+        //:   elements, using the supplied operation, or 'operator+' if none
+        //:   is supplied.
+        //:
+        //: 2 'transformReduce' returns the combination of the initial value
+        //:   and the transformed elements (or pairs of elements).
+        //:
+        //: 3 The initial value is returned for an empty range.
+        //:
+        //: 4 The order of the elements is preserved, so that non-commutative
+        //:   operations can be used.
+        //:
+        //: 5 Temporary memory comes from the supplied allocator, if any, and
+        //:   not from the default allocator.
+        //
+        // Plan:
+        //: 1 For each pool, and for a variety of lengths, compare the results
+        //:   of 'reduce' and 'transformReduce' with values computed
+        //:   sequentially.  (C-1..3)
+        //:
+        //: 2 Reduce a range of strings with concatenation.  (C-4)
+        //:
+        //: 3 Reduce a range on a started pool, supplying a test allocator, and
+        //:   verify that it, and not the default allocator, is used.  (C-5)
+        //
+        // Testing:
+        //   TYPE reduce(POOL *, RANDOM_IT, RANDOM_IT, const TYPE&);
+        //   TYPE reduce(POOL *, IT, IT, const TYPE&, BINARY_OP, *bA = 0);
+        //   TYPE transformReduce(POOL *, IT, IT, const T&, RED, TR, *bA = 0);
+        //   TYPE transformReduce(POOL *, I1, I1, I2, const T&, RED, TR, *bA);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'reduce' AND 'transformReduce'" << endl
+                          << "======================================" << endl;
+
+        runOnPools<ReduceTest>();
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting the supplied allocator." << endl;
+        {
+            bslma::TestAllocator poolAllocator("pool", veryVeryVerbose);
+            bslma::TestAllocator ta("supplied", veryVeryVerbose);
+
+            bdlmt::FixedThreadPool pool(4, 100, &poolAllocator);
+            ASSERT(0 == pool.start());
+
+            bsl::vector<int> data(&poolAllocator);
+            generate(&data, 10000, 1000);
+
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            const Int64 sum = Util::reduce(&pool,
+                                           data.begin(),
+                                           data.end(),
+                                           Int64(0),
+                                           bsl::plus<Int64>(),
+                                           &ta);
+
+            ASSERTV(sum, bsl::accumulate(data.begin(), data.end(), Int64(0))
+                                                                      == sum);
+            ASSERT(dam.isTotalSame());
+            ASSERTV(ta.numAllocations(), 0 < ta.numAllocations());
+
+            // Jobs that start after 'reduce' returns release the shared state
+            // they hold, so the supplied allocator is checked once the pool
+            // has stopped.
+
+            pool.stop();
+
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'forEach' AND 'transform'
+        //
+        // Concerns:
+        //: 1 'forEach' invokes the function exactly once on each element.
+        //:
+        //: 2 'transform' stores the result of the operation on each element
+        //:   (or pair of elements) to the output range, and returns the end
+        //:   of the output range.
+        //:
+        //: 3 The algorithms accept pointers as iterators, and 'transform' can
+        //:   be applied in place.
+        //
+        // Plan:
+        //: 1 For each pool, and for a variety of lengths, apply 'forEach'
+        //:   with a function incrementing each element, and apply both
+        //:   overloads of 'transform', and verify the results.  (C-1..3)
+        //
+        // Testing:
+        //   void forEach(POOL *, RANDOM_IT, RANDOM_IT, FUNCTION, *bA = 0);
+        //   OUTPUT_IT transform(POOL *, IT, IT, OUTPUT_IT, UNARY_OP, *bA = 0);
+        //   OUTPUT_IT transform(POOL *, I1, I1, I2, OUT_IT, BIN_OP, *bA = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'forEach' AND 'transform'" << endl
+                          << "=================================" << endl;
+
+        runOnPools<ForEachAndTransformTest>();
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'ParallelUtil_Imp'
+        //
+        // Concerns:
+        //: 1 'chunkBoundary' divides a range into contiguous chunks whose
+        //:   lengths differ by at most one.
+        //:
+        //: 2 'numChunks' is at most the length of the range, is 1 for a pool
+        //:   with a single thread (and a non-empty range), and otherwise
+        //:   allows several chunks per thread.
+        //:
+        //: 3 'runChunks' invokes the functor exactly once for each chunk,
+        //:   whether or not the pool accepts jobs.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a variety of lengths and numbers of chunks, verify the
+        //:   boundaries of each chunk.  (C-1)
+        //:
+        //: 2 Verify 'numChunks' for pools of several sizes.  (C-2)
+        //:
+        //: 3 Run a functor counting the invocations for each chunk on started
+        //:   and unstarted pools, and verify the counts.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   ParallelUtil_Imp
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'ParallelUtil_Imp'" << endl
+                          << "==========================" << endl;
+
+        if (verbose) cout << "\nTesting 'chunkBoundary'." << endl;
+        {
+            for (bsl::size_t length = 0; length < 100; ++length) {
+                for (bsl::size_t numChunks = 1; numChunks < 20; ++numChunks) {
+                    ASSERT(0 == Imp::chunkBoundary(length, numChunks, 0));
+                    ASSERT(length == Imp::chunkBoundary(length,
+                                                        numChunks,
+                                                        numChunks));
+
+                    for (bsl::size_t i = 0; i < numChunks; ++i) {
+                        const bsl::size_t chunkLength =
+                                   Imp::chunkBoundary(length, numChunks, i + 1)
+                                 - Imp::chunkBoundary(length, numChunks, i);
+
+                        ASSERTV(length, numChunks, i,
+                                chunkLength == length / numChunks
+                             || chunkLength == length / numChunks + 1);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'numChunks'." << endl;
+        {
+            bdlmt::FixedThreadPool pool1(1, 10);
+            bdlmt::FixedThreadPool pool4(4, 10);
+
+            ASSERT(0 == Imp::numChunks(pool1, 0));
+            ASSERT(1 == Imp::numChunks(pool1, 1));
+            ASSERT(1 == Imp::numChunks(pool1, 1000000));
+
+            ASSERT(0 == Imp::numChunks(pool4, 0));
+            ASSERT(1 == Imp::numChunks(pool4, 1));
+            ASSERT(7 == Imp::numChunks(pool4, 7));
+            ASSERT(4 * Imp::k_CHUNKS_PER_THREAD ==
+                                            Imp::numChunks(pool4, 1000000));
+
+            bslmt::ThreadAttributes attributes;
+            bdlmt::ThreadPool       threadPool(attributes, 1, 3, 100);
+
+            ASSERT(3 * Imp::k_CHUNKS_PER_THREAD ==
+                                       Imp::numChunks(threadPool, 1000000));
+        }
+
+        if (verbose) cout << "\nTesting 'runChunks'." << endl;
+        {
+            const bsl::size_t NUM_CHUNKS[] = { 0, 1, 2, 3, 16, 100 };
+            const int         NUM_DATA = sizeof NUM_CHUNKS
+                                       / sizeof *NUM_CHUNKS;
+
+            bdlmt::FixedThreadPool started(4, 100);
+            bdlmt::FixedThreadPool notStarted(4, 100);
+
+            ASSERT(0 == started.start());
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const bsl::size_t NUM = NUM_CHUNKS[ti];
+
+                for (int cfg = 0; cfg < 2; ++cfg) {
+                    bsls::AtomicInt counts[100];
+                    ChunkRecorder   recorder = { counts };
+
+                    Imp::runChunks(cfg ? &started : &notStarted,
+                                   NUM,
+                                   &recorder,
+                                   &defaultAllocator);
+
+                    for (bsl::size_t i = 0; i < NUM; ++i) {
+                        ASSERTV(NUM, cfg, i, counts[i], 1 == counts[i]);
+                    }
+                }
+            }
+            started.stop();
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Imp::chunkBoundary(10, 0, 0));
+            ASSERT_FAIL(Imp::chunkBoundary(10, 2, 3));
+            ASSERT_PASS(Imp::chunkBoundary(10, 2, 2));
+
+            bsl::vector<int> data(10);
+
+            bdlmt::FixedThreadPool *nullPool = 0;
+            ASSERT_FAIL(Util::forEach(nullPool,
+                                      data.begin(),
+                                      data.end(),
+                                      AddOne()));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Reduce and sort an array on each kind of pool, and verify the
+        //:   results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        runOnPools<BreathingTest>();
+
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+        //
+        // Concerns:
+        //: 1 The algorithms become faster as threads are added, up to the
+        //:   number of available processors.
+        //
+        // Plan:
+        //: 1 For pools of 1, 2, 4, 8, 16, 32, and 64 threads, time each
+        //:   algorithm on an array of N pseudo-random integers (N given by the
+        //:   second command-line argument, 4000000 by default), and compare
+        //:   with the corresponding sequential algorithm.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "PERFORMANCE: SCALING WITH THE NUMBER OF THREADS" << endl
+               << "===============================================" << endl;
+
+        const bsl::size_t N = verbose > 1 ? verbose : 4000000;
+
+        cout << "N = " << N << endl;
+
+        bsl::vector<int> original;
+        generate(&original, N, 1000000);
+
+        bsl::vector<int>   data;
+        bsl::vector<Int64> output(N);
+        IsLessThan         predicate = { 500000 };
+        bsls::Stopwatch    timer;
+        Int64              checksum = 0;
+
+        cout << "threads        sort   transform      reduce        scan"
+                "   partition" << endl;
+
+        {
+            double times[5];
+
+            data = original;
+            timer.reset();
+            timer.start();
+            bsl::sort(data.begin(), data.end());
+            times[0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            bsl::transform(original.begin(),
+                           original.end(),
+                           output.begin(),
+                           SquareOf());
+            times[1] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            checksum += bsl::accumulate(original.begin(),
+                                        original.end(),
+                                        Int64(0));
+            times[2] = timer.elapsedTime();
+
+            data = original;
+            timer.reset();
+            timer.start();
+            bsl::partial_sum(data.begin(), data.end(), data.begin());
+            times[3] = timer.elapsedTime();
+
+            data = original;
+            timer.reset();
+            timer.start();
+            bsl::partition(data.begin(), data.end(), predicate);
+            times[4] = timer.elapsedTime();
+
+            printf("%7s", "seq");
+            for (int i = 0; i < 5; ++i) {
+                printf("  %9.4fs", times[i]);
+            }
+            printf("\n");
+        }
+
+        for (int numThreads = 1; numThreads <= 64; numThreads *= 2) {
+            bdlmt::WorkStealingThreadPool pool(numThreads);
+            pool.start();
+
+            double times[5];
+
+            data = original;
+            timer.reset();
+            timer.start();
+            Util::sort(&pool, data.begin(), data.end());
+            times[0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            Util::transform(&pool,
+                            original.begin(),
+                            original.end(),
+                            output.begin(),
+                            SquareOf());
+            times[1] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            checksum += Util::reduce(&pool,
+                                     original.begin(),
+                                     original.end(),
+                                     Int64(0));
+            times[2] = timer.elapsedTime();
+
+            data = original;
+            timer.reset();
+            timer.start();
+            Util::inclusiveScan(&pool, data.begin(), data.end(), data.begin());
+            times[3] = timer.elapsedTime();
+
+            data = original;
+            timer.reset();
+            timer.start();
+            Util::partition(&pool, data.begin(), data.end(), predicate);
+            times[4] = timer.elapsedTime();
+
+            printf("%7d", numThreads);
+            for (int i = 0; i < 5; ++i) {
+                printf("  %9.4fs", times[i]);
+            }
+            printf("\n");
+
+            pool.stop();
+        }
+
+        if (veryVerbose) { P(checksum); }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == globalAllocator.numAllocations());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
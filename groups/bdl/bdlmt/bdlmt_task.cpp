@@ -0,0 +1,43 @@
+// bdlmt_task.cpp                                                     -*-C++-*-
+#include <bdlmt_task.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_task_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// The members named in 'snake_case' ('promise_type', 'await_ready',
+// 'initial_suspend', and so on) are required by the language, which finds
+// them by name when compiling a coroutine.
+//
+// The frame of a coroutine is allocated by the 'operator new' of its promise
+// type, which the language passes the arguments of the coroutine, but it is
+// deallocated by the 'operator delete' of the promise type, which is passed
+// only the address and size of the frame.  Therefore, the allocator of a
+// frame is stored in the frame, past the space requested for it.
+//
+// A task awaited by another coroutine transfers control to it on completion
+// by returning its handle from 'await_suspend' of the final awaiter
+// ("symmetric transfer"), rather than by resuming it, so that a chain of
+// tasks completing synchronously does not grow the stack.
+//
+// 'TaskUtil::spawn' and 'TaskUtil::syncWait' start a task by starting another
+// coroutine that awaits it.  The coroutine started by 'syncWait' signals its
+// latch from its final awaiter, once it is suspended, so that the waiting
+// thread can destroy it as soon as the latch is released.
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,2064 @@
+// bdlmt_task.h                                                       -*-C++-*-
+#ifndef INCLUDED_BDLMT_TASK
+#define INCLUDED_BDLMT_TASK
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a coroutine task type with pool, timer, and queue awaiters.
+//
+//@CLASSES:
+//  bdlmt::Task: lazily-started coroutine producing a value of 'TYPE'
+//  bdlmt::TaskUtil: namespace for awaiters and for starting tasks
+//
+//@SEE_ALSO: bdlmt_eventscheduler, bdlmt_fixedthreadpool, bdlmt_future,
+//           bdlmt_threadpool, bdlcc_boundedqueue
+//
+//@DESCRIPTION: This component provides a class template, 'bdlmt::Task', that
+// is the return type of a C++20 coroutine producing a value of its
+// parameterized 'TYPE' (or no value, if 'TYPE' is 'void'), and a 'struct',
+// 'bdlmt::TaskUtil', providing *awaiters* with which such a coroutine suspends
+// until it is resumed on a thread pool, until a time is reached on an event
+// scheduler, or until an element is popped from a bounded queue, and functions
+// that start a task from code that is not itself a coroutine.
+//
+// A suspended coroutine occupies no thread: its state lives in a heap
+// allocated *coroutine* *frame*, and the thread that suspended it returns to
+// whatever it was doing (for a pool thread, to running other jobs).  This
+// allows request handling to be written as straight-line code that waits on
+// timers and queues, without tying up a thread per outstanding request.
+//
+// This component is available only when the compiler supports coroutines, as
+// indicated by 'BSLS_COMPILERFEATURES_SUPPORT_COROUTINE'; otherwise, this
+// header provides no declarations.
+//
+///Tasks
+///-----
+// A coroutine returning a 'bdlmt::Task' is *lazy*: calling it allocates its
+// frame and returns a task, but does not run any of its body.  The body runs
+// when the task is awaited (with 'co_await') by another coroutine, or is
+// started by 'bdlmt::TaskUtil::spawn' or 'bdlmt::TaskUtil::syncWait'.  The
+// awaiting coroutine is suspended until the task completes, and is then
+// resumed, by the thread that completed the task, with the value passed to
+// 'co_return' (or with the exception that escaped the task, which is rethrown
+// by 'co_await').  A task may be awaited only once, and only as an rvalue:
+//..
+//  bdlmt::Task<int> answer();
+//
+//  bdlmt::Task<int> twiceTheAnswer()
+//  {
+//      bdlmt::Task<int> task = answer();
+//      int              value = co_await bsl::move(task);
+//      co_return 2 * value + co_await answer();
+//  }
+//..
+// A 'bdlmt::Task' owns the frame of its coroutine, and destroys it when the
+// task is destroyed.  The behavior is undefined if a task is destroyed while
+// its coroutine is suspended on anything other than its initial suspension
+// (i.e., while it is running, or is waiting to be resumed by an awaiter).
+//
+///Awaiters
+///--------
+// 'bdlmt::TaskUtil' provides the following awaiters, each of which is used as
+// the operand of 'co_await' in a coroutine returning a 'bdlmt::Task':
+//
+//: 'resumeOn(executor)':
+//:   Suspend the coroutine, and enqueue a job resuming it on the specified
+//:   executor, which may be a 'bdlmt::FixedThreadPool', a 'bdlmt::ThreadPool',
+//:   a 'bdlmt::WorkStealingThreadPool', or any other type providing:
+//:..
+//:  int enqueueJob(const bsl::function<void()>& job);
+//:      // Enqueue the specified 'job' to be executed.  Return 0 on success,
+//:      // and a non-zero value otherwise.
+//:..
+//:   If the job cannot be enqueued, the coroutine continues on the current
+//:   thread.  'co_await' yields 0 if the coroutine was resumed by the
+//:   executor, and the non-zero status of 'enqueueJob' otherwise.
+//:
+//: 'sleepFor(scheduler, duration)' and 'sleepUntil(scheduler, epochTime)':
+//:   Suspend the coroutine until the specified duration has elapsed, or the
+//:   specified time (according to the clock of the 'bdlmt::EventScheduler')
+//:   has been reached.
+//:
+//: 'popFront(value, queue, executor)' and
+//: 'popFront(value, queue, executor, scheduler, timeout)':
+//:   Suspend the coroutine until an element can be popped from the specified
+//:   'bdlcc::BoundedQueue' (or the specified timeout elapses on the specified
+//:   event scheduler), load the popped element into the specified 'value',
+//:   and resume the coroutine on the specified executor.  'co_await' yields 0
+//:   on success, 'bdlmt::TaskUtil::e_TIMED_OUT' if the timeout elapsed, and
+//:   the status returned by 'tryPopFront' of the queue otherwise (for
+//:   example, if popping from the queue was disabled).
+//
+// The coroutine is resumed by a thread of the executor for 'resumeOn' and
+// 'popFront', and by the dispatcher thread of the event scheduler for
+// 'sleepFor' and 'sleepUntil'.  Since the dispatcher thread is shared by all
+// the events of a scheduler, a coroutine resumed by it should do little work
+// before suspending again; 'co_await bdlmt::TaskUtil::resumeOn(&pool)' moves
+// the rest of the work to a pool.  The event scheduler must have been
+// started, and must not be stopped while a coroutine is waiting on it.
+//
+// A coroutine waiting in 'popFront' neither blocks a thread nor polls the
+// queue: it is registered as a 'bdlcc::BoundedQueueWaiter' of the queue, and
+// is notified by the thread whose push makes an element available (see
+// {'bdlcc_boundedqueue'|Waiting Without Blocking}), which enqueues the job
+// resuming the coroutine on the executor.  If a timeout is supplied, a single
+// event is scheduled for it, and is canceled when the coroutine is notified.
+//
+///Starting Tasks
+///--------------
+// Code that is not a coroutine starts a task with either:
+//
+//: 'spawn(task)' and 'spawn(executor, task)':
+//:   Run the specified task, on the current thread or as a job enqueued on the
+//:   specified executor, until its first suspension, and return.  The task is
+//:   destroyed when it completes, and its value (if any) is discarded.  The
+//:   behavior is undefined (the program is terminated) if an exception escapes
+//:   the task.
+//:
+//: 'syncWait(task)':
+//:   Run the specified task on the current thread until its first suspension,
+//:   block until it completes, and return its value, or rethrow the exception
+//:   that escaped it.
+//
+///Memory Allocation
+///-----------------
+// The frame of a coroutine returning a 'bdlmt::Task' is allocated by the
+// first argument of the coroutine that is convertible to 'bslma::Allocator *'
+// (if that argument is 0, or there is no such argument, by the default
+// allocator).  The value returned by the coroutine is constructed in the
+// frame, using the same allocator if 'TYPE' uses 'bslma' allocators:
+//..
+//  bdlmt::Task<bsl::string> greet(const char       *name,
+//                                 bslma::Allocator *basicAllocator = 0)
+//      // Return a task producing a greeting to the specified 'name'.
+//      // Optionally specify a 'basicAllocator' used to supply memory.  If
+//      // 'basicAllocator' is 0, the currently installed default allocator is
+//      // used.
+//  {
+//      co_return bsl::string("Hello, ") + name;
+//  }
+//..
+// The frames of the coroutines used internally by 'spawn' and 'syncWait' are
+// allocated by the allocator of the task they start.  The awaiters allocate
+// no memory other than the jobs and events they submit to executors and event
+// schedulers.
+//
+///Thread Safety
+///-------------
+// A 'bdlmt::Task' object is not thread-safe; it is normally accessed only by
+// the code that created it and by the coroutine awaiting it.  The awaiters may
+// be used concurrently by any number of coroutines, sharing executors,
+// schedulers, and queues.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handling Requests from a Queue
+///- - - - - - - - - - - - - - - - - - - - -
+// In this example we handle requests popped from a queue: each request is
+// handed to a thread pool for processing, and the handler gives up once no
+// request has arrived for a while.  No thread is blocked while the handler
+// waits for a request or for its processing.
+//
+// First, we define a coroutine that processes a request on a thread pool:
+//..
+//  bdlmt::Task<int> process(int request, bdlmt::FixedThreadPool *pool)
+//      // Return a task producing the response to the specified 'request',
+//      // computed on the specified 'pool'.
+//  {
+//      co_await bdlmt::TaskUtil::resumeOn(pool);
+//
+//      co_return request * request;
+//  }
+//..
+// Then, we define a coroutine that handles the requests in a queue, until a
+// request of 0 is received, or no request is received within 5 seconds:
+//..
+//  bdlmt::Task<int> handleRequests(bdlcc::BoundedQueue<int> *requests,
+//                                  bdlmt::FixedThreadPool   *pool,
+//                                  bdlmt::EventScheduler    *scheduler)
+//      // Return a task that processes, on the specified 'pool', the requests
+//      // in the specified 'requests' queue, using the specified 'scheduler'
+//      // to time out waiting for them, and produces the sum of the
+//      // responses.
+//  {
+//      const bsls::TimeInterval timeout(5.0);
+//
+//      int sum = 0;
+//      int request;
+//      while (0 == co_await bdlmt::TaskUtil::popFront(&request,
+//                                                     requests,
+//                                                     pool,
+//                                                     scheduler,
+//                                                     timeout)
+//          && 0 != request) {
+//          sum += co_await process(request, pool);
+//      }
+//      co_return sum;
+//  }
+//..
+// Next, we create and start the pool and the scheduler:
+//..
+//  bdlmt::FixedThreadPool pool(2, 100);
+//  pool.start();
+//
+//  bdlmt::EventScheduler scheduler;
+//  scheduler.start();
+//
+//  bdlcc::BoundedQueue<int> requests(16);
+//..
+// Then, we start handling requests, and push the requests from this thread,
+// which never blocks on the handler:
+//..
+//  bdlmt::Task<int> handler = handleRequests(&requests, &pool, &scheduler);
+//
+//  requests.pushBack(1);
+//  requests.pushBack(2);
+//  requests.pushBack(3);
+//  requests.pushBack(0);
+//..
+// Finally, we wait for the result of the handler, and stop the scheduler and
+// the pool:
+//..
+//  assert(14 == bdlmt::TaskUtil::syncWait(bsl::move(handler)));
+//
+//  scheduler.stop();
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_compilerfeatures.h>
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+#include <bdlmt_eventscheduler.h>
+
+#include <bdlcc_boundedqueue.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+
+#include <bslmt_latch.h>
+
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_exception.h>
+#include <bsl_functional.h>
+#include <bsl_type_traits.h>
+#include <bsl_utility.h>
+
+#include <coroutine>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+template <class TYPE> class Task;
+struct TaskUtil;
+
+//                           =====================
+//                           struct Task_FrameUtil
+//                           =====================
+
+struct Task_FrameUtil {
+    // This component-private utility 'struct' provides functions that allocate
+    // and deallocate coroutine frames, recording in each frame the allocator
+    // that supplied it.
+
+  private:
+    // PRIVATE CLASS METHODS
+    static bsl::size_t allocatorOffset(bsl::size_t size);
+        // Return the offset, within a block allocated for a frame of the
+        // specified 'size', of the address of the allocator that supplied the
+        // block.
+
+  public:
+    // CLASS METHODS
+    static void *allocate(bsl::size_t size, bslma::Allocator *allocator);
+        // Return a block of memory large enough for a coroutine frame of the
+        // specified 'size', allocated by the specified 'allocator'.
+
+    static void deallocate(void *frame, bsl::size_t size);
+        // Return the specified 'frame', of the specified 'size', to the
+        // allocator that supplied it.  The behavior is undefined unless
+        // 'frame' was returned by 'allocate' with the same 'size'.
+
+    static bslma::Allocator *selectAllocator();
+    template <class FIRST, class... REST>
+    static bslma::Allocator *selectAllocator(const FIRST&   first,
+                                             const REST&... rest);
+        // Return the first of the specified arguments that is convertible to
+        // 'bslma::Allocator *', if it is non-zero, and the default allocator
+        // otherwise.
+};
+
+//                         =========================
+//                         class Task_FrameAllocator
+//                         =========================
+
+class Task_FrameAllocator {
+    // This component-private class provides the allocation functions for the
+    // frame of a coroutine whose promise type derives from it.
+
+  public:
+    // CLASS METHODS
+    template <class... ARGS>
+    static void *operator new(bsl::size_t size, const ARGS&... args);
+        // Return a frame of the specified 'size' allocated by the allocator
+        // selected from the specified 'args' (the arguments of the coroutine)
+        // by 'Task_FrameUtil::selectAllocator'.
+
+    static void operator delete(void *frame, bsl::size_t size);
+        // Return the specified 'frame', of the specified 'size', to the
+        // allocator that supplied it.
+};
+
+//                          =======================
+//                          class Task_FinalAwaiter
+//                          =======================
+
+class Task_FinalAwaiter {
+    // This component-private class provides the awaiter on which the
+    // coroutine of a task suspends when it completes, transferring control to
+    // the coroutine awaiting the task, if any.
+
+  public:
+    // MANIPULATORS
+    bool await_ready() const noexcept;
+        // Return 'false'.
+
+    template <class PROMISE>
+    std::coroutine_handle<> await_suspend(
+                             std::coroutine_handle<PROMISE> handle) noexcept;
+        // Return the continuation of the promise of the specified 'handle',
+        // if set, and a handle to a no-op coroutine otherwise.
+
+    void await_resume() const noexcept;
+        // Do nothing.
+};
+
+//                           ======================
+//                           class Task_PromiseBase
+//                           ======================
+
+class Task_PromiseBase : public Task_FrameAllocator {
+    // This component-private class provides the part of the promise type of a
+    // 'Task' that does not depend on the type of its value: the continuation
+    // to resume on completion, the exception that escaped the coroutine, if
+    // any, and the allocator of the frame.
+
+    // DATA
+    std::coroutine_handle<>  d_continuation;  // coroutine awaiting the task,
+                                              // if any
+
+    bsl::exception_ptr       d_exception;     // exception that escaped the
+                                              // coroutine, if any
+
+    bslma::Allocator        *d_allocator_p;   // allocator of the frame (held)
+
+  protected:
+    // PROTECTED CREATORS
+    template <class... ARGS>
+    explicit Task_PromiseBase(const ARGS&... args);
+        // Create a promise base for a coroutine invoked with the specified
+        // 'args', using the allocator selected from 'args' by
+        // 'Task_FrameUtil::selectAllocator'.
+
+    // PROTECTED ACCESSORS
+    void rethrowIfFailed() const;
+        // Rethrow the exception that escaped the coroutine, if any.
+
+  public:
+    // MANIPULATORS
+    std::suspend_always initial_suspend() noexcept;
+        // Return an awaiter suspending the coroutine before it runs, as a
+        // task is started only when it is awaited.
+
+    Task_FinalAwaiter final_suspend() noexcept;
+        // Return an awaiter suspending the completed coroutine and resuming
+        // its continuation.
+
+    void setContinuation(std::coroutine_handle<> continuation);
+        // Set the coroutine to resume when the coroutine of this promise
+        // completes to the specified 'continuation'.
+
+    void unhandled_exception();
+        // Record the exception being handled as the one that escaped the
+        // coroutine.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator of the frame of the coroutine.
+
+    std::coroutine_handle<> continuation() const;
+        // Return the coroutine to resume when the coroutine of this promise
+        // completes, or a null handle if there is none.
+};
+
+//                             ==================
+//                             class Task_Promise
+//                             ==================
+
+template <class TYPE>
+class Task_Promise : public Task_PromiseBase {
+    // This component-private class template provides the promise type of a
+    // coroutine returning a 'Task<TYPE>', holding the value passed to
+    // 'co_return'.
+
+    // DATA
+    bsls::ObjectBuffer<TYPE> d_value;     // value, if 'd_hasValue'
+
+    bool                     d_hasValue;  // 'true' once 'd_value' is set
+
+  public:
+    // CREATORS
+    template <class... ARGS>
+    explicit Task_Promise(const ARGS&... args);
+        // Create a promise for a coroutine invoked with the specified 'args'.
+
+    ~Task_Promise();
+        // Destroy this object.
+
+    // MANIPULATORS
+    Task<TYPE> get_return_object();
+        // Return the task owning the coroutine of this promise.
+
+    template <class VALUE = TYPE>
+    void return_value(VALUE&& value);
+        // Set the value of this promise to the specified 'value', using the
+        // allocator of the frame if 'TYPE' uses 'bslma' allocators.
+
+    TYPE result();
+        // Rethrow the exception that escaped the coroutine, if any, and
+        // otherwise return the value of this promise, moved.  The behavior is
+        // undefined unless the coroutine has completed.
+};
+
+template <>
+class Task_Promise<void> : public Task_PromiseBase {
+    // This specialization provides the promise type of a coroutine returning
+    // a 'Task<void>'.
+
+  public:
+    // CREATORS
+    template <class... ARGS>
+    explicit Task_Promise(const ARGS&... args);
+        // Create a promise for a coroutine invoked with the specified 'args'.
+
+    // MANIPULATORS
+    Task<void> get_return_object();
+        // Return the task owning the coroutine of this promise.
+
+    void return_void();
+        // Do nothing.
+
+    void result();
+        // Rethrow the exception that escaped the coroutine, if any.  The
+        // behavior is undefined unless the coroutine has completed.
+};
+
+//                        ============================
+//                        class Task_CompletionAwaiter
+//                        ============================
+
+class Task_CompletionAwaiter {
+    // This component-private class provides an awaiter that starts the
+    // coroutine of a task and suspends the awaiting coroutine until it
+    // completes.
+
+  protected:
+    // DATA
+    std::coroutine_handle<>  d_handle;     // coroutine of the task
+
+    Task_PromiseBase        *d_promise_p;  // promise of the task
+
+  public:
+    // CREATORS
+    Task_CompletionAwaiter(std::coroutine_handle<>  handle,
+                           Task_PromiseBase        *promise);
+        // Create an awaiter for the coroutine referred to by the specified
+        // 'handle', having the specified 'promise'.
+
+    // MANIPULATORS
+    bool await_ready() const noexcept;
+        // Return 'true' if the coroutine has already completed, and 'false'
+        // otherwise.
+
+    std::coroutine_handle<> await_suspend(
+                                   std::coroutine_handle<> awaiter) noexcept;
+        // Set the continuation of the coroutine to the specified 'awaiter',
+        // and return the coroutine, so that it is started.
+
+    void await_resume() const noexcept;
+        // Do nothing.
+};
+
+//                             ==================
+//                             class Task_Awaiter
+//                             ==================
+
+template <class TYPE>
+class Task_Awaiter : public Task_CompletionAwaiter {
+    // This component-private class template provides the awaiter returned by
+    // 'co_await' on a 'Task<TYPE>', yielding the result of the task.
+
+  public:
+    // CREATORS
+    explicit Task_Awaiter(
+                  std::coroutine_handle<Task_Promise<TYPE> > handle);
+        // Create an awaiter for the coroutine referred to by the specified
+        // 'handle'.
+
+    // MANIPULATORS
+    TYPE await_resume();
+        // Rethrow the exception that escaped the coroutine, if any, and
+        // otherwise return its value.
+};
+
+//                                 ==========
+//                                 class Task
+//                                 ==========
+
+template <class TYPE>
+class Task {
+    // This class template provides the return type of a coroutine producing a
+    // value of the parameterized 'TYPE', or no value if 'TYPE' is 'void'.  A
+    // task owns the frame of its coroutine, which is started when the task is
+    // awaited.  This class is move-only.
+
+  public:
+    // TYPES
+    typedef Task_Promise<TYPE> promise_type;
+        // The promise type of a coroutine returning this type, as required by
+        // the language.
+
+  private:
+    // DATA
+    std::coroutine_handle<promise_type> d_handle;  // coroutine (owned), or
+                                                   // null
+
+    // FRIENDS
+    friend class Task_Promise<TYPE>;
+    friend struct TaskUtil;
+
+    // PRIVATE CREATORS
+    explicit Task(std::coroutine_handle<promise_type> handle);
+        // Create a task owning the coroutine referred to by the specified
+        // 'handle'.
+
+  public:
+    // CREATORS
+    Task();
+        // Create a task that does not own a coroutine.
+
+    Task(Task&& original) noexcept;
+        // Create a task owning the coroutine owned by the specified
+        // 'original', which is left owning no coroutine.
+
+    Task(const Task&) = delete;
+
+    ~Task();
+        // Destroy the coroutine owned by this task, if any, and this object.
+
+    // MANIPULATORS
+    Task& operator=(Task&& rhs) noexcept;
+        // Destroy the coroutine owned by this task, if any, transfer the
+        // ownership of the coroutine of the specified 'rhs' to this task,
+        // leaving 'rhs' owning no coroutine, and return a reference providing
+        // modifiable access to this task.
+
+    Task& operator=(const Task&) = delete;
+
+    Task_Awaiter<TYPE> operator co_await() &&;
+        // Return an awaiter that starts the coroutine owned by this task,
+        // suspends the awaiting coroutine until it completes, and yields its
+        // value (or rethrows the exception that escaped it).  The behavior is
+        // undefined unless 'isValid()' and this task has not been awaited or
+        // started before.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator of the frame of the coroutine owned by this
+        // task.  The behavior is undefined unless 'isValid()'.
+
+    bool isDone() const;
+        // Return 'true' if the coroutine owned by this task has completed,
+        // and 'false' otherwise.  The behavior is undefined unless
+        // 'isValid()'.
+
+    bool isValid() const;
+        // Return 'true' if this task owns a coroutine, and 'false' otherwise.
+};
+
+//                            ====================
+//                            class Task_ResumeJob
+//                            ====================
+
+class Task_ResumeJob {
+    // This component-private class provides a job, or event callback, that
+    // resumes a suspended coroutine.
+
+    // DATA
+    std::coroutine_handle<> d_handle;  // coroutine to resume
+
+  public:
+    // CREATORS
+    explicit Task_ResumeJob(std::coroutine_handle<> handle);
+        // Create a job resuming the coroutine referred to by the specified
+        // 'handle'.
+
+    // ACCESSORS
+    void operator()() const;
+        // Resume the coroutine of this job.
+};
+
+//                         ==========================
+//                         class Task_ResumeOnAwaiter
+//                         ==========================
+
+template <class EXECUTOR>
+class Task_ResumeOnAwaiter {
+    // This component-private class template provides the awaiter returned by
+    // 'TaskUtil::resumeOn'.
+
+    // DATA
+    EXECUTOR *d_executor_p;  // executor resuming the coroutine (held)
+
+    int       d_status;      // status of enqueuing the job, if it failed
+
+  public:
+    // CREATORS
+    explicit Task_ResumeOnAwaiter(EXECUTOR *executor);
+        // Create an awaiter resuming the awaiting coroutine on the specified
+        // 'executor'.
+
+    // MANIPULATORS
+    bool await_ready() const noexcept;
+        // Return 'false'.
+
+    bool await_suspend(std::coroutine_handle<> handle);
+        // Enqueue a job resuming the coroutine referred to by the specified
+        // 'handle' on the executor of this awaiter.  Return 'true' if the job
+        // was enqueued, and 'false' (so that the coroutine continues on this
+        // thread) otherwise.
+
+    int await_resume() const noexcept;
+        // Return 0 if the coroutine was resumed by the executor, and the
+        // non-zero status of 'enqueueJob' otherwise.
+};
+
+//                          =======================
+//                          class Task_SleepAwaiter
+//                          =======================
+
+class Task_SleepAwaiter {
+    // This component-private class provides the awaiter returned by
+    // 'TaskUtil::sleepFor' and 'TaskUtil::sleepUntil'.
+
+    // DATA
+    EventScheduler     *d_scheduler_p;  // scheduler resuming the coroutine
+                                        // (held)
+
+    bsls::TimeInterval  d_epochTime;    // time at which to resume
+
+  public:
+    // CREATORS
+    Task_SleepAwaiter(EventScheduler            *scheduler,
+                      const bsls::TimeInterval&  epochTime);
+        // Create an awaiter resuming the awaiting coroutine at the specified
+        // 'epochTime' of the specified 'scheduler'.
+
+    // MANIPULATORS
+    bool await_ready() const noexcept;
+        // Return 'false'.
+
+    void await_suspend(std::coroutine_handle<> handle);
+        // Schedule an event resuming the coroutine referred to by the
+        // specified 'handle' at the time of this awaiter.
+
+    void await_resume() const noexcept;
+        // Do nothing.
+};
+
+//                         ==========================
+//                         class Task_PopFrontAwaiter
+//                         ==========================
+
+template <class TYPE, class EXECUTOR>
+class Task_PopFrontAwaiter : public bdlcc::BoundedQueueWaiter {
+    // This component-private class template provides the awaiter returned by
+    // 'TaskUtil::popFront'.  While its queue is empty, the awaiter is
+    // registered as a waiter of the queue and, if it has a timeout, an event
+    // is scheduled for the timeout; whichever of the notification by the
+    // queue and the event occurs first enqueues a job on the executor that
+    // pops the element (waiting again if another thread popped it first) and
+    // resumes the coroutine.
+
+    // PRIVATE TYPES
+    enum {
+        // The bits of 'd_pending', each of which is set while the
+        // corresponding party may still access this awaiter.  The party
+        // clearing the last bit completes the wait.
+
+        k_ARMING  = 1,  // 'arm' has not finished
+        k_NOTIFY  = 2,  // the queue may invoke 'notify'
+        k_TIMEOUT = 4   // the scheduler may dispatch the timeout event
+    };
+
+    class PopJob {
+        // This class provides the job, enqueued on the executor of an
+        // awaiter, that pops the element and resumes the coroutine.
+
+        // DATA
+        Task_PopFrontAwaiter *d_awaiter_p;  // awaiter to complete (held)
+
+      public:
+        // CREATORS
+        explicit PopJob(Task_PopFrontAwaiter *awaiter);
+            // Create a job completing the specified 'awaiter'.
+
+        // ACCESSORS
+        void operator()() const;
+            // Pop the element for the awaiter of this job and resume its
+            // coroutine, unless the awaiter must wait again.
+    };
+
+    class TimeoutEvent {
+        // This class provides the event callback timing out the wait of an
+        // awaiter.
+
+        // DATA
+        Task_PopFrontAwaiter *d_awaiter_p;  // awaiter to time out (held)
+
+      public:
+        // CREATORS
+        explicit TimeoutEvent(Task_PopFrontAwaiter *awaiter);
+            // Create an event timing out the specified 'awaiter'.
+
+        // ACCESSORS
+        void operator()() const;
+            // Time out the wait of the awaiter of this event.
+    };
+
+    typedef bdlcc::BoundedQueue<TYPE> Queue;
+
+    // DATA
+    TYPE                        *d_value_p;       // popped element (held)
+
+    Queue                       *d_queue_p;       // queue to pop from (held)
+
+    EXECUTOR                    *d_executor_p;    // executor resuming the
+                                                  // coroutine (held)
+
+    EventScheduler              *d_scheduler_p;   // scheduler timing out the
+                                                  // wait, or 0 if there is no
+                                                  // timeout (held)
+
+    bsls::TimeInterval           d_timeout;       // relative timeout, if
+                                                  // 'd_scheduler_p'
+
+    bsls::TimeInterval           d_deadline;      // absolute timeout, if
+                                                  // 'd_scheduler_p'
+
+    EventScheduler::EventHandle  d_timeoutEvent;  // event timing out the
+                                                  // current wait
+
+    bsls::AtomicInt              d_pending;       // parties that may access
+                                                  // this awaiter (see
+                                                  // 'k_ARMING')
+
+    bool                         d_isTimedOut;    // 'true' if the timeout
+                                                  // event deregistered this
+                                                  // awaiter
+
+    int                          d_status;        // result of the operation
+
+    std::coroutine_handle<>      d_handle;        // awaiting coroutine
+
+    // PRIVATE MANIPULATORS
+    bool arm();
+        // Register this awaiter with its queue, and schedule the timeout
+        // event if there is a timeout.  Return 'true' if the wait has
+        // already ended (the queue is not empty, popping is disabled, or the
+        // timeout elapsed), and 'false' if a job completing the wait will be
+        // enqueued on the executor.
+
+    void dispatch();
+        // Enqueue a job completing the wait on the executor, or, if it cannot
+        // be enqueued, complete the wait on the current thread.
+
+    bool pop();
+        // Try to pop an element from the queue, and, if it is empty and the
+        // timeout (if any) has not elapsed, wait again.  Return 'true' if the
+        // status of the operation has been recorded, and 'false' if a job
+        // completing the wait will be enqueued on the executor.
+
+    bool release(int parties);
+        // Clear the specified 'parties' bits of 'd_pending', and return
+        // 'true' if no party may still access this awaiter, in which case the
+        // caller completes the wait.
+
+    void timeOut();
+        // Deregister this awaiter from its queue, if it is registered,
+        // recording that the wait timed out, and complete the wait if this is
+        // the last party to access this awaiter.
+
+  public:
+    // CREATORS
+    Task_PopFrontAwaiter(TYPE     *value,
+                         Queue    *queue,
+                         EXECUTOR *executor);
+    Task_PopFrontAwaiter(TYPE                      *value,
+                         Queue                     *queue,
+                         EXECUTOR                  *executor,
+                         EventScheduler            *scheduler,
+                         const bsls::TimeInterval&  timeout);
+        // Create an awaiter popping an element of the specified 'queue' into
+        // the specified 'value', resuming the coroutine on the specified
+        // 'executor', and waiting for at most the optionally specified
+        // 'timeout' according to the clock of the optionally specified
+        // 'scheduler'.
+
+    // MANIPULATORS
+    void notify() BSLS_KEYWORD_OVERRIDE;
+        // Cancel the timeout event, if any, and complete the wait if this is
+        // the last party to access this awaiter.  This method is invoked by
+        // the queue when an element may be popped or popping is disabled.
+
+    bool await_ready();
+        // Try to pop an element from the queue, and return 'true' unless it
+        // is empty.
+
+    bool await_suspend(std::coroutine_handle<> handle);
+        // Wait for an element to be pushed onto the queue for the coroutine
+        // referred to by the specified 'handle'.  Return 'true' if the
+        // coroutine is suspended, and 'false' (so that it continues on this
+        // thread) if the wait ended before the coroutine was suspended.
+
+    int await_resume() const noexcept;
+        // Return 0 if an element was popped, 'TaskUtil::e_TIMED_OUT' if the
+        // timeout elapsed, and the status returned by 'tryPopFront' of the
+        // queue otherwise.
+};
+
+//                            ===================
+//                            class Task_Detached
+//                            ===================
+
+class Task_Detached {
+    // This component-private class provides the return type of the coroutine
+    // run by 'TaskUtil::spawn', which starts immediately and destroys its own
+    // frame when it completes.
+
+  public:
+    // TYPES
+    struct promise_type : public Task_FrameAllocator {
+        // This 'struct' provides the promise type of a coroutine returning
+        // 'Task_Detached'.
+
+        // MANIPULATORS
+        Task_Detached get_return_object() noexcept;
+            // Return an empty object.
+
+        std::suspend_never initial_suspend() noexcept;
+            // Return an awaiter that does not suspend the coroutine.
+
+        std::suspend_never final_suspend() noexcept;
+            // Return an awaiter that does not suspend the coroutine, so that
+            // its frame is destroyed.
+
+        void return_void();
+            // Do nothing.
+
+        void unhandled_exception();
+            // Terminate the program.
+    };
+};
+
+//                           =====================
+//                           class Task_SyncWaiter
+//                           =====================
+
+class Task_SyncWaiter {
+    // This component-private class provides the return type of the coroutine
+    // run by 'TaskUtil::syncWait', which signals a latch when it completes.
+
+  public:
+    // TYPES
+    struct promise_type;
+
+  private:
+    // PRIVATE TYPES
+    class FinalAwaiter {
+        // This class provides the awaiter on which the coroutine suspends
+        // when it completes, signaling the latch of its promise.
+
+      public:
+        // MANIPULATORS
+        bool await_ready() const noexcept;
+            // Return 'false'.
+
+        void await_suspend(
+                   std::coroutine_handle<promise_type> handle) const noexcept;
+            // Arrive at the latch of the promise of the specified 'handle'.
+
+        void await_resume() const noexcept;
+            // Do nothing.
+    };
+
+    // DATA
+    std::coroutine_handle<promise_type> d_handle;  // coroutine (owned)
+
+  public:
+    // TYPES
+    struct promise_type : public Task_FrameAllocator {
+        // This 'struct' provides the promise type of a coroutine returning
+        // 'Task_SyncWaiter'.
+
+        // DATA
+        bslmt::Latch *d_latch_p;  // latch signaled on completion (held)
+
+        // MANIPULATORS
+        Task_SyncWaiter get_return_object() noexcept;
+            // Return the object owning the coroutine of this promise.
+
+        std::suspend_always initial_suspend() noexcept;
+            // Return an awaiter suspending the coroutine before it runs.
+
+        FinalAwaiter final_suspend() noexcept;
+            // Return an awaiter suspending the completed coroutine and
+            // signaling the latch.
+
+        void return_void();
+            // Do nothing.
+
+        void unhandled_exception();
+            // Terminate the program.
+    };
+
+    // CREATORS
+    explicit Task_SyncWaiter(std::coroutine_handle<promise_type> handle);
+        // Create an object owning the coroutine referred to by the specified
+        // 'handle'.
+
+    Task_SyncWaiter(const Task_SyncWaiter&) = delete;
+
+    ~Task_SyncWaiter();
+        // Destroy the coroutine owned by this object, and this object.
+
+    // MANIPULATORS
+    Task_SyncWaiter& operator=(const Task_SyncWaiter&) = delete;
+
+    void run();
+        // Start the coroutine owned by this object, and block until it
+        // completes.
+};
+
+//                              ===============
+//                              struct TaskUtil
+//                              ===============
+
+struct TaskUtil {
+    // This 'struct' provides a namespace for functions returning awaiters for
+    // coroutines returning 'Task', and for functions starting tasks.
+
+  private:
+    // PRIVATE CLASS METHODS
+    static Task_SyncWaiter awaitCompletion(std::coroutine_handle<>  handle,
+                                           Task_PromiseBase        *promise,
+                                           bslma::Allocator        *allocator);
+        // Return a suspended coroutine, allocated by the specified
+        // 'allocator', that awaits the completion of the coroutine referred to
+        // by the specified 'handle', having the specified 'promise'.
+
+    template <class TYPE>
+    static Task_Detached runDetached(Task<TYPE>        task,
+                                     bslma::Allocator *allocator);
+    template <class EXECUTOR, class TYPE>
+    static Task_Detached runDetached(EXECUTOR         *executor,
+                                     Task<TYPE>        task,
+                                     bslma::Allocator *allocator);
+        // Run a coroutine, allocated by the specified 'allocator', that awaits
+        // the specified 'task', after resuming on the optionally specified
+        // 'executor'.
+
+  public:
+    // TYPES
+    enum {
+        e_TIMED_OUT = -10  // 'popFront' timed out; distinct from the status
+                           // values of 'bdlcc::BoundedQueue'
+    };
+
+    // CLASS METHODS
+    template <class TYPE, class EXECUTOR>
+    static Task_PopFrontAwaiter<TYPE, EXECUTOR> popFront(
+                                        TYPE                      *value,
+                                        bdlcc::BoundedQueue<TYPE> *queue,
+                                        EXECUTOR                  *executor);
+    template <class TYPE, class EXECUTOR>
+    static Task_PopFrontAwaiter<TYPE, EXECUTOR> popFront(
+                                       TYPE                      *value,
+                                       bdlcc::BoundedQueue<TYPE> *queue,
+                                       EXECUTOR                  *executor,
+                                       EventScheduler            *scheduler,
+                                       const bsls::TimeInterval&  timeout);
+        // Return an awaiter that suspends the awaiting coroutine until an
+        // element is popped from the specified 'queue' into the specified
+        // 'value', or, if the optionally specified 'scheduler' and 'timeout'
+        // are supplied, until 'timeout' elapses according to the clock of
+        // 'scheduler'.  While 'queue' is empty, the coroutine is registered
+        // as a waiter of 'queue', and is resumed by a job enqueued on the
+        // specified 'executor' once an element is pushed (or 'timeout'
+        // elapses); if the job cannot be enqueued, the coroutine is resumed by
+        // the thread pushing the element (or by the dispatcher thread of
+        // 'scheduler').  'co_await' yields 0 if an element was popped,
+        // 'e_TIMED_OUT' if 'timeout' elapsed, and the (non-zero) status of
+        // 'queue->tryPopFront' otherwise.  If an element can be popped
+        // immediately, the coroutine is not suspended.  The behavior is
+        // undefined unless 'queue' is not destroyed, and 'scheduler' (if
+        // supplied) has been started and is not stopped, while the coroutine
+        // is suspended.
+
+    template <class EXECUTOR>
+    static Task_ResumeOnAwaiter<EXECUTOR> resumeOn(EXECUTOR *executor);
+        // Return an awaiter that suspends the awaiting coroutine and enqueues
+        // a job resuming it on the specified 'executor'.  'co_await' yields 0
+        // if the coroutine was resumed by 'executor', and the non-zero status
+        // of 'executor->enqueueJob' if the job could not be enqueued, in
+        // which case the coroutine continues on the current thread.
+
+    static Task_SleepAwaiter sleepFor(EventScheduler            *scheduler,
+                                      const bsls::TimeInterval&  duration);
+        // Return an awaiter that suspends the awaiting coroutine until the
+        // specified 'duration' has elapsed, as measured from the time this
+        // function is called by the clock of the specified 'scheduler', whose
+        // dispatcher thread resumes the coroutine.  The behavior is undefined
+        // unless 'scheduler' has been started, and is not stopped while the
+        // coroutine is suspended.
+
+    static Task_SleepAwaiter sleepUntil(EventScheduler            *scheduler,
+                                        const bsls::TimeInterval&  epochTime);
+        // Return an awaiter that suspends the awaiting coroutine until the
+        // specified 'epochTime', an absolute time according to the clock of
+        // the specified 'scheduler', whose dispatcher thread resumes the
+        // coroutine.  The behavior is undefined unless 'scheduler' has been
+        // started, and is not stopped while the coroutine is suspended.
+
+    template <class TYPE>
+    static void spawn(Task<TYPE> task);
+    template <class EXECUTOR, class TYPE>
+    static void spawn(EXECUTOR *executor, Task<TYPE> task);
+        // Run the specified 'task', on the current thread or, if the
+        // optionally specified 'executor' is supplied, as a job enqueued on
+        // 'executor' (or on the current thread, if the job cannot be
+        // enqueued), until its first suspension.  The task, and the
+        // coroutine awaiting it, are destroyed by the thread completing the
+        // task, and the value of the task, if any, is discarded.  The
+        // behavior is undefined unless 'task.isValid()' and 'task' has not
+        // been started.  The program is terminated if an exception escapes
+        // 'task'.
+
+    template <class TYPE>
+    static TYPE syncWait(Task<TYPE> task);
+        // Run the specified 'task' on the current thread until its first
+        // suspension, block until it completes, and return its value, or
+        // rethrow the exception that escaped it.  The behavior is undefined
+        // unless 'task.isValid()' and 'task' has not been started.
+};
+
+//                             ==================
+//                             INLINE DEFINITIONS
+//                             ==================
+
+//                           ---------------------
+//                           struct Task_FrameUtil
+//                           ---------------------
+
+// PRIVATE CLASS METHODS
+inline
+bsl::size_t Task_FrameUtil::allocatorOffset(bsl::size_t size)
+{
+    const bsl::size_t alignment =
+                          bsls::AlignmentFromType<bslma::Allocator *>::VALUE;
+
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+// CLASS METHODS
+inline
+void *Task_FrameUtil::allocate(bsl::size_t size, bslma::Allocator *allocator)
+{
+    const bsl::size_t offset = allocatorOffset(size);
+
+    char *frame = static_cast<char *>(
+                     allocator->allocate(offset + sizeof(bslma::Allocator *)));
+    *reinterpret_cast<bslma::Allocator **>(frame + offset) = allocator;
+    return frame;
+}
+
+inline
+void Task_FrameUtil::deallocate(void *frame, bsl::size_t size)
+{
+    bslma::Allocator *allocator = *reinterpret_cast<bslma::Allocator **>(
+                               static_cast<char *>(frame) +
+                               allocatorOffset(size));
+    allocator->deallocate(frame);
+}
+
+inline
+bslma::Allocator *Task_FrameUtil::selectAllocator()
+{
+    return bslma::Default::defaultAllocator();
+}
+
+template <class FIRST, class... REST>
+inline
+bslma::Allocator *Task_FrameUtil::selectAllocator(const FIRST&   first,
+                                                  const REST&... rest)
+{
+    if constexpr (bsl::is_convertible<const FIRST&,
+                                      bslma::Allocator *>::value) {
+        return bslma::Default::allocator(first);                      // RETURN
+    }
+    else {
+        return selectAllocator(rest...);                              // RETURN
+    }
+}
+
+//                         -------------------------
+//                         class Task_FrameAllocator
+//                         -------------------------
+
+// CLASS METHODS
+template <class... ARGS>
+inline
+void *Task_FrameAllocator::operator new(bsl::size_t size, const ARGS&... args)
+{
+    return Task_FrameUtil::allocate(size,
+                                    Task_FrameUtil::selectAllocator(args...));
+}
+
+inline
+void Task_FrameAllocator::operator delete(void *frame, bsl::size_t size)
+{
+    Task_FrameUtil::deallocate(frame, size);
+}
+
+//                          -----------------------
+//                          class Task_FinalAwaiter
+//                          -----------------------
+
+// MANIPULATORS
+inline
+bool Task_FinalAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+template <class PROMISE>
+inline
+std::coroutine_handle<> Task_FinalAwaiter::await_suspend(
+                              std::coroutine_handle<PROMISE> handle) noexcept
+{
+    std::coroutine_handle<> continuation = handle.promise().continuation();
+
+    if (continuation) {
+        return continuation;                                          // RETURN
+    }
+    return std::noop_coroutine();
+}
+
+inline
+void Task_FinalAwaiter::await_resume() const noexcept
+{
+}
+
+//                           ----------------------
+//                           class Task_PromiseBase
+//                           ----------------------
+
+// PROTECTED CREATORS
+template <class... ARGS>
+inline
+Task_PromiseBase::Task_PromiseBase(const ARGS&... args)
+: d_continuation()
+, d_exception()
+, d_allocator_p(Task_FrameUtil::selectAllocator(args...))
+{
+}
+
+// PROTECTED ACCESSORS
+inline
+void Task_PromiseBase::rethrowIfFailed() const
+{
+    if (d_exception) {
+        bsl::rethrow_exception(d_exception);
+    }
+}
+
+// MANIPULATORS
+inline
+std::suspend_always Task_PromiseBase::initial_suspend() noexcept
+{
+    return std::suspend_always();
+}
+
+inline
+Task_FinalAwaiter Task_PromiseBase::final_suspend() noexcept
+{
+    return Task_FinalAwaiter();
+}
+
+inline
+void Task_PromiseBase::setContinuation(std::coroutine_handle<> continuation)
+{
+    d_continuation = continuation;
+}
+
+inline
+void Task_PromiseBase::unhandled_exception()
+{
+    d_exception = bsl::current_exception();
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *Task_PromiseBase::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+std::coroutine_handle<> Task_PromiseBase::continuation() const
+{
+    return d_continuation;
+}
+
+//                             ------------------
+//                             class Task_Promise
+//                             ------------------
+
+// CREATORS
+template <class TYPE>
+template <class... ARGS>
+inline
+Task_Promise<TYPE>::Task_Promise(const ARGS&... args)
+: Task_PromiseBase(args...)
+, d_hasValue(false)
+{
+}
+
+template <class TYPE>
+inline
+Task_Promise<TYPE>::~Task_Promise()
+{
+    if (d_hasValue) {
+        d_value.object().~TYPE();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+Task<TYPE> Task_Promise<TYPE>::get_return_object()
+{
+    return Task<TYPE>(
+                  std::coroutine_handle<Task_Promise>::from_promise(*this));
+}
+
+template <class TYPE>
+template <class VALUE>
+inline
+void Task_Promise<TYPE>::return_value(VALUE&& value)
+{
+    BSLS_ASSERT(!d_hasValue);
+
+    bslma::ConstructionUtil::construct(d_value.address(),
+                                       allocator(),
+                                       bsl::forward<VALUE>(value));
+    d_hasValue = true;
+}
+
+template <class TYPE>
+inline
+TYPE Task_Promise<TYPE>::result()
+{
+    rethrowIfFailed();
+
+    BSLS_ASSERT(d_hasValue);
+
+    return bsl::move(d_value.object());
+}
+
+template <class... ARGS>
+inline
+Task_Promise<void>::Task_Promise(const ARGS&... args)
+: Task_PromiseBase(args...)
+{
+}
+
+// MANIPULATORS
+inline
+Task<void> Task_Promise<void>::get_return_object()
+{
+    return Task<void>(
+                  std::coroutine_handle<Task_Promise>::from_promise(*this));
+}
+
+inline
+void Task_Promise<void>::return_void()
+{
+}
+
+inline
+void Task_Promise<void>::result()
+{
+    rethrowIfFailed();
+}
+
+//                        ----------------------------
+//                        class Task_CompletionAwaiter
+//                        ----------------------------
+
+// CREATORS
+inline
+Task_CompletionAwaiter::Task_CompletionAwaiter(
+                                      std::coroutine_handle<>  handle,
+                                      Task_PromiseBase        *promise)
+: d_handle(handle)
+, d_promise_p(promise)
+{
+}
+
+// MANIPULATORS
+inline
+bool Task_CompletionAwaiter::await_ready() const noexcept
+{
+    return d_handle.done();
+}
+
+inline
+std::coroutine_handle<> Task_CompletionAwaiter::await_suspend(
+                                    std::coroutine_handle<> awaiter) noexcept
+{
+    d_promise_p->setContinuation(awaiter);
+    return d_handle;
+}
+
+inline
+void Task_CompletionAwaiter::await_resume() const noexcept
+{
+}
+
+//                             ------------------
+//                             class Task_Awaiter
+//                             ------------------
+
+// CREATORS
+template <class TYPE>
+inline
+Task_Awaiter<TYPE>::Task_Awaiter(
+                         std::coroutine_handle<Task_Promise<TYPE> > handle)
+: Task_CompletionAwaiter(handle, &handle.promise())
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+TYPE Task_Awaiter<TYPE>::await_resume()
+{
+    return static_cast<Task_Promise<TYPE> *>(d_promise_p)->result();
+}
+
+//                                 ----------
+//                                 class Task
+//                                 ----------
+
+// PRIVATE CREATORS
+template <class TYPE>
+inline
+Task<TYPE>::Task(std::coroutine_handle<promise_type> handle)
+: d_handle(handle)
+{
+}
+
+// CREATORS
+template <class TYPE>
+inline
+Task<TYPE>::Task()
+: d_handle()
+{
+}
+
+template <class TYPE>
+inline
+Task<TYPE>::Task(Task&& original) noexcept
+: d_handle(original.d_handle)
+{
+    original.d_handle = std::coroutine_handle<promise_type>();
+}
+
+template <class TYPE>
+inline
+Task<TYPE>::~Task()
+{
+    if (d_handle) {
+        d_handle.destroy();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+Task<TYPE>& Task<TYPE>::operator=(Task&& rhs) noexcept
+{
+    if (this != &rhs) {
+        if (d_handle) {
+            d_handle.destroy();
+        }
+        d_handle     = rhs.d_handle;
+        rhs.d_handle = std::coroutine_handle<promise_type>();
+    }
+    return *this;
+}
+
+template <class TYPE>
+inline
+Task_Awaiter<TYPE> Task<TYPE>::operator co_await() &&
+{
+    BSLS_ASSERT(d_handle);
+
+    return Task_Awaiter<TYPE>(d_handle);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bslma::Allocator *Task<TYPE>::allocator() const
+{
+    BSLS_ASSERT(d_handle);
+
+    return d_handle.promise().allocator();
+}
+
+template <class TYPE>
+inline
+bool Task<TYPE>::isDone() const
+{
+    BSLS_ASSERT(d_handle);
+
+    return d_handle.done();
+}
+
+template <class TYPE>
+inline
+bool Task<TYPE>::isValid() const
+{
+    return static_cast<bool>(d_handle);
+}
+
+//                            --------------------
+//                            class Task_ResumeJob
+//                            --------------------
+
+// CREATORS
+inline
+Task_ResumeJob::Task_ResumeJob(std::coroutine_handle<> handle)
+: d_handle(handle)
+{
+}
+
+// ACCESSORS
+inline
+void Task_ResumeJob::operator()() const
+{
+    d_handle.resume();
+}
+
+//                         --------------------------
+//                         class Task_ResumeOnAwaiter
+//                         --------------------------
+
+// CREATORS
+template <class EXECUTOR>
+inline
+Task_ResumeOnAwaiter<EXECUTOR>::Task_ResumeOnAwaiter(EXECUTOR *executor)
+: d_executor_p(executor)
+, d_status(0)
+{
+    BSLS_ASSERT(executor);
+}
+
+// MANIPULATORS
+template <class EXECUTOR>
+inline
+bool Task_ResumeOnAwaiter<EXECUTOR>::await_ready() const noexcept
+{
+    return false;
+}
+
+template <class EXECUTOR>
+inline
+bool Task_ResumeOnAwaiter<EXECUTOR>::await_suspend(
+                                              std::coroutine_handle<> handle)
+{
+    // Once the job is enqueued, the coroutine may be resumed, and this object
+    // destroyed, by the executor, so it must not be accessed on success.
+
+    const int rc = d_executor_p->enqueueJob(
+                                   bsl::function<void()>(
+                                                  Task_ResumeJob(handle)));
+    if (0 == rc) {
+        return true;                                                  // RETURN
+    }
+
+    d_status = rc;
+    return false;
+}
+
+template <class EXECUTOR>
+inline
+int Task_ResumeOnAwaiter<EXECUTOR>::await_resume() const noexcept
+{
+    return d_status;
+}
+
+//                          -----------------------
+//                          class Task_SleepAwaiter
+//                          -----------------------
+
+// CREATORS
+inline
+Task_SleepAwaiter::Task_SleepAwaiter(EventScheduler            *scheduler,
+                                     const bsls::TimeInterval&  epochTime)
+: d_scheduler_p(scheduler)
+, d_epochTime(epochTime)
+{
+    BSLS_ASSERT(scheduler);
+}
+
+// MANIPULATORS
+inline
+bool Task_SleepAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+inline
+void Task_SleepAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    d_scheduler_p->scheduleEvent(d_epochTime,
+                                 bsl::function<void()>(
+                                                  Task_ResumeJob(handle)));
+}
+
+inline
+void Task_SleepAwaiter::await_resume() const noexcept
+{
+}
+
+//                    ----------------------------------
+//                    class Task_PopFrontAwaiter::PopJob
+//                    ----------------------------------
+
+// CREATORS
+template <class TYPE, class EXECUTOR>
+inline
+Task_PopFrontAwaiter<TYPE, EXECUTOR>::PopJob::PopJob(
+                                                 Task_PopFrontAwaiter *awaiter)
+: d_awaiter_p(awaiter)
+{
+}
+
+// ACCESSORS
+template <class TYPE, class EXECUTOR>
+inline
+void Task_PopFrontAwaiter<TYPE, EXECUTOR>::PopJob::operator()() const
+{
+    if (d_awaiter_p->pop()) {
+        d_awaiter_p->d_handle.resume();
+    }
+}
+
+//                 ----------------------------------------
+//                 class Task_PopFrontAwaiter::TimeoutEvent
+//                 ----------------------------------------
+
+// CREATORS
+template <class TYPE, class EXECUTOR>
+inline
+Task_PopFrontAwaiter<TYPE, EXECUTOR>::TimeoutEvent::TimeoutEvent(
+                                                 Task_PopFrontAwaiter *awaiter)
+: d_awaiter_p(awaiter)
+{
+}
+
+// ACCESSORS
+template <class TYPE, class EXECUTOR>
+inline
+void Task_PopFrontAwaiter<TYPE, EXECUTOR>::TimeoutEvent::operator()() const
+{
+    d_awaiter_p->timeOut();
+}
+
+//                         --------------------------
+//                         class Task_PopFrontAwaiter
+//                         --------------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE, class EXECUTOR>
+bool Task_PopFrontAwaiter<TYPE, EXECUTOR>::arm()
+{
+    // The timeout event is scheduled before this awaiter is registered, so
+    // that 'notify' may cancel it.  If the event is dispatched before this
+    // awaiter is registered, it cannot deregister this awaiter, which is
+    // then done here.
+
+    d_isTimedOut = false;
+    d_pending    = k_ARMING | k_NOTIFY | (d_scheduler_p ? k_TIMEOUT : 0);
+
+    if (d_scheduler_p) {
+        d_scheduler_p->scheduleEvent(&d_timeoutEvent,
+                                     d_deadline,
+                                     bsl::function<void()>(
+                                                        TimeoutEvent(this)));
+    }
+
+    int parties = k_ARMING;
+    if (0 != d_queue_p->registerPopFrontWaiter(this)) {
+        parties |= k_NOTIFY;
+        if (d_scheduler_p
+         && 0 == d_scheduler_p->cancelEvent(&d_timeoutEvent)) {
+            parties |= k_TIMEOUT;
+        }
+    }
+    else if (d_scheduler_p
+          && 0 == (d_pending.loadAcquire() & k_TIMEOUT)
+          && d_queue_p->deregisterPopFrontWaiter(this)) {
+        d_isTimedOut  = true;
+        parties      |= k_NOTIFY;
+    }
+
+    return release(parties);
+}
+
+template <class TYPE, class EXECUTOR>
+void Task_PopFrontAwaiter<TYPE, EXECUTOR>::dispatch()
+{
+    if (0 != d_executor_p->enqueueJob(bsl::function<void()>(PopJob(this)))) {
+        PopJob(this)();
+    }
+}
+
+template <class TYPE, class EXECUTOR>
+bool Task_PopFrontAwaiter<TYPE, EXECUTOR>::pop()
+{
+    while (true) {
+        if (d_isTimedOut) {
+            d_status = TaskUtil::e_TIMED_OUT;
+            return true;                                              // RETURN
+        }
+
+        d_status = d_queue_p->tryPopFront(d_value_p);
+        if (Queue::e_EMPTY != d_status) {
+            return true;                                              // RETURN
+        }
+
+        if (d_scheduler_p && d_scheduler_p->now() >= d_deadline) {
+            d_status = TaskUtil::e_TIMED_OUT;
+            return true;                                              // RETURN
+        }
+
+        // Another thread popped the element this awaiter was notified of.
+        // Resuming the coroutine may destroy this object, so, once 'arm'
+        // returns 'false', this object must not be accessed.
+
+        if (!arm()) {
+            return false;                                             // RETURN
+        }
+    }
+}
+
+template <class TYPE, class EXECUTOR>
+inline
+bool Task_PopFrontAwaiter<TYPE, EXECUTOR>::release(int parties)
+{
+    return 0 == d_pending.addAcqRel(-parties);
+}
+
+template <class TYPE, class EXECUTOR>
+void Task_PopFrontAwaiter<TYPE, EXECUTOR>::timeOut()
+{
+    int parties = k_TIMEOUT;
+    if (d_queue_p->deregisterPopFrontWaiter(this)) {
+        d_isTimedOut  = true;
+        parties      |= k_NOTIFY;
+    }
+
+    if (release(parties)) {
+        dispatch();
+    }
+}
+
+// CREATORS
+template <class TYPE, class EXECUTOR>
+inline
+Task_PopFrontAwaiter<TYPE, EXECUTOR>::Task_PopFrontAwaiter(
+                                                   TYPE     *value,
+                                                   Queue    *queue,
+                                                   EXECUTOR *executor)
+: d_value_p(value)
+, d_queue_p(queue)
+, d_executor_p(executor)
+, d_scheduler_p(0)
+, d_timeout()
+, d_deadline()
+, d_timeoutEvent()
+, d_pending(0)
+, d_isTimedOut(false)
+, d_status(0)
+, d_handle()
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(queue);
+    BSLS_ASSERT(executor);
+}
+
+template <class TYPE, class EXECUTOR>
+inline
+Task_PopFrontAwaiter<TYPE, EXECUTOR>::Task_PopFrontAwaiter(
+                                       TYPE                      *value,
+                                       Queue                     *queue,
+                                       EXECUTOR                  *executor,
+                                       EventScheduler            *scheduler,
+                                       const bsls::TimeInterval&  timeout)
+: d_value_p(value)
+, d_queue_p(queue)
+, d_executor_p(executor)
+, d_scheduler_p(scheduler)
+, d_timeout(timeout)
+, d_deadline()
+, d_timeoutEvent()
+, d_pending(0)
+, d_isTimedOut(false)
+, d_status(0)
+, d_handle()
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(queue);
+    BSLS_ASSERT(executor);
+    BSLS_ASSERT(scheduler);
+}
+
+// MANIPULATORS
+template <class TYPE, class EXECUTOR>
+void Task_PopFrontAwaiter<TYPE, EXECUTOR>::notify()
+{
+    // The timeout event was scheduled before this awaiter was registered
+    // (see 'arm'), and is canceled before this party is released, while this
+    // object is known to exist.
+
+    int parties = k_NOTIFY;
+    if (d_scheduler_p && 0 == d_scheduler_p->cancelEvent(&d_timeoutEvent)) {
+        parties |= k_TIMEOUT;
+    }
+
+    if (release(parties)) {
+        dispatch();
+    }
+}
+
+template <class TYPE, class EXECUTOR>
+inline
+bool Task_PopFrontAwaiter<TYPE, EXECUTOR>::await_ready()
+{
+    d_status = d_queue_p->tryPopFront(d_value_p);
+    return Queue::e_EMPTY != d_status;
+}
+
+template <class TYPE, class EXECUTOR>
+inline
+bool Task_PopFrontAwaiter<TYPE, EXECUTOR>::await_suspend(
+                                              std::coroutine_handle<> handle)
+{
+    d_handle = handle;
+    if (d_scheduler_p) {
+        d_deadline = d_scheduler_p->now() + d_timeout;
+    }
+
+    return !pop();
+}
+
+template <class TYPE, class EXECUTOR>
+inline
+int Task_PopFrontAwaiter<TYPE, EXECUTOR>::await_resume() const noexcept
+{
+    return d_status;
+}
+
+//                            -------------------
+//                            class Task_Detached
+//                            -------------------
+
+// MANIPULATORS
+inline
+Task_Detached Task_Detached::promise_type::get_return_object() noexcept
+{
+    return Task_Detached();
+}
+
+inline
+std::suspend_never Task_Detached::promise_type::initial_suspend() noexcept
+{
+    return std::suspend_never();
+}
+
+inline
+std::suspend_never Task_Detached::promise_type::final_suspend() noexcept
+{
+    return std::suspend_never();
+}
+
+inline
+void Task_Detached::promise_type::return_void()
+{
+}
+
+inline
+void Task_Detached::promise_type::unhandled_exception()
+{
+    bsl::terminate();
+}
+
+//                    -----------------------------------
+//                    class Task_SyncWaiter::FinalAwaiter
+//                    -----------------------------------
+
+// MANIPULATORS
+inline
+bool Task_SyncWaiter::FinalAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+inline
+void Task_SyncWaiter::FinalAwaiter::await_suspend(
+             std::coroutine_handle<promise_type> handle) const noexcept
+{
+    handle.promise().d_latch_p->arrive();
+}
+
+inline
+void Task_SyncWaiter::FinalAwaiter::await_resume() const noexcept
+{
+}
+
+//                    -----------------------------------
+//                    class Task_SyncWaiter::promise_type
+//                    -----------------------------------
+
+// MANIPULATORS
+inline
+Task_SyncWaiter Task_SyncWaiter::promise_type::get_return_object() noexcept
+{
+    return Task_SyncWaiter(
+                  std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+inline
+std::suspend_always Task_SyncWaiter::promise_type::initial_suspend() noexcept
+{
+    return std::suspend_always();
+}
+
+inline
+Task_SyncWaiter::FinalAwaiter
+Task_SyncWaiter::promise_type::final_suspend() noexcept
+{
+    return FinalAwaiter();
+}
+
+inline
+void Task_SyncWaiter::promise_type::return_void()
+{
+}
+
+inline
+void Task_SyncWaiter::promise_type::unhandled_exception()
+{
+    bsl::terminate();
+}
+
+//                           ---------------------
+//                           class Task_SyncWaiter
+//                           ---------------------
+
+// CREATORS
+inline
+Task_SyncWaiter::Task_SyncWaiter(std::coroutine_handle<promise_type> handle)
+: d_handle(handle)
+{
+}
+
+inline
+Task_SyncWaiter::~Task_SyncWaiter()
+{
+    d_handle.destroy();
+}
+
+// MANIPULATORS
+inline
+void Task_SyncWaiter::run()
+{
+    bslmt::Latch latch(1);
+
+    d_handle.promise().d_latch_p = &latch;
+    d_handle.resume();
+    latch.wait();
+}
+
+//                              ---------------
+//                              struct TaskUtil
+//                              ---------------
+
+// PRIVATE CLASS METHODS
+inline
+Task_SyncWaiter TaskUtil::awaitCompletion(std::coroutine_handle<>  handle,
+                                          Task_PromiseBase        *promise,
+                                          bslma::Allocator        *)
+{
+    co_await Task_CompletionAwaiter(handle, promise);
+}
+
+template <class TYPE>
+Task_Detached TaskUtil::runDetached(Task<TYPE> task, bslma::Allocator *)
+{
+    co_await bsl::move(task);
+}
+
+template <class EXECUTOR, class TYPE>
+Task_Detached TaskUtil::runDetached(EXECUTOR         *executor,
+                                    Task<TYPE>        task,
+                                    bslma::Allocator *)
+{
+    co_await resumeOn(executor);
+    co_await bsl::move(task);
+}
+
+// CLASS METHODS
+template <class TYPE, class EXECUTOR>
+inline
+Task_PopFrontAwaiter<TYPE, EXECUTOR> TaskUtil::popFront(
+                                        TYPE                      *value,
+                                        bdlcc::BoundedQueue<TYPE> *queue,
+                                        EXECUTOR                  *executor)
+{
+    return Task_PopFrontAwaiter<TYPE, EXECUTOR>(value, queue, executor);
+}
+
+template <class TYPE, class EXECUTOR>
+inline
+Task_PopFrontAwaiter<TYPE, EXECUTOR> TaskUtil::popFront(
+                                       TYPE                      *value,
+                                       bdlcc::BoundedQueue<TYPE> *queue,
+                                       EXECUTOR                  *executor,
+                                       EventScheduler            *scheduler,
+                                       const bsls::TimeInterval&  timeout)
+{
+    return Task_PopFrontAwaiter<TYPE, EXECUTOR>(value,
+                                                queue,
+                                                executor,
+                                                scheduler,
+                                                timeout);
+}
+
+template <class EXECUTOR>
+inline
+Task_ResumeOnAwaiter<EXECUTOR> TaskUtil::resumeOn(EXECUTOR *executor)
+{
+    return Task_ResumeOnAwaiter<EXECUTOR>(executor);
+}
+
+inline
+Task_SleepAwaiter TaskUtil::sleepFor(EventScheduler            *scheduler,
+                                     const bsls::TimeInterval&  duration)
+{
+    BSLS_ASSERT(scheduler);
+
+    return Task_SleepAwaiter(scheduler, scheduler->now() + duration);
+}
+
+inline
+Task_SleepAwaiter TaskUtil::sleepUntil(EventScheduler            *scheduler,
+                                       const bsls::TimeInterval&  epochTime)
+{
+    return Task_SleepAwaiter(scheduler, epochTime);
+}
+
+template <class TYPE>
+inline
+void TaskUtil::spawn(Task<TYPE> task)
+{
+    BSLS_ASSERT(task.isValid());
+
+    bslma::Allocator *allocator = task.allocator();
+    runDetached(bsl::move(task), allocator);
+}
+
+template <class EXECUTOR, class TYPE>
+inline
+void TaskUtil::spawn(EXECUTOR *executor, Task<TYPE> task)
+{
+    BSLS_ASSERT(task.isValid());
+
+    bslma::Allocator *allocator = task.allocator();
+    runDetached(executor, bsl::move(task), allocator);
+}
+
+template <class TYPE>
+inline
+TYPE TaskUtil::syncWait(Task<TYPE> task)
+{
+    BSLS_ASSERT(task.isValid());
+
+    {
+        Task_SyncWaiter waiter = awaitCompletion(task.d_handle,
+                                                 &task.d_handle.promise(),
+                                                 task.allocator());
+        waiter.run();
+    }
+    return task.d_handle.promise().result();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1588 @@
+// bdlmt_task.t.cpp                                                   -*-C++-*-
+#include <bdlmt_task.h>
+
+#include <bsls_compilerfeatures.h>
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+#include <bdlmt_eventscheduler.h>
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlcc_boundedqueue.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_latch.h>
+#include <bslmt_testutil.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#else
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_testutil.h>
+
+#endif
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test provides a coroutine task type and a utility of
+// awaiters and of functions starting tasks, and is available only when the
+// compiler supports coroutines; otherwise, every test case passes trivially.
+// We first test the allocation of coroutine frames, then tasks awaited by
+// other tasks and started by 'syncWait', and then each awaiter, recording the
+// thread that resumes each coroutine to verify where it runs.  Finally, we
+// test 'spawn', and a stress test in which many coroutines share a queue, an
+// event scheduler, and a pool.
+//
+// In addition to positive test cases, a negative test case -1 can be run
+// manually to compare hopping between threads of a pool with jobs and with
+// coroutines, and to time awaiting tasks that complete synchronously.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 3] Task();
+// [ 3] Task(Task&& original);
+// [ 3] ~Task();
+//
+// MANIPULATORS
+// [ 3] Task& operator=(Task&& rhs);
+// [ 3] Task_Awaiter<TYPE> operator co_await() &&;
+//
+// ACCESSORS
+// [ 3] bslma::Allocator *allocator() const;
+// [ 3] bool isDone() const;
+// [ 3] bool isValid() const;
+//
+// CLASS METHODS
+// [ 6] Task_PopFrontAwaiter popFront(TYPE *, Queue *, EXECUTOR *);
+// [ 6] Task_PopFrontAwaiter popFront(TYPE *, Q *, EX *, EvSched *, TI&);
+// [ 4] Task_ResumeOnAwaiter<EXECUTOR> resumeOn(EXECUTOR *executor);
+// [ 5] Task_SleepAwaiter sleepFor(EventScheduler *, const TI&);
+// [ 5] Task_SleepAwaiter sleepUntil(EventScheduler *, const TI&);
+// [ 7] void spawn(Task<TYPE> task);
+// [ 7] void spawn(EXECUTOR *executor, Task<TYPE> task);
+// [ 3] TYPE syncWait(Task<TYPE> task);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] Task_FrameUtil
+// [ 8] CONCERN: MANY COROUTINES SHARING A QUEUE, SCHEDULER, AND POOL
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: COROUTINES VS. JOBS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT                   BSLMT_TESTUTIL_ASSERT
+#define ASSERTV                  BSLMT_TESTUTIL_ASSERTV
+
+#define GUARD                    BSLMT_TESTUTIL_GUARD
+
+#define Q                        BSLMT_TESTUTIL_Q
+#define P                        BSLMT_TESTUTIL_P
+#define P_                       BSLMT_TESTUTIL_P_
+#define T_                       BSLMT_TESTUTIL_T_
+#define L_                       BSLMT_TESTUTIL_L_
+
+#define GUARDED_STREAM(STREAM)   BSLMT_TESTUTIL_GUARDED_STREAM(STREAM)
+#define COUT                     BSLMT_TESTUTIL_COUT
+#define CERR                     BSLMT_TESTUTIL_CERR
+
+// ============================================================================
+//                           GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+int test;
+int verbose;
+int veryVerbose;
+int veryVeryVerbose;
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::TaskUtil           Util;
+typedef bdlmt::Task_FrameUtil     FrameUtil;
+typedef bdlcc::BoundedQueue<int>  IntQueue;
+typedef bsls::Types::Uint64       Uint64;
+
+const char *const LONG_STRING = "a string long enough to allocate memory";
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 selfId()
+    // Return the id of the calling thread.
+{
+    return bslmt::ThreadUtil::selfIdAsUint64();
+}
+
+bdlmt::Task<int> valueOf(int value, bslma::Allocator *basicAllocator = 0)
+    // Return a task producing the specified 'value'.  Optionally specify a
+    // 'basicAllocator' used to supply memory.
+{
+    co_return value;
+}
+
+bdlmt::Task<int> sumTo(int n, bslma::Allocator *basicAllocator = 0)
+    // Return a task producing the sum of the integers from 1 to the specified
+    // 'n', computed by awaiting one task for each.  Optionally specify a
+    // 'basicAllocator' used to supply memory.
+{
+    if (0 == n) {
+        co_return 0;
+    }
+    co_return n + co_await sumTo(n - 1, basicAllocator);
+}
+
+bdlmt::Task<bsl::string> concatenate(const char       *prefix,
+                                     const char       *suffix,
+                                     bslma::Allocator *basicAllocator = 0)
+    // Return a task producing the concatenation of the specified 'prefix' and
+    // 'suffix'.  Optionally specify a 'basicAllocator' used to supply memory.
+{
+    bsl::string result(prefix, basicAllocator);
+    result += suffix;
+    co_return result;
+}
+
+bdlmt::Task<void> increment(int *counter, bslma::Allocator *basicAllocator = 0)
+    // Return a task incrementing the specified 'counter'.  Optionally specify
+    // a 'basicAllocator' used to supply memory.
+{
+    ++*counter;
+    co_return;
+}
+
+bdlmt::Task<int> throwIf(bool shouldThrow, int value)
+    // Return a task throwing the specified 'value' if the specified
+    // 'shouldThrow' is 'true', and producing 'value' otherwise.
+{
+    if (shouldThrow) {
+        throw value;
+    }
+    co_return value;
+}
+
+bdlmt::Task<int> catchFrom(bool shouldThrow, int value)
+    // Return a task awaiting 'throwIf(shouldThrow, value)' for the specified
+    // 'shouldThrow' and 'value', and producing the negation of the value it
+    // throws, or the value it produces.
+{
+    try {
+        co_return co_await throwIf(shouldThrow, value);
+    }
+    catch (int thrown) {
+        co_return -thrown;
+    }
+}
+
+template <class EXECUTOR>
+bdlmt::Task<int> hopTo(EXECUTOR *executor, Uint64 *threadId)
+    // Return a task resuming on the specified 'executor', loading the id of
+    // the thread that resumed it into the specified 'threadId', and producing
+    // the status of resuming.
+{
+    const int rc = co_await Util::resumeOn(executor);
+
+    *threadId = selfId();
+    co_return rc;
+}
+
+bdlmt::Task<Uint64> sleepFor(bdlmt::EventScheduler     *scheduler,
+                             const bsls::TimeInterval&  duration,
+                             Uint64                    *threadId)
+    // Return a task sleeping for the specified 'duration' on the specified
+    // 'scheduler', loading the id of the thread that resumed it into the
+    // specified 'threadId', and producing the number of microseconds it
+    // slept.
+{
+    const bsls::TimeInterval start = scheduler->now();
+
+    co_await Util::sleepFor(scheduler, duration);
+
+    *threadId = selfId();
+    co_return (scheduler->now() - start).totalMicroseconds();
+}
+
+bdlmt::Task<Uint64> sleepUntil(bdlmt::EventScheduler     *scheduler,
+                               const bsls::TimeInterval&  epochTime)
+    // Return a task sleeping until the specified 'epochTime' of the specified
+    // 'scheduler', and producing the number of microseconds by which it
+    // overslept.
+{
+    co_await Util::sleepUntil(scheduler, epochTime);
+
+    co_return (scheduler->now() - epochTime).totalMicroseconds();
+}
+
+bdlmt::Task<int> popFrom(IntQueue               *queue,
+                         bdlmt::FixedThreadPool *pool,
+                         int                    *value,
+                         Uint64                 *threadId)
+    // Return a task popping an element of the specified 'queue' into the
+    // specified 'value', resuming on the specified 'pool', loading the id of
+    // the thread that resumed it into the specified 'threadId', and producing
+    // the status of popping.
+{
+    const int rc = co_await Util::popFront(value, queue, pool);
+
+    *threadId = selfId();
+    co_return rc;
+}
+
+bdlmt::Task<void> popAndArrive(IntQueue               *queue,
+                               bdlmt::FixedThreadPool *pool,
+                               int                    *value,
+                               int                    *status,
+                               Uint64                 *threadId,
+                               bslmt::Latch           *latch)
+    // Return a task popping an element of the specified 'queue' into the
+    // specified 'value', resuming on the specified 'pool', loading the status
+    // of popping into the specified 'status' and the id of the thread that
+    // resumed it into the specified 'threadId', and arriving at the specified
+    // 'latch'.
+{
+    *status   = co_await Util::popFront(value, queue, pool);
+    *threadId = selfId();
+    latch->arrive();
+}
+
+bdlmt::Task<int> popFromWithin(IntQueue                  *queue,
+                               bdlmt::FixedThreadPool    *pool,
+                               bdlmt::EventScheduler     *scheduler,
+                               const bsls::TimeInterval&  timeout,
+                               int                       *value)
+    // Return a task popping an element of the specified 'queue' into the
+    // specified 'value' within the specified 'timeout', measured by the
+    // specified 'scheduler', resuming on the specified 'pool', and producing
+    // the status of popping.
+{
+    co_return co_await Util::popFront(value, queue, pool, scheduler, timeout);
+}
+
+bdlmt::Task<void> popWithinAndArrive(IntQueue                  *queue,
+                                     bdlmt::FixedThreadPool    *pool,
+                                     bdlmt::EventScheduler     *scheduler,
+                                     const bsls::TimeInterval&  timeout,
+                                     int                       *value,
+                                     int                       *status,
+                                     bslmt::Latch              *latch)
+    // Return a task popping an element of the specified 'queue' into the
+    // specified 'value' within the specified 'timeout', measured by the
+    // specified 'scheduler', resuming on the specified 'pool', loading the
+    // status of popping into the specified 'status', and arriving at the
+    // specified 'latch'.
+{
+    *status = co_await Util::popFront(value, queue, pool, scheduler, timeout);
+    latch->arrive();
+}
+
+bdlmt::Task<void> countDown(bsls::AtomicInt *counter, bslmt::Latch *latch)
+    // Return a task incrementing the specified 'counter' and arriving at the
+    // specified 'latch'.
+{
+    ++*counter;
+    latch->arrive();
+    co_return;
+}
+
+bdlmt::Task<int> recordThread(Uint64 *threadId, bslmt::Latch *latch)
+    // Return a task loading the id of the thread that runs it into the
+    // specified 'threadId', arriving at the specified 'latch', and producing
+    // a value.
+{
+    *threadId = selfId();
+    latch->arrive();
+    co_return 1;
+}
+
+bdlmt::Task<void> waitThenCount(bdlmt::EventScheduler *scheduler,
+                                bsls::AtomicInt       *counter,
+                                bslmt::Latch          *latch)
+    // Return a task sleeping on the specified 'scheduler', and then
+    // incrementing the specified 'counter' and arriving at the specified
+    // 'latch'.
+{
+    co_await Util::sleepFor(scheduler, bsls::TimeInterval(0, 1000000));
+    ++*counter;
+    latch->arrive();
+}
+
+bdlmt::Task<int> square(int value, bdlmt::FixedThreadPool *pool)
+    // Return a task producing the square of the specified 'value', computed on
+    // the specified 'pool'.
+{
+    co_await Util::resumeOn(pool);
+    co_return value * value;
+}
+
+bdlmt::Task<void> worker(IntQueue               *requests,
+                         IntQueue               *responses,
+                         bdlmt::EventScheduler  *scheduler,
+                         bdlmt::FixedThreadPool *pool,
+                         bsls::AtomicInt        *numTimeouts,
+                         bslmt::Latch           *done)
+    // Return a task that, until a negative request is popped, pops a request
+    // from the specified 'requests', squares it on the specified 'pool', and
+    // pushes the square onto the specified 'responses'.  Wait for each
+    // request for at most a millisecond, measured by the specified
+    // 'scheduler', incrementing the specified 'numTimeouts' and waiting
+    // again if none is pushed.  Arrive at the specified 'done' on exit.
+{
+    const bsls::TimeInterval timeout(0, 1000 * 1000);
+
+    int request;
+    while (true) {
+        const int rc = co_await Util::popFront(&request,
+                                               requests,
+                                               pool,
+                                               scheduler,
+                                               timeout);
+        if (Util::e_TIMED_OUT == rc) {
+            ++*numTimeouts;
+            continue;
+        }
+        if (0 != rc || 0 > request) {
+            break;
+        }
+
+        responses->pushBack(co_await square(request, pool));
+    }
+    done->arrive();
+}
+
+int request(int pusher, int index)
+    // Return the request pushed by the specified 'pusher' at the specified
+    // 'index'.
+{
+    return (pusher * 7 + index) % 100;
+}
+
+void pushRequests(IntQueue *queue, int pusher, int numRequests)
+    // Push the specified 'numRequests' requests of the specified 'pusher'
+    // onto the specified 'queue'.
+{
+    for (int i = 0; i < numRequests; ++i) {
+        queue->pushBack(request(pusher, i));
+    }
+}
+
+                          // ========================
+                          // performance test helpers
+                          // ========================
+
+struct HopJob {
+    // This 'struct' provides a job that re-enqueues itself on a pool a number
+    // of times, and then arrives at a latch.
+
+    // DATA
+    bdlmt::FixedThreadPool *d_pool_p;
+    int                     d_remaining;
+    bslmt::Latch           *d_latch_p;
+
+    // ACCESSORS
+    void operator()() const
+    {
+        if (0 == d_remaining) {
+            d_latch_p->arrive();
+            return;                                                   // RETURN
+        }
+        HopJob next = { d_pool_p, d_remaining - 1, d_latch_p };
+        d_pool_p->enqueueJob(next);
+    }
+};
+
+bdlmt::Task<void> hop(bdlmt::FixedThreadPool *pool,
+                      int                     numHops,
+                      bslmt::Latch           *latch)
+    // Return a task resuming on the specified 'pool' the specified 'numHops'
+    // times, and then arriving at the specified 'latch'.
+{
+    for (int i = 0; i < numHops; ++i) {
+        co_await Util::resumeOn(pool);
+    }
+    latch->arrive();
+}
+
+bdlmt::Task<int> addOneTask(int value)
+    // Return a task producing one more than the specified 'value'.
+{
+    co_return value + 1;
+}
+
+bdlmt::Task<int> chain(int length)
+    // Return a task awaiting the specified 'length' tasks in turn, and
+    // producing 'length'.
+{
+    int value = 0;
+    for (int i = 0; i < length; ++i) {
+        value = co_await addOneTask(value);
+    }
+    co_return value;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handling Requests from a Queue
+///- - - - - - - - - - - - - - - - - - - - -
+// In this example we handle requests popped from a queue: each request is
+// handed to a thread pool for processing, and the handler gives up once no
+// request has arrived for a while.  No thread is blocked while the handler
+// waits for a request or for its processing.
+//
+// First, we define a coroutine that processes a request on a thread pool:
+//..
+    bdlmt::Task<int> process(int request, bdlmt::FixedThreadPool *pool)
+        // Return a task producing the response to the specified 'request',
+        // computed on the specified 'pool'.
+    {
+        co_await bdlmt::TaskUtil::resumeOn(pool);
+
+        co_return request * request;
+    }
+//..
+// Then, we define a coroutine that handles the requests in a queue, until a
+// request of 0 is received, or no request is received within 5 seconds:
+//..
+    bdlmt::Task<int> handleRequests(bdlcc::BoundedQueue<int> *requests,
+                                    bdlmt::FixedThreadPool   *pool,
+                                    bdlmt::EventScheduler    *scheduler)
+        // Return a task that processes, on the specified 'pool', the requests
+        // in the specified 'requests' queue, using the specified 'scheduler'
+        // to time out waiting for them, and produces the sum of the
+        // responses.
+    {
+        const bsls::TimeInterval timeout(5.0);
+
+        int sum = 0;
+        int request;
+        while (0 == co_await bdlmt::TaskUtil::popFront(&request,
+                                                       requests,
+                                                       pool,
+                                                       scheduler,
+                                                       timeout)
+            && 0 != request) {
+            sum += co_await process(request, pool);
+        }
+        co_return sum;
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE_1
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2 ? (atoi(argv[2]) ? atoi(argv[2]) : 1) : 0;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+    switch (test) { case 0:  // case 0 is always the first case
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE_1;
+
+// Next, we create and start the pool and the scheduler:
+//..
+    bdlmt::FixedThreadPool pool(2, 100);
+    pool.start();
+
+    bdlmt::EventScheduler scheduler;
+    scheduler.start();
+
+    bdlcc::BoundedQueue<int> requests(16);
+//..
+// Then, we start handling requests, and push the requests from this thread,
+// which never blocks on the handler:
+//..
+    bdlmt::Task<int> handler = handleRequests(&requests, &pool, &scheduler);
+
+    requests.pushBack(1);
+    requests.pushBack(2);
+    requests.pushBack(3);
+    requests.pushBack(0);
+//..
+// Finally, we wait for the result of the handler, and stop the scheduler and
+// the pool:
+//..
+    ASSERT(14 == bdlmt::TaskUtil::syncWait(bsl::move(handler)));
+
+    scheduler.stop();
+    pool.stop();
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: MANY COROUTINES SHARING A QUEUE, SCHEDULER, AND POOL
+        //
+        // Concerns:
+        //: 1 Many coroutines may concurrently wait on the same queue, timing
+        //:   out on the same scheduler, and hop onto the same pool, and every
+        //:   request is handled exactly once, even as waits time out while
+        //:   requests are pushed.
+        //:
+        //: 2 Coroutines waiting on an empty queue do not occupy threads of
+        //:   the pool: more coroutines than threads make progress.
+        //:
+        //: 3 All frames are deallocated once the coroutines complete.
+        //
+        // Plan:
+        //: 1 Spawn more workers than there are threads in a pool, each popping
+        //:   requests from a shared queue with a short timeout on a shared
+        //:   scheduler, squaring them on the pool, and pushing the squares
+        //:   onto another queue.  Push requests from several threads,
+        //:   followed by one negative request per worker, and verify the sum
+        //:   of the responses and that every worker exits.  Verify that the
+        //:   frames, allocated by a test allocator, are deallocated.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: MANY COROUTINES SHARING A QUEUE, SCHEDULER, AND POOL
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+           << "CONCERN: MANY COROUTINES SHARING A QUEUE, SCHEDULER, AND POOL"
+           << endl
+           << "============================================================="
+           << endl;
+
+        const int NUM_WORKERS   = 16;
+        const int NUM_THREADS   = 4;
+        const int NUM_PUSHERS   = 4;
+        const int NUM_REQUESTS  = 500;  // per pusher
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            bslma::DefaultAllocatorGuard frameGuard(&oa);
+
+            bdlmt::FixedThreadPool pool(NUM_THREADS, 1000, &oa);
+            ASSERT(0 == pool.start());
+
+            bdlmt::EventScheduler scheduler(&oa);
+            ASSERT(0 == scheduler.start());
+
+            IntQueue requests(64, &oa);
+            IntQueue responses(NUM_PUSHERS * NUM_REQUESTS, &oa);
+
+            bslmt::Latch    done(NUM_WORKERS);
+            bsls::AtomicInt numTimeouts(0);
+
+            for (int i = 0; i < NUM_WORKERS; ++i) {
+                Util::spawn(&pool, worker(&requests,
+                                          &responses,
+                                          &scheduler,
+                                          &pool,
+                                          &numTimeouts,
+                                          &done));
+            }
+
+            {
+                bslmt::ThreadGroup pushers(&oa);
+                for (int i = 0; i < NUM_PUSHERS; ++i) {
+                    pushers.addThread(bdlf::BindUtil::bind(&pushRequests,
+                                                           &requests,
+                                                           i,
+                                                           NUM_REQUESTS));
+                }
+                pushers.joinAll();
+            }
+
+            bsls::Types::Int64 expected = 0;
+            for (int i = 0; i < NUM_PUSHERS; ++i) {
+                for (int j = 0; j < NUM_REQUESTS; ++j) {
+                    expected += request(i, j) * request(i, j);
+                }
+            }
+            for (int i = 0; i < NUM_WORKERS; ++i) {
+                requests.pushBack(-1);
+            }
+
+            done.wait();
+
+            bsls::Types::Int64 sum = 0;
+            int                response;
+            int                numResponses = 0;
+            while (0 == responses.tryPopFront(&response)) {
+                sum += response;
+                ++numResponses;
+            }
+            ASSERTV(numResponses, NUM_PUSHERS * NUM_REQUESTS == numResponses);
+            ASSERTV(sum, expected, expected == sum);
+
+            if (veryVerbose) {
+                P(numTimeouts);
+            }
+
+            // The workers complete on the pool, which is joined when stopped,
+            // and no timeout event outlives the scheduler.
+
+            pool.stop();
+            scheduler.stop();
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'spawn'
+        //
+        // Concerns:
+        //: 1 'spawn(task)' runs the task on the calling thread until it first
+        //:   suspends, and returns.
+        //:
+        //: 2 'spawn(executor, task)' runs the task on the executor.
+        //:
+        //: 3 If the executor cannot enqueue the job, the task runs on the
+        //:   calling thread.
+        //:
+        //: 4 A spawned task, and the coroutine awaiting it, are deallocated
+        //:   once the task completes, using the allocator of the task.
+        //
+        // Plan:
+        //: 1 Spawn tasks without an executor, and verify that they ran on the
+        //:   calling thread before 'spawn' returned.  (C-1)
+        //:
+        //: 2 Spawn tasks on a pool, and verify, once they have completed, that
+        //:   they ran on a thread of the pool; repeat with the pool disabled,
+        //:   and verify that they ran on the calling thread.  (C-2..3)
+        //:
+        //: 3 Spawn tasks that suspend on a scheduler, allocated by a test
+        //:   allocator, and verify that all memory is released once the
+        //:   scheduler is stopped.  (C-4)
+        //
+        // Testing:
+        //   void spawn(Task<TYPE> task);
+        //   void spawn(EXECUTOR *executor, Task<TYPE> task);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'spawn'" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tWithout an executor." << endl;
+        {
+            bsls::AtomicInt counter(0);
+            bslmt::Latch    latch(3);
+
+            bdlmt::Task<void> task = countDown(&counter, &latch);
+
+            Util::spawn(bsl::move(task));
+            Util::spawn(countDown(&counter, &latch));
+
+            Uint64 threadId = 0;
+            Util::spawn(recordThread(&threadId, &latch));
+
+            ASSERTV(counter, 2 == counter);
+            ASSERT(selfId() == threadId);
+            ASSERT(0 == latch.currentCount());
+        }
+
+        if (verbose) cout << "\tOn an executor." << endl;
+        {
+            bdlmt::FixedThreadPool pool(2, 100);
+            ASSERT(0 == pool.start());
+
+            Uint64       threadId = 0;
+            bslmt::Latch latch(1);
+
+            Util::spawn(&pool, recordThread(&threadId, &latch));
+            latch.wait();
+            ASSERT(0        != threadId);
+            ASSERT(selfId() != threadId);
+
+            pool.disable();
+
+            bslmt::Latch rejected(1);
+            Util::spawn(&pool, recordThread(&threadId, &rejected));
+            ASSERT(0 == rejected.currentCount());
+            ASSERT(selfId() == threadId);
+
+            pool.stop();
+        }
+
+        if (verbose) cout << "\tDeallocation." << endl;
+        {
+            const int NUM_TASKS = 10;
+
+            bslma::DefaultAllocatorGuard frameGuard(&oa);
+
+            bdlmt::EventScheduler scheduler(&oa);
+            ASSERT(0 == scheduler.start());
+
+            bsls::AtomicInt counter(0);
+            bslmt::Latch    latch(NUM_TASKS);
+
+            for (int i = 0; i < NUM_TASKS; ++i) {
+                Util::spawn(waitThenCount(&scheduler, &counter, &latch));
+            }
+            ASSERT(0 < oa.numBlocksInUse());
+
+            latch.wait();
+            scheduler.stop();
+
+            ASSERTV(counter, NUM_TASKS == counter);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'popFront'
+        //
+        // Concerns:
+        //: 1 If an element can be popped immediately, the coroutine is not
+        //:   suspended, and 'co_await' yields 0.
+        //:
+        //: 2 Otherwise, the coroutine is suspended until an element is
+        //:   pushed, is then resumed on the executor, and 'co_await' yields
+        //:   0.
+        //:
+        //: 3 If the executor cannot enqueue the job, the coroutine is resumed
+        //:   on the thread that pushed the element.
+        //:
+        //: 4 A waiting coroutine does not poll the queue: it schedules no
+        //:   event without a timeout, and a single event with one.
+        //:
+        //: 5 If a timeout is supplied and elapses before an element is
+        //:   pushed, 'co_await' yields 'e_TIMED_OUT' no earlier than the
+        //:   timeout, and an element pushed before the timeout cancels it.
+        //:
+        //: 6 If popping from the queue is disabled, before or while the
+        //:   coroutine waits, 'co_await' yields 'e_DISABLED'.
+        //
+        // Plan:
+        //: 1 Await 'popFront' on a non-empty queue, and verify the value, the
+        //:   status, and that the coroutine ran on this thread.  (C-1)
+        //:
+        //: 2 Spawn a task awaiting 'popFront' on an empty queue, verify that
+        //:   the scheduler holds no event, push an element, and verify the
+        //:   value, the status, and that a thread of the pool resumed the
+        //:   coroutine.  Repeat with the pool disabled, and verify that this
+        //:   thread resumed the coroutine.  (C-2..4)
+        //:
+        //: 3 Await 'popFront' with a short timeout on an empty queue, and
+        //:   verify the status and the time elapsed.  Spawn a task awaiting
+        //:   'popFront' with a long timeout, verify that the scheduler holds
+        //:   a single event, push an element, and verify the value, the
+        //:   status, and that the event is cancelled.  (C-4..5)
+        //:
+        //: 4 Await 'popFront' on a queue that is disabled before, and while,
+        //:   the coroutine waits, and verify the status.  (C-6)
+        //
+        // Testing:
+        //   Task_PopFrontAwaiter popFront(TYPE *, Queue *, EXECUTOR *);
+        //   Task_PopFrontAwaiter popFront(TYPE *, Q *, EX *, EvSched *, TI&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'popFront'" << endl
+                          << "==================" << endl;
+
+        bdlmt::FixedThreadPool pool(2, 100);
+        ASSERT(0 == pool.start());
+
+        bdlmt::EventScheduler scheduler;
+        ASSERT(0 == scheduler.start());
+
+        if (verbose) cout << "\tNon-empty queue." << endl;
+        {
+            IntQueue queue(4);
+            queue.pushBack(7);
+
+            int    value    = 0;
+            Uint64 threadId = 0;
+
+            ASSERT(0 == Util::syncWait(popFrom(&queue,
+                                               &pool,
+                                               &value,
+                                               &threadId)));
+            ASSERTV(value, 7 == value);
+            ASSERT(selfId() == threadId);
+        }
+
+        if (verbose) cout << "\tEmpty queue." << endl;
+        {
+            IntQueue queue(4);
+
+            int          value    = 0;
+            int          status   = -1;
+            Uint64       threadId = 0;
+            bslmt::Latch latch(1);
+
+            Util::spawn(popAndArrive(&queue,
+                                     &pool,
+                                     &value,
+                                     &status,
+                                     &threadId,
+                                     &latch));
+            ASSERT(1 == latch.currentCount());
+            ASSERTV(scheduler.numEvents(), 0 == scheduler.numEvents());
+
+            bslmt::ThreadUtil::microSleep(10000);
+            queue.pushBack(8);
+
+            latch.wait();
+            ASSERTV(status, 0 == status);
+            ASSERTV(value, 8 == value);
+            ASSERT(0        != threadId);
+            ASSERT(selfId() != threadId);
+        }
+
+        if (verbose) cout << "\tDisabled executor." << endl;
+        {
+            bdlmt::FixedThreadPool disabledPool(1, 100);
+            ASSERT(0 == disabledPool.start());
+            disabledPool.disable();
+
+            IntQueue queue(4);
+
+            int          value    = 0;
+            int          status   = -1;
+            Uint64       threadId = 0;
+            bslmt::Latch latch(1);
+
+            Util::spawn(popAndArrive(&queue,
+                                     &disabledPool,
+                                     &value,
+                                     &status,
+                                     &threadId,
+                                     &latch));
+            ASSERT(1 == latch.currentCount());
+
+            queue.pushBack(8);
+
+            ASSERT(0 == latch.currentCount());
+            ASSERTV(status, 0 == status);
+            ASSERTV(value, 8 == value);
+            ASSERT(selfId() == threadId);
+
+            disabledPool.stop();
+        }
+
+        if (verbose) cout << "\tTimeout." << endl;
+        {
+            IntQueue queue(4);
+
+            const bsls::TimeInterval TIMEOUT(0, 20 * 1000 * 1000);
+            const bsls::TimeInterval start = scheduler.now();
+
+            int value = 0;
+            int rc    = Util::syncWait(popFromWithin(&queue,
+                                                     &pool,
+                                                     &scheduler,
+                                                     TIMEOUT,
+                                                     &value));
+            ASSERTV(rc, Util::e_TIMED_OUT == rc);
+            ASSERT(TIMEOUT <= scheduler.now() - start);
+            ASSERTV(value, 0 == value);
+
+            bdlmt::Task<int> task = popFromWithin(&queue,
+                                                  &pool,
+                                                  &scheduler,
+                                                  bsls::TimeInterval(60.0),
+                                                  &value);
+            queue.pushBack(9);
+            rc = Util::syncWait(bsl::move(task));
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(value, 9 == value);
+
+            int          status = -1;
+            bslmt::Latch latch(1);
+
+            Util::spawn(popWithinAndArrive(&queue,
+                                           &pool,
+                                           &scheduler,
+                                           bsls::TimeInterval(60.0),
+                                           &value,
+                                           &status,
+                                           &latch));
+            ASSERT(1 == latch.currentCount());
+            ASSERTV(scheduler.numEvents(), 1 == scheduler.numEvents());
+
+            queue.pushBack(10);
+
+            latch.wait();
+            ASSERTV(status, 0 == status);
+            ASSERTV(value, 10 == value);
+            ASSERTV(scheduler.numEvents(), 0 == scheduler.numEvents());
+        }
+
+        if (verbose) cout << "\tDisabled queue." << endl;
+        {
+            IntQueue queue(4);
+            queue.pushBack(1);
+            queue.disablePopFront();
+
+            int    value    = 0;
+            Uint64 threadId = 0;
+
+            int rc = Util::syncWait(popFrom(&queue,
+                                            &pool,
+                                            &value,
+                                            &threadId));
+            ASSERTV(rc, IntQueue::e_DISABLED == rc);
+            ASSERTV(value, 0 == value);
+
+            queue.enablePopFront();
+            queue.removeAll();
+
+            int          status = 0;
+            bslmt::Latch latch(1);
+
+            Util::spawn(popAndArrive(&queue,
+                                     &pool,
+                                     &value,
+                                     &status,
+                                     &threadId,
+                                     &latch));
+            ASSERT(1 == latch.currentCount());
+
+            bslmt::ThreadUtil::microSleep(10000);
+            queue.disablePopFront();
+
+            latch.wait();
+            ASSERTV(status, IntQueue::e_DISABLED == status);
+            ASSERTV(value, 0 == value);
+        }
+
+        scheduler.stop();
+        pool.stop();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'sleepFor' AND 'sleepUntil'
+        //
+        // Concerns:
+        //: 1 'sleepFor' suspends the coroutine for at least the duration, as
+        //:   measured by the clock of the scheduler.
+        //:
+        //: 2 'sleepUntil' suspends the coroutine until at least the time.
+        //:
+        //: 3 The coroutine is resumed on the dispatcher thread of the
+        //:   scheduler.
+        //:
+        //: 4 A time in the past resumes the coroutine promptly.
+        //
+        // Plan:
+        //: 1 Await 'sleepFor' and 'sleepUntil' and verify, by the clock of
+        //:   the scheduler, the time slept, and the thread that resumed the
+        //:   coroutine.  (C-1..3)
+        //:
+        //: 2 Await 'sleepFor' with a zero duration, and 'sleepUntil' with a
+        //:   time in the past, and verify that the coroutine completes.  (C-4)
+        //
+        // Testing:
+        //   Task_SleepAwaiter sleepFor(EventScheduler *, const TI&);
+        //   Task_SleepAwaiter sleepUntil(EventScheduler *, const TI&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'sleepFor' AND 'sleepUntil'" << endl
+                          << "===================================" << endl;
+
+        bdlmt::EventScheduler scheduler;
+        ASSERT(0 == scheduler.start());
+
+        {
+            const bsls::TimeInterval DURATION(0, 20 * 1000 * 1000);
+
+            Uint64 threadId = 0;
+            Uint64 slept    = Util::syncWait(sleepFor(&scheduler,
+                                                      DURATION,
+                                                      &threadId));
+            if (veryVerbose) { P(slept); }
+
+            ASSERTV(slept, DURATION.totalMicroseconds() <= slept);
+            ASSERT(0        != threadId);
+            ASSERT(selfId() != threadId);
+
+            Util::syncWait(sleepFor(&scheduler,
+                                    bsls::TimeInterval(),
+                                    &threadId));
+        }
+        {
+            const bsls::TimeInterval TIME = scheduler.now() +
+                                     bsls::TimeInterval(0, 20 * 1000 * 1000);
+
+            Uint64 overslept = Util::syncWait(sleepUntil(&scheduler, TIME));
+            if (veryVerbose) { P(overslept); }
+
+            ASSERT(TIME <= scheduler.now());
+
+            Util::syncWait(sleepUntil(&scheduler, bsls::TimeInterval()));
+        }
+
+        scheduler.stop();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'resumeOn'
+        //
+        // Concerns:
+        //: 1 'resumeOn' resumes the coroutine on a thread of the executor,
+        //:   and 'co_await' yields 0.
+        //:
+        //: 2 'resumeOn' supports 'FixedThreadPool', 'ThreadPool', and
+        //:   'WorkStealingThreadPool'.
+        //:
+        //: 3 If the job cannot be enqueued, the coroutine continues on the
+        //:   current thread, and 'co_await' yields the non-zero status.
+        //
+        // Plan:
+        //: 1 For each kind of pool, await 'resumeOn' and verify the status
+        //:   and the thread that resumed the coroutine.  (C-1..2)
+        //:
+        //: 2 Await 'resumeOn' a disabled 'FixedThreadPool', and verify the
+        //:   status and the thread that resumed the coroutine.  (C-3)
+        //
+        // Testing:
+        //   Task_ResumeOnAwaiter<EXECUTOR> resumeOn(EXECUTOR *executor);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'resumeOn'" << endl
+                          << "==================" << endl;
+
+        bslmt::ThreadAttributes attributes;
+
+        {
+            bdlmt::FixedThreadPool pool(2, 100);
+            ASSERT(0 == pool.start());
+
+            Uint64 threadId = 0;
+            ASSERT(0 == Util::syncWait(hopTo(&pool, &threadId)));
+            ASSERT(0        != threadId);
+            ASSERT(selfId() != threadId);
+
+            pool.disable();
+
+            int rc = Util::syncWait(hopTo(&pool, &threadId));
+            ASSERTV(rc, 0 != rc);
+            ASSERT(selfId() == threadId);
+
+            pool.stop();
+        }
+        {
+            bdlmt::ThreadPool pool(attributes, 1, 2, 100);
+            ASSERT(0 == pool.start());
+
+            Uint64 threadId = 0;
+            ASSERT(0 == Util::syncWait(hopTo(&pool, &threadId)));
+            ASSERT(0        != threadId);
+            ASSERT(selfId() != threadId);
+
+            pool.stop();
+        }
+        {
+            bdlmt::WorkStealingThreadPool pool(attributes, 2);
+            ASSERT(0 == pool.start());
+
+            Uint64 threadId = 0;
+            ASSERT(0 == Util::syncWait(hopTo(&pool, &threadId)));
+            ASSERT(0        != threadId);
+            ASSERT(selfId() != threadId);
+
+            pool.stop();
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'Task' AND 'syncWait'
+        //
+        // Concerns:
+        //: 1 A task does not run until it is awaited or started.
+        //:
+        //: 2 Awaiting a task yields its value, for value types, types using
+        //:   'bslma' allocators (constructed with the allocator of the
+        //:   frame), and 'void'; 'syncWait' returns it.
+        //:
+        //: 3 An exception escaping a task is rethrown by 'co_await' and by
+        //:   'syncWait'.
+        //:
+        //: 4 Frames are allocated by the allocator argument of the coroutine,
+        //:   or by the default allocator, and are deallocated when the task
+        //:   is destroyed, whether or not it was started.
+        //:
+        //: 5 Moving a task transfers ownership of its coroutine.
+        //:
+        //: 6 Tasks may be nested deeply.
+        //
+        // Plan:
+        //: 1 Create tasks, verify their accessors and that they have not run,
+        //:   and start them with 'syncWait'.  (C-1..2)
+        //:
+        //: 2 Await tasks that throw, directly and from another task.  (C-3)
+        //:
+        //: 3 Verify the allocations of frames supplied by test allocators,
+        //:   and the allocator of the value of a string task.  (C-4)
+        //:
+        //: 4 Move-construct and move-assign tasks, and verify which object
+        //:   owns the coroutine, and the deallocation of frames.  (C-5)
+        //:
+        //: 5 Await a recursion of 1000 tasks.  (C-6)
+        //
+        // Testing:
+        //   Task();
+        //   Task(Task&& original);
+        //   ~Task();
+        //   Task& operator=(Task&& rhs);
+        //   Task_Awaiter<TYPE> operator co_await() &&;
+        //   bslma::Allocator *allocator() const;
+        //   bool isDone() const;
+        //   bool isValid() const;
+        //   TYPE syncWait(Task<TYPE> task);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'Task' AND 'syncWait'" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard frameGuard(&da);
+
+        if (verbose) cout << "\tLazy start and values." << endl;
+        {
+            int counter = 0;
+
+            bdlmt::Task<void> task = increment(&counter, &oa);
+            ASSERT(task.isValid());
+            ASSERT(!task.isDone());
+            ASSERT(&oa == task.allocator());
+            ASSERTV(counter, 0 == counter);
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+            ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+            Util::syncWait(bsl::move(task));
+            ASSERTV(counter, 1 == counter);
+            ASSERT(!task.isValid());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            ASSERT(42 == Util::syncWait(valueOf(42)));
+            ASSERT(55 == Util::syncWait(sumTo(10, &oa)));
+            ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tAllocator-aware values." << endl;
+        {
+            bdlmt::Task<bsl::string> task = concatenate(LONG_STRING,
+                                                        "!",
+                                                        &oa);
+            ASSERT(&oa == task.allocator());
+
+            bsls::Types::Int64 numDefault = da.numAllocations();
+
+            const bsl::string result = Util::syncWait(bsl::move(task));
+            ASSERTV(numDefault, da.numAllocations(),
+                    numDefault == da.numAllocations());
+
+            // 'result' is moved from the value constructed in the frame.
+
+            ASSERT(&oa == result.get_allocator().mechanism());
+            ASSERT(bsl::string(LONG_STRING) + "!" == result);
+
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tDefault allocator." << endl;
+        {
+            bdlmt::Task<int> task = valueOf(1);
+            ASSERT(&da == task.allocator());
+            ASSERTV(da.numBlocksInUse(), 1 == da.numBlocksInUse());
+
+            bdlmt::Task<int> nullAllocator = valueOf(1, 0);
+            ASSERT(&da == nullAllocator.allocator());
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tExceptions." << endl;
+        {
+            ASSERT( 5 == Util::syncWait(catchFrom(false, 5)));
+            ASSERT(-5 == Util::syncWait(catchFrom(true,  5)));
+
+            bool caught = false;
+            try {
+                Util::syncWait(throwIf(true, 6));
+            }
+            catch (int thrown) {
+                ASSERTV(thrown, 6 == thrown);
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tMoving and destroying." << endl;
+        {
+            bdlmt::Task<int> empty;
+            ASSERT(!empty.isValid());
+
+            bdlmt::Task<int> task = valueOf(3, &oa);
+            bdlmt::Task<int> moved(bsl::move(task));
+            ASSERT(!task.isValid());
+            ASSERT(moved.isValid());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+
+            empty = bsl::move(moved);
+            ASSERT(!moved.isValid());
+            ASSERT(empty.isValid());
+
+            bdlmt::Task<int> other = valueOf(4, &oa);
+            ASSERTV(oa.numBlocksInUse(), 2 == oa.numBlocksInUse());
+
+            empty = bsl::move(other);
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+            ASSERT(4 == Util::syncWait(bsl::move(empty)));
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            // A task that is never started is destroyed without running.
+
+            int counter = 0;
+            {
+                bdlmt::Task<void> unstarted = increment(&counter, &oa);
+                ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+            }
+            ASSERTV(counter, 0 == counter);
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tDeep nesting." << endl;
+        {
+            const int N = 1000;
+
+            ASSERT(N * (N + 1) / 2 == Util::syncWait(sumTo(N, &oa)));
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(oa.numAllocations(), N < oa.numAllocations());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'Task_FrameUtil'
+        //
+        // Concerns:
+        //: 1 'selectAllocator' returns the first argument convertible to
+        //:   'bslma::Allocator *', or the default allocator if there is none,
+        //:   or it is 0.
+        //:
+        //: 2 'allocate' returns a block from the allocator, and 'deallocate'
+        //:   returns it to the same allocator, for any frame size.
+        //
+        // Plan:
+        //: 1 Call 'selectAllocator' with various argument lists, and verify
+        //:   the result.  (C-1)
+        //:
+        //: 2 For a range of sizes, allocate a block from a test allocator,
+        //:   write to every byte of the frame, and deallocate it; verify the
+        //:   allocations made by the test allocator.  (C-2)
+        //
+        // Testing:
+        //   Task_FrameUtil
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'Task_FrameUtil'" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator  oa("object", veryVeryVerbose);
+        bslma::TestAllocator  xa("other",  veryVeryVerbose);
+        bslma::Allocator     *DA = bslma::Default::defaultAllocator();
+        bslma::Allocator     *nullAllocator = 0;
+
+        if (verbose) cout << "\tselectAllocator." << endl;
+        {
+            const int         I = 1;
+            const char *const S = "s";
+
+            ASSERT(DA  == FrameUtil::selectAllocator());
+            ASSERT(DA  == FrameUtil::selectAllocator(I, S));
+            ASSERT(DA  == FrameUtil::selectAllocator(nullAllocator, I));
+            ASSERT(&oa == FrameUtil::selectAllocator(&oa));
+            ASSERT(&oa == FrameUtil::selectAllocator(I, &oa, S));
+            ASSERT(&oa == FrameUtil::selectAllocator(I, &oa, &xa));
+
+            bslma::Allocator *base = &xa;
+            ASSERT(&xa == FrameUtil::selectAllocator(S, base, &oa));
+        }
+
+        if (verbose) cout << "\tallocate and deallocate." << endl;
+        {
+            for (bsl::size_t size = 1; size < 100; ++size) {
+                char *frame = static_cast<char *>(
+                                               FrameUtil::allocate(size, &oa));
+                ASSERTV(size, 1 == oa.numBlocksInUse());
+                ASSERTV(size, size < oa.lastAllocatedNumBytes());
+
+                for (bsl::size_t i = 0; i < size; ++i) {
+                    frame[i] = static_cast<char>(i);
+                }
+
+                FrameUtil::deallocate(frame, size);
+                ASSERTV(size, 0 == oa.numBlocksInUse());
+            }
+            ASSERT(99 == oa.numAllocations());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Await tasks from a task started by 'syncWait', hopping onto a
+        //:   pool and sleeping on a scheduler.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERT(3 == Util::syncWait(valueOf(3)));
+        ASSERT(6 == Util::syncWait(sumTo(3)));
+
+        bdlmt::FixedThreadPool pool(2, 100);
+        ASSERT(0 == pool.start());
+
+        bdlmt::EventScheduler scheduler;
+        ASSERT(0 == scheduler.start());
+
+        ASSERT(49 == Util::syncWait(square(7, &pool)));
+
+        Uint64 threadId = 0;
+        ASSERT(1000 <= Util::syncWait(sleepFor(&scheduler,
+                                               bsls::TimeInterval(0, 1000000),
+                                               &threadId)));
+
+        scheduler.stop();
+        pool.stop();
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COROUTINES VS. JOBS
+        //
+        // Concerns:
+        //: 1 Resuming a coroutine on a pool costs little more than enqueuing
+        //:   a job.
+        //:
+        //: 2 Awaiting a task that completes synchronously costs little: no
+        //:   more than allocating its frame.
+        //
+        // Plan:
+        //: 1 Run a number of chains of hops onto a pool, once with jobs that
+        //:   re-enqueue themselves, and once with coroutines awaiting
+        //:   'resumeOn'.  (C-1)
+        //:
+        //: 2 Time a chain of awaits of tasks that complete synchronously.  The
+        //:   number of iterations is given by the second command-line
+        //:   argument (1000 by default).  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE: COROUTINES VS. JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: COROUTINES VS. JOBS" << endl
+                          << "================================" << endl;
+
+        // Time allocation as in production, not through the test allocator.
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        bslma::DefaultAllocatorGuard benchmarkGuard(allocator);
+
+        const int NUM_ITERATIONS = verbose > 1 ? verbose : 1000;
+        const int NUM_CHAINS     = 16;
+        const int NUM_HOPS       = 100;
+        const int NUM_THREADS    = 4;
+
+        bdlmt::FixedThreadPool pool(NUM_THREADS, 1000);
+        ASSERT(0 == pool.start());
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            bslmt::Latch latch(NUM_CHAINS);
+
+            for (int i = 0; i < NUM_CHAINS; ++i) {
+                HopJob job = { &pool, NUM_HOPS, &latch };
+                pool.enqueueJob(job);
+            }
+            latch.wait();
+            pool.drain();
+        }
+        timer.stop();
+        cout << "jobs:       " << timer.elapsedTime() << "s" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            bslmt::Latch latch(NUM_CHAINS);
+
+            for (int i = 0; i < NUM_CHAINS; ++i) {
+                Util::spawn(&pool, hop(&pool, NUM_HOPS - 1, &latch));
+            }
+            latch.wait();
+            pool.drain();
+        }
+        timer.stop();
+        cout << "coroutines: " << timer.elapsedTime() << "s" << endl;
+
+        const int CHAIN = 1000;
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            ASSERT(CHAIN == Util::syncWait(chain(CHAIN)));
+        }
+        timer.stop();
+        cout << "await chain of " << CHAIN << ": "
+             << timer.elapsedTime() / NUM_ITERATIONS * 1e6 << "us ("
+             << timer.elapsedTime() / NUM_ITERATIONS / CHAIN * 1e9
+             << "ns per task, including its frame)" << endl;
+
+        pool.stop();
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+#else
+    if (verbose) cout << "Coroutines are not supported in this configuration."
+                      << endl;
+#endif
+
+    ASSERT(0 == globalAllocator.numAllocations());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -100,13 +100,7 @@ ThreadPoolWaitNode::ThreadPoolWaitNode()
 const char ThreadPool::s_defaultThreadName[16] = { "bdl.ThreadPool" };
 
 // PRIVATE MANIPULATORS
-void ThreadPool::doEnqueueJob(const Job& job)
-{
-    d_queue.push_back(job);
-    wakeThreadIfNeeded();
-}
-
-void ThreadPool::doEnqueueJob(bslmf::MovableRef<Job> job)
+void ThreadPool::doEnqueueJob(bslmf::MovableRef<QueuedJob> job)
 {
     d_queue.push_back(bslmf::MovableRefUtil::move(job));
     wakeThreadIfNeeded();
@@ -230,7 +224,7 @@ int ThreadPool::startNewThread()
 void ThreadPool::workerThread()
 {
     ThreadPoolWaitNode waitNode;
-    Job functor;
+    QueuedJob functor;
     while (1) {
         // The functor has to be cleared when we are *not* holding the lock
         // because it might have some objects bound with non-trivial
@@ -238,7 +232,7 @@ void ThreadPool::workerThread()
 
         bool functorWasSetFlag = false;
         if (functor) {
-            functor = Job();
+            functor = QueuedJob();
             functorWasSetFlag = true;
         }
 
@@ -320,7 +314,7 @@ void ThreadPool::workerThread()
                 }
             }
 
-            functor = d_queue.front();
+            functor = bslmf::MovableRefUtil::move(d_queue.front());
             d_queue.pop_front();
 
             // Although user-enqueued functors cannot be null, 'stop()' and
@@ -457,7 +451,12 @@ int ThreadPool::enqueueJob(const Job& functor)
         return -1;                                                    // RETURN
     }
 
-    doEnqueueJob(functor);
+    // Copy 'functor' using the allocator of the queue, then move the copy
+    // into the queue.
+
+    Job       copy(bsl::allocator_arg, d_queue.get_allocator(), functor);
+    QueuedJob job(bslmf::MovableRefUtil::move(copy));
+    doEnqueueJob(bslmf::MovableRefUtil::move(job));
 
     return startThreadIfNeeded();
 }
@@ -478,10 +477,37 @@ int ThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
         return -1;                                                    // RETURN
     }
 
+    Job       copy(bsl::allocator_arg,
+                   d_queue.get_allocator(),
+                   bslmf::MovableRefUtil::move(functor));
+    QueuedJob job(bslmf::MovableRefUtil::move(copy));
+    doEnqueueJob(bslmf::MovableRefUtil::move(job));
+
+    return startThreadIfNeeded();
+}
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+int ThreadPool::enqueueInplaceJob(bslmf::MovableRef<InplaceJob> functor)
+{
+    if (!bslmf::MovableRefUtil::access(functor)) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (!d_enabled) {
+        return -1;                                                    // RETURN
+    }
+
     doEnqueueJob(bslmf::MovableRefUtil::move(functor));
 
     return startThreadIfNeeded();
 }
+#endif
 
 void ThreadPool::shutdown()
 {
@@ -492,7 +518,8 @@ void ThreadPool::shutdown()
         d_queue.pop_front();
     }
     for (int i = 0; i < d_threadCount; ++i) {
-        doEnqueueJob(Job());
+        QueuedJob nullJob;
+        doEnqueueJob(bslmf::MovableRefUtil::move(nullJob));
     }
     while (d_threadCount) {
         d_drainCond.wait(&d_mutex);
@@ -537,7 +564,8 @@ void ThreadPool::stop()
     d_enabled = 0;
 
     for (int i = 0; i < d_threadCount; ++i) {
-        doEnqueueJob(Job());
+        QueuedJob nullJob;
+        doEnqueueJob(bslmf::MovableRefUtil::move(nullJob));
     }
     while (d_threadCount) {
         d_drainCond.wait(&d_mutex);
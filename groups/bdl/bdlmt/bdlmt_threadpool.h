@@ -67,6 +67,19 @@ BSLS_IDENT("$Id: $")
 // management code, an application can easily create a thread pool, enqueue a
 // series of jobs to be executed, and wait until all the jobs have executed.
 //
+///Allocation-Free Job Submission
+///-------------------------------
+// A job enqueued as a 'Job' ('bsl::function<void()>') is stored in the queue
+// of pending jobs as a 'bsl::function', which allocates memory for every job
+// whose functor does not fit in its small buffer (a few pointers).  In C++11
+// and later, the pool also accepts jobs of type 'InplaceJob', a move-only
+// 'bdlf::InplaceFunction<void()>' whose buffer is large enough to hold a
+// 'Job' and a functor of up to 'sizeof(Job) + 2 * sizeof(void *)' bytes.
+// Jobs enqueued with 'enqueueInplaceJob' are moved into the queue without
+// allocating memory (other than for the amortized growth of the queue), and
+// may own move-only resources.  Jobs of both kinds are executed in the order
+// in which they are enqueued.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlmt::ThreadPool' class is both *fully thread-safe* (i.e., all
@@ -344,6 +357,7 @@ BSLS_IDENT("$Id: $")
 //..
 
 #include <bdlf_bind.h>
+#include <bdlf_inplacefunction.h>
 
 #include <bdlscm_version.h>
 
@@ -407,9 +421,26 @@ class ThreadPool {
     // TYPES
     typedef bsl::function<void()> Job;
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    typedef bdlf::InplaceFunction<void(), sizeof(Job) + 2 * sizeof(void *)>
+                                  InplaceJob;
+        // 'InplaceJob' is a move-only job type storing its functor within the
+        // job object itself, and therefore within the queue of pending jobs.
+#endif
+
   private:
+    // PRIVATE TYPES
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    typedef InplaceJob QueuedJob;
+#else
+    typedef Job        QueuedJob;
+#endif
+        // 'QueuedJob' is the type of the elements of the queue of pending
+        // jobs.
+
     // PRIVATE DATA
-    bsl::deque<Job>      d_queue;          // queue of pending jobs
+    bsl::deque<QueuedJob>
+                         d_queue;          // queue of pending jobs
 
     mutable bslmt::Mutex d_mutex;          // mutex used to control access to
                                            // this thread pool
@@ -481,8 +512,7 @@ class ThreadPool {
     friend void* ThreadPoolEntry(void *);
 
     // PRIVATE MANIPULATORS
-    void doEnqueueJob(const Job& job);
-    void doEnqueueJob(bslmf::MovableRef<Job> job);
+    void doEnqueueJob(bslmf::MovableRef<QueuedJob> job);
         // Internal method used to push the specified 'job' onto 'd_queue' and
         // signal the next waiting thread if any.  Note that this method must
         // be called with 'd_mutex' locked.
@@ -571,6 +601,18 @@ class ThreadPool {
         // to the function by the processing thread.  Return 0 if enqueued
         // successfully, and a non-zero value if queuing is currently disabled.
 
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    int enqueueInplaceJob(bslmf::MovableRef<InplaceJob> functor);
+        // Enqueue the specified 'functor' to be executed by the next available
+        // thread.  'functor' is moved into the queue of pending jobs, without
+        // allocating memory other than for the growth of the queue, and is
+        // left empty if enqueued.  Return 0 if enqueued successfully, and a
+        // non-zero value if queuing is currently disabled.  The behavior is
+        // undefined unless 'functor' is not empty.  Note that this method is
+        // named differently from 'enqueueJob' so that a lambda or other
+        // functor can be passed to either without ambiguity.
+#endif
+
     double resetPercentBusy();
         // Atomically report the percentage of wall time spent by each thread
         // of this thread pool executing jobs since the last reset time, and
@@ -25,6 +25,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
+#include <bsls_compilerfeatures.h>
 #include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
@@ -95,6 +96,7 @@ using namespace bsl;  // automatically added by script
 // [13] TESTING CPU consumption of an idle pool.
 // [15] TESTING MOVING ENQUEUEJOB METHOD
 // [16] THREAD NAMES
+// [17] int enqueueInplaceJob(bslmf::MovableRef<InplaceJob> functor);
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -771,6 +773,52 @@ void CopyCountingFunctor::operator()()
 
 }  // close namespace case14
 
+// ============================================================================
+//                         CASE 17 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+namespace case17 {
+                           // ====================
+                           // MoveOnlyRecordingJob
+                           // ====================
+class MoveOnlyRecordingJob {
+    // A move-only functor, larger than the small-object buffer of a
+    // 'bsl::function', that appends a value to a vector when invoked.
+
+    // DATA
+    bsl::vector<int> *d_results_p;  // vector to append to (held)
+    int               d_value;      // value to append
+    void             *d_padding[6]; // make this functor large
+
+  public:
+    // CREATORS
+    MoveOnlyRecordingJob(bsl::vector<int> *results, int value)
+        // Create a functor that appends the specified 'value' to the
+        // specified 'results' when invoked.
+    : d_results_p(results)
+    , d_value(value)
+    {
+        bsl::fill(d_padding, d_padding + 6, static_cast<void *>(0));
+    }
+
+    MoveOnlyRecordingJob(MoveOnlyRecordingJob&&) = default;
+        // Create a functor having the value of the specified object.
+
+    MoveOnlyRecordingJob(const MoveOnlyRecordingJob&) = delete;
+    MoveOnlyRecordingJob& operator=(const MoveOnlyRecordingJob&) = delete;
+
+    // MANIPULATORS
+    void operator()()
+        // Append the value of this functor to the vector of results.
+    {
+        d_results_p->push_back(d_value);
+    }
+};
+
+}  // close namespace case17
+#endif
+
 // ============================================================================
 //                          CASE 8 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -906,6 +954,101 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0: // 0 is always the first test case
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING 'enqueueInplaceJob'
+        //
+        // Concerns:
+        //: 1 'enqueueInplaceJob' accepts move-only functors, moves them into
+        //:   the queue, and leaves the argument empty.
+        //:
+        //: 2 Jobs enqueued with 'enqueueInplaceJob' and 'enqueueJob' are run
+        //:   in the order in which they are enqueued.
+        //:
+        //: 3 'enqueueInplaceJob' allocates no memory other than for the
+        //:   growth of the queue.
+        //:
+        //: 4 If the pool is disabled, 'enqueueInplaceJob' fails and leaves
+        //:   the argument unchanged.
+        //
+        // Plan:
+        //: 1 Block the single thread of a pool, then enqueue a sequence of
+        //:   move-only jobs recording their index, alternating between
+        //:   'enqueueInplaceJob' and 'enqueueJob' for a subsequence.  Verify
+        //:   that the arguments are left empty, and that the number of
+        //:   allocations is much smaller than the number of jobs.  (C-1, 3)
+        //:
+        //: 2 Unblock the thread, drain the pool and verify the order in
+        //:   which the jobs were run.  (C-2)
+        //:
+        //: 3 Stop the pool and verify that 'enqueueInplaceJob' fails without
+        //:   modifying its argument.  (C-4)
+        //
+        // Testing:
+        //   int enqueueInplaceJob(bslmf::MovableRef<InplaceJob> functor);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'enqueueInplaceJob'\n"
+                             "===========================\n";
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+        using case17::MoveOnlyRecordingJob;
+
+        const int k_NUM_JOBS = 64;
+
+        bsl::vector<int> results(&testAllocator);
+        results.reserve(2 * k_NUM_JOBS);
+
+        bslmt::Latch            latch(1);  // must outlive the pool
+        bslmt::ThreadAttributes attributes;
+        Obj                     mX(attributes, 1, 1, 0, &testAllocator);
+        mX.start();
+
+        case14::OnceBlockingFunctor blocker(&latch);
+        ASSERT(0 == mX.enqueueJob(blocker));
+
+        const bsls::Types::Int64 numAllocations =
+                                                testAllocator.numAllocations();
+
+        for (int i = 0; i < k_NUM_JOBS; ++i) {
+            Obj::InplaceJob job(MoveOnlyRecordingJob(&results, i));
+
+            ASSERTV(i, 0 == mX.enqueueInplaceJob(
+                                          bslmf::MovableRefUtil::move(job)));
+            ASSERTV(i, !job);
+        }
+
+        ASSERTV(testAllocator.numAllocations() - numAllocations,
+                testAllocator.numAllocations() - numAllocations <
+                                                              k_NUM_JOBS / 8);
+
+        for (int i = k_NUM_JOBS; i < 2 * k_NUM_JOBS; ++i) {
+            if (i % 2) {
+                ASSERTV(i, 0 == mX.enqueueInplaceJob(
+                                       MoveOnlyRecordingJob(&results, i)));
+            }
+            else {
+                ASSERTV(i, 0 == mX.enqueueJob([&results, i]() {
+                    results.push_back(i);
+                }));
+            }
+        }
+
+        latch.arrive();
+        mX.drain();
+
+        ASSERTV(results.size(), 2 * k_NUM_JOBS == results.size());
+        for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+            ASSERTV(i, results[i], i == results[i]);
+        }
+
+        mX.stop();
+
+        Obj::InplaceJob job(MoveOnlyRecordingJob(&results, -1));
+        ASSERT(0 != mX.enqueueInplaceJob(bslmf::MovableRefUtil::move(job)));
+        ASSERT(job);
+#endif
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TESTING THREAD NAMES
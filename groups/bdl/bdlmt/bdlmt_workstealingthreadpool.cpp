@@ -0,0 +1,663 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructorproctor.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_new.h>
+
+///Implementation Notes
+///--------------------
+// Each 'WorkStealingThreadPool_Deque' is the array-based deque described by
+// Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005), with the
+// memory orderings of Le et al. ("Correct and Efficient Work-Stealing for Weak
+// Memory Models", PPoPP 2013), except that the buffer is not grown: a job that
+// does not fit in the deque of the enqueuing thread is placed on the shared
+// queue instead.  The sequentially consistent fences of the latter paper are
+// expressed as sequentially consistent loads and stores of 'd_top' and
+// 'd_bottom'.
+//
+// 'drain' must detect that no job is pending or running, including jobs that
+// running jobs may still enqueue, without a counter that every thread updates
+// on every job.  Instead, each worker counts the jobs it enqueued and the jobs
+// it completed, and jobs enqueued from outside the pool (or that overflowed a
+// deque) are counted, under 'd_mutex', as they are added to the shared queue.
+// A job's enqueue is always counted before the job can be taken, and its
+// completion is counted after it, and any jobs it enqueued, have finished.
+// 'isQuiescent' sums all completion counts and *then* all enqueue counts; if
+// the sums are equal, then at the instant the first sum was complete, every
+// job that had been enqueued had also completed, and so (absent concurrent
+// enqueues from outside the pool) no job can be enqueued thereafter.
+//
+// A thread that finds no work announces itself in 'd_numSleeping' and, while
+// holding 'd_mutex', checks every deque and the shared queue before waiting
+// on 'd_workCondition'.  A thread that pushes onto its own deque reads
+// 'd_numSleeping' after pushing, and signals 'd_workCondition' (under
+// 'd_mutex') if it is non-zero.  Because both the announcement and the push
+// are sequentially consistent, either the sleeping thread sees the job or the
+// pushing thread sees the sleeper, so no wake-up is lost.  A thread that is
+// about to wait also signals 'd_idleCondition', which is how 'drain' is
+// notified that the pool may have become quiescent.
+
+namespace BloombergLP {
+namespace {
+
+const int k_DEQUE_CAPACITY = 4096;  // capacity of each worker's deque
+
+const int k_NUM_SPIN_ROUNDS = 64;   // number of attempts to find a job
+                                    // before a thread blocks
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+    // Load into the specified 'blockSet' all signals except the synchronous
+    // ones.
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace bdlmt {
+
+                     // ----------------------------------
+                     // class WorkStealingThreadPool_Deque
+                     // ----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                              int               capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_topPad()
+, d_bottom(0)
+, d_bottomPad()
+, d_buffer_p(0)
+, d_mask(capacity - 1)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    d_buffer_p = static_cast<bsls::AtomicPointer<Job> *>(
+                    d_allocator_p->allocate(capacity *
+                                            sizeof(bsls::AtomicPointer<Job>)));
+
+    for (int i = 0; i < capacity; ++i) {
+        new (d_buffer_p + i) bsls::AtomicPointer<Job>();
+    }
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+                     // -----------------------------------
+                     // struct WorkStealingThreadPool_Worker
+                     // -----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Worker::WorkStealingThreadPool_Worker(
+                                              int               index,
+                                              int               dequeCapacity,
+                                              bslma::Allocator *basicAllocator)
+: d_deque(dequeCapacity, basicAllocator)
+, d_numEnqueued(0)
+, d_numCompleted(0)
+, d_randomState((static_cast<unsigned int>(index) + 1) * 2654435761u)
+, d_pad()
+{
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE CLASS DATA
+const char WorkStealingThreadPool::s_defaultThreadName[16] = { "bdl.WSPool" };
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool::Job *WorkStealingThreadPool::createJob(
+                                                            const Job& functor)
+{
+    void *memory = d_jobPool.allocate();
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(memory,
+                                                             &d_jobPool);
+
+    Job *job = new (memory) Job(bsl::allocator_arg,
+                                bsl::allocator<char>(d_allocator_p),
+                                functor);
+
+    proctor.release();
+
+    return job;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::createJob(
+                                                bslmf::MovableRef<Job> functor)
+{
+    void *memory = d_jobPool.allocate();
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(memory,
+                                                             &d_jobPool);
+
+    Job *job = new (memory) Job(bsl::allocator_arg,
+                                bsl::allocator<char>(d_allocator_p),
+                                bslmf::MovableRefUtil::move(functor));
+
+    proctor.release();
+
+    return job;
+}
+
+void WorkStealingThreadPool::destroyJob(Job *job)
+{
+    job->~Job();
+    d_jobPool.deallocate(job);
+}
+
+void WorkStealingThreadPool::drainImp()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    ++d_numDrainWaiters;
+    while (!isQuiescent()) {
+        d_idleCondition.wait(&d_mutex);
+    }
+    --d_numDrainWaiters;
+}
+
+int WorkStealingThreadPool::enqueueImp(Job *job)
+{
+    Worker *worker = static_cast<Worker *>(
+                              bslmt::ThreadUtil::getSpecific(d_workerKey));
+
+    if (worker) {
+        // Count the job before it can be taken by another thread (see the
+        // implementation notes).
+
+        const bsls::Types::Uint64 numEnqueued =
+                                          worker->d_numEnqueued.loadRelaxed();
+        worker->d_numEnqueued.storeRelease(numEnqueued + 1);
+
+        if (worker->d_deque.push(job)) {
+            if (0 < d_numSleeping) {
+                bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+                d_workCondition.signal();
+            }
+            return e_SUCCESS;                                         // RETURN
+        }
+
+        // The deque is full; the job is counted by 'pushShared' instead.
+
+        worker->d_numEnqueued.storeRelease(numEnqueued);
+    }
+    else if (!d_enabled) {
+        destroyJob(job);
+        return e_DISABLED;                                            // RETURN
+    }
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> deallocator(job,
+                                                                 &d_jobPool);
+    bslma::DestructorProctor<Job>                    destructor(job);
+
+    pushShared(job);
+
+    destructor.release();
+    deallocator.release();
+
+    return e_SUCCESS;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::findJob(Worker *worker)
+{
+    for (int i = 0; i < k_NUM_SPIN_ROUNDS; ++i) {
+        if (d_stopFlag.loadAcquire()) {
+            return 0;                                                 // RETURN
+        }
+
+        Job *job = takeShared();
+        if (job) {
+            return job;                                               // RETURN
+        }
+
+        job = stealJob(worker);
+        if (job) {
+            return job;                                               // RETURN
+        }
+
+        bslmt::ThreadUtil::yield();
+    }
+
+    return 0;
+}
+
+void WorkStealingThreadPool::initialize()
+{
+    BSLS_ASSERT_OPT(1 <= d_numThreads);
+
+    if (d_threadAttributes.threadName().empty()) {
+        d_threadAttributes.setThreadName(s_defaultThreadName);
+    }
+
+    d_workers_p = static_cast<Worker *>(
+                       d_allocator_p->allocate(d_numThreads * sizeof(Worker)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(d_workers_p,
+                                                            d_allocator_p);
+    bslma::AutoDestructor<Worker>               destructor(d_workers_p);
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        new (d_workers_p + i) Worker(i, k_DEQUE_CAPACITY, d_allocator_p);
+        ++destructor;
+    }
+
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+
+    destructor.release();
+    deallocator.release();
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+void WorkStealingThreadPool::pushShared(Job *job)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_sharedQueue.push_back(job);
+
+    d_numShared.storeRelease(static_cast<int>(d_sharedQueue.size()));
+    d_numSharedEnqueued.addRelaxed(1);
+
+    if (0 < d_numSleeping) {
+        d_workCondition.signal();
+    }
+}
+
+void WorkStealingThreadPool::removeAll()
+{
+    bsls::Types::Uint64 numRemoved = 0;
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        while (Job *job = d_workers_p[i].d_deque.pop()) {
+            destroyJob(job);
+            ++numRemoved;
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    while (!d_sharedQueue.empty()) {
+        destroyJob(d_sharedQueue.front());
+        d_sharedQueue.pop_front();
+        ++numRemoved;
+    }
+    d_numShared.storeRelease(0);
+
+    d_numCanceled.addRelaxed(numRemoved);
+}
+
+void WorkStealingThreadPool::runJob(Worker *worker, Job *job)
+{
+    d_numActiveThreads.addAcqRel(1);
+
+    (*job)();
+    destroyJob(job);
+
+    d_numActiveThreads.addAcqRel(-1);
+
+    worker->d_numCompleted.storeRelease(
+                                     worker->d_numCompleted.loadRelaxed() + 1);
+}
+
+int WorkStealingThreadPool::startNewThread(Worker *worker)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    bsl::function<void()> workerThreadFunc = bdlf::BindUtil::bind(
+                                         &WorkStealingThreadPool::workerThread,
+                                          this,
+                                          worker);
+
+    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_stopFlag = true;
+        d_workCondition.broadcast();
+    }
+
+    d_threadGroup.joinAll();
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::stealJob(Worker *worker)
+{
+    if (1 == d_numThreads) {
+        return 0;                                                     // RETURN
+    }
+
+    // Choose the first victim with an "xorshift" generator.
+
+    unsigned int state = worker->d_randomState;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    worker->d_randomState = state;
+
+    const int first = static_cast<int>(state % d_numThreads);
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        Worker *victim = d_workers_p + (first + i) % d_numThreads;
+
+        if (victim != worker) {
+            Job *job = victim->d_deque.steal();
+            if (job) {
+                return job;                                           // RETURN
+            }
+        }
+    }
+
+    return 0;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::takeShared()
+{
+    if (0 == d_numShared.loadAcquire()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_sharedQueue.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_sharedQueue.front();
+    d_sharedQueue.pop_front();
+
+    d_numShared.storeRelease(static_cast<int>(d_sharedQueue.size()));
+
+    return job;
+}
+
+void WorkStealingThreadPool::waitForJob()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_numSleeping.add(1);
+
+    if (!d_stopFlag.loadAcquire() && !hasPendingJob()) {
+        if (d_numDrainWaiters) {
+            d_idleCondition.broadcast();
+        }
+        d_workCondition.wait(&d_mutex);
+    }
+
+    d_numSleeping.add(-1);
+}
+
+void WorkStealingThreadPool::workerThread(Worker *worker)
+{
+    bslmt::ThreadUtil::setSpecific(d_workerKey, worker);
+
+    while (!d_stopFlag.loadAcquire()) {
+        Job *job = worker->d_deque.pop();
+
+        if (!job) {
+            job = findJob(worker);
+        }
+
+        if (job) {
+            runJob(worker, job);
+        }
+        else {
+            waitForJob();
+        }
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+}
+
+// PRIVATE ACCESSORS
+bool WorkStealingThreadPool::hasPendingJob() const
+{
+    if (!d_sharedQueue.empty()) {
+        return true;                                                  // RETURN
+    }
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        if (!d_workers_p[i].d_deque.isEmpty()) {
+            return true;                                              // RETURN
+        }
+    }
+
+    return false;
+}
+
+bool WorkStealingThreadPool::isQuiescent() const
+{
+    // Completions must be summed before enqueues (see the implementation
+    // notes).
+
+    bsls::Types::Uint64 numCompleted = d_numCanceled.loadAcquire();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        numCompleted += d_workers_p[i].d_numCompleted.loadAcquire();
+    }
+
+    bsls::Types::Uint64 numEnqueued = d_numSharedEnqueued.loadAcquire();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        numEnqueued += d_workers_p[i].d_numEnqueued.loadAcquire();
+    }
+
+    return numEnqueued == numCompleted;
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_workers_p(0)
+, d_numThreads(numThreads)
+, d_jobPool(sizeof(Job), basicAllocator)
+, d_sharedQueue(basicAllocator)
+, d_numShared(0)
+, d_numSharedEnqueued(0)
+, d_numCanceled(0)
+, d_numSleeping(0)
+, d_numActiveThreads(0)
+, d_enabled(false)
+, d_stopFlag(false)
+, d_numDrainWaiters(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             bslma::Allocator               *basicAllocator)
+: d_workers_p(0)
+, d_numThreads(numThreads)
+, d_jobPool(sizeof(Job), basicAllocator)
+, d_sharedQueue(basicAllocator)
+, d_numShared(0)
+, d_numSharedEnqueued(0)
+, d_numCanceled(0)
+, d_numSleeping(0)
+, d_numActiveThreads(0)
+, d_enabled(false)
+, d_stopFlag(false)
+, d_numDrainWaiters(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    // Jobs may have been enqueued while enabled but not started.
+
+    removeAll();
+
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers_p[i].~Worker();
+    }
+    d_allocator_p->deallocate(d_workers_p);
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        drainImp();
+    }
+}
+
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    BSLS_ASSERT(0 != function);
+
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        d_enabled = false;
+        stopThreads();
+        removeAll();
+    }
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_stopFlag = false;
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        if (0 != startNewThread(d_workers_p + i)) {
+            stopThreads();
+            return -1;                                                // RETURN
+        }
+    }
+
+    d_enabled = true;
+
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        d_enabled = false;
+        drainImp();
+        stopThreads();
+    }
+}
+
+// ACCESSORS
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    int numPending = d_numShared.loadAcquire();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        numPending += d_workers_p[i].d_deque.numElements();
+    }
+
+    return numPending;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,822 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size thread pool that balances load by stealing.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size pool with per-thread job deques
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that is designed for large numbers of
+// small jobs, and in particular for "fork/join" computations in which running
+// jobs enqueue further jobs.  Each thread in the pool owns a double-ended
+// queue ("deque") of pending jobs.  A job enqueued by a job that is running in
+// the pool is pushed onto the deque of the thread running it, without any
+// locking, and each thread takes jobs from the back of its own deque, so the
+// most recently enqueued (and typically cache-hot) job runs first.  A thread
+// whose deque is empty takes jobs from the front of the deque of another,
+// randomly chosen, thread (it "steals" them).  Jobs enqueued by threads that
+// do not belong to the pool are placed on a single shared queue, guarded by a
+// mutex, from which idle pool threads take them.
+//
+// By contrast, 'bdlmt::ThreadPool' and 'bdlmt::FixedThreadPool' hand every
+// job to their threads through a single queue, which all enqueuing and
+// processing threads contend on.  For coarse-grained jobs that contention is
+// negligible, and those pools additionally offer dynamic sizing and bounded
+// capacity, respectively.  'bdlmt::WorkStealingThreadPool' is preferable when
+// jobs are short and are mostly created by other jobs.
+//
+///Job Ordering
+///------------
+// No ordering is guaranteed between jobs.  In particular, jobs enqueued by the
+// same job are generally executed in the reverse of the order in which they
+// were enqueued, unless other threads steal them.
+//
+///Idle Threads
+///------------
+// A thread that finds no job in its own deque first checks the shared queue,
+// then attempts to steal from every other thread, yielding the processor
+// between rounds of attempts.  After a bounded number of unsuccessful rounds
+// the thread blocks on a condition variable until a job is enqueued, so an
+// idle pool does not consume CPU.
+//
+///Enabling and Disabling
+///----------------------
+// Enqueuing jobs from threads that do not belong to the pool is disabled until
+// 'start' is called, and after 'disable', 'stop', or 'shutdown' is called.
+// Jobs that are running in the pool can always enqueue further jobs, so that a
+// fork/join computation that is in progress when 'stop' is called completes
+// before 'stop' returns.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with 'bdlmt::FixedThreadPool', the threads of the pool block all
+// asynchronous signals on Unix platforms.
+//
+///Thread Names for Sub-Threads
+///----------------------------
+// To facilitate debugging, users can provide a thread name as the
+// 'threadName' attribute of the 'bslmt::ThreadAttributes' argument passed to
+// the constructor, that will be used for all the sub-threads.  If no
+// 'ThreadAttributes' object is passed, or if the 'threadName' attribute is not
+// set, the default value "bdl.WSPool" will be used.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Recursive Summation
+///- - - - - - - - - - - - - - - - - - - -
+// In this example we sum the elements of a large array by recursively
+// splitting it into halves, enqueuing a job for each half, until the ranges
+// are small enough to be summed directly.  Each job that splits a range
+// enqueues its two halves from within the pool, so the halves are pushed onto
+// the deque of the thread that split the range, and idle threads steal them.
+//
+// First, we define the job, which holds the range to sum, the pool, and the
+// location of the (shared) result:
+//..
+//  struct SumJob {
+//      // DATA
+//      const int                     *d_begin_p;
+//      const int                     *d_end_p;
+//      bdlmt::WorkStealingThreadPool *d_pool_p;
+//      bsls::AtomicInt64             *d_sum_p;
+//
+//      // ACCESSORS
+//      void operator()() const
+//      {
+//          if (d_end_p - d_begin_p <= 1024) {
+//              bsls::Types::Int64 sum = 0;
+//              for (const int *p = d_begin_p; p != d_end_p; ++p) {
+//                  sum += *p;
+//              }
+//              d_sum_p->addRelaxed(sum);
+//              return;                                               // RETURN
+//          }
+//
+//          const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+//
+//          SumJob lower = { d_begin_p, middle,  d_pool_p, d_sum_p };
+//          SumJob upper = { middle,    d_end_p, d_pool_p, d_sum_p };
+//
+//          d_pool_p->enqueueJob(lower);
+//          d_pool_p->enqueueJob(upper);
+//      }
+//  };
+//..
+// Then, we create the data to sum, and a pool with four threads:
+//..
+//  bsl::vector<int> data(1000000);
+//  for (bsl::size_t i = 0; i < data.size(); ++i) {
+//      data[i] = static_cast<int>(i % 100);
+//  }
+//
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we enqueue a single job for the whole range:
+//..
+//  bsls::AtomicInt64 sum(0);
+//
+//  SumJob job = { data.data(), data.data() + data.size(), &pool, &sum };
+//  rc = pool.enqueueJob(job);
+//  assert(0 == rc);
+//..
+// Finally, we wait for the job, and all of the jobs it transitively enqueued,
+// to complete, and verify the result:
+//..
+//  pool.drain();
+//  assert(49500000 == sum);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+                     // ==================================
+                     // class WorkStealingThreadPool_Deque
+                     // ==================================
+
+class WorkStealingThreadPool_Deque {
+    // This component-private class provides a fixed-capacity, lock-free
+    // "Chase-Lev" deque of pointers to jobs.  A single "owner" thread may
+    // call 'push' and 'pop', which operate on the back of the deque, and any
+    // thread may concurrently call 'steal', which operates on the front.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE -
+                                                     sizeof(bsls::AtomicInt64)
+    };
+
+    // DATA
+    bsls::AtomicInt64        d_top;          // index of the front element
+
+    const char               d_topPad[k_PADDING];
+                                             // padding to keep 'd_top' and
+                                             // 'd_bottom' on separate cache
+                                             // lines
+
+    bsls::AtomicInt64        d_bottom;       // index one past the back
+                                             // element
+
+    const char               d_bottomPad[k_PADDING];
+                                             // padding to keep 'd_bottom'
+                                             // and the read-mostly members on
+                                             // separate cache lines
+
+    bsls::AtomicPointer<Job> *d_buffer_p;    // circular buffer of elements
+
+    const bsls::Types::Int64  d_mask;        // capacity - 1
+
+    bslma::Allocator         *d_allocator_p; // memory allocator (held, not
+                                             // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                         const WorkStealingThreadPool_Deque&);
+
+  public:
+    // CREATORS
+    explicit
+    WorkStealingThreadPool_Deque(int               capacity,
+                                 bslma::Allocator *basicAllocator = 0);
+        // Create an empty deque that can hold the specified 'capacity' number
+        // of elements.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless 'capacity' is
+        // a positive power of two.
+
+    ~WorkStealingThreadPool_Deque();
+        // Destroy this object.  Note that the jobs referred to by any
+        // remaining elements are not destroyed.
+
+    // MANIPULATORS
+    Job *pop();
+        // Remove the element at the back of this deque and return it, or
+        // return 0 if this deque is empty.  The behavior is undefined unless
+        // this method is called by the owner thread.
+
+    bool push(Job *job);
+        // Append the specified 'job' to the back of this deque and return
+        // 'true' if this deque is not full, and return 'false' with no effect
+        // otherwise.  The behavior is undefined unless this method is called
+        // by the owner thread and 'job' is not 0.
+
+    Job *steal();
+        // Remove the element at the front of this deque and return it, or
+        // return 0 if this deque is empty or if the front element was
+        // concurrently removed by another thread.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of elements this deque can hold.
+
+    bool isEmpty() const;
+        // Return 'true' if this deque is empty, and 'false' otherwise.  Note
+        // that the returned value may be out of date by the time it is
+        // examined unless this method is called by the owner thread.
+
+    int numElements() const;
+        // Return a snapshot of the number of elements in this deque.
+};
+
+                     // ===================================
+                     // struct WorkStealingThreadPool_Worker
+                     // ===================================
+
+struct WorkStealingThreadPool_Worker {
+    // This component-private 'struct' holds the state associated with a
+    // single thread of a 'WorkStealingThreadPool'.  The counters are written
+    // only by the associated thread, and are read by 'drain' to detect that
+    // no job is pending or running.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE
+    };
+
+    // PUBLIC DATA
+    WorkStealingThreadPool_Deque d_deque;         // jobs enqueued by jobs
+                                                  // running on this thread
+
+    bsls::AtomicUint64           d_numEnqueued;   // number of jobs enqueued
+                                                  // by this thread
+
+    bsls::AtomicUint64           d_numCompleted;  // number of jobs executed
+                                                  // by this thread
+
+    unsigned int                 d_randomState;   // state of the generator
+                                                  // used to choose victims
+
+    const char                   d_pad[k_PADDING];
+                                                  // padding to keep adjacent
+                                                  // workers on separate cache
+                                                  // lines
+
+    // CREATORS
+    WorkStealingThreadPool_Worker(int               index,
+                                  int               dequeCapacity,
+                                  bslma::Allocator *basicAllocator);
+        // Create a worker having the specified 'index' within its pool, and
+        // an empty deque with the specified 'dequeCapacity', using the
+        // specified 'basicAllocator' to supply memory.
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a fixed-size thread pool in which each thread
+    // owns a deque of pending jobs and steals jobs from other threads when its
+    // own deque is empty.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS  =  0,  // the job was enqueued
+        e_DISABLED = -3,  // enqueuing is disabled
+        e_FAILED   = -4   // the job could not be enqueued
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    // PRIVATE CLASS DATA
+    static const char s_defaultThreadName[16];  // thread name to use when
+                                                // none is specified
+
+    // DATA
+    Worker                   *d_workers_p;       // array of 'd_numThreads'
+                                                 // workers
+
+    const int                 d_numThreads;      // number of configured
+                                                 // processing threads
+
+    bdlma::ConcurrentPool     d_jobPool;         // memory for 'Job' objects
+
+    bsl::deque<Job *>         d_sharedQueue;     // jobs enqueued by threads
+                                                 // outside the pool, and jobs
+                                                 // that overflowed a worker's
+                                                 // deque
+
+    bsls::AtomicInt           d_numShared;       // number of elements in
+                                                 // 'd_sharedQueue', readable
+                                                 // without locking
+
+    bsls::AtomicUint64        d_numSharedEnqueued;
+                                                 // number of jobs enqueued by
+                                                 // threads outside the pool
+
+    bsls::AtomicUint64        d_numCanceled;     // number of jobs destroyed
+                                                 // without being executed
+
+    bsls::AtomicInt           d_numSleeping;     // number of threads blocked,
+                                                 // or about to block, on
+                                                 // 'd_workCondition'
+
+    bsls::AtomicInt           d_numActiveThreads;
+                                                 // number of threads
+                                                 // processing jobs
+
+    bsls::AtomicBool          d_enabled;         // 'true' if threads outside
+                                                 // the pool may enqueue jobs
+
+    bsls::AtomicBool          d_stopFlag;        // set to make threads exit
+
+    int                       d_numDrainWaiters; // number of threads blocked
+                                                 // in 'drain' (guarded by
+                                                 // 'd_mutex')
+
+    bslmt::Mutex              d_mutex;           // guards 'd_sharedQueue' and
+                                                 // the conditions
+
+    bslmt::Condition          d_workCondition;   // signaled when a job is
+                                                 // enqueued
+
+    bslmt::Condition          d_idleCondition;   // signaled when a thread
+                                                 // runs out of jobs
+
+    bslmt::Mutex              d_metaMutex;       // ensures that there is only
+                                                 // one controlling thread at
+                                                 // any time
+
+    bslmt::ThreadUtil::Key    d_workerKey;       // thread-specific key holding
+                                                 // the address of the
+                                                 // 'Worker' of a pool thread
+
+    bslmt::ThreadGroup        d_threadGroup;     // threads used by this pool
+
+    bslmt::ThreadAttributes   d_threadAttributes;
+                                                 // thread attributes to be
+                                                 // used when constructing
+                                                 // processing threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                  d_blockSet;        // set of signals to be
+                                                 // blocked in managed threads
+#endif
+
+    bslma::Allocator         *d_allocator_p;     // memory allocator (held,
+                                                 // not owned)
+
+    // PRIVATE MANIPULATORS
+    Job *createJob(const Job& functor);
+    Job *createJob(bslmf::MovableRef<Job> functor);
+        // Return the address of a new job, allocated from 'd_jobPool', that
+        // holds a copy of (or the moved-from value of) the specified
+        // 'functor'.
+
+    void destroyJob(Job *job);
+        // Destroy the specified 'job' and return its memory to 'd_jobPool'.
+
+    void drainImp();
+        // Block until no job is pending or running.  The behavior is
+        // undefined unless 'd_metaMutex' is locked and the pool is started.
+
+    int enqueueImp(Job *job);
+        // Enqueue the specified 'job', taking ownership of it.  Return 0 on
+        // success, and a non-zero value (with no effect) otherwise.
+
+    Job *findJob(Worker *worker);
+        // Return a job taken from the shared queue or stolen from another
+        // thread by the thread associated with the specified 'worker',
+        // spinning for a bounded period if none is available, and return 0 if
+        // no job was found or the pool is stopping.
+
+    void initialize();
+        // Perform the construction steps common to all constructors.
+
+    void pushShared(Job *job);
+        // Append the specified 'job' to 'd_sharedQueue', taking ownership of
+        // it, and wake a sleeping thread if there is one.
+
+    void removeAll();
+        // Destroy all pending jobs without executing them.  The behavior is
+        // undefined unless no thread of this pool is running.
+
+    void runJob(Worker *worker, Job *job);
+        // Execute and then destroy the specified 'job' on the thread
+        // associated with the specified 'worker'.
+
+    int startNewThread(Worker *worker);
+        // Spawn a processing thread associated with the specified 'worker'.
+        // Return 0 on success, and a non-zero value otherwise.  The behavior
+        // is undefined unless 'd_metaMutex' is locked.
+
+    void stopThreads();
+        // Make all processing threads exit once they are not running a job,
+        // and join them.  The behavior is undefined unless 'd_metaMutex' is
+        // locked.
+
+    Job *stealJob(Worker *worker);
+        // Attempt to steal a job from each other thread in turn, starting
+        // from a randomly chosen one, on behalf of the thread associated with
+        // the specified 'worker'.  Return the stolen job, or 0 if none was
+        // stolen.
+
+    Job *takeShared();
+        // Remove the job at the front of 'd_sharedQueue' and return it, or
+        // return 0 if 'd_sharedQueue' is empty.
+
+    void waitForJob();
+        // Block the calling processing thread until a job may be available or
+        // the pool is stopping.
+
+    void workerThread(Worker *worker);
+        // The main function executed by the processing thread associated
+        // with the specified 'worker'.
+
+    // PRIVATE ACCESSORS
+    bool hasPendingJob() const;
+        // Return 'true' if a job is available in any deque or in the shared
+        // queue, and 'false' otherwise.  The behavior is undefined unless
+        // 'd_mutex' is locked.
+
+    bool isQuiescent() const;
+        // Return 'true' if, at some instant during this call, no job was
+        // pending or running, and 'false' otherwise.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create a thread pool with the specified 'numThreads' number of
+        // threads.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numThreads'.  Note that no thread is started until 'start' is
+        // called.
+
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Create a thread pool with the specified 'threadAttributes' and
+        // 'numThreads' number of threads.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numThreads'.
+
+    ~WorkStealingThreadPool();
+        // Destroy all pending jobs without executing them, block until all
+        // currently running jobs complete, and then destroy this thread pool.
+
+    // MANIPULATORS
+    void disable();
+        // Disable enqueuing jobs from threads that do not belong to this
+        // pool.  All subsequent invocations of 'enqueueJob' from such threads
+        // will fail.  Note that jobs running in this pool can still enqueue
+        // jobs.
+
+    void enable();
+        // Enable enqueuing jobs from threads that do not belong to this pool.
+        // If this pool is already enabled, this method has no effect.  Note
+        // that enqueued jobs are not executed until 'start' is called.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a thread of this
+        // pool.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' on success, 'e_DISABLED' if the
+        // calling thread does not belong to this pool and '!isEnabled()', and
+        // 'e_FAILED' if an error occurs.  If the calling thread belongs to
+        // this pool, the job is pushed onto that thread's own deque.  The
+        // behavior is undefined unless 'functor' is not null.
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a thread of this
+        // pool.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success, 'e_DISABLED' if the calling thread does not belong to this
+        // pool and '!isEnabled()', and 'e_FAILED' if an error occurs.  The
+        // behavior is undefined unless 'function' is not null.
+
+    void drain();
+        // Block until no job is pending or running, including jobs enqueued
+        // by the jobs being waited for, without disabling this pool.  If the
+        // pool was not already started ('isStarted()' is 'false'), this method
+        // has no effect.  Note that if jobs are enqueued from outside the pool
+        // concurrently with this method, this method may or may not wait
+        // until they have also completed, and may wait indefinitely.  The
+        // behavior is undefined if this method is called by a job running in
+        // this pool.
+
+    void shutdown();
+        // Disable enqueuing jobs from threads that do not belong to this
+        // pool, wait until all running jobs complete, destroy all pending
+        // jobs without executing them, and join all processing threads.  If
+        // the pool was not already started ('isStarted()' is 'false'), this
+        // method has no effect.  At the completion of this method,
+        // 'false == isStarted()'.  The behavior is undefined if this method
+        // is called by a job running in this pool.
+
+    int start();
+        // Spawn 'numThreads()' processing threads.  On success, enable
+        // enqueuing and return 0.  Otherwise, join all threads (ensuring
+        // 'false == isStarted()') and return -1.  If the thread pool was
+        // already started ('isStarted()' is 'true'), this method has no
+        // effect.
+
+    void stop();
+        // Disable enqueuing jobs from threads that do not belong to this
+        // pool, wait until all pending and running jobs complete (see
+        // 'drain'), and join all processing threads.  If the pool was not
+        // already started ('isStarted()' is 'false'), this method has no
+        // effect.  At the completion of this method, 'false == isStarted()'.
+        // The behavior is undefined if this method is called by a job running
+        // in this pool.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if threads that do not belong to this pool can
+        // enqueue jobs, and 'false' otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if 'numThreads()' are started on this thread pool,
+        // and 'false' otherwise (indicating that 0 threads are started).
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads that are currently
+        // processing a job for this thread pool.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs currently enqueued to be
+        // processed by this thread pool.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads currently started by
+        // this thread pool.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                     // ----------------------------------
+                     // class WorkStealingThreadPool_Deque
+                     // ----------------------------------
+
+// MANIPULATORS
+inline
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::pop()
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+
+    // The sequentially consistent store of 'd_bottom' followed by the load of
+    // 'd_top' orders this reservation against a concurrent 'steal'.
+
+    d_bottom = bottom;
+
+    bsls::Types::Int64 top = d_top;
+
+    if (top > bottom) {
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_buffer_p[bottom & d_mask].loadRelaxed();
+
+    if (top == bottom) {
+        // This is the last element; race any thief for it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            job = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+
+    return job;
+}
+
+inline
+bool WorkStealingThreadPool_Deque::push(Job *job)
+{
+    BSLS_ASSERT(job);
+
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+
+    if (bottom - top > d_mask) {
+        return false;                                                 // RETURN
+    }
+
+    d_buffer_p[bottom & d_mask].storeRelaxed(job);
+
+    // A sequentially consistent store (rather than a release store) is used
+    // so that a thread about to sleep, which checks the deque after
+    // announcing itself, and the owner, which checks for sleeping threads
+    // after pushing, cannot both miss each other.
+
+    d_bottom = bottom + 1;
+
+    return true;
+}
+
+inline
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::steal()
+{
+    bsls::Types::Int64       top    = d_top;
+    const bsls::Types::Int64 bottom = d_bottom;
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_buffer_p[top & d_mask].loadRelaxed();
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    return job;
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool_Deque::capacity() const
+{
+    return static_cast<int>(d_mask + 1);
+}
+
+inline
+bool WorkStealingThreadPool_Deque::isEmpty() const
+{
+    return d_top >= d_bottom;
+}
+
+inline
+int WorkStealingThreadPool_Deque::numElements() const
+{
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+    const bsls::Types::Int64 bottom = d_bottom.loadAcquire();
+
+    return bottom > top ? static_cast<int>(bottom - top) : 0;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabled = false;
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_enabled = true;
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    return enqueueImp(createJob(functor));
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    return enqueueImp(createJob(bslmf::MovableRefUtil::move(functor)));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return d_enabled;
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveThreads.loadAcquire();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *WorkStealingThreadPool::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1251 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_testutil.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// A work-stealing thread pool dispatches jobs onto a fixed number of threads,
+// each of which owns a lock-free deque of jobs.  We first test the
+// component-private deque on its own, single-threaded and then with one owner
+// and several concurrent thieves, verifying that each element is removed
+// exactly once.  We then test that the pool can be started, stopped, drained
+// and shut down, that jobs enqueued from outside the pool and from jobs
+// running in the pool are all executed, that 'drain' waits for jobs enqueued
+// by the jobs it is waiting for, that overflowing a thread's deque is
+// handled, and that 'shutdown' destroys pending jobs without running them.
+//
+// In addition to positive test cases, a negative test case -1 can be run
+// manually to compare the throughput of a fork/join computation on this pool
+// with 'bdlmt::FixedThreadPool' and 'bdlmt::ThreadPool'.
+// ----------------------------------------------------------------------------
+// WorkStealingThreadPool_Deque
+// [ 2] WorkStealingThreadPool_Deque(int capacity, bslma::Allocator *);
+// [ 2] Job *pop();
+// [ 2] bool push(Job *job);
+// [ 2] Job *steal();
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 2] int numElements() const;
+//
+// WorkStealingThreadPool
+// [ 4] WorkStealingThreadPool(int, bslma::Allocator *);
+// [ 4] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 4] ~WorkStealingThreadPool();
+// [ 4] void disable();
+// [ 4] void enable();
+// [ 4] int enqueueJob(const Job& functor);
+// [ 4] int enqueueJob(bslmf::MovableRef<Job> functor);
+// [ 4] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 4] void drain();
+// [ 6] void shutdown();
+// [ 4] int start();
+// [ 4] void stop();
+// [ 4] bool isEnabled() const;
+// [ 4] bool isStarted() const;
+// [ 6] int numActiveThreads() const;
+// [ 6] int numPendingJobs() const;
+// [ 4] int numThreads() const;
+// [ 4] int numThreadsStarted() const;
+// [ 4] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: CONCURRENT 'pop' AND 'steal' ON A DEQUE
+// [ 5] CONCERN: JOBS ENQUEUING JOBS (FORK/JOIN)
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: FORK/JOIN THROUGHPUT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT                   BSLMT_TESTUTIL_ASSERT
+#define ASSERTV                  BSLMT_TESTUTIL_ASSERTV
+
+#define GUARD                    BSLMT_TESTUTIL_GUARD
+
+#define Q                        BSLMT_TESTUTIL_Q
+#define P                        BSLMT_TESTUTIL_P
+#define P_                       BSLMT_TESTUTIL_P_
+#define T_                       BSLMT_TESTUTIL_T_
+#define L_                       BSLMT_TESTUTIL_L_
+
+#define GUARDED_STREAM(STREAM)   BSLMT_TESTUTIL_GUARDED_STREAM(STREAM)
+#define COUT                     BSLMT_TESTUTIL_COUT
+#define CERR                     BSLMT_TESTUTIL_CERR
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+typedef bsl::function<void()>               Job;
+
+// ============================================================================
+//                           GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+int test;
+int verbose;
+int veryVerbose;
+int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void incrementC(void *counter)
+    // Increment the 'bsls::AtomicInt' at the specified 'counter' address.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitOnSemaphore(bslmt::Semaphore *start,
+                     bslmt::Semaphore *finish,
+                     bsls::AtomicInt  *counter)
+    // Post to the specified 'start' semaphore, wait on the specified 'finish'
+    // semaphore, and then increment the specified 'counter'.
+{
+    start->post();
+    finish->wait();
+    ++*counter;
+}
+
+void postAfterDelay(bslmt::Semaphore *semaphore, int count)
+    // Sleep for 100 milliseconds, then post the specified 'count' times to
+    // the specified 'semaphore'.
+{
+    bslmt::ThreadUtil::microSleep(100000);
+    semaphore->post(count);
+}
+
+void enqueueFromPool(Obj *pool, bsls::AtomicInt *counter, int *rc)
+    // Enqueue a job incrementing the specified 'counter' on the specified
+    // 'pool', and load the result into the specified 'rc'.
+{
+    *rc = pool->enqueueJob(bdlf::BindUtil::bind(&increment, counter));
+}
+
+void spawnMany(Obj *pool, bsls::AtomicInt *counter, int numJobs)
+    // Enqueue the specified 'numJobs' jobs, each incrementing the specified
+    // 'counter', on the specified 'pool'.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        int rc = pool->enqueueJob(bdlf::BindUtil::bind(&increment, counter));
+        ASSERTV(i, rc, 0 == rc);
+    }
+}
+
+                              // =============
+                              // struct FibJob
+                              // =============
+
+template <class POOL>
+struct FibJob {
+    // This 'struct' computes the 'd_n'th Fibonacci number by recursively
+    // enqueuing a job for each of the two previous ones, adding 'd_n' to
+    // '*d_sum_p' if 'd_n < 2'.  If 'd_latch_p' is not 0, each job arrives on
+    // it when complete.
+
+    // DATA
+    POOL              *d_pool_p;
+    int                d_n;
+    bsls::AtomicInt64 *d_sum_p;
+    bslmt::Latch      *d_latch_p;
+
+    // ACCESSORS
+    void operator()() const
+    {
+        if (d_n < 2) {
+            d_sum_p->addRelaxed(d_n);
+        }
+        else {
+            FibJob lower = { d_pool_p, d_n - 2, d_sum_p, d_latch_p };
+            FibJob upper = { d_pool_p, d_n - 1, d_sum_p, d_latch_p };
+
+            int rc = d_pool_p->enqueueJob(lower);
+            ASSERTV(rc, 0 == rc);
+            rc = d_pool_p->enqueueJob(upper);
+            ASSERTV(rc, 0 == rc);
+        }
+        if (d_latch_p) {
+            d_latch_p->arrive();
+        }
+    }
+};
+
+bsls::Types::Int64 fibonacci(int n)
+    // Return the specified 'n'th Fibonacci number.
+{
+    bsls::Types::Int64 a = 0;
+    bsls::Types::Int64 b = 1;
+
+    for (int i = 0; i < n; ++i) {
+        bsls::Types::Int64 c = a + b;
+        a = b;
+        b = c;
+    }
+    return a;
+}
+
+int numFibJobs(int n)
+    // Return the number of jobs executed by 'FibJob' for the specified 'n'.
+{
+    // T(n) = 1 + T(n - 1) + T(n - 2), T(0) = T(1) = 1
+
+    int a = 1;
+    int b = 1;
+
+    for (int i = 1; i < n; ++i) {
+        int c = 1 + a + b;
+        a = b;
+        b = c;
+    }
+    return b;
+}
+
+void ownerThread(Deque                   *deque,
+                 Job                     *jobs,
+                 int                      numJobs,
+                 bsl::vector<int>        *taken,
+                 bsls::AtomicInt         *done)
+    // Push the specified 'numJobs' elements of the specified 'jobs' array
+    // onto the specified 'deque', popping one element after every third push,
+    // then pop the remaining elements, and increment the element of the
+    // specified 'taken' vector corresponding to each popped job.  Set the
+    // specified 'done' flag when finished.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        while (!deque->push(jobs + i)) {
+            Job *job = deque->pop();
+            if (job) {
+                ++(*taken)[job - jobs];
+            }
+        }
+        if (2 == i % 3) {
+            Job *job = deque->pop();
+            if (job) {
+                ++(*taken)[job - jobs];
+            }
+        }
+    }
+    while (Job *job = deque->pop()) {
+        ++(*taken)[job - jobs];
+    }
+    *done = 1;
+}
+
+void thiefThread(Deque            *deque,
+                 Job              *jobs,
+                 bsl::vector<int> *taken,
+                 bsls::AtomicInt  *done)
+    // Steal elements from the specified 'deque' until the specified 'done'
+    // flag is set and 'deque' is empty, and increment the element of the
+    // specified 'taken' vector corresponding to each stolen element of the
+    // specified 'jobs' array.
+{
+    while (!*done || !deque->isEmpty()) {
+        Job *job = deque->steal();
+        if (job) {
+            ++(*taken)[job - jobs];
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Recursive Summation
+///- - - - - - - - - - - - - - - - - - - -
+// In this example we sum the elements of a large array by recursively
+// splitting it into halves, enqueuing a job for each half, until the ranges
+// are small enough to be summed directly.  Each job that splits a range
+// enqueues its two halves from within the pool, so the halves are pushed onto
+// the deque of the thread that split the range, and idle threads steal them.
+//
+// First, we define the job, which holds the range to sum, the pool, and the
+// location of the (shared) result:
+//..
+    struct SumJob {
+        // DATA
+        const int                     *d_begin_p;
+        const int                     *d_end_p;
+        bdlmt::WorkStealingThreadPool *d_pool_p;
+        bsls::AtomicInt64             *d_sum_p;
+
+        // ACCESSORS
+        void operator()() const
+        {
+            if (d_end_p - d_begin_p <= 1024) {
+                bsls::Types::Int64 sum = 0;
+                for (const int *p = d_begin_p; p != d_end_p; ++p) {
+                    sum += *p;
+                }
+                d_sum_p->addRelaxed(sum);
+                return;                                               // RETURN
+            }
+
+            const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+
+            SumJob lower = { d_begin_p, middle,  d_pool_p, d_sum_p };
+            SumJob upper = { middle,    d_end_p, d_pool_p, d_sum_p };
+
+            d_pool_p->enqueueJob(lower);
+            d_pool_p->enqueueJob(upper);
+        }
+    };
+//..
+
+}  // close namespace USAGE_EXAMPLE_1
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2 ? (atoi(argv[2]) ? atoi(argv[2]) : 1) : 0;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE_1;
+
+// Then, we create the data to sum, and a pool with four threads:
+//..
+    bsl::vector<int> data(1000000);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>(i % 100);
+    }
+
+    bdlmt::WorkStealingThreadPool pool(4);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we enqueue a single job for the whole range:
+//..
+    bsls::AtomicInt64 sum(0);
+
+    SumJob job = { data.data(), data.data() + data.size(), &pool, &sum };
+    rc = pool.enqueueJob(job);
+    ASSERT(0 == rc);
+//..
+// Finally, we wait for the job, and all of the jobs it transitively enqueued,
+// to complete, and verify the result:
+//..
+    pool.drain();
+    ASSERT(49500000 == sum);
+
+    pool.stop();
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'shutdown' AND THE DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 'shutdown' waits for running jobs to complete, destroys pending
+        //:   jobs without executing them, and joins all threads.
+        //:
+        //: 2 Pending jobs are reported by 'numPendingJobs', and running jobs
+        //:   by 'numActiveThreads'.
+        //:
+        //: 3 A pool can be restarted after 'shutdown', and 'drain' works
+        //:   after a restart.
+        //:
+        //: 4 The destructor destroys jobs enqueued while the pool was enabled
+        //:   but not started.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Occupy every thread with a job that blocks on a semaphore, then
+        //:   enqueue more jobs and verify 'numPendingJobs' and
+        //:   'numActiveThreads'.  From another thread, release the blocked
+        //:   jobs after a delay, call 'shutdown', and verify that none of the
+        //:   pending jobs ran.  (C-1..2)
+        //:
+        //: 2 Restart the pool, enqueue jobs, and 'drain'.  (C-3)
+        //:
+        //: 3 Enable a pool without starting it, enqueue jobs, and destroy it.
+        //:   (C-4)
+        //:
+        //: 4 Use a test allocator and verify that all memory is returned.
+        //:   (C-5)
+        //
+        // Testing:
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'shutdown' AND THE DESTRUCTOR" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int NUM_THREADS = 3;
+        const int NUM_PENDING = 50;
+
+        {
+            Obj mX(NUM_THREADS, &oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            bslmt::Semaphore started;
+            bslmt::Semaphore finish;
+            bsls::AtomicInt  numBlocked(0);
+            bsls::AtomicInt  numPending(0);
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                              &waitOnSemaphore,
+                                                              &started,
+                                                              &finish,
+                                                              &numBlocked)));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                started.wait();
+            }
+
+            for (int i = 0; i < NUM_PENDING; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &numPending)));
+            }
+
+            ASSERTV(X.numPendingJobs(),   NUM_PENDING == X.numPendingJobs());
+            ASSERTV(X.numActiveThreads(),
+                    NUM_THREADS == X.numActiveThreads());
+
+            // Release the blocked jobs from another thread after a delay, so
+            // that 'shutdown' (below) has set the stop flag by the time they
+            // return.
+
+            bslmt::ThreadGroup releaser;
+            ASSERT(0 == releaser.addThread(bdlf::BindUtil::bind(
+                                                             &postAfterDelay,
+                                                             &finish,
+                                                             NUM_THREADS)));
+
+            mX.shutdown();
+
+            ASSERT(!X.isStarted());
+            ASSERT(!X.isEnabled());
+            ASSERT(0 == X.numThreadsStarted());
+            ASSERT(0 == X.numPendingJobs());
+            ASSERT(0 == X.numActiveThreads());
+            ASSERTV(numBlocked, NUM_THREADS == numBlocked);
+            ASSERTV(numPending, 0 == numPending);
+
+            releaser.joinAll();
+
+            ASSERT(0 == mX.start());
+
+            for (int i = 0; i < NUM_PENDING; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &numPending)));
+            }
+            mX.drain();
+            ASSERTV(numPending, NUM_PENDING == numPending);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        {
+            bsls::AtomicInt numRun(0);
+            {
+                Obj mX(NUM_THREADS, &oa);
+
+                mX.enable();
+                for (int i = 0; i < NUM_PENDING; ++i) {
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                                   &numRun)));
+                }
+                ASSERT(NUM_PENDING == mX.numPendingJobs());
+            }
+            ASSERT(0 == numRun);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: JOBS ENQUEUING JOBS (FORK/JOIN)
+        //
+        // Concerns:
+        //: 1 Jobs enqueued by jobs running in the pool are executed, and
+        //:   'drain' waits for them, transitively.
+        //:
+        //: 2 A job can enqueue more jobs than its thread's deque can hold.
+        //:
+        //: 3 Jobs running in the pool can enqueue jobs while the pool is
+        //:   disabled, and 'stop' waits for them.
+        //:
+        //: 4 The pool works with a single thread.
+        //
+        // Plan:
+        //: 1 For pools of 1, 2, and 4 threads, compute Fibonacci numbers by
+        //:   recursively enqueuing jobs, 'drain', and verify the result.
+        //:   (C-1, 4)
+        //:
+        //: 2 Enqueue a job that enqueues 10000 jobs (more than the capacity
+        //:   of a deque), 'drain', and verify that all ran.  (C-2)
+        //:
+        //: 3 Disable the pool, run a job that enqueues a job, and verify that
+        //:   the nested enqueue succeeds while an external one fails.  Start
+        //:   a Fibonacci computation and immediately call 'stop', and verify
+        //:   the result.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: JOBS ENQUEUING JOBS (FORK/JOIN)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: JOBS ENQUEUING JOBS (FORK/JOIN)" << endl
+                         << "========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int THREADS[] = { 1, 2, 4 };
+        const int NUM_THREADS = sizeof THREADS / sizeof *THREADS;
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int NT = THREADS[ti];
+
+            if (veryVerbose) { T_ P(NT); }
+
+            Obj mX(NT, &oa);
+
+            ASSERT(0 == mX.start());
+
+            for (int n = 0; n <= 20; n += 5) {
+                bsls::AtomicInt64 sum(0);
+
+                FibJob<Obj> job = { &mX, n, &sum, 0 };
+                ASSERT(0 == mX.enqueueJob(job));
+
+                mX.drain();
+
+                ASSERTV(NT, n, sum, fibonacci(n) == sum);
+            }
+
+            bsls::AtomicInt counter(0);
+            const int       NUM_SPAWNED = 10000;
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&spawnMany,
+                                                           &mX,
+                                                           &counter,
+                                                           NUM_SPAWNED)));
+            mX.drain();
+            ASSERTV(NT, counter, NUM_SPAWNED == counter);
+
+            mX.disable();
+
+            counter = 0;
+            int rc  = -1;
+            ASSERT(Obj::e_DISABLED == mX.enqueueJob(
+                                bdlf::BindUtil::bind(&enqueueFromPool,
+                                                     &mX,
+                                                     &counter,
+                                                     &rc)));
+
+            mX.enable();
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&enqueueFromPool,
+                                                           &mX,
+                                                           &counter,
+                                                           &rc)));
+            mX.disable();
+            mX.drain();
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(counter, 1 == counter);
+
+            mX.enable();
+
+            bsls::AtomicInt64 sum(0);
+
+            FibJob<Obj> job = { &mX, 18, &sum, 0 };
+            ASSERT(0 == mX.enqueueJob(job));
+
+            mX.stop();
+
+            ASSERTV(NT, sum, fibonacci(18) == sum);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'start', 'stop', 'drain', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A pool is created with the specified number of threads, not
+        //:   started, and not enabled.
+        //:
+        //: 2 'start' starts the threads and enables the pool, and is a no-op
+        //:   if the pool is already started.
+        //:
+        //: 3 Jobs enqueued from outside the pool are executed, through each
+        //:   'enqueueJob' overload.
+        //:
+        //: 4 'enqueueJob' from outside the pool fails with 'e_DISABLED' when
+        //:   the pool is disabled, and 'enable' and 'disable' toggle
+        //:   'isEnabled'.
+        //:
+        //: 5 'stop' runs all pending jobs, disables the pool, and joins the
+        //:   threads; 'drain', 'stop', and 'shutdown' have no effect on a pool
+        //:   that is not started.
+        //:
+        //: 6 All memory is supplied by the specified allocator, and the
+        //:   default allocator is used if none is specified.
+        //:
+        //: 7 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create pools with each constructor, verify their state, start,
+        //:   enqueue jobs with each overload from several threads, drain, and
+        //:   verify the jobs' effects.  (C-1..4)
+        //:
+        //: 2 Call 'stop', and verify the state and that all jobs ran.  Call
+        //:   each of 'drain', 'stop', and 'shutdown' on a stopped pool.  (C-5)
+        //:
+        //: 3 Use test allocators to verify memory use.  (C-6)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int, bslma::Allocator *);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   ~WorkStealingThreadPool();
+        //   void disable();
+        //   void enable();
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(bslmf::MovableRef<Job> functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   void drain();
+        //   int start();
+        //   void stop();
+        //   bool isEnabled() const;
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+              << "TESTING CREATORS, 'start', 'stop', 'drain', AND ACCESSORS"
+              << endl
+              << "=========================================================="
+              << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int NUM_JOBS = 1000;
+
+        for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+            if (veryVerbose) { T_ P(cfg); }
+
+            bslmt::ThreadAttributes attributes;
+            attributes.setThreadName("wsTest");
+
+            Obj *objPtr = 0;
+            switch (cfg) {
+              case 'a': {
+                objPtr = new (oa) Obj(3, &oa);
+              } break;
+              case 'b': {
+                objPtr = new (oa) Obj(attributes, 3, &oa);
+              } break;
+              case 'c': {
+                objPtr = new (oa) Obj(3);
+              } break;
+            }
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            bslma::TestAllocator& usedAllocator = 'c' == cfg
+                                                ? defaultAllocator
+                                                : oa;
+
+            ASSERT(&usedAllocator == X.allocator());
+            ASSERT(3 == X.numThreads());
+            ASSERT(!X.isStarted());
+            ASSERT(!X.isEnabled());
+            ASSERT(0 == X.numThreadsStarted());
+            ASSERT(0 == X.numPendingJobs());
+            ASSERT(0 == X.numActiveThreads());
+
+            bsls::AtomicInt counter(0);
+
+            ASSERT(Obj::e_DISABLED == mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&increment, &counter)));
+
+            mX.drain();
+            mX.stop();
+            mX.shutdown();
+            ASSERT(!X.isStarted());
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.start());
+            ASSERT(X.isStarted());
+            ASSERT(X.isEnabled());
+            ASSERT(3 == X.numThreadsStarted());
+
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                switch (i % 3) {
+                  case 0: {
+                    const Job job = bdlf::BindUtil::bind(&increment,
+                                                         &counter);
+                    ASSERT(0 == mX.enqueueJob(job));
+                  } break;
+                  case 1: {
+                    Job job = bdlf::BindUtil::bind(&increment, &counter);
+                    ASSERT(0 == mX.enqueueJob(
+                                          bslmf::MovableRefUtil::move(job)));
+                  } break;
+                  case 2: {
+                    ASSERT(0 == mX.enqueueJob(&incrementC, &counter));
+                  } break;
+                }
+            }
+            mX.drain();
+            ASSERTV(counter, NUM_JOBS == counter);
+            ASSERT(X.isStarted());
+            ASSERT(X.isEnabled());
+
+            mX.disable();
+            ASSERT(!X.isEnabled());
+            ASSERT(Obj::e_DISABLED == mX.enqueueJob(&incrementC, &counter));
+            mX.enable();
+            ASSERT(X.isEnabled());
+
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementC, &counter));
+            }
+            mX.stop();
+            ASSERTV(counter, 2 * NUM_JOBS == counter);
+            ASSERT(!X.isStarted());
+            ASSERT(!X.isEnabled());
+            ASSERT(0 == X.numThreadsStarted());
+
+            mX.drain();
+            mX.stop();
+            mX.shutdown();
+
+            ASSERT(0 < usedAllocator.numBlocksInUse());
+
+            oa.deleteObject(objPtr);
+
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(defaultAllocator.numBlocksInUse(),
+                    0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_OPT_FAIL(Obj(0, &oa));
+            ASSERT_OPT_PASS(Obj(1, &oa));
+
+            Obj mX(1, &oa);
+            ASSERT(0 == mX.start());
+
+            ASSERT_FAIL(mX.enqueueJob(Job()));
+            ASSERT_FAIL(mX.enqueueJob(0, 0));
+
+            bsls::AtomicInt counter(0);
+            ASSERT_PASS(mX.enqueueJob(&incrementC, &counter));
+            mX.stop();
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT 'pop' AND 'steal' ON A DEQUE
+        //
+        // Concerns:
+        //: 1 When one owner thread pushes and pops while other threads steal,
+        //:   every pushed element is removed exactly once, including when the
+        //:   deque is repeatedly full and empty.
+        //
+        // Plan:
+        //: 1 For several capacities and numbers of thieves, push a large
+        //:   number of distinct elements from an owner thread that also pops,
+        //:   while thief threads steal.  Record the number of times each
+        //:   element was removed in per-thread vectors, and verify that the
+        //:   sums are all one.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT 'pop' AND 'steal' ON A DEQUE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "CONCERN: CONCURRENT 'pop' AND 'steal' ON A DEQUE" << endl
+                 << "================================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int NUM_JOBS     = 100000;
+        const int CAPACITIES[] = { 1, 2, 16, 1024 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        bsl::vector<Job> jobs(NUM_JOBS);
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            for (int numThieves = 1; numThieves <= 3; ++numThieves) {
+                const int CAPACITY = CAPACITIES[ci];
+
+                if (veryVerbose) { T_ P_(CAPACITY); P(numThieves); }
+
+                Deque mX(CAPACITY, &oa);
+
+                bsl::vector<bsl::vector<int> > taken(
+                                           numThieves + 1,
+                                           bsl::vector<int>(NUM_JOBS, 0));
+                bsls::AtomicInt    done(0);
+                bslmt::ThreadGroup threads;
+
+                for (int i = 0; i < numThieves; ++i) {
+                    threads.addThread(bdlf::BindUtil::bind(&thiefThread,
+                                                           &mX,
+                                                           jobs.data(),
+                                                           &taken[i + 1],
+                                                           &done));
+                }
+                ownerThread(&mX, jobs.data(), NUM_JOBS, &taken[0], &done);
+                threads.joinAll();
+
+                ASSERT(mX.isEmpty());
+
+                for (int j = 0; j < NUM_JOBS; ++j) {
+                    int count = 0;
+                    for (int i = 0; i <= numThieves; ++i) {
+                        count += taken[i][j];
+                    }
+                    ASSERTV(CAPACITY, numThieves, j, count, 1 == count);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'WorkStealingThreadPool_Deque'
+        //
+        // Concerns:
+        //: 1 'push' appends to the back and fails, with no effect, when the
+        //:   deque is full.
+        //:
+        //: 2 'pop' removes from the back (LIFO) and 'steal' removes from the
+        //:   front (FIFO); both return 0 on an empty deque.
+        //:
+        //: 3 The deque works correctly as its indices wrap around its buffer.
+        //:
+        //: 4 'capacity', 'isEmpty', and 'numElements' report the state.
+        //:
+        //: 5 Memory is supplied by the specified allocator.
+        //:
+        //: 6 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several capacities, repeatedly fill the deque, verify that a
+        //:   further 'push' fails, and empty it alternately with 'pop' and
+        //:   'steal', verifying the order of the elements and the accessors.
+        //:   (C-1..4)
+        //:
+        //: 2 Use a test allocator.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   WorkStealingThreadPool_Deque(int capacity, bslma::Allocator *);
+        //   Job *pop();
+        //   bool push(Job *job);
+        //   Job *steal();
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        //   int numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'WorkStealingThreadPool_Deque'" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int CAPACITIES[] = { 1, 2, 4, 8, 64 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        Job jobs[64];
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            const int CAPACITY = CAPACITIES[ci];
+
+            if (veryVerbose) { T_ P(CAPACITY); }
+
+            {
+                Deque mX(CAPACITY, &oa);  const Deque& X = mX;
+
+                ASSERT(0 < oa.numBlocksInUse());
+                ASSERT(CAPACITY == X.capacity());
+                ASSERT(X.isEmpty());
+                ASSERT(0 == X.numElements());
+                ASSERT(0 == mX.pop());
+                ASSERT(0 == mX.steal());
+
+                for (int round = 0; round < 5; ++round) {
+                    for (int i = 0; i < CAPACITY; ++i) {
+                        ASSERTV(CAPACITY, round, i, mX.push(jobs + i));
+                        ASSERT(!X.isEmpty());
+                        ASSERT(i + 1 == X.numElements());
+                    }
+                    ASSERT(!mX.push(jobs + CAPACITY - 1));
+                    ASSERT(CAPACITY == X.numElements());
+
+                    if (round % 2) {
+                        for (int i = CAPACITY - 1; i >= 0; --i) {
+                            ASSERTV(CAPACITY, round, i, jobs + i == mX.pop());
+                        }
+                    }
+                    else {
+                        for (int i = 0; i < CAPACITY; ++i) {
+                            ASSERTV(CAPACITY, round, i,
+                                    jobs + i == mX.steal());
+                        }
+                    }
+                    ASSERT(X.isEmpty());
+                    ASSERT(0 == X.numElements());
+                    ASSERT(0 == mX.pop());
+                    ASSERT(0 == mX.steal());
+
+                    // Shift the indices so that later rounds wrap around.
+
+                    ASSERT(mX.push(jobs));
+                    ASSERT(jobs == mX.steal());
+                }
+
+                // Interleave 'pop' and 'steal'.
+
+                for (int i = 0; i < CAPACITY; ++i) {
+                    ASSERT(mX.push(jobs + i));
+                }
+                for (int i = 0; i < CAPACITY / 2; ++i) {
+                    ASSERTV(i, jobs + i == mX.steal());
+                    ASSERTV(i, jobs + CAPACITY - 1 - i == mX.pop());
+                }
+                if (CAPACITY % 2) {
+                    ASSERT(jobs + CAPACITY / 2 == mX.pop());
+                }
+                ASSERT(X.isEmpty());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Deque(0, &oa));
+            ASSERT_FAIL(Deque(3, &oa));
+            ASSERT_PASS(Deque(4, &oa));
+
+            Deque mX(4, &oa);
+            ASSERT_FAIL(mX.push(0));
+            ASSERT_PASS(mX.push(jobs));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue jobs from the main thread, and jobs that
+        //:   enqueue jobs, drain, verify the effects, and stop.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+
+            ASSERT(4 == X.numThreads());
+            ASSERT(0 == mX.start());
+            ASSERT(X.isStarted());
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &counter)));
+            }
+            mX.drain();
+            ASSERTV(counter, 100 == counter);
+
+            bsls::AtomicInt64 sum(0);
+            FibJob<Obj>       job = { &mX, 15, &sum, 0 };
+            ASSERT(0 == mX.enqueueJob(job));
+            mX.drain();
+            ASSERTV(sum, 610 == sum);
+
+            mX.stop();
+            ASSERT(!X.isStarted());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FORK/JOIN THROUGHPUT
+        //   Compare the time taken by a fine-grained fork/join computation on
+        //   'bdlmt::WorkStealingThreadPool', 'bdlmt::FixedThreadPool', and
+        //   'bdlmt::ThreadPool'.
+        //
+        // Concerns:
+        //: 1 Jobs that mostly enqueue other jobs are dispatched faster by the
+        //:   work-stealing pool than by pools with a single shared queue.
+        //
+        // Plan:
+        //: 1 Compute the Nth Fibonacci number (N given by the second
+        //:   command-line argument, 25 by default) by enqueuing a job for
+        //:   every recursive call, on each pool with 1, 2, 4, and 8 threads.
+        //:   Every job arrives on a latch that the main thread waits on, so
+        //:   all pools are measured the same way.  Report the elapsed time and
+        //:   the number of jobs per second.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: FORK/JOIN THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: FORK/JOIN THROUGHPUT" << endl
+                          << "=================================" << endl;
+
+        const int N        = verbose > 1 ? verbose : 25;
+        const int NUM_JOBS = numFibJobs(N);
+
+        cout << "fib(" << N << "): " << NUM_JOBS << " jobs" << endl;
+
+        const int THREADS[] = { 1, 2, 4, 8 };
+        const int NUM_THREADS = sizeof THREADS / sizeof *THREADS;
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int NT = THREADS[ti];
+
+            double times[3];
+
+            {
+                Obj mX(NT);
+                mX.start();
+
+                bsls::AtomicInt64 sum(0);
+                bslmt::Latch      latch(NUM_JOBS);
+                FibJob<Obj>       job = { &mX, N, &sum, &latch };
+
+                bsls::Stopwatch timer;
+                timer.start();
+                mX.enqueueJob(job);
+                latch.wait();
+                times[0] = timer.elapsedTime();
+
+                ASSERT(fibonacci(N) == sum);
+            }
+            {
+                typedef bdlmt::FixedThreadPool Pool;
+
+                Pool mX(NT, NUM_JOBS);
+                mX.start();
+
+                bsls::AtomicInt64 sum(0);
+                bslmt::Latch      latch(NUM_JOBS);
+                FibJob<Pool>      job = { &mX, N, &sum, &latch };
+
+                bsls::Stopwatch timer;
+                timer.start();
+                mX.enqueueJob(job);
+                latch.wait();
+                times[1] = timer.elapsedTime();
+
+                ASSERT(fibonacci(N) == sum);
+            }
+            {
+                typedef bdlmt::ThreadPool Pool;
+
+                bslmt::ThreadAttributes attributes;
+                Pool                    mX(attributes, NT, NT, 1000);
+                mX.start();
+
+                bsls::AtomicInt64 sum(0);
+                bslmt::Latch      latch(NUM_JOBS);
+                FibJob<Pool>      job = { &mX, N, &sum, &latch };
+
+                bsls::Stopwatch timer;
+                timer.start();
+                mX.enqueueJob(job);
+                latch.wait();
+                times[2] = timer.elapsedTime();
+
+                ASSERT(fibonacci(N) == sum);
+            }
+
+            cout << NT << " threads:"
+                 << "  WorkStealingThreadPool " << times[0] << "s ("
+                 << NUM_JOBS / times[0] << " jobs/s)"
+                 << "  FixedThreadPool " << times[1] << "s ("
+                 << NUM_JOBS / times[1] << " jobs/s)"
+                 << "  ThreadPool " << times[2] << "s ("
+                 << NUM_JOBS / times[2] << " jobs/s)" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == globalAllocator.numAllocations());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
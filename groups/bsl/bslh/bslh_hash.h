@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslh::Hash: functor that runs 'bslh' hash algorithms on supported types
+//  bslh::IsBitwiseHashable: trait for types hashed as their object bytes
 //
 //@SEE_ALSO:
 //
@@ -157,6 +158,29 @@ BSLS_IDENT("$Id: $")
 //  assert(algM.computeHash() == algI.computeHash());
 //..
 //
+///Hashing Contiguous Sequences
+///-----------------------------
+// The 'bslh::IsBitwiseHashable' trait identifies types whose 'hashAppend'
+// passes exactly the bytes of the object representation to the hashing
+// algorithm, in a single call.  Integral types (other than 'bool'), pointers
+// to fundamental types and 'void', and arrays of such types have this trait;
+// 'bool', floating point types (which normalize the value of negative zero),
+// enumerations, pointers to other types, and class types do not, unless the
+// trait is explicitly specialized for them.  Enumerations and pointers to
+// user-defined types are excluded because a user may overload 'hashAppend'
+// for them, and that overload must still be called for each element of a
+// sequence; such a type hashed by the default 'hashAppend' may opt in by
+// specializing the trait.
+//
+// Because hashing algorithms are subdivision-invariant (see
+// {Subdivision-Invariance}), the hash of a contiguous sequence of objects of
+// a bitwise-hashable type can be computed by passing the whole sequence to
+// the algorithm at once, yielding the same result as appending each element
+// in turn.  The 'bslh::hashAppendContiguous' function does so when the trait
+// holds, and appends the elements one at a time otherwise.  Containers with
+// contiguous storage (such as 'bsl::vector' and 'bsl::array') use it to
+// implement their 'hashAppend'.
+//
 ///Usage
 ///-----
 // This section illustrates intended usage of this component.
@@ -442,14 +466,18 @@ BSLS_IDENT("$Id: $")
 #include <bslh_defaulthashalgorithm.h>
 
 #include <bslmf_enableif.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_isenum.h>
 #include <bslmf_isfloatingpoint.h>
+#include <bslmf_isfundamental.h>
 #include <bslmf_isintegral.h>
 #include <bslmf_ispointer.h>
 #include <bslmf_issame.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_istriviallydefaultconstructible.h>
+#include <bslmf_removecv.h>
+#include <bslmf_removepointer.h>
 
 #include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>
@@ -516,6 +544,66 @@ class Hash_AdlWrapper {
         // and cast the return value to 'result_type.
 };
 
+                       // =============================
+                       // struct bslh::IsBitwiseHashable
+                       // =============================
+
+template <class TYPE>
+struct IsBitwiseHashable
+: bsl::integral_constant<
+      bool,
+      (bsl::is_integral<typename bsl::remove_cv<TYPE>::type>::value ||
+       (bsl::is_pointer<typename bsl::remove_cv<TYPE>::type>::value &&
+        bsl::is_fundamental<typename bsl::remove_cv<
+            typename bsl::remove_pointer<
+                typename bsl::remove_cv<TYPE>::type>::type>::type>::value)) &&
+      !bsl::is_same<typename bsl::remove_cv<TYPE>::type, bool>::value> {
+    // This 'struct' template implements a meta-function to determine whether
+    // 'hashAppend' for the (template parameter) 'TYPE' passes the bytes of the
+    // object representation of its argument, and nothing else, to the hashing
+    // algorithm.  This trait may be specialized to derive from
+    // 'bsl::true_type' for a type whose 'hashAppend' is equivalent to
+    // 'hashAlg(&object, sizeof(object))'; note that objects of such a type
+    // that compare equal must have identical object representations.  Note
+    // that enumerations, and pointers to types other than fundamental types
+    // and 'void', do not have this trait by default, because their
+    // 'hashAppend' may be overloaded by the user.
+};
+
+template <class TYPE, size_t N>
+struct IsBitwiseHashable<TYPE[N]> : IsBitwiseHashable<TYPE> {
+    // This partial specialization of 'IsBitwiseHashable' for arrays has the
+    // trait of the element type, as an array of bitwise-hashable elements is
+    // itself hashed as a single contiguous sequence of bytes.
+};
+
+                          // ===========================
+                          // struct bslh::Hash_RangeUtil
+                          // ===========================
+
+struct Hash_RangeUtil {
+    // This component-private 'struct' provides a namespace for the
+    // implementation of 'hashAppendContiguous'.
+
+    // CLASS METHODS
+    template <class HASH_ALGORITHM, class TYPE>
+    static void append(HASH_ALGORITHM&  hashAlg,
+                       const TYPE      *data,
+                       size_t           numElements,
+                       bsl::true_type);
+        // Pass the specified 'numElements' bitwise-hashable objects starting
+        // at the specified 'data' to the specified 'hashAlg' in a single call.
+
+    template <class HASH_ALGORITHM, class TYPE>
+    static void append(HASH_ALGORITHM&  hashAlg,
+                       const TYPE      *data,
+                       size_t           numElements,
+                       bsl::false_type);
+        // Pass the specified 'numElements' objects starting at the specified
+        // 'data' to the specified 'hashAlg' by calling 'hashAppend' on each of
+        // them in turn.
+};
+
                           // ================
                           // class bslh::Hash
                           // ================
@@ -645,21 +733,36 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 void hashAppend(HASH_ALGORITHM& hashAlg, TYPE (&input)[N]);
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
-    // resulting hash value.  Note that the elements in 'input' will be hashed
-    // one at a time by calling 'hashAppend' because the (template parameter)
-    // 'TYPE' might not be hashable as a contiguous sequence of bytes.  Also
-    // note that this 'hashAppend' exists because some platforms don't
-    // recognize that adding a const qualifier is a better match for arrays
-    // than decaying to a pointer and using the 'hashAppend' function for
-    // pointers.
+    // resulting hash value.  Note that the elements in 'input' are passed to
+    // 'hashAppendContiguous', so they are hashed in a single call to 'hashAlg'
+    // if 'IsBitwiseHashable<TYPE>::value' is 'true', and one at a time by
+    // calling 'hashAppend' otherwise.  Also note that this 'hashAppend'
+    // exists because some platforms don't recognize that adding a const
+    // qualifier is a better match for arrays than decaying to a pointer and
+    // using the 'hashAppend' function for pointers.
 
 template <class HASH_ALGORITHM, class TYPE, size_t N>
 void hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N]);
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
-    // resulting hash value.  Note that the elements in 'input' will be hashed
-    // one at a time by calling 'hashAppend' because the (template parameter)
-    // 'TYPE' might not be hashable as a contiguous sequence of bytes.
+    // resulting hash value.  Note that the elements in 'input' are passed to
+    // 'hashAppendContiguous', so they are hashed in a single call to 'hashAlg'
+    // if 'IsBitwiseHashable<TYPE>::value' is 'true', and one at a time by
+    // calling 'hashAppend' otherwise.
+
+template <class HASH_ALGORITHM, class TYPE>
+void hashAppendContiguous(HASH_ALGORITHM&  hashAlg,
+                          const TYPE      *data,
+                          size_t           numElements);
+    // Pass the specified 'numElements' objects of the (template parameter)
+    // 'TYPE' starting at the specified 'data' to the specified 'hashAlg', with
+    // the same effect as calling 'hashAppend' on each of them in turn.  If
+    // 'IsBitwiseHashable<TYPE>::value' is 'true', the whole sequence is
+    // passed to 'hashAlg' in a single call (if 'numElements' is not 0).  The
+    // behavior is undefined unless '[data, data + numElements)' is a valid
+    // range.  Note that this function does not append 'numElements' itself;
+    // containers must do so separately to distinguish sequences that are
+    // concatenations of each other.
 
 }  // close package namespace
 
@@ -705,6 +808,35 @@ bslh::Hash_AdlWrapper<HASH_ALGORITHM>::computeHash()
     return d_hashAlgorithm.computeHash();
 }
 
+                          // ---------------------------
+                          // struct bslh::Hash_RangeUtil
+                          // ---------------------------
+
+// CLASS METHODS
+template <class HASH_ALGORITHM, class TYPE>
+inline
+void bslh::Hash_RangeUtil::append(HASH_ALGORITHM&  hashAlg,
+                                  const TYPE      *data,
+                                  size_t           numElements,
+                                  bsl::true_type)
+{
+    if (numElements) {
+        hashAlg(data, sizeof(TYPE) * numElements);
+    }
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+inline
+void bslh::Hash_RangeUtil::append(HASH_ALGORITHM&  hashAlg,
+                                  const TYPE      *data,
+                                  size_t           numElements,
+                                  bsl::false_type)
+{
+    for (size_t i = 0; i < numElements; ++i) {
+        hashAppend(hashAlg, data[i]);
+    }
+}
+
                                 // ----------
                                 // bslh::Hash
                                 // ----------
@@ -857,10 +989,7 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 inline
 void bslh::hashAppend(HASH_ALGORITHM& hashAlg, TYPE (&input)[N])
 {
-
-    for (size_t i = 0; i < N; ++i) {
-        hashAppend(hashAlg, input[i]);
-    }
+    hashAppendContiguous(hashAlg, &input[0], N);
 }
 
 
@@ -868,9 +997,21 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 inline
 void bslh::hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N])
 {
-    for (size_t i = 0; i < N; ++i) {
-        hashAppend(hashAlg, input[i]);
-    }
+    hashAppendContiguous(hashAlg, &input[0], N);
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+inline
+void bslh::hashAppendContiguous(HASH_ALGORITHM&  hashAlg,
+                                const TYPE      *data,
+                                size_t           numElements)
+{
+    Hash_RangeUtil::append(hashAlg,
+                           data,
+                           numElements,
+                           bsl::integral_constant<
+                                       bool,
+                                       IsBitwiseHashable<TYPE>::value>());
 }
 
 // ============================================================================
@@ -9,6 +9,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <limits>
@@ -71,6 +72,7 @@ using namespace BloombergLP;
 // [ 3] void hashAppend(HASHALG& hashAlg, const TYPE (&input)[N]);
 // [ 3] void hashAppend(HASHALG& hashAlg, const void *input);
 // [ 3] void hashAppend(HASHALG& hashAlg, RT (*input)(ARGS...));
+// [11] void hashAppendContiguous(HASHALG&, const TYPE *, size_t);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [10] USAGE EXAMPLE
@@ -79,6 +81,8 @@ using namespace BloombergLP;
 // [ 6] is_trivially_copyable trait
 // [ 6] is_trivially_default_constructible trait
 // [ 7] QoI: Support for empty base optimization
+// [11] IsBitwiseHashable trait
+// [-1] PERFORMANCE: CONTIGUOUS HASHING
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -840,6 +844,287 @@ class MockAccumulatingHashingAlgorithm {
 using bslh::MockHashingAlgorithm;
 using bslh::MockAccumulatingHashingAlgorithm;
 
+template <class HASH_ALGORITHM>
+class CallCountingHashingAlgorithm {
+    // This class implements a hashing algorithm that forwards to the (template
+    // parameter) 'HASH_ALGORITHM' and counts the number of calls made to its
+    // function-call operator.
+
+    HASH_ALGORITHM d_algorithm;  // wrapped algorithm
+    int            d_numCalls;   // number of calls to 'operator()'
+
+  public:
+    // TYPES
+    typedef typename HASH_ALGORITHM::result_type result_type;
+
+    // CREATORS
+    CallCountingHashingAlgorithm()
+        // Create a new 'CallCountingHashingAlgorithm'.
+    : d_algorithm()
+    , d_numCalls(0)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t length)
+        // Pass the specified 'data' of the specified 'length' to the wrapped
+        // algorithm and count the call.
+    {
+        d_algorithm(data, length);
+        ++d_numCalls;
+    }
+
+    result_type computeHash()
+        // Return the hash computed by the wrapped algorithm.
+    {
+        return d_algorithm.computeHash();
+    }
+
+    // ACCESSORS
+    int numCalls() const
+        // Return the number of calls made to 'operator()'.
+    {
+        return d_numCalls;
+    }
+};
+
+enum ContiguousTestEnum { e_CONTIGUOUS_A, e_CONTIGUOUS_B };
+
+enum ContiguousOptInEnum { e_OPT_IN_A, e_OPT_IN_B };
+
+namespace BloombergLP {
+namespace bslh {
+
+template <>
+struct IsBitwiseHashable<ContiguousOptInEnum> : bsl::true_type {
+    // 'ContiguousOptInEnum' is hashed by the default 'hashAppend', and so
+    // opts in to being hashed as a contiguous sequence of bytes.
+};
+
+}  // close namespace bslh
+}  // close enterprise namespace
+
+namespace ContiguousTestNS {
+
+enum CustomHashedEnum { e_CUSTOM_A = 1, e_CUSTOM_B = 2 };
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, CustomHashedEnum value)
+    // Pass a single character identifying the specified 'value' to the
+    // specified 'hashAlg', rather than the object representation of 'value'.
+{
+    const char code = e_CUSTOM_A == value ? 'a' : 'b';
+    hashAlg(&code, sizeof code);
+}
+
+struct CustomHashedPointee {
+    // This type is hashed through pointers to it by identifier rather than by
+    // address.
+
+    // DATA
+    char d_id;  // identifier hashed in place of the address
+};
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const CustomHashedPointee *value)
+    // Pass the identifier of the object at the specified 'value' address to
+    // the specified 'hashAlg', rather than the address itself.
+{
+    hashAlg(&value->d_id, sizeof value->d_id);
+}
+
+}  // close namespace ContiguousTestNS
+
+struct ContiguousTestStruct {
+    int d_value;
+};
+
+template <class HASH_ALGORITHM>
+void testContiguousHashing(const char *name)
+    // Verify that 'hashAppendContiguous' with the (template parameter)
+    // 'HASH_ALGORITHM' yields the same hash as appending the elements one at a
+    // time, using a single call to the algorithm for bitwise-hashable element
+    // types, and one or more calls per element otherwise.  Use the specified
+    // 'name' to identify the algorithm in assertion messages.
+{
+    typedef CallCountingHashingAlgorithm<HASH_ALGORITHM> Alg;
+
+    const int k_MAX_LENGTH = 40;
+
+    int    ints[k_MAX_LENGTH];
+    double doubles[k_MAX_LENGTH];
+    for (int i = 0; i < k_MAX_LENGTH; ++i) {
+        ints[i]    = i * 7919 - 1000;
+        doubles[i] = i * 0.5 - 3.0;
+    }
+
+    for (int len = 0; len <= k_MAX_LENGTH; ++len) {
+        {
+            Alg contiguous;
+            bslh::hashAppendContiguous(contiguous, ints, len);
+
+            Alg elementwise;
+            for (int i = 0; i < len; ++i) {
+                hashAppend(elementwise, ints[i]);
+            }
+
+            ASSERTV(name, len, contiguous.computeHash() ==
+                                                   elementwise.computeHash());
+            ASSERTV(name, len, contiguous.numCalls(),
+                    (len ? 1 : 0) == contiguous.numCalls());
+        }
+        {
+            Alg contiguous;
+            bslh::hashAppendContiguous(contiguous, doubles, len);
+
+            Alg elementwise;
+            for (int i = 0; i < len; ++i) {
+                hashAppend(elementwise, doubles[i]);
+            }
+
+            ASSERTV(name, len, contiguous.computeHash() ==
+                                                   elementwise.computeHash());
+            ASSERTV(name, len, contiguous.numCalls(),
+                    len == contiguous.numCalls());
+        }
+    }
+
+    // Negative and positive zero are equal, and must hash equally.
+
+    const double zeros[]         = {  0.0, 1.0,  0.0 };
+    const double negativeZeros[] = { -0.0, 1.0, -0.0 };
+
+    Alg algZeros;
+    bslh::hashAppendContiguous(algZeros, zeros, 3);
+
+    Alg algNegativeZeros;
+    bslh::hashAppendContiguous(algNegativeZeros, negativeZeros, 3);
+
+    ASSERTV(name, algZeros.computeHash() == algNegativeZeros.computeHash());
+
+    // Arrays of bitwise-hashable types are hashed in a single call.
+
+    Alg algArray;
+    hashAppend(algArray, ints);
+
+    Alg algContiguous;
+    bslh::hashAppendContiguous(algContiguous, ints, k_MAX_LENGTH);
+
+    ASSERTV(name, algArray.numCalls(), 1 == algArray.numCalls());
+    ASSERTV(name, algArray.computeHash() == algContiguous.computeHash());
+
+    // Enumerations are appended one at a time, so that a user-supplied
+    // 'hashAppend' is honored, unless they opt in to the trait.
+
+    using ContiguousTestNS::CustomHashedEnum;
+
+    const CustomHashedEnum customs[] = { ContiguousTestNS::e_CUSTOM_A,
+                                         ContiguousTestNS::e_CUSTOM_B,
+                                         ContiguousTestNS::e_CUSTOM_A };
+
+    Alg algCustoms;
+    hashAppend(algCustoms, customs);
+
+    Alg algCustomsElementwise;
+    for (int i = 0; i < 3; ++i) {
+        hashAppend(algCustomsElementwise, customs[i]);
+    }
+
+    Alg algCustomsAsChars;
+    algCustomsAsChars("aba", 3);
+
+    ASSERTV(name, algCustoms.numCalls(), 3 == algCustoms.numCalls());
+    ASSERTV(name, algCustoms.computeHash() ==
+                                         algCustomsElementwise.computeHash());
+    ASSERTV(name, algCustoms.computeHash() ==
+                                             algCustomsAsChars.computeHash());
+
+    const ContiguousOptInEnum optIns[] = { e_OPT_IN_A, e_OPT_IN_B };
+
+    Alg algOptIns;
+    hashAppend(algOptIns, optIns);
+
+    Alg algOptInsElementwise;
+    for (int i = 0; i < 2; ++i) {
+        hashAppend(algOptInsElementwise, optIns[i]);
+    }
+
+    ASSERTV(name, algOptIns.numCalls(), 1 == algOptIns.numCalls());
+    ASSERTV(name, algOptIns.computeHash() ==
+                                          algOptInsElementwise.computeHash());
+
+    // Pointers to user-defined types are also appended one at a time, so
+    // that a user-supplied 'hashAppend' for the pointer type is honored.
+
+    using ContiguousTestNS::CustomHashedPointee;
+
+    const CustomHashedPointee  pointees[] = { { 'x' }, { 'y' } };
+    const CustomHashedPointee *pointers[] = { &pointees[0],
+                                              &pointees[1],
+                                              &pointees[0] };
+
+    Alg algPointers;
+    hashAppend(algPointers, pointers);
+
+    Alg algPointersContiguous;
+    bslh::hashAppendContiguous(algPointersContiguous, pointers, 3);
+
+    Alg algPointersAsChars;
+    algPointersAsChars("xyx", 3);
+
+    ASSERTV(name, algPointers.numCalls(), 3 == algPointers.numCalls());
+    ASSERTV(name, algPointersContiguous.numCalls(),
+            3 == algPointersContiguous.numCalls());
+    ASSERTV(name, algPointers.computeHash() ==
+                                            algPointersAsChars.computeHash());
+    ASSERTV(name, algPointersContiguous.computeHash() ==
+                                            algPointersAsChars.computeHash());
+}
+
+template <class HASH_ALGORITHM>
+void benchmarkContiguousHashing(const char   *name,
+                                const int    *data,
+                                size_t        numElements,
+                                int           numIterations)
+    // Print the time taken to hash the specified 'numElements' integers at the
+    // specified 'data' the specified 'numIterations' times using the
+    // (template parameter) 'HASH_ALGORITHM', both one element at a time and
+    // with a single call to 'hashAppendContiguous'.  Use the specified 'name'
+    // to identify the algorithm in the output.
+{
+    bsls::Types::Uint64 sink = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int iteration = 0; iteration < numIterations; ++iteration) {
+        HASH_ALGORITHM alg;
+        for (size_t i = 0; i < numElements; ++i) {
+            hashAppend(alg, data[i]);
+        }
+        sink += static_cast<bsls::Types::Uint64>(alg.computeHash());
+    }
+    timer.stop();
+    const double elementwiseTime = timer.elapsedTime() / numIterations;
+
+    timer.reset();
+    timer.start();
+    for (int iteration = 0; iteration < numIterations; ++iteration) {
+        HASH_ALGORITHM alg;
+        bslh::hashAppendContiguous(alg, data, numElements);
+        sink += static_cast<bsls::Types::Uint64>(alg.computeHash());
+    }
+    timer.stop();
+    const double contiguousTime = timer.elapsedTime() / numIterations;
+
+    printf("%-28s element-wise: %9.3f ms  contiguous: %9.3f ms  "
+           "(%.1fx)  [%llu]\n",
+           name,
+           elementwiseTime * 1000.0,
+           contiguousTime * 1000.0,
+           elementwiseTime / contiguousTime,
+           static_cast<unsigned long long>(sink & 1));
+}
+
 template<class TYPE>
 class TestDriver {
     // This class implements a test driver that can run tests on any type.
@@ -1115,6 +1400,112 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING CONTIGUOUS HASHING
+        //
+        // Concerns:
+        //: 1 'IsBitwiseHashable' is 'true' for integral types other than
+        //:   'bool', pointers to fundamental types and 'void', arrays of such
+        //:   types, cv-qualified versions of these, and types that specialize
+        //:   the trait, and 'false' otherwise (in particular, for enumerations
+        //:   and pointers to user-defined types).
+        //:
+        //: 2 'hashAppendContiguous' produces the same hash as appending each
+        //:   element in turn, for any length including 0.
+        //:
+        //: 3 For a bitwise-hashable element type, 'hashAppendContiguous' calls
+        //:   the algorithm once (and not at all for an empty range); for other
+        //:   types it appends the elements one at a time.
+        //:
+        //: 4 Ranges that compare equal but have different object
+        //:   representations (e.g., negative and positive zero) hash equally.
+        //:
+        //: 5 'hashAppend' for arrays of bitwise-hashable types uses a single
+        //:   call to the algorithm.
+        //:
+        //: 6 'hashAppend' for an array of enumerations calls a user-supplied
+        //:   'hashAppend' overload for each element, unless the enumeration
+        //:   specializes 'IsBitwiseHashable'.
+        //:
+        //: 7 'hashAppend' and 'hashAppendContiguous' for a sequence of
+        //:   pointers to a user-defined type call a user-supplied 'hashAppend'
+        //:   overload for the pointer type for each element.
+        //
+        // Plan:
+        //: 1 Verify the value of 'IsBitwiseHashable' for a representative set
+        //:   of types.  (C-1)
+        //:
+        //: 2 For several hashing algorithms wrapped by a call-counting
+        //:   algorithm, and for ranges of 'int' and 'double' of every length
+        //:   up to 40, compare the hash and the number of calls to those of
+        //:   appending each element in turn.  (C-2..3)
+        //:
+        //: 3 Hash ranges of 'double' differing only in the sign of zero and
+        //:   verify the hashes are equal.  (C-4)
+        //:
+        //: 4 Hash an 'int' array with 'hashAppend' and verify that one call
+        //:   is made.  (C-5)
+        //:
+        //: 5 Hash an array of an enumeration having its own 'hashAppend', and
+        //:   an array of an enumeration specializing the trait, and verify the
+        //:   hashes and the number of calls.  (C-6)
+        //:
+        //: 6 Hash an array of 'const Foo *', where 'Foo' has a 'hashAppend'
+        //:   overload for 'const Foo *' hashing the pointee, with both
+        //:   'hashAppend' and 'hashAppendContiguous', and verify the hashes
+        //:   and the number of calls.  (C-7)
+        //
+        // Testing:
+        //   IsBitwiseHashable trait
+        //   void hashAppendContiguous(HASHALG&, const TYPE *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING CONTIGUOUS HASHING\n"
+                            "==========================\n");
+
+        if (verbose) printf("Testing 'IsBitwiseHashable'.\n");
+        {
+            ASSERT( bslh::IsBitwiseHashable<char>::value);
+            ASSERT( bslh::IsBitwiseHashable<unsigned char>::value);
+            ASSERT( bslh::IsBitwiseHashable<int>::value);
+            ASSERT( bslh::IsBitwiseHashable<const int>::value);
+            ASSERT( bslh::IsBitwiseHashable<volatile long>::value);
+            ASSERT( bslh::IsBitwiseHashable<bsls::Types::Uint64>::value);
+            ASSERT( bslh::IsBitwiseHashable<const char *>::value);
+            ASSERT( bslh::IsBitwiseHashable<void *>::value);
+            ASSERT( bslh::IsBitwiseHashable<const volatile void *>::value);
+            ASSERT( bslh::IsBitwiseHashable<double *const>::value);
+            ASSERT( bslh::IsBitwiseHashable<ContiguousOptInEnum>::value);
+            ASSERT( bslh::IsBitwiseHashable<int[4]>::value);
+            ASSERT( bslh::IsBitwiseHashable<const short[2][3]>::value);
+
+            ASSERT(!bslh::IsBitwiseHashable<bool>::value);
+            ASSERT(!bslh::IsBitwiseHashable<const bool>::value);
+            ASSERT(!bslh::IsBitwiseHashable<float>::value);
+            ASSERT(!bslh::IsBitwiseHashable<double>::value);
+            ASSERT(!bslh::IsBitwiseHashable<long double>::value);
+            ASSERT(!bslh::IsBitwiseHashable<double[4]>::value);
+            ASSERT(!bslh::IsBitwiseHashable<ContiguousTestStruct>::value);
+            ASSERT(!bslh::IsBitwiseHashable<ContiguousTestEnum>::value);
+            ASSERT(!bslh::IsBitwiseHashable<
+                                ContiguousTestNS::CustomHashedEnum>::value);
+            ASSERT(!bslh::IsBitwiseHashable<ContiguousTestEnum[4]>::value);
+            ASSERT(!bslh::IsBitwiseHashable<ContiguousTestStruct *>::value);
+            ASSERT(!bslh::IsBitwiseHashable<
+                      const ContiguousTestNS::CustomHashedPointee *>::value);
+            ASSERT(!bslh::IsBitwiseHashable<ContiguousTestEnum *>::value);
+            ASSERT(!bslh::IsBitwiseHashable<int **>::value);
+            ASSERT(!bslh::IsBitwiseHashable<void (*)()>::value);
+        }
+
+        if (verbose) printf("Testing 'hashAppendContiguous'.\n");
+        {
+            testContiguousHashing<bslh::DefaultHashAlgorithm>("Default");
+            testContiguousHashing<bslh::SpookyHashAlgorithm>("Spooky");
+            testContiguousHashing<bslh::WyHashIncrementalAlgorithm>("WyHash");
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -2313,6 +2704,51 @@ int main(int argc, char *argv[])
             ASSERT(hashAlg(int1) == hashAlg(int2));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONTIGUOUS HASHING
+        //
+        // Concern:
+        //: 1 Hashing a contiguous range of a bitwise-hashable type in a single
+        //:   call is faster than appending its elements one at a time.
+        //
+        // Plan:
+        //: 1 Hash a range of 1M 'int's (or the number specified as the second
+        //:   argument) with each algorithm, element-wise and with
+        //:   'hashAppendContiguous', and report the average times.
+        //
+        // Testing:
+        //   PERFORMANCE: CONTIGUOUS HASHING
+        // --------------------------------------------------------------------
+
+        printf("PERFORMANCE: CONTIGUOUS HASHING\n"
+               "===============================\n");
+
+        const size_t numElements = argc > 2 ? atoi(argv[2]) : 1000 * 1000;
+        const int    numIterations = 20;
+
+        int *data = new int[numElements];
+        for (size_t i = 0; i < numElements; ++i) {
+            data[i] = static_cast<int>(i * 2654435761u);
+        }
+
+        printf("%d iterations over %d 'int's\n",
+               numIterations,
+               static_cast<int>(numElements));
+
+        benchmarkContiguousHashing<bslh::WyHashIncrementalAlgorithm>(
+                                                  "WyHashIncrementalAlgorithm",
+                                                  data,
+                                                  numElements,
+                                                  numIterations);
+        benchmarkContiguousHashing<bslh::SpookyHashAlgorithm>(
+                                                  "SpookyHashAlgorithm",
+                                                  data,
+                                                  numElements,
+                                                  numIterations);
+
+        delete[] data;
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -29,6 +29,17 @@ Allocator::~Allocator()
 {
 }
 
+// PROTECTED MANIPULATORS
+void Allocator::doDeallocate(void      *address,
+                             size_type  size,
+                             size_type  alignment)
+{
+    (void)size;
+    (void)alignment;
+
+    deallocate(address);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -117,6 +117,40 @@ BSLS_IDENT("$Id: $")
 // is known that the 'address' does *not* refer to a secondary base class of
 // the object being deleted.
 //
+///Sized Deallocation
+///-------------------
+// In addition to the pure virtual 'deallocate(address)', the protocol offers
+// a sized and aligned overload, 'deallocate(address, size, alignment)', for
+// clients that know the extent of the block being returned -- e.g.,
+// 'bsl::allocator<TYPE>::deallocate(p, n)', through which the standard
+// containers return memory, knows that the block holds 'n' objects of 'TYPE'.
+// The sized overload is non-virtual; it dispatches to the protected virtual
+// 'doDeallocate', whose default implementation ignores 'size' and 'alignment'
+// and calls 'deallocate(address)'.  Existing derived classes are therefore
+// unaffected; a derived class may override 'doDeallocate' to make use of
+// them.
+//
+// The 'size' supplied to the sized overload *must* be the size that was passed
+// to 'allocate' when the block was obtained, and the 'alignment' must be a
+// power of two no greater than the alignment guaranteed by 'allocate' for a
+// block of that size; supplying any other values is undefined behavior.  An
+// implementation of 'doDeallocate' may therefore rely on 'size' to determine
+// the size class or pool to which a block belongs.  A caller that does not
+// know the size of a block (e.g., 'deleteObject') uses the unsized
+// 'deallocate(address)' instead, which remains available for every block, so
+// an allocator that makes use of the sized overload must still be able to
+// recover the size of a block from its own bookkeeping (or otherwise locate
+// the block) in 'deallocate(address)'.
+//
+// 'bslma::TestAllocator' overrides 'doDeallocate' to verify that the 'size'
+// supplied matches the size it recorded when the block was allocated, and
+// reports a mismatch as it does any other invalid deallocation, so test
+// drivers detect callers that supply an inaccurate size.
+// Note also that, because the sized overload shares its name with the pure
+// virtual 'deallocate', a derived class that overrides the latter hides the
+// former; call the sized overload through a base-class pointer or reference
+// (or bring it into scope with a 'using' declaration).
+//
 ///Usage
 ///-----
 // The 'bslma::Allocator' protocol provided in this component defines a
@@ -376,6 +410,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_assert.h>
 #include <bsls_keyword.h>
 #include <bsls_nullptr.h>
 #include <bsls_platform.h>
@@ -445,6 +480,19 @@ class Allocator {
         // behavior is undefined unless 'address' was allocated using this
         // allocator object and has not already been deallocated.
 
+    void deallocate(void *address, size_type size, size_type alignment);
+        // Return the memory block at the specified 'address' back to this
+        // allocator, supplying the specified 'size' (in bytes) and
+        // 'alignment' of the block to the implementation.  If 'address' is
+        // 0, this function has no effect.  The behavior is undefined unless
+        // 'address' was allocated using this allocator object, has not
+        // already been deallocated, 'size' is the value passed to 'allocate'
+        // when the block was obtained, and 'alignment' is a power of two no
+        // greater than the alignment guaranteed by 'allocate' for a block of
+        // 'size' bytes.  Note that this method invokes the protected virtual
+        // 'doDeallocate', which by default forwards to 'deallocate(address)';
+        // see {Sized Deallocation}.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
@@ -478,6 +526,19 @@ class Allocator {
         // not deduce to a pointer type for the method above.  As calls to
         // 'deleteObjectRaw' with (typed) null pointer values have well-defined
         // behavior, it should also support calls with a null pointer literal.
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual void doDeallocate(void      *address,
+                              size_type  size,
+                              size_type  alignment);
+        // Return the memory block at the specified 'address' back to this
+        // allocator, ignoring the specified 'size' and 'alignment' of the
+        // block.  Derived classes may override this method to make use of
+        // 'size' and 'alignment' (e.g., to find the pool to which the block
+        // belongs); the default implementation simply invokes
+        // 'deallocate(address)'.  The behavior is undefined unless the
+        // preconditions of 'deallocate(address, size, alignment)' are met.
 };
 
 }  // close package namespace
@@ -585,6 +646,15 @@ void Allocator::deleteObject(const TYPE *object)
 }
 
 
+inline
+void Allocator::deallocate(void *address, size_type size, size_type alignment)
+{
+    BSLS_ASSERT_SAFE(0 < alignment);
+    BSLS_ASSERT_SAFE(0 == (alignment & (alignment - 1)));
+
+    doDeallocate(address, size, alignment);
+}
+
 inline
 void Allocator::deleteObject(bsl::nullptr_t)
 {
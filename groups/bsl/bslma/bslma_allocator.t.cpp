@@ -25,7 +25,9 @@ using namespace BloombergLP;
 // 'deleteObject' and 'deleteObjectRaw' destroys the argument object and calls
 // the deallocate method of the supplied allocator, and (3) that the overloaded
 // 'new' and 'delete' operators respectively forward the call to the
-// 'allocate' and 'deallocate' method of the supplied allocator.
+// 'allocate' and 'deallocate' method of the supplied allocator.  We also
+// verify that the sized 'deallocate' overload dispatches to 'doDeallocate',
+// whose default implementation forwards to the unsized 'deallocate'.
 //-----------------------------------------------------------------------------
 // [ 1] virtual ~Allocator();
 // [ 1] virtual void *allocate(size_type size) = 0;
@@ -36,6 +38,8 @@ using namespace BloombergLP;
 // [ 3] void deleteObjectRaw(bsl::nulptr_t);
 // [ 4] void *operator new(int size, bslma::Allocator& basicAllocator);
 // [ 5] void operator delete(void *address, bslma::Allocator& bA);
+// [ 6] void deallocate(void *address, size_type size, size_type alignment);
+// [ 6] virtual void doDeallocate(void *, size_type, size_type);
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
 // [  ] static throwBadAlloc();
 #endif
@@ -43,7 +47,7 @@ using namespace BloombergLP;
 // [ 1] PROTOCOL TEST - Make sure derived class compiles and links.
 // [ 4] OPERATOR TEST - Make sure overloaded operators call correct functions.
 // [ 5] EXCEPTION SAFETY - Ensure operator delete is invoked on an exception.
-// [ 6] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
+// [ 7] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
 //=============================================================================
 
 // ============================================================================
@@ -148,6 +152,47 @@ class my_Allocator : public bslma::Allocator {
         // Return descriptive code for the function called.
 };
 
+class my_SizedAllocator : public my_Allocator {
+    // Test class used to verify that the sized 'deallocate' overload is
+    // dispatched to an overriding 'doDeallocate'.
+
+    int       d_sizedCount;      // number of times 'doDeallocate' called
+    void     *d_lastAddress_p;   // last address passed to 'doDeallocate'
+    size_type d_lastSize;        // last size passed to 'doDeallocate'
+    size_type d_lastAlignment;   // last alignment passed to 'doDeallocate'
+
+  protected:
+    // PROTECTED MANIPULATORS
+    void doDeallocate(void *address, size_type size, size_type alignment) {
+        ++d_sizedCount;
+        d_lastAddress_p = address;
+        d_lastSize      = size;
+        d_lastAlignment = alignment;
+    }
+
+  public:
+    my_SizedAllocator()
+    : d_sizedCount(0)
+    , d_lastAddress_p(0)
+    , d_lastSize(0)
+    , d_lastAlignment(0)
+    {
+    }
+
+    // ACCESSORS
+    void *lastAddress() const { return d_lastAddress_p; }
+        // Return last address passed to 'doDeallocate'.
+
+    size_type lastAlignment() const { return d_lastAlignment; }
+        // Return last alignment passed to 'doDeallocate'.
+
+    size_type lastSize() const { return d_lastSize; }
+        // Return last size passed to 'doDeallocate'.
+
+    int sizedCount() const { return d_sizedCount; }
+        // Return number of times 'doDeallocate' called.
+};
+
 class my_NewDeleteAllocator : public bslma::Allocator {
     // Test class used to verify examples.
 
@@ -456,7 +501,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -511,6 +556,82 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // SIZED DEALLOCATION
+        //   Ensure that the sized 'deallocate' overload reaches the derived
+        //   allocator.
+        //
+        // Concerns:
+        //: 1 By default, the sized 'deallocate' overload invokes the unsized
+        //:   'deallocate' with the same address, ignoring the hints.
+        //:
+        //: 2 A null address is forwarded, so that it has no effect on a
+        //:   conforming derived allocator.
+        //:
+        //: 3 If a derived class overrides 'doDeallocate', the sized overload
+        //:   invokes the override with the supplied address, size, and
+        //:   alignment, and does not invoke the unsized 'deallocate'.
+        //
+        // Plan:
+        //: 1 Using 'my_Allocator', which does not override 'doDeallocate',
+        //:   call the sized overload through a base-class reference and
+        //:   verify that the unsized 'deallocate' was called.  (C-1..2)
+        //:
+        //: 2 Using 'my_SizedAllocator', which overrides 'doDeallocate', call
+        //:   the sized overload through a base-class reference and verify
+        //:   that the override observed the arguments, and that the unsized
+        //:   'deallocate' was not called.  (C-3)
+        //
+        // Testing:
+        //   void deallocate(void *address, size_type size, size_type align);
+        //   virtual void doDeallocate(void *, size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSIZED DEALLOCATION"
+                            "\n==================\n");
+
+        if (verbose) printf("\nDefault 'doDeallocate' forwards.\n");
+        {
+            my_Allocator myA;
+            bslma::Allocator& a = myA;
+
+            void *p = a.allocate(24);
+            ASSERT(1 == myA.allocateCount());
+
+            a.deallocate(p, 24, 8);
+            ASSERT(2 == myA.fun());
+            ASSERT(1 == myA.deallocateCount());
+
+            a.deallocate(0, 0, 1);
+            ASSERT(2 == myA.deallocateCount());
+        }
+
+        if (verbose) printf("\nOverriding 'doDeallocate'.\n");
+        {
+            my_SizedAllocator myA;
+            bslma::Allocator& a = myA;
+
+            void *p = a.allocate(13);
+
+            a.deallocate(p, 13, 1);
+            ASSERT(1  == myA.sizedCount());
+            ASSERT(p  == myA.lastAddress());
+            ASSERT(13 == myA.lastSize());
+            ASSERT(1  == myA.lastAlignment());
+            ASSERT(0  == myA.deallocateCount());
+
+            a.deallocate(p, 32, 16);
+            ASSERT(2  == myA.sizedCount());
+            ASSERT(32 == myA.lastSize());
+            ASSERT(16 == myA.lastAlignment());
+            ASSERT(0  == myA.deallocateCount());
+
+            a.deallocate(p);
+            ASSERT(2  == myA.sizedCount());
+            ASSERT(1  == myA.deallocateCount());
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // EXCEPTION SAFETY OF OPERATOR NEW TEST
@@ -55,7 +55,7 @@ using namespace BloombergLP;
 // Modifiers
 // [  ] allocator& operator=(const allocator& rhs);
 // [  ] pointer allocate(size_type n, const void *hint = 0);
-// [  ] void deallocate(pointer p, size_type n = 1);
+// [ 7] void deallocate(pointer p, size_type n = 1);
 // [  ] void construct(pointer p, const TYPE& val);
 // [  ] void destroy(pointer p);
 //
@@ -86,9 +86,10 @@ using namespace BloombergLP;
 //
 // Specialized Traits
 // [ 6] bsl::allocator_traits<bsl::allocator<E>>
+// [ 7] CONCERN: 'deallocate' supplies size and alignment to the mechanism
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ 2] bsl::is_trivially_copyable<bsl::allocator>
 // [ 2] bslmf::IsBitwiseEqualityComparable<sl::allocator>
 // [ 2] bslmf::IsBitwiseMoveable<bsl::allocator>
@@ -167,6 +168,66 @@ enum { VERBOSE_ARG_NUM = 2, VERY_VERBOSE_ARG_NUM, VERY_VERY_VERBOSE_ARG_NUM };
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+                        // ============================
+                        // class SizeRecordingAllocator
+                        // ============================
+
+class SizeRecordingAllocator : public bslma::Allocator {
+    // This test allocator obtains memory from an upstream allocator and
+    // records the size and alignment hints passed to the sized 'deallocate'
+    // overload.
+
+    // DATA
+    bslma::Allocator *d_upstream_p;      // supplies memory (held, not owned)
+    int               d_numSized;        // number of sized deallocations
+    int               d_numUnsized;      // number of unsized deallocations
+    size_type         d_lastSize;        // last size hint
+    size_type         d_lastAlignment;   // last alignment hint
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual void doDeallocate(void      *address,
+                              size_type  size,
+                              size_type  alignment)
+        // Record the specified 'size' and 'alignment' and return the block
+        // at the specified 'address' to the upstream allocator.
+    {
+        ++d_numSized;
+        d_lastSize      = size;
+        d_lastAlignment = alignment;
+        d_upstream_p->deallocate(address);
+    }
+
+  public:
+    // CREATORS
+    explicit SizeRecordingAllocator(bslma::Allocator *upstream)
+    : d_upstream_p(upstream)
+    , d_numSized(0)
+    , d_numUnsized(0)
+    , d_lastSize(0)
+    , d_lastAlignment(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        return d_upstream_p->allocate(size);
+    }
+
+    virtual void deallocate(void *address)
+    {
+        ++d_numUnsized;
+        d_upstream_p->deallocate(address);
+    }
+
+    // ACCESSORS
+    size_type lastAlignment() const { return d_lastAlignment; }
+    size_type lastSize() const { return d_lastSize; }
+    int numSized() const { return d_numSized; }
+    int numUnsized() const { return d_numUnsized; }
+};
+
 //=============================================================================
 //                            USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -582,7 +643,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -606,6 +667,106 @@ int main(int argc, char *argv[])
         usageExample2();
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING SIZED 'deallocate'
+        //
+        // Concerns:
+        //: 1 'deallocate(p, n)' returns the block to the mechanism through the
+        //:   sized 'bslma::Allocator::deallocate' overload, supplying
+        //:   'n * sizeof(TYPE)' and the alignment of 'TYPE'.
+        //:
+        //: 2 If 'n' is not specified, the size of a single 'TYPE' is supplied.
+        //:
+        //: 3 Deallocating through 'bsl::allocator_traits' supplies the same
+        //:   hints.
+        //:
+        //: 4 Mechanisms that do not override 'doDeallocate' still have their
+        //:   memory returned through the unsized 'deallocate'.
+        //
+        // Plan:
+        //: 1 Using a mechanism that records the hints passed to
+        //:   'doDeallocate', allocate and deallocate blocks of various lengths
+        //:   for several element types, directly and through
+        //:   'bsl::allocator_traits', and verify the recorded hints.
+        //:   (C-1..3)
+        //:
+        //: 2 Allocate and deallocate from a 'bslma::TestAllocator' and verify
+        //:   that no memory is leaked.  (C-4)
+        //
+        // Testing:
+        //   void deallocate(pointer p, size_type n = 1);
+        //   CONCERN: 'deallocate' supplies size and alignment to the mechanism
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SIZED 'deallocate'"
+                            "\n==========================\n");
+
+        bslma::TestAllocator   ta("upstream", veryVeryVeryVerbose);
+        SizeRecordingAllocator sra(&ta);
+
+        struct Big { double d_a[5]; char d_c; };
+
+        if (verbose) printf("\nDirect calls.\n");
+        {
+            bsl::allocator<char>   ac(&sra);
+            bsl::allocator<double> ad(&sra);
+            bsl::allocator<Big>    ab(&sra);
+
+            for (int n = 1; n < 10; ++n) {
+                char *pc = ac.allocate(n);
+                ac.deallocate(pc, n);
+                ASSERTV(n, sizeof(char) * n == sra.lastSize());
+                ASSERTV(n, bsls::AlignmentFromType<char>::VALUE
+                                                     == sra.lastAlignment());
+
+                double *pd = ad.allocate(n);
+                ad.deallocate(pd, n);
+                ASSERTV(n, sizeof(double) * n == sra.lastSize());
+                ASSERTV(n, bsls::AlignmentFromType<double>::VALUE
+                                                     == sra.lastAlignment());
+
+                Big *pb = ab.allocate(n);
+                ab.deallocate(pb, n);
+                ASSERTV(n, sizeof(Big) * n == sra.lastSize());
+                ASSERTV(n, bsls::AlignmentFromType<Big>::VALUE
+                                                     == sra.lastAlignment());
+            }
+            ASSERT(27 == sra.numSized());
+
+            double *pd = ad.allocate(1);
+            ad.deallocate(pd);
+            ASSERT(28             == sra.numSized());
+            ASSERT(sizeof(double) == sra.lastSize());
+        }
+
+        if (verbose) printf("\nThrough 'allocator_traits'.\n");
+        {
+            typedef bsl::allocator<Big>         AB;
+            typedef bsl::allocator_traits<AB>   TB;
+
+            AB ab(&sra);
+
+            Big *pb = TB::allocate(ab, 3);
+            TB::deallocate(ab, pb, 3);
+            ASSERT(29              == sra.numSized());
+            ASSERT(3 * sizeof(Big) == sra.lastSize());
+            ASSERT(bsls::AlignmentFromType<Big>::VALUE
+                                                      == sra.lastAlignment());
+        }
+        ASSERT(0 == sra.numUnsized());
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\nMechanism without 'doDeallocate'.\n");
+        {
+            bsl::allocator<int> ai(&ta);
+
+            int *pi = ai.allocate(7);
+            ASSERT(1 == ta.numBlocksInUse());
+            ai.deallocate(pi, 7);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING ALLOCATOR_TRAITS
@@ -130,9 +130,13 @@ class allocator {
 
     void deallocate(pointer p, size_type n = 1);
         // Return memory previously allocated with 'allocate' to the underlying
-        // mechanism object by calling 'deallocate' on the mechanism object
-        // with the specified 'p'.  The optionally specified 'n' argument is
-        // ignored by this allocator type.
+        // mechanism object by calling the sized 'deallocate' overload on the
+        // mechanism object with the specified 'p', the size of the block, and
+        // the alignment of 'TYPE'.  Optionally specify 'n', the number of
+        // objects for which the block was allocated; if 'n' is not
+        // specified, 1 is assumed.  The behavior is undefined unless 'p' was
+        // obtained from a call to 'allocate(n)' on an allocator that compares
+        // equal to this one.
 
 #if BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
 // {{{ BEGIN GENERATED CODE
@@ -1183,8 +1187,9 @@ inline
 void allocator<TYPE>::deallocate(typename allocator::pointer   p,
                                  typename allocator::size_type n)
 {
-    (void) n;  // suppress unused parameter warning
-    d_mechanism->deallocate(p);
+    d_mechanism->deallocate(p,
+                            n * sizeof(TYPE),
+                            BloombergLP::bsls::AlignmentFromType<TYPE>::VALUE);
 }
 
 #if BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
@@ -469,6 +469,51 @@ TestAllocator::~TestAllocator()
     }
 }
 
+// PROTECTED MANIPULATORS
+void TestAllocator::doDeallocate(void      *address,
+                                 size_type  size,
+                                 size_type  alignment)
+{
+    (void)alignment;
+
+    if (address) {
+        Align *align = (Align *)address - 1;
+
+        // Only the size of a block that 'deallocate' would otherwise accept is
+        // checked here; any other error is diagnosed by 'deallocate'.  See
+        // 'deallocate' for the reason these checks are done in this order.
+
+        if (ALLOCATED_MEMORY == align->d_object.d_magicNumber
+         && this             == align->d_object.d_id_p
+         && size             != align->d_object.d_bytes) {
+            d_numDeallocations.addRelaxed(1);
+            d_lastDeallocatedAddress_p.storeRelaxed(
+                                             reinterpret_cast<int *>(address));
+            d_lastDeallocatedNumBytes.storeRelaxed(0);
+            d_numMismatches.addRelaxed(1);
+
+            if (isQuiet()) {
+                return;                                               // RETURN
+            }
+
+            std::printf("*** Sized deallocation of " ZU " byte segment at %p"
+                        " supplied size " ZU ". ***\n",
+                        align->d_object.d_bytes,
+                        address,
+                        size);
+            std::fflush(stdout);
+
+            if (isNoAbort()) {
+                return;                                               // RETURN
+            }
+
+            std::abort();                                             // ABORT
+        }
+    }
+
+    deallocate(address);
+}
+
 // MANIPULATORS
 void *TestAllocator::allocate(size_type size)
 {
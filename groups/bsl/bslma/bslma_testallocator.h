@@ -75,6 +75,12 @@ BSLS_IDENT("$Id: $")
 // deallocation to see if they have been modified.  If they have, a message is
 // printed and the allocator aborts, unless it is in quiet mode.
 //
+// A block returned through the sized 'deallocate(address, size, alignment)'
+// overload of the 'bslma::Allocator' protocol (as 'bsl::allocator' does) is
+// also checked against the size originally requested for it: a sized
+// deallocation supplying any other size is reported as a mismatch, and the
+// block is left allocated.
+//
 ///Detecting Memory Leaks
 ///----------------------
 // The 'bslma::TestAllocator' is useful for detecting memory leaks, unless
@@ -430,6 +436,23 @@ class TestAllocator : public Allocator {
     TestAllocator(const TestAllocator&);             // = delete
     TestAllocator& operator=(const TestAllocator&);  // = delete
 
+  protected:
+    // PROTECTED MANIPULATORS
+    void doDeallocate(void      *address,
+                      size_type  size,
+                      size_type  alignment);
+        // Return the memory block at the specified 'address' back to this
+        // allocator as if by 'deallocate(address)', after verifying that the
+        // specified 'size' is the size originally requested for the block.
+        // If 'address' is consistent with being allocated from this test
+        // allocator but 'size' differs from the size originally requested,
+        // increment the number of mismatches, leave the block allocated, and
+        // -- unless in quiet mode -- immediately report the details of the
+        // mismatch to 'stdout' and abort.  The specified 'alignment' is
+        // ignored.  Note that this method is invoked by the sized overload
+        // 'Allocator::deallocate(address, size, alignment)' (see
+        // {'bslma_allocator'|Sized Deallocation}).
+
   public:
     // CREATORS
     explicit
@@ -614,7 +637,8 @@ class TestAllocator : public Allocator {
         // Return the number of mismatched memory deallocations that have
         // occurred since this object was created.  A memory deallocation is
         // *mismatched* if that memory was not allocated directly from this
-        // allocator.
+        // allocator, or if it is a sized deallocation supplying a size other
+        // than the size originally requested for the block.
 
     void print() const;
         // Write the accumulated state information held in this allocator to
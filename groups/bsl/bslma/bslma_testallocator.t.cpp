@@ -89,7 +89,8 @@ using namespace BloombergLP;
 // [12] void print() const;
 // [ 2] int status() const;
 //-----------------------------------------------------------------------------
-// [16] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
+// [16] Ensure that inaccurate sized deallocations are detected/reported.
 // [15] DRQS 129104858
 // [ 5] Ensure that exception is thrown after allocation limit is exceeded.
 // [ 1] Make sure that all counts are initialized to zero (placement new).
@@ -798,7 +799,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVeryVerbose);
 
     switch (test) { case 0:
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -923,6 +924,75 @@ int main(int argc, char *argv[])
 // indicate whether or not exceptions are enabled.
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // SIZED DEALLOCATION
+        //   Ensure that inaccurate sized deallocations are detected.
+        //
+        // Concerns:
+        //: 1 A sized deallocation supplying the size originally requested
+        //:   for the block deallocates the block exactly as 'deallocate'
+        //:   does.
+        //:
+        //: 2 A sized deallocation supplying any other size is counted as a
+        //:   mismatch and leaves the block allocated.
+        //:
+        //: 3 A sized deallocation of a null pointer has no effect other than
+        //:   to record statistics.
+        //
+        // Plan:
+        //: 1 Using a quiet test allocator, allocate a block and return it
+        //:   through the sized 'deallocate' of the base class supplying a
+        //:   larger and a smaller size, and verify that the mismatch count is
+        //:   incremented and the block remains in use.  (C-2)
+        //:
+        //: 2 Return the block supplying the correct size and verify that it
+        //:   is deallocated without a mismatch.  (C-1)
+        //:
+        //: 3 Return a null pointer through the sized 'deallocate'.  (C-3)
+        //
+        // Testing:
+        //   Ensure that inaccurate sized deallocations are detected/reported.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSIZED DEALLOCATION"
+                            "\n==================\n");
+
+        Obj               mX(veryVeryVeryVerbose);
+        const Obj&        X    = mX;
+        bslma::Allocator *base = &mX;
+
+        mX.setQuiet(true);
+
+        void *p = mX.allocate(24);
+
+        if (verbose) printf("\tInaccurate sizes.\n");
+
+        base->deallocate(p, 32, 8);
+        ASSERTV(X.numMismatches(),  1 == X.numMismatches());
+        ASSERTV(X.numBlocksInUse(), 1 == X.numBlocksInUse());
+        ASSERTV(X.numBytesInUse(), 24 == X.numBytesInUse());
+
+        base->deallocate(p, 16, 8);
+        ASSERTV(X.numMismatches(),  2 == X.numMismatches());
+        ASSERTV(X.numBlocksInUse(), 1 == X.numBlocksInUse());
+        ASSERTV(X.numDeallocations(), 2 == X.numDeallocations());
+
+        if (verbose) printf("\tAccurate size.\n");
+
+        base->deallocate(p, 24, 8);
+        ASSERTV(X.numMismatches(),  2 == X.numMismatches());
+        ASSERTV(X.numBlocksInUse(), 0 == X.numBlocksInUse());
+        ASSERTV(X.numBytesInUse(),  0 == X.numBytesInUse());
+        ASSERTV(X.lastDeallocatedNumBytes(),
+                24 == X.lastDeallocatedNumBytes());
+
+        if (verbose) printf("\tNull pointer.\n");
+
+        base->deallocate(0, 0, 1);
+        ASSERTV(X.numMismatches(),    2 == X.numMismatches());
+        ASSERTV(X.numDeallocations(), 4 == X.numDeallocations());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // DRQS 129104858
@@ -25,6 +25,7 @@ BSLS_IDENT("$Id: $")
 //  BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR: 'constexpr' specifier
 //  BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR_CPP14: C++14 'constexpr' spec.
 //  BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR_CPP17: C++17 'constexpr' spec.
+//  BSLS_COMPILERFEATURES_SUPPORT_COROUTINE: flag for C++20 coroutines
 //  BSLS_COMPILERFEATURES_SUPPORT_CTAD: flag for template argument deduction
 //  BSLS_COMPILERFEATURES_SUPPORT_DECLTYPE: flag for 'decltype'
 //  BSLS_COMPILERFEATURES_SUPPORT_DEFAULT_TEMPLATE_ARGS: for function templates
@@ -228,6 +229,12 @@ BSLS_IDENT("$Id: $")
 //:     by the current compiler settings for this platform.  In particular,
 //:     this allows lambda functions to be defined in a 'constexpr' function.
 //:
+//: 'BSLS_COMPILERFEATURES_SUPPORT_COROUTINE':
+//:     This macro is defined if the coroutines introduced in the C++20
+//:     Standard ('co_await', 'co_yield', and 'co_return') are supported by the
+//:     current compiler settings for this platform, and the standard library
+//:     provides the '<coroutine>' header.
+//:
 //: 'BSLS_COMPILERFEATURES_SUPPORT_CTAD':
 //:     This macro is defined if template argument deduction introduced in the
 //:     C++17 Standard are supported by the current compiler settings for this
@@ -621,6 +628,16 @@ BSLS_IDENT("$Id: $")
 //:   o IBM xlC not supported?
 //:   o Oracle CC 12.4
 //
+///'BSLS_COMPILERFEATURES_SUPPORT_COROUTINE'
+///- - - - - - - - - - - - - - - - - - - - -
+// This macro is defined if the compiler supports C++20 coroutines and the
+// standard library provides the '<coroutine>' header.
+//
+//: o Compiler support:
+//:   o GCC 10.1
+//:   o Clang 14.0 (with a '<coroutine>' header)
+//:   o Visual Studio 2019 version 16.8 (_MSC_VER 1928)
+//
 ///'BSLS_COMPILERFEATURES_SUPPORT_DEFAULTED_FUNCTIONS'
 ///- - - - - - - - - - - - - - - - - - - - - - - - - -
 // This macro is defined if the compiler supports syntax to introduce defaulted
@@ -1006,6 +1023,16 @@ BSLS_IDENT("$Id: $")
   #define BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON                  1
 #endif
 
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L &&      \
+                                                       defined(__has_include)
+  // Older standard libraries paired with a coroutine-capable compiler provide
+  // only '<experimental/coroutine>', so also require the standard header.
+
+  #if __has_include(<coroutine>)
+    #define BSLS_COMPILERFEATURES_SUPPORT_COROUTINE                           1
+  #endif
+#endif
+
 #if defined(__cplusplus)
   #define BSLS_COMPILERFEATURES_CPLUSPLUS __cplusplus
 #else
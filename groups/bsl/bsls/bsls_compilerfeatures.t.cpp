@@ -16,6 +16,10 @@
     #include <compare>
 #endif
 
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+    #include <coroutine>
+#endif
+
 #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
     #include <initializer_list>
 #endif
@@ -50,6 +54,7 @@
 // [ 2] BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR
 // [ 3] BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR_CPP14
 // [ 4] BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR_CPP17
+// [37] BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
 // [34] BSLS_COMPILERFEATURES_SUPPORT_CTAD
 // [ 5] BSLS_COMPILERFEATURES_SUPPORT_DECLTYPE
 // [  ] BSLS_COMPILERFEATURES_SUPPORT_DEFAULT_TEMPLATE_ARGS
@@ -84,7 +89,7 @@
 // [  ] BSLS_COMPILERFEATURES_FORWARD_REF
 // [  ] BSLS_COMPILERFEATURES_FORWARD
 // ----------------------------------------------------------------------------
-// [37] USAGE EXAMPLE
+// [38] USAGE EXAMPLE
 
 #ifdef BDE_VERIFY
 // Suppress some pedantic bde_verify checks in this test driver
@@ -1102,6 +1107,69 @@ Holder(const T &) -> Holder<T>;
 #endif
 }  // close namespace test_case_34
 
+namespace test_case_37 {
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+
+struct Counter {
+    // A minimal coroutine return type whose coroutine suspends on every
+    // 'co_yield' and is resumed by the caller.  Used to test that a coroutine
+    // can be defined, suspended, resumed, and destroyed.
+
+    struct promise_type {
+        // PUBLIC DATA
+        int d_value;
+
+        // MANIPULATORS
+        Counter get_return_object()
+        {
+            return Counter(
+                  std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        std::suspend_always yield_value(int value)
+        {
+            d_value = value;
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {}
+    };
+
+    // DATA
+    std::coroutine_handle<promise_type> d_handle;
+
+    // CREATORS
+    explicit Counter(std::coroutine_handle<promise_type> handle)
+        // Create a 'Counter' owning the coroutine referred to by the specified
+        // 'handle'.
+    : d_handle(handle)
+    {
+    }
+
+    ~Counter()
+        // Destroy this object and the coroutine it owns.
+    {
+        d_handle.destroy();
+    }
+};
+
+Counter countTo(int limit)
+    // Yield the values from 1 through the specified 'limit', in order.
+{
+    for (int i = 1; i <= limit; ++i) {
+        co_yield i;
+    }
+}
+
+#endif
+}  // close namespace test_case_37
+
 // ============================================================================
 //                              HELPER FUNCTIONS
 // ----------------------------------------------------------------------------
@@ -1471,6 +1539,13 @@ static void printFlags()
     puts("UNDEFINED");
 #endif
 
+    fputs("\n  BSLS_COMPILERFEATURES_SUPPORT_COROUTINE: ", stdout);
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+    puts(STRINGIFY(BSLS_COMPILERFEATURES_SUPPORT_COROUTINE));
+#else
+    puts("UNDEFINED");
+#endif
+
     puts("\n\n==printFlags: bsls_compilerfeatures Referenced Macros==");
 
     fputs("\n  BSLS_COMPILERFEATURES_SIMULATE_FORWARD_WORKAROUND: ", stdout);
@@ -1725,7 +1800,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 37: {
+      case 38: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1806,6 +1881,54 @@ int main(int argc, char *argv[])
 // compilers) that further, more complicated or even indeterminate behaviors
 // may arise.
 #undef THATS_MY_LINE
+      } break;
+      case 37: {
+        // --------------------------------------------------------------------
+        // TESTING 'BSLS_COMPILERFEATURES_SUPPORT_COROUTINE'
+        //
+        // Concerns:
+        //: 1 'BSLS_COMPILERFEATURES_SUPPORT_COROUTINE' is defined only when
+        //:   '__cpp_impl_coroutine' is defined and has a value as defined by
+        //:   the ISO C++20 or greater.
+        //:
+        //: 2 When the macro is defined, the '<coroutine>' header is available
+        //:   and a coroutine can be suspended, resumed, and destroyed.
+        //
+        // Plan:
+        //: 1 Verify that '__cpp_impl_coroutine' is defined and has a value at
+        //:   least '201902L' when the macro is defined.  (C-1)
+        //:
+        //: 2 Define a coroutine that yields a sequence of values, resume it
+        //:   until it completes, and verify the yielded values.  (C-2)
+        //
+        // Testing:
+        //   BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        // --------------------------------------------------------------------
+        MACRO_TEST_TITLE("_SUPPORT_COROUTINE",
+                         "==================");
+
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_COROUTINE
+        ASSERTV(__cpp_impl_coroutine, __cpp_impl_coroutine >= 201902L);
+
+        {
+            test_case_37::Counter counter = test_case_37::countTo(3);
+
+            ASSERT(!counter.d_handle.done());
+
+            int expected = 1;
+            for (counter.d_handle.resume();
+                 !counter.d_handle.done();
+                 counter.d_handle.resume()) {
+                ASSERTV(expected, counter.d_handle.promise().d_value,
+                        expected == counter.d_handle.promise().d_value);
+                ++expected;
+            }
+            ASSERTV(expected, 4 == expected);
+        }
+#else
+        if (verbose) printf("Coroutines are not supported in this "
+                            "configuration\n");
+#endif
       } break;
       case 36: {
         // --------------------------------------------------------------------
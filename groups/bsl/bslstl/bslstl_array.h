@@ -896,10 +896,9 @@ void hashAppend(HASH_ALGORITHM& hashAlgorithm, const array<TYPE, SIZE>& input)
     using ::BloombergLP::bslh::hashAppend;
 
     hashAppend(hashAlgorithm, SIZE);
-    for (size_t i = 0; i < SIZE; ++i)
-    {
-        hashAppend(hashAlgorithm, input[i]);
-    }
+    ::BloombergLP::bslh::hashAppendContiguous(hashAlgorithm,
+                                              input.data(),
+                                              SIZE);
 }
 
 // suppress comparison of 'unsigned' expression is always false warnings
@@ -1036,11 +1035,7 @@ void hashAppend(HASH_ALGORITHM&               hashAlgorithm,
     using ::BloombergLP::bslh::hashAppend;
 
     hashAppend(hashAlgorithm, SIZE);
-    if BSLS_KEYWORD_CONSTEXPR_CPP17 (SIZE > 0) {
-        for (size_t i = 0; i < SIZE; ++i) {
-            hashAppend(hashAlgorithm, input[i]);
-        }
-    }
+    hashAppendContiguous(hashAlgorithm, input.data(), SIZE);
 }
 
 }  // close namespace bslh
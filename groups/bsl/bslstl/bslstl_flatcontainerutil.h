@@ -0,0 +1,855 @@
+// bslstl_flatcontainerutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATCONTAINERUTIL
+#define INCLUDED_BSLSTL_FLATCONTAINERUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide tag types and algorithms shared by the flat containers.
+//
+//@CLASSES:
+//  bsl::sorted_unique_t: tag for input that is sorted with unique keys
+//  bsl::sorted_equivalent_t: tag for input that is sorted
+//  bslstl::FlatContainerUtil: sorted-sequence search and merge algorithms
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatmultimap, bslstl_flatset
+//
+//@DESCRIPTION: This component provides the tag types 'bsl::sorted_unique_t'
+// and 'bsl::sorted_equivalent_t' (and the corresponding tag values
+// 'bsl::sorted_unique' and 'bsl::sorted_equivalent') specified by C++23 for
+// the flat container adaptors, along with a utility 'struct',
+// 'bslstl::FlatContainerUtil', providing the algorithms on which those
+// adaptors are built.
+//
+// A flat container keeps its elements in a single contiguous, sorted sequence
+// container (by default, a 'bsl::vector').  Compared to a node-based
+// container such as 'bsl::map', lookup touches far fewer cache lines,
+// iteration is a linear scan of memory, and there is no per-element allocation
+// overhead; the price is that inserting or erasing a single element is linear
+// in the size of the container.  Flat containers are therefore well suited to
+// read-mostly lookup tables that are populated in bulk.
+//
+// The tag types are passed to the constructors and 'insert' methods of the
+// flat containers to indicate that the supplied range is already sorted
+// ('sorted_equivalent') or is sorted *and* free of duplicate keys
+// ('sorted_unique'), so that the container can skip its sorting (and
+// duplicate-removal) step.  Supplying a tag for a range that does not satisfy
+// the corresponding precondition results in undefined behavior.
+//
+// The algorithms in 'bslstl::FlatContainerUtil' are parameterized by a
+// 'KEY_POLICY' type that extracts the key from an element, so that the same
+// algorithms serve both the set adaptors (where the element *is* the key; see
+// 'bslstl::FlatContainerUtil_IdentityKey') and the map adaptors (where the key
+// is the 'first' member of a pair; see
+// 'bslstl::FlatContainerUtil_PairFirstKey').
+//
+///Branchless Search
+///-----------------
+// 'FlatContainerUtil::lowerBound' and 'FlatContainerUtil::upperBound' use a
+// "branchless" formulation of binary search: on each iteration the size of the
+// candidate range is halved unconditionally, and only the *start* of the range
+// depends on the result of the comparison.  This lets the compiler select the
+// next range with a conditional move rather than a conditional branch, which
+// avoids the branch mispredictions that dominate the cost of a conventional
+// binary search over data that is resident in cache.
+//
+///Memory Allocation
+///-----------------
+// 'FlatContainerUtil::merge' and 'FlatContainerUtil::sortAndMerge' need
+// temporary storage to merge (and stably sort) elements.  Rather than use
+// 'std::inplace_merge' and 'std::stable_sort', which obtain such storage from
+// the global 'operator new', these algorithms obtain it from the allocator of
+// the container on which they operate, so that a flat container using a
+// 'bslma' allocator allocates no memory from any other source.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Sorted 'bsl::vector' of Pairs
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a sorted 'bsl::vector' of '(code, name)' pairs by hand,
+// and want to look up entries by code.
+//
+// First, we create the table:
+//..
+//  typedef bsl::pair<int, const char *> Entry;
+//
+//  bsl::vector<Entry> table;
+//  table.push_back(Entry(10, "ten"));
+//  table.push_back(Entry(20, "twenty"));
+//  table.push_back(Entry(30, "thirty"));
+//..
+// Then, we search the table by key, supplying the policy that extracts the
+// 'first' member of each element:
+//..
+//  typedef bslstl::FlatContainerUtil_PairFirstKey KeyPolicy;
+//
+//  std::less<int>                     comparator;
+//  bsl::vector<Entry>::const_iterator it =
+//           bslstl::FlatContainerUtil::lowerBound<KeyPolicy>(table.cbegin(),
+//                                                            table.cend(),
+//                                                            20,
+//                                                            comparator);
+//  assert(table.cend() != it);
+//  assert(0 == strcmp("twenty", it->second));
+//..
+// Next, we append two more entries out of order:
+//..
+//  table.push_back(Entry(25, "twenty-five"));
+//  table.push_back(Entry(5,  "five"));
+//..
+// Finally, we restore the sorted order of the table by merging the unsorted
+// tail (starting at index 3) into the sorted prefix:
+//..
+//  bslstl::FlatContainerUtil::sortAndMerge<KeyPolicy>(&table, 3, comparator);
+//  assert(5  == table.size());
+//  assert(5  == table[0].first);
+//  assert(25 == table[3].first);
+//  assert(bslstl::FlatContainerUtil::isSorted<KeyPolicy>(table.cbegin(),
+//                                                        table.cend(),
+//                                                        comparator));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <algorithm>
+
+namespace bsl {
+
+                           // ======================
+                           // struct sorted_unique_t
+                           // ======================
+
+struct sorted_unique_t {
+    // This trivial tag type is passed to the constructors and 'insert'
+    // methods of the flat container adaptors to indicate that the supplied
+    // range is sorted with respect to the container's comparator and contains
+    // no two elements having equivalent keys.
+
+    // CREATORS
+    explicit BSLS_KEYWORD_CONSTEXPR sorted_unique_t() BSLS_KEYWORD_NOEXCEPT;
+        // Create a 'sorted_unique_t' value.
+};
+
+                         // ==========================
+                         // struct sorted_equivalent_t
+                         // ==========================
+
+struct sorted_equivalent_t {
+    // This trivial tag type is passed to the constructors and 'insert'
+    // methods of the flat container adaptors to indicate that the supplied
+    // range is sorted with respect to the container's comparator (but may
+    // contain elements having equivalent keys).
+
+    // CREATORS
+    explicit BSLS_KEYWORD_CONSTEXPR sorted_equivalent_t()
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Create a 'sorted_equivalent_t' value.
+};
+
+// CREATORS
+inline
+BSLS_KEYWORD_CONSTEXPR sorted_unique_t::sorted_unique_t() BSLS_KEYWORD_NOEXCEPT
+{
+    // This 'constexpr' function has to be defined before initializing the
+    // 'constexpr' value, 'sorted_unique', below.
+}
+
+inline
+BSLS_KEYWORD_CONSTEXPR
+sorted_equivalent_t::sorted_equivalent_t() BSLS_KEYWORD_NOEXCEPT
+{
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_INLINE_VARIABLES)
+inline constexpr sorted_unique_t     sorted_unique     = sorted_unique_t();
+inline constexpr sorted_equivalent_t sorted_equivalent = sorted_equivalent_t();
+#else
+extern const sorted_unique_t     sorted_unique;
+extern const sorted_equivalent_t sorted_equivalent;
+#endif
+    // Values of type 'sorted_unique_t' and 'sorted_equivalent_t' used as
+    // arguments to functions that take the corresponding tag argument.
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace bslstl {
+
+                    // ====================================
+                    // struct FlatContainerUtil_IdentityKey
+                    // ====================================
+
+struct FlatContainerUtil_IdentityKey {
+    // This 'struct' provides a key-extraction policy for containers whose
+    // elements are their own keys.
+
+    // CLASS METHODS
+    template <class VALUE_TYPE>
+    static const VALUE_TYPE& key(const VALUE_TYPE& value);
+        // Return a reference providing non-modifiable access to the specified
+        // 'value'.
+};
+
+                   // =====================================
+                   // struct FlatContainerUtil_PairFirstKey
+                   // =====================================
+
+struct FlatContainerUtil_PairFirstKey {
+    // This 'struct' provides a key-extraction policy for containers whose
+    // elements are pairs keyed by their 'first' member.
+
+    // CLASS METHODS
+    template <class PAIR_TYPE>
+    static const typename PAIR_TYPE::first_type& key(const PAIR_TYPE& value);
+        // Return a reference providing non-modifiable access to the 'first'
+        // member of the specified 'value'.
+};
+
+                  // =======================================
+                  // class FlatContainerUtil_ValueComparator
+                  // =======================================
+
+template <class KEY_POLICY, class COMPARATOR>
+class FlatContainerUtil_ValueComparator {
+    // This class provides a functor that orders elements by applying a key
+    // comparator to the keys extracted from those elements by the (template
+    // parameter) 'KEY_POLICY'.
+
+    // DATA
+    const COMPARATOR *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+    explicit FlatContainerUtil_ValueComparator(const COMPARATOR& comparator);
+        // Create a functor that orders elements using the specified key
+        // 'comparator'.
+
+    // ACCESSORS
+    template <class VALUE_TYPE>
+    bool operator()(const VALUE_TYPE& lhs, const VALUE_TYPE& rhs) const;
+        // Return 'true' if the key of the specified 'lhs' is ordered before
+        // the key of the specified 'rhs', and 'false' otherwise.
+};
+
+                // ===========================================
+                // class FlatContainerUtil_EquivalentPredicate
+                // ===========================================
+
+template <class KEY_POLICY, class COMPARATOR>
+class FlatContainerUtil_EquivalentPredicate {
+    // This class provides a binary predicate that, applied to two *adjacent*
+    // elements of a sorted sequence, returns 'true' if they have equivalent
+    // keys.
+
+    // DATA
+    const COMPARATOR *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+    explicit FlatContainerUtil_EquivalentPredicate(
+                                                 const COMPARATOR& comparator);
+        // Create a predicate that compares keys using the specified
+        // 'comparator'.
+
+    // ACCESSORS
+    template <class VALUE_TYPE>
+    bool operator()(const VALUE_TYPE& lhs, const VALUE_TYPE& rhs) const;
+        // Return 'true' if the key of the specified 'lhs' is *not* ordered
+        // before the key of the specified 'rhs', and 'false' otherwise.  The
+        // behavior is undefined unless 'rhs' is not ordered before 'lhs'.
+        // Note that, given that precondition, this predicate returns 'true'
+        // if and only if the two keys are equivalent.
+};
+
+                    // ====================================
+                    // class FlatContainerUtil_ClearProctor
+                    // ====================================
+
+template <class CONTAINER>
+class FlatContainerUtil_ClearProctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // invoked, clears the container it manages on destruction.  A flat
+    // container uses this proctor to restore its invariant (that its elements
+    // are sorted) if an exception is thrown while its elements are being
+    // rearranged, leaving the container empty.
+
+    // DATA
+    CONTAINER *d_container_p;  // managed container (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    FlatContainerUtil_ClearProctor(const FlatContainerUtil_ClearProctor&);
+    FlatContainerUtil_ClearProctor& operator=(
+                                        const FlatContainerUtil_ClearProctor&);
+
+  public:
+    // CREATORS
+    explicit FlatContainerUtil_ClearProctor(CONTAINER *container);
+        // Create a proctor managing the specified 'container'.
+
+    ~FlatContainerUtil_ClearProctor();
+        // Destroy this proctor, and clear the managed container unless
+        // 'release' has been called.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the container managed by this proctor.
+};
+
+                     // ==================================
+                     // struct FlatContainerUtil_MergeUtil
+                     // ==================================
+
+struct FlatContainerUtil_MergeUtil {
+    // This 'struct' provides a namespace for stable merge and sort algorithms
+    // that obtain their temporary storage from a caller-supplied sequence
+    // container (and so from the allocator of that container), rather than
+    // from the global 'operator new', as 'std::inplace_merge' and
+    // 'std::stable_sort' do.
+
+    // CLASS METHODS
+    template <class ITERATOR, class BUFFER, class VALUE_COMPARATOR>
+    static void merge(ITERATOR                 first,
+                      ITERATOR                 middle,
+                      ITERATOR                 last,
+                      BUFFER                  *buffer,
+                      const VALUE_COMPARATOR&  comparator);
+        // Stably merge the sorted ranges '[first, middle)' and
+        // '[middle, last)', so that '[first, last)' is sorted with respect to
+        // the specified 'comparator', using the specified 'buffer' to hold the
+        // elements of '[middle, last)' while they are merged.  Elements of
+        // '[first, middle)' are ordered before equivalent elements of
+        // '[middle, last)'.  'buffer' is empty on return.  The behavior is
+        // undefined unless both ranges are sorted with respect to
+        // 'comparator', and 'buffer' is empty.
+
+    template <class ITERATOR, class BUFFER, class VALUE_COMPARATOR>
+    static void stableSort(ITERATOR                 first,
+                           ITERATOR                 last,
+                           BUFFER                  *buffer,
+                           const VALUE_COMPARATOR&  comparator);
+        // Stably sort the range '[first, last)' with respect to the specified
+        // 'comparator', using the specified 'buffer' to hold at most half of
+        // the elements of the range at a time.  'buffer' is empty on return.
+        // The behavior is undefined unless 'buffer' is empty.
+};
+
+                          // ========================
+                          // struct FlatContainerUtil
+                          // ========================
+
+struct FlatContainerUtil {
+    // This 'struct' provides a namespace for the algorithms on sorted
+    // sequences used to implement the flat container adaptors.  Each
+    // algorithm is parameterized by a 'KEY_POLICY' type providing a static
+    // 'key' method that returns the key of an element, and by a 'COMPARATOR'
+    // type that imposes a strict weak ordering on keys.
+
+    // CLASS METHODS
+    template <class KEY_POLICY,
+              class ITERATOR,
+              class LOOKUP_KEY,
+              class COMPARATOR>
+    static ITERATOR lowerBound(ITERATOR           first,
+                               ITERATOR           last,
+                               const LOOKUP_KEY&  key,
+                               const COMPARATOR&  comparator);
+        // Return an iterator to the first element in the specified range
+        // '[first, last)' whose key is not ordered before the specified 'key'
+        // by the specified 'comparator', and 'last' if there is no such
+        // element.  The behavior is undefined unless '[first, last)' is a
+        // valid range of random-access iterators that is sorted with respect
+        // to 'comparator'.
+
+    template <class KEY_POLICY,
+              class ITERATOR,
+              class LOOKUP_KEY,
+              class COMPARATOR>
+    static ITERATOR upperBound(ITERATOR           first,
+                               ITERATOR           last,
+                               const LOOKUP_KEY&  key,
+                               const COMPARATOR&  comparator);
+        // Return an iterator to the first element in the specified range
+        // '[first, last)' whose key is ordered after the specified 'key' by
+        // the specified 'comparator', and 'last' if there is no such element.
+        // The behavior is undefined unless '[first, last)' is a valid range of
+        // random-access iterators that is sorted with respect to 'comparator'.
+
+    template <class KEY_POLICY, class ITERATOR, class COMPARATOR>
+    static bool isSorted(ITERATOR          first,
+                         ITERATOR          last,
+                         const COMPARATOR& comparator);
+        // Return 'true' if no element in the specified range '[first, last)'
+        // has a key that is ordered (by the specified 'comparator') before the
+        // key of the element preceding it, and 'false' otherwise.
+
+    template <class KEY_POLICY, class ITERATOR, class COMPARATOR>
+    static bool isSortedUnique(ITERATOR          first,
+                               ITERATOR          last,
+                               const COMPARATOR& comparator);
+        // Return 'true' if every element in the specified range
+        // '[first, last)' has a key that is ordered (by the specified
+        // 'comparator') after the key of the element preceding it, and 'false'
+        // otherwise.
+
+    template <class KEY_POLICY, class CONTAINER, class COMPARATOR>
+    static void eraseDuplicates(CONTAINER         *container,
+                                const COMPARATOR&  comparator);
+        // Erase from the specified 'container' every element whose key is
+        // equivalent (with respect to the specified 'comparator') to that of
+        // the element preceding it.  The first element of each run of
+        // equivalent elements is retained.  The behavior is undefined unless
+        // 'container' is sorted with respect to 'comparator'.
+
+    template <class KEY_POLICY, class CONTAINER, class COMPARATOR>
+    static void merge(CONTAINER                    *container,
+                      typename CONTAINER::size_type position,
+                      const COMPARATOR&             comparator);
+        // Merge the sorted subsequence of the specified 'container' starting
+        // at the specified 'position' into the sorted subsequence preceding
+        // 'position', so that the entire 'container' is sorted with respect
+        // to the specified 'comparator'.  The merge is stable: elements
+        // originally preceding 'position' are ordered before equivalent
+        // elements originally following it.  Temporary storage, if needed,
+        // is obtained from the allocator of 'container'.  The behavior is
+        // undefined unless 'position <= container->size()' and both
+        // subsequences are sorted with respect to 'comparator'.
+
+    template <class KEY_POLICY, class CONTAINER, class COMPARATOR>
+    static void sortAndMerge(CONTAINER                    *container,
+                             typename CONTAINER::size_type position,
+                             const COMPARATOR&             comparator);
+        // Stably sort the subsequence of the specified 'container' starting at
+        // the specified 'position', and merge it into the sorted subsequence
+        // preceding 'position', so that the entire 'container' is sorted with
+        // respect to the specified 'comparator'.  Elements originally
+        // preceding 'position' are ordered before equivalent elements
+        // originally following it, and the relative order of equivalent
+        // elements originally following 'position' is preserved.  Temporary
+        // storage, if needed, is obtained from the allocator of 'container'.
+        // The behavior is undefined unless 'position <= container->size()'
+        // and the subsequence preceding 'position' is sorted with respect to
+        // 'comparator'.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                    // ------------------------------------
+                    // struct FlatContainerUtil_IdentityKey
+                    // ------------------------------------
+
+// CLASS METHODS
+template <class VALUE_TYPE>
+inline
+const VALUE_TYPE&
+FlatContainerUtil_IdentityKey::key(const VALUE_TYPE& value)
+{
+    return value;
+}
+
+                   // -------------------------------------
+                   // struct FlatContainerUtil_PairFirstKey
+                   // -------------------------------------
+
+// CLASS METHODS
+template <class PAIR_TYPE>
+inline
+const typename PAIR_TYPE::first_type&
+FlatContainerUtil_PairFirstKey::key(const PAIR_TYPE& value)
+{
+    return value.first;
+}
+
+                  // ---------------------------------------
+                  // class FlatContainerUtil_ValueComparator
+                  // ---------------------------------------
+
+// CREATORS
+template <class KEY_POLICY, class COMPARATOR>
+inline
+FlatContainerUtil_ValueComparator<KEY_POLICY, COMPARATOR>::
+              FlatContainerUtil_ValueComparator(const COMPARATOR& comparator)
+: d_comparator_p(&comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY_POLICY, class COMPARATOR>
+template <class VALUE_TYPE>
+inline
+bool FlatContainerUtil_ValueComparator<KEY_POLICY, COMPARATOR>::operator()(
+                                                  const VALUE_TYPE& lhs,
+                                                  const VALUE_TYPE& rhs) const
+{
+    return (*d_comparator_p)(KEY_POLICY::key(lhs), KEY_POLICY::key(rhs));
+}
+
+                // -------------------------------------------
+                // class FlatContainerUtil_EquivalentPredicate
+                // -------------------------------------------
+
+// CREATORS
+template <class KEY_POLICY, class COMPARATOR>
+inline
+FlatContainerUtil_EquivalentPredicate<KEY_POLICY, COMPARATOR>::
+          FlatContainerUtil_EquivalentPredicate(const COMPARATOR& comparator)
+: d_comparator_p(&comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY_POLICY, class COMPARATOR>
+template <class VALUE_TYPE>
+inline
+bool FlatContainerUtil_EquivalentPredicate<KEY_POLICY, COMPARATOR>::operator()(
+                                                  const VALUE_TYPE& lhs,
+                                                  const VALUE_TYPE& rhs) const
+{
+    return !(*d_comparator_p)(KEY_POLICY::key(lhs), KEY_POLICY::key(rhs));
+}
+
+                    // ------------------------------------
+                    // class FlatContainerUtil_ClearProctor
+                    // ------------------------------------
+
+// CREATORS
+template <class CONTAINER>
+inline
+FlatContainerUtil_ClearProctor<CONTAINER>::FlatContainerUtil_ClearProctor(
+                                                          CONTAINER *container)
+: d_container_p(container)
+{
+}
+
+template <class CONTAINER>
+inline
+FlatContainerUtil_ClearProctor<CONTAINER>::~FlatContainerUtil_ClearProctor()
+{
+    if (d_container_p) {
+        d_container_p->clear();
+    }
+}
+
+// MANIPULATORS
+template <class CONTAINER>
+inline
+void FlatContainerUtil_ClearProctor<CONTAINER>::release()
+{
+    d_container_p = 0;
+}
+
+                     // ----------------------------------
+                     // struct FlatContainerUtil_MergeUtil
+                     // ----------------------------------
+
+// CLASS METHODS
+template <class ITERATOR, class BUFFER, class VALUE_COMPARATOR>
+void FlatContainerUtil_MergeUtil::merge(ITERATOR                 first,
+                                        ITERATOR                 middle,
+                                        ITERATOR                 last,
+                                        BUFFER                  *buffer,
+                                        const VALUE_COMPARATOR&  comparator)
+{
+    BSLS_ASSERT_SAFE(buffer);
+    BSLS_ASSERT_SAFE(buffer->empty());
+
+    typedef typename BUFFER::iterator BufferIterator;
+
+    // Move the second range (typically the shorter, e.g., elements appended
+    // to a flat container) into the buffer, and merge from the back, so that
+    // each element is moved into its final position exactly once.
+
+    for (ITERATOR it = middle; it != last; ++it) {
+        buffer->push_back(BloombergLP::bslmf::MovableRefUtil::move(*it));
+    }
+
+    const BufferIterator bufferBegin = buffer->begin();
+    BufferIterator       bufferEnd   = buffer->end();
+    ITERATOR             out         = last;
+
+    while (bufferBegin != bufferEnd && first != middle) {
+        --out;
+        if (comparator(*(bufferEnd - 1), *(middle - 1))) {
+            --middle;
+            *out = BloombergLP::bslmf::MovableRefUtil::move(*middle);
+        }
+        else {
+            --bufferEnd;
+            *out = BloombergLP::bslmf::MovableRefUtil::move(*bufferEnd);
+        }
+    }
+
+    while (bufferBegin != bufferEnd) {
+        --out;
+        --bufferEnd;
+        *out = BloombergLP::bslmf::MovableRefUtil::move(*bufferEnd);
+    }
+
+    buffer->clear();
+}
+
+template <class ITERATOR, class BUFFER, class VALUE_COMPARATOR>
+void FlatContainerUtil_MergeUtil::stableSort(
+                                           ITERATOR                 first,
+                                           ITERATOR                 last,
+                                           BUFFER                  *buffer,
+                                           const VALUE_COMPARATOR&  comparator)
+{
+    BSLS_ASSERT_SAFE(buffer);
+    BSLS_ASSERT_SAFE(buffer->empty());
+
+    typedef typename bsl::iterator_traits<ITERATOR>::difference_type
+                                                                DifferenceType;
+
+    enum { k_RUN_LENGTH = 16 };  // length of the runs sorted by insertion
+
+    // First, sort runs of 'k_RUN_LENGTH' elements by (stable) insertion sort,
+    // then merge adjacent runs of doubling length.
+
+    for (ITERATOR run = first; run != last; ) {
+        const ITERATOR runEnd = last - run > k_RUN_LENGTH
+                              ? run + k_RUN_LENGTH
+                              : last;
+
+        for (ITERATOR i = run + 1; i < runEnd; ++i) {
+            for (ITERATOR j = i; j != run && comparator(*j, *(j - 1)); --j) {
+                BloombergLP::bslalg::SwapUtil::swap(&*j, &*(j - 1));
+            }
+        }
+        run = runEnd;
+    }
+
+    const DifferenceType length = last - first;
+
+    for (DifferenceType width = k_RUN_LENGTH; width < length; width *= 2) {
+        ITERATOR left = first;
+        while (last - left > width) {
+            const ITERATOR middle = left + width;
+            const ITERATOR right  = last - middle > width
+                                  ? middle + width
+                                  : last;
+
+            if (comparator(*middle, *(middle - 1))) {
+                merge(left, middle, right, buffer, comparator);
+            }
+            left = right;
+        }
+    }
+}
+
+                          // ------------------------
+                          // struct FlatContainerUtil
+                          // ------------------------
+
+// CLASS METHODS
+template <class KEY_POLICY,
+          class ITERATOR,
+          class LOOKUP_KEY,
+          class COMPARATOR>
+inline
+ITERATOR FlatContainerUtil::lowerBound(ITERATOR           first,
+                                       ITERATOR           last,
+                                       const LOOKUP_KEY&  key,
+                                       const COMPARATOR&  comparator)
+{
+    typedef typename bsl::iterator_traits<ITERATOR>::difference_type
+                                                               DifferenceType;
+
+    // Note that the search is written so that the compiler can select the
+    // next range with a conditional move: the length of the range is halved
+    // on every iteration regardless of the outcome of the comparison.
+
+    DifferenceType length = last - first;
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    while (1 < length) {
+        const DifferenceType half = length / 2;
+
+        first  += comparator(KEY_POLICY::key(first[half - 1]), key) ? half : 0;
+        length -= half;
+    }
+
+    return first + (comparator(KEY_POLICY::key(*first), key) ? 1 : 0);
+}
+
+template <class KEY_POLICY,
+          class ITERATOR,
+          class LOOKUP_KEY,
+          class COMPARATOR>
+inline
+ITERATOR FlatContainerUtil::upperBound(ITERATOR           first,
+                                       ITERATOR           last,
+                                       const LOOKUP_KEY&  key,
+                                       const COMPARATOR&  comparator)
+{
+    typedef typename bsl::iterator_traits<ITERATOR>::difference_type
+                                                               DifferenceType;
+
+    DifferenceType length = last - first;
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    while (1 < length) {
+        const DifferenceType half = length / 2;
+
+        first  += comparator(key, KEY_POLICY::key(first[half - 1])) ? 0 : half;
+        length -= half;
+    }
+
+    return first + (comparator(key, KEY_POLICY::key(*first)) ? 0 : 1);
+}
+
+template <class KEY_POLICY, class ITERATOR, class COMPARATOR>
+bool FlatContainerUtil::isSorted(ITERATOR          first,
+                                 ITERATOR          last,
+                                 const COMPARATOR& comparator)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    for (ITERATOR next = first; ++next != last; first = next) {
+        if (comparator(KEY_POLICY::key(*next), KEY_POLICY::key(*first))) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_POLICY, class ITERATOR, class COMPARATOR>
+bool FlatContainerUtil::isSortedUnique(ITERATOR          first,
+                                       ITERATOR          last,
+                                       const COMPARATOR& comparator)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    for (ITERATOR next = first; ++next != last; first = next) {
+        if (!comparator(KEY_POLICY::key(*first), KEY_POLICY::key(*next))) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_POLICY, class CONTAINER, class COMPARATOR>
+void FlatContainerUtil::eraseDuplicates(CONTAINER         *container,
+                                        const COMPARATOR&  comparator)
+{
+    BSLS_ASSERT_SAFE(container);
+
+    container->erase(
+        std::unique(container->begin(),
+                    container->end(),
+                    FlatContainerUtil_EquivalentPredicate<KEY_POLICY,
+                                                          COMPARATOR>(
+                                                                 comparator)),
+        container->end());
+}
+
+template <class KEY_POLICY, class CONTAINER, class COMPARATOR>
+void FlatContainerUtil::merge(CONTAINER                    *container,
+                              typename CONTAINER::size_type position,
+                              const COMPARATOR&             comparator)
+{
+    BSLS_ASSERT_SAFE(container);
+    BSLS_ASSERT_SAFE(position <= container->size());
+
+    typedef typename CONTAINER::iterator                       Iterator;
+    typedef bsl::vector<typename CONTAINER::value_type,
+                        typename CONTAINER::allocator_type>    Buffer;
+
+    if (0 == position || container->size() == position) {
+        return;                                                       // RETURN
+    }
+
+    Iterator middle = container->begin() + position;
+
+    // Appending keys that all follow the existing ones is the common case for
+    // bulk loads, and requires no merge at all.
+
+    if (!comparator(KEY_POLICY::key(*middle),
+                    KEY_POLICY::key(*(middle - 1)))) {
+        return;                                                       // RETURN
+    }
+
+    Buffer buffer(container->get_allocator());
+    buffer.reserve(container->size() - position);
+
+    FlatContainerUtil_MergeUtil::merge(
+             container->begin(),
+             middle,
+             container->end(),
+             &buffer,
+             FlatContainerUtil_ValueComparator<KEY_POLICY, COMPARATOR>(
+                                                                 comparator));
+}
+
+template <class KEY_POLICY, class CONTAINER, class COMPARATOR>
+void FlatContainerUtil::sortAndMerge(CONTAINER                    *container,
+                                     typename CONTAINER::size_type position,
+                                     const COMPARATOR&             comparator)
+{
+    BSLS_ASSERT_SAFE(container);
+    BSLS_ASSERT_SAFE(position <= container->size());
+
+    typedef typename CONTAINER::iterator                       Iterator;
+    typedef bsl::vector<typename CONTAINER::value_type,
+                        typename CONTAINER::allocator_type>    Buffer;
+
+    Iterator middle = container->begin() + position;
+
+    if (!isSorted<KEY_POLICY>(middle, container->end(), comparator)) {
+        Buffer buffer(container->get_allocator());
+        buffer.reserve((container->size() - position) / 2);
+
+        FlatContainerUtil_MergeUtil::stableSort(
+             middle,
+             container->end(),
+             &buffer,
+             FlatContainerUtil_ValueComparator<KEY_POLICY, COMPARATOR>(
+                                                                 comparator));
+    }
+
+    merge<KEY_POLICY>(container, position, comparator);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
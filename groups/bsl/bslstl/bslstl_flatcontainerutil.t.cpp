@@ -0,0 +1,690 @@
+// bslstl_flatcontainerutil.t.cpp                                     -*-C++-*-
+#include <bslstl_flatcontainerutil.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a utility 'struct' of algorithms on
+// sorted sequences, together with a handful of small helper types.  The
+// algorithms are tested against the corresponding standard algorithms
+// ('std::lower_bound', 'std::upper_bound', 'std::unique', and
+// 'std::stable_sort') on exhaustively enumerated short sequences, with
+// particular attention to stability: each element carries a sequence number
+// in addition to its key, so that the relative order of elements having
+// equivalent keys can be observed.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] ITERATOR lowerBound<KP>(ITERATOR, ITERATOR, const K&, const C&);
+// [ 2] ITERATOR upperBound<KP>(ITERATOR, ITERATOR, const K&, const C&);
+// [ 3] bool isSorted<KP>(ITERATOR, ITERATOR, const C&);
+// [ 3] bool isSortedUnique<KP>(ITERATOR, ITERATOR, const C&);
+// [ 4] void eraseDuplicates<KP>(CONTAINER *, const C&);
+// [ 5] void merge<KP>(CONTAINER *, size_type, const C&);
+// [ 5] void sortAndMerge<KP>(CONTAINER *, size_type, const C&);
+//
+// HELPER CLASSES
+// [ 3] FlatContainerUtil_IdentityKey
+// [ 2] FlatContainerUtil_PairFirstKey
+// [ 6] FlatContainerUtil_ClearProctor
+// [ 1] sorted_unique_t, sorted_equivalent_t
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bslstl::FlatContainerUtil                Util;
+typedef bslstl::FlatContainerUtil_IdentityKey    IdentityKey;
+typedef bslstl::FlatContainerUtil_PairFirstKey   PairFirstKey;
+
+typedef bsl::pair<int, int>                      Element;
+    // An element is a '(key, sequence number)' pair; the sequence number
+    // records the original position of the element, so that stability can
+    // be observed.
+
+typedef bsl::vector<Element>                     Sequence;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct FirstLess {
+    // This 'struct' provides a comparator of 'Element' objects by key, for use
+    // with the standard algorithms.
+
+    bool operator()(const Element& lhs, const Element& rhs) const
+        // Return 'true' if the key of the specified 'lhs' is less than that of
+        // the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+struct FirstEqual {
+    // This 'struct' provides an equality predicate of 'Element' objects by
+    // key, for use with the standard algorithms.
+
+    bool operator()(const Element& lhs, const Element& rhs) const
+        // Return 'true' if the key of the specified 'lhs' is equal to that of
+        // the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.first == rhs.first;
+    }
+};
+
+void makeSequence(Sequence *result, const char *spec)
+    // Load into the specified 'result' one element for each character of the
+    // specified 'spec', having as key the value of the character and as
+    // sequence number its position in 'spec'.
+{
+    result->clear();
+    for (int i = 0; spec[i]; ++i) {
+        result->push_back(Element(spec[i], i));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Sorted 'bsl::vector' of Pairs
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a sorted 'bsl::vector' of '(code, name)' pairs by hand,
+// and want to look up entries by code.
+//
+// First, we create the table:
+//..
+    typedef bsl::pair<int, const char *> Entry;
+
+    bsl::vector<Entry> table;
+    table.push_back(Entry(10, "ten"));
+    table.push_back(Entry(20, "twenty"));
+    table.push_back(Entry(30, "thirty"));
+//..
+// Then, we search the table by key, supplying the policy that extracts the
+// 'first' member of each element:
+//..
+    typedef bslstl::FlatContainerUtil_PairFirstKey KeyPolicy;
+
+    std::less<int>                     comparator;
+    bsl::vector<Entry>::const_iterator it =
+             bslstl::FlatContainerUtil::lowerBound<KeyPolicy>(table.cbegin(),
+                                                              table.cend(),
+                                                              20,
+                                                              comparator);
+    ASSERT(table.cend() != it);
+    ASSERT(0 == strcmp("twenty", it->second));
+//..
+// Next, we append two more entries out of order:
+//..
+    table.push_back(Entry(25, "twenty-five"));
+    table.push_back(Entry(5,  "five"));
+//..
+// Finally, we restore the sorted order of the table by merging the unsorted
+// tail (starting at index 3) into the sorted prefix:
+//..
+    bslstl::FlatContainerUtil::sortAndMerge<KeyPolicy>(&table, 3, comparator);
+    ASSERT(5  == table.size());
+    ASSERT(5  == table[0].first);
+    ASSERT(25 == table[3].first);
+    ASSERT(bslstl::FlatContainerUtil::isSorted<KeyPolicy>(table.cbegin(),
+                                                          table.cend(),
+                                                          comparator));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'FlatContainerUtil_ClearProctor'
+        //
+        // Concerns:
+        //: 1 The proctor clears the managed container on destruction.
+        //:
+        //: 2 The proctor does not modify the container on destruction once
+        //:   'release' has been called.
+        //
+        // Plan:
+        //: 1 Create a proctor for a non-empty sequence, let it go out of
+        //:   scope, and verify that the sequence is empty.  (C-1)
+        //:
+        //: 2 Repeat P-1, calling 'release' before the proctor goes out of
+        //:   scope, and verify that the sequence is unchanged.  (C-2)
+        //
+        // Testing:
+        //   FlatContainerUtil_ClearProctor
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'FlatContainerUtil_ClearProctor'"
+                            "\n================================\n");
+
+        typedef bslstl::FlatContainerUtil_ClearProctor<Sequence> Proctor;
+
+        Sequence mX;  const Sequence& X = mX;
+
+        makeSequence(&mX, "ABC");
+        {
+            Proctor proctor(&mX);
+        }
+        ASSERT(X.empty());
+
+        makeSequence(&mX, "ABC");
+        {
+            Proctor proctor(&mX);
+            proctor.release();
+        }
+        ASSERT(3 == X.size());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'merge' AND 'sortAndMerge'
+        //
+        // Concerns:
+        //: 1 After 'sortAndMerge', the sequence holds the same elements as
+        //:   after a 'std::stable_sort' of the whole sequence.
+        //:
+        //: 2 Elements preceding 'position' are ordered before equivalent
+        //:   elements following it, and the relative order of equivalent
+        //:   elements within each part is preserved.
+        //:
+        //: 3 'merge' of two sorted parts produces the same result as
+        //:   'sortAndMerge'.
+        //:
+        //: 4 Both functions handle an empty prefix, an empty tail, and a
+        //:   tail that sorts entirely after the prefix.
+        //:
+        //: 5 Tails longer than the runs that 'sortAndMerge' sorts by
+        //:   insertion are sorted correctly.
+        //:
+        //: 6 Any temporary storage is obtained from the allocator of the
+        //:   container, and not from the default allocator.
+        //
+        // Plan:
+        //: 1 For each specification in a table, and for every 'position' in
+        //:   the sequence, sort the prefix with 'std::stable_sort', then
+        //:   apply 'sortAndMerge' and compare the result with that of
+        //:   'std::stable_sort' applied to the whole original sequence,
+        //:   comparing both keys and sequence numbers.  (C-1, 2, 4)
+        //:
+        //: 2 Repeat P-1, additionally sorting the tail before calling
+        //:   'merge'.  (C-3, 4)
+        //:
+        //: 3 Include in the table specifications longer than twice the
+        //:   length of an insertion-sorted run.  (C-5)
+        //:
+        //: 4 Apply both functions to a long sequence using a test object
+        //:   allocator, and verify that the object allocator, and not the
+        //:   default allocator, is used.  (C-6)
+        //
+        // Testing:
+        //   void merge<KP>(CONTAINER *, size_type, const C&);
+        //   void sortAndMerge<KP>(CONTAINER *, size_type, const C&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'merge' AND 'sortAndMerge'"
+                            "\n==========================\n");
+
+        static const char *SPECS[] = {
+            "", "A", "AB", "BA", "AA", "ABA", "BAB", "CBA", "AABB", "BBAA",
+            "ABAB", "DCBA", "ACBD", "ABCDE", "EDCBA", "AAAAA", "ABABABAB",
+            "CACBCABA", "HGFEDCBA", "AEBFCGDH", "ABCDEFGHIJKLMNOP",
+            "ZYXWVUTSRQPONMLKJIHGFEDCBAZYXWVUTSRQ",
+            "CBACBACBACBACBACBACBACBACBACBACBACBACBA",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        std::less<int> comparator;
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *SPEC = SPECS[ti];
+            const int   LEN  = static_cast<int>(strlen(SPEC));
+
+            if (veryVerbose) { T_ P(SPEC) }
+
+            for (int pos = 0; pos <= LEN; ++pos) {
+                Sequence original;
+                makeSequence(&original, SPEC);
+                std::stable_sort(original.begin(),
+                                 original.begin() + pos,
+                                 FirstLess());
+
+                Sequence expected(original);
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 FirstLess());
+
+                Sequence mX(original);  const Sequence& X = mX;
+                Util::sortAndMerge<PairFirstKey>(&mX, pos, comparator);
+                ASSERTV(SPEC, pos, expected == X);
+
+                Sequence mY(original);  const Sequence& Y = mY;
+                std::stable_sort(mY.begin() + pos, mY.end(), FirstLess());
+                Util::merge<PairFirstKey>(&mY, pos, comparator);
+                ASSERTV(SPEC, pos, expected == Y);
+            }
+        }
+
+        if (verbose) printf("\nTesting use of the container allocator.\n");
+        {
+            const char *SPEC = "QPONMLKJIHGFEDCBAQPONMLKJIHGFEDCBA";
+            const int   POS  = 4;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Sequence original;
+            makeSequence(&original, SPEC);
+            std::stable_sort(original.begin(),
+                             original.begin() + POS,
+                             FirstLess());
+
+            Sequence expected(original);
+            std::stable_sort(expected.begin(), expected.end(), FirstLess());
+
+            Sequence mX(original, &oa);  const Sequence& X = mX;
+            Sequence mY(original, &oa);  const Sequence& Y = mY;
+            std::stable_sort(mY.begin() + POS, mY.end(), FirstLess());
+
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Util::sortAndMerge<PairFirstKey>(&mX, POS, comparator);
+            ASSERT(expected == X);
+            ASSERT(oam.isTotalUp());
+
+            oam.reset();
+
+            Util::merge<PairFirstKey>(&mY, POS, comparator);
+            ASSERT(expected == Y);
+            ASSERT(oam.isTotalUp());
+            ASSERT(oam.isInUseSame());
+
+            ASSERT(dam.isTotalSame());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'eraseDuplicates'
+        //
+        // Concerns:
+        //: 1 'eraseDuplicates' retains exactly the first element of each run
+        //:   of elements having equivalent keys.
+        //:
+        //: 2 A sequence without duplicates, and an empty sequence, are
+        //:   unchanged.
+        //
+        // Plan:
+        //: 1 For each specification in a table, create a sorted sequence,
+        //:   apply 'eraseDuplicates' and compare the result with that of
+        //:   'std::unique' using a key-equality predicate, comparing both
+        //:   keys and sequence numbers.  (C-1..2)
+        //
+        // Testing:
+        //   void eraseDuplicates<KP>(CONTAINER *, const C&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'eraseDuplicates'"
+                            "\n=================\n");
+
+        static const char *SPECS[] = {
+            "", "A", "AA", "AB", "AAB", "ABB", "AAA", "AABBCC", "ABBBC",
+            "ABCDE", "AAAAB", "ABBBB",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        std::less<int> comparator;
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *SPEC = SPECS[ti];
+
+            if (veryVerbose) { T_ P(SPEC) }
+
+            Sequence expected;
+            makeSequence(&expected, SPEC);
+            expected.erase(std::unique(expected.begin(),
+                                       expected.end(),
+                                       FirstEqual()),
+                           expected.end());
+
+            Sequence mX;  const Sequence& X = mX;
+            makeSequence(&mX, SPEC);
+            Util::eraseDuplicates<PairFirstKey>(&mX, comparator);
+            ASSERTV(SPEC, expected == X);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'isSorted' AND 'isSortedUnique'
+        //
+        // Concerns:
+        //: 1 'isSorted' returns 'true' if and only if no element is ordered
+        //:   before its predecessor.
+        //:
+        //: 2 'isSortedUnique' returns 'true' if and only if every element is
+        //:   ordered after its predecessor.
+        //:
+        //: 3 Both functions work with 'FlatContainerUtil_IdentityKey'.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, apply both functions to
+        //:   sequences of 'char' and compare the results with the expected
+        //:   values.  (C-1..3)
+        //
+        // Testing:
+        //   bool isSorted<KP>(ITERATOR, ITERATOR, const C&);
+        //   bool isSortedUnique<KP>(ITERATOR, ITERATOR, const C&);
+        //   FlatContainerUtil_IdentityKey
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'isSorted' AND 'isSortedUnique'"
+                            "\n===============================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_spec;
+            bool        d_sorted;
+            bool        d_sortedUnique;
+        } DATA[] = {
+            //LINE  SPEC       SORTED  UNIQUE
+            //----  -------    ------  ------
+            { L_,   "",        true,   true   },
+            { L_,   "A",       true,   true   },
+            { L_,   "AB",      true,   true   },
+            { L_,   "AA",      true,   false  },
+            { L_,   "BA",      false,  false  },
+            { L_,   "ABC",     true,   true   },
+            { L_,   "ABB",     true,   false  },
+            { L_,   "ACB",     false,  false  },
+            { L_,   "AABC",    true,   false  },
+            { L_,   "ABCDEF",  true,   true   },
+            { L_,   "ABCDFE",  false,  false  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        std::less<char> comparator;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *SPEC   = DATA[ti].d_spec;
+            const bool  SORTED = DATA[ti].d_sorted;
+            const bool  UNIQUE = DATA[ti].d_sortedUnique;
+            const char *END    = SPEC + strlen(SPEC);
+
+            ASSERTV(LINE, SORTED == Util::isSorted<IdentityKey>(SPEC,
+                                                                END,
+                                                                comparator));
+            ASSERTV(LINE,
+                    UNIQUE == Util::isSortedUnique<IdentityKey>(SPEC,
+                                                                END,
+                                                                comparator));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'lowerBound' AND 'upperBound'
+        //
+        // Concerns:
+        //: 1 'lowerBound' and 'upperBound' return the same positions as
+        //:   'std::lower_bound' and 'std::upper_bound', for every key (present
+        //:   or absent, below, within, and above the range) and every
+        //:   sequence length, including 0, 1, and lengths that are not powers
+        //:   of two.
+        //:
+        //: 2 Runs of equivalent keys are bounded correctly.
+        //:
+        //: 3 The functions work with 'FlatContainerUtil_PairFirstKey', and
+        //:   with both 'iterator' and 'const_iterator'.
+        //
+        // Plan:
+        //: 1 For every length 'N' up to 70, create a sorted sequence of 'N'
+        //:   elements whose keys are 'i / 2' (so that each key appears
+        //:   twice).  For every key from -1 to 'N / 2 + 1', compare the
+        //:   results of both functions with those of the standard
+        //:   algorithms.  (C-1..3)
+        //
+        // Testing:
+        //   ITERATOR lowerBound<KP>(ITERATOR, ITERATOR, const K&, const C&);
+        //   ITERATOR upperBound<KP>(ITERATOR, ITERATOR, const K&, const C&);
+        //   FlatContainerUtil_PairFirstKey
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'lowerBound' AND 'upperBound'"
+                            "\n=============================\n");
+
+        std::less<int> comparator;
+
+        for (int n = 0; n <= 70; ++n) {
+            Sequence mX;  const Sequence& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.push_back(Element(i / 2, i));
+            }
+
+            for (int key = -1; key <= n / 2 + 1; ++key) {
+                const Element PROBE(key, 0);
+
+                Sequence::const_iterator EXP_LB = std::lower_bound(
+                                                                X.begin(),
+                                                                X.end(),
+                                                                PROBE,
+                                                                FirstLess());
+                Sequence::const_iterator EXP_UB = std::upper_bound(
+                                                                X.begin(),
+                                                                X.end(),
+                                                                PROBE,
+                                                                FirstLess());
+
+                Sequence::const_iterator lb =
+                            Util::lowerBound<PairFirstKey>(X.begin(),
+                                                           X.end(),
+                                                           key,
+                                                           comparator);
+                Sequence::iterator ub =
+                            Util::upperBound<PairFirstKey>(mX.begin(),
+                                                           mX.end(),
+                                                           key,
+                                                           comparator);
+
+                ASSERTV(n, key, EXP_LB == lb);
+                ASSERTV(n, key, EXP_UB == ub);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Exercise each algorithm on a small sequence.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   sorted_unique_t, sorted_equivalent_t
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const bsl::sorted_unique_t     U = bsl::sorted_unique;
+        const bsl::sorted_equivalent_t E = bsl::sorted_equivalent;
+        (void)U;
+        (void)E;
+
+        std::less<int> comparator;
+
+        Sequence mX;  const Sequence& X = mX;
+        makeSequence(&mX, "CAB");
+
+        ASSERT(!Util::isSorted<PairFirstKey>(X.begin(), X.end(), comparator));
+
+        Util::sortAndMerge<PairFirstKey>(&mX, 0, comparator);
+        ASSERT( Util::isSortedUnique<PairFirstKey>(X.begin(),
+                                                   X.end(),
+                                                   comparator));
+        ASSERT('A' == X[0].first);
+
+        mX.push_back(Element('B', 3));
+        mX.push_back(Element('A', 4));
+        Util::sortAndMerge<PairFirstKey>(&mX, 3, comparator);
+        ASSERT(5 == X.size());
+        ASSERT( Util::isSorted<PairFirstKey>(X.begin(), X.end(), comparator));
+        ASSERT(!Util::isSortedUnique<PairFirstKey>(X.begin(),
+                                                   X.end(),
+                                                   comparator));
+        ASSERT(1 == X[0].second);
+        ASSERT(4 == X[1].second);
+
+        ASSERT(X.begin() + 2 == Util::lowerBound<PairFirstKey>(X.begin(),
+                                                               X.end(),
+                                                               'B',
+                                                               comparator));
+        ASSERT(X.begin() + 4 == Util::upperBound<PairFirstKey>(X.begin(),
+                                                               X.end(),
+                                                               'B',
+                                                               comparator));
+
+        Util::eraseDuplicates<PairFirstKey>(&mX, comparator);
+        ASSERT(3 == X.size());
+        ASSERT(1 == X[0].second);
+        ASSERT(2 == X[1].second);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,2324 @@
+// bslstl_flatmap.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMAP
+#define INCLUDED_BSLSTL_FLATMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map with unique keys stored in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_map: map adaptor storing its elements in a sorted sequence
+//
+//@CANONICAL_HEADER: bsl_flat_map.h
+//
+//@SEE_ALSO: bslstl_flatmultimap, bslstl_flatset, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_map', implementing the C++23 standard container adaptor
+// 'std::flat_map'.  A 'flat_map' provides the interface of an ordered map
+// with unique keys (see 'bsl::map'), but stores its '(key, value)' pairs in a
+// single sequence container (by default, a 'bsl::vector') kept sorted by key.
+//
+// Compared to the node-based 'bsl::map', a 'flat_map':
+//: o allocates a single contiguous buffer rather than one node per element;
+//:
+//: o iterates at the speed of a linear scan of memory;
+//:
+//: o looks up keys with a binary search over contiguous memory (see
+//:   {'bslstl_flatcontainerutil'|Branchless Search}), which typically touches
+//:   far fewer cache lines than a search of a red-black tree; but
+//:
+//: o inserts and erases individual elements in time linear in the size of the
+//:   container, and invalidates iterators and references on every insertion
+//:   and erasure.
+//
+// A 'flat_map' is therefore best suited to read-mostly lookup tables that are
+// populated in bulk.  Bulk population is fastest when the input is already
+// sorted with unique keys: in that case the 'bsl::sorted_unique' tag may be
+// passed to the constructors and to 'insert', allowing the container to
+// simply append (or adopt) the input without sorting it.
+//
+///Differences from 'std::flat_map'
+///--------------------------------
+// The C++23 'std::flat_map' stores keys and mapped values in two separate
+// sequence containers.  'bsl::flat_map' instead stores 'bsl::pair<KEY, VALUE>'
+// elements in a single sequence container, given by the (template parameter)
+// 'CONTAINER'.  Consequently:
+//: o 'value_type' is 'bsl::pair<KEY, VALUE>', and iterators refer directly to
+//:   the stored elements.  Modifying the 'first' member of an element through
+//:   an iterator results in undefined behavior.
+//:
+//: o The 'keys' and 'values' accessors are not provided; 'extract' and
+//:   'replace' transfer the single underlying container.
+//:
+//: o 'allocator_type' is 'CONTAINER::allocator_type', and that allocator is
+//:   used to supply memory for the container and for its elements.
+//
+// In addition, 'emplace', 'emplace_hint', and 'try_emplace' are available only
+// on platforms supporting variadic templates.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_map''s 'CONTAINER' template parameter
+// determines how memory will be allocated.  With the default 'CONTAINER',
+// 'bsl::vector<bsl::pair<KEY, VALUE> >', a 'flat_map' uses the 'bslma'
+// allocator model: the allocator supplied at construction (or the currently
+// installed default allocator, if none is supplied) is used to supply memory
+// for the sequence and for each of its elements that uses a 'bslma'-style
+// allocator, and a copy-constructed 'flat_map' uses the default allocator
+// rather than the allocator of the original.
+//
+///Exception Safety
+///----------------
+// If an exception is thrown while a 'flat_map' is rearranging its elements
+// (e.g., while sorting or merging a range supplied to 'insert'), the
+// 'flat_map' is left empty so that its invariants are maintained.  Single
+// element insertion and erasure provide the guarantees of the underlying
+// container's 'insert' and 'erase' methods.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Read-Mostly Lookup Table
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we need a table mapping ISO currency codes to the number of decimal
+// places used when displaying amounts in that currency.  The table is loaded
+// once at startup and then consulted for every amount formatted.
+//
+// First, we define the table type:
+//..
+//  typedef bsl::flat_map<bsl::string, int> DecimalPlaces;
+//..
+// Then, we load the table from data that is already sorted by currency code,
+// using the 'sorted_unique' tag to skip the sort:
+//..
+//  typedef bsl::pair<bsl::string, int> Entry;
+//
+//  const Entry data[] = {
+//      Entry("EUR", 2),
+//      Entry("JPY", 0),
+//      Entry("KWD", 3),
+//      Entry("USD", 2),
+//  };
+//  const int NUM_DATA = sizeof data / sizeof *data;
+//
+//  DecimalPlaces table(bsl::sorted_unique, data, data + NUM_DATA);
+//  assert(4 == table.size());
+//..
+// Next, we add a currency that was missing from the initial data set:
+//..
+//  bsl::pair<DecimalPlaces::iterator, bool> result =
+//                                          table.insert(Entry("BHD", 3));
+//  assert(true  == result.second);
+//  assert("BHD" == table.begin()->first);
+//..
+// Then, we look up the number of decimal places for some currencies:
+//..
+//  assert(0 == table.at("JPY"));
+//  assert(2 == table.find("USD")->second);
+//  assert(table.end() == table.find("XYZ"));
+//..
+// Finally, we observe that iterating the table visits the currencies in
+// order:
+//..
+//  const char *EXPECTED[] = { "BHD", "EUR", "JPY", "KWD", "USD" };
+//
+//  int i = 0;
+//  for (DecimalPlaces::const_iterator it  = table.cbegin();
+//                                     it != table.cend();
+//                                   ++it, ++i) {
+//      assert(EXPECTED[i] == it->first);
+//  }
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flatcontainerutil.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_stdexceptutil.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_addlvaluereference.h>
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_libraryfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <algorithm>
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
+# include <tuple>      // for forward_as_tuple (C++11)
+# include <utility>    // for piecewise_construct (C++11)
+#endif
+
+namespace bsl {
+
+                              // ==============
+                              // class flat_map
+                              // ==============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class CONTAINER  = bsl::vector<bsl::pair<KEY, VALUE> > >
+class flat_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys, stored in a
+    // sorted sequence container of the (template parameter) type 'CONTAINER'.
+    // Keys are ordered by the (template parameter) type 'COMPARATOR'.  The
+    // elements of 'CONTAINER' must be 'bsl::pair<KEY, VALUE>' (or another
+    // pair type whose 'first' and 'second' members are of type 'KEY' and
+    // 'VALUE', respectively), and 'CONTAINER' must provide random-access
+    // iterators.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see 'bsldoc_glossary'.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslmf::MovableRefUtil               MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil           Util;
+        // This 'typedef' is an alias for the utility implementing the search
+        // and merge algorithms on the underlying sequence.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil_PairFirstKey
+                                                             KeyPolicy;
+        // This 'typedef' is an alias for the policy extracting the key from
+        // an element.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil_ClearProctor<CONTAINER>
+                                                             ClearProctor;
+        // This 'typedef' is an alias for the proctor restoring the invariants
+        // of this map if an exception is thrown while its elements are being
+        // rearranged.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef typename CONTAINER::value_type             value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef typename CONTAINER::allocator_type         allocator_type;
+    typedef typename CONTAINER::reference              reference;
+    typedef typename CONTAINER::const_reference        const_reference;
+    typedef typename CONTAINER::size_type              size_type;
+    typedef typename CONTAINER::difference_type        difference_type;
+    typedef typename CONTAINER::iterator               iterator;
+    typedef typename CONTAINER::const_iterator         const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+    typedef CONTAINER                                  container_type;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by adapting an object of (template parameter) type
+        // 'COMPARATOR', which compares two objects of (template parameter)
+        // type 'KEY'.
+
+        // FRIENDS
+        friend class flat_map;
+
+      protected:
+        // PROTECTED DATA
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member 'protected'; however, it is required by
+                          // the C++ standard
+
+        // PROTECTED CREATORS
+        value_compare(COMPARATOR comparator);                       // IMPLICIT
+            // Create a 'value_compare' object that uses the specified
+            // 'comparator'.
+
+      public:
+        // PUBLIC TYPES
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to the
+            // overload of 'operator()' of this class.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' of this class.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' of this class.
+
+        // ACCESSORS
+        bool operator()(const value_type& x, const value_type& y) const;
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction, and 'false' otherwise.
+    };
+
+  private:
+    // DATA
+    container_type d_container;   // sorted sequence of elements
+    key_compare    d_comparator;  // key comparator
+
+    // PRIVATE MANIPULATORS
+    iterator lowerBoundFromHint(const_iterator hint, const key_type& key);
+        // Return an iterator to the first element in this map whose key is
+        // not ordered before the specified 'key'.  If the specified 'hint' is
+        // that position, determine it in constant time.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(flat_map,
+                                   BloombergLP::bslalg::HasStlIterators);
+
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+        flat_map,
+        BloombergLP::bslma::UsesBslmaAllocator,
+        BloombergLP::bslma::UsesBslmaAllocator<container_type>::value);
+
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+        flat_map,
+        BloombergLP::bslmf::IsBitwiseMoveable,
+        BloombergLP::bslmf::IsBitwiseMoveable<container_type>::value &&
+            BloombergLP::bslmf::IsBitwiseMoveable<key_compare>::value);
+
+    // CREATORS
+    flat_map();
+    explicit flat_map(const COMPARATOR&     comparator,
+                      const allocator_type& basicAllocator = allocator_type());
+    explicit flat_map(const allocator_type& basicAllocator);
+        // Create an empty map.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of type 'allocator_type' is used.  Note
+        // that, with the default 'CONTAINER', a 'bslma::Allocator *' can be
+        // supplied for 'basicAllocator', and the currently installed default
+        // allocator is used if none is supplied.
+
+    flat_map(const flat_map& original);
+        // Create a map having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this map.  The allocator of the new map is obtained
+        // from the copy constructor of 'CONTAINER'; with the default
+        // 'CONTAINER', that is the currently installed default allocator.
+
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original);
+        // Create a map having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new map.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this map.  The allocator associated with 'original' is
+        // propagated for use in the newly-created map.  'original' is left in
+        // a valid but unspecified state.
+
+    flat_map(const flat_map&       original,
+             const allocator_type& basicAllocator);
+        // Create a map having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this map.
+
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original,
+             const allocator_type&                    basicAllocator);
+        // Create a map having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // map if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.
+
+    explicit flat_map(
+                  const container_type& container,
+                  const COMPARATOR&     comparator     = COMPARATOR(),
+                  const allocator_type& basicAllocator = allocator_type());
+    flat_map(const container_type& container,
+             const allocator_type& basicAllocator);
+        // Create a map holding the elements of the specified 'container',
+        // sorted, and retaining only the first of any elements having
+        // equivalent keys.  Optionally specify a 'comparator' used to order
+        // keys contained in this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of type 'allocator_type' is used.
+
+    explicit flat_map(
+                   BloombergLP::bslmf::MovableRef<container_type> container,
+                   const COMPARATOR&                              comparator =
+                                                                 COMPARATOR());
+        // Create a map holding the elements of the specified 'container' (on
+        // entry), sorted, and retaining only the first of any elements having
+        // equivalent keys, by moving (in constant time) the contents of
+        // 'container' into the new map.  Optionally specify a 'comparator'
+        // used to order keys contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  The allocator associated
+        // with 'container' is propagated for use in the newly-created map.
+        // 'container' is left in a valid but unspecified state.
+
+    flat_map(sorted_unique_t,
+             const container_type& container,
+             const COMPARATOR&     comparator     = COMPARATOR(),
+             const allocator_type& basicAllocator = allocator_type());
+        // Create a map holding the elements of the specified 'container'.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.  The behavior is undefined unless
+        // the elements of 'container' are sorted by key and have unique keys.
+
+    flat_map(sorted_unique_t,
+             BloombergLP::bslmf::MovableRef<container_type> container,
+             const COMPARATOR& comparator = COMPARATOR());
+        // Create a map holding the elements of the specified 'container' (on
+        // entry) by moving (in constant time) the contents of 'container'
+        // into the new map.  Optionally specify a 'comparator' used to order
+        // keys contained in this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  The allocator associated with 'container' is
+        // propagated for use in the newly-created map.  'container' is left
+        // in a valid but unspecified state.  The behavior is undefined unless
+        // the elements of 'container' are sorted by key and have unique keys.
+
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR        first,
+             INPUT_ITERATOR        last,
+             const COMPARATOR&     comparator     = COMPARATOR(),
+             const allocator_type& basicAllocator = allocator_type());
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR        first,
+             INPUT_ITERATOR        last,
+             const allocator_type& basicAllocator);
+        // Create a map, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those objects having
+        // a key equivalent to that of an object earlier in the sequence.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.  If the sequence 'first' to 'last' is
+        // ordered by key, this operation has 'O[N]' complexity, where 'N' is
+        // the number of elements in the sequence; otherwise it has
+        // 'O[N * log(N)]' complexity.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR        first,
+             INPUT_ITERATOR        last,
+             const COMPARATOR&     comparator     = COMPARATOR(),
+             const allocator_type& basicAllocator = allocator_type());
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR        first,
+             INPUT_ITERATOR        last,
+             const allocator_type& basicAllocator);
+        // Create a map holding the 'value_type' objects in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, in linear time.  Optionally
+        // specify a 'comparator' used to order keys contained in this object.
+        // If 'comparator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'COMPARATOR' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last', and the sequence is sorted by
+        // key and has unique keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_map(std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator     = COMPARATOR(),
+             const allocator_type&             basicAllocator =
+                                                             allocator_type());
+    flat_map(std::initializer_list<value_type> values,
+             const allocator_type&             basicAllocator);
+        // Create a map and insert each 'value_type' object in the specified
+        // 'values' initializer list, ignoring those objects having a key
+        // equivalent to that of an object earlier in the list.  Optionally
+        // specify a 'comparator' used to order keys contained in this object.
+        // If 'comparator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'COMPARATOR' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.
+
+    flat_map(sorted_unique_t,
+             std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator     = COMPARATOR(),
+             const allocator_type&             basicAllocator =
+                                                             allocator_type());
+        // Create a map holding the 'value_type' objects in the specified
+        // 'values' initializer list.  Optionally specify a 'comparator' used
+        // to order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of type 'allocator_type' is used.  The
+        // behavior is undefined unless 'values' is sorted by key and has
+        // unique keys.
+#endif
+
+    //! ~flat_map() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_map& operator=(const flat_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    flat_map& operator=(BloombergLP::bslmf::MovableRef<flat_map> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The contents of 'rhs' are moved to this map using the
+        // move-assignment operator of 'CONTAINER'.  'rhs' is left in a valid
+        // but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_map& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // map and then inserting each 'value_type' object in the specified
+        // 'values' initializer list, ignoring those objects having a key
+        // equivalent to that of an object earlier in the list; return a
+        // reference providing modifiable access to this object.
+#endif
+
+    typename add_lvalue_reference<VALUE>::type operator[](
+                                                         const key_type& key);
+    typename add_lvalue_reference<VALUE>::type operator[](
+                                BloombergLP::bslmf::MovableRef<key_type> key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key'; if this map does not already
+        // contain a 'value_type' object having an equivalent key, first
+        // insert a new 'value_type' object having 'key' (copied or moved, as
+        // appropriate) and a default-constructed 'VALUE'.  This method
+        // requires that the (template parameter) type 'VALUE' be
+        // default-constructible.
+
+    typename add_lvalue_reference<VALUE>::type at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with a key equivalent to the specified 'key', if such an
+        // entry exists; otherwise, throw a 'std::out_of_range' exception.
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this map.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or 'rend' if this map is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this map.  Note that the map is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    pair<iterator, bool> insert(const value_type& value);
+    pair<iterator, bool> insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' (copied or moved, as appropriate) into
+        // this map if a key equivalent to that of 'value' does not already
+        // exist in this map; otherwise, if a key equivalent to that of
+        // 'value' already exists in this map, this method has no effect.
+        // Return a pair whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) 'value_type' object in this map whose key
+        // is equivalent to that of 'value', and whose 'second' member is
+        // 'true' if a new value was inserted, and 'false' if the key was
+        // already present.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' (copied or moved, as appropriate) into
+        // this map (in amortized constant search time, if the specified
+        // 'hint' is a valid immediate successor to the key of 'value') if a
+        // key equivalent to that of 'value' does not already exist in this
+        // map; otherwise, this method has no effect.  Return an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this map whose key is equivalent to that of 'value'.  The behavior
+        // is undefined unless 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included).  Note that the cost
+        // of inserting an element is linear in the number of elements that
+        // follow it.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to that of the object is not already contained in this
+        // map and does not appear earlier in the range.  The elements are
+        // appended to the underlying sequence, sorted, and merged into place,
+        // so that this operation has 'O[M * log(M) + N]' complexity, where
+        // 'M' is the length of the range and 'N' is the size of this map.  If
+        // an exception is thrown while sorting or merging, this map is left
+        // empty.  The (template parameter) type 'INPUT_ITERATOR' shall meet
+        // the requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to that of the object is not already contained in this
+        // map.  This operation has 'O[M + N]' complexity, where 'M' is the
+        // length of the range and 'N' is the size of this map.  If an
+        // exception is thrown while merging, this map is left empty.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last',
+        // and the sequence is sorted by key and has unique keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this map the value of each 'value_type' object in the
+        // specified 'values' initializer list if a key equivalent to that of
+        // the object is not already contained in this map and does not appear
+        // earlier in 'values'.
+
+    void insert(sorted_unique_t, std::initializer_list<value_type> values);
+        // Insert into this map the value of each 'value_type' object in the
+        // specified 'values' initializer list if a key equivalent to that of
+        // the object is not already contained in this map.  The behavior is
+        // undefined unless 'values' is sorted by key and has unique keys.
+#endif
+
+    template <class OBJECT>
+    pair<iterator, bool> insert_or_assign(
+                                  const key_type&                     key,
+                                  BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT)
+                                                                      obj);
+    template <class OBJECT>
+    pair<iterator, bool> insert_or_assign(
+                          BloombergLP::bslmf::MovableRef<key_type>    key,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT)   obj);
+        // If a key equivalent to the specified 'key' already exists in this
+        // map, assign the specified 'obj' to the value associated with that
+        // key, and return a pair containing an iterator referring to the
+        // existing item and 'false'.  Otherwise, insert into this map a newly
+        // created 'value_type' object, constructed from 'key' (copied or
+        // moved, as appropriate) and 'obj', and return a pair containing an
+        // iterator referring to the newly-created entry and 'true'.  This
+        // method requires that the (template parameter) type 'VALUE' be
+        // assignable and constructible from 'obj'.
+
+    template <class OBJECT>
+    iterator insert_or_assign(const_iterator                      hint,
+                              const key_type&                     key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT)
+                                                                  obj);
+    template <class OBJECT>
+    iterator insert_or_assign(
+                          const_iterator                              hint,
+                          BloombergLP::bslmf::MovableRef<key_type>    key,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT)   obj);
+        // If a key equivalent to the specified 'key' already exists in this
+        // map, assign the specified 'obj' to the value associated with that
+        // key, and return an iterator referring to the existing item.
+        // Otherwise, insert into this map a newly created 'value_type'
+        // object, constructed from 'key' (copied or moved, as appropriate)
+        // and 'obj', and return an iterator referring to the newly-created
+        // entry.  The search for the position of 'key' takes amortized
+        // constant time if the specified 'hint' is a valid immediate
+        // successor to 'key'.  This method requires that the (template
+        // parameter) type 'VALUE' be assignable and constructible from 'obj'.
+        // The behavior is undefined unless 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included).
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... Args>
+    pair<iterator, bool> emplace(Args&&... args);
+        // Insert into this map a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'args' to the corresponding
+        // constructor of 'value_type', if a key equivalent to such a value
+        // does not already exist in this map; otherwise, this method has no
+        // effect (other than possibly creating a temporary 'value_type'
+        // object).  Return a pair whose 'first' member is an iterator
+        // referring to the (possibly newly created and inserted) object in
+        // this map whose key is equivalent to that of an object constructed
+        // from 'args', and whose 'second' member is 'true' if a new value was
+        // inserted, and 'false' if an equivalent key was already present.
+
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args);
+        // Insert into this map a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'args' to the corresponding
+        // constructor of 'value_type', (in amortized constant search time, if
+        // the specified 'hint' is a valid immediate successor to the key of
+        // the object) if a key equivalent to such a value does not already
+        // exist in this map; otherwise, this method has no effect (other than
+        // possibly creating a temporary 'value_type' object).  Return an
+        // iterator referring to the (possibly newly created and inserted)
+        // object in this map whose key is equivalent to that of an object
+        // constructed from 'args'.  The behavior is undefined unless 'hint'
+        // is an iterator in the range '[begin() .. end()]' (both endpoints
+        // included).
+
+    template <class... Args>
+    pair<iterator, bool> try_emplace(const key_type& key, Args&&... args);
+    template <class... Args>
+    pair<iterator, bool> try_emplace(
+                               BloombergLP::bslmf::MovableRef<key_type> key,
+                               Args&&...                                args);
+        // If a key equivalent to the specified 'key' already exists in this
+        // map, return a pair containing an iterator referring to the existing
+        // item and 'false'.  Otherwise, insert into this map a newly-created
+        // 'value_type' object, constructed from 'key' (copied or moved, as
+        // appropriate) and the specified (variable number of) 'args', and
+        // return a pair containing an iterator referring to the newly-created
+        // entry and 'true'.  Unlike 'emplace', no 'value_type' object is
+        // created unless it is inserted.
+
+    template <class... Args>
+    iterator try_emplace(const_iterator hint,
+                         const key_type& key,
+                         Args&&... args);
+    template <class... Args>
+    iterator try_emplace(const_iterator                           hint,
+                         BloombergLP::bslmf::MovableRef<key_type> key,
+                         Args&&...                                args);
+        // If a key equivalent to the specified 'key' already exists in this
+        // map, return an iterator referring to the existing item.  Otherwise,
+        // insert into this map (in amortized constant search time, if the
+        // specified 'hint' is a valid immediate successor to 'key') a
+        // newly-created 'value_type' object, constructed from 'key' (copied
+        // or moved, as appropriate) and the specified (variable number of)
+        // 'args', and return an iterator referring to the newly-created
+        // entry.  The behavior is undefined unless 'hint' is an iterator in
+        // the range '[begin() .. end()]' (both endpoints included).
+#endif
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  The
+        // behavior is undefined unless 'position' refers to a 'value_type'
+        // object in this map.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object whose key is
+        // equivalent to the specified 'key', if such an entry exists, and
+        // return 1; otherwise, if there is no 'value_type' object having an
+        // equivalent key, return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including, the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this map or
+        // are the 'end' iterator, and the 'first' position is at or before
+        // the 'last' position in the ordered sequence provided by this
+        // container.
+
+    container_type extract();
+        // Move the underlying sequence out of this map, leaving this map
+        // empty, and return it.
+
+    void replace(BloombergLP::bslmf::MovableRef<container_type> container);
+        // Replace the underlying sequence of this map with the specified
+        // 'container' (on entry), using the move-assignment operator of
+        // 'CONTAINER'.  'container' is left in a valid but unspecified state.
+        // The behavior is undefined unless the elements of 'container' are
+        // sorted by key and have unique keys.
+
+    void swap(flat_map& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object, using the 'swap' method of 'CONTAINER' to
+        // exchange the underlying sequences.
+
+    iterator find(const key_type& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map whose key is equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    iterator lower_bound(const key_type& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    iterator upper_bound(const key_type& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain a 'value_type' object whose key is greater-than
+        // 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain a 'value_type' object whose key is greater-than
+        // 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this map contains
+        // no 'value_type' objects with a key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that since a
+        // map maintains unique keys, the range will contain at most one
+        // element.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator first = lower_bound(key);
+        iterator last  = first;
+        if (last != end() && !d_comparator(key, last->first)) {
+            ++last;
+        }
+        return pair<iterator, iterator>(first, last);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this map contains
+        // no 'value_type' objects with a key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that
+        // although a map maintains unique keys, the range may contain more
+        // than one element, because a transparent comparator may have been
+        // supplied that provides a different (but compatible) partitioning of
+        // keys for 'LOOKUP_KEY' as the comparisons used to order the keys in
+        // the map.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this map.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this map.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    typename add_lvalue_reference<const VALUE>::type at(
+                                                   const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with a key equivalent to the specified
+        // 'key', if such an entry exists; otherwise, throw a
+        // 'std::out_of_range' exception.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this map; if a comparator was supplied at construction, return its
+        // value; otherwise, return a default constructed 'key_compare'
+        // object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their respective keys using 'key_comp()'.
+
+    const_iterator find(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    size_type count(const key_type& key) const
+        // Return the number of 'value_type' objects within this map whose
+        // keys are equivalent to the specified 'key'.  Note that since a map
+        // maintains unique keys, the returned value will be either 0 or 1.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this map whose
+        // keys are equivalent to the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return upper_bound(key) - lower_bound(key);
+    }
+
+    bool contains(const key_type& key) const
+        // Return 'true' if this map contains an element whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this map contains an element whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return find(key) != end();
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this map contains
+        // no 'value_type' objects with a key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that since a
+        // map maintains unique keys, the range will contain at most one
+        // element.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator first = lower_bound(key);
+        const_iterator last  = first;
+        if (last != end() && !d_comparator(key, last->first)) {
+            ++last;
+        }
+        return pair<const_iterator, const_iterator>(first, last);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this map contains
+        // no 'value_type' objects with a key equivalent to 'key', then the
+        // two returned iterators will have the same value.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return pair<const_iterator, const_iterator>(lower_bound(key),
+                                                    upper_bound(key));
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator==(const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_map' objects have the same
+    // value if they have the same number of key-value pairs, and each element
+    // in the ordered sequence of key-value pairs of 'lhs' has the same value
+    // as the corresponding element in the ordered sequence of key-value pairs
+    // of 'rhs'.  This method requires that the (template parameter) types
+    // 'KEY' and 'VALUE' both be 'equality-comparable'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator!=(const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_map' objects do not have
+    // the same value if they do not have the same number of key-value pairs,
+    // or some element in the ordered sequence of key-value pairs of 'lhs'
+    // does not have the same value as the corresponding element in the
+    // ordered sequence of key-value pairs of 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator<(const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+               const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of map 'lhs' is lexicographically less than that of map 'rhs'
+    // if 'true == *i < *j' for the first pair of corresponding iterator
+    // positions where '*i < *j' and '*j < *i' are not both 'false'.  If no
+    // such corresponding iterator position exists, the value of 'lhs' is
+    // lexicographically less than that of 'rhs' if 'lhs.size() < rhs.size()'.
+    // This method requires that 'operator<', inducing a total order, be
+    // defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator>(const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+               const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than that of the specified 'rhs' map, and
+    // 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator<=(const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  Note that this operator returns
+    // '!(rhs < lhs)'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator>=(const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class CONTAINER,
+          class PREDICATE>
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+erase_if(flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& m, PREDICATE predicate);
+    // Erase all the elements in the specified map 'm' that satisfy the
+    // specified predicate 'predicate'.  Return the number of elements erased.
+    // Note that, unlike repeated calls to 'erase', this operation has linear
+    // complexity.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+void swap(flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& a,
+          flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -----------------------------
+                        // class flat_map::value_compare
+                        // -----------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::value_compare::value_compare(
+                                                         COMPARATOR comparator)
+: comp(comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::value_compare::operator()(
+                                                     const value_type& x,
+                                                     const value_type& y) const
+{
+    return comp(x.first, y.first);
+}
+
+                              // --------------
+                              // class flat_map
+                              // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::lowerBoundFromHint(
+                                                   const_iterator  hint,
+                                                   const key_type& key)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    if ((hint == cbegin() || d_comparator((hint - 1)->first, key))
+     && (hint == cend()   || !d_comparator(hint->first, key))) {
+        return begin() + (hint - cbegin());                           // RETURN
+    }
+    return lower_bound(key);
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map()
+: d_container()
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                         const COMPARATOR&     comparator,
+                                         const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                          const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                                      const flat_map& original)
+: d_container(original.d_container)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                             BloombergLP::bslmf::MovableRef<flat_map> original)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                        const flat_map&       original,
+                                        const allocator_type& basicAllocator)
+: d_container(original.d_container, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                     BloombergLP::bslmf::MovableRef<flat_map> original,
+                     const allocator_type&                    basicAllocator)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container),
+              basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                        const container_type& container,
+                                        const COMPARATOR&     comparator,
+                                        const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator(comparator)
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                        const container_type& container,
+                                        const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator()
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                     BloombergLP::bslmf::MovableRef<container_type> container,
+                     const COMPARATOR&                              comparator)
+: d_container(MoveUtil::move(container))
+, d_comparator(comparator)
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                        sorted_unique_t,
+                                        const container_type& container,
+                                        const COMPARATOR&     comparator,
+                                        const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(d_container.begin(),
+                                                     d_container.end(),
+                                                     d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                      sorted_unique_t,
+                     BloombergLP::bslmf::MovableRef<container_type> container,
+                     const COMPARATOR&                              comparator)
+: d_container(MoveUtil::move(container))
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(d_container.begin(),
+                                                     d_container.end(),
+                                                     d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                        INPUT_ITERATOR        first,
+                                        INPUT_ITERATOR        last,
+                                        const COMPARATOR&     comparator,
+                                        const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator(comparator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                        INPUT_ITERATOR        first,
+                                        INPUT_ITERATOR        last,
+                                        const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator()
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                        sorted_unique_t,
+                                        INPUT_ITERATOR        first,
+                                        INPUT_ITERATOR        last,
+                                        const COMPARATOR&     comparator,
+                                        const allocator_type& basicAllocator)
+: d_container(first, last, basicAllocator)
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(d_container.begin(),
+                                                     d_container.end(),
+                                                     d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                                        sorted_unique_t,
+                                        INPUT_ITERATOR        first,
+                                        INPUT_ITERATOR        last,
+                                        const allocator_type& basicAllocator)
+: d_container(first, last, basicAllocator)
+, d_comparator()
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(d_container.begin(),
+                                                     d_container.end(),
+                                                     d_comparator));
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                             std::initializer_list<value_type> values,
+                             const COMPARATOR&                 comparator,
+                             const allocator_type&             basicAllocator)
+: flat_map(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                             std::initializer_list<value_type> values,
+                             const allocator_type&             basicAllocator)
+: flat_map(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::flat_map(
+                             sorted_unique_t,
+                             std::initializer_list<value_type> values,
+                             const COMPARATOR&                 comparator,
+                             const allocator_type&             basicAllocator)
+: flat_map(sorted_unique,
+           values.begin(),
+           values.end(),
+           comparator,
+           basicAllocator)
+{
+}
+#endif
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>&
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::operator=(const flat_map& rhs)
+{
+    d_container  = rhs.d_container;
+    d_comparator = rhs.d_comparator;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>&
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::operator=(
+                                  BloombergLP::bslmf::MovableRef<flat_map> rhs)
+{
+    flat_map& lvalue = rhs;
+
+    d_container  = MoveUtil::move(lvalue.d_container);
+    d_comparator = lvalue.d_comparator;
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>&
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+typename add_lvalue_reference<VALUE>::type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::operator[](const key_type& key)
+{
+    iterator it = lower_bound(key);
+    if (it == end() || d_comparator(key, it->first)) {
+        BloombergLP::bsls::ObjectBuffer<VALUE> temp;  // for default 'VALUE'
+
+        allocator_type alloc = get_allocator();
+
+        bsl::allocator_traits<allocator_type>::construct(alloc,
+                                                         temp.address());
+
+        BloombergLP::bslma::DestructorGuard<VALUE> guard(temp.address());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        it = d_container.emplace(it, key, MoveUtil::move(temp.object()));
+#else
+        it = d_container.emplace(it, key, temp.object());
+#endif
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+typename add_lvalue_reference<VALUE>::type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::operator[](
+                                  BloombergLP::bslmf::MovableRef<key_type> key)
+{
+    key_type& lvalue = key;
+
+    iterator it = lower_bound(lvalue);
+    if (it == end() || d_comparator(lvalue, it->first)) {
+        BloombergLP::bsls::ObjectBuffer<VALUE> temp;  // for default 'VALUE'
+
+        allocator_type alloc = get_allocator();
+
+        bsl::allocator_traits<allocator_type>::construct(alloc,
+                                                         temp.address());
+
+        BloombergLP::bslma::DestructorGuard<VALUE> guard(temp.address());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        it = d_container.emplace(it,
+                                 MoveUtil::move(lvalue),
+                                 MoveUtil::move(temp.object()));
+#else
+        it = d_container.emplace(it, lvalue, temp.object());
+#endif
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+typename add_lvalue_reference<VALUE>::type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::at(const key_type& key)
+{
+    iterator it = find(key);
+    if (it == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                             "flat_map<...>::at(key_type): invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::rbegin() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    d_container.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert(const value_type& value)
+{
+    iterator it = lower_bound(value.first);
+    if (it != end() && !d_comparator(value.first, it->first)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(d_container.insert(it, value), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    iterator it = lower_bound(lvalue.first);
+    if (it != end() && !d_comparator(lvalue.first, it->first)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(d_container.insert(it,
+                                                   MoveUtil::move(lvalue)),
+                                true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert(const_iterator    hint,
+                                                    const value_type& value)
+{
+    iterator it = lowerBoundFromHint(hint, value.first);
+    if (it != end() && !d_comparator(value.first, it->first)) {
+        return it;                                                    // RETURN
+    }
+    return d_container.insert(it, value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    iterator it = lowerBoundFromHint(hint, lvalue.first);
+    if (it != end() && !d_comparator(lvalue.first, it->first)) {
+        return it;                                                    // RETURN
+    }
+    return d_container.insert(it, MoveUtil::move(lvalue));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+void flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert(INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    const size_type position = d_container.size();
+
+    d_container.insert(d_container.end(), first, last);
+
+    ClearProctor proctor(&d_container);
+
+    Util::sortAndMerge<KeyPolicy>(&d_container, position, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+
+    proctor.release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+void flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert(sorted_unique_t,
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    const size_type position = d_container.size();
+
+    d_container.insert(d_container.end(), first, last);
+
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(
+                                             d_container.begin() + position,
+                                             d_container.end(),
+                                             d_comparator));
+
+    ClearProctor proctor(&d_container);
+
+    Util::merge<KeyPolicy>(&d_container, position, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                                      sorted_unique_t,
+                                      std::initializer_list<value_type> values)
+{
+    insert(sorted_unique, values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class OBJECT>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert_or_assign(
+                              const key_type&                           key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj)
+{
+    iterator it = lower_bound(key);
+    if (it != end() && !d_comparator(key, it->first)) {
+        it->second = BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj);
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(
+                    d_container.emplace(it,
+                                        key,
+                                        BSLS_COMPILERFEATURES_FORWARD(OBJECT,
+                                                                      obj)),
+                    true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class OBJECT>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert_or_assign(
+                              BloombergLP::bslmf::MovableRef<key_type>  key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj)
+{
+    key_type& lvalue = key;
+
+    iterator it = lower_bound(lvalue);
+    if (it != end() && !d_comparator(lvalue, it->first)) {
+        it->second = BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj);
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(
+                    d_container.emplace(it,
+                                        MoveUtil::move(lvalue),
+                                        BSLS_COMPILERFEATURES_FORWARD(OBJECT,
+                                                                      obj)),
+                    true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class OBJECT>
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert_or_assign(
+                              const_iterator                            hint,
+                              const key_type&                           key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj)
+{
+    iterator it = lowerBoundFromHint(hint, key);
+    if (it != end() && !d_comparator(key, it->first)) {
+        it->second = BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj);
+        return it;                                                    // RETURN
+    }
+    return d_container.emplace(it,
+                               key,
+                               BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class OBJECT>
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::insert_or_assign(
+                              const_iterator                            hint,
+                              BloombergLP::bslmf::MovableRef<key_type>  key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(OBJECT) obj)
+{
+    key_type& lvalue = key;
+
+    iterator it = lowerBoundFromHint(hint, lvalue);
+    if (it != end() && !d_comparator(lvalue, it->first)) {
+        it->second = BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj);
+        return it;                                                    // RETURN
+    }
+    return d_container.emplace(it,
+                               MoveUtil::move(lvalue),
+                               BSLS_COMPILERFEATURES_FORWARD(OBJECT, obj));
+}
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class... Args>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::emplace(Args&&... args)
+{
+    BloombergLP::bsls::ObjectBuffer<value_type> temp;
+
+    allocator_type alloc = get_allocator();
+
+    bsl::allocator_traits<allocator_type>::construct(
+                                 alloc,
+                                 temp.address(),
+                                 BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+    BloombergLP::bslma::DestructorGuard<value_type> guard(temp.address());
+
+    return insert(MoveUtil::move(temp.object()));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class... Args>
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::emplace_hint(const_iterator hint,
+                                                          Args&&...      args)
+{
+    BloombergLP::bsls::ObjectBuffer<value_type> temp;
+
+    allocator_type alloc = get_allocator();
+
+    bsl::allocator_traits<allocator_type>::construct(
+                                 alloc,
+                                 temp.address(),
+                                 BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+    BloombergLP::bslma::DestructorGuard<value_type> guard(temp.address());
+
+    return insert(hint, MoveUtil::move(temp.object()));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class... Args>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::try_emplace(const key_type& key,
+                                                         Args&&...       args)
+{
+    iterator it = lower_bound(key);
+    if (it != end() && !d_comparator(key, it->first)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(
+                                try_emplace(it,
+                                            key,
+                                            BSLS_COMPILERFEATURES_FORWARD(
+                                                               Args, args)...),
+                                true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class... Args>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::try_emplace(
+                                 BloombergLP::bslmf::MovableRef<key_type> key,
+                                 Args&&...                                args)
+{
+    key_type& lvalue = key;
+
+    iterator it = lower_bound(lvalue);
+    if (it != end() && !d_comparator(lvalue, it->first)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(
+                                try_emplace(it,
+                                            MoveUtil::move(lvalue),
+                                            BSLS_COMPILERFEATURES_FORWARD(
+                                                               Args, args)...),
+                                true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class... Args>
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::try_emplace(
+                                                  const_iterator  hint,
+                                                  const key_type& key,
+                                                  Args&&...       args)
+{
+    iterator it = lowerBoundFromHint(hint, key);
+    if (it != end() && !d_comparator(key, it->first)) {
+        return it;                                                    // RETURN
+    }
+
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
+    return d_container.emplace(
+          it,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(Args, args)...));
+#else
+    return d_container.emplace(
+                  it,
+                  key,
+                  mapped_type(BSLS_COMPILERFEATURES_FORWARD(Args, args)...));
+#endif
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class... Args>
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::try_emplace(
+                                 const_iterator                           hint,
+                                 BloombergLP::bslmf::MovableRef<key_type> key,
+                                 Args&&...                                args)
+{
+    key_type& lvalue = key;
+
+    iterator it = lowerBoundFromHint(hint, lvalue);
+    if (it != end() && !d_comparator(lvalue, it->first)) {
+        return it;                                                    // RETURN
+    }
+
+#if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
+    return d_container.emplace(
+          it,
+          std::piecewise_construct,
+          std::forward_as_tuple(MoveUtil::move(lvalue)),
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(Args, args)...));
+#else
+    return d_container.emplace(
+                  it,
+                  MoveUtil::move(lvalue),
+                  mapped_type(BSLS_COMPILERFEATURES_FORWARD(Args, args)...));
+#endif
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_container.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::erase(iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::erase(const key_type& key)
+{
+    iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    d_container.erase(it);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    return d_container.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::container_type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::extract()
+{
+    container_type result(MoveUtil::move(d_container));
+    d_container.clear();
+    return MoveUtil::move(result);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::replace(
+                      BloombergLP::bslmf::MovableRef<container_type> container)
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(
+                                         MoveUtil::access(container).begin(),
+                                         MoveUtil::access(container).end(),
+                                         d_comparator));
+
+    d_container = MoveUtil::move(container);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::swap(flat_map& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    d_container.swap(other.d_container);
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::allocator_type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.get_allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::rbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::rend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::crend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+typename add_lvalue_reference<const VALUE>::type
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::at(const key_type& key) const
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                       "flat_map<...>::at(key_type) const: invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::key_compare
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::value_compare
+flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::value_comp() const
+{
+    return value_compare(d_comparator);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator==(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator!=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator<(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator>(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator<=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator>=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class CONTAINER,
+          class PREDICATE>
+inline
+typename bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+bsl::erase_if(flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& m,
+              PREDICATE                                    predicate)
+{
+    typedef flat_map<KEY, VALUE, COMPARATOR, CONTAINER> MapType;
+
+    typename MapType::iterator first = std::remove_if(m.begin(),
+                                                      m.end(),
+                                                      predicate);
+    typename MapType::size_type count = m.end() - first;
+    m.erase(first, m.end());
+    return count;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void bsl::swap(bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& a,
+               bsl::flat_map<KEY, VALUE, COMPARATOR, CONTAINER>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
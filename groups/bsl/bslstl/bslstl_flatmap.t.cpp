@@ -0,0 +1,1432 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_flatcontainerutil.h>
+#include <bslstl_map.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The object under test is a container adaptor whose interface and contract
+// are dictated by the C++23 standard, with the differences documented in the
+// component header.  Since 'bsl::map' provides the same interface with the
+// same semantics, most test cases compare the state of a 'flat_map' with that
+// of a 'bsl::map' (the *model*) after applying the same sequence of
+// operations to both.  In addition, we verify that memory is supplied by the
+// allocator passed at construction, that the documented behavior on
+// exceptions is provided, and that the sorted-input ('sorted_unique') entry
+// points accept sorted input and reject unsorted input in safe builds.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map();
+// [ 2] flat_map(const C& comparator, const A& allocator = A());
+// [ 2] flat_map(const A& allocator);
+// [ 4] flat_map(const flat_map& original);
+// [ 4] flat_map(MovableRef<flat_map> original);
+// [ 4] flat_map(const flat_map& original, const A& allocator);
+// [ 4] flat_map(MovableRef<flat_map> original, const A& allocator);
+// [ 3] flat_map(const CONTAINER& c, const C& comp = C(), const A& = A());
+// [ 3] flat_map(const CONTAINER& c, const A& a);
+// [ 3] flat_map(MovableRef<CONTAINER> c, const C& comp = C());
+// [ 3] flat_map(sorted_unique_t, const CONTAINER& c, const C&, const A&);
+// [ 3] flat_map(sorted_unique_t, MovableRef<CONTAINER> c, const C&);
+// [ 3] flat_map(ITER first, ITER last, const C& comp, const A& a);
+// [ 3] flat_map(ITER first, ITER last, const A& a);
+// [ 3] flat_map(sorted_unique_t, ITER first, ITER last, const C&, ...);
+// [ 3] flat_map(sorted_unique_t, ITER first, ITER last, const A& a);
+// [ 3] flat_map(initializer_list<value_type>, const C&, const A&);
+// [ 3] flat_map(initializer_list<value_type>, const A&);
+// [ 3] flat_map(sorted_unique_t, initializer_list<value_type>, ...);
+//
+// MANIPULATORS
+// [ 4] flat_map& operator=(const flat_map& rhs);
+// [ 4] flat_map& operator=(MovableRef<flat_map> rhs);
+// [ 3] flat_map& operator=(initializer_list<value_type>);
+// [ 5] VALUE& operator[](const key_type& key);
+// [ 5] VALUE& operator[](MovableRef<key_type> key);
+// [ 5] VALUE& at(const key_type& key);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 5] pair<iterator, bool> insert(MovableRef<value_type> value);
+// [ 5] iterator insert(const_iterator hint, const value_type& value);
+// [ 5] iterator insert(const_iterator hint, MovableRef<value_type> v);
+// [ 3] void insert(ITER first, ITER last);
+// [ 3] void insert(sorted_unique_t, ITER first, ITER last);
+// [ 3] void insert(initializer_list<value_type>);
+// [ 3] void insert(sorted_unique_t, initializer_list<value_type>);
+// [ 5] pair<iterator, bool> insert_or_assign(const key_type&, V&&);
+// [ 5] iterator insert_or_assign(const_iterator, const key_type&, V&&);
+// [ 5] pair<iterator, bool> emplace(Args&&...);
+// [ 5] iterator emplace_hint(const_iterator, Args&&...);
+// [ 5] pair<iterator, bool> try_emplace(const key_type&, Args&&...);
+// [ 5] iterator try_emplace(const_iterator, const key_type&, Args&&...);
+// [ 6] iterator erase(const_iterator position);
+// [ 6] iterator erase(iterator position);
+// [ 6] size_type erase(const key_type& key);
+// [ 6] iterator erase(const_iterator first, const_iterator last);
+// [ 6] CONTAINER extract();
+// [ 6] void replace(MovableRef<CONTAINER> container);
+// [ 4] void swap(flat_map& other);
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 2] iterator begin(), end(), rbegin(), rend() and 'const' variants
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 5] const VALUE& at(const key_type& key) const;
+// [ 7] iterator find(const key_type& key);
+// [ 7] size_type count(const key_type& key) const;
+// [ 7] bool contains(const key_type& key) const;
+// [ 7] iterator lower_bound(const key_type& key);
+// [ 7] iterator upper_bound(const key_type& key);
+// [ 7] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 7] transparent 'find', 'count', 'contains', and bounds
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+//
+// FREE FUNCTIONS
+// [ 4] bool operator==(const flat_map&, const flat_map&);
+// [ 4] bool operator!=(const flat_map&, const flat_map&);
+// [ 4] bool operator<(const flat_map&, const flat_map&);
+// [ 6] size_type erase_if(flat_map&, PREDICATE);
+// [ 4] void swap(flat_map&, flat_map&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] CONCERN: range 'insert' leaves a valid object on exception
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: lookup compared to 'bsl::map'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bslmf::MovableRefUtil                    MoveUtil;
+
+typedef bsl::flat_map<int, int>                  Obj;
+typedef Obj::value_type                          Value;
+typedef bsl::map<int, int>                       Model;
+
+typedef bsl::flat_map<int, bsl::string>          SObj;
+typedef SObj::value_type                         SValue;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+const char *const LONG_STRING = "This string is long enough to allocate.";
+
+class RandomGenerator {
+    // This class provides a deterministic linear congruential generator, so
+    // that test sequences are reproducible on every platform.
+
+    // DATA
+    unsigned d_state;
+
+  public:
+    // CREATORS
+    explicit RandomGenerator(unsigned seed = 1) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int modulus)
+        // Return the next pseudo-random number in the range
+        // '[0 .. modulus - 1]'.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return static_cast<int>((d_state >> 8) % modulus);
+    }
+};
+
+bool isEqual(const Obj& object, const Model& model)
+    // Return 'true' if the specified 'object' holds the same sequence of
+    // elements as the specified 'model', and 'false' otherwise.
+{
+    if (object.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+
+    Model::const_iterator mit = model.begin();
+    for (Obj::const_iterator it = object.begin(); it != object.end(); ++it) {
+        if (it->first != mit->first || it->second != mit->second) {
+            return false;                                             // RETURN
+        }
+        ++mit;
+    }
+    return true;
+}
+
+struct TransparentLess {
+    // This 'struct' provides a transparent comparator of 'int' and 'long'
+    // values that counts the number of comparisons of mixed types it makes.
+
+    // TYPES
+    typedef void is_transparent;
+
+    // DATA
+    mutable int *d_mixedCount_p;  // counter of mixed-type comparisons
+
+    // CREATORS
+    explicit TransparentLess(int *mixedCount = 0)
+    : d_mixedCount_p(mixedCount)
+        // Create a comparator that counts mixed-type comparisons into the
+        // optionally specified 'mixedCount'.
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'lhs < rhs' for the specified 'lhs' and 'rhs'.
+    {
+        return lhs < rhs;
+    }
+
+    bool operator()(int lhs, long rhs) const
+        // Return 'lhs < rhs' for the specified 'lhs' and 'rhs'.
+    {
+        if (d_mixedCount_p) {
+            ++*d_mixedCount_p;
+        }
+        return lhs < rhs;
+    }
+
+    bool operator()(long lhs, int rhs) const
+        // Return 'lhs < rhs' for the specified 'lhs' and 'rhs'.
+    {
+        if (d_mixedCount_p) {
+            ++*d_mixedCount_p;
+        }
+        return lhs < rhs;
+    }
+};
+
+bool isOdd(const Value& value)
+    // Return 'true' if the key of the specified 'value' is odd, and 'false'
+    // otherwise.
+{
+    return value.first % 2;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Read-Mostly Lookup Table
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we need a table mapping ISO currency codes to the number of decimal
+// places used when displaying amounts in that currency.  The table is loaded
+// once at startup and then consulted for every amount formatted.
+//
+// First, we define the table type:
+//..
+    typedef bsl::flat_map<bsl::string, int> DecimalPlaces;
+//..
+// Then, we load the table from data that is already sorted by currency code,
+// using the 'sorted_unique' tag to skip the sort:
+//..
+    typedef bsl::pair<bsl::string, int> Entry;
+
+    const Entry data[] = {
+        Entry("EUR", 2),
+        Entry("JPY", 0),
+        Entry("KWD", 3),
+        Entry("USD", 2),
+    };
+    const int NUM_DATA = sizeof data / sizeof *data;
+
+    DecimalPlaces table(bsl::sorted_unique, data, data + NUM_DATA);
+    ASSERT(4 == table.size());
+//..
+// Next, we add a currency that was missing from the initial data set:
+//..
+    bsl::pair<DecimalPlaces::iterator, bool> result =
+                                            table.insert(Entry("BHD", 3));
+    ASSERT(true  == result.second);
+    ASSERT("BHD" == table.begin()->first);
+//..
+// Then, we look up the number of decimal places for some currencies:
+//..
+    ASSERT(0 == table.at("JPY"));
+    ASSERT(2 == table.find("USD")->second);
+    ASSERT(table.end() == table.find("XYZ"));
+//..
+// Finally, we observe that iterating the table visits the currencies in
+// order:
+//..
+    const char *EXPECTED[] = { "BHD", "EUR", "JPY", "KWD", "USD" };
+
+    int i = 0;
+    for (DecimalPlaces::const_iterator it  = table.cbegin();
+                                       it != table.cend();
+                                     ++it, ++i) {
+        ASSERT(EXPECTED[i] == it->first);
+    }
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: RANGE 'insert' LEAVES A VALID OBJECT ON EXCEPTION
+        //
+        // Concerns:
+        //: 1 If an allocation fails during a range 'insert', the object is
+        //:   left sorted and free of duplicate keys.
+        //:
+        //: 2 No memory is leaked.
+        //:
+        //: 3 Repeating the 'insert' after a failure produces the expected
+        //:   final value.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, insert
+        //:   an unsorted range of elements having allocating 'bsl::string'
+        //:   values into an object, verifying on each attempt that the object
+        //:   is sorted and unique.  After the loop completes, verify the
+        //:   value of the object.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: range 'insert' leaves a valid object on exception
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+             "\nCONCERN: RANGE 'insert' LEAVES A VALID OBJECT ON EXCEPTION"
+             "\n==========================================================\n");
+
+        typedef bslstl::FlatContainerUtil_PairFirstKey KeyPolicy;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::vector<SValue> input;
+        for (int i = 0; i < 16; ++i) {
+            input.push_back(SValue((i * 7) % 16, LONG_STRING));
+        }
+
+        {
+            SObj mX(&oa);  const SObj& X = mX;
+            for (int i = 0; i < 8; ++i) {
+                mX.insert(SValue(i * 3, LONG_STRING));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT((bslstl::FlatContainerUtil::isSortedUnique<KeyPolicy>(
+                                                           X.begin(),
+                                                           X.end(),
+                                                           X.key_comp())));
+
+                mX.insert(input.begin(), input.end());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(X.size(), 16 <= X.size() && X.size() <= 21);
+            for (int i = 0; i < 16; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'find', 'count', 'contains', 'lower_bound', 'upper_bound', and
+        //:   'equal_range' return the same results as the corresponding
+        //:   methods of the model, for keys that are present, absent, below
+        //:   the smallest key, and above the largest key.
+        //:
+        //: 2 The transparent overloads are selected for a transparent
+        //:   comparator, and compare the lookup key without converting it.
+        //
+        // Plan:
+        //: 1 For objects of every size up to 40 holding the even keys, look
+        //:   up every key in '[-1 .. 2 * size + 1]', and compare the results
+        //:   with those of the model.  (C-1)
+        //:
+        //: 2 Repeat the lookups on an object having a 'TransparentLess'
+        //:   comparator, using 'long' lookup keys, and verify that the
+        //:   mixed-type comparison overloads were invoked.  (C-2)
+        //
+        // Testing:
+        //   iterator find(const key_type& key);
+        //   size_type count(const key_type& key) const;
+        //   bool contains(const key_type& key) const;
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   transparent 'find', 'count', 'contains', and bounds
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        for (int n = 0; n <= 40; ++n) {
+            Obj   mX;  const Obj& X = mX;
+            Model mM;
+            for (int i = 0; i < n; ++i) {
+                mX.insert(Value(2 * i, i));
+                mM.insert(Value(2 * i, i));
+            }
+
+            for (int key = -1; key <= 2 * n + 1; ++key) {
+                const int LB = static_cast<int>(
+                            bsl::distance(mM.begin(), mM.lower_bound(key)));
+                const int UB = static_cast<int>(
+                            bsl::distance(mM.begin(), mM.upper_bound(key)));
+                const bool FOUND = mM.end() != mM.find(key);
+
+                ASSERTV(n, key, LB == mX.lower_bound(key) - mX.begin());
+                ASSERTV(n, key, UB == mX.upper_bound(key) - mX.begin());
+                ASSERTV(n, key, LB == X.lower_bound(key) - X.begin());
+                ASSERTV(n, key, UB == X.upper_bound(key) - X.begin());
+                ASSERTV(n, key, LB == mX.equal_range(key).first - X.begin());
+                ASSERTV(n, key, UB == X.equal_range(key).second - X.begin());
+                ASSERTV(n, key, FOUND == (X.end() != X.find(key)));
+                ASSERTV(n, key, FOUND == (mX.end() != mX.find(key)));
+                ASSERTV(n, key, FOUND == X.contains(key));
+                ASSERTV(n, key, (FOUND ? 1u : 0u) == X.count(key));
+                if (FOUND) {
+                    ASSERTV(n, key, key / 2 == X.find(key)->second);
+                }
+            }
+        }
+
+        if (verbose) printf("\tTransparent comparator.\n");
+
+        typedef bsl::flat_map<int, int, TransparentLess> TObj;
+
+        int             mixedCount = 0;
+        TransparentLess comparator(&mixedCount);
+
+        TObj mX(comparator);  const TObj& X = mX;
+        for (int i = 0; i < 20; ++i) {
+            mX.insert(Value(2 * i, i));
+        }
+        ASSERT(0 == mixedCount);
+
+        for (long key = -1; key <= 41; ++key) {
+            const bool FOUND = 0 <= key && key <= 38 && 0 == key % 2;
+
+            ASSERTV(key, FOUND == X.contains(key));
+            ASSERTV(key, (FOUND ? 1u : 0u) == X.count(key));
+            ASSERTV(key, FOUND == (X.end() != X.find(key)));
+            ASSERTV(key, FOUND == (mX.end() != mX.find(key)));
+            ASSERTV(key, X.lower_bound(static_cast<int>(key)) ==
+                                                           X.lower_bound(key));
+            ASSERTV(key, X.upper_bound(static_cast<int>(key)) ==
+                                                           X.upper_bound(key));
+            ASSERTV(key, mX.equal_range(static_cast<int>(key)) ==
+                                                          mX.equal_range(key));
+        }
+        ASSERT(0 < mixedCount);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ERASURE, 'extract', AND 'replace'
+        //
+        // Concerns:
+        //: 1 Each 'erase' overload removes the indicated elements, and returns
+        //:   the documented iterator or count.
+        //:
+        //: 2 'erase_if' removes exactly the elements satisfying the predicate
+        //:   and returns their number.
+        //:
+        //: 3 'extract' returns the underlying sequence and leaves the object
+        //:   empty; 'replace' adopts a sorted sequence.
+        //:
+        //: 4 'replace' rejects an unsorted sequence in safe builds.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of erasures to an object and to
+        //:   the model, comparing the two after each step.  (C-1)
+        //:
+        //: 2 Apply 'erase_if' with a predicate selecting odd keys, and verify
+        //:   the result.  (C-2)
+        //:
+        //: 3 Extract the sequence of an object, verify it, and put it back
+        //:   with 'replace'.  (C-3)
+        //:
+        //: 4 Use 'bsls_asserttest' to verify that 'replace' fails on unsorted
+        //:   input.  (C-4)
+        //
+        // Testing:
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   size_type erase_if(flat_map&, PREDICATE);
+        //   CONTAINER extract();
+        //   void replace(MovableRef<CONTAINER> container);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASURE, 'extract', AND 'replace'"
+                            "\n=================================\n");
+
+        RandomGenerator random;
+
+        Obj   mX;  const Obj& X = mX;
+        Model mM;
+        for (int i = 0; i < 200; ++i) {
+            mX.insert(Value(i, -i));
+            mM.insert(Value(i, -i));
+        }
+
+        while (!mM.empty()) {
+            const int op  = random(4);
+            const int pos = random(static_cast<int>(mM.size()));
+
+            Model::iterator mit = mM.begin();
+            bsl::advance(mit, pos);
+
+            switch (op) {
+              case 0: {
+                Obj::iterator it = mX.erase(X.begin() + pos);
+                mit = mM.erase(mit);
+                ASSERTV(pos, bsl::distance(mM.begin(), mit) ==
+                                                            it - mX.begin());
+              } break;
+              case 1: {
+                Obj::iterator it = mX.erase(mX.begin() + pos);
+                mM.erase(mit);
+                ASSERTV(pos, pos == it - mX.begin());
+              } break;
+              case 2: {
+                const int key = mit->first;
+                ASSERTV(key, 1 == mX.erase(key));
+                ASSERTV(key, 0 == mX.erase(key));
+                mM.erase(key);
+              } break;
+              case 3: {
+                const int len = random(5);
+                Model::iterator mlast = mit;
+                int             n     = 0;
+                while (n < len && mlast != mM.end()) {
+                    ++mlast;
+                    ++n;
+                }
+                Obj::iterator it = mX.erase(X.begin() + pos,
+                                            X.begin() + pos + n);
+                mM.erase(mit, mlast);
+                ASSERTV(pos, pos == it - mX.begin());
+              } break;
+            }
+            ASSERTV(op, pos, isEqual(X, mM));
+        }
+        ASSERT(X.empty());
+
+        if (verbose) printf("\t'erase_if'.\n");
+
+        for (int i = 0; i < 21; ++i) {
+            mX.insert(Value(i, i));
+        }
+        ASSERT(10 == bsl::erase_if(mX, isOdd));
+        ASSERT(11 == X.size());
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            ASSERTV(it->first, 0 == it->first % 2);
+        }
+
+        if (verbose) printf("\t'extract' and 'replace'.\n");
+
+        Obj::container_type sequence = mX.extract();
+        ASSERT(X.empty());
+        ASSERT(11 == sequence.size());
+        ASSERT(20 == sequence.back().first);
+
+        mX.replace(MoveUtil::move(sequence));
+        ASSERT(11 == X.size());
+        ASSERT(X.contains(20));
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj::container_type sorted;
+            sorted.push_back(Value(1, 1));
+            sorted.push_back(Value(2, 2));
+            Obj::container_type unsorted;
+            unsorted.push_back(Value(2, 2));
+            unsorted.push_back(Value(1, 1));
+            Obj::container_type duplicated;
+            duplicated.push_back(Value(1, 1));
+            duplicated.push_back(Value(1, 2));
+
+            ASSERT_SAFE_PASS(mX.replace(MoveUtil::move(sorted)));
+            ASSERT_SAFE_FAIL(mX.replace(MoveUtil::move(unsorted)));
+            ASSERT_SAFE_FAIL(mX.replace(MoveUtil::move(duplicated)));
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SINGLE-ELEMENT INSERTION AND ELEMENT ACCESS
+        //
+        // Concerns:
+        //: 1 Each single-element insertion method inserts an element if and
+        //:   only if its key is absent, and returns an iterator to the element
+        //:   having that key.
+        //:
+        //: 2 A hint is honored when correct, and ignored (without affecting
+        //:   the result) when incorrect.
+        //:
+        //: 3 'insert_or_assign' overwrites the mapped value of an existing
+        //:   element; 'try_emplace' and 'emplace' do not.
+        //:
+        //: 4 'operator[]' default-constructs the mapped value of an absent
+        //:   key; 'at' throws 'std::out_of_range' for an absent key.
+        //:
+        //: 5 Elements use the allocator of the object.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of insertions, using each method
+        //:   in turn with both correct and incorrect hints, to an object and
+        //:   to the model, comparing the two after each step.  (C-1..4)
+        //:
+        //: 2 Insert elements having allocating 'bsl::string' values into an
+        //:   object using a test allocator, and verify that the default
+        //:   allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type& key);
+        //   VALUE& operator[](MovableRef<key_type> key);
+        //   VALUE& at(const key_type& key);
+        //   const VALUE& at(const key_type& key) const;
+        //   pair<iterator, bool> insert(MovableRef<value_type> value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   iterator insert(const_iterator hint, MovableRef<value_type> v);
+        //   pair<iterator, bool> insert_or_assign(const key_type&, V&&);
+        //   iterator insert_or_assign(const_iterator, const key_type&, V&&);
+        //   pair<iterator, bool> emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        //   pair<iterator, bool> try_emplace(const key_type&, Args&&...);
+        //   iterator try_emplace(const_iterator, const key_type&, Args&&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-ELEMENT INSERTION AND ELEMENT ACCESS"
+                            "\n===========================================\n");
+
+        RandomGenerator random;
+
+        Obj   mX;  const Obj& X = mX;
+        Model mM;
+
+        for (int i = 0; i < 2000; ++i) {
+            const int key   = random(300);
+            const int value = random(1000);
+            const int op    = random(9);
+
+            const Obj::const_iterator GOOD_HINT = X.lower_bound(key);
+            const Obj::const_iterator BAD_HINT  = GOOD_HINT == X.begin()
+                                                ? X.end()
+                                                : X.begin();
+            const Obj::const_iterator HINT = random(2) ? GOOD_HINT : BAD_HINT;
+
+            const bool PRESENT = mM.end() != mM.find(key);
+
+            switch (op) {
+              case 0: {
+                Value v(key, value);
+                bsl::pair<Obj::iterator, bool> r =
+                                                mX.insert(MoveUtil::move(v));
+                ASSERTV(i, !PRESENT == r.second);
+                ASSERTV(i, key == r.first->first);
+                mM.insert(Value(key, value));
+              } break;
+              case 1: {
+                Obj::iterator it = mX.insert(HINT, Value(key, value));
+                ASSERTV(i, key == it->first);
+                mM.insert(Value(key, value));
+              } break;
+              case 2: {
+                Value v(key, value);
+                Obj::iterator it = mX.insert(HINT, MoveUtil::move(v));
+                ASSERTV(i, key == it->first);
+                mM.insert(Value(key, value));
+              } break;
+              case 3: {
+                bsl::pair<Obj::iterator, bool> r =
+                                              mX.insert_or_assign(key, value);
+                ASSERTV(i, !PRESENT == r.second);
+                ASSERTV(i, value == r.first->second);
+                mM[key] = value;
+              } break;
+              case 4: {
+                Obj::iterator it = mX.insert_or_assign(HINT, key, value);
+                ASSERTV(i, value == it->second);
+                mM[key] = value;
+              } break;
+              case 5: {
+                mX[key] = value;
+                mM[key] = value;
+              } break;
+              case 6: {
+                if (PRESENT) {
+                    ASSERTV(i, mM[key] == X.at(key));
+                    mX.at(key) = value;
+                    mM[key]    = value;
+                }
+                else {
+                    bool caught = false;
+                    try {
+                        X.at(key);
+                    }
+                    catch (const std::out_of_range&) {
+                        caught = true;
+                    }
+                    ASSERTV(i, caught);
+                }
+              } break;
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+              case 7: {
+                bsl::pair<Obj::iterator, bool> r = mX.try_emplace(key, value);
+                ASSERTV(i, !PRESENT == r.second);
+                Obj::iterator it = mX.try_emplace(X.lower_bound(key),
+                                                  key,
+                                                  value);
+                ASSERTV(i, r.first == it);
+                mM.insert(Value(key, value));
+              } break;
+              case 8: {
+                bsl::pair<Obj::iterator, bool> r = mX.emplace(key, value);
+                ASSERTV(i, !PRESENT == r.second);
+                Obj::iterator it = mX.emplace_hint(X.begin(), key, value);
+                ASSERTV(i, r.first == it);
+                mM.insert(Value(key, value));
+              } break;
+#endif
+            }
+            ASSERTV(i, op, isEqual(X, mM));
+        }
+
+        if (verbose) printf("\tAllocator propagation.\n");
+        {
+            bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocatorMonitor  dam(&defaultAllocator);
+
+            SObj mY(&oa);  const SObj& Y = mY;
+
+            const bsl::string S(LONG_STRING, &oa);
+
+            mY.insert(SValue(1, S, &oa));
+            mY.insert(Y.end(), SValue(2, S, &oa));
+            mY[3] = LONG_STRING;
+            mY.insert_or_assign(4, bsl::string(LONG_STRING, &oa));
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+            mY.emplace(5, LONG_STRING);
+            mY.try_emplace(6, LONG_STRING);
+#endif
+
+            for (SObj::const_iterator it = Y.begin(); it != Y.end(); ++it) {
+                ASSERTV(it->first, &oa == it->second.get_allocator());
+            }
+            ASSERT(dam.isTotalSame());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment produce an object
+        //:   having the value of the source.
+        //:
+        //: 2 The extended copy and move constructors use the supplied
+        //:   allocator.
+        //:
+        //: 3 Move construction transfers the sequence without copying
+        //:   elements.
+        //:
+        //: 4 'swap' exchanges values.
+        //:
+        //: 5 The equality and relational operators compare values
+        //:   lexicographically.
+        //
+        // Plan:
+        //: 1 Exercise each operation on objects holding allocating
+        //:   'bsl::string' values, verifying values and allocators.
+        //:   (C-1..4)
+        //:
+        //: 2 Compare objects built from a table of specifications against
+        //:   each other, and verify that the results agree with those of
+        //:   the model.  (C-5)
+        //
+        // Testing:
+        //   flat_map(const flat_map& original);
+        //   flat_map(MovableRef<flat_map> original);
+        //   flat_map(const flat_map& original, const A& allocator);
+        //   flat_map(MovableRef<flat_map> original, const A& allocator);
+        //   flat_map& operator=(const flat_map& rhs);
+        //   flat_map& operator=(MovableRef<flat_map> rhs);
+        //   void swap(flat_map& other);
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator<(const flat_map&, const flat_map&);
+        //   void swap(flat_map&, flat_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        SObj mW(&oa);  const SObj& W = mW;
+        for (int i = 0; i < 10; ++i) {
+            mW.insert(SValue(i, LONG_STRING));
+        }
+
+        {
+            const SObj X(W);
+            ASSERT(W == X);
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+
+            const SObj Y(W, &za);
+            ASSERT(W == Y);
+            ASSERT(&za == Y.get_allocator().mechanism());
+            ASSERT(&za == Y.begin()->second.get_allocator());
+        }
+        {
+            SObj mX(W, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const SObj Y(MoveUtil::move(mX));
+            ASSERT(W == Y);
+            ASSERT(&oa == Y.get_allocator().mechanism());
+            ASSERT(oam.isTotalSame());
+        }
+        {
+            SObj mX(W, &oa);
+
+            const SObj Y(MoveUtil::move(mX), &za);
+            ASSERT(W == Y);
+            ASSERT(&za == Y.begin()->second.get_allocator());
+        }
+        {
+            SObj mX(&za);  const SObj& X = mX;
+            mX = W;
+            ASSERT(W == X);
+            ASSERT(&za == X.begin()->second.get_allocator());
+
+            SObj mY(&za);  const SObj& Y = mY;
+            mY = MoveUtil::move(mX);
+            ASSERT(W == Y);
+        }
+        {
+            SObj mX(&oa);  const SObj& X = mX;
+            SObj mY(W, &oa);  const SObj& Y = mY;
+
+            mX.swap(mY);
+            ASSERT(W == X);
+            ASSERT(Y.empty());
+
+            bsl::swap(mX, mY);
+            ASSERT(X.empty());
+            ASSERT(W == Y);
+        }
+
+        if (verbose) printf("\tComparison.\n");
+
+        static const char *SPECS[] = {
+            "", "A", "B", "AB", "AC", "BA", "ABC", "ABD", "BCD", "ABCD",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            Obj mX;  const Obj& X = mX;  Model mMX;
+            for (const char *p = SPECS[ti]; *p; ++p) {
+                mX.insert(Value(*p, 0));
+                mMX.insert(Value(*p, 0));
+            }
+            for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                Obj mY;  const Obj& Y = mY;  Model mMY;
+                for (const char *p = SPECS[tj]; *p; ++p) {
+                    mY.insert(Value(*p, 0));
+                    mMY.insert(Value(*p, 0));
+                }
+                ASSERTV(ti, tj, (mMX == mMY) == (X == Y));
+                ASSERTV(ti, tj, (mMX != mMY) == (X != Y));
+                ASSERTV(ti, tj, (mMX <  mMY) == (X <  Y));
+                ASSERTV(ti, tj, (mMX >  mMY) == (X >  Y));
+                ASSERTV(ti, tj, (mMX <= mMY) == (X <= Y));
+                ASSERTV(ti, tj, (mMX >= mMY) == (X >= Y));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANGE CONSTRUCTION AND INSERTION
+        //
+        // Concerns:
+        //: 1 Construction from, and insertion of, an unsorted range produce
+        //:   the same value as inserting each element in turn into the model,
+        //:   retaining the first of each group of elements having equivalent
+        //:   keys.
+        //:
+        //: 2 The 'sorted_unique' overloads accept sorted input, and reject
+        //:   unsorted input in safe builds.
+        //:
+        //: 3 Construction from a container sorts it and removes duplicates,
+        //:   and construction from a moved container does not allocate.
+        //:
+        //: 4 The supplied allocator and comparator are used.
+        //
+        // Plan:
+        //: 1 For pseudo-random input ranges of various lengths, construct an
+        //:   object from the range, insert the range into a non-empty
+        //:   object, and compare both with the model.  (C-1)
+        //:
+        //: 2 Exercise the 'sorted_unique' overloads with sorted input, and
+        //:   use 'bsls_asserttest' to verify that they fail on unsorted
+        //:   input.  (C-2)
+        //:
+        //: 3 Construct objects from containers and verify their values and
+        //:   allocation.  (C-3..4)
+        //
+        // Testing:
+        //   flat_map(const CONTAINER& c, const C& comp = C(), const A& = A());
+        //   flat_map(const CONTAINER& c, const A& a);
+        //   flat_map(MovableRef<CONTAINER> c, const C& comp = C());
+        //   flat_map(sorted_unique_t, const CONTAINER& c, const C&, const A&);
+        //   flat_map(sorted_unique_t, MovableRef<CONTAINER> c, const C&);
+        //   flat_map(ITER first, ITER last, const C& comp, const A& a);
+        //   flat_map(ITER first, ITER last, const A& a);
+        //   flat_map(sorted_unique_t, ITER first, ITER last, const C&, ...);
+        //   flat_map(sorted_unique_t, ITER first, ITER last, const A& a);
+        //   flat_map(initializer_list<value_type>, const C&, const A&);
+        //   flat_map(initializer_list<value_type>, const A&);
+        //   flat_map(sorted_unique_t, initializer_list<value_type>, ...);
+        //   flat_map& operator=(initializer_list<value_type>);
+        //   void insert(ITER first, ITER last);
+        //   void insert(sorted_unique_t, ITER first, ITER last);
+        //   void insert(initializer_list<value_type>);
+        //   void insert(sorted_unique_t, initializer_list<value_type>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE CONSTRUCTION AND INSERTION"
+                            "\n================================\n");
+
+        RandomGenerator random;
+
+        for (int n = 0; n <= 64; ++n) {
+            bsl::vector<Value> input;
+            for (int i = 0; i < n; ++i) {
+                input.push_back(Value(random(n + 1), i));
+            }
+
+            Model mM(input.begin(), input.end());
+
+            const Obj X(input.begin(), input.end());
+            ASSERTV(n, isEqual(X, mM));
+
+            Obj mY;  const Obj& Y = mY;
+            Model mMY;
+            for (int i = 0; i < n; i += 3) {
+                mY.insert(Value(i, -1));
+                mMY.insert(Value(i, -1));
+            }
+            mY.insert(input.begin(), input.end());
+            mMY.insert(input.begin(), input.end());
+            ASSERTV(n, isEqual(Y, mMY));
+
+            const Obj Z(input);
+            ASSERTV(n, isEqual(Z, mM));
+
+            bsl::vector<Value> sorted(mM.begin(), mM.end());
+            const Obj S(bsl::sorted_unique, sorted.begin(), sorted.end());
+            ASSERTV(n, isEqual(S, mM));
+
+            mY.insert(bsl::sorted_unique, sorted.begin(), sorted.end());
+            ASSERTV(n, isEqual(Y, mMY));
+        }
+
+        if (verbose) printf("\tAllocator and comparator.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::vector<SValue> input(&oa);
+            input.push_back(SValue(3, bsl::string(LONG_STRING, &oa)));
+            input.push_back(SValue(1, bsl::string(LONG_STRING, &oa)));
+            input.push_back(SValue(2, bsl::string(LONG_STRING, &oa)));
+
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            typedef bsl::flat_map<int, bsl::string, std::greater<int> > GObj;
+
+            const GObj X(input.begin(),
+                         input.end(),
+                         std::greater<int>(),
+                         &oa);
+            ASSERT(3 == X.begin()->first);
+            ASSERT(&oa == X.begin()->second.get_allocator());
+
+            const SObj Y(input.begin(), input.end(), &oa);
+            ASSERT(1 == Y.begin()->first);
+
+            const SObj Z(input, &oa);
+            ASSERT(1 == Z.begin()->first);
+            ASSERT(&oa == Z.begin()->second.get_allocator());
+
+            SObj::container_type sorted(Y.begin(), Y.end(), &oa);
+            const SObj S1(bsl::sorted_unique, sorted, std::less<int>(), &oa);
+            ASSERT(Y == S1);
+            const SObj S2(bsl::sorted_unique,
+                          sorted.begin(),
+                          sorted.end(),
+                          &oa);
+            ASSERT(Y == S2);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const SObj M(bsl::sorted_unique, MoveUtil::move(sorted));
+            ASSERT(Y == M);
+            ASSERT(oam.isTotalSame());
+            ASSERT(dam.isTotalSame());
+
+            SObj::container_type unsorted(input.begin(), input.end(), &oa);
+            const SObj U(MoveUtil::move(unsorted));
+            ASSERT(Y == U);
+            ASSERT(&oa == U.get_allocator().mechanism());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) printf("\tInitializer lists.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            const Obj X({ {3, 0}, {1, 1}, {3, 2}, {2, 3} }, &oa);
+            ASSERT(3 == X.size());
+            ASSERT(0 == X.at(3));
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            const Obj Y(bsl::sorted_unique, { {1, 1}, {2, 3}, {3, 0} });
+            ASSERT(X == Y);
+
+            Obj mZ;  const Obj& Z = mZ;
+            mZ = { {2, 3}, {3, 0}, {1, 1} };
+            ASSERT(X == Z);
+
+            mZ.insert({ {5, 5}, {4, 4}, {1, 9} });
+            ASSERT(5 == Z.size());
+            ASSERT(1 == Z.at(1));
+
+            mZ.insert(bsl::sorted_unique, { {6, 6}, {7, 7} });
+            ASSERT(7 == Z.size());
+        }
+#endif
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Value SORTED[]   = { Value(1, 0), Value(2, 0) };
+            const Value UNSORTED[] = { Value(2, 0), Value(1, 0) };
+            const Value DUPLICATE[] = { Value(1, 0), Value(1, 0) };
+
+            Obj mX;
+
+            ASSERT_SAFE_PASS(Obj(bsl::sorted_unique, SORTED, SORTED + 2));
+            ASSERT_SAFE_FAIL(Obj(bsl::sorted_unique, UNSORTED, UNSORTED + 2));
+            ASSERT_SAFE_FAIL(Obj(bsl::sorted_unique,
+                                 DUPLICATE,
+                                 DUPLICATE + 2));
+            ASSERT_SAFE_PASS(mX.insert(bsl::sorted_unique,
+                                       SORTED,
+                                       SORTED + 2));
+            ASSERT_SAFE_FAIL(mX.insert(bsl::sorted_unique,
+                                       UNSORTED,
+                                       UNSORTED + 2));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // DEFAULT CONSTRUCTION, BASIC INSERTION, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object is empty, and uses the default
+        //:   allocator and a default-constructed comparator.
+        //:
+        //: 2 An object constructed with an allocator or comparator uses it.
+        //:
+        //: 3 'insert' of a value keeps the elements sorted and unique, and the
+        //:   iterator accessors visit them in order.
+        //:
+        //: 4 'clear' empties the object.
+        //:
+        //: 5 The type has the expected traits.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and verify their state.
+        //:   (C-1..2)
+        //:
+        //: 2 Insert a pseudo-random sequence of values into an object and
+        //:   into the model, and compare them, iterating forwards and
+        //:   backwards.  (C-3..4)
+        //:
+        //: 3 Verify the traits at compile time.  (C-5)
+        //
+        // Testing:
+        //   flat_map();
+        //   flat_map(const C& comparator, const A& allocator = A());
+        //   flat_map(const A& allocator);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   void clear();
+        //   iterator begin(), end(), rbegin(), rend() and 'const' variants
+        //   bool empty() const;
+        //   size_type size() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+             "\nDEFAULT CONSTRUCTION, BASIC INSERTION, AND BASIC ACCESSORS"
+             "\n==========================================================\n");
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+
+            const Obj Y(&oa);
+            ASSERT(&oa == Y.get_allocator().mechanism());
+
+            typedef bsl::flat_map<int, int, std::greater<int> > GObj;
+
+            const GObj Z(std::greater<int>(), &oa);
+            ASSERT(&oa == Z.get_allocator().mechanism());
+            ASSERT(Z.key_comp()(2, 1));
+            ASSERT(Z.value_comp()(Value(2, 0), Value(1, 0)));
+        }
+
+        RandomGenerator random;
+
+        Obj   mX(&oa);  const Obj& X = mX;
+        Model mM;
+        for (int i = 0; i < 500; ++i) {
+            const Value V(random(200), i);
+
+            bsl::pair<Obj::iterator, bool>   r  = mX.insert(V);
+            bsl::pair<Model::iterator, bool> mr = mM.insert(V);
+
+            ASSERTV(i, mr.second == r.second);
+            ASSERTV(i, mr.first->second == r.first->second);
+        }
+        ASSERT(isEqual(X, mM));
+
+        Model::const_reverse_iterator mrit = mM.rbegin();
+        Obj::reverse_iterator         rit  = mX.rbegin();
+        Obj::const_reverse_iterator   crit = X.crbegin();
+        for (; mrit != mM.rend(); ++mrit, ++rit, ++crit) {
+            ASSERTV(mrit->first, mrit->first == rit->first);
+            ASSERTV(mrit->first, mrit->first == crit->first);
+        }
+        ASSERT(mX.rend() == rit);
+        ASSERT(X.crend() == crit);
+        ASSERT(X.rend()  == X.crend());
+        ASSERT(X.cbegin() == X.begin());
+        ASSERT(X.cend()   == X.end());
+
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT( mX.insert(Value(2, 20)).second);
+        ASSERT( mX.insert(Value(1, 10)).second);
+        ASSERT(!mX.insert(Value(2, 99)).second);
+        ASSERT(2 == X.size());
+        ASSERT(1 == X.begin()->first);
+        ASSERT(20 == X.at(2));
+
+        mX[3] = 30;
+        ASSERT(3 == X.size());
+        ASSERT(30 == X.find(3)->second);
+        ASSERT(X.end() == X.find(4));
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        ASSERT(1 == mY.erase(2));
+        ASSERT(X != Y);
+        ASSERT(X < Y);
+
+        mX.swap(mY);
+        ASSERT(2 == X.size());
+        ASSERT(3 == Y.size());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LOOKUP COMPARED TO 'bsl::map'
+        //
+        // Concerns:
+        //: 1 Looking up keys in a 'flat_map' is faster than in a 'bsl::map'
+        //:   holding the same elements.
+        //
+        // Plan:
+        //: 1 For several sizes, build a 'flat_map' and a 'bsl::map' holding
+        //:   the same pseudo-random keys, and time a fixed number of 'find'
+        //:   operations for a pseudo-random sequence of keys, half of which
+        //:   are present, on each.  Also time iteration over all elements.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: lookup compared to 'bsl::map'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: LOOKUP COMPARED TO 'bsl::map'"
+               "\n==========================================\n");
+
+        const int NUM_LOOKUPS = argc > 2 ? atoi(argv[2]) : 4000000;
+
+        static const int SIZES[] = { 16, 256, 4096, 65536, 1048576 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%10s %14s %14s %14s %14s\n",
+               "size", "map find", "flat find", "map iter", "flat iter");
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            RandomGenerator random(ti + 1);
+
+            bsl::vector<int> keys;
+            for (int i = 0; i < SIZE; ++i) {
+                keys.push_back(random(SIZE * 2) * 2);
+            }
+
+            Model mM;
+            for (int i = 0; i < SIZE; ++i) {
+                mM.insert(Value(keys[i], i));
+            }
+            const Obj X(mM.begin(), mM.end());
+
+            bsl::vector<int> probes;
+            for (int i = 0; i < 4096; ++i) {
+                probes.push_back(random(2) ? keys[random(SIZE)]
+                                           : random(SIZE * 4));
+            }
+
+            bsls::Stopwatch timer;
+            long            sum = 0;
+
+            timer.start(true);
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                Model::const_iterator it = mM.find(probes[i & 4095]);
+                sum += it == mM.end() ? 0 : it->second;
+            }
+            timer.stop();
+            const double MAP_FIND = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                Obj::const_iterator it = X.find(probes[i & 4095]);
+                sum -= it == X.end() ? 0 : it->second;
+            }
+            timer.stop();
+            const double FLAT_FIND = timer.accumulatedWallTime();
+
+            const int PASSES = NUM_LOOKUPS / SIZE + 1;
+
+            timer.reset();
+            timer.start(true);
+            for (int p = 0; p < PASSES; ++p) {
+                for (Model::const_iterator it  = mM.begin();
+                                           it != mM.end();
+                                         ++it) {
+                    sum += it->second;
+                }
+            }
+            timer.stop();
+            const double MAP_ITER = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int p = 0; p < PASSES; ++p) {
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    sum -= it->second;
+                }
+            }
+            timer.stop();
+            const double FLAT_ITER = timer.accumulatedWallTime();
+
+            ASSERTV(sum, 0 == sum);
+
+            printf("%10d %14.6f %14.6f %14.6f %14.6f\n",
+                   SIZE, MAP_FIND, FLAT_FIND, MAP_ITER, FLAT_ITER);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
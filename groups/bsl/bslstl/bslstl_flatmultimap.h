@@ -0,0 +1,1901 @@
+// bslstl_flatmultimap.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTIMAP
+#define INCLUDED_BSLSTL_FLATMULTIMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multimap stored in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_multimap: multimap adaptor storing elements in a sorted sequence
+//
+//@CANONICAL_HEADER: bsl_flat_map.h
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatset, bslstl_multimap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multimap', implementing the C++23 standard container adaptor
+// 'std::flat_multimap'.  A 'flat_multimap' provides the interface of an
+// ordered map that may hold multiple elements having equivalent keys (see
+// 'bsl::multimap'), but stores its '(key, value)' pairs in a single sequence
+// container (by default, a 'bsl::vector') kept sorted by key.  Elements
+// having equivalent keys are kept in the order in which they were inserted.
+//
+// See 'bslstl_flatmap' for a discussion of the performance characteristics
+// of the flat containers, and of how 'bsl::flat_multimap' differs from
+// 'std::flat_multimap' (which are the same as the differences between
+// 'bsl::flat_map' and 'std::flat_map').  Where 'bsl::flat_map' accepts the
+// 'bsl::sorted_unique' tag to indicate that input is already sorted,
+// 'bsl::flat_multimap' accepts the 'bsl::sorted_equivalent' tag, which
+// indicates that the input is sorted but may contain equivalent keys.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Log Records by Severity
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we collect a batch of log records, and want to examine them grouped
+// by severity, preserving the order in which records of the same severity
+// arrived.
+//
+// First, we define the index type:
+//..
+//  enum Severity { e_ERROR = 1, e_WARN = 2, e_INFO = 3 };
+//
+//  typedef bsl::flat_multimap<int, const char *> LogIndex;
+//..
+// Then, we bulk-load the records of a batch, which arrive in no particular
+// order of severity:
+//..
+//  typedef LogIndex::value_type Record;
+//
+//  const Record batch[] = {
+//      Record(e_INFO,  "connected"),
+//      Record(e_ERROR, "disk full"),
+//      Record(e_WARN,  "slow response"),
+//      Record(e_ERROR, "write failed"),
+//      Record(e_INFO,  "disconnected"),
+//  };
+//  const int NUM_RECORDS = sizeof batch / sizeof *batch;
+//
+//  LogIndex index(batch, batch + NUM_RECORDS);
+//  assert(5 == index.size());
+//..
+// Next, we count the errors:
+//..
+//  assert(2 == index.count(e_ERROR));
+//..
+// Finally, we visit the errors, and observe that they are presented in the
+// order in which they arrived:
+//..
+//  bsl::pair<LogIndex::const_iterator, LogIndex::const_iterator> errors =
+//                                                 index.equal_range(e_ERROR);
+//
+//  LogIndex::const_iterator it = errors.first;
+//  assert(0 == strcmp("disk full",    it->second));
+//  ++it;
+//  assert(0 == strcmp("write failed", it->second));
+//  ++it;
+//  assert(errors.second == it);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flatcontainerutil.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <algorithm>
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                            // ===================
+                            // class flat_multimap
+                            // ===================
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class CONTAINER  = bsl::vector<bsl::pair<KEY, VALUE> > >
+class flat_multimap {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs, possibly having equivalent
+    // keys, stored in a sorted sequence container of the (template parameter)
+    // type 'CONTAINER'.  Keys are ordered by the (template parameter) type
+    // 'COMPARATOR'.  The elements of 'CONTAINER' must be
+    // 'bsl::pair<KEY, VALUE>' (or another pair type whose 'first' and
+    // 'second' members are of type 'KEY' and 'VALUE', respectively), and
+    // 'CONTAINER' must provide random-access iterators.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see 'bsldoc_glossary'.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslmf::MovableRefUtil               MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil           Util;
+        // This 'typedef' is an alias for the utility implementing the search
+        // and merge algorithms on the underlying sequence.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil_PairFirstKey
+                                                             KeyPolicy;
+        // This 'typedef' is an alias for the policy extracting the key from
+        // an element.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil_ClearProctor<CONTAINER>
+                                                             ClearProctor;
+        // This 'typedef' is an alias for the proctor restoring the invariants
+        // of this multimap if an exception is thrown while its elements are
+        // being rearranged.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef typename CONTAINER::value_type             value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef typename CONTAINER::allocator_type         allocator_type;
+    typedef typename CONTAINER::reference              reference;
+    typedef typename CONTAINER::const_reference        const_reference;
+    typedef typename CONTAINER::size_type              size_type;
+    typedef typename CONTAINER::difference_type        difference_type;
+    typedef typename CONTAINER::iterator               iterator;
+    typedef typename CONTAINER::const_iterator         const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+    typedef CONTAINER                                  container_type;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by adapting an object of (template parameter) type
+        // 'COMPARATOR', which compares two objects of (template parameter)
+        // type 'KEY'.
+
+        // FRIENDS
+        friend class flat_multimap;
+
+      protected:
+        // PROTECTED DATA
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member 'protected'; however, it is required by
+                          // the C++ standard
+
+        // PROTECTED CREATORS
+        value_compare(COMPARATOR comparator);                       // IMPLICIT
+            // Create a 'value_compare' object that uses the specified
+            // 'comparator'.
+
+      public:
+        // PUBLIC TYPES
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to the
+            // overload of 'operator()' of this class.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' of this class.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' of this class.
+
+        // ACCESSORS
+        bool operator()(const value_type& x, const value_type& y) const;
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction, and 'false' otherwise.
+    };
+
+  private:
+    // DATA
+    container_type d_container;   // sorted sequence of elements
+    key_compare    d_comparator;  // key comparator
+
+    // PRIVATE MANIPULATORS
+    iterator insertPositionFromHint(const_iterator hint, const key_type& key);
+        // Return the position at which an element having the specified 'key'
+        // should be inserted into this multimap: the specified 'hint', if
+        // inserting at 'hint' preserves the ordering of this multimap, and
+        // the position following the last element whose key is equivalent to
+        // 'key' otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(flat_multimap,
+                                   BloombergLP::bslalg::HasStlIterators);
+
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+        flat_multimap,
+        BloombergLP::bslma::UsesBslmaAllocator,
+        BloombergLP::bslma::UsesBslmaAllocator<container_type>::value);
+
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+        flat_multimap,
+        BloombergLP::bslmf::IsBitwiseMoveable,
+        BloombergLP::bslmf::IsBitwiseMoveable<container_type>::value &&
+            BloombergLP::bslmf::IsBitwiseMoveable<key_compare>::value);
+
+    // CREATORS
+    flat_multimap();
+    explicit flat_multimap(
+                      const COMPARATOR&     comparator,
+                      const allocator_type& basicAllocator = allocator_type());
+    explicit flat_multimap(const allocator_type& basicAllocator);
+        // Create an empty multimap.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of type 'allocator_type' is used.  Note
+        // that, with the default 'CONTAINER', a 'bslma::Allocator *' can be
+        // supplied for 'basicAllocator', and the currently installed default
+        // allocator is used if none is supplied.
+
+    flat_multimap(const flat_multimap& original);
+        // Create a multimap having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this multimap.  The allocator of the new multimap is
+        // obtained from the copy constructor of 'CONTAINER'; with the default
+        // 'CONTAINER', that is the currently installed default allocator.
+
+    flat_multimap(BloombergLP::bslmf::MovableRef<flat_multimap> original);
+        // Create a multimap having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new multimap.  Use a copy of 'original.key_comp()' to order the
+        // keys contained in this multimap.  The allocator associated with
+        // 'original' is propagated for use in the newly-created multimap.
+        // 'original' is left in a valid but unspecified state.
+
+    flat_multimap(const flat_multimap&  original,
+                  const allocator_type& basicAllocator);
+        // Create a multimap having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this multimap.
+
+    flat_multimap(
+                 BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                 const allocator_type&                         basicAllocator);
+        // Create a multimap having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // multimap if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.
+
+    explicit flat_multimap(
+                  const container_type& container,
+                  const COMPARATOR&     comparator     = COMPARATOR(),
+                  const allocator_type& basicAllocator = allocator_type());
+    flat_multimap(const container_type& container,
+                  const allocator_type& basicAllocator);
+        // Create a multimap holding the elements of the specified 'container',
+        // stably sorted by key.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of type 'allocator_type' is used.
+
+    explicit flat_multimap(
+                   BloombergLP::bslmf::MovableRef<container_type> container,
+                   const COMPARATOR&                              comparator =
+                                                                 COMPARATOR());
+        // Create a multimap holding the elements of the specified 'container'
+        // (on entry), stably sorted by key, by moving (in constant time) the
+        // contents of 'container' into the new multimap.  Optionally specify
+        // a 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  The allocator
+        // associated with 'container' is propagated for use in the
+        // newly-created multimap.  'container' is left in a valid but
+        // unspecified state.
+
+    flat_multimap(sorted_equivalent_t,
+                  const container_type& container,
+                  const COMPARATOR&     comparator     = COMPARATOR(),
+                  const allocator_type& basicAllocator = allocator_type());
+        // Create a multimap holding the elements of the specified 'container'.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.  The behavior is undefined unless
+        // the elements of 'container' are sorted by key.
+
+    flat_multimap(sorted_equivalent_t,
+                  BloombergLP::bslmf::MovableRef<container_type> container,
+                  const COMPARATOR& comparator = COMPARATOR());
+        // Create a multimap holding the elements of the specified 'container'
+        // (on entry) by moving (in constant time) the contents of 'container'
+        // into the new multimap.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  The allocator associated with
+        // 'container' is propagated for use in the newly-created multimap.
+        // 'container' is left in a valid but unspecified state.  The behavior
+        // is undefined unless the elements of 'container' are sorted by key.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  const COMPARATOR&     comparator     = COMPARATOR(),
+                  const allocator_type& basicAllocator = allocator_type());
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  const allocator_type& basicAllocator);
+        // Create a multimap, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  Optionally specify
+        // a 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of type 'allocator_type'
+        // is used.  If the sequence 'first' to 'last' is ordered by key, this
+        // operation has 'O[N]' complexity, where 'N' is the number of elements
+        // in the sequence; otherwise it has 'O[N * log(N)]' complexity.  The
+        // (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  const COMPARATOR&     comparator     = COMPARATOR(),
+                  const allocator_type& basicAllocator = allocator_type());
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  const allocator_type& basicAllocator);
+        // Create a multimap holding the 'value_type' objects in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, in linear time.  Optionally
+        // specify a 'comparator' used to order keys contained in this object.
+        // If 'comparator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'COMPARATOR' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last', and the sequence is sorted by
+        // key.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multimap(std::initializer_list<value_type> values,
+                  const COMPARATOR&                 comparator = COMPARATOR(),
+                  const allocator_type&             basicAllocator =
+                                                             allocator_type());
+    flat_multimap(std::initializer_list<value_type> values,
+                  const allocator_type&             basicAllocator);
+        // Create a multimap and insert each 'value_type' object in the
+        // specified 'values' initializer list.  Optionally specify a
+        // 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of type 'allocator_type'
+        // is used.
+
+    flat_multimap(sorted_equivalent_t,
+                  std::initializer_list<value_type> values,
+                  const COMPARATOR&                 comparator = COMPARATOR(),
+                  const allocator_type&             basicAllocator =
+                                                             allocator_type());
+        // Create a multimap holding the 'value_type' objects in the specified
+        // 'values' initializer list.  Optionally specify a 'comparator' used
+        // to order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of type 'allocator_type' is used.  The
+        // behavior is undefined unless 'values' is sorted by key.
+#endif
+
+    //! ~flat_multimap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multimap& operator=(const flat_multimap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    flat_multimap& operator=(
+                           BloombergLP::bslmf::MovableRef<flat_multimap> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The contents of 'rhs' are moved to this multimap using
+        // the move-assignment operator of 'CONTAINER'.  'rhs' is left in a
+        // valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multimap& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // multimap and then inserting each 'value_type' object in the
+        // specified 'values' initializer list; return a reference providing
+        // modifiable access to this object.
+#endif
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'end' iterator if this multimap
+        // is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this multimap.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or 'rend' if this multimap is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this multimap.  Note that the multimap is
+        // empty after this call, but allocated memory may be retained for
+        // future use.
+
+    iterator insert(const value_type& value);
+    iterator insert(BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' (copied or moved, as appropriate) into
+        // this multimap, after any elements having a key equivalent to that
+        // of 'value', and return an iterator referring to the newly inserted
+        // 'value_type' object.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' (copied or moved, as appropriate) into
+        // this multimap (in amortized constant search time, if the specified
+        // 'hint' is a valid insertion position for 'value'), and return an
+        // iterator referring to the newly inserted 'value_type' object.  If
+        // 'hint' is a valid insertion position, 'value' is inserted
+        // immediately before 'hint'; otherwise, it is inserted after any
+        // elements having a key equivalent to that of 'value'.  The behavior
+        // is undefined unless 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator.  The elements are
+        // appended to the underlying sequence, stably sorted, and merged into
+        // place, so that this operation has 'O[M * log(M) + N]' complexity,
+        // where 'M' is the length of the range and 'N' is the size of this
+        // multimap.  If an exception is thrown while sorting or merging, this
+        // multimap is left empty.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator.  This operation
+        // has 'O[M + N]' complexity, where 'M' is the length of the range and
+        // 'N' is the size of this multimap.  If an exception is thrown while
+        // merging, this multimap is left empty.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last', and the sequence is
+        // sorted by key.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the specified 'values' initializer list.
+
+    void insert(sorted_equivalent_t, std::initializer_list<value_type> values);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the specified 'values' initializer list.  The behavior is undefined
+        // unless 'values' is sorted by key.
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... Args>
+    iterator emplace(Args&&... args);
+        // Insert into this multimap a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'args' to the corresponding
+        // constructor of 'value_type', after any elements having an
+        // equivalent key, and return an iterator referring to the newly
+        // created and inserted object.
+
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args);
+        // Insert into this multimap a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'args' to the corresponding
+        // constructor of 'value_type' (in amortized constant search time, if
+        // the specified 'hint' is a valid insertion position for the object),
+        // and return an iterator referring to the newly created and inserted
+        // object.  If 'hint' is a valid insertion position, the object is
+        // inserted immediately before 'hint'; otherwise, it is inserted after
+        // any elements having an equivalent key.  The behavior is undefined
+        // unless 'hint' is an iterator in the range '[begin() .. end()]'
+        // (both endpoints included).
+#endif
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this multimap the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  The
+        // behavior is undefined unless 'position' refers to a 'value_type'
+        // object in this multimap.
+
+    size_type erase(const key_type& key);
+        // Remove from this multimap all 'value_type' objects whose keys are
+        // equivalent to the specified 'key', if such entries exist, and
+        // return the number of erased objects; otherwise, if there is no
+        // 'value_type' object having an equivalent key, return 0 with no
+        // other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multimap the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including, the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this multimap
+        // or are the 'end' iterator, and the 'first' position is at or before
+        // the 'last' position in the ordered sequence provided by this
+        // container.
+
+    container_type extract();
+        // Move the underlying sequence out of this multimap, leaving this
+        // multimap empty, and return it.
+
+    void replace(BloombergLP::bslmf::MovableRef<container_type> container);
+        // Replace the underlying sequence of this multimap with the specified
+        // 'container' (on entry), using the move-assignment operator of
+        // 'CONTAINER'.  'container' is left in a valid but unspecified state.
+        // The behavior is undefined unless the elements of 'container' are
+        // sorted by key.
+
+    void swap(flat_multimap& other)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object, using the 'swap' method of 'CONTAINER' to
+        // exchange the underlying sequences.
+
+    iterator find(const key_type& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    iterator lower_bound(const key_type& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multimap does not contain a 'value_type' object
+        // whose key is greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multimap does not contain a 'value_type' object
+        // whose key is greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    iterator upper_bound(const key_type& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this multimap does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this multimap does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this multimap
+        // contains no 'value_type' objects with a key equivalent to 'key',
+        // then the two returned iterators will have the same value.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator first = lower_bound(key);
+        return pair<iterator, iterator>(
+                                      first,
+                                      Util::upperBound<KeyPolicy>(
+                                                            first,
+                                                            d_container.end(),
+                                                            key,
+                                                            d_comparator));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this multimap
+        // contains no 'value_type' objects with a key equivalent to 'key',
+        // then the two returned iterators will have the same value.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator first = lower_bound(key);
+        return pair<iterator, iterator>(
+                                      first,
+                                      Util::upperBound<KeyPolicy>(
+                                                            first,
+                                                            d_container.end(),
+                                                            key,
+                                                            d_comparator));
+    }
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multimap.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'end' iterator if this multimap
+        // is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this multimap.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multimap, or 'rend' if this multimap is
+        // empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this multimap contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this multimap.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this multimap could possibly hold.  Note that there is no
+        // guarantee that the multimap can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this multimap; if a comparator was supplied at construction, return
+        // its value; otherwise, return a default constructed 'key_compare'
+        // object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their respective keys using 'key_comp()'.
+
+    const_iterator find(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    size_type count(const key_type& key) const
+        // Return the number of 'value_type' objects within this multimap
+        // whose keys are equivalent to the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this multimap
+        // whose keys are equivalent to the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    bool contains(const key_type& key) const
+        // Return 'true' if this multimap contains an element whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this multimap contains an element whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return find(key) != end();
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater-than or equal-to the specified 'key', and the
+        // past-the-end iterator if this multimap does not contain a
+        // 'value_type' object whose key is greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater-than or equal-to the specified 'key', and the
+        // past-the-end iterator if this multimap does not contain a
+        // 'value_type' object whose key is greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater than the specified 'key', and the past-the-end iterator
+        // if this multimap does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater than the specified 'key', and the past-the-end iterator
+        // if this multimap does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this multimap
+        // contains no 'value_type' objects with a key equivalent to 'key',
+        // then the two returned iterators will have the same value.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator first = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                                      first,
+                                      Util::upperBound<KeyPolicy>(
+                                                            first,
+                                                            d_container.end(),
+                                                            key,
+                                                            d_comparator));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this multimap
+        // contains no 'value_type' objects with a key equivalent to 'key',
+        // then the two returned iterators will have the same value.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator first = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                                      first,
+                                      Util::upperBound<KeyPolicy>(
+                                                            first,
+                                                            d_container.end(),
+                                                            key,
+                                                            d_comparator));
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator==(const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multimap' objects have the
+    // same value if they have the same number of key-value pairs, and each
+    // element in the ordered sequence of key-value pairs of 'lhs' has the
+    // same value as the corresponding element in the ordered sequence of
+    // key-value pairs of 'rhs'.  This method requires that the (template
+    // parameter) types 'KEY' and 'VALUE' both be 'equality-comparable'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator!=(const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multimap' objects do not
+    // have the same value if they do not have the same number of key-value
+    // pairs, or some element in the ordered sequence of key-value pairs of
+    // 'lhs' does not have the same value as the corresponding element in the
+    // ordered sequence of key-value pairs of 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator<(const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than that of the specified 'rhs' multimap, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of multimap 'lhs' is lexicographically less than that of
+    // multimap 'rhs' if 'true == *i < *j' for the first pair of corresponding
+    // iterator positions where '*i < *j' and '*j < *i' are not both 'false'.
+    // If no such corresponding iterator position exists, the value of 'lhs'
+    // is lexicographically less than that of 'rhs' if
+    // 'lhs.size() < rhs.size()'.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator>(const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically greater than that of the specified 'rhs' multimap,
+    // and 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator<=(const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  Note that this operator returns
+    // '!(rhs < lhs)'.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+bool operator>=(const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class CONTAINER,
+          class PREDICATE>
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+erase_if(flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& m,
+         PREDICATE                                         predicate);
+    // Erase all the elements in the specified multimap 'm' that satisfy the
+    // specified predicate 'predicate'.  Return the number of elements erased.
+    // Note that, unlike repeated calls to 'erase', this operation has linear
+    // complexity.
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+void swap(flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& a,
+          flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                     // ----------------------------------
+                     // class flat_multimap::value_compare
+                     // ----------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::value_compare::value_compare(
+                                                         COMPARATOR comparator)
+: comp(comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::value_compare::operator()(
+                                                     const value_type& x,
+                                                     const value_type& y) const
+{
+    return comp(x.first, y.first);
+}
+
+                            // -------------------
+                            // class flat_multimap
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insertPositionFromHint(
+                                                   const_iterator  hint,
+                                                   const key_type& key)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    if ((hint == cbegin() || !d_comparator(key, (hint - 1)->first))
+     && (hint == cend()   || !d_comparator(hint->first, key))) {
+        return begin() + (hint - cbegin());                           // RETURN
+    }
+    return upper_bound(key);
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap()
+: d_container()
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                         const COMPARATOR&     comparator,
+                                         const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                          const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                                 const flat_multimap& original)
+: d_container(original.d_container)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                        BloombergLP::bslmf::MovableRef<flat_multimap> original)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                        const flat_multimap&  original,
+                                        const allocator_type& basicAllocator)
+: d_container(original.d_container, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                const allocator_type&                         basicAllocator)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container),
+              basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                        const container_type& container,
+                                        const COMPARATOR&     comparator,
+                                        const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator(comparator)
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                        const container_type& container,
+                                        const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator()
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                     BloombergLP::bslmf::MovableRef<container_type> container,
+                     const COMPARATOR&                              comparator)
+: d_container(MoveUtil::move(container))
+, d_comparator(comparator)
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                        sorted_equivalent_t,
+                                        const container_type& container,
+                                        const COMPARATOR&     comparator,
+                                        const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSorted<KeyPolicy>(d_container.begin(),
+                                               d_container.end(),
+                                               d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                     sorted_equivalent_t,
+                     BloombergLP::bslmf::MovableRef<container_type> container,
+                     const COMPARATOR&                              comparator)
+: d_container(MoveUtil::move(container))
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSorted<KeyPolicy>(d_container.begin(),
+                                               d_container.end(),
+                                               d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                        INPUT_ITERATOR        first,
+                                        INPUT_ITERATOR        last,
+                                        const COMPARATOR&     comparator,
+                                        const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator(comparator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                        INPUT_ITERATOR        first,
+                                        INPUT_ITERATOR        last,
+                                        const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator()
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                        sorted_equivalent_t,
+                                        INPUT_ITERATOR        first,
+                                        INPUT_ITERATOR        last,
+                                        const COMPARATOR&     comparator,
+                                        const allocator_type& basicAllocator)
+: d_container(first, last, basicAllocator)
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSorted<KeyPolicy>(d_container.begin(),
+                                               d_container.end(),
+                                               d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                                        sorted_equivalent_t,
+                                        INPUT_ITERATOR        first,
+                                        INPUT_ITERATOR        last,
+                                        const allocator_type& basicAllocator)
+: d_container(first, last, basicAllocator)
+, d_comparator()
+{
+    BSLS_ASSERT_SAFE(Util::isSorted<KeyPolicy>(d_container.begin(),
+                                               d_container.end(),
+                                               d_comparator));
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                             std::initializer_list<value_type> values,
+                             const COMPARATOR&                 comparator,
+                             const allocator_type&             basicAllocator)
+: flat_multimap(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                             std::initializer_list<value_type> values,
+                             const allocator_type&             basicAllocator)
+: flat_multimap(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::flat_multimap(
+                             sorted_equivalent_t,
+                             std::initializer_list<value_type> values,
+                             const COMPARATOR&                 comparator,
+                             const allocator_type&             basicAllocator)
+: flat_multimap(sorted_equivalent,
+                values.begin(),
+                values.end(),
+                comparator,
+                basicAllocator)
+{
+}
+#endif
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>&
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::operator=(
+                                                      const flat_multimap& rhs)
+{
+    d_container  = rhs.d_container;
+    d_comparator = rhs.d_comparator;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>&
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::operator=(
+                             BloombergLP::bslmf::MovableRef<flat_multimap> rhs)
+{
+    flat_multimap& lvalue = rhs;
+
+    d_container  = MoveUtil::move(lvalue.d_container);
+    d_comparator = lvalue.d_comparator;
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>&
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::rbegin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    d_container.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                                                       const value_type& value)
+{
+    return d_container.insert(upper_bound(value.first), value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    return d_container.insert(upper_bound(lvalue.first),
+                              MoveUtil::move(lvalue));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                                                     const_iterator    hint,
+                                                     const value_type& value)
+{
+    return d_container.insert(insertPositionFromHint(hint, value.first),
+                              value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    return d_container.insert(insertPositionFromHint(hint, lvalue.first),
+                              MoveUtil::move(lvalue));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+void flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    const size_type position = d_container.size();
+
+    d_container.insert(d_container.end(), first, last);
+
+    ClearProctor proctor(&d_container);
+
+    Util::sortAndMerge<KeyPolicy>(&d_container, position, d_comparator);
+
+    proctor.release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+void flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                                                     sorted_equivalent_t,
+                                                     INPUT_ITERATOR      first,
+                                                     INPUT_ITERATOR      last)
+{
+    const size_type position = d_container.size();
+
+    d_container.insert(d_container.end(), first, last);
+
+    BSLS_ASSERT_SAFE(Util::isSorted<KeyPolicy>(d_container.begin() + position,
+                                               d_container.end(),
+                                               d_comparator));
+
+    ClearProctor proctor(&d_container);
+
+    Util::merge<KeyPolicy>(&d_container, position, d_comparator);
+
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::insert(
+                                      sorted_equivalent_t,
+                                      std::initializer_list<value_type> values)
+{
+    insert(sorted_equivalent, values.begin(), values.end());
+}
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class... Args>
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::emplace(Args&&... args)
+{
+    BloombergLP::bsls::ObjectBuffer<value_type> temp;
+
+    allocator_type alloc = get_allocator();
+
+    bsl::allocator_traits<allocator_type>::construct(
+                                 alloc,
+                                 temp.address(),
+                                 BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+    BloombergLP::bslma::DestructorGuard<value_type> guard(temp.address());
+
+    return insert(MoveUtil::move(temp.object()));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+template <class... Args>
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::emplace_hint(
+                                                   const_iterator hint,
+                                                   Args&&...      args)
+{
+    BloombergLP::bsls::ObjectBuffer<value_type> temp;
+
+    allocator_type alloc = get_allocator();
+
+    bsl::allocator_traits<allocator_type>::construct(
+                                 alloc,
+                                 temp.address(),
+                                 BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+    BloombergLP::bslma::DestructorGuard<value_type> guard(temp.address());
+
+    return insert(hint, MoveUtil::move(temp.object()));
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_container.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::erase(iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::erase(const key_type& key)
+{
+    pair<iterator, iterator> range = equal_range(key);
+
+    const size_type count = range.second - range.first;
+    d_container.erase(range.first, range.second);
+    return count;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::erase(const_iterator first,
+                                                        const_iterator last)
+{
+    return d_container.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::container_type
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::extract()
+{
+    container_type result(MoveUtil::move(d_container));
+    d_container.clear();
+    return MoveUtil::move(result);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::replace(
+                      BloombergLP::bslmf::MovableRef<container_type> container)
+{
+    BSLS_ASSERT_SAFE(Util::isSorted<KeyPolicy>(
+                                         MoveUtil::access(container).begin(),
+                                         MoveUtil::access(container).end(),
+                                         d_comparator));
+
+    d_container = MoveUtil::move(container);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::swap(
+                                                          flat_multimap& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    d_container.swap(other.d_container);
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::allocator_type
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.get_allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::rbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::rend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::crend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::key_compare
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::value_compare
+flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::value_comp() const
+{
+    return value_compare(d_comparator);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator==(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator!=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator<(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator>(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator<=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator>=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class CONTAINER,
+          class PREDICATE>
+inline
+typename bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>::size_type
+bsl::erase_if(flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& m,
+              PREDICATE                                         predicate)
+{
+    typedef flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER> MultimapType;
+
+    typename MultimapType::iterator first = std::remove_if(m.begin(),
+                                                           m.end(),
+                                                           predicate);
+    typename MultimapType::size_type count = m.end() - first;
+    m.erase(first, m.end());
+    return count;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class CONTAINER>
+inline
+void bsl::swap(bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& a,
+               bsl::flat_multimap<KEY, VALUE, COMPARATOR, CONTAINER>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
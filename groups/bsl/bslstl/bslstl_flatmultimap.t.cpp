@@ -0,0 +1,916 @@
+// bslstl_flatmultimap.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultimap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_multimap.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The object under test is a container adaptor whose interface and contract
+// are dictated by the C++23 standard, with the differences documented in the
+// component header.  Since 'bsl::multimap' provides the same interface with
+// the same semantics, most test cases compare the state of a 'flat_multimap'
+// with that of a 'bsl::multimap' (the *model*) after applying the same
+// sequence of operations to both.  Each element carries a sequence number as
+// its mapped value, so that comparing with the model also verifies that
+// elements having equivalent keys are kept in insertion order.  Much of the
+// implementation is shared with 'bsl::flat_map' through
+// 'bslstl_flatcontainerutil', so this driver concentrates on the behavior
+// specific to equivalent keys.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multimap();
+// [ 2] flat_multimap(const A& allocator);
+// [ 5] flat_multimap(const flat_multimap& original);
+// [ 5] flat_multimap(MovableRef<flat_multimap> original);
+// [ 5] flat_multimap(const flat_multimap& original, const A& allocator);
+// [ 3] flat_multimap(const CONTAINER& c, const C& comp, const A& a);
+// [ 3] flat_multimap(MovableRef<CONTAINER> c, const C& comp = C());
+// [ 3] flat_multimap(sorted_equivalent_t, const CONTAINER& c, ...);
+// [ 3] flat_multimap(ITER first, ITER last, const C& comp, const A& a);
+// [ 3] flat_multimap(sorted_equivalent_t, ITER first, ITER last, ...);
+// [ 3] flat_multimap(initializer_list<value_type>, const C&, const A&);
+// [ 3] flat_multimap(sorted_equivalent_t, initializer_list<value_type>, ...);
+//
+// MANIPULATORS
+// [ 5] flat_multimap& operator=(const flat_multimap& rhs);
+// [ 5] flat_multimap& operator=(MovableRef<flat_multimap> rhs);
+// [ 2] iterator insert(const value_type& value);
+// [ 2] iterator insert(MovableRef<value_type> value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] iterator insert(const_iterator hint, MovableRef<value_type> value);
+// [ 3] void insert(ITER first, ITER last);
+// [ 3] void insert(sorted_equivalent_t, ITER first, ITER last);
+// [ 2] iterator emplace(Args&&...);
+// [ 2] iterator emplace_hint(const_iterator, Args&&...);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] size_type erase(const key_type& key);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 4] CONTAINER extract();
+// [ 4] void replace(MovableRef<CONTAINER> container);
+// [ 5] void swap(flat_multimap& other);
+//
+// ACCESSORS
+// [ 4] iterator find(const key_type& key);
+// [ 4] size_type count(const key_type& key) const;
+// [ 4] bool contains(const key_type& key) const;
+// [ 4] iterator lower_bound(const key_type& key);
+// [ 4] iterator upper_bound(const key_type& key);
+// [ 4] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// FREE FUNCTIONS
+// [ 5] bool operator==(const flat_multimap&, const flat_multimap&);
+// [ 5] bool operator<(const flat_multimap&, const flat_multimap&);
+// [ 4] size_type erase_if(flat_multimap&, PREDICATE);
+// [ 5] void swap(flat_multimap&, flat_multimap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bslmf::MovableRefUtil                    MoveUtil;
+
+typedef bsl::flat_multimap<int, int>             Obj;
+typedef Obj::value_type                          Value;
+typedef bsl::multimap<int, int>                  Model;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+const char *const LONG_STRING = "This string is long enough to allocate.";
+
+class RandomGenerator {
+    // This class provides a deterministic linear congruential generator, so
+    // that test sequences are reproducible on every platform.
+
+    // DATA
+    unsigned d_state;
+
+  public:
+    // CREATORS
+    explicit RandomGenerator(unsigned seed = 1) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int modulus)
+        // Return the next pseudo-random number in the range
+        // '[0 .. modulus - 1]'.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return static_cast<int>((d_state >> 8) % modulus);
+    }
+};
+
+bool isEqual(const Obj& object, const Model& model)
+    // Return 'true' if the specified 'object' holds the same sequence of
+    // elements as the specified 'model', and 'false' otherwise.
+{
+    if (object.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+
+    Model::const_iterator mit = model.begin();
+    for (Obj::const_iterator it = object.begin(); it != object.end(); ++it) {
+        if (it->first != mit->first || it->second != mit->second) {
+            return false;                                             // RETURN
+        }
+        ++mit;
+    }
+    return true;
+}
+
+bool isOddValue(const Value& value)
+    // Return 'true' if the mapped value of the specified 'value' is odd, and
+    // 'false' otherwise.
+{
+    return value.second % 2;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Log Records by Severity
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we collect a batch of log records, and want to examine them grouped
+// by severity, preserving the order in which records of the same severity
+// arrived.
+//
+// First, we define the index type:
+//..
+    enum Severity { e_ERROR = 1, e_WARN = 2, e_INFO = 3 };
+
+    typedef bsl::flat_multimap<int, const char *> LogIndex;
+//..
+// Then, we bulk-load the records of a batch, which arrive in no particular
+// order of severity:
+//..
+    typedef LogIndex::value_type Record;
+
+    const Record batch[] = {
+        Record(e_INFO,  "connected"),
+        Record(e_ERROR, "disk full"),
+        Record(e_WARN,  "slow response"),
+        Record(e_ERROR, "write failed"),
+        Record(e_INFO,  "disconnected"),
+    };
+    const int NUM_RECORDS = sizeof batch / sizeof *batch;
+
+    LogIndex index(batch, batch + NUM_RECORDS);
+    ASSERT(5 == index.size());
+//..
+// Next, we count the errors:
+//..
+    ASSERT(2 == index.count(e_ERROR));
+//..
+// Finally, we visit the errors, and observe that they are presented in the
+// order in which they arrived:
+//..
+    bsl::pair<LogIndex::const_iterator, LogIndex::const_iterator> errors =
+                                                   index.equal_range(e_ERROR);
+
+    LogIndex::const_iterator it = errors.first;
+    ASSERT(0 == strcmp("disk full",    it->second));
+    ++it;
+    ASSERT(0 == strcmp("write failed", it->second));
+    ++it;
+    ASSERT(errors.second == it);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment produce an object
+        //:   having the value of the source, using the expected allocator.
+        //:
+        //: 2 'swap' exchanges values.
+        //:
+        //: 3 The equality and relational operators compare values, including
+        //:   the order of elements having equivalent keys.
+        //
+        // Plan:
+        //: 1 Exercise each operation on objects holding allocating
+        //:   'bsl::string' values, verifying values and allocators.
+        //:   (C-1..2)
+        //:
+        //: 2 Compare objects built from a table of specifications against
+        //:   each other, and verify that the results agree with those of the
+        //:   model.  (C-3)
+        //
+        // Testing:
+        //   flat_multimap(const flat_multimap& original);
+        //   flat_multimap(MovableRef<flat_multimap> original);
+        //   flat_multimap(const flat_multimap& original, const A& allocator);
+        //   flat_multimap& operator=(const flat_multimap& rhs);
+        //   flat_multimap& operator=(MovableRef<flat_multimap> rhs);
+        //   void swap(flat_multimap& other);
+        //   bool operator==(const flat_multimap&, const flat_multimap&);
+        //   bool operator<(const flat_multimap&, const flat_multimap&);
+        //   void swap(flat_multimap&, flat_multimap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        typedef bsl::flat_multimap<int, bsl::string> SObj;
+        typedef SObj::value_type                     SValue;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const bsl::string S(LONG_STRING, &oa);
+
+        SObj mW(&oa);  const SObj& W = mW;
+        for (int i = 0; i < 10; ++i) {
+            mW.insert(SValue(i % 3, S, &oa));
+        }
+        {
+            const SObj X(W);
+            ASSERT(W == X);
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+
+            const SObj Y(W, &za);
+            ASSERT(W == Y);
+            ASSERT(&za == Y.begin()->second.get_allocator());
+        }
+        {
+            SObj mX(W, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const SObj Y(MoveUtil::move(mX));
+            ASSERT(W == Y);
+            ASSERT(oam.isTotalSame());
+        }
+        {
+            SObj mX(&za);  const SObj& X = mX;
+            mX = W;
+            ASSERT(W == X);
+
+            SObj mY(&za);  const SObj& Y = mY;
+            mY = MoveUtil::move(mX);
+            ASSERT(W == Y);
+
+            SObj mZ(&za);  const SObj& Z = mZ;
+            mZ.swap(mY);
+            ASSERT(W == Z);
+            ASSERT(Y.empty());
+
+            bsl::swap(mY, mZ);
+            ASSERT(W == Y);
+            ASSERT(Z.empty());
+        }
+
+        if (verbose) printf("\tComparison.\n");
+
+        static const char *SPECS[] = {
+            "", "A", "AA", "B", "AB", "BA", "ABB", "AAB", "BBA", "ABCD",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            Obj mX;  const Obj& X = mX;  Model mMX;
+            for (const char *p = SPECS[ti]; *p; ++p) {
+                mX.insert(Value(*p, static_cast<int>(p - SPECS[ti])));
+                mMX.insert(Value(*p, static_cast<int>(p - SPECS[ti])));
+            }
+            for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                Obj mY;  const Obj& Y = mY;  Model mMY;
+                for (const char *p = SPECS[tj]; *p; ++p) {
+                    mY.insert(Value(*p, static_cast<int>(p - SPECS[tj])));
+                    mMY.insert(Value(*p, static_cast<int>(p - SPECS[tj])));
+                }
+                ASSERTV(ti, tj, (mMX == mMY) == (X == Y));
+                ASSERTV(ti, tj, (mMX != mMY) == (X != Y));
+                ASSERTV(ti, tj, (mMX <  mMY) == (X <  Y));
+                ASSERTV(ti, tj, (mMX >  mMY) == (X >  Y));
+                ASSERTV(ti, tj, (mMX <= mMY) == (X <= Y));
+                ASSERTV(ti, tj, (mMX >= mMY) == (X >= Y));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP, ERASURE, 'extract', AND 'replace'
+        //
+        // Concerns:
+        //: 1 'find' returns the first of the elements having the key, and
+        //:   'count', 'contains', and the bounds account for every element
+        //:   having the key.
+        //:
+        //: 2 'erase(key)' removes every element having the key and returns
+        //:   their number; the other 'erase' overloads behave as for a
+        //:   sequence.
+        //:
+        //: 3 'erase_if' removes exactly the elements satisfying the predicate,
+        //:   preserving the order of the others.
+        //:
+        //: 4 'extract' and 'replace' transfer the underlying sequence, and
+        //:   'replace' rejects an unsorted sequence in safe builds.
+        //
+        // Plan:
+        //: 1 Build an object and the model from pseudo-random keys having many
+        //:   duplicates, and compare lookups for every key in range.  (C-1)
+        //:
+        //: 2 Apply a pseudo-random sequence of erasures to both, comparing
+        //:   after each step.  (C-2)
+        //:
+        //: 3 Apply 'erase_if' and verify the result.  (C-3)
+        //:
+        //: 4 Extract and replace the sequence, and use 'bsls_asserttest' to
+        //:   verify that 'replace' fails on unsorted input.  (C-4)
+        //
+        // Testing:
+        //   iterator find(const key_type& key);
+        //   size_type count(const key_type& key) const;
+        //   bool contains(const key_type& key) const;
+        //   iterator lower_bound(const key_type& key);
+        //   iterator upper_bound(const key_type& key);
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   size_type erase_if(flat_multimap&, PREDICATE);
+        //   CONTAINER extract();
+        //   void replace(MovableRef<CONTAINER> container);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP, ERASURE, 'extract', AND 'replace'"
+                            "\n=========================================\n");
+
+        RandomGenerator random;
+
+        Obj   mX;  const Obj& X = mX;
+        Model mM;
+        for (int i = 0; i < 300; ++i) {
+            const Value V(random(40), i);
+            mX.insert(V);
+            mM.insert(V);
+        }
+        ASSERT(isEqual(X, mM));
+
+        for (int key = -1; key <= 41; ++key) {
+            const int LB = static_cast<int>(
+                            bsl::distance(mM.begin(), mM.lower_bound(key)));
+            const int UB = static_cast<int>(
+                            bsl::distance(mM.begin(), mM.upper_bound(key)));
+
+            ASSERTV(key, LB == X.lower_bound(key) - X.begin());
+            ASSERTV(key, UB == X.upper_bound(key) - X.begin());
+            ASSERTV(key, LB == mX.equal_range(key).first - X.begin());
+            ASSERTV(key, UB == X.equal_range(key).second - X.begin());
+            ASSERTV(key, mM.count(key) == X.count(key));
+            ASSERTV(key, (0 != mM.count(key)) == X.contains(key));
+            if (mM.count(key)) {
+                ASSERTV(key, mM.find(key)->second == X.find(key)->second);
+                ASSERTV(key, X.lower_bound(key) == mX.find(key));
+            }
+            else {
+                ASSERTV(key, X.end() == X.find(key));
+            }
+        }
+
+        while (!mM.empty()) {
+            const int op  = random(3);
+            const int pos = random(static_cast<int>(mM.size()));
+
+            Model::iterator mit = mM.begin();
+            bsl::advance(mit, pos);
+
+            switch (op) {
+              case 0: {
+                Obj::iterator it = mX.erase(X.begin() + pos);
+                mM.erase(mit);
+                ASSERTV(pos, pos == it - mX.begin());
+              } break;
+              case 1: {
+                const int key = mit->first;
+                ASSERTV(key, mM.count(key) == mX.erase(key));
+                ASSERTV(key, 0 == mX.erase(key));
+                mM.erase(key);
+              } break;
+              case 2: {
+                const int len = random(5);
+                Model::iterator mlast = mit;
+                int             n     = 0;
+                while (n < len && mlast != mM.end()) {
+                    ++mlast;
+                    ++n;
+                }
+                mX.erase(X.begin() + pos, X.begin() + pos + n);
+                mM.erase(mit, mlast);
+              } break;
+            }
+            ASSERTV(op, pos, isEqual(X, mM));
+        }
+
+        if (verbose) printf("\t'erase_if'.\n");
+
+        for (int i = 0; i < 20; ++i) {
+            mX.insert(Value(i % 4, i));
+        }
+        ASSERT(10 == bsl::erase_if(mX, isOddValue));
+        ASSERT(10 == X.size());
+        ASSERT(0 == X.begin()->second);
+        ASSERT(4 == (X.begin() + 1)->second);
+
+        if (verbose) printf("\t'extract' and 'replace'.\n");
+
+        Obj::container_type sequence = mX.extract();
+        ASSERT(X.empty());
+        ASSERT(10 == sequence.size());
+
+        mX.replace(MoveUtil::move(sequence));
+        ASSERT(10 == X.size());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj::container_type duplicated;
+            duplicated.push_back(Value(1, 1));
+            duplicated.push_back(Value(1, 2));
+            Obj::container_type unsorted;
+            unsorted.push_back(Value(2, 2));
+            unsorted.push_back(Value(1, 1));
+
+            ASSERT_SAFE_PASS(mX.replace(MoveUtil::move(duplicated)));
+            ASSERT_SAFE_FAIL(mX.replace(MoveUtil::move(unsorted)));
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANGE CONSTRUCTION AND INSERTION
+        //
+        // Concerns:
+        //: 1 Construction from, and insertion of, an unsorted range produce
+        //:   the same value as inserting each element in turn into the model;
+        //:   in particular, all elements are retained, and elements having
+        //:   equivalent keys keep their relative order, following any that
+        //:   were already present.
+        //:
+        //: 2 The 'sorted_equivalent' overloads accept sorted input having
+        //:   equivalent keys, and reject unsorted input in safe builds.
+        //:
+        //: 3 The supplied allocator and comparator are used.
+        //
+        // Plan:
+        //: 1 For pseudo-random input ranges of various lengths, construct an
+        //:   object from the range, insert the range into a non-empty object,
+        //:   and compare both with the model.  (C-1)
+        //:
+        //: 2 Exercise the 'sorted_equivalent' overloads with sorted input,
+        //:   and use 'bsls_asserttest' to verify that they fail on unsorted
+        //:   input.  (C-2)
+        //:
+        //: 3 Construct objects with an allocator and a comparator and verify
+        //:   their state.  (C-3)
+        //
+        // Testing:
+        //   flat_multimap(const CONTAINER& c, const C& comp, const A& a);
+        //   flat_multimap(MovableRef<CONTAINER> c, const C& comp = C());
+        //   flat_multimap(sorted_equivalent_t, const CONTAINER& c, ...);
+        //   flat_multimap(ITER first, ITER last, const C& comp, const A& a);
+        //   flat_multimap(sorted_equivalent_t, ITER first, ITER last, ...);
+        //   flat_multimap(initializer_list<value_type>, const C&, const A&);
+        //   flat_multimap(sorted_equivalent_t, initializer_list<V>, ...);
+        //   void insert(ITER first, ITER last);
+        //   void insert(sorted_equivalent_t, ITER first, ITER last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE CONSTRUCTION AND INSERTION"
+                            "\n================================\n");
+
+        RandomGenerator random;
+
+        for (int n = 0; n <= 64; ++n) {
+            bsl::vector<Value> input;
+            for (int i = 0; i < n; ++i) {
+                input.push_back(Value(random(n / 2 + 1), i));
+            }
+
+            Model mM(input.begin(), input.end());
+
+            const Obj X(input.begin(), input.end());
+            ASSERTV(n, isEqual(X, mM));
+
+            const Obj Z(input);
+            ASSERTV(n, isEqual(Z, mM));
+
+            Obj mY;  const Obj& Y = mY;
+            Model mMY;
+            for (int i = 0; i < n; i += 3) {
+                mY.insert(Value(i / 2, -i));
+                mMY.insert(Value(i / 2, -i));
+            }
+            mY.insert(input.begin(), input.end());
+            mMY.insert(input.begin(), input.end());
+            ASSERTV(n, isEqual(Y, mMY));
+
+            bsl::vector<Value> sorted(mM.begin(), mM.end());
+            const Obj S(bsl::sorted_equivalent, sorted.begin(), sorted.end());
+            ASSERTV(n, isEqual(S, mM));
+
+            const Obj T(bsl::sorted_equivalent, sorted);
+            ASSERTV(n, S == T);
+
+            mY.insert(bsl::sorted_equivalent, sorted.begin(), sorted.end());
+            mMY.insert(sorted.begin(), sorted.end());
+            ASSERTV(n, isEqual(Y, mMY));
+
+            Obj::container_type moved(input.begin(), input.end());
+            const Obj M(MoveUtil::move(moved));
+            ASSERTV(n, isEqual(M, mM));
+        }
+
+        if (verbose) printf("\tAllocator and comparator.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            typedef bsl::flat_multimap<int, int, std::greater<int> > GObj;
+
+            const Value INPUT[] = { Value(1, 0), Value(3, 1), Value(1, 2) };
+
+            const GObj X(INPUT, INPUT + 3, std::greater<int>(), &oa);
+            ASSERT(3 == X.begin()->first);
+            ASSERT(0 == (X.begin() + 1)->second);
+            ASSERT(2 == (X.begin() + 2)->second);
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            const Obj Y(Obj::container_type(INPUT, INPUT + 3),
+                        std::less<int>(),
+                        &oa);
+            ASSERT(1 == Y.begin()->first);
+            ASSERT(&oa == Y.get_allocator().mechanism());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) printf("\tInitializer lists.\n");
+        {
+            const Obj X({ {3, 0}, {1, 1}, {3, 2}, {2, 3} });
+            ASSERT(4 == X.size());
+            ASSERT(2 == X.count(3));
+            ASSERT(0 == X.find(3)->second);
+
+            const Obj Y(bsl::sorted_equivalent,
+                        { {1, 1}, {2, 3}, {3, 0}, {3, 2} });
+            ASSERT(X == Y);
+
+            Obj mZ;  const Obj& Z = mZ;
+            mZ = { {1, 1}, {1, 1} };
+            ASSERT(2 == Z.size());
+            mZ.insert({ {0, 0}, {1, 2} });
+            ASSERT(4 == Z.size());
+            ASSERT(2 == (Z.end() - 1)->second);
+            mZ.insert(bsl::sorted_equivalent, { {5, 5}, {5, 5} });
+            ASSERT(6 == Z.size());
+        }
+#endif
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Value SORTED[]   = { Value(1, 0), Value(1, 0) };
+            const Value UNSORTED[] = { Value(2, 0), Value(1, 0) };
+
+            Obj mX;
+
+            ASSERT_SAFE_PASS(Obj(bsl::sorted_equivalent, SORTED, SORTED + 2));
+            ASSERT_SAFE_FAIL(Obj(bsl::sorted_equivalent,
+                                 UNSORTED,
+                                 UNSORTED + 2));
+            ASSERT_SAFE_PASS(mX.insert(bsl::sorted_equivalent,
+                                       SORTED,
+                                       SORTED + 2));
+            ASSERT_SAFE_FAIL(mX.insert(bsl::sorted_equivalent,
+                                       UNSORTED,
+                                       UNSORTED + 2));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SINGLE-ELEMENT INSERTION
+        //
+        // Concerns:
+        //: 1 Each single-element insertion method always inserts, and returns
+        //:   an iterator to the inserted element.
+        //:
+        //: 2 Without a hint, or with an invalid hint, an element is inserted
+        //:   after any elements having an equivalent key.
+        //:
+        //: 3 With a valid hint, an element is inserted immediately before the
+        //:   hint.
+        //:
+        //: 4 Elements use the allocator of the object, and the default
+        //:   allocator is not used.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of insertions without hints, and
+        //:   with invalid hints, to an object and to the model, comparing the
+        //:   two after each step.  (C-1..2)
+        //:
+        //: 2 Insert with the hint 'lower_bound(key)', which is always valid,
+        //:   and verify that the new element precedes the existing elements
+        //:   having that key.  (C-3)
+        //:
+        //: 3 Insert allocating values into an object and verify the
+        //:   allocators used.  (C-4)
+        //
+        // Testing:
+        //   flat_multimap();
+        //   flat_multimap(const A& allocator);
+        //   iterator insert(const value_type& value);
+        //   iterator insert(MovableRef<value_type> value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   iterator insert(const_iterator hint, MovableRef<value_type> v);
+        //   iterator emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-ELEMENT INSERTION"
+                            "\n========================\n");
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        RandomGenerator random;
+
+        Obj   mX;  const Obj& X = mX;
+        Model mM;
+        ASSERT(X.empty());
+
+        for (int i = 0; i < 1000; ++i) {
+            const int key = random(50);
+            const int op  = random(4);
+
+            Obj::const_iterator BAD_HINT = X.upper_bound(key);
+            if (BAD_HINT != X.end()) {
+                ++BAD_HINT;
+            }
+            else if (BAD_HINT != X.begin() && X.lower_bound(key) == X.end()) {
+                BAD_HINT = X.begin();
+            }
+
+            Obj::iterator it = Obj::iterator();
+            switch (op) {
+              case 0: {
+                it = mX.insert(Value(key, i));
+              } break;
+              case 1: {
+                Value v(key, i);
+                it = mX.insert(MoveUtil::move(v));
+              } break;
+              case 2: {
+                it = mX.insert(BAD_HINT, Value(key, i));
+              } break;
+              case 3: {
+                Value v(key, i);
+                it = mX.insert(BAD_HINT, MoveUtil::move(v));
+              } break;
+            }
+            ASSERTV(i, key == it->first);
+            ASSERTV(i, i   == it->second);
+            mM.insert(Value(key, i));
+            ASSERTV(i, op, isEqual(X, mM));
+        }
+
+        if (verbose) printf("\tValid hints.\n");
+
+        for (int key = 0; key < 50; ++key) {
+            Obj::iterator it = mX.insert(X.lower_bound(key), Value(key, -1));
+            ASSERTV(key, X.lower_bound(key) == it);
+            ASSERTV(key, -1 == it->second);
+        }
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+        if (verbose) printf("\t'emplace' and 'emplace_hint'.\n");
+        {
+            Obj mY;  const Obj& Y = mY;
+            mY.emplace(1, 1);
+            mY.emplace(1, 2);
+            mY.emplace_hint(Y.begin(), 1, 0);
+            mY.emplace_hint(Y.end(), 0, 3);
+            ASSERT(4 == Y.size());
+            ASSERT(3 == Y.begin()->second);
+            ASSERT(0 == (Y.begin() + 1)->second);
+            ASSERT(2 == (Y.end() - 1)->second);
+        }
+#endif
+
+        if (verbose) printf("\tAllocator propagation.\n");
+        {
+            typedef bsl::flat_multimap<int, bsl::string> SObj;
+            typedef SObj::value_type                     SValue;
+
+            bslma::TestAllocator        oa("object", veryVeryVeryVerbose);
+            const bsl::string           S(LONG_STRING, &oa);
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            SObj mY(&oa);  const SObj& Y = mY;
+            mY.insert(SValue(1, S, &oa));
+            mY.insert(Y.begin(), SValue(1, S, &oa));
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+            mY.emplace(1, LONG_STRING);
+#endif
+            for (SObj::const_iterator it = Y.begin(); it != Y.end(); ++it) {
+                ASSERT(&oa == it->second.get_allocator());
+            }
+            ASSERT(dam.isTotalSame());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        mX.insert(Value(2, 20));
+        mX.insert(Value(1, 10));
+        mX.insert(Value(2, 21));
+        ASSERT(3 == X.size());
+        ASSERT(1 == X.begin()->first);
+        ASSERT(2 == X.count(2));
+        ASSERT(20 == X.find(2)->second);
+        ASSERT(21 == (X.end() - 1)->second);
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        ASSERT(2 == mY.erase(2));
+        ASSERT(1 == Y.size());
+        ASSERT(X != Y);
+        ASSERT(X > Y);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
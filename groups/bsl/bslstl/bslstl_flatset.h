@@ -0,0 +1,1588 @@
+// bslstl_flatset.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATSET
+#define INCLUDED_BSLSTL_FLATSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set with unique keys stored in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_set: set adaptor storing its keys in a sorted sequence
+//
+//@CANONICAL_HEADER: bsl_flat_set.h
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_set', implementing the C++23 standard container adaptor
+// 'std::flat_set'.  A 'flat_set' provides the interface of an ordered set of
+// unique keys (see 'bsl::set'), but stores its keys in a sequence container
+// (by default, a 'bsl::vector') kept sorted.
+//
+// See 'bslstl_flatmap' for a discussion of the performance characteristics
+// of the flat containers.  As with 'std::flat_set', both 'iterator' and
+// 'const_iterator' provide non-modifiable access to the keys, and the
+// 'bsl::sorted_unique' tag may be passed to the constructors and to 'insert'
+// to indicate that input is already sorted and free of duplicates.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_set''s 'CONTAINER' template parameter
+// determines how memory will be allocated.  With the default 'CONTAINER',
+// 'bsl::vector<KEY>', a 'flat_set' uses the 'bslma' allocator model: the
+// allocator supplied at construction (or the currently installed default
+// allocator, if none is supplied) is used to supply memory for the sequence
+// and for each of its elements that uses a 'bslma'-style allocator.
+//
+///Exception Safety
+///----------------
+// If an exception is thrown while a 'flat_set' is rearranging its elements
+// (e.g., while sorting or merging a range supplied to 'insert'), the
+// 'flat_set' is left empty so that its invariants are maintained.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recognizing Reserved Words
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a tokenizer for a small expression language, and
+// need to recognize the reserved words of the language.  The set of reserved
+// words is fixed at startup and consulted for every identifier scanned.
+//
+// First, we define the set type:
+//..
+//  typedef bsl::flat_set<bsl::string> ReservedWords;
+//..
+// Then, we load the reserved words, which are supplied in no particular
+// order:
+//..
+//  const char *WORDS[] = { "let", "if", "then", "else", "in", "if" };
+//  const int   NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//
+//  ReservedWords reserved(WORDS, WORDS + NUM_WORDS);
+//  assert(5 == reserved.size());
+//..
+// Notice that the duplicated "if" was stored only once.
+//
+// Finally, we classify some tokens:
+//..
+//  assert( reserved.contains("then"));
+//  assert(!reserved.contains("thence"));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flatcontainerutil.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <algorithm>
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                               // ==============
+                               // class flat_set
+                               // ==============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class CONTAINER  = bsl::vector<KEY> >
+class flat_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys, stored in a sorted sequence
+    // container of the (template parameter) type 'CONTAINER'.  Keys are
+    // ordered by the (template parameter) type 'COMPARATOR'.  'CONTAINER'
+    // must provide random-access iterators.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see 'bsldoc_glossary'.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslmf::MovableRefUtil               MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil           Util;
+        // This 'typedef' is an alias for the utility implementing the search
+        // and merge algorithms on the underlying sequence.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil_IdentityKey
+                                                             KeyPolicy;
+        // This 'typedef' is an alias for the policy extracting the key from
+        // an element.
+
+    typedef BloombergLP::bslstl::FlatContainerUtil_ClearProctor<CONTAINER>
+                                                             ClearProctor;
+        // This 'typedef' is an alias for the proctor restoring the invariants
+        // of this set if an exception is thrown while its elements are being
+        // rearranged.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef typename CONTAINER::allocator_type         allocator_type;
+    typedef typename CONTAINER::reference              reference;
+    typedef typename CONTAINER::const_reference        const_reference;
+    typedef typename CONTAINER::size_type              size_type;
+    typedef typename CONTAINER::difference_type        difference_type;
+    typedef typename CONTAINER::const_iterator         iterator;
+    typedef typename CONTAINER::const_iterator         const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+    typedef CONTAINER                                  container_type;
+
+  private:
+    // DATA
+    container_type d_container;   // sorted sequence of unique keys
+    key_compare    d_comparator;  // key comparator
+
+    // PRIVATE ACCESSORS
+    const_iterator lowerBoundFromHint(const_iterator  hint,
+                                      const key_type& key) const;
+        // Return the specified 'hint' if it is the first position in this set
+        // whose key is not less than the specified 'key', and
+        // 'lower_bound(key)' otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(flat_set,
+                                   BloombergLP::bslalg::HasStlIterators);
+
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+        flat_set,
+        BloombergLP::bslma::UsesBslmaAllocator,
+        BloombergLP::bslma::UsesBslmaAllocator<container_type>::value);
+
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+        flat_set,
+        BloombergLP::bslmf::IsBitwiseMoveable,
+        BloombergLP::bslmf::IsBitwiseMoveable<container_type>::value &&
+            BloombergLP::bslmf::IsBitwiseMoveable<key_compare>::value);
+
+    // CREATORS
+    flat_set();
+    explicit flat_set(const COMPARATOR&     comparator,
+                      const allocator_type& basicAllocator = allocator_type());
+    explicit flat_set(const allocator_type& basicAllocator);
+        // Create an empty set.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of type 'allocator_type' is used.  Note
+        // that, with the default 'CONTAINER', a 'bslma::Allocator *' can be
+        // supplied for 'basicAllocator', and the currently installed default
+        // allocator is used if none is supplied.
+
+    flat_set(const flat_set& original);
+        // Create a set having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this set.  The allocator of the new set is obtained
+        // from the copy constructor of 'CONTAINER'; with the default
+        // 'CONTAINER', that is the currently installed default allocator.
+
+    flat_set(BloombergLP::bslmf::MovableRef<flat_set> original);
+        // Create a set having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new set.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this set.  The allocator associated with 'original' is
+        // propagated for use in the newly-created set.  'original' is left in
+        // a valid but unspecified state.
+
+    flat_set(const flat_set& original, const allocator_type& basicAllocator);
+        // Create a set having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.
+
+    flat_set(BloombergLP::bslmf::MovableRef<flat_set> original,
+             const allocator_type&                    basicAllocator);
+        // Create a set having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // set if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.
+
+    explicit flat_set(const container_type& container,
+                      const COMPARATOR&     comparator     = COMPARATOR(),
+                      const allocator_type& basicAllocator = allocator_type());
+    flat_set(const container_type& container,
+             const allocator_type& basicAllocator);
+        // Create a set holding the keys of the specified 'container', sorted,
+        // with all but the first of each group of equivalent keys removed.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.
+
+    explicit flat_set(
+                   BloombergLP::bslmf::MovableRef<container_type> container,
+                   const COMPARATOR&                              comparator =
+                                                                 COMPARATOR());
+        // Create a set holding the keys of the specified 'container' (on
+        // entry), sorted, with all but the first of each group of equivalent
+        // keys removed, by moving (in constant time) the contents of
+        // 'container' into the new set.  Optionally specify a 'comparator'
+        // used to order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  The allocator associated with
+        // 'container' is propagated for use in the newly-created set.
+        // 'container' is left in a valid but unspecified state.
+
+    flat_set(sorted_unique_t,
+             const container_type& container,
+             const COMPARATOR&     comparator     = COMPARATOR(),
+             const allocator_type& basicAllocator = allocator_type());
+        // Create a set holding the keys of the specified 'container'.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.  The behavior is undefined unless
+        // the keys of 'container' are sorted and unique.
+
+    flat_set(sorted_unique_t,
+             BloombergLP::bslmf::MovableRef<container_type> container,
+             const COMPARATOR&                              comparator =
+                                                                 COMPARATOR());
+        // Create a set holding the keys of the specified 'container' (on
+        // entry) by moving (in constant time) the contents of 'container'
+        // into the new set.  Optionally specify a 'comparator' used to order
+        // keys contained in this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  The allocator associated with 'container' is
+        // propagated for use in the newly-created set.  'container' is left in
+        // a valid but unspecified state.  The behavior is undefined unless the
+        // keys of 'container' are sorted and unique.
+
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR        first,
+             INPUT_ITERATOR        last,
+             const COMPARATOR&     comparator     = COMPARATOR(),
+             const allocator_type& basicAllocator = allocator_type());
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR        first,
+             INPUT_ITERATOR        last,
+             const allocator_type& basicAllocator);
+        // Create a set, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those keys having a
+        // value equivalent to that which appears earlier in the sequence.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // type 'allocator_type' is used.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR        first,
+             INPUT_ITERATOR        last,
+             const COMPARATOR&     comparator     = COMPARATOR(),
+             const allocator_type& basicAllocator = allocator_type());
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR        first,
+             INPUT_ITERATOR        last,
+             const allocator_type& basicAllocator);
+        // Create a set holding the keys in the sequence starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element, in linear time.  Optionally specify a
+        // 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of type 'allocator_type'
+        // is used.  The behavior is undefined unless 'first' and 'last' refer
+        // to a sequence of valid values where 'first' is at a position at or
+        // before 'last', and the sequence is sorted and free of equivalent
+        // keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_set(std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator     = COMPARATOR(),
+             const allocator_type&             basicAllocator =
+                                                             allocator_type());
+    flat_set(std::initializer_list<value_type> values,
+             const allocator_type&             basicAllocator);
+        // Create a set and insert each key in the specified 'values'
+        // initializer list, ignoring those keys having a value equivalent to
+        // that which appears earlier in the list.  Optionally specify a
+        // 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of type 'allocator_type'
+        // is used.
+
+    flat_set(sorted_unique_t,
+             std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator     = COMPARATOR(),
+             const allocator_type&             basicAllocator =
+                                                             allocator_type());
+        // Create a set holding the keys in the specified 'values' initializer
+        // list.  Optionally specify a 'comparator' used to order keys
+        // contained in this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of type 'allocator_type' is used.  The
+        // behavior is undefined unless 'values' is sorted and free of
+        // equivalent keys.
+#endif
+
+    //! ~flat_set() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_set& operator=(const flat_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    flat_set& operator=(BloombergLP::bslmf::MovableRef<flat_set> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The contents of 'rhs' are moved to this set using the
+        // move-assignment operator of 'CONTAINER'.  'rhs' is left in a valid
+        // but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_set& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // set and then inserting each key in the specified 'values'
+        // initializer list, ignoring those keys having a value equivalent to
+        // that which appears earlier in the list; return a reference
+        // providing modifiable access to this object.
+#endif
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this set.  Note that the set is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    pair<iterator, bool> insert(const value_type& value);
+    pair<iterator, bool> insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' (copied or moved, as appropriate) into
+        // this set if a key equivalent to 'value' does not already exist in
+        // this set; otherwise, if a key equivalent to 'value' already exists
+        // in this set, this method has no effect.  Return a pair whose 'first'
+        // member is an iterator referring to the (possibly newly inserted)
+        // key in this set that is equivalent to 'value', and whose 'second'
+        // member is 'true' if a new value was inserted, and 'false' if the
+        // value was already present.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' (copied or moved, as appropriate) into
+        // this set (in amortized constant search time, if the specified 'hint'
+        // is a valid immediate successor to 'value') if a key equivalent to
+        // 'value' does not already exist in this set.  Return an iterator
+        // referring to the (possibly newly inserted) key in this set that is
+        // equivalent to 'value'.  If 'hint' is not a valid immediate
+        // successor to 'value', this operation has 'O[log(N)]' search
+        // complexity, where 'N' is the size of this set.  The behavior is
+        // undefined unless 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set each key in the range starting at the
+        // specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, whose key is not equivalent to that of
+        // a key already in this set or appearing earlier in the range.  The
+        // keys are appended to the underlying sequence, stably sorted, and
+        // merged into place, so that this operation has
+        // 'O[M * log(M) + N]' complexity, where 'M' is the length of the
+        // range and 'N' is the size of this set.  If an exception is thrown
+        // while sorting or merging, this set is left empty.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator defined in the C++11 standard [24.2.3] providing
+        // access to values of a type convertible to 'value_type'.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set each key in the range starting at the
+        // specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, whose key is not equivalent to that of
+        // a key already in this set.  This operation has 'O[M + N]'
+        // complexity, where 'M' is the length of the range and 'N' is the
+        // size of this set.  If an exception is thrown while merging, this
+        // set is left empty.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last', and the sequence is sorted and free
+        // of equivalent keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this set each key in the specified 'values' initializer
+        // list whose key is not equivalent to that of a key already in this
+        // set or appearing earlier in the list.
+
+    void insert(sorted_unique_t, std::initializer_list<value_type> values);
+        // Insert into this set each key in the specified 'values' initializer
+        // list whose key is not equivalent to that of a key already in this
+        // set.  The behavior is undefined unless 'values' is sorted and free
+        // of equivalent keys.
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... Args>
+    pair<iterator, bool> emplace(Args&&... args);
+        // Insert into this set a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'args' to the corresponding
+        // constructor of 'value_type', if a key equivalent to the newly
+        // created object does not already exist in this set.  Return a pair
+        // whose 'first' member is an iterator referring to the (possibly
+        // newly inserted) key in this set that is equivalent to the newly
+        // created object, and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' if an equivalent key was already present.
+
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args);
+        // Insert into this set a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'args' to the corresponding
+        // constructor of 'value_type' (in amortized constant search time, if
+        // the specified 'hint' is a valid immediate successor to the object),
+        // if a key equivalent to the newly created object does not already
+        // exist in this set.  Return an iterator referring to the (possibly
+        // newly inserted) key in this set that is equivalent to the newly
+        // created object.  The behavior is undefined unless 'hint' is an
+        // iterator in the range '[begin() .. end()]' (both endpoints
+        // included).
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this set the key at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last in the sequence.  The behavior is undefined
+        // unless 'position' refers to a key in this set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the key equivalent to the specified 'key', if
+        // such a key exists, and return 1; otherwise, if there is no key
+        // equivalent to 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the keys starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return 'last'.  The behavior is undefined unless 'first' and
+        // 'last' either refer to elements in this set or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the ordered sequence provided by this container.
+
+    container_type extract();
+        // Move the underlying sequence out of this set, leaving this set
+        // empty, and return it.
+
+    void replace(BloombergLP::bslmf::MovableRef<container_type> container);
+        // Replace the underlying sequence of this set with the specified
+        // 'container' (on entry), using the move-assignment operator of
+        // 'CONTAINER'.  'container' is left in a valid but unspecified state.
+        // The behavior is undefined unless the keys of 'container' are sorted
+        // and unique.
+
+    void swap(flat_set& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object, using the 'swap' method of 'CONTAINER' to
+        // exchange the underlying sequences.
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first key
+        // in the ordered sequence of keys maintained by this set, or the
+        // 'end' iterator if this set is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of keys maintained by
+        // this set.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last key in the ordered sequence of keys maintained by this set, or
+        // 'rend' if this set is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of keys
+        // maintained by this set.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this set.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this set; if a comparator was supplied at construction, return its
+        // value; otherwise, return a default constructed 'key_compare'
+        // object.
+
+    value_compare value_comp() const;
+        // Return the functor used by this set to compare keys.  Note that,
+        // for a set, 'value_compare' and 'key_compare' are the same type.
+
+    const_iterator find(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the key in
+        // this set equivalent to the specified 'key', if such a key exists,
+        // and the past-the-end ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, *it) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the key in
+        // this set equivalent to the specified 'key', if such a key exists,
+        // and the past-the-end ('end') iterator otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, *it) ? it : end();
+    }
+
+    size_type count(const key_type& key) const
+        // Return the number of keys within this set that are equivalent to
+        // the specified 'key'.  Note that, since a set has unique keys, the
+        // returned value will be either 0 or 1.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of keys within this set that are equivalent to
+        // the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    bool contains(const key_type& key) const
+        // Return 'true' if this set contains a key equivalent to the
+        // specified 'key', and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this set contains a key equivalent to the
+        // specified 'key', and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return find(key) != end();
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set that is greater-than or
+        // equal-to the specified 'key', and the past-the-end iterator if this
+        // set does not contain a key greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set that is greater-than or
+        // equal-to the specified 'key', and the past-the-end iterator if this
+        // set does not contain a key greater-than or equal-to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::lowerBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set that is greater than the
+        // specified 'key', and the past-the-end iterator if this set does not
+        // contain a key greater-than 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set that is greater than the
+        // specified 'key', and the past-the-end iterator if this set does not
+        // contain a key greater-than 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return Util::upperBound<KeyPolicy>(d_container.begin(),
+                                           d_container.end(),
+                                           key,
+                                           d_comparator);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                    const key_type& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of keys in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence,
+        // and the second is positioned one past the end of the sequence.  If
+        // this set contains no key equivalent to 'key', then the two returned
+        // iterators will have the same value.  Note that since a set
+        // maintains unique keys, the range will contain at most one element.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator it = lower_bound(key);
+        const_iterator next = it;
+        if (it != end() && !d_comparator(key, *it)) {
+            ++next;
+        }
+        return pair<const_iterator, const_iterator>(it, next);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of keys in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence,
+        // and the second is positioned one past the end of the sequence.  If
+        // this set contains no key equivalent to 'key', then the two returned
+        // iterators will have the same value.  Note that a transparent
+        // comparator may consider several keys equivalent to 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator first = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                                      first,
+                                      Util::upperBound<KeyPolicy>(
+                                                            first,
+                                                            d_container.end(),
+                                                            key,
+                                                            d_comparator));
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class CONTAINER>
+bool operator==(const flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                const flat_set<KEY, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_set' objects have the same
+    // value if they have the same number of keys, and each key in the ordered
+    // sequence of keys of 'lhs' has the same value as the corresponding key
+    // in the ordered sequence of keys of 'rhs'.  This method requires that
+    // the (template parameter) type 'KEY' be 'equality-comparable'.
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+bool operator!=(const flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                const flat_set<KEY, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_set' objects do not have
+    // the same value if they do not have the same number of keys, or some key
+    // in the ordered sequence of keys of 'lhs' does not have the same value
+    // as the corresponding key in the ordered sequence of keys of 'rhs'.
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+bool operator<(const flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+               const flat_set<KEY, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of set 'lhs' is lexicographically less than that of set 'rhs'
+    // if 'true == *i < *j' for the first pair of corresponding iterator
+    // positions where '*i < *j' and '*j < *i' are not both 'false'.  If no
+    // such corresponding iterator position exists, the value of 'lhs' is
+    // lexicographically less than that of 'rhs' if 'lhs.size() < rhs.size()'.
+    // This method requires that 'operator<', inducing a total order, be
+    // defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+bool operator>(const flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+               const flat_set<KEY, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than that of the specified 'rhs' set, and
+    // 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+bool operator<=(const flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                const flat_set<KEY, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  Note that this operator returns
+    // '!(rhs < lhs)'.
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+bool operator>=(const flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                const flat_set<KEY, COMPARATOR, CONTAINER>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class CONTAINER, class PREDICATE>
+typename flat_set<KEY, COMPARATOR, CONTAINER>::size_type
+erase_if(flat_set<KEY, COMPARATOR, CONTAINER>& s, PREDICATE predicate);
+    // Erase all the elements in the specified set 's' that satisfy the
+    // specified predicate 'predicate'.  Return the number of elements erased.
+    // Note that, unlike repeated calls to 'erase', this operation has linear
+    // complexity.
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+void swap(flat_set<KEY, COMPARATOR, CONTAINER>& a,
+          flat_set<KEY, COMPARATOR, CONTAINER>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                               // --------------
+                               // class flat_set
+                               // --------------
+
+// PRIVATE ACCESSORS
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::lowerBoundFromHint(
+                                             const_iterator  hint,
+                                             const key_type& key) const
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    if ((hint == cbegin() || d_comparator(*(hint - 1), key))
+     && (hint == cend()   || !d_comparator(*hint, key))) {
+        return hint;                                                  // RETURN
+    }
+    return lower_bound(key);
+}
+
+// CREATORS
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set()
+: d_container()
+, d_comparator()
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         const COMPARATOR&     comparator,
+                                         const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                          const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(const flat_set& original)
+: d_container(original.d_container)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                             BloombergLP::bslmf::MovableRef<flat_set> original)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         const flat_set&       original,
+                                         const allocator_type& basicAllocator)
+: d_container(original.d_container, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                     BloombergLP::bslmf::MovableRef<flat_set> original,
+                     const allocator_type&                    basicAllocator)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container),
+              basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         const container_type& container,
+                                         const COMPARATOR&     comparator,
+                                         const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator(comparator)
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         const container_type& container,
+                                         const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator()
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                     BloombergLP::bslmf::MovableRef<container_type> container,
+                     const COMPARATOR&                              comparator)
+: d_container(MoveUtil::move(container))
+, d_comparator(comparator)
+{
+    Util::sortAndMerge<KeyPolicy>(&d_container, 0, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         sorted_unique_t,
+                                         const container_type& container,
+                                         const COMPARATOR&     comparator,
+                                         const allocator_type& basicAllocator)
+: d_container(container, basicAllocator)
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(d_container.begin(),
+                                                     d_container.end(),
+                                                     d_comparator));
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                     sorted_unique_t,
+                     BloombergLP::bslmf::MovableRef<container_type> container,
+                     const COMPARATOR&                              comparator)
+: d_container(MoveUtil::move(container))
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(d_container.begin(),
+                                                     d_container.end(),
+                                                     d_comparator));
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         INPUT_ITERATOR        first,
+                                         INPUT_ITERATOR        last,
+                                         const COMPARATOR&     comparator,
+                                         const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator(comparator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         INPUT_ITERATOR        first,
+                                         INPUT_ITERATOR        last,
+                                         const allocator_type& basicAllocator)
+: d_container(basicAllocator)
+, d_comparator()
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         sorted_unique_t,
+                                         INPUT_ITERATOR        first,
+                                         INPUT_ITERATOR        last,
+                                         const COMPARATOR&     comparator,
+                                         const allocator_type& basicAllocator)
+: d_container(first, last, basicAllocator)
+, d_comparator(comparator)
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(d_container.begin(),
+                                                     d_container.end(),
+                                                     d_comparator));
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                                         sorted_unique_t,
+                                         INPUT_ITERATOR        first,
+                                         INPUT_ITERATOR        last,
+                                         const allocator_type& basicAllocator)
+: d_container(first, last, basicAllocator)
+, d_comparator()
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(d_container.begin(),
+                                                     d_container.end(),
+                                                     d_comparator));
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                             std::initializer_list<value_type> values,
+                             const COMPARATOR&                 comparator,
+                             const allocator_type&             basicAllocator)
+: flat_set(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                             std::initializer_list<value_type> values,
+                             const allocator_type&             basicAllocator)
+: flat_set(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>::flat_set(
+                             sorted_unique_t,
+                             std::initializer_list<value_type> values,
+                             const COMPARATOR&                 comparator,
+                             const allocator_type&             basicAllocator)
+: flat_set(sorted_unique,
+           values.begin(),
+           values.end(),
+           comparator,
+           basicAllocator)
+{
+}
+#endif
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>&
+flat_set<KEY, COMPARATOR, CONTAINER>::operator=(const flat_set& rhs)
+{
+    d_container  = rhs.d_container;
+    d_comparator = rhs.d_comparator;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>&
+flat_set<KEY, COMPARATOR, CONTAINER>::operator=(
+                                  BloombergLP::bslmf::MovableRef<flat_set> rhs)
+{
+    flat_set& lvalue = rhs;
+
+    d_container  = MoveUtil::move(lvalue.d_container);
+    d_comparator = lvalue.d_comparator;
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+flat_set<KEY, COMPARATOR, CONTAINER>&
+flat_set<KEY, COMPARATOR, CONTAINER>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+void flat_set<KEY, COMPARATOR, CONTAINER>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_container.clear();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+pair<typename flat_set<KEY, COMPARATOR, CONTAINER>::iterator, bool>
+flat_set<KEY, COMPARATOR, CONTAINER>::insert(const value_type& value)
+{
+    const_iterator it = lower_bound(value);
+    if (it != end() && !d_comparator(value, *it)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(d_container.insert(it, value), true);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+pair<typename flat_set<KEY, COMPARATOR, CONTAINER>::iterator, bool>
+flat_set<KEY, COMPARATOR, CONTAINER>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    const_iterator it = lower_bound(lvalue);
+    if (it != end() && !d_comparator(lvalue, *it)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(d_container.insert(it,
+                                                   MoveUtil::move(lvalue)),
+                                true);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::insert(const_iterator    hint,
+                                             const value_type& value)
+{
+    const_iterator it = lowerBoundFromHint(hint, value);
+    if (it != end() && !d_comparator(value, *it)) {
+        return it;                                                    // RETURN
+    }
+    return d_container.insert(it, value);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    const_iterator it = lowerBoundFromHint(hint, lvalue);
+    if (it != end() && !d_comparator(lvalue, *it)) {
+        return it;                                                    // RETURN
+    }
+    return d_container.insert(it, MoveUtil::move(lvalue));
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+void flat_set<KEY, COMPARATOR, CONTAINER>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    const size_type position = d_container.size();
+
+    d_container.insert(d_container.end(), first, last);
+
+    ClearProctor proctor(&d_container);
+
+    Util::sortAndMerge<KeyPolicy>(&d_container, position, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+
+    proctor.release();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+template <class INPUT_ITERATOR>
+void flat_set<KEY, COMPARATOR, CONTAINER>::insert(sorted_unique_t,
+                                                  INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    const size_type position = d_container.size();
+
+    d_container.insert(d_container.end(), first, last);
+
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(
+                                             d_container.begin() + position,
+                                             d_container.end(),
+                                             d_comparator));
+
+    ClearProctor proctor(&d_container);
+
+    Util::merge<KeyPolicy>(&d_container, position, d_comparator);
+    Util::eraseDuplicates<KeyPolicy>(&d_container, d_comparator);
+
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+void flat_set<KEY, COMPARATOR, CONTAINER>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+void flat_set<KEY, COMPARATOR, CONTAINER>::insert(
+                                      sorted_unique_t,
+                                      std::initializer_list<value_type> values)
+{
+    insert(sorted_unique, values.begin(), values.end());
+}
+#endif
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class KEY, class COMPARATOR, class CONTAINER>
+template <class... Args>
+pair<typename flat_set<KEY, COMPARATOR, CONTAINER>::iterator, bool>
+flat_set<KEY, COMPARATOR, CONTAINER>::emplace(Args&&... args)
+{
+    BloombergLP::bsls::ObjectBuffer<value_type> temp;
+
+    allocator_type alloc = get_allocator();
+
+    bsl::allocator_traits<allocator_type>::construct(
+                                 alloc,
+                                 temp.address(),
+                                 BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+    BloombergLP::bslma::DestructorGuard<value_type> guard(temp.address());
+
+    return insert(MoveUtil::move(temp.object()));
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+template <class... Args>
+typename flat_set<KEY, COMPARATOR, CONTAINER>::iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::emplace_hint(const_iterator hint,
+                                                   Args&&...      args)
+{
+    BloombergLP::bsls::ObjectBuffer<value_type> temp;
+
+    allocator_type alloc = get_allocator();
+
+    bsl::allocator_traits<allocator_type>::construct(
+                                 alloc,
+                                 temp.address(),
+                                 BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+
+    BloombergLP::bslma::DestructorGuard<value_type> guard(temp.address());
+
+    return insert(hint, MoveUtil::move(temp.object()));
+}
+#endif
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_container.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::size_type
+flat_set<KEY, COMPARATOR, CONTAINER>::erase(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    d_container.erase(it);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_container.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::container_type
+flat_set<KEY, COMPARATOR, CONTAINER>::extract()
+{
+    container_type result(MoveUtil::move(d_container));
+    d_container.clear();
+    return MoveUtil::move(result);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+void flat_set<KEY, COMPARATOR, CONTAINER>::replace(
+                      BloombergLP::bslmf::MovableRef<container_type> container)
+{
+    BSLS_ASSERT_SAFE(Util::isSortedUnique<KeyPolicy>(
+                                         MoveUtil::access(container).begin(),
+                                         MoveUtil::access(container).end(),
+                                         d_comparator));
+
+    d_container = MoveUtil::move(container);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+void flat_set<KEY, COMPARATOR, CONTAINER>::swap(flat_set& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    d_container.swap(other.d_container);
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::allocator_type
+flat_set<KEY, COMPARATOR, CONTAINER>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.get_allocator();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.begin();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.begin();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.end();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.end();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::crbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, CONTAINER>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+bool flat_set<KEY, COMPARATOR, CONTAINER>::empty() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.empty();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::size_type
+flat_set<KEY, COMPARATOR, CONTAINER>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.size();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::size_type
+flat_set<KEY, COMPARATOR, CONTAINER>::max_size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_container.max_size();
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::key_compare
+flat_set<KEY, COMPARATOR, CONTAINER>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+typename flat_set<KEY, COMPARATOR, CONTAINER>::value_compare
+flat_set<KEY, COMPARATOR, CONTAINER>::value_comp() const
+{
+    return d_comparator;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator==(const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator!=(const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator<(const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator>(const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator<=(const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+bool bsl::operator>=(const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, CONTAINER>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class CONTAINER, class PREDICATE>
+inline
+typename bsl::flat_set<KEY, COMPARATOR, CONTAINER>::size_type
+bsl::erase_if(flat_set<KEY, COMPARATOR, CONTAINER>& s, PREDICATE predicate)
+{
+    typedef flat_set<KEY, COMPARATOR, CONTAINER> SetType;
+
+    CONTAINER container = s.extract();
+
+    typename CONTAINER::iterator first = std::remove_if(container.begin(),
+                                                        container.end(),
+                                                        predicate);
+    typename SetType::size_type count = container.end() - first;
+    container.erase(first, container.end());
+    s.replace(BloombergLP::bslmf::MovableRefUtil::move(container));
+    return count;
+}
+
+template <class KEY, class COMPARATOR, class CONTAINER>
+inline
+void bsl::swap(bsl::flat_set<KEY, COMPARATOR, CONTAINER>& a,
+               bsl::flat_set<KEY, COMPARATOR, CONTAINER>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
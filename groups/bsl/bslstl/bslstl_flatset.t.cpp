@@ -0,0 +1,857 @@
+// bslstl_flatset.t.cpp                                               -*-C++-*-
+#include <bslstl_flatset.h>
+
+#include <bslstl_set.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The object under test is a container adaptor whose interface and contract
+// are dictated by the C++23 standard, with the differences documented in the
+// component header.  Since 'bsl::set' provides the same interface with the
+// same semantics, most test cases compare the state of a 'flat_set' with that
+// of a 'bsl::set' (the *model*) after applying the same sequence of operations
+// to both.  The algorithms shared with 'bsl::flat_map' are tested in
+// 'bslstl_flatcontainerutil', so this driver concentrates on the interface.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_set();
+// [ 2] flat_set(const A& allocator);
+// [ 5] flat_set(const flat_set& original);
+// [ 5] flat_set(MovableRef<flat_set> original);
+// [ 5] flat_set(const flat_set& original, const A& allocator);
+// [ 3] flat_set(const CONTAINER& c, const C& comp, const A& a);
+// [ 3] flat_set(MovableRef<CONTAINER> c, const C& comp = C());
+// [ 3] flat_set(sorted_unique_t, const CONTAINER& c, ...);
+// [ 3] flat_set(ITER first, ITER last, const C& comp, const A& a);
+// [ 3] flat_set(sorted_unique_t, ITER first, ITER last, ...);
+// [ 3] flat_set(initializer_list<value_type>, const C&, const A&);
+// [ 3] flat_set(sorted_unique_t, initializer_list<value_type>, ...);
+//
+// MANIPULATORS
+// [ 5] flat_set& operator=(const flat_set& rhs);
+// [ 5] flat_set& operator=(MovableRef<flat_set> rhs);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] pair<iterator, bool> insert(MovableRef<value_type> value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] iterator insert(const_iterator hint, MovableRef<value_type> value);
+// [ 3] void insert(ITER first, ITER last);
+// [ 3] void insert(sorted_unique_t, ITER first, ITER last);
+// [ 2] pair<iterator, bool> emplace(Args&&...);
+// [ 2] iterator emplace_hint(const_iterator, Args&&...);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] size_type erase(const key_type& key);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 4] CONTAINER extract();
+// [ 4] void replace(MovableRef<CONTAINER> container);
+// [ 5] void swap(flat_set& other);
+//
+// ACCESSORS
+// [ 4] const_iterator find(const key_type& key) const;
+// [ 4] size_type count(const key_type& key) const;
+// [ 4] bool contains(const key_type& key) const;
+// [ 4] const_iterator lower_bound(const key_type& key) const;
+// [ 4] const_iterator upper_bound(const key_type& key) const;
+// [ 4] pair<It, It> equal_range(const key_type& key) const;
+//
+// FREE FUNCTIONS
+// [ 5] bool operator==(const flat_set&, const flat_set&);
+// [ 5] bool operator<(const flat_set&, const flat_set&);
+// [ 4] size_type erase_if(flat_set&, PREDICATE);
+// [ 5] void swap(flat_set&, flat_set&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bslmf::MovableRefUtil MoveUtil;
+
+typedef bsl::flat_set<int>    Obj;
+typedef bsl::set<int>         Model;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+const char *const LONG_STRING = "This string is long enough to allocate.";
+
+class RandomGenerator {
+    // This class provides a deterministic linear congruential generator, so
+    // that test sequences are reproducible on every platform.
+
+    // DATA
+    unsigned d_state;
+
+  public:
+    // CREATORS
+    explicit RandomGenerator(unsigned seed = 1) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int modulus)
+        // Return the next pseudo-random number in the range
+        // '[0 .. modulus - 1]'.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return static_cast<int>((d_state >> 8) % modulus);
+    }
+};
+
+bool isEqual(const Obj& object, const Model& model)
+    // Return 'true' if the specified 'object' holds the same sequence of keys
+    // as the specified 'model', and 'false' otherwise.
+{
+    return object.size() == model.size()
+        && std::equal(object.begin(), object.end(), model.begin());
+}
+
+bool isOdd(int value)
+    // Return 'true' if the specified 'value' is odd, and 'false' otherwise.
+{
+    return value % 2;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recognizing Reserved Words
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a tokenizer for a small expression language, and
+// need to recognize the reserved words of the language.  The set of reserved
+// words is fixed at startup and consulted for every identifier scanned.
+//
+// First, we define the set type:
+//..
+    typedef bsl::flat_set<bsl::string> ReservedWords;
+//..
+// Then, we load the reserved words, which are supplied in no particular
+// order:
+//..
+    const char *WORDS[] = { "let", "if", "then", "else", "in", "if" };
+    const int   NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+    ReservedWords reserved(WORDS, WORDS + NUM_WORDS);
+    ASSERT(5 == reserved.size());
+//..
+// Notice that the duplicated "if" was stored only once.
+//
+// Finally, we classify some tokens:
+//..
+    ASSERT( reserved.contains("then"));
+    ASSERT(!reserved.contains("thence"));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment produce an object
+        //:   having the value of the source, using the expected allocator.
+        //:
+        //: 2 'swap' exchanges values.
+        //:
+        //: 3 The equality and relational operators compare values
+        //:   lexicographically.
+        //
+        // Plan:
+        //: 1 Exercise each operation on objects holding allocating
+        //:   'bsl::string' keys, verifying values and allocators.  (C-1..2)
+        //:
+        //: 2 Compare objects built from a table of specifications against
+        //:   each other, and verify that the results agree with those of the
+        //:   model.  (C-3)
+        //
+        // Testing:
+        //   flat_set(const flat_set& original);
+        //   flat_set(MovableRef<flat_set> original);
+        //   flat_set(const flat_set& original, const A& allocator);
+        //   flat_set& operator=(const flat_set& rhs);
+        //   flat_set& operator=(MovableRef<flat_set> rhs);
+        //   void swap(flat_set& other);
+        //   bool operator==(const flat_set&, const flat_set&);
+        //   bool operator<(const flat_set&, const flat_set&);
+        //   void swap(flat_set&, flat_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        typedef bsl::flat_set<bsl::string> SObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        SObj mW(&oa);  const SObj& W = mW;
+        for (char c = 'a'; c <= 'j'; ++c) {
+            bsl::string s(LONG_STRING, &oa);
+            s.push_back(c);
+            mW.insert(s);
+        }
+        {
+            const SObj X(W);
+            ASSERT(W == X);
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+
+            const SObj Y(W, &za);
+            ASSERT(W == Y);
+            ASSERT(&za == Y.begin()->get_allocator());
+        }
+        {
+            SObj mX(W, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const SObj Y(MoveUtil::move(mX));
+            ASSERT(W == Y);
+            ASSERT(oam.isTotalSame());
+        }
+        {
+            SObj mX(&za);  const SObj& X = mX;
+            mX = W;
+            ASSERT(W == X);
+
+            SObj mY(&za);  const SObj& Y = mY;
+            mY = MoveUtil::move(mX);
+            ASSERT(W == Y);
+
+            SObj mZ(&za);  const SObj& Z = mZ;
+            mZ.swap(mY);
+            ASSERT(W == Z);
+            ASSERT(Y.empty());
+
+            bsl::swap(mY, mZ);
+            ASSERT(W == Y);
+            ASSERT(Z.empty());
+        }
+
+        if (verbose) printf("\tComparison.\n");
+
+        static const char *SPECS[] = {
+            "", "A", "B", "AB", "AC", "BC", "ABC", "ABD", "ACD", "ABCD",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            Obj mX;  const Obj& X = mX;  Model mMX;
+            for (const char *p = SPECS[ti]; *p; ++p) {
+                mX.insert(*p);
+                mMX.insert(*p);
+            }
+            for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                Obj mY;  const Obj& Y = mY;  Model mMY;
+                for (const char *p = SPECS[tj]; *p; ++p) {
+                    mY.insert(*p);
+                    mMY.insert(*p);
+                }
+                ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                ASSERTV(ti, tj, (mMX <  mMY) == (X <  Y));
+                ASSERTV(ti, tj, (mMX >  mMY) == (X >  Y));
+                ASSERTV(ti, tj, (mMX <= mMY) == (X <= Y));
+                ASSERTV(ti, tj, (mMX >= mMY) == (X >= Y));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP, ERASURE, 'extract', AND 'replace'
+        //
+        // Concerns:
+        //: 1 The lookup accessors agree with those of the model for keys that
+        //:   are present, absent, and beyond either end of the set.
+        //:
+        //: 2 Each 'erase' overload removes the designated keys and returns the
+        //:   documented value.
+        //:
+        //: 3 'erase_if' removes exactly the keys satisfying the predicate.
+        //:
+        //: 4 'extract' and 'replace' transfer the underlying sequence, and
+        //:   'replace' rejects a sequence that is unsorted or holds duplicates
+        //:   in safe builds.
+        //
+        // Plan:
+        //: 1 Build an object and the model from pseudo-random keys, and
+        //:   compare lookups for every key in range.  (C-1)
+        //:
+        //: 2 Apply a pseudo-random sequence of erasures to both, comparing
+        //:   after each step.  (C-2)
+        //:
+        //: 3 Apply 'erase_if' and verify the result.  (C-3)
+        //:
+        //: 4 Extract and replace the sequence, and use 'bsls_asserttest' to
+        //:   verify that 'replace' fails on invalid input.  (C-4)
+        //
+        // Testing:
+        //   const_iterator find(const key_type& key) const;
+        //   size_type count(const key_type& key) const;
+        //   bool contains(const key_type& key) const;
+        //   const_iterator lower_bound(const key_type& key) const;
+        //   const_iterator upper_bound(const key_type& key) const;
+        //   pair<It, It> equal_range(const key_type& key) const;
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   size_type erase_if(flat_set&, PREDICATE);
+        //   CONTAINER extract();
+        //   void replace(MovableRef<CONTAINER> container);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP, ERASURE, 'extract', AND 'replace'"
+                            "\n=========================================\n");
+
+        RandomGenerator random;
+
+        Obj   mX;  const Obj& X = mX;
+        Model mM;
+        for (int i = 0; i < 200; ++i) {
+            const int key = random(300);
+            mX.insert(key);
+            mM.insert(key);
+        }
+        ASSERT(isEqual(X, mM));
+
+        for (int key = -1; key <= 301; ++key) {
+            const int LB = static_cast<int>(
+                            bsl::distance(mM.begin(), mM.lower_bound(key)));
+            const int UB = static_cast<int>(
+                            bsl::distance(mM.begin(), mM.upper_bound(key)));
+
+            ASSERTV(key, LB == X.lower_bound(key) - X.begin());
+            ASSERTV(key, UB == X.upper_bound(key) - X.begin());
+            ASSERTV(key, LB == X.equal_range(key).first - X.begin());
+            ASSERTV(key, UB == X.equal_range(key).second - X.begin());
+            ASSERTV(key, mM.count(key) == X.count(key));
+            ASSERTV(key, (0 != mM.count(key)) == X.contains(key));
+            ASSERTV(key, (0 != mM.count(key)) == (X.end() != X.find(key)));
+        }
+
+        while (!mM.empty()) {
+            const int op  = random(3);
+            const int pos = random(static_cast<int>(mM.size()));
+
+            Model::iterator mit = mM.begin();
+            bsl::advance(mit, pos);
+
+            switch (op) {
+              case 0: {
+                Obj::iterator it = mX.erase(X.begin() + pos);
+                mM.erase(mit);
+                ASSERTV(pos, pos == it - X.begin());
+              } break;
+              case 1: {
+                const int key = *mit;
+                ASSERTV(key, 1 == mX.erase(key));
+                ASSERTV(key, 0 == mX.erase(key));
+                mM.erase(key);
+              } break;
+              case 2: {
+                const int len = random(5);
+                Model::iterator mlast = mit;
+                int             n     = 0;
+                while (n < len && mlast != mM.end()) {
+                    ++mlast;
+                    ++n;
+                }
+                mX.erase(X.begin() + pos, X.begin() + pos + n);
+                mM.erase(mit, mlast);
+              } break;
+            }
+            ASSERTV(op, pos, isEqual(X, mM));
+        }
+
+        if (verbose) printf("\t'erase_if'.\n");
+
+        for (int i = 0; i < 20; ++i) {
+            mX.insert(i);
+        }
+        ASSERT(10 == bsl::erase_if(mX, isOdd));
+        ASSERT(10 == X.size());
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            ASSERTV(*it, !isOdd(*it));
+        }
+
+        if (verbose) printf("\t'extract' and 'replace'.\n");
+
+        Obj::container_type sequence = mX.extract();
+        ASSERT(X.empty());
+        ASSERT(10 == sequence.size());
+
+        mX.replace(MoveUtil::move(sequence));
+        ASSERT(10 == X.size());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj::container_type sorted;
+            sorted.push_back(1);
+            sorted.push_back(2);
+            Obj::container_type duplicated;
+            duplicated.push_back(1);
+            duplicated.push_back(1);
+            Obj::container_type unsorted;
+            unsorted.push_back(2);
+            unsorted.push_back(1);
+
+            ASSERT_SAFE_PASS(mX.replace(MoveUtil::move(sorted)));
+            ASSERT_SAFE_FAIL(mX.replace(MoveUtil::move(duplicated)));
+            ASSERT_SAFE_FAIL(mX.replace(MoveUtil::move(unsorted)));
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANGE CONSTRUCTION AND INSERTION
+        //
+        // Concerns:
+        //: 1 Construction from, and insertion of, an unsorted range holding
+        //:   duplicates produce the same value as the model.
+        //:
+        //: 2 The 'sorted_unique' overloads accept sorted unique input, and
+        //:   reject other input in safe builds.
+        //:
+        //: 3 The supplied allocator and comparator are used.
+        //
+        // Plan:
+        //: 1 For pseudo-random input ranges of various lengths, construct an
+        //:   object from the range, insert the range into a non-empty object,
+        //:   and compare both with the model.  (C-1)
+        //:
+        //: 2 Exercise the 'sorted_unique' overloads with sorted input, and use
+        //:   'bsls_asserttest' to verify that they fail on invalid input.
+        //:   (C-2)
+        //:
+        //: 3 Construct objects with an allocator and a comparator and verify
+        //:   their state.  (C-3)
+        //
+        // Testing:
+        //   flat_set(const CONTAINER& c, const C& comp, const A& a);
+        //   flat_set(MovableRef<CONTAINER> c, const C& comp = C());
+        //   flat_set(sorted_unique_t, const CONTAINER& c, ...);
+        //   flat_set(ITER first, ITER last, const C& comp, const A& a);
+        //   flat_set(sorted_unique_t, ITER first, ITER last, ...);
+        //   flat_set(initializer_list<value_type>, const C&, const A&);
+        //   flat_set(sorted_unique_t, initializer_list<value_type>, ...);
+        //   void insert(ITER first, ITER last);
+        //   void insert(sorted_unique_t, ITER first, ITER last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE CONSTRUCTION AND INSERTION"
+                            "\n================================\n");
+
+        RandomGenerator random;
+
+        for (int n = 0; n <= 64; ++n) {
+            bsl::vector<int> input;
+            for (int i = 0; i < n; ++i) {
+                input.push_back(random(n + 1));
+            }
+
+            Model mM(input.begin(), input.end());
+
+            const Obj X(input.begin(), input.end());
+            ASSERTV(n, isEqual(X, mM));
+
+            const Obj Z(input);
+            ASSERTV(n, isEqual(Z, mM));
+
+            Obj mY;  const Obj& Y = mY;
+            Model mMY;
+            for (int i = 0; i < n; i += 3) {
+                mY.insert(i);
+                mMY.insert(i);
+            }
+            mY.insert(input.begin(), input.end());
+            mMY.insert(input.begin(), input.end());
+            ASSERTV(n, isEqual(Y, mMY));
+
+            bsl::vector<int> sorted(mM.begin(), mM.end());
+            const Obj S(bsl::sorted_unique, sorted.begin(), sorted.end());
+            ASSERTV(n, isEqual(S, mM));
+
+            const Obj T(bsl::sorted_unique, sorted);
+            ASSERTV(n, S == T);
+
+            mY.insert(bsl::sorted_unique, sorted.begin(), sorted.end());
+            mMY.insert(sorted.begin(), sorted.end());
+            ASSERTV(n, isEqual(Y, mMY));
+
+            Obj::container_type moved(input.begin(), input.end());
+            const Obj M(MoveUtil::move(moved));
+            ASSERTV(n, isEqual(M, mM));
+        }
+
+        if (verbose) printf("\tAllocator and comparator.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            typedef bsl::flat_set<int, std::greater<int> > GObj;
+
+            const int INPUT[] = { 1, 3, 1, 2 };
+
+            const GObj X(INPUT, INPUT + 4, std::greater<int>(), &oa);
+            ASSERT(3 == X.size());
+            ASSERT(3 == *X.begin());
+            ASSERT(1 == *(X.end() - 1));
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            const Obj Y(Obj::container_type(INPUT, INPUT + 4),
+                        std::less<int>(),
+                        &oa);
+            ASSERT(3 == Y.size());
+            ASSERT(1 == *Y.begin());
+            ASSERT(&oa == Y.get_allocator().mechanism());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) printf("\tInitializer lists.\n");
+        {
+            const Obj X({ 3, 1, 3, 2 });
+            ASSERT(3 == X.size());
+
+            const Obj Y(bsl::sorted_unique, { 1, 2, 3 });
+            ASSERT(X == Y);
+
+            Obj mZ;  const Obj& Z = mZ;
+            mZ = { 5, 5 };
+            ASSERT(1 == Z.size());
+            mZ.insert({ 0, 5, 4 });
+            ASSERT(3 == Z.size());
+            mZ.insert(bsl::sorted_unique, { 6, 7 });
+            ASSERT(5 == Z.size());
+        }
+#endif
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const int SORTED[]     = { 1, 2 };
+            const int DUPLICATED[] = { 1, 1 };
+            const int UNSORTED[]   = { 2, 1 };
+
+            Obj mX;
+
+            ASSERT_SAFE_PASS(Obj(bsl::sorted_unique, SORTED, SORTED + 2));
+            ASSERT_SAFE_FAIL(Obj(bsl::sorted_unique,
+                                 DUPLICATED,
+                                 DUPLICATED + 2));
+            ASSERT_SAFE_FAIL(Obj(bsl::sorted_unique, UNSORTED, UNSORTED + 2));
+            ASSERT_SAFE_PASS(mX.insert(bsl::sorted_unique,
+                                       SORTED,
+                                       SORTED + 2));
+            ASSERT_SAFE_FAIL(mX.insert(bsl::sorted_unique,
+                                       UNSORTED,
+                                       UNSORTED + 2));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SINGLE-ELEMENT INSERTION
+        //
+        // Concerns:
+        //: 1 Each single-element insertion method inserts a key only if an
+        //:   equivalent key is not already present, and reports the position
+        //:   of the key.
+        //:
+        //: 2 A hint, valid or not, does not affect the resulting value.
+        //:
+        //: 3 Keys use the allocator of the object.
+        //:
+        //: 4 Iterators of a set provide only non-modifiable access.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of insertions, with no hint, a
+        //:   valid hint, and an arbitrary hint, to an object and to the model,
+        //:   comparing the two after each step.  (C-1..2)
+        //:
+        //: 2 Insert allocating keys into an object and verify the allocators
+        //:   used.  (C-3)
+        //:
+        //: 3 Verify that 'iterator' and 'const_iterator' are the same type.
+        //:   (C-4)
+        //
+        // Testing:
+        //   flat_set();
+        //   flat_set(const A& allocator);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   pair<iterator, bool> insert(MovableRef<value_type> value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   iterator insert(const_iterator hint, MovableRef<value_type> v);
+        //   pair<iterator, bool> emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-ELEMENT INSERTION"
+                            "\n========================\n");
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT((bsl::is_same<Obj::iterator,
+                                   Obj::const_iterator>::value));
+
+        RandomGenerator random;
+
+        Obj   mX;  const Obj& X = mX;
+        Model mM;
+        ASSERT(X.empty());
+
+        for (int i = 0; i < 1000; ++i) {
+            const int key = random(300);
+            const int op  = random(5);
+
+            const bool isNew = 0 == mM.count(key);
+
+            Obj::const_iterator it = Obj::const_iterator();
+            switch (op) {
+              case 0: {
+                bsl::pair<Obj::iterator, bool> r = mX.insert(key);
+                ASSERTV(i, isNew == r.second);
+                it = r.first;
+              } break;
+              case 1: {
+                int k = key;
+                bsl::pair<Obj::iterator, bool> r =
+                                               mX.insert(MoveUtil::move(k));
+                ASSERTV(i, isNew == r.second);
+                it = r.first;
+              } break;
+              case 2: {
+                it = mX.insert(X.lower_bound(key), key);
+              } break;
+              case 3: {
+                int k = key;
+                it = mX.insert(X.begin() + random(
+                                            static_cast<int>(X.size()) + 1),
+                               MoveUtil::move(k));
+              } break;
+              case 4: {
+                it = mX.insert(X.end(), key);
+              } break;
+            }
+            ASSERTV(i, key == *it);
+            mM.insert(key);
+            ASSERTV(i, op, isEqual(X, mM));
+        }
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+        if (verbose) printf("\t'emplace' and 'emplace_hint'.\n");
+        {
+            Obj mY;  const Obj& Y = mY;
+            ASSERT( mY.emplace(1).second);
+            ASSERT(!mY.emplace(1).second);
+            ASSERT(0 == *mY.emplace_hint(Y.end(), 0));
+            ASSERT(2 == Y.size());
+        }
+#endif
+
+        if (verbose) printf("\tAllocator propagation.\n");
+        {
+            typedef bsl::flat_set<bsl::string> SObj;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            const bsl::string    S(LONG_STRING, &oa);
+
+            SObj mY(&oa);  const SObj& Y = mY;
+            mY.insert(S);
+            mY.insert(Y.begin(), S + "x");
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+            mY.emplace(LONG_STRING, 5);
+#endif
+            for (SObj::const_iterator it = Y.begin(); it != Y.end(); ++it) {
+                ASSERT(&oa == it->get_allocator());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT( mX.insert(2).second);
+        ASSERT( mX.insert(1).second);
+        ASSERT(!mX.insert(2).second);
+        ASSERT(2 == X.size());
+        ASSERT(1 == *X.begin());
+        ASSERT(X.contains(2));
+        ASSERT(!X.contains(3));
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        ASSERT(1 == mY.erase(2));
+        ASSERT(1 == Y.size());
+        ASSERT(X != Y);
+        ASSERT(Y < X);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -61,6 +61,7 @@ template <class FUNCTOR>
 class HashTable_HashWrapper<FUNCTOR &>;
 
 struct HashTable_ImpDetails;
+struct HashTable_RehashState;
 struct HashTable_Util;
 
                        // ======================
@@ -383,6 +384,11 @@ class HashTable {
     typedef bslalg::BidirectionalNode<ValueType>   NodeType;
     typedef typename AllocatorTraits::size_type    SizeType;
 
+    enum {
+        k_FIND_BATCH_SIZE = 16  // maximum number of keys looked up by one
+                                // call to 'findBatch'
+    };
+
   private:
     // PRIVATE TYPES
     typedef
@@ -423,9 +429,37 @@ class HashTable {
                                          // rehash is required (computed from
                                          // 'd_maxLoadFactor')
     float               d_maxLoadFactor; // maximum permitted load factor
+    HashTable_RehashState
+                       *d_rehash_p;      // state of the incremental rehash of
+                                         // this table (owned), or 0 if
+                                         // incremental rehash is disabled
 
   private:
     // PRIVATE MANIPULATORS
+    void abandonRehash();
+        // Release the bucket arrays of the incremental rehash in progress, if
+        // any, without migrating any element, and end the rehash.  The
+        // behavior is undefined unless every element that has not yet been
+        // migrated is about to be destroyed or re-indexed into a new bucket
+        // array.
+
+    void advanceRehash(std::size_t hashCode);
+        // If an incremental rehash is in progress, clear or migrate the share
+        // of buckets due for one insertion (see {Incremental Rehash}),
+        // including, if elements are being migrated, the old bucket to which
+        // the specified 'hashCode' maps; otherwise, do nothing.  This method
+        // must be called (after any call to 'growForInsertion') before an
+        // element having 'hashCode' is inserted into the current bucket array.
+        // If the 'hasher' throws, this hash table is left in a valid but empty
+        // state.
+
+    void beginMigration();
+        // Make the (cleared) new bucket array of the incremental rehash in
+        // progress the current bucket array of this hash table, retaining the
+        // current one as the array from which elements are migrated.  The
+        // behavior is undefined unless every bucket of the new array has been
+        // cleared.
+
     void copyDataStructure(bslalg::BidirectionalLink *cursor);
         // Copy the sequence of elements from the list starting at the
         // specified 'cursor' and having 'size' elements.  Allocate a bucket
@@ -437,6 +471,32 @@ class HashTable {
         // for the 'size' and other attributes that may not be consistent with
         // the class invariants until after this method is called.
 
+    void copyIncrementalRehashStep(const HashTable& original);
+        // Enable incremental rehash for this hash table, with the same step as
+        // the specified 'original', if it is enabled for 'original'.  The
+        // behavior is undefined unless incremental rehash is disabled for this
+        // hash table.  Note that this method is called by the constructors
+        // that copy or move (with a different allocator) 'original', after
+        // the elements are copied, and that it destroys them if it throws.
+
+    void growForInsertion();
+        // Increase the capacity of this hash table so that at least one more
+        // element can be inserted without exceeding the 'maxLoadFactor'.  If
+        // incremental rehash is enabled and this hash table has a bucket array
+        // of its own, complete any rehash already in progress, then allocate
+        // the new (uninitialized) bucket array and begin an incremental rehash
+        // into it (see 'advanceRehash'); otherwise, re-index every element
+        // into a new bucket array immediately.
+
+    void migrateOldBucket(SizeType index);
+        // Move each element in the bucket at the specified 'index' in the
+        // bucket array from which elements are being migrated by an
+        // incremental rehash to the appropriate bucket of the current bucket
+        // array.  If the 'hasher' throws, this hash table is left in a valid
+        // but empty state.  The behavior is undefined unless an incremental
+        // rehash is migrating elements and 'index' is less than the number of
+        // buckets in the old bucket array.
+
     void moveDataStructure(bslalg::BidirectionalLink *cursor);
         // Recreate the sequence of elements from the list starting at the
         // specified 'cursor' and having (member) 'd_size' elements, ensuring
@@ -498,6 +558,14 @@ class HashTable {
         // the extra bookkeeping is not necessary.
 
     // PRIVATE ACCESSORS
+    const bslalg::HashTableAnchor& anchorForHashCode(
+                                                 std::size_t hashCode) const;
+        // Return a reference providing non-modifiable access to the anchor
+        // whose bucket array indexes the elements having the specified
+        // 'hashCode'.  Note that this is the anchor of the old bucket array
+        // only if an incremental rehash is in progress and the old bucket to
+        // which 'hashCode' maps has not yet been migrated.
+
     template <class DEDUCED_KEY>
     bslalg::BidirectionalLink *find(DEDUCED_KEY& key,
                                     std::size_t  hashValue) const;
@@ -1158,6 +1226,13 @@ class HashTable {
 // }}} END GENERATED CODE
 #endif
 
+    void completeRehash();
+        // Finish the incremental rehash in progress, if any, clearing the rest
+        // of the new bucket array and migrating to it every element not yet
+        // migrated, and release the old bucket array.  If the 'hasher' throws,
+        // this hash table is left in a valid but empty state.  Note that this
+        // method has no effect unless 'isRehashInProgress()'.
+
     bslalg::BidirectionalLink *insertIfMissing(const KeyType& key);
         // Insert into this hash-table a newly-created 'ValueType' object,
         // constructed by forwarding the specified 'key' and a
@@ -1316,7 +1391,9 @@ class HashTable {
         // references to the removed node and previously saved values of the
         // 'end()' iterator, and preserves the relative order of the nodes not
         // removed.  The behavior is undefined unless 'node' refers to a node
-        // in this hash-table.
+        // in this hash-table.  Note that this method never advances an
+        // incremental rehash in progress, as doing so could reorder the
+        // remaining nodes.
 
     void removeAll();
         // Remove all the elements from this hash-table.  Note that this
@@ -1337,6 +1414,18 @@ class HashTable {
         // hash-table in a valid, but otherwise unspecified (and potentially
         // empty), state.
 
+    void setIncrementalRehashStep(SizeType numBuckets);
+        // Enable incremental rehash for this hash table, clearing or migrating
+        // at least the specified 'numBuckets' buckets per insertion while a
+        // rehash is in progress, or, if 'numBuckets' is 0, disable incremental
+        // rehash, completing any rehash already in progress (see
+        // 'completeRehash').  When incremental rehash is enabled, an insertion
+        // that would exceed the 'maxLoadFactor' allocates the larger bucket
+        // array, but the elements are re-indexed into it a few buckets at a
+        // time by that and subsequent insertions, so that the rehash completes
+        // before this table grows again (see {Incremental Rehash}).  If the
+        // 'hasher' throws, this hash table is left in a valid but empty state.
+
     void setMaxLoadFactor(float newMaxLoadFactor);
         // Set the maximum load factor permitted by this hash table to the
         // specified 'newMaxLoadFactor', where load factor is the statistical
@@ -1584,11 +1673,14 @@ class HashTable {
         // Return a reference offering non-modifiable access to the
         // 'HashTableBucket' at the specified 'index' position in the array of
         // buckets of this table.  The behavior is undefined unless 'index <
-        // numBuckets()'.
+        // numBuckets()'.  Note that, while an incremental rehash is in
+        // progress, the buckets of this table may not yet index every element
+        // (see 'isRehashInProgress').
 
     SizeType bucketIndexForKey(const KeyType& key) const;
         // Return the index of the bucket that would contain all the elements
-        // having the specified 'key'.
+        // having the specified 'key' (if they have all been migrated by the
+        // incremental rehash in progress, if any).
 
     const COMPARATOR& comparator() const;
         // Return a reference providing non-modifiable access to the
@@ -1597,7 +1689,9 @@ class HashTable {
     SizeType countElementsInBucket(SizeType index) const;
         // Return the number elements contained in the bucket at the specified
         // 'index'.  Note that this operation has linear run-time complexity
-        // with respect to the number of elements in the indexed bucket.
+        // with respect to the number of elements in the indexed bucket.  Also
+        // note that, while an incremental rehash is migrating elements,
+        // elements that have not been migrated are not counted.
 
     bslalg::BidirectionalLink *elementListRoot() const;
         // Return the address of the first element in this hash table, or a
@@ -1617,11 +1711,13 @@ class HashTable {
         // the same key).  The behavior is undefined unless 'key' is equivalent
         // to the elements of at most one equivalent-key group.
         {
+            const std::size_t hashCode = d_parameters.hashCodeForKey(key);
+
             return bslalg::HashTableImpUtil::findTransparent<KEY_CONFIG>(
-                                             d_anchor,
-                                             key,
-                                             d_parameters.comparator(),
-                                             d_parameters.hashCodeForKey(key));
+                                                anchorForHashCode(hashCode),
+                                                key,
+                                                d_parameters.comparator(),
+                                                hashCode);
         }
 
     bslalg::BidirectionalLink *find(const KeyType& key) const;
@@ -1632,6 +1728,22 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    template <class KEY_ITERATOR>
+    KEY_ITERATOR findBatch(bslalg::BidirectionalLink **results,
+                           KEY_ITERATOR                first,
+                           KEY_ITERATOR                last) const;
+        // Load into the specified 'results' the address that 'find' would
+        // return for each of the keys in the range starting at the specified
+        // 'first' and ending at the specified 'last' or after
+        // 'k_FIND_BATCH_SIZE' keys, whichever is reached first, and return the
+        // position following the last key looked up.  The hash code of every
+        // key in the batch is computed, and its bucket and the first node of
+        // that bucket prefetched, before any key is compared, so that the
+        // cache misses of the batch overlap rather than occurring one after
+        // another.  'KEY_ITERATOR' shall be a forward iterator whose value
+        // type is convertible to 'KeyType'.  The behavior is undefined unless
+        // 'results' has at least 'k_FIND_BATCH_SIZE' elements.
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -1706,6 +1818,16 @@ class HashTable {
         // Return a reference providing non-modifiable access to the hash
         // functor used by this hash-table.
 
+    SizeType incrementalRehashStep() const;
+        // Return the minimum number of buckets cleared or migrated per
+        // insertion by an incremental rehash of this hash table, or 0 if
+        // incremental rehash is disabled (the default).
+
+    bool isRehashInProgress() const;
+        // Return 'true' if this hash table is part way through an incremental
+        // rehash, i.e., it has grown its capacity but not yet re-indexed every
+        // element into its new bucket array, and 'false' otherwise.
+
     float loadFactor() const;
         // Return the current load factor for this table.  The load factor is
         // the statistical mean number of elements per bucket.
@@ -1734,7 +1856,10 @@ class HashTable {
         // size, or even close to that size without running out of resources.
 
     SizeType numBuckets() const;
-        // Return the number of buckets contained in this hash table.
+        // Return the number of buckets contained in this hash table.  Note
+        // that, while an incremental rehash is in progress, this is the number
+        // of buckets in the current bucket array, which is the new one only
+        // once it has been cleared (see {Incremental Rehash}).
 
     SizeType rehashThreshold() const;
         // Return the number of elements this hash table can hold without
@@ -1928,6 +2053,42 @@ struct HashTable_ImpDetails {
         // preceding value).
 };
 
+                     // ============================
+                     // struct HashTable_RehashState
+                     // ============================
+
+struct HashTable_RehashState {
+    // This component-private 'struct' holds the state of the incremental
+    // rehash (see {Incremental Rehash}) of a 'HashTable' for which that mode
+    // is enabled.
+
+    // PUBLIC DATA
+    bslalg::HashTableAnchor d_newAnchor;  // bucket array being cleared to
+                                          // replace the current one (list
+                                          // root unused), or null
+
+    bslalg::HashTableAnchor d_oldAnchor;  // bucket array from which elements
+                                          // are being migrated (list root
+                                          // unused), or null
+
+    std::size_t             d_cursor;     // index of the next bucket of
+                                          // 'd_newAnchor' to be cleared or, if
+                                          // that is null, of 'd_oldAnchor' to
+                                          // be migrated
+
+    std::size_t             d_quota;      // number of buckets cleared or
+                                          // migrated per insertion by the
+                                          // rehash in progress
+
+    std::size_t             d_step;       // minimum value of 'd_quota', as
+                                          // set by 'setIncrementalRehashStep'
+
+    // CREATORS
+    explicit HashTable_RehashState(std::size_t step);
+        // Create a 'HashTable_RehashState' object having the specified 'step'
+        // and no rehash in progress.
+};
+
                     // ====================
                     // class HashTable_Util
                     // ====================
@@ -1939,6 +2100,17 @@ struct HashTable_Util {
     // library 'bslma_allocatortraits' for their implementation.
 
     // CLASS METHODS
+    template<class ALLOCATOR>
+    static void allocateBucketArray(bslalg::HashTableAnchor *anchor,
+                                    std::size_t              bucketArraySize,
+                                    const ALLOCATOR&         allocator);
+        // Load into the specified 'anchor' a (contiguous) array of buckets of
+        // the specified 'bucketArraySize' using memory supplied by the
+        // specified 'allocator', without initializing the buckets.  The
+        // behavior is undefined unless '0 < bucketArraySize'.  Note that this
+        // operation has no effect on 'anchor->listRootAddress()', and that
+        // every bucket must be reset before the array is used.
+
     template <class TYPE>
     static void assertNotNullPointer(TYPE&);
     template <class TYPE>
@@ -1952,6 +2124,14 @@ struct HashTable_Util {
         // way to assert in general that the value of a generic type passed to
         // a function is not a null pointer value.
 
+    template<class ALLOCATOR>
+    static HashTable_RehashState *createRehashState(
+                                                std::size_t      step,
+                                                const ALLOCATOR& allocator);
+        // Return the address of a newly created 'HashTable_RehashState'
+        // object having the specified 'step', using memory supplied by the
+        // specified 'allocator'.
+
     template<class ALLOCATOR>
     static void destroyBucketArray(bslalg::HashTableBucket *data,
                                    std::size_t              bucketArraySize,
@@ -1959,6 +2139,12 @@ struct HashTable_Util {
         // Destroy the specified 'data' array of the specified length
         // 'bucketArraySize', that was allocated by the specified 'allocator'.
 
+    template<class ALLOCATOR>
+    static void destroyRehashState(HashTable_RehashState *state,
+                                   const ALLOCATOR&       allocator);
+        // Destroy the specified 'state', that was created by
+        // 'createRehashState' using the specified 'allocator'.
+
     template<class ALLOCATOR>
     static void initAnchor(bslalg::HashTableAnchor *anchor,
                            std::size_t              bucketArraySize,
@@ -2401,10 +2587,70 @@ void HashTable_ArrayProctor<FACTORY>::release()
     d_anchor_p = 0;
 }
 
+                     // ----------------------------
+                     // struct HashTable_RehashState
+                     // ----------------------------
+
+// CREATORS
+inline
+HashTable_RehashState::HashTable_RehashState(std::size_t step)
+: d_newAnchor(0, 0, 0)
+, d_oldAnchor(0, 0, 0)
+, d_cursor(0)
+, d_quota(step)
+, d_step(step)
+{
+}
+
                     // --------------------
                     // class HashTable_Util
                     // --------------------
 
+template <class ALLOCATOR>
+inline
+void HashTable_Util::allocateBucketArray(
+                                      bslalg::HashTableAnchor *anchor,
+                                      std::size_t              bucketArraySize,
+                                      const ALLOCATOR&         allocator)
+{
+    BSLS_ASSERT_SAFE(anchor);
+    BSLS_ASSERT_SAFE(0 != bucketArraySize);
+
+    typedef ::bsl::allocator_traits<ALLOCATOR>               ParamAllocTraits;
+    typedef typename ParamAllocTraits::template
+                      rebind_traits<bslalg::HashTableBucket> BucketAllocTraits;
+    typedef typename BucketAllocTraits::allocator_type       ArrayAllocator;
+    typedef ::bsl::allocator_traits<ArrayAllocator>       ArrayAllocatorTraits;
+    typedef typename ArrayAllocatorTraits::size_type         SizeType;
+
+    BSLS_ASSERT_SAFE(bucketArraySize <= std::numeric_limits<SizeType>::max());
+
+    ArrayAllocator reboundAllocator(allocator);
+
+    // This test is necessary to avoid undefined behavior in the non-standard
+    // narrow contract of 'bsl::allocator', although it seems like a reasonable
+    // assumption to pre-empt other allocators too.
+
+    if (ArrayAllocatorTraits::max_size(reboundAllocator) < bucketArraySize) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    // Conversion to exactly the correct type resolves compiler warnings.  The
+    // assertions above are a loose safety check that this conversion can never
+    // overflow - which would require an allocator using a 'size_type' larger
+    // than 'std::size_t', with the requirement that a standard conforming
+    // allocator must use a 'size_type' that is a built-in unsigned integer
+    // type.
+
+    const SizeType newArraySize = static_cast<SizeType>(bucketArraySize);
+
+    bslalg::HashTableBucket *data = ArrayAllocatorTraits::allocate(
+                                       reboundAllocator,
+                                       newArraySize);
+
+    anchor->setBucketArrayAddressAndSize(data, newArraySize);
+}
+
 template <class TYPE>
 inline
 void HashTable_Util::assertNotNullPointer(TYPE&)
@@ -2429,6 +2675,24 @@ void HashTable_Util::assertNotNullPointer(TYPE * & ptr)
     BSLS_ASSERT(ptr);
 }
 
+template <class ALLOCATOR>
+inline
+HashTable_RehashState *HashTable_Util::createRehashState(
+                                                    std::size_t      step,
+                                                    const ALLOCATOR& allocator)
+{
+    typedef ::bsl::allocator_traits<ALLOCATOR>               ParamAllocTraits;
+    typedef typename ParamAllocTraits::template
+                        rebind_traits<HashTable_RehashState> StateAllocTraits;
+    typedef typename StateAllocTraits::allocator_type        StateAllocator;
+
+    StateAllocator reboundAllocator(allocator);
+
+    HashTable_RehashState *state = StateAllocTraits::allocate(reboundAllocator,
+                                                              1);
+    return ::new (static_cast<void *>(state)) HashTable_RehashState(step);
+}
+
 template <class ALLOCATOR>
 inline
 void HashTable_Util::destroyBucketArray(
@@ -2463,48 +2727,37 @@ void HashTable_Util::destroyBucketArray(
 
 template <class ALLOCATOR>
 inline
-void HashTable_Util::initAnchor(bslalg::HashTableAnchor *anchor,
-                                std::size_t              bucketArraySize,
-                                const ALLOCATOR&         allocator)
+void HashTable_Util::destroyRehashState(HashTable_RehashState *state,
+                                        const ALLOCATOR&       allocator)
 {
-    BSLS_ASSERT_SAFE(anchor);
-    BSLS_ASSERT_SAFE(0 != bucketArraySize);
+    BSLS_ASSERT_SAFE(state);
 
     typedef ::bsl::allocator_traits<ALLOCATOR>               ParamAllocTraits;
     typedef typename ParamAllocTraits::template
-                      rebind_traits<bslalg::HashTableBucket> BucketAllocTraits;
-    typedef typename BucketAllocTraits::allocator_type       ArrayAllocator;
-    typedef ::bsl::allocator_traits<ArrayAllocator>       ArrayAllocatorTraits;
-    typedef typename ArrayAllocatorTraits::size_type         SizeType;
+                        rebind_traits<HashTable_RehashState> StateAllocTraits;
+    typedef typename StateAllocTraits::allocator_type        StateAllocator;
 
-    BSLS_ASSERT_SAFE(bucketArraySize <= std::numeric_limits<SizeType>::max());
-
-    ArrayAllocator reboundAllocator(allocator);
+    StateAllocator reboundAllocator(allocator);
 
-    // This test is necessary to avoid undefined behavior in the non-standard
-    // narrow contract of 'bsl::allocator', although it seems like a reasonable
-    // assumption to pre-empt other allocators too.
+    // 'HashTable_RehashState' is trivially destructible.
 
-    if (ArrayAllocatorTraits::max_size(reboundAllocator) < bucketArraySize) {
-        bsls::BslExceptionUtil::throwBadAlloc();
-    }
-
-    // Conversion to exactly the correct type resolves compiler warnings.  The
-    // assertions above are a loose safety check that this conversion can never
-    // overflow - which would require an allocator using a 'size_type' larger
-    // than 'std::size_t', with the requirement that a standard conforming
-    // allocator must use a 'size_type' that is a built-in unsigned integer
-    // type.
-
-    const SizeType newArraySize = static_cast<SizeType>(bucketArraySize);
+    StateAllocTraits::deallocate(reboundAllocator, state, 1);
+}
 
-    bslalg::HashTableBucket *data = ArrayAllocatorTraits::allocate(
-                                       reboundAllocator,
-                                       newArraySize);
+template <class ALLOCATOR>
+inline
+void HashTable_Util::initAnchor(bslalg::HashTableAnchor *anchor,
+                                std::size_t              bucketArraySize,
+                                const ALLOCATOR&         allocator)
+{
+    BSLS_ASSERT_SAFE(anchor);
+    BSLS_ASSERT_SAFE(0 != bucketArraySize);
 
-    std::fill_n(data, bucketArraySize, bslalg::HashTableBucket());
+    allocateBucketArray(anchor, bucketArraySize, allocator);
 
-    anchor->setBucketArrayAddressAndSize(data, newArraySize);
+    std::fill_n(anchor->bucketArrayAddress(),
+                bucketArraySize,
+                bslalg::HashTableBucket());
 }
 
                 //-------------------------------
@@ -2686,6 +2939,7 @@ HashTable(const ALLOCATOR& basicAllocator)
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_rehash_p(0)
 {
     BSLMF_ASSERT(!bsl::is_pointer<HASHER>::value &&
                  !bsl::is_pointer<COMPARATOR>::value);
@@ -2704,6 +2958,7 @@ HashTable(const HASHER&     hash,
 , d_size()
 , d_capacity(0)
 , d_maxLoadFactor(initialMaxLoadFactor)
+, d_rehash_p(0)
 {
     BSLS_ASSERT_SAFE(0.0f < initialMaxLoadFactor);
 
@@ -2737,11 +2992,13 @@ HashTable(const HashTable& original)
 , d_size(original.d_size)
 , d_capacity(0)
 , d_maxLoadFactor(original.d_maxLoadFactor)
+, d_rehash_p(0)
 {
     if (0 < d_size) {
         d_parameters.nodeFactory().reserveNodes(original.d_size);
         this->copyDataStructure(original.d_anchor.listRootAddress());
     }
+    this->copyIncrementalRehashStep(original);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -2753,6 +3010,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::HashTable(
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_rehash_p(0)
 {
     HashTable& lvalue = original;
     using std::swap;
@@ -2760,6 +3018,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::HashTable(
     swap(d_size,          lvalue.d_size);
     swap(d_capacity,      lvalue.d_capacity);
     swap(d_maxLoadFactor, lvalue.d_maxLoadFactor);
+    swap(d_rehash_p,      lvalue.d_rehash_p);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -2771,11 +3030,13 @@ HashTable(const HashTable& original, const ALLOCATOR& basicAllocator)
 , d_size(original.d_size)
 , d_capacity(0)
 , d_maxLoadFactor(original.d_maxLoadFactor)
+, d_rehash_p(0)
 {
     if (0 < d_size) {
         d_parameters.nodeFactory().reserveNodes(original.d_size);
         this->copyDataStructure(original.d_anchor.listRootAddress());
     }
+    this->copyIncrementalRehashStep(original);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -2789,6 +3050,7 @@ HashTable(bslmf::MovableRef<HashTable> original,
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_rehash_p(0)
 {
     HashTable& lvalue = original;
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
@@ -2800,12 +3062,16 @@ HashTable(bslmf::MovableRef<HashTable> original,
         swap(d_size,          lvalue.d_size);
         swap(d_capacity,      lvalue.d_capacity);
         swap(d_maxLoadFactor, lvalue.d_maxLoadFactor);
+        swap(d_rehash_p,      lvalue.d_rehash_p);
     }
     else {
         d_size = lvalue.d_size;
         d_maxLoadFactor = lvalue.d_maxLoadFactor;
         if (0 < d_size) {
             // 'original' left in the default state
+
+            lvalue.abandonRehash();
+
             bslalg::HashTableAnchor anchor(
                            HashTable_ImpDetails::defaultBucketAddress(), 1, 0);
             using std::swap;
@@ -2824,6 +3090,7 @@ HashTable(bslmf::MovableRef<HashTable> original,
 
             // 'arrayProctor' will care of deleting the nodes
         }
+        this->copyIncrementalRehashStep(lvalue);
     }
 }
 
@@ -2842,16 +3109,113 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~HashTable()
     // kind of catastrophic failure we are concerned with handling in an
     // invariant check that runs only in SAFE_2 builds from a destructor.
 
-    BSLS_ASSERT_SAFE(bslalg::HashTableImpUtil::isWellFormed<KEY_CONFIG>(
+    BSLS_ASSERT_SAFE(isRehashInProgress()
+                  || bslalg::HashTableImpUtil::isWellFormed<KEY_CONFIG>(
                                  this->d_anchor,
                                  this->d_parameters.hasher(),
                                  HashTable_ImpDetails::incidentalAllocator()));
 #endif
 
     this->removeAllAndDeallocate();
+    if (d_rehash_p) {
+        HashTable_Util::destroyRehashState(d_rehash_p, this->allocator());
+    }
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::abandonRehash()
+{
+    if (d_rehash_p) {
+        if (d_rehash_p->d_newAnchor.bucketArrayAddress()) {
+            HashTable_Util::destroyBucketArray(
+                                d_rehash_p->d_newAnchor.bucketArrayAddress(),
+                                d_rehash_p->d_newAnchor.bucketArraySize(),
+                                this->allocator());
+            d_rehash_p->d_newAnchor.setBucketArrayAddressAndSize(0, 0);
+        }
+        if (d_rehash_p->d_oldAnchor.bucketArrayAddress()) {
+            HashTable_Util::destroyBucketArray(
+                                d_rehash_p->d_oldAnchor.bucketArrayAddress(),
+                                d_rehash_p->d_oldAnchor.bucketArraySize(),
+                                this->allocator());
+            d_rehash_p->d_oldAnchor.setBucketArrayAddressAndSize(0, 0);
+        }
+        d_rehash_p->d_cursor = 0;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::advanceRehash(
+                                                          std::size_t hashCode)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(this->isRehashInProgress())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        HashTable_RehashState& rehash = *d_rehash_p;
+        std::size_t            budget = rehash.d_quota;
+
+        if (rehash.d_newAnchor.bucketArrayAddress()) {
+            const std::size_t numToClear = std::min(
+                      budget,
+                      rehash.d_newAnchor.bucketArraySize() - rehash.d_cursor);
+
+            std::fill_n(rehash.d_newAnchor.bucketArrayAddress()
+                                                             + rehash.d_cursor,
+                        numToClear,
+                        bslalg::HashTableBucket());
+            rehash.d_cursor += numToClear;
+            budget          -= numToClear;
+
+            if (rehash.d_cursor < rehash.d_newAnchor.bucketArraySize()) {
+                return;                                               // RETURN
+            }
+            this->beginMigration();
+        }
+
+        const std::size_t numOldBuckets = rehash.d_oldAnchor.bucketArraySize();
+
+        // Migrate the bucket of the element about to be inserted first, so
+        // that elements having equivalent keys remain contiguous.
+
+        this->migrateOldBucket(static_cast<SizeType>(
+                        bslalg::HashTableImpUtil::computeBucketIndex(
+                                                            hashCode,
+                                                            numOldBuckets)));
+
+        for (; 0 < budget && rehash.d_cursor < numOldBuckets; --budget) {
+            this->migrateOldBucket(static_cast<SizeType>(rehash.d_cursor++));
+        }
+
+        if (rehash.d_cursor == numOldBuckets) {
+            this->abandonRehash();
+        }
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::beginMigration()
+{
+    BSLS_ASSERT_SAFE(d_rehash_p);
+    BSLS_ASSERT_SAFE(d_rehash_p->d_newAnchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(d_rehash_p->d_cursor ==
+                                   d_rehash_p->d_newAnchor.bucketArraySize());
+    BSLS_ASSERT_SAFE(0 == d_rehash_p->d_oldAnchor.bucketArrayAddress());
+
+    HashTable_RehashState& rehash = *d_rehash_p;
+
+    rehash.d_oldAnchor.setBucketArrayAddressAndSize(
+                                                 d_anchor.bucketArrayAddress(),
+                                                 d_anchor.bucketArraySize());
+    d_anchor.setBucketArrayAddressAndSize(
+                                    rehash.d_newAnchor.bucketArrayAddress(),
+                                    rehash.d_newAnchor.bucketArraySize());
+    rehash.d_newAnchor.setBucketArrayAddressAndSize(0, 0);
+    rehash.d_cursor = 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
@@ -2904,6 +3268,165 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
     arrayProctor.release();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+copyIncrementalRehashStep(const HashTable& original)
+{
+    BSLS_ASSERT_SAFE(0 == d_rehash_p);
+
+    if (original.d_rehash_p) {
+        // Destroy the elements already copied if the allocation throws, as
+        // the destructor of this (partly constructed) object will not run.
+
+        HashTable_ArrayProctor<typename ImplParameters::NodeFactory>
+                                 arrayProctor(&d_parameters.nodeFactory(),
+                                              &d_anchor);
+
+        d_rehash_p = HashTable_Util::createRehashState(
+                                                  original.d_rehash_p->d_step,
+                                                  this->allocator());
+        arrayProctor.release();
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::growForInsertion()
+{
+    if (!d_rehash_p
+     || HashTable_ImpDetails::defaultBucketAddress() ==
+                                               d_anchor.bucketArrayAddress()) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+        return;                                                       // RETURN
+    }
+
+    // The quota computed below completes every rehash before the table can
+    // grow again, so this call is normally a no-op.
+
+    this->completeRehash();
+
+    size_t   capacity;
+    SizeType newNumBuckets = static_cast<SizeType>(
+                              HashTable_ImpDetails::growBucketsForLoadFactor(
+                                      &capacity,
+                                      d_size + 1u,
+                                      static_cast<size_t>(numBuckets() * 2),
+                                      d_maxLoadFactor));
+
+    // The new bucket array is cleared incrementally too, so that this call
+    // does not take time linear in the size of the table.
+
+    HashTable_RehashState& rehash = *d_rehash_p;
+
+    HashTable_Util::allocateBucketArray(&rehash.d_newAnchor,
+                                        static_cast<size_t>(newNumBuckets),
+                                        this->allocator());
+
+    // Spread the buckets to be cleared and migrated over the insertions that
+    // the new capacity allows, so that the rehash is complete before this
+    // table must grow again.
+
+    const std::size_t numInsertions = capacity > d_size
+                                    ? capacity - d_size
+                                    : 1;
+    const std::size_t numBucketsToDo =
+                          static_cast<std::size_t>(newNumBuckets)
+                        + static_cast<std::size_t>(d_anchor.bucketArraySize());
+
+    rehash.d_cursor = 0;
+    rehash.d_quota  = std::max(
+                        rehash.d_step,
+                        (numBucketsToDo + numInsertions - 1) / numInsertions);
+    d_capacity      = static_cast<SizeType>(capacity);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::migrateOldBucket(
+                                                                SizeType index)
+{
+    BSLS_ASSERT_SAFE(d_rehash_p);
+    BSLS_ASSERT_SAFE(d_rehash_p->d_oldAnchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(index < d_rehash_p->d_oldAnchor.bucketArraySize());
+
+    class Proctor {
+        // An object of this proctor class guarantees that, if an exception is
+        // thrown by a user-supplied hash functor, the container remains in a
+        // valid, usable (but empty) state, as the bucket being migrated is
+        // left partly in each bucket array.
+
+      private:
+        HashTable *d_table_p;
+
+#if !defined(BSLS_PLATFORM_CMP_MSVC)
+        // Microsoft warns if these methods are declared private.
+
+      private:
+        // NOT IMPLEMENTED
+        Proctor(const Proctor&); // = delete;
+        Proctor& operator=(const Proctor&); // = delete;
+#endif
+
+      public:
+        // CREATORS
+        explicit Proctor(HashTable *table)
+        : d_table_p(table)
+        {
+            BSLS_ASSERT_SAFE(table);
+        }
+
+        ~Proctor()
+        {
+            if (d_table_p) {
+                d_table_p->removeAll();
+            }
+        }
+
+        // MANIPULATORS
+        void dismiss()
+        {
+            d_table_p = 0;
+        }
+    };
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+    bslalg::HashTableBucket *bucket =
+                          d_rehash_p->d_oldAnchor.bucketArrayAddress() + index;
+
+    bslalg::BidirectionalLink *cursor = bucket->first();
+    if (!cursor) {
+        return;                                                       // RETURN
+    }
+
+    Proctor cleanUpIfUserHashThrows(this);
+
+    bslalg::BidirectionalLink *const last = bucket->last();
+    bool                             isLast;
+    do {
+        // Compute the hash code before unlinking 'cursor', so that every
+        // element is still in the list if the hasher throws.
+
+        const std::size_t          hashCode = hashCodeForNode(cursor);
+        bslalg::BidirectionalLink *next     = cursor->nextLink();
+
+        isLast = last == cursor;
+
+        bslalg::BidirectionalLinkListUtil::unlink(cursor);
+        if (d_anchor.listRootAddress() == cursor) {
+            d_anchor.setListRootAddress(next);
+        }
+        bslalg::HashTableImpUtil::insertAtBackOfBucket(&d_anchor,
+                                                       cursor,
+                                                       hashCode);
+        cursor = next;
+    } while (!isLast);
+
+    bucket->reset();
+
+    cleanUpIfUserHashThrows.dismiss();
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::moveDataStructure(
@@ -2971,6 +3494,7 @@ quickSwapExchangeAllocators(HashTable *other)
     swap(d_size,          other->d_size);
     swap(d_capacity,      other->d_capacity);
     swap(d_maxLoadFactor, other->d_maxLoadFactor);
+    swap(d_rehash_p,      other->d_rehash_p);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -2988,6 +3512,7 @@ quickSwapRetainAllocators(HashTable *other)
     swap(d_size,          other->d_size);
     swap(d_capacity,      other->d_capacity);
     swap(d_maxLoadFactor, other->d_maxLoadFactor);
+    swap(d_rehash_p,      other->d_rehash_p);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3084,6 +3609,11 @@ rehashIntoExactlyNumBuckets(SizeType newNumBuckets, SizeType capacity)
 
     d_anchor.swap(newAnchor);
     d_capacity = capacity;
+
+    // Every element, including any not yet migrated by an incremental rehash,
+    // is now indexed by the new bucket array.
+
+    this->abandonRehash();
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3092,6 +3622,7 @@ void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllAndDeallocate()
 {
     this->removeAllImp();
+    this->abandonRehash();
     HashTable_Util::destroyBucketArray(d_anchor.bucketArrayAddress(),
                                        d_anchor.bucketArraySize(),
                                        this->allocator());
@@ -3119,6 +3650,33 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllImp()
 }
 
 // PRIVATE ACCESSORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+const bslalg::HashTableAnchor&
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::anchorForHashCode(
+                                                    std::size_t hashCode) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                               d_rehash_p
+                            && d_rehash_p->d_oldAnchor.bucketArrayAddress())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Old buckets are migrated whole, so a non-empty old bucket holds
+        // every element whose hash code maps to it.
+
+        const bslalg::HashTableAnchor& oldAnchor = d_rehash_p->d_oldAnchor;
+        const bslalg::HashTableBucket& oldBucket =
+                        oldAnchor.bucketArrayAddress()[
+                            bslalg::HashTableImpUtil::computeBucketIndex(
+                                                hashCode,
+                                                oldAnchor.bucketArraySize())];
+        if (oldBucket.first()) {
+            return oldAnchor;                                         // RETURN
+        }
+    }
+    return d_anchor;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class DEDUCED_KEY>
 inline
@@ -3128,10 +3686,10 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                                   std::size_t  hashValue) const
 {
     return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
-                                                     d_anchor,
-                                                     key,
-                                                     d_parameters.comparator(),
-                                                     hashValue);
+                                                  anchorForHashCode(hashValue),
+                                                  key,
+                                                  d_parameters.comparator(),
+                                                  hashValue);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3222,7 +3780,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3237,6 +3795,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3266,7 +3825,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3281,6 +3840,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3312,7 +3872,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3328,6 +3888,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3361,7 +3922,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3378,6 +3939,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3413,7 +3975,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3431,6 +3993,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3468,7 +4031,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3487,6 +4050,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3526,7 +4090,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3546,6 +4110,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3587,7 +4152,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3608,6 +4173,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3651,7 +4217,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3673,6 +4239,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3718,7 +4285,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3741,6 +4308,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3788,7 +4356,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3812,6 +4380,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -3841,7 +4410,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3856,6 +4425,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -3888,7 +4458,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3903,6 +4473,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -3937,7 +4508,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -3953,6 +4524,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -3989,7 +4561,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4006,6 +4578,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -4044,7 +4617,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4062,6 +4635,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -4102,7 +4676,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4121,6 +4695,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -4163,7 +4738,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4183,6 +4758,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -4227,7 +4803,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4248,6 +4824,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -4294,7 +4871,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4316,6 +4893,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -4364,7 +4942,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4387,6 +4965,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -4437,7 +5016,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4461,6 +5040,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -4494,7 +5074,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4509,6 +5089,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -4517,7 +5098,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -4545,7 +5126,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4560,6 +5141,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -4568,7 +5150,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -4598,7 +5180,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4614,6 +5196,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -4622,7 +5205,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -4654,7 +5237,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4671,6 +5254,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -4679,7 +5263,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -4713,7 +5297,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4731,6 +5315,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -4739,7 +5324,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -4775,7 +5360,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4794,6 +5379,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -4802,7 +5388,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -4840,7 +5426,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4860,6 +5446,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -4868,7 +5455,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -4908,7 +5495,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -4929,6 +5516,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -4937,7 +5525,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -4979,7 +5567,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -5001,6 +5589,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -5009,7 +5598,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -5053,7 +5642,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -5076,6 +5665,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -5084,7 +5674,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -5130,7 +5720,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -5154,6 +5744,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -5162,7 +5753,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -5189,7 +5780,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -5204,6 +5795,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -5232,7 +5824,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -5247,6 +5839,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     if (!hint
      || !d_parameters.comparator()(ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                    ImpUtil::extractKey<KEY_CONFIG>(hint))) {
@@ -5279,7 +5872,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
 
 
@@ -5294,6 +5887,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                      ImpUtil::extractKey<KEY_CONFIG>(newNode));
+    this->advanceRehash(hashCode);
     bslalg::BidirectionalLink *position = this->find(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
@@ -5302,7 +5896,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
 
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
@@ -5317,6 +5911,31 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 // }}} END GENERATED CODE
 #endif
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::completeRehash()
+{
+    if (!this->isRehashInProgress()) {
+        return;                                                       // RETURN
+    }
+
+    HashTable_RehashState& rehash = *d_rehash_p;
+
+    if (rehash.d_newAnchor.bucketArrayAddress()) {
+        std::fill_n(rehash.d_newAnchor.bucketArrayAddress() + rehash.d_cursor,
+                    rehash.d_newAnchor.bucketArraySize() - rehash.d_cursor,
+                    bslalg::HashTableBucket());
+        rehash.d_cursor = rehash.d_newAnchor.bucketArraySize();
+        this->beginMigration();
+    }
+
+    const std::size_t numOldBuckets = rehash.d_oldAnchor.bucketArraySize();
+
+    while (rehash.d_cursor < numOldBuckets) {
+        this->migrateOldBucket(static_cast<SizeType>(rehash.d_cursor++));
+    }
+    this->abandonRehash();
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
@@ -5326,8 +5945,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     bslalg::BidirectionalLink *position = this->find(key, hashCode);
     if (!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
+        this->advanceRehash(hashCode);
 
         typedef typename ValueType::second_type MappedType;
 
@@ -5377,8 +5997,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
+        this->advanceRehash(hashCode);
 
         position = d_parameters.nodeFactory().emplaceIntoNewNode(value);
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
@@ -5410,8 +6031,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growForInsertion();
         }
+        this->advanceRehash(hashCode);
 
         position = d_parameters.nodeFactory().emplaceIntoNewNode(
                                                        MoveUtil::move(lvalue));
@@ -5491,8 +6113,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertOrAssign(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
         BSLS_COMPILERFEATURES_FORWARD(KEY_ARG, key),
@@ -5542,9 +6165,23 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::remove(
 
     bslalg::BidirectionalLink *result = node->nextLink();
 
-    bslalg::HashTableImpUtil::remove(&d_anchor,
-                                     node,
-                                     hashCodeForNode(node));
+    const std::size_t              hashCode = hashCodeForNode(node);
+    const bslalg::HashTableAnchor& anchor   = anchorForHashCode(hashCode);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(&anchor != &d_anchor)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // 'node' has not yet been migrated by the rehash in progress, so it
+        // is unlinked from its old bucket.
+
+        bslalg::HashTableAnchor oldAnchor(anchor.bucketArrayAddress(),
+                                          anchor.bucketArraySize(),
+                                          d_anchor.listRootAddress());
+        bslalg::HashTableImpUtil::remove(&oldAnchor, node, hashCode);
+        d_anchor.setListRootAddress(oldAnchor.listRootAddress());
+    }
+    else {
+        bslalg::HashTableImpUtil::remove(&d_anchor, node, hashCode);
+    }
     --d_size;
 
     d_parameters.nodeFactory().deleteNode(static_cast<NodeType *>(node));
@@ -5557,6 +6194,7 @@ void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
 {
     this->removeAllImp();
+    this->abandonRehash();
     if (HashTable_ImpDetails::defaultBucketAddress() !=
         d_anchor.bucketArrayAddress()) {
         std::memset(d_anchor.bucketArrayAddress(),
@@ -5596,6 +6234,32 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserveForNumElements(
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setIncrementalRehashStep(
+                                                           SizeType numBuckets)
+{
+    if (0 == numBuckets) {
+        if (d_rehash_p) {
+            this->completeRehash();
+            HashTable_Util::destroyRehashState(d_rehash_p, this->allocator());
+            d_rehash_p = 0;
+        }
+        return;                                                       // RETURN
+    }
+
+    if (!d_rehash_p) {
+        d_rehash_p = HashTable_Util::createRehashState(
+                                         static_cast<std::size_t>(numBuckets),
+                                         this->allocator());
+        return;                                                       // RETURN
+    }
+
+    // The new step applies from the next time this table grows.
+
+    d_rehash_p->d_step = static_cast<std::size_t>(numBuckets);
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setMaxLoadFactor(
@@ -5673,8 +6337,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -5726,8 +6391,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -5783,8 +6449,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -5844,8 +6511,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -5909,8 +6577,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -5978,8 +6647,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -6051,8 +6721,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -6128,8 +6799,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -6209,8 +6881,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -6294,8 +6967,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -6383,8 +7057,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -6458,8 +7133,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::tryEmplace(
     }
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growForInsertion();
     }
+    this->advanceRehash(hashCode);
 
 #if defined(BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR)
     hint = d_parameters.nodeFactory().emplaceIntoNewNode(
@@ -6560,11 +7236,56 @@ bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                                       const KeyType& key) const
 {
-    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
-                                             d_anchor,
-                                             key,
-                                             d_parameters.comparator(),
-                                             d_parameters.hashCodeForKey(key));
+    return this->find(key, d_parameters.hashCodeForKey(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class KEY_ITERATOR>
+KEY_ITERATOR HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findBatch(
+                                     bslalg::BidirectionalLink **results,
+                                     KEY_ITERATOR                first,
+                                     KEY_ITERATOR                last) const
+{
+    BSLS_ASSERT_SAFE(results);
+
+    std::size_t                    hashCodes[k_FIND_BATCH_SIZE];
+    const bslalg::HashTableBucket *buckets[k_FIND_BATCH_SIZE];
+    int                            numKeys = 0;
+
+    // First, hash every key of the batch and prefetch its bucket.
+
+    for (KEY_ITERATOR it = first; numKeys < k_FIND_BATCH_SIZE && it != last;
+                                                           ++numKeys, ++it) {
+        const KeyType&    key      = *it;
+        const std::size_t hashCode = d_parameters.hashCodeForKey(key);
+
+        hashCodes[numKeys] = hashCode;
+        buckets[numKeys]   = d_anchor.bucketArrayAddress()
+                           + bslalg::HashTableImpUtil::computeBucketIndex(
+                                                   hashCode,
+                                                   d_anchor.bucketArraySize());
+
+        bsls::PerformanceHint::prefetchForReading(buckets[numKeys]);
+    }
+
+    // Then, prefetch the first node of each bucket, which is where the
+    // element sought is most likely to be found.
+
+    for (int i = 0; i < numKeys; ++i) {
+        if (bslalg::BidirectionalLink *node = buckets[i]->first()) {
+            bsls::PerformanceHint::prefetchForReading(node);
+        }
+    }
+
+    // Finally, compare the keys.
+
+    for (int i = 0; i < numKeys; ++i, ++first) {
+        const KeyType& key = *first;
+
+        results[i] = this->find(key, hashCodes[i]);
+    }
+
+    return first;
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -6641,12 +7362,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasSameValue(
     }
 
     while (cursor) {
+        const std::size_t rhsHashCode = other.d_parameters.hashCodeForKey(
+                                      ImpUtil::extractKey<KEY_CONFIG>(cursor));
         bslalg::BidirectionalLink *rhsFirst =
-             ImpUtil::find<KEY_CONFIG>(other.d_anchor,
+             ImpUtil::find<KEY_CONFIG>(other.anchorForHashCode(rhsHashCode),
                                        ImpUtil::extractKey<KEY_CONFIG>(cursor),
                                        other.d_parameters.comparator(),
-                                       other.d_parameters.hashCodeForKey(
-                                     ImpUtil::extractKey<KEY_CONFIG>(cursor)));
+                                       rhsHashCode);
         if (!rhsFirst) {
             return false;  // no matching key                         // RETURN
         }
@@ -6767,6 +7489,26 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasher() const
     return d_parameters.originalHasher();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::incrementalRehashStep()
+                                                                          const
+{
+    return d_rehash_p ? static_cast<SizeType>(d_rehash_p->d_step) : 0;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::isRehashInProgress()
+                                                                          const
+{
+    return d_rehash_p
+        && (d_rehash_p->d_newAnchor.bucketArrayAddress()
+         || d_rehash_p->d_oldAnchor.bucketArrayAddress());
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 float HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::loadFactor() const
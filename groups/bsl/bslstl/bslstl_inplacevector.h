@@ -0,0 +1,1524 @@
+// bslstl_inplacevector.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_INPLACEVECTOR
+#define INCLUDED_BSLSTL_INPLACEVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-capacity vector that stores its elements inline.
+//
+//@CLASSES:
+//  bsl::inplace_vector: fixed-capacity sequence container with inline storage
+//
+//@CANONICAL_HEADER: bsl_inplace_vector.h
+//
+//@SEE_ALSO: bslstl_vector, bdlc_smallvector
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::inplace_vector', implementing the C++26 standard container of that
+// name: a dynamically-resizable sequence of at most 'CAPACITY' elements whose
+// storage is part of the object itself.  An 'inplace_vector' never allocates
+// memory; the object is typically placed on the stack or embedded in another
+// object, so creating, filling, and destroying a small sequence costs no
+// allocator round-trip.  Attempting to grow an 'inplace_vector' beyond its
+// 'CAPACITY' throws 'bsl::bad_alloc', except through the 'try_*' methods,
+// which instead return a null pointer, and the 'unchecked_*' methods, which
+// have a precondition that capacity is available.
+//
+// Since the elements are stored inline, moving an 'inplace_vector' moves each
+// element, and 'swap' exchanges elements, so that both operations take time
+// linear in the number of elements, and (unlike those of 'bsl::vector')
+// invalidate iterators.
+//
+// Elements are relocated (e.g., by 'insert' and 'erase') using
+// 'bslalg::ArrayPrimitives', so that the elements of bitwise-moveable types
+// are moved with 'memmove'.
+//
+///Allocator Use
+///-------------
+// An 'inplace_vector' is not allocator-aware.  An element of an
+// allocator-aware 'VALUE_TYPE' is created using the default allocator, as
+// though it were created with no allocator argument.
+//
+///Requirements on 'VALUE_TYPE'
+///----------------------------
+// The requirements on 'VALUE_TYPE' are those of the corresponding operations
+// of 'bsl::vector'.
+//
+///Exception Safety
+///----------------
+// Any method that would increase the size of an 'inplace_vector' beyond
+// 'CAPACITY' throws 'bsl::bad_alloc' and has no effect.  Appending a single
+// element provides the strong exception-safety guarantee; other methods
+// provide the basic guarantee.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting the Digits of a Number
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need the decimal digits of an 'unsigned int', most significant
+// first.  There are at most ten of them, so we can collect them into an
+// 'inplace_vector' and avoid any allocation.
+//
+// First, we define the function:
+//..
+//  typedef bsl::inplace_vector<char, 10> Digits;
+//
+//  Digits toDigits(unsigned int value)
+//      // Return the decimal digits of the specified 'value', most
+//      // significant first.
+//  {
+//      Digits result;
+//      do {
+//          result.push_back(static_cast<char>('0' + value % 10));
+//          value /= 10;
+//      } while (value);
+//      bsl::reverse(result.begin(), result.end());
+//      return result;
+//  }
+//..
+// Then, we call the function:
+//..
+//  Digits digits = toDigits(4096);
+//..
+// Finally, we examine the result:
+//..
+//  assert(4   == digits.size());
+//  assert(10  == digits.capacity());
+//  assert('4' == digits.front());
+//  assert('6' == digits.back());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_stdexceptutil.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_hasstliterators.h>
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructionutil.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isintegral.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_bslexceptionutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <initializer_list>
+#endif
+
+namespace bsl {
+
+                      // ===============================
+                      // class InplaceVector_TailProctor
+                      // ===============================
+
+template <class VALUE_TYPE>
+class InplaceVector_TailProctor {
+    // This component-private class implements a proctor that, unless
+    // released, destroys the elements appended to an 'inplace_vector' after
+    // the proctor was created, and restores the size of the vector.
+
+    // DATA
+    VALUE_TYPE  *d_data_p;   // first element of the vector
+    std::size_t *d_size_p;   // address of the size of the vector
+    std::size_t  d_oldSize;  // size of the vector at construction
+
+  private:
+    // NOT IMPLEMENTED
+    InplaceVector_TailProctor(const InplaceVector_TailProctor&);
+    InplaceVector_TailProctor& operator=(const InplaceVector_TailProctor&);
+
+  public:
+    // CREATORS
+    InplaceVector_TailProctor(VALUE_TYPE *data, std::size_t *size);
+        // Create a proctor for the elements appended to the array at the
+        // specified 'data' address, whose size is held at the specified
+        // 'size' address, after this call.
+
+    ~InplaceVector_TailProctor();
+        // Destroy this proctor, destroying the elements appended since its
+        // creation and restoring the size, unless 'release' has been called.
+
+    // MANIPULATORS
+    void release();
+        // Release the elements under management from this proctor.
+};
+
+                            // ====================
+                            // class inplace_vector
+                            // ====================
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+class inplace_vector {
+    // This class template provides an STL-compliant 'inplace_vector' that
+    // holds at most (template parameter) 'CAPACITY' elements of (template
+    // parameter) type 'VALUE_TYPE' in storage embedded in the object.  See
+    // the component documentation for details.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ArrayPrimitives            ArrayPrimitives;
+    typedef BloombergLP::bslalg::ArrayDestructionPrimitives DestructionUtil;
+    typedef BloombergLP::bslma::ConstructionUtil            ConstructionUtil;
+    typedef BloombergLP::bslmf::MovableRefUtil              MoveUtil;
+
+    enum {
+        k_BUFFER_SIZE = sizeof(VALUE_TYPE) * (CAPACITY ? CAPACITY : 1),
+        k_ALIGNMENT   =
+                     BloombergLP::bsls::AlignmentFromType<VALUE_TYPE>::VALUE
+    };
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                             value_type;
+    typedef VALUE_TYPE&                            reference;
+    typedef const VALUE_TYPE&                      const_reference;
+    typedef VALUE_TYPE                            *pointer;
+    typedef const VALUE_TYPE                      *const_pointer;
+    typedef VALUE_TYPE                            *iterator;
+    typedef const VALUE_TYPE                      *const_iterator;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                         difference_type;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // DATA
+    BloombergLP::bsls::AlignedBuffer<k_BUFFER_SIZE, k_ALIGNMENT> d_buffer;
+                                                  // element storage
+
+    size_type                                     d_size;
+                                                  // number of elements
+
+    // PRIVATE MANIPULATORS
+    template <class INPUT_ITERATOR>
+    void appendRange(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Append the elements in the range specified by '[first .. last)' to
+        // the end of this vector.  Throw 'bsl::bad_alloc', and leave this
+        // vector unchanged, if the resulting size would exceed 'CAPACITY'.
+
+    void checkCapacity(size_type numElements) const;
+        // Throw 'bsl::bad_alloc' unless the specified 'numElements' additional
+        // elements fit in this vector.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(inplace_vector,
+                                   BloombergLP::bslalg::HasStlIterators);
+
+    BSLMF_NESTED_TRAIT_DECLARATION_IF(
+                   inplace_vector,
+                   BloombergLP::bslmf::IsBitwiseMoveable,
+                   BloombergLP::bslmf::IsBitwiseMoveable<VALUE_TYPE>::value);
+
+    // CLASS METHODS
+    static size_type capacity() BSLS_KEYWORD_NOEXCEPT;
+    static size_type max_size() BSLS_KEYWORD_NOEXCEPT;
+        // Return the (template parameter) 'CAPACITY', the maximum number of
+        // elements an object of this type can hold.
+
+    // CREATORS
+    inplace_vector() BSLS_KEYWORD_NOEXCEPT;
+        // Create an empty vector.
+
+    explicit inplace_vector(size_type initialSize);
+        // Create a vector of the specified 'initialSize' value-initialized
+        // elements.  Throw 'bsl::bad_alloc' if 'CAPACITY < initialSize'.
+
+    inplace_vector(size_type initialSize, const VALUE_TYPE& value);
+        // Create a vector of the specified 'initialSize' copies of the
+        // specified 'value'.  Throw 'bsl::bad_alloc' if
+        // 'CAPACITY < initialSize'.
+
+    template <class INPUT_ITERATOR>
+    inplace_vector(INPUT_ITERATOR first,
+                   INPUT_ITERATOR last,
+                   typename bsl::enable_if<
+                       !bsl::is_integral<INPUT_ITERATOR>::value>::type * = 0);
+        // Create a vector holding the elements in the range specified by
+        // '[first .. last)'.  Throw 'bsl::bad_alloc' if the range holds more
+        // than 'CAPACITY' elements.  The behavior is undefined unless
+        // '[first .. last)' is a valid range.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    inplace_vector(std::initializer_list<VALUE_TYPE> values);       // IMPLICIT
+        // Create a vector holding the specified 'values'.  Throw
+        // 'bsl::bad_alloc' if 'CAPACITY < values.size()'.
+#endif
+
+    inplace_vector(const inplace_vector& original);
+        // Create a vector having the same value as the specified 'original'
+        // vector.
+
+    inplace_vector(BloombergLP::bslmf::MovableRef<inplace_vector> original);
+        // Create a vector holding the elements of the specified 'original'
+        // vector, moved one by one.  'original' is left holding the same
+        // number of elements, each in a valid but unspecified state.
+
+    ~inplace_vector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    inplace_vector& operator=(const inplace_vector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    inplace_vector& operator=(
+                          BloombergLP::bslmf::MovableRef<inplace_vector> rhs);
+        // Assign to this object the elements of the specified 'rhs' object,
+        // moved one by one, and return a reference providing modifiable
+        // access to this object.  'rhs' is left holding the same number of
+        // elements, each in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    inplace_vector& operator=(std::initializer_list<VALUE_TYPE> values);
+        // Assign to this object the specified 'values', and return a
+        // reference providing modifiable access to this object.  Throw
+        // 'bsl::bad_alloc' if 'CAPACITY < values.size()'.
+#endif
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Assign to this object the specified 'numElements' copies of the
+        // specified 'value'.  Throw 'bsl::bad_alloc' if
+        // 'CAPACITY < numElements'.
+
+    template <class INPUT_ITERATOR>
+    typename bsl::enable_if<!bsl::is_integral<INPUT_ITERATOR>::value>::type
+    assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Assign to this object the elements in the range specified by
+        // '[first .. last)'.  Throw 'bsl::bad_alloc' if the range holds more
+        // than 'CAPACITY' elements.  The behavior is undefined unless
+        // '[first .. last)' is a valid range that does not refer to elements
+        // of this vector.
+
+                                 // Iterators
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator to the first element of this vector, or 'end()'
+        // if this vector is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator of this vector.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator to the last element of this vector, or
+        // 'rend()' if this vector is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator of this vector.
+
+                              // Element Access
+
+    reference operator[](size_type position);
+        // Return a reference to the element at the specified 'position'.  The
+        // behavior is undefined unless 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference to the element at the specified 'position'.
+        // Throw 'bsl::out_of_range' if 'size() <= position'.
+
+    reference front();
+        // Return a reference to the first element.  The behavior is undefined
+        // unless this vector is not empty.
+
+    reference back();
+        // Return a reference to the last element.  The behavior is undefined
+        // unless this vector is not empty.
+
+    VALUE_TYPE *data() BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the first element of this vector.
+
+                                 // Modifiers
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    template <class... ARGS>
+    reference emplace_back(ARGS&&... arguments);
+        // Append to the end of this vector an element constructed by
+        // forwarding the specified 'arguments' to the constructor of
+        // 'VALUE_TYPE', and return a reference to it.  Throw 'bsl::bad_alloc'
+        // if this vector is full.
+
+    template <class... ARGS>
+    VALUE_TYPE *try_emplace_back(ARGS&&... arguments);
+        // Append to the end of this vector an element constructed by
+        // forwarding the specified 'arguments' to the constructor of
+        // 'VALUE_TYPE', and return its address if this vector is not full;
+        // otherwise, return 0 with no effect.
+
+    template <class... ARGS>
+    reference unchecked_emplace_back(ARGS&&... arguments);
+        // Append to the end of this vector an element constructed by
+        // forwarding the specified 'arguments' to the constructor of
+        // 'VALUE_TYPE', and return a reference to it.  The behavior is
+        // undefined if this vector is full.
+
+    template <class... ARGS>
+    iterator emplace(const_iterator position, ARGS&&... arguments);
+        // Insert, at the specified 'position', an element constructed by
+        // forwarding the specified 'arguments' to the constructor of
+        // 'VALUE_TYPE', and return an iterator to it.  Throw 'bsl::bad_alloc'
+        // if this vector is full.  The behavior is undefined unless
+        // 'position' is in '[begin() .. end()]'.
+#endif
+
+    reference push_back(const VALUE_TYPE& value);
+    reference push_back(BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Append to the end of this vector the specified 'value' (copied or
+        // moved, as appropriate), and return a reference to the new element.
+        // Throw 'bsl::bad_alloc' if this vector is full.
+
+    VALUE_TYPE *try_push_back(const VALUE_TYPE& value);
+    VALUE_TYPE *try_push_back(
+                             BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Append to the end of this vector the specified 'value' (copied or
+        // moved, as appropriate), and return the address of the new element,
+        // if this vector is not full; otherwise, return 0 with no effect.
+
+    reference unchecked_push_back(const VALUE_TYPE& value);
+    reference unchecked_push_back(
+                             BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Append to the end of this vector the specified 'value' (copied or
+        // moved, as appropriate), and return a reference to the new element.
+        // The behavior is undefined if this vector is full.
+
+    void pop_back();
+        // Erase the last element of this vector.  The behavior is undefined
+        // if this vector is empty.
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+    iterator insert(const_iterator                             position,
+                    BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Insert the specified 'value' (copied or moved, as appropriate) at
+        // the specified 'position', and return an iterator to the new
+        // element.  Throw 'bsl::bad_alloc' if this vector is full.  The
+        // behavior is undefined unless 'position' is in '[begin() .. end()]'.
+
+    iterator insert(const_iterator    position,
+                    size_type         numElements,
+                    const VALUE_TYPE& value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // at the specified 'position', and return an iterator to the first
+        // new element, or 'position' if 'numElements' is 0.  Throw
+        // 'bsl::bad_alloc' if the resulting size would exceed 'CAPACITY'.
+        // The behavior is undefined unless 'position' is in
+        // '[begin() .. end()]'.
+
+    template <class INPUT_ITERATOR>
+    typename bsl::enable_if<!bsl::is_integral<INPUT_ITERATOR>::value,
+                            iterator>::type
+    insert(const_iterator position, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert the elements in the range specified by '[first .. last)' at
+        // the specified 'position', and return an iterator to the first new
+        // element, or 'position' if the range is empty.  Throw
+        // 'bsl::bad_alloc', and leave this vector unchanged, if the resulting
+        // size would exceed 'CAPACITY'.  The behavior is undefined unless
+        // 'position' is in '[begin() .. end()]' and '[first .. last)' is a
+        // valid range that does not refer to elements of this vector.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    iterator insert(const_iterator                    position,
+                    std::initializer_list<VALUE_TYPE> values);
+        // Insert the specified 'values' at the specified 'position', and
+        // return an iterator to the first new element, or 'position' if
+        // 'values' is empty.  Throw 'bsl::bad_alloc', and leave this vector
+        // unchanged, if the resulting size would exceed 'CAPACITY'.  The
+        // behavior is undefined unless 'position' is in '[begin() .. end()]'.
+#endif
+
+    iterator erase(const_iterator position);
+        // Erase the element at the specified 'position', and return an
+        // iterator to the element that followed it.  The behavior is
+        // undefined unless 'position' is in '[begin() .. end())'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the elements in the range specified by '[first .. last)', and
+        // return an iterator to the element that followed them.  The behavior
+        // is undefined unless '[first .. last)' is a valid range of elements
+        // of this vector.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Erase all elements of this vector.
+
+    void resize(size_type newSize);
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end or appending value-initialized elements or
+        // copies of the optionally specified 'value', as necessary.  Throw
+        // 'bsl::bad_alloc' if 'CAPACITY < newSize'.
+
+    void reserve(size_type newCapacity);
+        // Throw 'bsl::bad_alloc' if 'CAPACITY < newCapacity', and otherwise
+        // have no effect.
+
+    void shrink_to_fit() BSLS_KEYWORD_NOEXCEPT;
+        // Have no effect.  Note that this method is provided for
+        // compatibility with 'bsl::vector'.
+
+    void swap(inplace_vector& other);
+        // Exchange the value of this object with that of the specified
+        // 'other' object.  Note that this operation swaps or moves each
+        // element, and so takes linear time and invalidates iterators.
+
+    // ACCESSORS
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // element of this vector, or 'end()' if this vector is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this vector.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element of this vector, or 'rend()' if this vector is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this vector.
+
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position'.  The behavior is undefined unless
+        // 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position'.  Throw 'bsl::out_of_range' if
+        // 'size() <= position'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element.  The behavior is undefined unless this vector is not
+        // empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element.  The behavior is undefined unless this vector is not
+        // empty.
+
+    const VALUE_TYPE *data() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the address providing non-modifiable access to the first
+        // element of this vector.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this vector has no elements, and 'false'
+        // otherwise.
+
+    bool full() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this vector holds 'CAPACITY' elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this vector.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t CAPACITY>
+bool operator==(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                const inplace_vector<VALUE_TYPE, CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'inplace_vector' objects have the
+    // same value if they have the same size and each element of one is equal
+    // to the element at the same position in the other.
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+bool operator!=(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                const inplace_vector<VALUE_TYPE, CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'inplace_vector' objects do not
+    // have the same value if they do not have the same size or some element
+    // of one is not equal to the element at the same position in the other.
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+bool operator<(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+               const inplace_vector<VALUE_TYPE, CAPACITY>& rhs);
+template <class VALUE_TYPE, std::size_t CAPACITY>
+bool operator>(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+               const inplace_vector<VALUE_TYPE, CAPACITY>& rhs);
+template <class VALUE_TYPE, std::size_t CAPACITY>
+bool operator<=(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                const inplace_vector<VALUE_TYPE, CAPACITY>& rhs);
+template <class VALUE_TYPE, std::size_t CAPACITY>
+bool operator>=(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                const inplace_vector<VALUE_TYPE, CAPACITY>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than, greater than, less than or equal to, or
+    // greater than or equal to (respectively) the value of the specified
+    // 'rhs' vector, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t CAPACITY, class BDE_OTHER_TYPE>
+typename inplace_vector<VALUE_TYPE, CAPACITY>::size_type
+erase(inplace_vector<VALUE_TYPE, CAPACITY>& vec, const BDE_OTHER_TYPE& value);
+    // Erase all the elements in the specified vector 'vec' that compare equal
+    // to the specified 'value'.  Return the number of elements erased.
+
+template <class VALUE_TYPE, std::size_t CAPACITY, class PREDICATE>
+typename inplace_vector<VALUE_TYPE, CAPACITY>::size_type
+erase_if(inplace_vector<VALUE_TYPE, CAPACITY>& vec, PREDICATE predicate);
+    // Erase all the elements in the specified vector 'vec' that satisfy the
+    // specified predicate 'predicate'.  Return the number of elements erased.
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+void swap(inplace_vector<VALUE_TYPE, CAPACITY>& a,
+          inplace_vector<VALUE_TYPE, CAPACITY>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.
+
+// ============================================================================
+//                       TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class InplaceVector_TailProctor
+                      // -------------------------------
+
+// CREATORS
+template <class VALUE_TYPE>
+inline
+InplaceVector_TailProctor<VALUE_TYPE>::InplaceVector_TailProctor(
+                                                      VALUE_TYPE  *data,
+                                                      std::size_t *size)
+: d_data_p(data)
+, d_size_p(size)
+, d_oldSize(*size)
+{
+}
+
+template <class VALUE_TYPE>
+inline
+InplaceVector_TailProctor<VALUE_TYPE>::~InplaceVector_TailProctor()
+{
+    if (d_size_p) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                      d_data_p + d_oldSize,
+                                                      d_data_p + *d_size_p);
+        *d_size_p = d_oldSize;
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE>
+inline
+void InplaceVector_TailProctor<VALUE_TYPE>::release()
+{
+    d_size_p = 0;
+}
+
+                            // --------------------
+                            // class inplace_vector
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, std::size_t CAPACITY>
+template <class INPUT_ITERATOR>
+void inplace_vector<VALUE_TYPE, CAPACITY>::appendRange(INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last)
+{
+    InplaceVector_TailProctor<VALUE_TYPE> proctor(data(), &d_size);
+
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+    proctor.release();
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+void inplace_vector<VALUE_TYPE, CAPACITY>::checkCapacity(
+                                                  size_type numElements) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(CAPACITY - d_size <
+                                                               numElements)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bsls::BslExceptionUtil::throwBadAlloc();
+    }
+}
+
+// CLASS METHODS
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::size_type
+inplace_vector<VALUE_TYPE, CAPACITY>::capacity() BSLS_KEYWORD_NOEXCEPT
+{
+    return CAPACITY;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::size_type
+inplace_vector<VALUE_TYPE, CAPACITY>::max_size() BSLS_KEYWORD_NOEXCEPT
+{
+    return CAPACITY;
+}
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+inplace_vector<VALUE_TYPE, CAPACITY>::inplace_vector() BSLS_KEYWORD_NOEXCEPT
+: d_size(0)
+{
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inplace_vector<VALUE_TYPE, CAPACITY>::inplace_vector(size_type initialSize)
+: d_size(0)
+{
+    resize(initialSize);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inplace_vector<VALUE_TYPE, CAPACITY>::inplace_vector(size_type initialSize,
+                                                     const VALUE_TYPE& value)
+: d_size(0)
+{
+    resize(initialSize, value);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+template <class INPUT_ITERATOR>
+inplace_vector<VALUE_TYPE, CAPACITY>::inplace_vector(
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last,
+                typename bsl::enable_if<
+                            !bsl::is_integral<INPUT_ITERATOR>::value>::type *)
+: d_size(0)
+{
+    appendRange(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inplace_vector<VALUE_TYPE, CAPACITY>::inplace_vector(
+                                      std::initializer_list<VALUE_TYPE> values)
+: d_size(0)
+{
+    checkCapacity(values.size());
+    ArrayPrimitives::copyConstruct(data(),
+                                   values.begin(),
+                                   values.end(),
+                                   (BloombergLP::bslma::Allocator *)0);
+    d_size = values.size();
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inplace_vector<VALUE_TYPE, CAPACITY>::inplace_vector(
+                                                const inplace_vector& original)
+: d_size(0)
+{
+    ArrayPrimitives::copyConstruct(data(),
+                                   original.begin(),
+                                   original.end(),
+                                   (BloombergLP::bslma::Allocator *)0);
+    d_size = original.d_size;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inplace_vector<VALUE_TYPE, CAPACITY>::inplace_vector(
+                      BloombergLP::bslmf::MovableRef<inplace_vector> original)
+: d_size(0)
+{
+    inplace_vector& lvalue = original;
+
+    ArrayPrimitives::moveConstruct(data(),
+                                   lvalue.begin(),
+                                   lvalue.end(),
+                                   (BloombergLP::bslma::Allocator *)0);
+    d_size = lvalue.d_size;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+inplace_vector<VALUE_TYPE, CAPACITY>::~inplace_vector()
+{
+    DestructionUtil::destroy(begin(), end());
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inplace_vector<VALUE_TYPE, CAPACITY>&
+inplace_vector<VALUE_TYPE, CAPACITY>::operator=(const inplace_vector& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        ArrayPrimitives::copyConstruct(data(),
+                                       rhs.begin(),
+                                       rhs.end(),
+                                       (BloombergLP::bslma::Allocator *)0);
+        d_size = rhs.d_size;
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inplace_vector<VALUE_TYPE, CAPACITY>&
+inplace_vector<VALUE_TYPE, CAPACITY>::operator=(
+                           BloombergLP::bslmf::MovableRef<inplace_vector> rhs)
+{
+    inplace_vector& lvalue = rhs;
+
+    if (this != &lvalue) {
+        clear();
+        ArrayPrimitives::moveConstruct(data(),
+                                       lvalue.begin(),
+                                       lvalue.end(),
+                                       (BloombergLP::bslma::Allocator *)0);
+        d_size = lvalue.d_size;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+inplace_vector<VALUE_TYPE, CAPACITY>&
+inplace_vector<VALUE_TYPE, CAPACITY>::operator=(
+                                      std::initializer_list<VALUE_TYPE> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+void inplace_vector<VALUE_TYPE, CAPACITY>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    if (CAPACITY < numElements) {
+        BloombergLP::bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    // 'value' may refer to an element of this vector, so assign over the
+    // common prefix before erasing any element.
+
+    const size_type common = numElements < d_size ? numElements : d_size;
+    std::fill(begin(), begin() + common, value);
+    if (numElements < d_size) {
+        erase(begin() + numElements, end());
+    }
+    else {
+        resize(numElements, value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+typename bsl::enable_if<!bsl::is_integral<INPUT_ITERATOR>::value>::type
+inplace_vector<VALUE_TYPE, CAPACITY>::assign(INPUT_ITERATOR first,
+                                             INPUT_ITERATOR last)
+{
+    clear();
+    appendRange(first, last);
+}
+
+                                 // Iterators
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return data();
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return data() + d_size;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reverse_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::rbegin() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reverse_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+                              // Element Access
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::operator[](size_type position)
+{
+    BSLS_ASSERT_SAFE(position < d_size);
+
+    return data()[position];
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_size <= position)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                               "inplace_vector<...>::at(n): invalid position");
+    }
+    return data()[position];
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *data();
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return data()[d_size - 1];
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+VALUE_TYPE *inplace_vector<VALUE_TYPE, CAPACITY>::data() BSLS_KEYWORD_NOEXCEPT
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_buffer.buffer());
+}
+
+                                 // Modifiers
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class VALUE_TYPE, std::size_t CAPACITY>
+template <class... ARGS>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::emplace_back(ARGS&&... arguments)
+{
+    checkCapacity(1);
+    return unchecked_emplace_back(
+                           BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+template <class... ARGS>
+inline
+VALUE_TYPE *
+inplace_vector<VALUE_TYPE, CAPACITY>::try_emplace_back(ARGS&&... arguments)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(full())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+    return &unchecked_emplace_back(
+                           BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+template <class... ARGS>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::unchecked_emplace_back(
+                                                         ARGS&&... arguments)
+{
+    BSLS_ASSERT_SAFE(!full());
+
+    VALUE_TYPE *address = end();
+    ConstructionUtil::construct(
+                            address,
+                            (BloombergLP::bslma::Allocator *)0,
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    ++d_size;
+    return *address;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+template <class... ARGS>
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::emplace(const_iterator position,
+                                              ARGS&&...      arguments)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    checkCapacity(1);
+
+    iterator pos = begin() + (position - cbegin());
+    ArrayPrimitives::emplace(
+                            pos,
+                            end(),
+                            (BloombergLP::bslma::Allocator *)0,
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    ++d_size;
+    return pos;
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::push_back(const VALUE_TYPE& value)
+{
+    checkCapacity(1);
+    return unchecked_push_back(value);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::push_back(
+                              BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    checkCapacity(1);
+    return unchecked_push_back(MoveUtil::move(value));
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+VALUE_TYPE *
+inplace_vector<VALUE_TYPE, CAPACITY>::try_push_back(const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(full())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+    return &unchecked_push_back(value);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+VALUE_TYPE *inplace_vector<VALUE_TYPE, CAPACITY>::try_push_back(
+                              BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(full())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+    return &unchecked_push_back(MoveUtil::move(value));
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::unchecked_push_back(
+                                                       const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(!full());
+
+    VALUE_TYPE *address = end();
+    ConstructionUtil::construct(address,
+                                (BloombergLP::bslma::Allocator *)0,
+                                value);
+    ++d_size;
+    return *address;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::reference
+inplace_vector<VALUE_TYPE, CAPACITY>::unchecked_push_back(
+                              BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    BSLS_ASSERT_SAFE(!full());
+
+    VALUE_TYPE *address = end();
+    ConstructionUtil::construct(address,
+                                (BloombergLP::bslma::Allocator *)0,
+                                MoveUtil::move(value));
+    ++d_size;
+    return *address;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+void inplace_vector<VALUE_TYPE, CAPACITY>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_size;
+    BloombergLP::bslma::DestructionUtil::destroy(end());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::insert(const_iterator    position,
+                                             const VALUE_TYPE& value)
+{
+    return insert(position, size_type(1), value);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::insert(
+                           const_iterator                             position,
+                           BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    checkCapacity(1);
+
+    iterator pos = begin() + (position - cbegin());
+    ArrayPrimitives::insert(pos,
+                            end(),
+                            MoveUtil::move(value),
+                            (BloombergLP::bslma::Allocator *)0);
+    ++d_size;
+    return pos;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::insert(const_iterator    position,
+                                             size_type         numElements,
+                                             const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    checkCapacity(numElements);
+
+    iterator pos = begin() + (position - cbegin());
+    ArrayPrimitives::insert(pos,
+                            end(),
+                            value,
+                            numElements,
+                            (BloombergLP::bslma::Allocator *)0);
+    d_size += numElements;
+    return pos;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+template <class INPUT_ITERATOR>
+typename bsl::enable_if<
+    !bsl::is_integral<INPUT_ITERATOR>::value,
+    typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator>::type
+inplace_vector<VALUE_TYPE, CAPACITY>::insert(const_iterator position,
+                                             INPUT_ITERATOR first,
+                                             INPUT_ITERATOR last)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    // Append the new elements, then rotate them into place; this supports
+    // single-pass input iterators, and leaves this vector unchanged if the
+    // capacity is exceeded.
+
+    iterator        pos     = begin() + (position - cbegin());
+    const size_type oldSize = d_size;
+
+    appendRange(first, last);
+    ArrayPrimitives::rotate(pos, begin() + oldSize, end());
+    return pos;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::insert(
+                                   const_iterator                    position,
+                                   std::initializer_list<VALUE_TYPE> values)
+{
+    return insert(position, values.begin(), values.end());
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position < end());
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+typename inplace_vector<VALUE_TYPE, CAPACITY>::iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    BSLS_ASSERT_SAFE(begin() <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= end());
+
+    iterator        pos         = begin() + (first - cbegin());
+    const size_type numElements = last - first;
+
+    ArrayPrimitives::erase(pos,
+                           pos + numElements,
+                           end(),
+                           (BloombergLP::bslma::Allocator *)0);
+    d_size -= numElements;
+    return pos;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+void inplace_vector<VALUE_TYPE, CAPACITY>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    DestructionUtil::destroy(begin(), end());
+    d_size = 0;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+void inplace_vector<VALUE_TYPE, CAPACITY>::resize(size_type newSize)
+{
+    if (newSize <= d_size) {
+        DestructionUtil::destroy(begin() + newSize, end());
+    }
+    else {
+        checkCapacity(newSize - d_size);
+        ArrayPrimitives::defaultConstruct(end(),
+                                          newSize - d_size,
+                                          (BloombergLP::bslma::Allocator *)0);
+    }
+    d_size = newSize;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+void inplace_vector<VALUE_TYPE, CAPACITY>::resize(size_type         newSize,
+                                                  const VALUE_TYPE& value)
+{
+    if (newSize <= d_size) {
+        DestructionUtil::destroy(begin() + newSize, end());
+    }
+    else {
+        checkCapacity(newSize - d_size);
+        ArrayPrimitives::uninitializedFillN(
+                                          end(),
+                                          newSize - d_size,
+                                          value,
+                                          (BloombergLP::bslma::Allocator *)0);
+    }
+    d_size = newSize;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+void inplace_vector<VALUE_TYPE, CAPACITY>::reserve(size_type newCapacity)
+{
+    if (CAPACITY < newCapacity) {
+        BloombergLP::bsls::BslExceptionUtil::throwBadAlloc();
+    }
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+void
+inplace_vector<VALUE_TYPE, CAPACITY>::shrink_to_fit() BSLS_KEYWORD_NOEXCEPT
+{
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+void inplace_vector<VALUE_TYPE, CAPACITY>::swap(inplace_vector& other)
+{
+    inplace_vector *shorter = d_size < other.d_size ? this : &other;
+    inplace_vector *longer  = d_size < other.d_size ? &other : this;
+
+    const size_type common = shorter->d_size;
+    for (size_type i = 0; i < common; ++i) {
+        BloombergLP::bslalg::SwapUtil::swap(shorter->data() + i,
+                                            longer->data() + i);
+    }
+
+    // Relocate the excess elements of the longer vector.
+
+    ArrayPrimitives::destructiveMove(shorter->end(),
+                                     longer->begin() + common,
+                                     longer->end(),
+                                     (BloombergLP::bslma::Allocator *)0);
+    shorter->d_size = longer->d_size;
+    longer->d_size  = common;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return data();
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return data();
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return data() + d_size;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return data() + d_size;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_reverse_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_reverse_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::crbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_reverse_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_reverse_iterator
+inplace_vector<VALUE_TYPE, CAPACITY>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_reference
+inplace_vector<VALUE_TYPE, CAPACITY>::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < d_size);
+
+    return data()[position];
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_reference
+inplace_vector<VALUE_TYPE, CAPACITY>::at(size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_size <= position)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                         "inplace_vector<...>::at(n) const: invalid position");
+    }
+    return data()[position];
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_reference
+inplace_vector<VALUE_TYPE, CAPACITY>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *data();
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::const_reference
+inplace_vector<VALUE_TYPE, CAPACITY>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return data()[d_size - 1];
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+const VALUE_TYPE *
+inplace_vector<VALUE_TYPE, CAPACITY>::data() const BSLS_KEYWORD_NOEXCEPT
+{
+    return reinterpret_cast<const VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+bool inplace_vector<VALUE_TYPE, CAPACITY>::empty() const BSLS_KEYWORD_NOEXCEPT
+{
+    return 0 == d_size;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+bool inplace_vector<VALUE_TYPE, CAPACITY>::full() const BSLS_KEYWORD_NOEXCEPT
+{
+    return CAPACITY == d_size;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+typename inplace_vector<VALUE_TYPE, CAPACITY>::size_type
+inplace_vector<VALUE_TYPE, CAPACITY>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_size;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator==(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                     const inplace_vector<VALUE_TYPE, CAPACITY>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator!=(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                     const inplace_vector<VALUE_TYPE, CAPACITY>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator<(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                    const inplace_vector<VALUE_TYPE, CAPACITY>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator>(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                    const inplace_vector<VALUE_TYPE, CAPACITY>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator<=(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                     const inplace_vector<VALUE_TYPE, CAPACITY>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+bool bsl::operator>=(const inplace_vector<VALUE_TYPE, CAPACITY>& lhs,
+                     const inplace_vector<VALUE_TYPE, CAPACITY>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t CAPACITY, class BDE_OTHER_TYPE>
+inline
+typename bsl::inplace_vector<VALUE_TYPE, CAPACITY>::size_type
+bsl::erase(inplace_vector<VALUE_TYPE, CAPACITY>& vec,
+           const BDE_OTHER_TYPE&                 value)
+{
+    typename inplace_vector<VALUE_TYPE, CAPACITY>::size_type oldSize =
+                                                                    vec.size();
+    vec.erase(std::remove(vec.begin(), vec.end(), value), vec.end());
+    return oldSize - vec.size();
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY, class PREDICATE>
+inline
+typename bsl::inplace_vector<VALUE_TYPE, CAPACITY>::size_type
+bsl::erase_if(inplace_vector<VALUE_TYPE, CAPACITY>& vec, PREDICATE predicate)
+{
+    typename inplace_vector<VALUE_TYPE, CAPACITY>::size_type oldSize =
+                                                                    vec.size();
+    vec.erase(std::remove_if(vec.begin(), vec.end(), predicate), vec.end());
+    return oldSize - vec.size();
+}
+
+template <class VALUE_TYPE, std::size_t CAPACITY>
+inline
+void bsl::swap(inplace_vector<VALUE_TYPE, CAPACITY>& a,
+               inplace_vector<VALUE_TYPE, CAPACITY>& b)
+{
+    a.swap(b);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1246 @@
+// bslstl_inplacevector.t.cpp                                         -*-C++-*-
+#include <bslstl_inplacevector.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <algorithm>
+#include <new>          // 'std::bad_alloc'
+#include <stdexcept>    // 'std::out_of_range'
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The object under test is a sequence container whose interface and contract
+// are dictated by the C++26 standard.  Since 'bsl::vector' provides the same
+// sequence operations with the same semantics, most test cases compare the
+// state of an 'inplace_vector' with that of a 'bsl::vector' (the *model*)
+// after applying the same sequence of operations to both.  The concerns
+// specific to this component are that the capacity is never exceeded (an
+// attempt throws 'bsl::bad_alloc' and has no effect), that no memory is ever
+// allocated by the container, and that every element constructed is
+// destroyed exactly once.  The latter is verified with the 'Counted' helper
+// type, which tracks the number of live objects, and with 'bsl::string',
+// which allocates from the default allocator.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static size_type capacity();
+// [ 2] static size_type max_size();
+//
+// CREATORS
+// [ 2] inplace_vector();
+// [ 3] inplace_vector(size_type initialSize);
+// [ 3] inplace_vector(size_type initialSize, const VALUE_TYPE& value);
+// [ 3] inplace_vector(ITER first, ITER last);
+// [ 3] inplace_vector(initializer_list<VALUE_TYPE> values);
+// [ 3] inplace_vector(const inplace_vector& original);
+// [ 3] inplace_vector(MovableRef<inplace_vector> original);
+// [ 2] ~inplace_vector();
+//
+// MANIPULATORS
+// [ 3] inplace_vector& operator=(const inplace_vector& rhs);
+// [ 3] inplace_vector& operator=(MovableRef<inplace_vector> rhs);
+// [ 3] inplace_vector& operator=(initializer_list<VALUE_TYPE> values);
+// [ 3] void assign(size_type numElements, const VALUE_TYPE& value);
+// [ 3] void assign(ITER first, ITER last);
+// [ 2] reference emplace_back(Args&&...);
+// [ 2] VALUE_TYPE *try_emplace_back(Args&&...);
+// [ 2] reference unchecked_emplace_back(Args&&...);
+// [ 4] iterator emplace(const_iterator position, Args&&...);
+// [ 2] reference push_back(const VALUE_TYPE& value);
+// [ 2] reference push_back(MovableRef<VALUE_TYPE> value);
+// [ 2] VALUE_TYPE *try_push_back(const VALUE_TYPE& value);
+// [ 2] VALUE_TYPE *try_push_back(MovableRef<VALUE_TYPE> value);
+// [ 2] reference unchecked_push_back(const VALUE_TYPE& value);
+// [ 2] reference unchecked_push_back(MovableRef<VALUE_TYPE> value);
+// [ 2] void pop_back();
+// [ 4] iterator insert(const_iterator position, const VALUE_TYPE& value);
+// [ 4] iterator insert(const_iterator position, MovableRef<VALUE_TYPE> v);
+// [ 4] iterator insert(const_iterator position, size_type n, const V& v);
+// [ 4] iterator insert(const_iterator position, ITER first, ITER last);
+// [ 4] iterator insert(const_iterator position, initializer_list<V>);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 2] void clear();
+// [ 5] void resize(size_type newSize);
+// [ 5] void resize(size_type newSize, const VALUE_TYPE& value);
+// [ 5] void reserve(size_type newCapacity);
+// [ 5] void shrink_to_fit();
+// [ 5] void swap(inplace_vector& other);
+//
+// ACCESSORS
+// [ 2] reference operator[](size_type position);
+// [ 5] reference at(size_type position);
+// [ 2] reference front();
+// [ 2] reference back();
+// [ 2] VALUE_TYPE *data();
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] bool empty() const;
+// [ 2] bool full() const;
+// [ 2] size_type size() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const inplace_vector&, const inplace_vector&);
+// [ 5] bool operator<(const inplace_vector&, const inplace_vector&);
+//
+// FREE FUNCTIONS
+// [ 5] size_type erase(inplace_vector&, const OTHER&);
+// [ 5] size_type erase_if(inplace_vector&, PREDICATE);
+// [ 5] void swap(inplace_vector&, inplace_vector&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 2] CONCERN: Trait 'IsBitwiseMoveable' follows 'VALUE_TYPE'.
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bslmf::MovableRefUtil MoveUtil;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+const char *const LONG_STRING = "This string is long enough to allocate.";
+
+class Counted {
+    // This class holds an 'int' value, and tracks the number of objects of
+    // the class that are alive.
+
+    // CLASS DATA
+    static int s_numAlive;
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS METHODS
+    static int numAlive()
+        // Return the number of 'Counted' objects currently alive.
+    {
+        return s_numAlive;
+    }
+
+    // CREATORS
+    Counted() : d_value(0) { ++s_numAlive; }
+        // Create an object having the value 0.
+
+    Counted(int value) : d_value(value) { ++s_numAlive; }           // IMPLICIT
+        // Create an object having the specified 'value'.
+
+    Counted(const Counted& original) : d_value(original.d_value)
+        // Create an object having the value of the specified 'original'.
+    {
+        ++s_numAlive;
+    }
+
+    ~Counted()
+        // Destroy this object.
+    {
+        ASSERT(0 < s_numAlive);
+        --s_numAlive;
+        d_value = -1;
+    }
+
+    // MANIPULATORS
+    Counted& operator=(const Counted& rhs)
+        // Assign to this object the value of the specified 'rhs', and return
+        // a reference providing modifiable access to this object.
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+int Counted::s_numAlive = 0;
+
+bool operator==(const Counted& lhs, const Counted& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same value, and
+    // 'false' otherwise.
+{
+    return lhs.value() == rhs.value();
+}
+
+class RandomGenerator {
+    // This class provides a deterministic linear congruential generator, so
+    // that test sequences are reproducible on every platform.
+
+    // DATA
+    unsigned d_state;
+
+  public:
+    // CREATORS
+    explicit RandomGenerator(unsigned seed = 1) : d_state(seed) {}
+        // Create a generator having the specified 'seed'.
+
+    // MANIPULATORS
+    int operator()(int modulus)
+        // Return the next pseudo-random number in the range
+        // '[0 .. modulus - 1]'.
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        return static_cast<int>((d_state >> 8) % modulus);
+    }
+};
+
+template <class OBJECT, class MODEL>
+bool isEqual(const OBJECT& object, const MODEL& model)
+    // Return 'true' if the specified 'object' holds the same sequence of
+    // elements as the specified 'model', and 'false' otherwise.
+{
+    return object.size() == model.size()
+        && std::equal(object.begin(), object.end(), model.begin());
+}
+
+bool isOdd(int value)
+    // Return 'true' if the specified 'value' is odd, and 'false' otherwise.
+{
+    return value % 2;
+}
+
+template <class ITERATOR>
+class InputIterator {
+    // This class adapts the (template parameter) 'ITERATOR' to provide only
+    // the operations of an input iterator, so that tests can verify that
+    // single-pass ranges are supported.
+
+    // DATA
+    ITERATOR d_it;
+
+  public:
+    // TYPES
+    typedef bsl::iterator_traits<ITERATOR>         Traits;
+
+    typedef std::input_iterator_tag                iterator_category;
+    typedef typename Traits::value_type            value_type;
+    typedef typename Traits::difference_type       difference_type;
+    typedef typename Traits::pointer               pointer;
+    typedef typename Traits::reference             reference;
+
+    // CREATORS
+    explicit InputIterator(ITERATOR it) : d_it(it) {}
+        // Create an iterator adapting the specified 'it'.
+
+    // MANIPULATORS
+    InputIterator& operator++()
+        // Advance this iterator, and return a reference providing modifiable
+        // access to it.
+    {
+        ++d_it;
+        return *this;
+    }
+
+    // ACCESSORS
+    reference operator*() const
+        // Return the element referred to by this iterator.
+    {
+        return *d_it;
+    }
+
+    bool operator!=(const InputIterator& rhs) const
+        // Return 'true' if this iterator does not refer to the same position
+        // as the specified 'rhs', and 'false' otherwise.
+    {
+        return d_it != rhs.d_it;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting the Digits of a Number
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need the decimal digits of an 'unsigned int', most significant
+// first.  There are at most ten of them, so we can collect them into an
+// 'inplace_vector' and avoid any allocation.
+//
+// First, we define the function:
+//..
+    typedef bsl::inplace_vector<char, 10> Digits;
+
+    Digits toDigits(unsigned int value)
+        // Return the decimal digits of the specified 'value', most
+        // significant first.
+    {
+        Digits result;
+        do {
+            result.push_back(static_cast<char>('0' + value % 10));
+            value /= 10;
+        } while (value);
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+//..
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we call the function:
+//..
+    Digits digits = toDigits(4096);
+//..
+// Finally, we examine the result:
+//..
+    ASSERT(4   == digits.size());
+    ASSERT(10  == digits.capacity());
+    ASSERT('4' == digits.front());
+    ASSERT('6' == digits.back());
+//..
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RESIZE, SWAP, COMPARISON, AND FREE FUNCTIONS
+        //
+        // Concerns:
+        //: 1 'resize' appends value-initialized elements or copies of the
+        //:   supplied value, or destroys trailing elements, and throws
+        //:   'bsl::bad_alloc' with no effect if the capacity is exceeded.
+        //:
+        //: 2 'reserve' throws 'bsl::bad_alloc' only if the requested capacity
+        //:   exceeds 'CAPACITY', and 'shrink_to_fit' has no effect.
+        //:
+        //: 3 'swap' exchanges the values of vectors of any sizes, including
+        //:   allocating elements, without leaking or double-destroying.
+        //:
+        //: 4 The equality and relational operators compare values
+        //:   lexicographically.
+        //:
+        //: 5 'at' throws 'bsl::out_of_range' for an invalid position.
+        //:
+        //: 6 'erase' and 'erase_if' remove exactly the matching elements.
+        //
+        // Plan:
+        //: 1 Resize vectors up and down, with and without a value, and
+        //:   compare with the model.  (C-1)
+        //:
+        //: 2 Call 'reserve' and 'shrink_to_fit' and verify the results.
+        //:   (C-2)
+        //:
+        //: 3 Swap vectors of every pair of sizes holding 'bsl::string'
+        //:   elements and verify the values and the live object count.  (C-3)
+        //:
+        //: 4 Compare vectors built from a table of specifications against
+        //:   each other, and verify that the results agree with those of the
+        //:   model.  (C-4)
+        //:
+        //: 5 Call 'at' with valid and invalid positions.  (C-5)
+        //:
+        //: 6 Apply 'erase' and 'erase_if' and verify the results.  (C-6)
+        //
+        // Testing:
+        //   void resize(size_type newSize);
+        //   void resize(size_type newSize, const VALUE_TYPE& value);
+        //   void reserve(size_type newCapacity);
+        //   void shrink_to_fit();
+        //   void swap(inplace_vector& other);
+        //   reference at(size_type position);
+        //   bool operator==(const inplace_vector&, const inplace_vector&);
+        //   bool operator<(const inplace_vector&, const inplace_vector&);
+        //   size_type erase(inplace_vector&, const OTHER&);
+        //   size_type erase_if(inplace_vector&, PREDICATE);
+        //   void swap(inplace_vector&, inplace_vector&);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+                    printf("\nRESIZE, SWAP, COMPARISON, AND FREE FUNCTIONS"
+                           "\n============================================\n");
+
+        typedef bsl::inplace_vector<int, 8> Obj;
+
+        if (verbose) printf("\t'resize', 'reserve', and 'shrink_to_fit'.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.resize(3);
+            ASSERT(3 == X.size());
+            ASSERT(0 == X[0] && 0 == X[2]);
+
+            mX.resize(6, 7);
+            ASSERT(6 == X.size());
+            ASSERT(0 == X[2] && 7 == X[3] && 7 == X[5]);
+
+            mX.resize(2, 9);
+            ASSERT(2 == X.size());
+            ASSERT(0 == X[1]);
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                mX.resize(9);
+            }
+            catch (const std::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(2 == X.size());
+
+            caught = false;
+            try {
+                mX.reserve(9);
+            }
+            catch (const std::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+            mX.reserve(8);
+            mX.shrink_to_fit();
+            ASSERT(2 == X.size());
+            ASSERT(8 == X.capacity());
+        }
+
+        if (verbose) printf("\t'swap'.\n");
+        {
+            typedef bsl::inplace_vector<bsl::string, 5> SObj;
+
+            for (int i = 0; i <= 5; ++i) {
+                for (int j = 0; j <= 5; ++j) {
+                    SObj mX;  const SObj& X = mX;
+                    SObj mY;  const SObj& Y = mY;
+                    bsl::vector<bsl::string> mMX, mMY;
+
+                    for (int k = 0; k < i; ++k) {
+                        bsl::string s(LONG_STRING);
+                        s.push_back(static_cast<char>('a' + k));
+                        mX.push_back(s);
+                        mMX.push_back(s);
+                    }
+                    for (int k = 0; k < j; ++k) {
+                        bsl::string s(LONG_STRING);
+                        s.push_back(static_cast<char>('A' + k));
+                        mY.push_back(s);
+                        mMY.push_back(s);
+                    }
+
+                    mX.swap(mY);
+                    ASSERTV(i, j, isEqual(X, mMY));
+                    ASSERTV(i, j, isEqual(Y, mMX));
+
+                    bsl::swap(mX, mY);
+                    ASSERTV(i, j, isEqual(X, mMX));
+                    ASSERTV(i, j, isEqual(Y, mMY));
+                }
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tComparison.\n");
+        {
+            static const char *SPECS[] = {
+                "", "A", "B", "AA", "AB", "BA", "ABC", "ABD", "ABCD",
+            };
+            const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+            for (int ti = 0; ti < NUM_SPECS; ++ti) {
+                const char *SI = SPECS[ti];
+                const Obj   X(SI, SI + strlen(SI));
+                const bsl::vector<int> MX(SI, SI + strlen(SI));
+
+                for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                    const char *SJ = SPECS[tj];
+                    const Obj   Y(SJ, SJ + strlen(SJ));
+                    const bsl::vector<int> MY(SJ, SJ + strlen(SJ));
+
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                    ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                    ASSERTV(ti, tj, (MX <  MY) == (X <  Y));
+                    ASSERTV(ti, tj, (MX >  MY) == (X >  Y));
+                    ASSERTV(ti, tj, (MX <= MY) == (X <= Y));
+                    ASSERTV(ti, tj, (MX >= MY) == (X >= Y));
+                }
+            }
+        }
+
+        if (verbose) printf("\t'at'.\n");
+        {
+            Obj mX(3, 5);  const Obj& X = mX;
+
+            mX.at(2) = 6;
+            ASSERT(6 == X.at(2));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                X.at(3);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+
+        if (verbose) printf("\t'erase' and 'erase_if'.\n");
+        {
+            const int DATA[] = { 1, 2, 3, 2, 5, 2, 7, 8 };
+            Obj mX(DATA, DATA + 8);  const Obj& X = mX;
+
+            ASSERT(3 == bsl::erase(mX, 2));
+            ASSERT(5 == X.size());
+            ASSERT(0 == bsl::erase(mX, 2));
+
+            ASSERT(4 == bsl::erase_if(mX, isOdd));
+            ASSERT(1 == X.size());
+            ASSERT(8 == X[0]);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERT, EMPLACE, AND ERASE
+        //
+        // Concerns:
+        //: 1 Each insertion method inserts the elements at the position, and
+        //:   returns an iterator to the first inserted element.
+        //:
+        //: 2 Each 'erase' method removes the designated elements, and returns
+        //:   an iterator to the element that followed them.
+        //:
+        //: 3 An inserted value may refer to an element of the vector.
+        //:
+        //: 4 Insertion beyond the capacity throws 'bsl::bad_alloc' and leaves
+        //:   the vector unchanged.
+        //:
+        //: 5 Every element constructed is destroyed exactly once.
+        //:
+        //: 6 Both bitwise-moveable and other element types are supported.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of insertions and erasures to an
+        //:   'inplace_vector<int, N>' and to the model, including insertions
+        //:   of values referring to elements of the vector, comparing the two
+        //:   after each step, and verifying the returned iterators.  When an
+        //:   insertion would exceed the capacity, verify that 'bad_alloc' is
+        //:   thrown and the vector is unchanged.  (C-1..4)
+        //:
+        //: 2 Repeat P-1 with the element type 'Counted', and verify that no
+        //:   'Counted' object is alive at the end.  (C-5..6)
+        //
+        // Testing:
+        //   iterator emplace(const_iterator position, Args&&...);
+        //   iterator insert(const_iterator position, const VALUE_TYPE& value);
+        //   iterator insert(const_iterator position, MovableRef<VALUE_TYPE>);
+        //   iterator insert(const_iterator position, size_type n, const V& v);
+        //   iterator insert(const_iterator position, ITER first, ITER last);
+        //   iterator insert(const_iterator position, initializer_list<V>);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT, EMPLACE, AND ERASE"
+                            "\n==========================\n");
+
+        {
+            typedef bsl::inplace_vector<Counted, 16> Obj;
+
+            RandomGenerator random;
+
+            Obj                  mX;  const Obj& X = mX;
+            bsl::vector<Counted> mM;
+
+            const Counted VALUES[] = { 100, 101, 102, 103, 104, 105 };
+
+            for (int i = 0; i < 2000; ++i) {
+                const int op  = random(8);
+                const int pos = random(static_cast<int>(X.size()) + 1);
+                const int n   = random(4);
+                const int v   = random(50);
+
+                const bool fits = X.size() + (op <= 4 ? 1 : n) <= 16;
+
+                if (veryVeryVerbose) {
+                    T_ P_(i) P_(op) P_(pos) P_(n) P(v)
+                }
+
+                Obj::iterator it = Obj::iterator();
+#if defined(BDE_BUILD_TARGET_EXC)
+                try {
+#else
+                if (!fits) {
+                    continue;
+                }
+#endif
+                    switch (op) {
+                      case 0: {
+                        it = mX.insert(X.begin() + pos, Counted(v));
+                        mM.insert(mM.begin() + pos, Counted(v));
+                      } break;
+                      case 1: {
+                        Counted c(v);
+                        it = mX.insert(X.begin() + pos, MoveUtil::move(c));
+                        mM.insert(mM.begin() + pos, Counted(v));
+                      } break;
+                      case 2: {
+                        if (X.empty()) {
+                            it = mX.insert(X.begin(), Counted(v));
+                            mM.insert(mM.begin(), Counted(v));
+                        }
+                        else {
+                            // Insert a value referring to the last element.
+
+                            const Counted V = X.back();
+                            it = mX.insert(X.begin() + pos, X.back());
+                            mM.insert(mM.begin() + pos, V);
+                        }
+                      } break;
+                      case 3: {
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+                        it = mX.emplace(X.begin() + pos, v);
+#else
+                        it = mX.insert(X.begin() + pos, Counted(v));
+#endif
+                        mM.insert(mM.begin() + pos, Counted(v));
+                      } break;
+                      case 4: {
+                        if (X.empty()) {
+                            it = mX.insert(X.begin(), Counted(v));
+                            mM.insert(mM.begin(), Counted(v));
+                        }
+                        else {
+                            // Insert copies of the first element.
+
+                            const Counted V = X.front();
+                            it = mX.insert(X.begin() + pos, 1, X.front());
+                            mM.insert(mM.begin() + pos, V);
+                        }
+                      } break;
+                      case 5: {
+                        it = mX.insert(X.begin() + pos, n, Counted(v));
+                        mM.insert(mM.begin() + pos, n, Counted(v));
+                      } break;
+                      case 6: {
+                        it = mX.insert(X.begin() + pos,
+                                       VALUES + v % 3,
+                                       VALUES + v % 3 + n);
+                        mM.insert(mM.begin() + pos,
+                                  VALUES + v % 3,
+                                  VALUES + v % 3 + n);
+                      } break;
+                      case 7: {
+                        typedef InputIterator<const Counted *> InIt;
+                        it = mX.insert(X.begin() + pos,
+                                       InIt(VALUES),
+                                       InIt(VALUES + n));
+                        mM.insert(mM.begin() + pos, VALUES, VALUES + n);
+                      } break;
+                    }
+                    ASSERTV(i, op, fits);
+                    ASSERTV(i, op, pos == it - X.begin());
+#if defined(BDE_BUILD_TARGET_EXC)
+                }
+                catch (const std::bad_alloc&) {
+                    ASSERTV(i, op, !fits);
+                }
+#endif
+                ASSERTV(i, op, isEqual(X, mM));
+
+                // Erase to keep the size varying over the full range.
+
+                if (X.size() > 12 || (X.size() && random(3) == 0)) {
+                    const int first = random(static_cast<int>(X.size()));
+                    const int count = random(
+                                      static_cast<int>(X.size()) - first + 1);
+                    if (count == 1 && random(2)) {
+                        it = mX.erase(X.begin() + first);
+                    }
+                    else {
+                        it = mX.erase(X.begin() + first,
+                                      X.begin() + first + count);
+                    }
+                    mM.erase(mM.begin() + first, mM.begin() + first + count);
+                    ASSERTV(i, first == it - X.begin());
+                    ASSERTV(i, isEqual(X, mM));
+                }
+                ASSERTV(i, static_cast<int>(X.size() + mM.size()) + 6 ==
+                                                         Counted::numAlive());
+            }
+        }
+        ASSERTV(Counted::numAlive(), 0 == Counted::numAlive());
+
+        if (verbose) printf("\tBitwise-moveable elements.\n");
+        {
+            typedef bsl::inplace_vector<int, 10> Obj;
+
+            Obj mX;  const Obj& X = mX;
+            bsl::vector<int> mM;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(X.begin() + i / 2, i);
+                mM.insert(mM.begin() + i / 2, i);
+            }
+            ASSERT(isEqual(X, mM));
+
+            mX.erase(X.begin() + 2, X.begin() + 5);
+            mM.erase(mM.begin() + 2, mM.begin() + 5);
+            ASSERT(isEqual(X, mM));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert(X.begin() + 1, { 40, 41, 42 });
+            ASSERT(10 == X.size());
+            ASSERT(40 == X[1] && 42 == X[3]);
+#endif
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            typedef bsl::inplace_vector<int, 4> Obj;
+
+            Obj mX(2);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.erase(X.begin() + 1, X.begin()));
+            ASSERT_SAFE_FAIL(mX.insert(X.end() + 1, 0));
+            ASSERT_SAFE_PASS(mX.insert(X.end(), 0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 Each constructor creates a vector having the expected value.
+        //:
+        //: 2 A constructor given more than 'CAPACITY' elements throws
+        //:   'bsl::bad_alloc' without leaking any element.
+        //:
+        //: 3 Copy and move construction and assignment produce a vector
+        //:   having the value of the source, also when assigning to a
+        //:   non-empty vector or to itself.
+        //:
+        //: 4 'assign' replaces the value, and may be passed a value referring
+        //:   to an element of the vector.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor with element type
+        //:   'Counted', and verify their values and the live object count.
+        //:   (C-1..2)
+        //:
+        //: 2 Copy, move, and assign vectors of 'bsl::string' of various
+        //:   sizes, and verify the values.  (C-3)
+        //:
+        //: 3 Call 'assign' with a count and a value, including a value that
+        //:   is an element of the vector, and with ranges.  (C-4)
+        //
+        // Testing:
+        //   inplace_vector(size_type initialSize);
+        //   inplace_vector(size_type initialSize, const VALUE_TYPE& value);
+        //   inplace_vector(ITER first, ITER last);
+        //   inplace_vector(initializer_list<VALUE_TYPE> values);
+        //   inplace_vector(const inplace_vector& original);
+        //   inplace_vector(MovableRef<inplace_vector> original);
+        //   inplace_vector& operator=(const inplace_vector& rhs);
+        //   inplace_vector& operator=(MovableRef<inplace_vector> rhs);
+        //   inplace_vector& operator=(initializer_list<VALUE_TYPE> values);
+        //   void assign(size_type numElements, const VALUE_TYPE& value);
+        //   void assign(ITER first, ITER last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND ASSIGNMENT"
+                            "\n===========================\n");
+
+        {
+            typedef bsl::inplace_vector<Counted, 4> Obj;
+
+            const Counted VALUES[] = { 1, 2, 3, 4, 5 };
+
+            const Obj X(3);
+            ASSERT(3 == X.size());
+            ASSERT(0 == X[0].value() && 0 == X[2].value());
+
+            const Obj Y(2, VALUES[4]);
+            ASSERT(2 == Y.size());
+            ASSERT(5 == Y[1].value());
+
+            const Obj Z(VALUES, VALUES + 4);
+            ASSERT(4 == Z.size());
+            ASSERT(4 == Z.back().value());
+
+            typedef InputIterator<const Counted *> InIt;
+            const Obj W((InIt(VALUES + 1)), InIt(VALUES + 3));
+            ASSERT(2 == W.size());
+            ASSERT(2 == W.front().value());
+
+            // The integral overload is chosen for two 'int' arguments.
+
+            const bsl::inplace_vector<int, 4> I(3, 7);
+            ASSERT(3 == I.size());
+            ASSERT(7 == I[2]);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            {
+                const Obj L = { 7, 8 };
+                ASSERT(2 == L.size());
+                ASSERT(8 == L.back().value());
+            }
+#endif
+
+            ASSERTV(Counted::numAlive(),
+                    5 + 3 + 2 + 4 + 2 == Counted::numAlive());
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            const int ALIVE = Counted::numAlive();
+
+            bool caught = false;
+            try {
+                const Obj O(VALUES, VALUES + 5);
+            }
+            catch (const std::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERTV(Counted::numAlive(), ALIVE == Counted::numAlive());
+
+            caught = false;
+            try {
+                const Obj O(5);
+            }
+            catch (const std::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERTV(Counted::numAlive(), ALIVE == Counted::numAlive());
+#endif
+        }
+        ASSERTV(Counted::numAlive(), 0 == Counted::numAlive());
+
+        if (verbose) printf("\tCopy, move, and assignment.\n");
+        {
+            typedef bsl::inplace_vector<bsl::string, 4> Obj;
+
+            for (int i = 0; i <= 4; ++i) {
+                Obj mW;  const Obj& W = mW;
+                for (int k = 0; k < i; ++k) {
+                    bsl::string s(LONG_STRING);
+                    s.push_back(static_cast<char>('a' + k));
+                    mW.push_back(s);
+                }
+
+                const Obj X(W);
+                ASSERTV(i, W == X);
+
+                Obj mY(W);
+                const Obj Z(MoveUtil::move(mY));
+                ASSERTV(i, W == Z);
+
+                for (int j = 0; j <= 4; ++j) {
+                    Obj mU(j, bsl::string(LONG_STRING));  const Obj& U = mU;
+                    mU = W;
+                    ASSERTV(i, j, W == U);
+
+                    Obj mV(j, bsl::string(LONG_STRING));  const Obj& V = mV;
+                    Obj mT(W);
+                    mV = MoveUtil::move(mT);
+                    ASSERTV(i, j, W == V);
+                }
+
+                mW = W;
+                ASSERTV(i, X == W);
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) printf("\t'assign'.\n");
+        {
+            typedef bsl::inplace_vector<int, 6> Obj;
+
+            Obj mX(4, 1);  const Obj& X = mX;
+            mX[3] = 9;
+
+            mX.assign(2, X[3]);
+            ASSERT(2 == X.size());
+            ASSERT(9 == X[0] && 9 == X[1]);
+
+            mX[0] = 3;
+            mX.assign(5, X[0]);
+            ASSERT(5 == X.size());
+            ASSERT(3 == X[4]);
+
+            const int DATA[] = { 1, 2, 3 };
+            mX.assign(DATA, DATA + 3);
+            ASSERT(3 == X.size());
+            ASSERT(3 == X[2]);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX = { 4, 5 };
+            ASSERT(2 == X.size());
+            ASSERT(5 == X[1]);
+#endif
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'push_back' and 'emplace_back' append an element and return a
+        //:   reference to it, and throw 'bsl::bad_alloc' with no effect when
+        //:   the vector is full.
+        //:
+        //: 2 The 'try_*' methods return the address of the new element, or 0
+        //:   with no effect when the vector is full.
+        //:
+        //: 3 The 'unchecked_*' methods append an element, and assert that the
+        //:   vector is not full in safe builds.
+        //:
+        //: 4 'pop_back' and 'clear' destroy elements.
+        //:
+        //: 5 The accessors report the state of the vector, and 'capacity' and
+        //:   'max_size' return 'CAPACITY'.
+        //:
+        //: 6 No memory is allocated, and the object is no larger than its
+        //:   elements and a size.
+        //:
+        //: 7 The vector is bitwise moveable if and only if 'VALUE_TYPE' is.
+        //
+        // Plan:
+        //: 1 Fill vectors of 'Counted' elements to capacity using each append
+        //:   method, verifying the state, the returned values, and the live
+        //:   object count after each step, then attempt one more append.
+        //:   (C-1..5)
+        //:
+        //: 2 Verify that the default allocator is unused.  (C-6)
+        //:
+        //: 3 Use 'BSLMF_ASSERT' to verify the size and the traits.  (C-6..7)
+        //
+        // Testing:
+        //   static size_type capacity();
+        //   static size_type max_size();
+        //   inplace_vector();
+        //   ~inplace_vector();
+        //   reference emplace_back(Args&&...);
+        //   VALUE_TYPE *try_emplace_back(Args&&...);
+        //   reference unchecked_emplace_back(Args&&...);
+        //   reference push_back(const VALUE_TYPE& value);
+        //   reference push_back(MovableRef<VALUE_TYPE> value);
+        //   VALUE_TYPE *try_push_back(const VALUE_TYPE& value);
+        //   VALUE_TYPE *try_push_back(MovableRef<VALUE_TYPE> value);
+        //   reference unchecked_push_back(const VALUE_TYPE& value);
+        //   reference unchecked_push_back(MovableRef<VALUE_TYPE> value);
+        //   void pop_back();
+        //   void clear();
+        //   reference operator[](size_type position);
+        //   reference front();
+        //   reference back();
+        //   VALUE_TYPE *data();
+        //   iterator begin();
+        //   iterator end();
+        //   bool empty() const;
+        //   bool full() const;
+        //   size_type size() const;
+        //   CONCERN: Trait 'IsBitwiseMoveable' follows 'VALUE_TYPE'.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        BSLMF_ASSERT(sizeof(bsl::inplace_vector<int, 4>) <=
+                                          4 * sizeof(int) + sizeof(size_t));
+        typedef bsl::inplace_vector<int,     4> IntVector;
+        typedef bsl::inplace_vector<Counted, 4> CountedVector;
+        BSLMF_ASSERT( bslmf::IsBitwiseMoveable<IntVector>::value);
+        BSLMF_ASSERT(!bslmf::IsBitwiseMoveable<CountedVector>::value);
+
+        typedef bsl::inplace_vector<Counted, 5> Obj;
+
+        ASSERT(5 == Obj::capacity());
+        ASSERT(5 == Obj::max_size());
+
+        for (int method = 0; method < 7; ++method) {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(!X.full());
+            ASSERT(X.begin() == X.end());
+
+            for (int i = 0; i < 5; ++i) {
+                const Counted V(i);
+                Counted       v(i);
+                Counted      *p = 0;
+
+                switch (method) {
+                  case 0: p = &mX.push_back(V);                       break;
+                  case 1: p = &mX.push_back(MoveUtil::move(v));       break;
+                  case 2: p = mX.try_push_back(V);                    break;
+                  case 3: p = mX.try_push_back(MoveUtil::move(v));    break;
+                  case 4: p = &mX.unchecked_push_back(V);             break;
+                  case 5: p = &mX.unchecked_push_back(
+                                                      MoveUtil::move(v));
+                          break;
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+                  case 6: {
+                    switch (i % 3) {
+                      case 0: p = &mX.emplace_back(i);                break;
+                      case 1: p = mX.try_emplace_back(i);             break;
+                      case 2: p = &mX.unchecked_emplace_back(i);      break;
+                    }
+                  } break;
+#else
+                  case 6: p = &mX.push_back(V);                       break;
+#endif
+                }
+
+                ASSERTV(method, i, &X.back() == p);
+                ASSERTV(method, i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(method, i, i == X[i].value());
+                ASSERTV(method, i, 0 == X.front().value());
+                ASSERTV(method, i, X.data() + i == p);
+                ASSERTV(method, i, X.end() - X.begin() == i + 1);
+                ASSERTV(method, i, i + 1 + 2 == Counted::numAlive());
+            }
+            ASSERT(X.full());
+
+            const Counted V(9);
+            ASSERTV(method, 0 == mX.try_push_back(V));
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+            ASSERTV(method, 0 == mX.try_emplace_back(9));
+#endif
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                mX.push_back(V);
+            }
+            catch (const std::bad_alloc&) {
+                caught = true;
+            }
+            ASSERTV(method, caught);
+#endif
+            ASSERTV(method, 5 == X.size());
+            ASSERTV(method, 5 + 1 == Counted::numAlive());
+
+            mX.pop_back();
+            ASSERTV(method, 4 == X.size());
+            ASSERTV(method, 3 == X.back().value());
+            ASSERTV(method, 4 + 1 == Counted::numAlive());
+
+            mX[0] = V;
+            ASSERTV(method, 9 == X.front().value());
+
+            mX.clear();
+            ASSERTV(method, X.empty());
+            ASSERTV(method, 1 == Counted::numAlive());
+
+            mX.push_back(V);
+        }
+        ASSERTV(Counted::numAlive(), 0 == Counted::numAlive());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            typedef bsl::inplace_vector<int, 1> IObj;
+
+            IObj mX;  const IObj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.pop_back());
+            ASSERT_SAFE_FAIL(X.front());
+            ASSERT_SAFE_FAIL(X.back());
+            ASSERT_SAFE_FAIL(X[0]);
+            ASSERT_SAFE_PASS(mX.unchecked_push_back(1));
+            ASSERT_SAFE_FAIL(mX.unchecked_push_back(2));
+            ASSERT_SAFE_PASS(X[0]);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::inplace_vector<int, 4> Obj;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(4 == X.capacity());
+
+        mX.push_back(1);
+        mX.push_back(3);
+        mX.insert(X.begin() + 1, 2);
+        ASSERT(3 == X.size());
+        ASSERT(1 == X[0] && 2 == X[1] && 3 == X[2]);
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.push_back(4);
+        ASSERT(Y.full());
+        ASSERT(0 == mY.try_push_back(5));
+        ASSERT(X < Y);
+
+        mY.erase(Y.begin());
+        ASSERT(2 == Y.front());
+        ASSERT(X != Y);
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
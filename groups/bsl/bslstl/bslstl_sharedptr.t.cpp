@@ -2921,7 +2921,7 @@ MyBslAllocArgTestDeleter::MyBslAllocArgTestDeleter(
 
 MyBslAllocArgTestDeleter::~MyBslAllocArgTestDeleter()
 {
-    d_allocator.deallocate(static_cast<char *>(d_memory_p));
+    d_allocator.deallocate(static_cast<char *>(d_memory_p), 13);
 }
 
 // MANIPULATORS
@@ -262,16 +262,31 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
                                             // ensure proper alignment
     };
 
+    union Chunk;
+
+    struct ChunkHeader {
+        // This 'struct' holds the bookkeeping data stored at the beginning of
+        // each chunk.
+
+        Chunk                                      *d_next_p;
+                                             // pointer to next Chunk
+
+        typename Types::AllocatorTraits::size_type  d_numObjects;
+                                             // number of 'MaxAlignedType'
+                                             // objects allocated for this
+                                             // chunk
+    };
+
     union Chunk {
         // This 'union' prepends to the beginning of each managed block of
         // allocated memory, implementing a singly-linked list of managed
         // chunks, and thereby enabling constant-time additions to the list of
         // chunks.
 
-        Chunk *d_next_p;  // pointer to next Chunk
+        ChunkHeader d_header;  // link to next chunk, and size of this chunk
 
         typename bsls::AlignmentFromType<Block>::Type d_alignment;
-                          // ensure each block is correctly aligned
+                               // ensure each block is correctly aligned
     };
 
   public:
@@ -421,8 +436,9 @@ SimplePool<VALUE, ALLOCATOR>::allocateChunk(size_type size)
     BSLS_ASSERT_SAFE(0 ==
              reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % sizeof(Chunk));
 
-    chunkPtr->d_next_p = d_chunkList_p;
-    d_chunkList_p      = chunkPtr;
+    chunkPtr->d_header.d_next_p     = d_chunkList_p;
+    chunkPtr->d_header.d_numObjects = numMaxAlignedType;
+    d_chunkList_p                   = chunkPtr;
 
     return reinterpret_cast<Block *>(chunkPtr + 1);
 }
@@ -588,8 +604,13 @@ void SimplePool<VALUE, ALLOCATOR>::release()
         typename AllocatorTraits::value_type *lastChunk =
                       reinterpret_cast<typename AllocatorTraits::value_type *>(
                                                                 d_chunkList_p);
-        d_chunkList_p   = d_chunkList_p->d_next_p;
-        AllocatorTraits::deallocate(allocator(), lastChunk, 1);
+        const size_type numObjects = d_chunkList_p->d_header.d_numObjects;
+
+        // Return each chunk with the number of objects it was allocated with,
+        // so that the allocator receives an accurate size.
+
+        d_chunkList_p = d_chunkList_p->d_header.d_next_p;
+        AllocatorTraits::deallocate(allocator(), lastChunk, numObjects);
     }
     d_freeList_p = 0;
 
@@ -224,6 +224,106 @@ class Stack {
     }
 };
 
+class SizeCheckingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol, forwarding to an
+    // underlying allocator, and records the size of each outstanding block so
+    // that it can verify the size hint supplied by each sized deallocation.
+
+    enum { CAPACITY = 128 };  // maximum number of outstanding blocks
+
+    // DATA
+    void             *d_addresses[CAPACITY];  // outstanding blocks
+    size_type         d_sizes[CAPACITY];      // sizes of outstanding blocks
+    int               d_numBlocks;            // number of outstanding blocks
+    int               d_numSized;             // number of sized deallocations
+    int               d_numMismatches;        // number of sized deallocations
+                                              // with an incorrect size
+    bslma::Allocator *d_allocator_p;          // underlying allocator (held)
+
+    // PRIVATE MANIPULATORS
+    size_type remove(void *address)
+        // Remove the specified 'address' from the outstanding blocks, and
+        // return its size.  The behavior is undefined unless 'address' is an
+        // outstanding block.
+    {
+        for (int i = 0; i < d_numBlocks; ++i) {
+            if (address == d_addresses[i]) {
+                const size_type size = d_sizes[i];
+
+                --d_numBlocks;
+                d_addresses[i] = d_addresses[d_numBlocks];
+                d_sizes[i]     = d_sizes[d_numBlocks];
+                return size;                                          // RETURN
+            }
+        }
+        BSLS_ASSERT_INVOKE("unknown address");
+        return 0;
+    }
+
+  protected:
+    // PROTECTED MANIPULATORS
+    void doDeallocate(void *address, size_type size, size_type)
+        // Return the memory block at the specified 'address' to the
+        // underlying allocator, recording whether the specified 'size' is the
+        // size with which the block was allocated.
+    {
+        if (address) {
+            ++d_numSized;
+            if (size != remove(address)) {
+                ++d_numMismatches;
+            }
+            d_allocator_p->deallocate(address);
+        }
+    }
+
+  public:
+    // CREATORS
+    explicit SizeCheckingAllocator(bslma::Allocator *basicAllocator)
+        // Create an allocator that forwards to the specified
+        // 'basicAllocator'.
+    : d_numBlocks(0)
+    , d_numSized(0)
+    , d_numMismatches(0)
+    , d_allocator_p(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size)
+        // Return a block of the specified 'size' from the underlying
+        // allocator.
+    {
+        BSLS_ASSERT(CAPACITY != d_numBlocks);
+
+        void *address = d_allocator_p->allocate(size);
+        d_addresses[d_numBlocks] = address;
+        d_sizes[d_numBlocks]     = size;
+        ++d_numBlocks;
+        return address;
+    }
+
+    void deallocate(void *address)
+        // Return the memory block at the specified 'address' to the
+        // underlying allocator.
+    {
+        if (address) {
+            remove(address);
+            d_allocator_p->deallocate(address);
+        }
+    }
+
+    // ACCESSORS
+    int numBlocksInUse() const { return d_numBlocks; }
+        // Return the number of outstanding blocks.
+
+    int numMismatches() const { return d_numMismatches; }
+        // Return the number of sized deallocations whose size hint differed
+        // from the size with which the block was allocated.
+
+    int numSizedDeallocations() const { return d_numSized; }
+        // Return the number of sized deallocations.
+};
+
 template <class VALUE>
 class TestDriver {
     // This templatized struct provide a namespace for testing the 'map'
@@ -928,6 +1028,9 @@ void TestDriver<VALUE>::testCase7()
     //:
     //: 3 No free memory blocks is available after a 'release'.  i.e.,
     //:   subsequent 'allocate' will need to allocate memory from the heap.
+    //:
+    //: 4 Each chunk is returned to the allocator with the size with which it
+    //:   was allocated.
     //
     // Plan:
     //: 1 Invoke 'allocate' and 'deallocate' various number of time.
@@ -936,6 +1039,11 @@ void TestDriver<VALUE>::testCase7()
     //:
     //:   2 Call 'allocate' and verify memory is allocated from the heap.
     //:     (C-3)
+    //:
+    //: 2 Using an allocator that records the size of each block, allocate
+    //:   blocks in chunks of several sizes, call 'release', and verify that
+    //:   every chunk was returned with a size hint matching its allocation.
+    //:   (C-4)
     //
     // Testing:
     //   void release();
@@ -999,6 +1107,27 @@ void TestDriver<VALUE>::testCase7()
 
     }
 
+    {
+        bslma::TestAllocator  oa("object", veryVeryVeryVerbose);
+        SizeCheckingAllocator sa(&oa);
+
+        Stack usedX;
+        Stack freeX;
+
+        Obj mX(&sa);
+        init(&mX, &usedX, &freeX, 40, 10);
+        mX.reserve(5);
+
+        const int NUM_CHUNKS = sa.numBlocksInUse();
+
+        mX.release();
+
+        ASSERTV(NUM_CHUNKS, sa.numSizedDeallocations(),
+                NUM_CHUNKS == sa.numSizedDeallocations());
+        ASSERTV(sa.numMismatches(), 0 == sa.numMismatches());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+    }
+
     // Verify no memory is allocated from the default allocator.
 
     ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
@@ -1500,6 +1500,24 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result);
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, an iterator providing modifiable access to the
+        // 'value_type' object in this unordered map with a key equivalent to
+        // that key, if such an entry exists, and the past-the-end iterator
+        // ('end') otherwise.  Return the position following the last iterator
+        // written.  The result is the same as calling 'find' for each key, but
+        // the hash codes of a batch of keys are computed, and their buckets
+        // and nodes prefetched, before any key is compared, which hides much
+        // of the memory latency of looking up many keys in a map larger than
+        // the data cache.  'KEY_ITERATOR' shall be a forward iterator whose
+        // value type is convertible to 'key_type'.  Note that this method is
+        // a BDE extension.
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this unordered map if the key (the
         // 'first' element) of the object referred to by 'value' does not
@@ -1775,6 +1793,29 @@ class unordered_map {
         // numElements'.  Also note that this operation has no effect if
         // 'numElements <= size()'.
 
+    void completeRehash();
+        // Finish immediately any incremental rehash in progress, so that every
+        // element of this unordered map is indexed by its current array of
+        // buckets.  This method has no effect unless 'isRehashInProgress()'.
+        // Note that this method is a BDE extension.
+
+    void setIncrementalRehashStep(size_type numBuckets);
+        // Enable incremental rehash for this unordered map, clearing or
+        // migrating at least the specified 'numBuckets' buckets per insertion
+        // while a rehash is in progress, or, if 'numBuckets' is 0, disable
+        // incremental rehash, completing any rehash already in progress.  When
+        // incremental rehash is enabled, an insertion that would exceed the
+        // 'max_load_factor' allocates the larger bucket array, but the array
+        // is cleared, and the elements are re-indexed into it, a few buckets
+        // at a time by that and subsequent insertions, which bounds the
+        // latency of any one insertion.  The share of buckets handled by each
+        // insertion is chosen so that the rehash completes before this map
+        // grows again.  The bucket interface ('bucket_count', 'bucket',
+        // 'begin(n)', etc.) describes the current array of buckets, and so is
+        // complete only when 'isRehashInProgress()' is 'false'.  As any
+        // insertion may re-index elements, any insertion may change the order
+        // of iteration.  Note that this method is a BDE extension.
+
     void swap(unordered_map& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(
                                      AllocatorTraits::is_always_equal::value &&
                                      bsl::is_nothrow_swappable<HASH>::value &&
@@ -2017,6 +2058,22 @@ class unordered_map {
         // the specified 'key', if such an entry exists, and the past-the-end
         // iterator ('end') otherwise.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result) const;
+        // Write to the specified 'result', for each key in the range starting
+        // at the specified 'first' and ending immediately before the specified
+        // 'last', in order, an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered map with a key equivalent to
+        // that key, if such an entry exists, and the past-the-end iterator
+        // ('end') otherwise.  Return the position following the last iterator
+        // written.  The result is the same as calling 'find' for each key, but
+        // the lookups are batched and prefetched as described for the
+        // modifiable overload.  'KEY_ITERATOR' shall be a forward iterator
+        // whose value type is convertible to 'key_type'.  Note that this
+        // method is a BDE extension.
+
     allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -2045,6 +2102,17 @@ class unordered_map {
         // number of buckets and rehash the elements of the container into
         // those buckets (see 'rehash').
 
+    size_type incrementalRehashStep() const;
+        // Return the minimum number of buckets cleared or migrated by each
+        // insertion while an incremental rehash is in progress, or 0 if
+        // incremental rehash is disabled (see 'setIncrementalRehashStep').
+        // Note that this method is a BDE extension.
+
+    bool isRehashInProgress() const;
+        // Return 'true' if this unordered map has grown its array of buckets
+        // but not yet migrated every element into it, and 'false' otherwise.
+        // Note that this method is a BDE extension.
+
     size_type size() const BSLS_KEYWORD_NOEXCEPT;
         // Return the number of elements in this unordered map.
 
@@ -2935,6 +3003,28 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findMany(
+                                                  KEY_ITERATOR    first,
+                                                  KEY_ITERATOR    last,
+                                                  OUTPUT_ITERATOR result)
+{
+    HashTableLink *links[HashTable::k_FIND_BATCH_SIZE];
+
+    while (first != last) {
+        const KEY_ITERATOR next = d_impl.findBatch(links, first, last);
+
+        for (HashTableLink **link = links; first != next;
+                                                ++first, ++link, ++result) {
+            *result = iterator(*link);
+        }
+    }
+
+    return result;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -3109,6 +3199,22 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::reserve(
     d_impl.reserveForNumElements(numElements);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::completeRehash()
+{
+    d_impl.completeRehash();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::setIncrementalRehashStep(
+                                                          size_type numBuckets)
+{
+    d_impl.setIncrementalRehashStep(numBuckets);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void
@@ -3387,6 +3493,28 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findMany(
+                                            KEY_ITERATOR    first,
+                                            KEY_ITERATOR    last,
+                                            OUTPUT_ITERATOR result) const
+{
+    HashTableLink *links[HashTable::k_FIND_BATCH_SIZE];
+
+    while (first != last) {
+        const KEY_ITERATOR next = d_impl.findBatch(links, first, last);
+
+        for (HashTableLink **link = links; first != next;
+                                                ++first, ++link, ++result) {
+            *result = const_iterator(*link);
+        }
+    }
+
+    return result;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
@@ -3428,6 +3556,23 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
     return d_impl.maxLoadFactor();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::incrementalRehashStep()
+                                                                          const
+{
+    return d_impl.incrementalRehashStep();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::isRehashInProgress() const
+{
+    return d_impl.isRehashInProgress();
+}
+
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
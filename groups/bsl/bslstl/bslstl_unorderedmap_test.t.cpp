@@ -34,6 +34,7 @@
 #include <bsls_nameof.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_timeutil.h>   // TC -1
 #include <bsls_types.h>
 #include <bsls_util.h>
 
@@ -189,6 +190,8 @@ using bsl::pair;
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
 // [ 4] iterator find(const KEY& key);
 // [ 4] const_iterator find(const KEY& key) const;
+// [44] OUTPUT_ITERATOR findMany(KEY_ITERATOR, KEY_ITERATOR, OUTPUT_IT);
+// [44] OUTPUT_ITERATOR findMany(KEY_IT, KEY_IT, OUTPUT_ITERATOR) const;
 //
 // non-local iterators:
 // [14] iterator begin();
@@ -228,6 +231,10 @@ using bsl::pair;
 // [35] float max_load_factor() const;
 // [35] void rehash(size_type);
 // [35] void reserve(size_type);
+// [45] void setIncrementalRehashStep(size_type);
+// [45] void completeRehash();
+// [45] size_type incrementalRehashStep() const;
+// [45] bool isRehashInProgress() const;
 //
 // functor access:
 // [ 2] HASH hash_function() const;
@@ -1609,6 +1616,22 @@ struct IntValue {
 
     int d_value;
 };
+
+                        // =====================
+                        // struct ModuloFourHash
+                        // =====================
+
+struct ModuloFourHash {
+    // A hash functor that maps every 'int' onto one of four hash values, so
+    // that the buckets of a map using it hold long chains of colliding keys.
+
+    size_t operator()(int key) const
+        // Return the specified 'key' modulo 4.
+    {
+        return static_cast<size_t>(key) % 4;
+    }
+};
+
                          // ================
                          // class MoveHolder
                          // ================
@@ -9376,6 +9399,411 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
+      case 45: {
+        // --------------------------------------------------------------------
+        // TESTING INCREMENTAL REHASH
+        //
+        // Concerns:
+        //: 1 By default, incremental rehash is disabled, and no rehash is ever
+        //:   left in progress.
+        //:
+        //: 2 When incremental rehash is enabled, growing the map leaves a
+        //:   rehash in progress, which subsequent insertions complete.
+        //:
+        //: 3 While a rehash is in progress, every element can be found,
+        //:   iterated over, erased, and compared, and copies of the map have
+        //:   the same value.
+        //:
+        //: 4 'completeRehash', and setting the step to 0, finish a rehash in
+        //:   progress, after which the bucket interface indexes every element.
+        //:
+        //: 5 Keys that collide with other keys in the same bucket are handled
+        //:   correctly.
+        //:
+        //: 6 A rehash completes before the map grows again, however small the
+        //:   step and the maximum load factor.
+        //:
+        //: 7 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Verify the initial state of a default-constructed map.  (C-1)
+        //:
+        //: 2 For a series of steps, insert a sequence of keys into a map with
+        //:   that incremental rehash step, erasing some of them as we go, and
+        //:   after every insertion verify that the new key, and a sample of
+        //:   earlier keys, can be found (or not, if erased).  Record whether
+        //:   a rehash was ever observed in progress.  (C-2..3)
+        //:
+        //: 3 Copy, move, swap, and compare the map while a rehash is in
+        //:   progress, then complete the rehash and verify that the sum of
+        //:   'bucket_size' over all buckets equals 'size'.  (C-3..4)
+        //:
+        //: 4 Repeat P-2..3 with a hash functor that maps every key onto one of
+        //:   four hash values.  (C-5)
+        //:
+        //: 5 Using a step of 1 and a maximum load factor of 0.25, insert a
+        //:   sequence of keys, counting the rehashes begun and the changes in
+        //:   'bucket_count', and verify that every change but the first
+        //:   (allocating the initial bucket array) is due to a distinct
+        //:   rehash.  (C-6)
+        //:
+        //: 6 Use a test allocator throughout, and verify that all memory is
+        //:   returned.  (C-7)
+        //
+        // Testing:
+        //   void setIncrementalRehashStep(size_type);
+        //   void completeRehash();
+        //   size_type incrementalRehashStep() const;
+        //   bool isRehashInProgress() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING INCREMENTAL REHASH"
+                            "\n==========================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting default state.\n");
+        {
+            typedef bsl::unordered_map<int, int> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0     == X.incrementalRehashStep());
+            ASSERT(false == X.isRehashInProgress());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX[i] = i;
+                ASSERTV(i, !X.isRehashInProgress());
+            }
+        }
+
+        static const int STEPS[]   = { 1, 2, 3, 8, 1000 };
+        const int        NUM_STEPS = static_cast<int>(sizeof STEPS
+                                                      / sizeof *STEPS);
+
+        const int NUM_KEYS = 3000;
+
+        if (verbose) printf("\tTesting with 'bsl::hash'.\n");
+        for (int ti = 0; ti < NUM_STEPS; ++ti) {
+            const int STEP = STEPS[ti];
+
+            typedef bsl::unordered_map<int, int> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.setIncrementalRehashStep(STEP);
+            ASSERTV(STEP, STEP == static_cast<int>(X.incrementalRehashStep()));
+
+            bool sawRehash = false;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(STEP, i, mX.insert(Obj::value_type(i, -i)).second);
+                sawRehash |= X.isRehashInProgress();
+
+                if (0 == i % 3) {
+                    ASSERTV(STEP, i, 1 == mX.erase(i / 2));
+                }
+
+                for (int j = i; j >= 0 && j > i - 40; --j) {
+                    // Key 'j' is erased by the iteration '2 * j' or
+                    // '2 * j + 1', whichever is divisible by 3.
+
+                    const int  k      = 0 == (2 * j) % 3 ? 2 * j : 2 * j + 1;
+                    const bool erased = 0 == k % 3 && k <= i;
+
+                    Obj::const_iterator it = X.find(j);
+                    ASSERTV(STEP, i, j, erased == (X.end() == it));
+                    if (X.end() != it) {
+                        ASSERTV(STEP, i, j, -j == it->second);
+                    }
+                }
+            }
+            ASSERTV(STEP, sawRehash);
+
+            size_t count = 0;
+            for (Obj::const_iterator it = X.begin(); X.end() != it; ++it) {
+                ASSERTV(STEP, it == X.find(it->first));
+                ++count;
+            }
+            ASSERTV(STEP, X.size() == count);
+
+            // Grow the map once more to make sure a rehash is in progress.
+
+            while (!X.isRehashInProgress()) {
+                mX[static_cast<int>(X.size()) * 2 + NUM_KEYS] = 0;
+            }
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERTV(STEP, X == Y);
+            ASSERTV(STEP, STEP == static_cast<int>(Y.incrementalRehashStep()));
+
+            Obj mZ(&oa);  const Obj& Z = mZ;
+            mZ.swap(mY);
+            ASSERTV(STEP, X == Z);
+            ASSERTV(STEP, Y.empty());
+
+            Obj mW(bslmf::MovableRefUtil::move(mZ), &oa);  const Obj& W = mW;
+            ASSERTV(STEP, X == W);
+
+            mX.completeRehash();
+            ASSERTV(STEP, !X.isRehashInProgress());
+            ASSERTV(STEP, X == W);
+
+            size_t bucketTotal = 0;
+            for (size_t b = 0; b < X.bucket_count(); ++b) {
+                bucketTotal += X.bucket_size(b);
+            }
+            ASSERTV(STEP, X.size() == bucketTotal);
+
+            while (!W.isRehashInProgress()) {
+                mW[static_cast<int>(W.size()) * 2 + NUM_KEYS] = 0;
+            }
+            mW.setIncrementalRehashStep(0);
+            ASSERTV(STEP, 0 == W.incrementalRehashStep());
+            ASSERTV(STEP, !W.isRehashInProgress());
+
+            mW.clear();
+            ASSERTV(STEP, !W.isRehashInProgress());
+        }
+
+        if (verbose) printf("\tTesting with colliding keys.\n");
+        for (int ti = 0; ti < NUM_STEPS; ++ti) {
+            const int STEP = STEPS[ti];
+
+            typedef bsl::unordered_map<int, int, ModuloFourHash> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.setIncrementalRehashStep(STEP);
+
+            for (int i = 0; i < 200; ++i) {
+                mX[i] = i;
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(STEP, i, j, X.end() != X.find(j));
+                }
+                ASSERTV(STEP, i, X.end() == X.find(i + 1));
+            }
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERTV(STEP, X == Y);
+
+            for (int i = 0; i < 200; i += 2) {
+                ASSERTV(STEP, i, 1 == mX.erase(i));
+            }
+            ASSERTV(STEP, 100 == X.size());
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(STEP, i, (i % 2) == static_cast<int>(X.count(i)));
+            }
+        }
+
+        if (verbose) printf("\tTesting that a rehash completes in time.\n");
+        {
+            typedef bsl::unordered_map<int, int> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.max_load_factor(0.25f);
+            mX.setIncrementalRehashStep(1);
+
+            // The first insertion allocates the initial bucket array without
+            // an incremental rehash.  Thereafter, a rehash changes
+            // 'bucket_count' once it has cleared the new bucket array.  A
+            // rehash still in progress when the map next grows would be
+            // completed by that growth, which would then change
+            // 'bucket_count' without a new rehash being observed to begin.
+
+            mX[0] = 0;
+
+            int    numRehashes      = 0;
+            int    numBucketChanges = 0;
+            size_t bucketCount      = X.bucket_count();
+            bool   wasInProgress    = false;
+
+            for (int i = 1; i < 5000; ++i) {
+                mX[i] = i;
+
+                if (X.isRehashInProgress() && !wasInProgress) {
+                    ++numRehashes;
+                }
+                wasInProgress = X.isRehashInProgress();
+
+                if (bucketCount != X.bucket_count()) {
+                    bucketCount = X.bucket_count();
+                    ++numBucketChanges;
+                }
+            }
+
+            mX.completeRehash();
+            if (bucketCount != X.bucket_count()) {
+                ++numBucketChanges;
+            }
+
+            ASSERTV(numRehashes, 4 < numRehashes);
+            ASSERTV(numRehashes, numBucketChanges,
+                    numRehashes == numBucketChanges);
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 44: {
+        // --------------------------------------------------------------------
+        // TESTING 'findMany'
+        //
+        // Concerns:
+        //: 1 'findMany' writes, for each key in the range, the same iterator
+        //:   that 'find' returns for that key, in the order of the keys.
+        //:
+        //: 2 Keys that are absent, repeated, or that collide with other keys
+        //:   in the same bucket are handled correctly.
+        //:
+        //: 3 Ranges longer than one internal batch are handled correctly.
+        //:
+        //: 4 'findMany' works on a map that has never allocated a bucket
+        //:   array, and on an empty range of keys.
+        //:
+        //: 5 The returned output iterator is positioned one past the last
+        //:   iterator written.
+        //:
+        //: 6 Iterators written by the non-'const' overload can be used to
+        //:   modify the mapped values.
+        //:
+        //: 7 No memory is allocated.
+        //
+        // Plan:
+        //: 1 For a series of map sizes, populate a map with even keys, and
+        //:   look up a sequence of even (present) and odd (absent) keys,
+        //:   including repetitions, using both overloads.  Compare each
+        //:   result with that of 'find', and verify that no memory is
+        //:   allocated.  Repeat with a hash functor that maps every key onto
+        //:   one of four hash values.  (C-1..3, 5, 7)
+        //:
+        //: 2 Call 'findMany' on a default-constructed map and with an empty
+        //:   range.  (C-4)
+        //:
+        //: 3 Assign through the iterators written by the non-'const'
+        //:   overload, and verify the mapped values of the map.  (C-6)
+        //
+        // Testing:
+        //   OUTPUT_ITERATOR findMany(KEY_ITERATOR, KEY_ITERATOR, OUTPUT_IT);
+        //   OUTPUT_ITERATOR findMany(KEY_IT, KEY_IT, OUTPUT_ITERATOR) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'findMany'"
+                            "\n==================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const int SIZES[]   = { 0, 1, 2, 15, 16, 17, 33, 100, 500 };
+        const int        NUM_SIZES = static_cast<int>(sizeof SIZES
+                                                      / sizeof *SIZES);
+
+        if (verbose) printf("\tTesting with 'bsl::hash'.\n");
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            typedef bsl::unordered_map<int, int> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX[2 * i] = i;
+            }
+
+            bsl::vector<int> keys(&oa);
+            for (int i = 0; i < 2 * SIZE + 3; ++i) {
+                keys.push_back(i);
+                if (0 == i % 7) {
+                    keys.push_back(i);
+                }
+            }
+
+            bsl::vector<Obj::iterator>       results(keys.size(), &oa);
+            bsl::vector<Obj::const_iterator> cresults(keys.size(), &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            typedef bsl::vector<Obj::iterator>::iterator       ResultIt;
+            typedef bsl::vector<Obj::const_iterator>::iterator CResultIt;
+
+            ResultIt  rEnd  = mX.findMany(keys.begin(),
+                                          keys.end(),
+                                          results.begin());
+            CResultIt crEnd =  X.findMany(keys.begin(),
+                                          keys.end(),
+                                          cresults.begin());
+
+            ASSERTV(SIZE, oam.isTotalSame());
+            ASSERTV(SIZE, results.end()  == rEnd);
+            ASSERTV(SIZE, cresults.end() == crEnd);
+
+            for (size_t i = 0; i < keys.size(); ++i) {
+                ASSERTV(SIZE, i, mX.find(keys[i]) == results[i]);
+                ASSERTV(SIZE, i,  X.find(keys[i]) == cresults[i]);
+                ASSERTV(SIZE, i, (keys[i] % 2 || keys[i] >= 2 * SIZE) ==
+                                                     (X.end() == cresults[i]));
+            }
+
+            for (size_t i = 0; i < keys.size(); ++i) {
+                if (mX.end() != results[i]) {
+                    results[i]->second = -keys[i];
+                }
+            }
+            for (int i = 0; i < SIZE; ++i) {
+                ASSERTV(SIZE, i, -2 * i == X.find(2 * i)->second);
+            }
+        }
+
+        if (verbose) printf("\tTesting with colliding keys.\n");
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            typedef bsl::unordered_map<int, int, ModuloFourHash> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX[2 * i] = i;
+            }
+
+            bsl::vector<int> keys(&oa);
+            for (int i = 2 * SIZE + 2; i >= 0; --i) {
+                keys.push_back(i);
+            }
+
+            bsl::vector<Obj::const_iterator> cresults(&oa);
+
+            X.findMany(keys.begin(),
+                       keys.end(),
+                       bsl::back_inserter(cresults));
+
+            ASSERTV(SIZE, keys.size() == cresults.size());
+            for (size_t i = 0; i < keys.size(); ++i) {
+                ASSERTV(SIZE, i, X.find(keys[i]) == cresults[i]);
+            }
+        }
+
+        if (verbose) printf("\tTesting a map without buckets.\n");
+        {
+            typedef bsl::unordered_map<int, int> Obj;
+
+            const Obj X(&oa);
+
+            const int KEYS[] = { 0, 1, 2, 3 };
+            enum { NUM_KEYS = sizeof KEYS / sizeof *KEYS };
+
+            Obj::const_iterator results[NUM_KEYS];
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            ASSERT(results + NUM_KEYS == X.findMany(KEYS,
+                                                    KEYS + NUM_KEYS,
+                                                    results));
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, X.end() == results[i]);
+            }
+
+            ASSERT(results == X.findMany(KEYS, KEYS, results));
+
+            ASSERT(oam.isTotalSame());
+        }
+      } break;
       case 43: {
         // --------------------------------------------------------------------
         // TESTING 'TRY_EMPLACE' AND 'INSERT_OR_ASSIGN'
@@ -10214,6 +10642,63 @@ int main(int argc, char *argv[])
                    "\n==============================================\n",
                    test);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // WORST-CASE INSERT LATENCY
+        //
+        // Concerns:
+        //: 1 Incremental rehash bounds the cost of the insertion that grows
+        //:   the map, at a modest cost in total insertion time.
+        //
+        // Plan:
+        //: 1 Insert 'N' (2^21 by default, or the second command-line
+        //:   argument) keys into maps with incremental rehash disabled and
+        //:   with a series of steps, timing each insertion, and report the
+        //:   total and the longest insertion time.
+        //
+        // Testing:
+        //   WORST-CASE INSERT LATENCY
+        // --------------------------------------------------------------------
+
+        printf("\nWORST-CASE INSERT LATENCY"
+               "\n=========================\n");
+
+        const int N = argc > 2 ? atoi(argv[2]) : 1 << 21;
+
+        static const int STEPS[]   = { 0, 1, 4, 16, 64 };
+        const int        NUM_STEPS = static_cast<int>(sizeof STEPS
+                                                      / sizeof *STEPS);
+
+        bsls::TimeUtil::initialize();
+
+        for (int ti = 0; ti < NUM_STEPS; ++ti) {
+            const int STEP = STEPS[ti];
+
+            bsl::unordered_map<int, int> mX;
+
+            mX.setIncrementalRehashStep(STEP);
+
+            bsls::Types::Int64 maxTime = 0;
+
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < N; ++i) {
+                const bsls::Types::Int64 t0 = bsls::TimeUtil::getTimer();
+                mX[i] = i;
+                const bsls::Types::Int64 t1 = bsls::TimeUtil::getTimer();
+
+                if (t1 - t0 > maxTime) {
+                    maxTime = t1 - t0;
+                }
+            }
+            const bsls::Types::Int64 total =
+                                          bsls::TimeUtil::getTimer() - start;
+
+            printf("step: %4d  total: %8.3fms  max insert: %8.3fms\n",
+                   STEP,
+                   static_cast<double>(total)   / 1.0e6,
+                   static_cast<double>(maxTime) / 1.0e6);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;